@@ -22,9 +22,13 @@ d		:= $(dir)
 # Local rules and target
 CORE_SRC_$(d)	:= \
                    $(d)/logged_vector_control.cc $(d)/logged_vector_control.h \
+                   $(d)/sample_server.cc $(d)/sample_server.h \
+                   $(d)/shared_logged_vector.cc $(d)/shared_logged_vector.h \
 
 CORE_OBJS_$(d)	:=  \
                    $(d)/logged_vector_control.o \
+                   $(d)/sample_server.o \
+                   $(d)/shared_logged_vector.o \
 
 CORE_DEPS_$(d)	:= $(CORE_OBJS_$(d):%=%.d)
 
@@ -0,0 +1,261 @@
+// -*- coding: utf-8 -*-
+#include "sample_server.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <new>
+#include <cstring>
+#include <cerrno>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+/** Read exactly size bytes, return false on end of stream or error */
+static bool
+read_full( int fd, void *buffer, size_t size )
+{
+  char *p = (char *) buffer;
+  while( size > 0 ) {
+    ssize_t n = read( fd, p, size );
+    if( n <= 0 ) return false;
+    p += n;
+    size -= n;
+  }
+  return true;
+}
+/******************************************************************************************/
+SampleServer::SampleServer( const std::string &path, size_t capacity,
+                            unsigned int max_width )
+{
+  _path = path;
+  _capacity = capacity;
+  _max_width = max_width;
+  _listen_fd = -1;
+  _stop = false;
+  _queued = 0;
+  _acceptor = 0;
+}
+SampleServer::~SampleServer()
+{
+  stop();
+}
+/******************************************************************************************/
+std::string
+SampleServer::dumpToString()
+{
+  std::stringstream ss;
+
+  ss << "SampleServer::dumpToString()\n";
+  ss << "path=" << _path << " capacity=" << _capacity << " max_width=" << _max_width;
+  ss << " connections=" << _fds.size() << " queued=" << _queued << "\n";
+
+  return ss.str();
+}
+/******************************************************************************************/
+void
+SampleServer::add_model( unsigned int channel, LoggedVectorPtr model )
+{
+  _models[channel] = model;
+}
+void
+SampleServer::add_curve( unsigned int channel, CurvePtr curve )
+{
+  _curves[channel] = curve;
+}
+/******************************************************************************************/
+void
+SampleServer::start()
+{
+  struct sockaddr_un address;
+  if( _path.size() >= sizeof(address.sun_path) ) {
+    throw std::invalid_argument( "SampleServer: socket path is too long" );
+  }
+  memset( &address, 0, sizeof(address) );
+  address.sun_family = AF_UNIX;
+  strcpy( address.sun_path, _path.c_str() );
+
+  _listen_fd = socket( AF_UNIX, SOCK_STREAM, 0 );
+  if( _listen_fd < 0 ) {
+    throw std::runtime_error( "SampleServer: cannot create socket" );
+  }
+  unlink( _path.c_str() );
+  if( (bind( _listen_fd, (struct sockaddr *) &address, sizeof(address) ) != 0) ||
+      (listen( _listen_fd, 16 ) != 0) ) {
+    close( _listen_fd );
+    _listen_fd = -1;
+    throw std::runtime_error( "SampleServer: cannot listen on " + _path );
+  }
+  _stop = false;
+  _acceptor = new boost::thread( &SampleServer::accept_loop, this );
+}
+void
+SampleServer::stop()
+{
+  {
+    boost::mutex::scoped_lock lock( _mutex );
+    if( _listen_fd < 0 ) return;
+    _stop = true;
+    shutdown( _listen_fd, SHUT_RDWR );
+    for( unsigned int i=0; i<_fds.size(); i++) {
+      shutdown( _fds[i], SHUT_RDWR );
+    }
+  }
+  _not_full.notify_all();
+  // Acceptor is joined first, readers cannot be added past this point
+  _acceptor->join();
+  delete _acceptor;
+  _acceptor = 0;
+  for( std::map<boost::thread::id, boost::thread *>::iterator it = _readers.begin();
+       it != _readers.end(); it++ ) {
+    it->second->join();
+    delete it->second;
+  }
+  _readers.clear();
+  _finished.clear();
+  close( _listen_fd );
+  _listen_fd = -1;
+  unlink( _path.c_str() );
+}
+/******************************************************************************************/
+unsigned int
+SampleServer::poll()
+{
+  std::deque<T_Batch> batches;
+  {
+    boost::mutex::scoped_lock lock( _mutex );
+    batches.swap( _queue );
+    _queued = 0;
+  }
+  _not_full.notify_all();
+
+  unsigned int nb_samples = 0;
+  std::map<unsigned int, LoggedVectorPtr> updated;
+  for( unsigned int b=0; b<batches.size(); b++) {
+    T_Batch &batch = batches[b];
+    unsigned int dim = batch.width - 1;
+    unsigned int nb = batch.values.size() / batch.width;
+    nb_samples += nb;
+
+    std::map<unsigned int, LoggedVectorPtr>::iterator model = _models.find( batch.channel );
+    if( model != _models.end() ) {
+      for( unsigned int i=0; i<nb; i++) {
+        const float *sample = &batch.values[i*batch.width];
+        LoggedVector::T_Logged new_data = {sample[0],
+                                           Eigen::Map<const LoggedVector::T_Vect>( sample+1, dim )};
+        model->second->_data.push_back( new_data );
+      }
+      updated[batch.channel] = model->second;
+    }
+
+    std::map<unsigned int, CurvePtr>::iterator curve = _curves.find( batch.channel );
+    if( (curve != _curves.end()) && (dim > 0) ) {
+      for( unsigned int i=0; i<nb; i++) {
+        const float *sample = &batch.values[i*batch.width];
+        if( dim == 1 )
+          curve->second->add_xyz( sample[0], sample[1], 0.0 );
+        else if( dim == 2 )
+          curve->second->add_xyz( sample[0], sample[1], sample[2] );
+        else
+          curve->second->add_xyz( sample[1], sample[2], sample[3] );
+      }
+    }
+  }
+
+  // Notify once per model
+  for( std::map<unsigned int, LoggedVectorPtr>::iterator it = updated.begin();
+       it != updated.end(); it++ ) {
+    it->second->notify_observers();
+  }
+  return nb_samples;
+}
+/******************************************************************************************/
+void
+SampleServer::accept_loop()
+{
+  while( true ) {
+    int fd = accept( _listen_fd, 0, 0 );
+    int error = errno;
+    reap();
+    boost::mutex::scoped_lock lock( _mutex );
+    if( _stop ) {
+      if( fd >= 0 ) close( fd );
+      return;
+    }
+    if( fd < 0 ) {
+      if( (error == EINTR) || (error == ECONNABORTED) ) continue;
+      // Out of descriptors or memory: wait for connections to close rather
+      // than spinning, any other error means the socket is unusable
+      if( (error != EMFILE) && (error != ENFILE) &&
+          (error != ENOBUFS) && (error != ENOMEM) ) return;
+      lock.unlock();
+      boost::this_thread::sleep( boost::posix_time::milliseconds( 100 ));
+      continue;
+    }
+    _fds.push_back( fd );
+    boost::thread *reader = new boost::thread( &SampleServer::read_loop, this, fd );
+    _readers[reader->get_id()] = reader;
+  }
+}
+void
+SampleServer::reap()
+{
+  std::vector<boost::thread::id> finished;
+  {
+    boost::mutex::scoped_lock lock( _mutex );
+    finished.swap( _finished );
+  }
+  for( unsigned int i=0; i<finished.size(); i++) {
+    std::map<boost::thread::id, boost::thread *>::iterator it = _readers.find( finished[i] );
+    if( it == _readers.end() ) continue;
+    it->second->join();
+    delete it->second;
+    _readers.erase( it );
+  }
+}
+void
+SampleServer::read_loop( int fd )
+{
+  while( true ) {
+    unsigned int header[4];
+    if( not read_full( fd, header, sizeof(header) )) break;
+    // Bad frames close the connection, so do batches that could never be
+    // queued: sizes come from the peer and are checked before allocating
+    if( (header[0] != MAGIC) || (header[3] == 0) || (header[3] > _max_width) ||
+        (header[2] > _capacity / (header[3] * sizeof(float))) ) break;
+    if( header[2] == 0 ) continue;
+
+    T_Batch batch;
+    batch.channel = header[1];
+    batch.width = header[3];
+    try {
+      batch.values.resize( (size_t) header[2] * header[3] );
+    }
+    catch( std::bad_alloc &e ) {
+      break;
+    }
+    if( not read_full( fd, &batch.values[0], batch.values.size() * sizeof(float) )) break;
+    if( not push( batch )) break;
+  }
+
+  boost::mutex::scoped_lock lock( _mutex );
+  _fds.erase( std::find( _fds.begin(), _fds.end(), fd ));
+  _finished.push_back( boost::this_thread::get_id() );
+  close( fd );
+}
+bool
+SampleServer::push( T_Batch &batch )
+{
+  size_t bytes = batch.values.size() * sizeof(float);
+  boost::mutex::scoped_lock lock( _mutex );
+  while( (not _stop) && (_queued > 0) && (_queued + bytes > _capacity) ) {
+    _not_full.wait( lock );
+  }
+  if( _stop ) return false;
+  _queue.push_back( T_Batch() );
+  _queue.back().channel = batch.channel;
+  _queue.back().width = batch.width;
+  _queue.back().values.swap( batch.values );
+  _queued += bytes;
+  return true;
+}
+/******************************************************************************************/
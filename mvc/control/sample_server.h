@@ -0,0 +1,128 @@
+// -*- coding: utf-8 -*-
+#ifndef __SAMPLE_SERVER_H
+#define __SAMPLE_SERVER_H
+
+#include <string>
+#include <iostream>
+#include <vector>
+#include <deque>
+#include <map>
+#include <boost/thread.hpp>
+
+#include "logged_vector.h"
+#include "curve.h"
+
+#ifdef HAVE_BOOST
+    typedef boost::shared_ptr<class SampleServer> SampleServerPtr;
+#else
+    typedef class SampleServer * SampleServerPtr;
+#endif
+
+/**
+ * Receive samples from external producers over a Unix domain socket.
+ *
+ * Producers that cannot link libscigl (Python, Julia, ...) connect to the
+ * socket and send frames made of a header of four native 32 bits unsigned
+ * integers followed by float samples:
+ *   - magic (SampleServer::MAGIC)
+ *   - channel the samples are for
+ *   - number of samples
+ *   - number of floats per sample (the time followed by values)
+ *
+ * Each connection is read by its own thread which queues received batches,
+ * threads of closed connections are joined when the next one is accepted.
+ * The queue is bounded in bytes: when it is full, reader threads stop reading
+ * until it is drained such that producers are slowed down by the socket
+ * instead of memory growing without limits. Frames are checked before any
+ * allocation: a frame whose samples are wider than max_width floats or which
+ * could never fit in the queue closes its connection.
+ *
+ * Queued batches are appended to models (LoggedVector) and curves (Curve)
+ * registered for their channel when poll() is called, typically from the
+ * graphic loop, such that models and curves are only modified by the thread
+ * rendering them. Observers of a model are notified once per poll.
+ */
+class SampleServer
+{
+ public:
+  /** Frame magic number ("SGLS") */
+  static const unsigned int MAGIC = 0x534c4753;
+
+ public:
+  /** Create: listen on socket path, queueing at most capacity bytes of
+   * samples made of at most max_width floats */
+  SampleServer( const std::string &path, size_t capacity = 16 << 20,
+                unsigned int max_width = 64 );
+  /** Destruction (stops the server) */
+  ~SampleServer();
+
+  /** dump to STR */
+  std::string dumpToString();
+
+  /** Samples of channel are appended to model */
+  void add_model( unsigned int channel, LoggedVectorPtr model );
+  /** Samples of channel are added to curve as (t,v0,0), (t,v0,v1) or (v0,v1,v2) */
+  void add_curve( unsigned int channel, CurvePtr curve );
+
+  /** Start accepting connections */
+  void start();
+  /** Close all connections and stop accepting new ones */
+  void stop();
+
+  /** Append queued samples to models and curves, return number of samples */
+  unsigned int poll();
+
+ public:
+  /** Batch of samples received for a channel */
+  struct S_Batch {
+    unsigned int channel;
+    unsigned int width;
+    std::vector<float> values;
+  };
+  typedef struct S_Batch T_Batch;
+
+ public:
+  /** Socket path */
+  std::string _path;
+  /** Maximum number of queued bytes */
+  size_t _capacity;
+  /** Maximum number of floats per sample */
+  unsigned int _max_width;
+  /** Models by channel */
+  std::map<unsigned int, LoggedVectorPtr> _models;
+  /** Curves by channel */
+  std::map<unsigned int, CurvePtr> _curves;
+
+ protected:
+  /** Accept connections until stopped */
+  void accept_loop();
+  /** Read frames from a connection until closed */
+  void read_loop( int fd );
+  /** Join and delete reader threads that have finished */
+  void reap();
+  /** Queue a batch, waiting while queue is full */
+  bool push( T_Batch &batch );
+
+ protected:
+  /** Listening socket */
+  int _listen_fd;
+  /** Open connections */
+  std::vector<int> _fds;
+  /** Whether server is stopping */
+  bool _stop;
+  /** Queued batches */
+  std::deque<T_Batch> _queue;
+  /** Number of queued bytes */
+  size_t _queued;
+  /** Protect queue, connections and stop flag */
+  boost::mutex _mutex;
+  /** Signalled when queue is drained */
+  boost::condition_variable _not_full;
+  /** Accept thread */
+  boost::thread *_acceptor;
+  /** Reader threads, only touched by accept thread (and stop once it ended) */
+  std::map<boost::thread::id, boost::thread *> _readers;
+  /** Readers that have finished, waiting to be reaped */
+  std::vector<boost::thread::id> _finished;
+};
+#endif //__SAMPLE_SERVER_H
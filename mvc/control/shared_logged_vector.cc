@@ -0,0 +1,64 @@
+// -*- coding: utf-8 -*-
+#include "shared_logged_vector.h"
+
+/******************************************************************************************/
+SharedLoggedVector::SharedLoggedVector( SharedRingPtr ring, LoggedVectorPtr model )
+{
+  _ring = ring;
+  _model = model;
+  _last = 0;
+  _lost = 0;
+}
+SharedLoggedVector::~SharedLoggedVector()
+{
+}
+/******************************************************************************************/
+std::string
+SharedLoggedVector::dumpToString()
+{
+  std::stringstream ss;
+
+  ss << "SharedLoggedVector::dumpToString()\n";
+  ss << "ring=" << _ring->get_name() << " last=" << _last << " lost=" << _lost << "\n";
+
+  return ss.str();
+}
+/******************************************************************************************/
+unsigned int
+SharedLoggedVector::poll()
+{
+  unsigned long head = _ring->get_head();
+  if( head == _last ) return 0;
+
+  // Older samples have already been overwritten
+  unsigned long first = _last + 1;
+  if( head - _last > _ring->get_slots() ) {
+    first = head - _ring->get_slots() + 1;
+  }
+  _lost += first - (_last + 1);
+
+  unsigned int nb_added = 0;
+  for( unsigned long s = first; s <= head; s++ ) {
+    SharedRing::Record record;
+    if( (not _ring->get( s, record )) || (record.type != GL_FLOAT) ) {
+      _lost++;
+      continue;
+    }
+    unsigned int size = record.width * record.height * record.depth;
+    LoggedVector::T_Vect v = Eigen::Map<const LoggedVector::T_Vect>( (const float *) record.data, size );
+    if( not _ring->validate( record )) {
+      _lost++;
+      continue;
+    }
+    LoggedVector::T_Logged new_data = {(LoggedVector::T_Time) record.time, v};
+    _model->_data.push_back( new_data );
+    nb_added++;
+  }
+  _last = head;
+
+  if( nb_added > 0 ) {
+    _model->notify_observers();
+  }
+  return nb_added;
+}
+/******************************************************************************************/
@@ -0,0 +1,49 @@
+// -*- coding: utf-8 -*-
+#ifndef __SHARED_LOGGED_VECTOR_H
+#define __SHARED_LOGGED_VECTOR_H
+
+#include <string>
+#include <iostream>
+
+#include "logged_vector.h"
+#include "shared-ring.h"
+
+#ifdef HAVE_BOOST
+    typedef boost::shared_ptr<class SharedLoggedVector> SharedLoggedVectorPtr;
+#else
+    typedef class SharedLoggedVector * SharedLoggedVectorPtr;
+#endif
+
+/**
+ * Feed a LoggedVector with samples published in a SharedRing by another
+ * process (see SharedRing::publish( time, values, count)).
+ *
+ * Samples published since last poll are appended at once, observers being
+ * notified only once per poll. Samples overwritten before being polled are
+ * counted as lost.
+ */
+class SharedLoggedVector
+{
+ public:
+  /** Create: from ring and model */
+  SharedLoggedVector( SharedRingPtr ring, LoggedVectorPtr model );
+  /** Destruction */
+  ~SharedLoggedVector();
+
+  /** dump to STR */
+  std::string dumpToString();
+
+  /** Append new samples to model, return number of appended samples */
+  unsigned int poll();
+
+ public:
+  /** Ring samples are read from */
+  SharedRingPtr _ring;
+  /** Model samples are appended to */
+  LoggedVectorPtr _model;
+  /** Sequence number of last polled sample */
+  unsigned long _last;
+  /** Number of lost samples */
+  unsigned long _lost;
+};
+#endif //__SHARED_LOGGED_VECTOR_H
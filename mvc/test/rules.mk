@@ -29,6 +29,7 @@ d		:= $(dir)
 CORE_SRC_$(d)	:= $(DIR_PROJET)/$(d)/test_logged_vector.cc \
                    $(DIR_PROJET)/$(d)/test_logged_vector_scigl.cc \
                    $(DIR_PROJET)/$(d)/skel_scigl.cc \
+                   $(DIR_PROJET)/$(d)/test_table_reader.cc \
 
 CORE_OBJS_$(d)	:= 
 
@@ -37,7 +38,8 @@ CORE_DEPS_$(d)	:= $(CORE_OBJS_$(d):%=%.d)
 
 TGTS_$(d)	:= $(d)/test_logged_vector \
                    $(d)/test_logged_vector_scigl \
-                   $(d)/skel_scigl
+                   $(d)/skel_scigl \
+                   $(d)/test_table_reader
 
 DEPS_$(d)	:= $(TGTS_$(d):%=%.d)
 
@@ -108,6 +110,11 @@ $(d)/skel_scigl:	 	$(d)/skel_scigl.cc model/libmodel.a view/libview.a $(SCIGL_RO
 				$(COMPLINK)
 
 
+$(d)/test_table_reader:	$(d)/test_table_reader.cc $(SCIGL_ROOT)/scigl/libscigl.a
+				@echo "===== Compiling and Linking $@"
+				$(COMPLINK)
+
+
 .PHONY : verbose_$(d)
 verbose_$(d): $(TGTS_$(d))
 	@echo "**** Generating $^"
@@ -22,9 +22,6 @@ LoggedVectorPtr _vec_model = LoggedVectorPtr( new LoggedVector );
 LoggedVectorSciglPtr _vec_obs1 = LoggedVectorSciglPtr( new LoggedVectorScigl(_vec_model));
 LoggedVectorSciglPtr _vec_obs2 = LoggedVectorSciglPtr( new LoggedVectorScigl(_vec_model));
 
-// Slow down things
-boost::posix_time::millisec td(1);
-
 // ------------------------------------------------------------------------------------
 // ------------------------------------------------------------------------------------
 /**
@@ -83,6 +80,15 @@ void on_key_pressed( int key, int action)
     _scene->set_orientation( 0, 0);
   }
 }
+/**
+ * Called when the window needs to be redrawn (exposed...).
+ * see glfwSetWindowRefreshCallback().
+ */
+void on_refresh( void )
+{
+  _scene->set_dirty();
+}
+
 /**
  * Compute what is to be drawn.
  */
@@ -126,6 +132,7 @@ void init_graphic()
   
   glfwSetMouseButtonCallback( on_mouse_button );
   glfwSetMousePosCallback( on_mouse_move );
+  glfwSetWindowRefreshCallback( on_refresh );
   glfwSetKeyCallback( on_key_pressed );
 
   // Background color for scene
@@ -168,6 +175,7 @@ void run_graphic()
 {
   // Some graphic parameters
   int width, height;
+  int drawn_width = 0, drawn_height = 0;
 
   // Main loop of GLFW
   int nb_iter = 0;
@@ -177,7 +185,7 @@ void run_graphic()
     // Special case: avoid division by zero below
     height = height > 0 ? height : 1;
     
-    glViewport( 0, 0, width, height );
+    RenderState::viewport( 0, 0, width, height );
 
     // add to _vec_model
     if( nb_iter % 10 == 0 ) {
@@ -188,9 +196,17 @@ void run_graphic()
       _vec_model->add_vector( nb_iter, new_v );
     }
   
-    // display
-    display();
-    boost::this_thread::sleep(td);
+    // display only when something changed, poll events otherwise
+    if( (width != drawn_width) || (height != drawn_height) ||
+        _scene->needs_redraw() ) {
+      display();
+      drawn_width = width;
+      drawn_height = height;
+    }
+    else {
+      glfwPollEvents();
+      glfwSleep( 0.01 );
+    }
     
     nb_iter++;
 
@@ -26,9 +26,6 @@ LoggedVectorPtr _vec_model = LoggedVectorPtr( new LoggedVector );
 LoggedVectorSciglPtr _vec_obs1;
 LoggedVectorSciglPtr _vec_obs2;
 
-// Slow down things
-boost::posix_time::millisec td(1);
-
 // ------------------------------------------------------------------------------------
 // ------------------------------------------------------------------------------------
 /**
@@ -96,6 +93,15 @@ void on_key_pressed( int key, int action)
     }
   }
 }
+/**
+ * Called when the window needs to be redrawn (exposed...).
+ * see glfwSetWindowRefreshCallback().
+ */
+void on_refresh( void )
+{
+  _scene->set_dirty();
+}
+
 /**
  * Compute what is to be drawn.
  */
@@ -130,6 +136,7 @@ void init_graphic()
   
   glfwSetMouseButtonCallback( on_mouse_button );
   glfwSetMousePosCallback( on_mouse_move );
+  glfwSetWindowRefreshCallback( on_refresh );
   glfwSetKeyCallback( on_key_pressed );
 
   // Background color for scene
@@ -178,6 +185,7 @@ void run_graphic()
 {
   // Some graphic parameters
   int width, height;
+  int drawn_width = 0, drawn_height = 0;
 
   // Main loop of GLFW
   int nb_iter = 0;
@@ -187,7 +195,7 @@ void run_graphic()
     // Special case: avoid division by zero below
     height = height > 0 ? height : 1;
     
-    glViewport( 0, 0, width, height );
+    RenderState::viewport( 0, 0, width, height );
 
     // add to _vec_model
     if( nb_iter % 10 == 0 ) {
@@ -198,9 +206,17 @@ void run_graphic()
       _vec_model->add_vector( nb_iter, new_v );
     }
   
-    // display
-    display();
-    boost::this_thread::sleep(td);
+    // display only when something changed, poll events otherwise
+    if( (width != drawn_width) || (height != drawn_height) ||
+        _scene->needs_redraw() ) {
+      display();
+      drawn_width = width;
+      drawn_height = height;
+    }
+    else {
+      glfwPollEvents();
+      glfwSleep( 0.01 );
+    }
     
     nb_iter++;
 
@@ -0,0 +1,160 @@
+// -*- coding: utf-8 -*-
+/**
+ * Test de parse_number et TableReader
+ * => mantisses longues, exposants au dela de +/-22
+ * => debordement des entiers
+ * => numeros de ligne des erreurs
+ */
+#include <iostream>
+#include <fstream>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include "convert.h"
+#include "table-reader.h"
+
+static unsigned int nb_failed = 0;
+
+void check( bool ok, const std::string &what )
+{
+  std::cout << (ok ? "  ok   " : "  FAIL ") << what << "\n";
+  if( not ok ) nb_failed++;
+}
+
+/** parse_number must give the same double as strtod and consume all of s */
+void check_double( const std::string &s )
+{
+  const char *p = s.c_str();
+  const char *end = p + s.size();
+  double x = 0;
+  bool parsed = parse_number( p, end, x );
+  double expected = strtod( s.c_str(), 0 );
+  check( parsed && (p == end) && (x == expected), "double " + s );
+}
+
+/** parse_number must accept s as an int equal to value */
+void check_int( const std::string &s, int value )
+{
+  const char *p = s.c_str();
+  const char *end = p + s.size();
+  int x = 0;
+  bool parsed = parse_number( p, end, x );
+  check( parsed && (p == end) && (x == value), "int " + s );
+}
+
+/** parse_number must reject s as an int */
+void check_no_int( const std::string &s )
+{
+  const char *p = s.c_str();
+  const char *end = p + s.size();
+  int x = 0;
+  bool parsed = parse_number( p, end, x );
+  check( (not parsed) && (p == s.c_str()), "no int " + s );
+}
+
+void test_parse_number()
+{
+  std::cout << "parse_number\n";
+  // Exact path
+  check_double( "0" );
+  check_double( "-1.5" );
+  check_double( "+3.25e2" );
+  check_double( "1e22" );
+  check_double( "1e-22" );
+  check_double( "0.000001" );
+  // Long mantissas
+  check_double( "3.14159265358979323846264338327950288" );
+  check_double( "1234567890123456789012345678901234567890" );
+  check_double( "0.1000000000000000055511151231257827" );
+  check_double( "9007199254740993" );
+  check_double( "-2.2250738585072011e-308" );
+  check_double( "0." + std::string( 200, '3' ));
+  // Exponents beyond +/-22
+  check_double( "1e23" );
+  check_double( "1e-23" );
+  check_double( "8.5e-30" );
+  check_double( "1.7976931348623157e308" );
+  check_double( "4.9e-324" );
+  check_double( "1e-400" );
+  check_double( "0e999" );
+
+  check_int( "0", 0 );
+  check_int( "-17", -17 );
+  check_int( "2147483647", 2147483647 );
+  check_int( "-2147483648", -2147483647 - 1 );
+  // Integer overflow
+  check_no_int( "2147483648" );
+  check_no_int( "-2147483649" );
+  check_no_int( "99999999999999999999" );
+  check_no_int( "-" );
+  check_no_int( "x1" );
+}
+
+void test_table_reader()
+{
+  std::cout << "TableReader\n";
+  std::string filename = "/tmp/test_table_reader.csv";
+  {
+    std::ofstream out( filename.c_str() );
+    out << "time,x,y\n"              // 1: header
+        << "0,1.5,2\n"               // 2
+        << "# comment\n"             // 3
+        << "1,1e23,-4\n"             // 4
+        << "\n"                      // 5
+        << "2,abc,6\n"               // 6: bad value
+        << "3,7\n"                   // 7: missing value
+        << "4,8,9,10\n"              // 8: extra values
+        << "5,2147483648,11\n";      // 9
+  }
+
+  TableReader reader;
+  bool ok = reader.read( filename, GL_DOUBLE );
+  check( not ok, "errors reported" );
+  check( (reader.get_columns() == 3) && (reader.get_rows() == 6), "3 columns, 6 rows" );
+  const std::vector<TableReader::Error> &errors = reader.get_errors();
+  check( (errors.size() == 3) && (reader.get_error_count() == 3), "3 errors" );
+  if( errors.size() == 3 ) {
+    check( (errors[0].line == 6) && (errors[0].column == 2), "bad value at 6:2" );
+    check( (errors[1].line == 7) && (errors[1].column == 3), "missing value at 7:3" );
+    check( (errors[2].line == 8) && (errors[2].column == 4), "extra values at 8:4" );
+  }
+  const double *x = (const double *) reader.get_column( 1 )->get_data();
+  check( (x[0] == 1.5) && (x[1] == 1e23) && (x[5] == 2147483648.0), "double values" );
+  check( x[2] != x[2], "bad value is NaN" );
+
+  {
+    std::ofstream out( filename.c_str() );
+    out << "1 2\n"                       // 1
+        << "2147483647 -2147483648\n"    // 2
+        << "2147483648 3\n"              // 3: integer overflow
+        << "4\n";                        // 4: missing value
+  }
+  ok = reader.read( filename, GL_INT );
+  check( (not ok) && (reader.get_error_count() == 2), "2 errors as int" );
+  if( reader.get_errors().size() == 2 ) {
+    check( (reader.get_errors()[0].line == 3) && (reader.get_errors()[0].column == 1),
+           "int overflow at 3:1" );
+    check( (reader.get_errors()[1].line == 4) && (reader.get_errors()[1].column == 2),
+           "missing value at 4:2" );
+  }
+  const int *xi = (const int *) reader.get_column( 0 )->get_data();
+  const int *yi = (const int *) reader.get_column( 1 )->get_data();
+  check( (xi[1] == 2147483647) && (yi[1] == -2147483647 - 1), "int limits" );
+  check( (xi[2] == 0) && (yi[3] == 0), "int missing value is 0 by default" );
+
+  reader.set_missing( -1 );
+  reader.read( filename, GL_INT );
+  xi = (const int *) reader.get_column( 0 )->get_data();
+  yi = (const int *) reader.get_column( 1 )->get_data();
+  check( (xi[2] == -1) && (yi[3] == -1), "int missing value is -1 when set" );
+
+  remove( filename.c_str() );
+}
+
+int main( int argc, char *argv[] )
+{
+  test_parse_number();
+  test_table_reader();
+  std::cout << (nb_failed ? "--FAILED--\n" : "--END--\n");
+  return nb_failed ? 1 : 0;
+}
@@ -90,6 +90,7 @@ LoggedVectorTxt::toString()
 void
 LoggedVectorScigl::update( int signal )
 {
+  set_dirty();
   // @todo Change ranges
   // @todo if internal data (if visualisation is faster than computation), change internal data
   // @todo maybe useful with threads
@@ -104,6 +105,7 @@ LoggedVectorScigl::attach_to_coord( PlaneCoordPtr plane )
 void
 LoggedVectorScigl::set_thickness( float thickness )
 {
+  set_dirty();
   _thickness = thickness;
 }
 float
@@ -12,6 +12,8 @@ dir	:= scigl
 include		$(dir)/rules.mk
 dir	:= test-glfw
 include		$(dir)/rules.mk
+dir	:= tools
+include		$(dir)/rules.mk
 
 # General directory independent rules
 
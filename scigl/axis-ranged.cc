@@ -60,7 +60,7 @@ AxisRanged::render (void)
         return;
     Object::compute_visibility();
 
-    FontPtr font = Font::Font24();
+    FontPtr font = Font::FontSDF();
     float font_scale = 1/(get_range().major*font->get_glyph_size().x*8);
     float d1 = 0.065;  // major tick size
     float d2 = 0.025; // minor tick size
@@ -73,8 +73,8 @@ AxisRanged::render (void)
     glColor4f (get_fg_color().r, get_fg_color().g, get_fg_color().b, get_fg_color().a*alpha_);
 
     // Position
-    glPushMatrix(); // POS
-    glTranslatef( get_position().x, get_position().y, get_position().z );
+    RenderState::push_matrix(); // POS
+    RenderState::translate( get_position().x, get_position().y, get_position().z );
     
     // Axis
     glLineWidth (2.0f);
@@ -152,7 +152,7 @@ AxisRanged::render (void)
 		  // get_range().min + (get_range().max-get_range().min)*i/get_range().major);
         // old_version Size s = font->size (text);
 	size_t size_text = strlen(text);
-        glPushMatrix(); //TICKSLAB
+        RenderState::push_matrix(); //TICKSLAB
 //         if (get_size().x > 0)
 // 	  glRotatef (180,0,0,1);
         // old_version glTranslatef (get_position().x + i/get_range().major*get_size().x - s.x*font_scale/2,
@@ -164,11 +164,11 @@ AxisRanged::render (void)
 	else {
 	  x_ratio = (i * delta_major) / (max_slide_ - get_range().min);
 	}
-	glTranslatef (x_ratio*get_size().x - size_text*font->get_glyph_size().x *font_scale/2,
+	RenderState::translate (x_ratio*get_size().x - size_text*font->get_glyph_size().x *font_scale/2,
 		      -font->get_glyph_size().y*font_scale - fabs(d1), 0);
-        glScalef (font_scale,font_scale,font_scale);
+        RenderState::scale (font_scale,font_scale,font_scale);
         font->render (text);
-        glPopMatrix(); //TICKSLAB
+        RenderState::pop_matrix(); //TICKSLAB
       }
     glDisable (GL_TEXTURE_2D);
     //}
@@ -221,29 +221,31 @@ AxisRanged::render (void)
 
     // Label
     glEnable (GL_TEXTURE_2D);
-    font_scale = .0025;
-    glPushMatrix(); // LABEL
+    // Label is .07 high (a Font24 glyph scaled by .0025)
+    font_scale = .07/font->get_glyph_size().y;
+    RenderState::push_matrix(); // LABEL
     // old_version Size s = font->size (label_);
     size_t size_label = label_.size();
 //     if (get_size().x > 0)
 //         glRotatef (180,0,0,1);
     // old_version glTranslatef (get_position().x + get_size().x/2 - s.x*font_scale/2,
     // old_version               -2*s.y*font_scale - fabs(d1), 0);
-    glTranslatef (get_size().x/2 - size_label*font->get_glyph_size().x *font_scale/2,
+    RenderState::translate (get_size().x/2 - size_label*font->get_glyph_size().x *font_scale/2,
 		  -2*font->get_glyph_size().y*font_scale - fabs(d1), 0);
-    glScalef (font_scale,font_scale,font_scale);
+    RenderState::scale (font_scale,font_scale,font_scale);
     font->render (label_);
-    glPopMatrix(); //LABEL
+    RenderState::pop_matrix(); //LABEL
 
     glDisable (GL_TEXTURE_2D);
     
-    glPopMatrix(); // POS
+    RenderState::pop_matrix(); // POS
 }
 
 // ============================================================================
 void
 AxisRanged::set_position_x (float x)
 {
+    set_dirty ();
     position_ = Position (x, 0, 0, 0);
 }
 
@@ -252,6 +254,7 @@ AxisRanged::set_position_x (float x)
 void
 AxisRanged::set_size (float x)
 {
+    set_dirty ();
     size_ = Size (x, 0, 0, 0);
 }
 
@@ -259,6 +262,7 @@ AxisRanged::set_size (float x)
 void
 AxisRanged::set_title (std::string label)
 {
+    set_dirty ();
     label_ = label;
 }
 
@@ -272,6 +276,7 @@ AxisRanged::get_title (void)
 void
 AxisRanged::set_range (Range range)
 {
+    set_dirty ();
     range_ = range;
     max_slide_ = range_.max;
 }
@@ -291,11 +296,13 @@ AxisRanged:: get_range (void)
 void
 AxisRanged::set_slide_max( float max_slide )
 {
+    set_dirty ();
   max_slide_ = max_slide;
 }
 void
 AxisRanged::set_sliding( bool flag )
 {
+    set_dirty ();
   _fg_sliding = flag;
 }
 bool
@@ -80,10 +80,10 @@ Axis::render (void)
                get_fg_color().g,
                get_fg_color().b,
                get_fg_color().a*get_alpha());
-    glPushMatrix();
-    glTranslatef(start_.x, start_.y, start_.z);
-    glRotatef (az, 0, ry, rz);
-    glRotatef (orientation_, 1, 0, 0); // Set ticks & labels orientation
+    RenderState::push_matrix();
+    RenderState::translate(start_.x, start_.y, start_.z);
+    RenderState::rotate (az, 0, ry, rz);
+    RenderState::rotate (orientation_, 1, 0, 0); // Set ticks & labels orientation
 
     // Main axis
     // -------------------------------------------------------------------------
@@ -118,34 +118,34 @@ Axis::render (void)
     // -------------------------------------------------------------------------
     glPolygonMode (GL_FRONT_AND_BACK, GL_FILL);
     glEnable (GL_TEXTURE_2D);
-    FontPtr font = FontPtr (Font::Font32());
+    FontPtr font = FontPtr (Font::FontSDF());
     float scale = ticks_fontsize_;
-    glPushMatrix();
-    glScalef (-scale,-scale,scale);
-    glTranslatef (0,-mts/scale, 0);
+    RenderState::push_matrix();
+    RenderState::scale (-scale,-scale,scale);
+    RenderState::translate (0,-mts/scale, 0);
     for (int i=0; i<int(tick_labels_.size()); i++) {
         std::string label = tick_labels_[i];
         if (label.size()) {
             float x = ticks_[i].x;
             float l = (label.size()) * font->get_glyph_size().x;
-            glPushMatrix();
-            glTranslatef (-x*v/scale-l/2, 0.0f, 0.0f);
+            RenderState::push_matrix();
+            RenderState::translate (-x*v/scale-l/2, 0.0f, 0.0f);
             font->render (label);
-            glPopMatrix();
+            RenderState::pop_matrix();
         }
     }
         
     // Title
     // -------------------------------------------------------------------------
-    glTranslatef (-.5*v/scale, -font->get_glyph_size().y, 0);
-    glScalef (title_fontsize_/scale,title_fontsize_/scale,title_fontsize_/scale);
-    glPushMatrix();
-    font->render_ansi_string (title_, get_alpha(), 0);
-    glPopMatrix();
-    glPopMatrix();
+    RenderState::translate (-.5*v/scale, -font->get_glyph_size().y, 0);
+    RenderState::scale (title_fontsize_/scale,title_fontsize_/scale,title_fontsize_/scale);
+    RenderState::push_matrix();
+    font->render_ansi_string (title_, get_fg_color(), get_alpha(), 0);
+    RenderState::pop_matrix();
+    RenderState::pop_matrix();
 
     glDisable (GL_TEXTURE_2D);
-    glPopMatrix();
+    RenderState::pop_matrix();
 }
 
 // _________________________________________________________________________ set
@@ -187,6 +187,7 @@ Axis::set (float min, float max, int major_n, int minor_n,
 void
 Axis::clear (void)
 {
+    set_dirty ();
     ticks_.clear();
     tick_labels_.clear();    
 }
@@ -195,6 +196,7 @@ Axis::clear (void)
 void
 Axis::add (Tick tick, std::string label)
 {
+    set_dirty ();
     ticks_.push_back (tick);
     tick_labels_.push_back (label);
 }
@@ -203,6 +205,7 @@ Axis::add (Tick tick, std::string label)
 void
 Axis::set_title (std::string title)
 {
+    set_dirty ();
     title_ = title;
 }
 
@@ -217,6 +220,7 @@ Axis::get_title (void) const
 void
 Axis::set_start (Position start)
 {
+    set_dirty ();
     start_ = Position (start);
 }
 
@@ -238,6 +242,7 @@ Axis::get_start (void) const
 void
 Axis::set_end (Position end)
 {
+    set_dirty ();
     end_ = Position (end);
 }
 
@@ -266,6 +271,7 @@ Axis::get_ticks_fontsize (void) const
 void
 Axis::set_ticks_fontsize (float size)
 {
+    set_dirty ();
     ticks_fontsize_ = size;
 }
 
@@ -280,6 +286,7 @@ Axis::get_title_fontsize (void) const
 void
 Axis::set_title_fontsize (float size)
 {
+    set_dirty ();
     title_fontsize_ = size;
 }
 
@@ -294,6 +301,7 @@ Axis::get_thickness (void) const
 void
 Axis::set_thickness (float thickness)
 {
+    set_dirty ();
     thickness_ = thickness;
 }
 
@@ -308,5 +316,6 @@ Axis::get_orientation (void) const
 void
 Axis::set_orientation (float orientation)
 {
+    set_dirty ();
     orientation_ = orientation;
 }
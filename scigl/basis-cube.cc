@@ -60,19 +60,18 @@ BasisCube::render()
   else {
   }
 
-  glPushMatrix();
+  RenderState::push_matrix ();
 
   // set global position and size
-  glScalef (get_size().x, get_size().y, get_size().z);
-  glTranslatef (get_position().x, get_position().y, get_position().z);
+  RenderState::scale (get_size().x, get_size().y, get_size().z);
+  RenderState::translate (get_position().x, get_position().y, get_position().z);
 
   // need to decide which plane to draw first (farther Z from point of view)
 
   /* z sorting is done on faces center */
   PlanIndex first, second;
   float z[3];
-  float m[16];
-  glGetFloatv (GL_MODELVIEW_MATRIX, m);
+  const float *m = RenderState::get_modelview ();
   // Oxy center is (0.5, 0.5, plan_pos_.z)
   z[PLAN_OXY] = 0.5 * m[2]
                     + 0.5 * m[6]
@@ -112,7 +111,7 @@ BasisCube::render()
       render_plane (PLAN_OZX);
     }
   }
-  glPopMatrix();
+  RenderState::pop_matrix ();
 }
 void
 BasisCube::render_plane (PlanIndex plan_name)
@@ -121,48 +120,51 @@ BasisCube::render_plane (PlanIndex plan_name)
     {
     case PLAN_OXY:  
       // Oxy
-      glPushMatrix();
-      glTranslatef ( 0, 0, plan_pos_.z );
+      RenderState::push_matrix ();
+      RenderState::translate (0, 0, plan_pos_.z);
       get_plane (PLAN_OXY)->render();
-      glPopMatrix();
+      RenderState::pop_matrix ();
       break;
     case PLAN_OYZ:
       // Oyz
-      glPushMatrix();
-      glRotatef (90, 0, 0, 1);
-      glRotatef (90, 1, 0, 0);
-      glTranslatef ( 0, 0, plan_pos_.x );
+      RenderState::push_matrix ();
+      RenderState::rotate (90, 0, 0, 1);
+      RenderState::rotate (90, 1, 0, 0);
+      RenderState::translate (0, 0, plan_pos_.x);
       get_plane (PLAN_OYZ)->render();
-      glPopMatrix();
+      RenderState::pop_matrix ();
       break;
     case PLAN_OZX:
       // Ozx
-      glPushMatrix();
-      glRotatef (90, 0, 0, 1);
-      glRotatef (90, 1, 0, 0);
-      glRotatef (90, 0, 0, 1);
-      glRotatef (90, 1, 0, 0);
-      glTranslatef ( 0, 0, plan_pos_.y );
+      RenderState::push_matrix ();
+      RenderState::rotate (90, 0, 0, 1);
+      RenderState::rotate (90, 1, 0, 0);
+      RenderState::rotate (90, 0, 0, 1);
+      RenderState::rotate (90, 1, 0, 0);
+      RenderState::translate (0, 0, plan_pos_.y);
       get_plane (PLAN_OZX)->render();
-      glPopMatrix();
+      RenderState::pop_matrix ();
     }
 }
 // ============================================================================
 void
 BasisCube::set_range_coord_x (Range range)
 {
+  set_dirty();
   get_plane (PLAN_OXY)->set_range_coord1 (range);
   get_plane (PLAN_OZX)->set_range_coord2 (range);
 }
 void
 BasisCube::set_range_coord_y (Range range)
 {
+  set_dirty();
   get_plane (PLAN_OXY)->set_range_coord2 (range);
   get_plane (PLAN_OYZ)->set_range_coord1 (range);
 }
 void
 BasisCube::set_range_coord_z (Range range)
 {
+  set_dirty();
   get_plane (PLAN_OYZ)->set_range_coord2 (range);
   get_plane (PLAN_OZX)->set_range_coord1 (range);
 }
@@ -186,18 +188,21 @@ BasisCube::get_range_coord_z (void)
 void
 BasisCube::set_title_coord_x (std::string label)
 {
+  set_dirty();
   get_plane (PLAN_OXY)->set_title_coord1 (label);
   get_plane (PLAN_OZX)->set_title_coord2 (label);
 }
 void
 BasisCube::set_title_coord_y (std::string label)
 {
+  set_dirty();
   get_plane (PLAN_OXY)->set_title_coord2 (label);
   get_plane (PLAN_OYZ)->set_title_coord1 (label);
 }
 void
 BasisCube::set_title_coord_z (std::string label)
 {
+  set_dirty();
   get_plane (PLAN_OYZ)->set_title_coord2 (label);
   get_plane (PLAN_OZX)->set_title_coord1 (label);
 }
@@ -208,6 +213,7 @@ BasisCube::set_sides_type_Oxy ( PlaneCoord::SideType side_1,
 				PlaneCoord::SideType side_3,
 				PlaneCoord::SideType side_4)
 {
+  set_dirty();
   get_plane (PLAN_OXY)->set_sides_type (side_1, side_2, side_3, side_4);
 }
 void
@@ -216,6 +222,7 @@ BasisCube::set_sides_type_Oyz ( PlaneCoord::SideType side_1,
 				PlaneCoord::SideType side_3,
 				PlaneCoord::SideType side_4)
 {
+  set_dirty();
   get_plane (PLAN_OYZ)->set_sides_type (side_1, side_2, side_3, side_4);
 }
 void
@@ -224,22 +231,26 @@ BasisCube::set_sides_type_Ozx ( PlaneCoord::SideType side_1,
 				PlaneCoord::SideType side_3,
 				PlaneCoord::SideType side_4)
 {
+  set_dirty();
   get_plane (PLAN_OZX)->set_sides_type (side_1, side_2, side_3, side_4);
 }
 // ============================================================================
 void
 BasisCube::set_position_Oxy (float z)
 {
+  set_dirty();
   plan_pos_.z = z;
 }
 void
 BasisCube::set_position_Oyz (float x)
 {
+  set_dirty();
   plan_pos_.x = x;
 }
 void
 BasisCube::set_position_Ozx (float y)
 {
+  set_dirty();
   plan_pos_.y = y;
 }
 // ============================================================================
@@ -265,3 +276,30 @@ BasisCube::show (float timeout)
     get_plane (PLAN_OYZ)->show (timeout);
     get_plane (PLAN_OZX)->show (timeout);
 }
+// ============================================================================
+bool
+BasisCube::needs_redraw (void) const
+{
+  if (Object::needs_redraw())
+    return true;
+  for (int i=0; i<3; i++)
+    if (plans_[i]->needs_redraw())
+      return true;
+  return false;
+}
+void
+BasisCube::set_dirty (bool dirty)
+{
+  Object::set_dirty (dirty);
+  if (dirty)
+    return;
+  for (int i=0; i<3; i++)
+    plans_[i]->set_dirty (false);
+}
+void
+BasisCube::set_time (double time)
+{
+  Object::set_time (time);
+  for (int i=0; i<3; i++)
+    plans_[i]->set_time (time);
+}
@@ -160,6 +160,23 @@ class BasisCube : public Object {
   virtual void show (float timeout=0);
   //@}
 
+  /**
+   * @name Redraw
+   */
+  /**
+   * Whether object or any of its planes needs to be redrawn
+   */
+  virtual bool needs_redraw (void) const;
+  /**
+   * Set whether object needs to be redrawn, clearing also clears planes
+   */
+  virtual void set_dirty (bool dirty = true);
+  /**
+   * Set time of the frame being rendered, passed down to planes
+   */
+  virtual void set_time (double time);
+  //@}
+
  protected:
   /**
    * A set of three PlaneCoord.
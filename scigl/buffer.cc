@@ -0,0 +1,225 @@
+/*
+ * Copyright (C) 2008 Nicolas P. Rougier
+ *
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <cstdlib>
+#include <new>
+#include <stdexcept>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "buffer.h"
+
+// Size of huge pages on most systems
+static const size_t huge_page_size = 2*1024*1024;
+
+// ______________________________________________________________________ advice
+static int
+advice (Buffer::Access access)
+{
+    if (access == Buffer::ACCESS_SEQUENTIAL)
+        return MADV_SEQUENTIAL;
+    else if (access == Buffer::ACCESS_RANDOM)
+        return MADV_RANDOM;
+    return MADV_NORMAL;
+}
+
+
+// ______________________________________________________________________ Buffer
+Buffer::Buffer (size_t size, bool huge_pages)
+{
+    data_ = mapping_ = 0;
+    size_ = size;
+    mapped_ = 0;
+    file_ = false;
+    huge_pages_ = false;
+    frozen_ = false;
+
+    // Huge pages need whole pages, hence a mapping of its own
+    if (huge_pages and (size > 0)) {
+        size_t length = ((size + huge_page_size - 1)/huge_page_size)
+                        * huge_page_size;
+        void *data = MAP_FAILED;
+#if defined(MAP_HUGETLB)
+        data = mmap (0, length, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        huge_pages_ = (data != MAP_FAILED);
+#endif
+        if (data == MAP_FAILED) {
+            data = mmap (0, length, PROT_READ | PROT_WRITE,
+                         MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+#if defined(MADV_HUGEPAGE)
+            if (data != MAP_FAILED)
+                huge_pages_ = (madvise (data, length, MADV_HUGEPAGE) == 0);
+#endif
+        }
+        if (data != MAP_FAILED) {
+            data_ = mapping_ = data;
+            mapped_ = length;
+            return;
+        }
+    }
+
+    if (posix_memalign (&data_, alignment, size ? size : alignment) != 0) {
+        throw std::bad_alloc();
+    }
+}
+
+
+// ______________________________________________________________________ Buffer
+Buffer::Buffer (const std::string &filename, size_t offset, size_t size,
+                Access access)
+{
+    data_ = mapping_ = 0;
+    mapped_ = 0;
+    file_ = true;
+    huge_pages_ = false;
+    frozen_ = true;
+
+    int fd = open (filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error ("Buffer: cannot open " + filename);
+    }
+    struct stat status;
+    if (fstat (fd, &status) != 0) {
+        close (fd);
+        throw std::runtime_error ("Buffer: cannot stat " + filename);
+    }
+    size_t length = status.st_size;
+    if ((offset > length) or ((size > 0) and (offset+size > length))) {
+        close (fd);
+        throw std::invalid_argument ("Buffer: " + filename + " is too short");
+    }
+    if (size == 0)
+        size = length - offset;
+    size_ = size;
+    if (size == 0) {
+        close (fd);
+        throw std::invalid_argument ("Buffer: nothing to map in " + filename);
+    }
+
+    // Mappings start on a page boundary
+    size_t page = sysconf (_SC_PAGESIZE);
+    size_t start = (offset/page)*page;
+    mapped_ = size + (offset-start);
+    mapping_ = mmap (0, mapped_, PROT_READ, MAP_SHARED, fd, start);
+    close (fd);
+    if (mapping_ == MAP_FAILED) {
+        mapping_ = 0;
+        mapped_ = 0;
+        throw std::runtime_error ("Buffer: cannot map " + filename);
+    }
+    data_ = (char *) mapping_ + (offset-start);
+    advise (access);
+}
+
+
+// _____________________________________________________________________ ~Buffer
+Buffer::~Buffer (void)
+{
+    if (mapped_)
+        munmap (mapping_, mapped_);
+    else
+        free (data_);
+}
+
+
+// ____________________________________________________________________ get_size
+size_t
+Buffer::get_size (void) const
+{
+    return size_;
+}
+
+
+// ____________________________________________________________________ get_data
+void *
+Buffer::get_data (void)
+{
+    if (frozen_) {
+        throw std::logic_error ("Buffer is frozen (read-only)");
+    }
+    return data_;
+}
+
+
+// ____________________________________________________________________ get_data
+const void *
+Buffer::get_data (void) const
+{
+    return data_;
+}
+
+
+// ______________________________________________________________ get_huge_pages
+bool
+Buffer::get_huge_pages (void) const
+{
+    return huge_pages_;
+}
+
+
+// ____________________________________________________________________ get_file
+bool
+Buffer::get_file (void) const
+{
+    return file_;
+}
+
+
+// ______________________________________________________________________ advise
+void
+Buffer::advise (Access access)
+{
+    if (mapped_)
+        madvise (mapping_, mapped_, advice (access));
+}
+
+
+// ____________________________________________________________________ prefetch
+void
+Buffer::prefetch (size_t offset, size_t size)
+{
+    if ((not mapped_) or (offset >= size_))
+        return;
+    if (offset+size > size_)
+        size = size_-offset;
+
+    // Advised range must start on a page boundary
+    size_t page = sysconf (_SC_PAGESIZE);
+    char *begin = (char *) data_ + offset;
+    size_t shift = (size_t) (begin - (char *) mapping_) % page;
+    madvise (begin - shift, size + shift, MADV_WILLNEED);
+}
+
+
+// ______________________________________________________________________ freeze
+void
+Buffer::freeze (void)
+{
+    if (frozen_)
+        return;
+    frozen_ = true;
+    if (mapped_)
+        mprotect (mapping_, mapped_, PROT_READ);
+}
+
+
+// __________________________________________________________________ get_frozen
+bool
+Buffer::get_frozen (void) const
+{
+    return frozen_;
+}
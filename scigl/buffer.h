@@ -0,0 +1,210 @@
+/*
+ * Copyright (C) 2008 Nicolas P. Rougier
+ *
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef __BUFFER_H__
+#define __BUFFER_H__
+#include <cstddef>
+#include <string>
+
+#if defined(HAVE_BOOST)
+#   include <boost/shared_ptr.hpp>
+    typedef boost::shared_ptr<class Buffer> BufferPtr;
+#else
+    typedef class Buffer *                  BufferPtr;
+#endif
+
+
+/**
+ * Owned block of memory holding data arrays.
+ *
+ * Memory is aligned on 64 bytes (a cache line), which allows vectorized
+ * processing of every column, and can be backed by huge pages to reduce TLB
+ * misses on very large arrays. Buffers are shared through BufferPtr: a data
+ * using a buffer (see Data::set) keeps it alive, such that a producer can
+ * hand a filled array over to the renderer by passing a reference instead of
+ * copying it.
+ *
+ * Once frozen, a buffer is read-only: writable access throws and, when the
+ * buffer is made of whole pages, writes through former pointers fault.
+ *
+ * A buffer can also map part of a file, in which case it is read-only and
+ * pages are only read from disk when accessed. This allows to open very large
+ * snapshots instantly and to only read the parts that are actually used.
+ */
+class Buffer {
+public:
+
+    /**
+     * Expected access pattern of mapped files
+     */
+    enum Access {
+        ACCESS_NORMAL,      /*!< No particular pattern                */
+        ACCESS_SEQUENTIAL,  /*!< Read ahead aggressively              */
+        ACCESS_RANDOM       /*!< Only read accessed pages             */
+    };
+
+
+    // _________________________________________________________________________
+
+    /**
+     * @name Creation/Destruction
+     */
+    /**
+     * Default constructor
+     *
+     * @param size       size in bytes
+     * @param huge_pages whether to back buffer with huge pages when possible
+     */
+    Buffer (size_t size, bool huge_pages = false);
+
+    /**
+     * Map part of a file (read-only)
+     *
+     * @param filename file to be mapped
+     * @param offset   offset of mapped part in bytes (any alignment)
+     * @param size     size of mapped part in bytes (0 means up to file end)
+     * @param access   expected access pattern
+     */
+    Buffer (const std::string &filename, size_t offset = 0, size_t size = 0,
+            Access access = ACCESS_NORMAL);
+
+    /**
+     * Destructor
+     */
+    virtual ~Buffer (void);
+    //@}
+
+
+    // _________________________________________________________________________
+
+    /**
+     * @name Storage
+     */
+    /**
+     * Alignment of buffer storage in bytes
+     */
+    static const size_t alignment = 64;
+
+    /**
+     * Get size in bytes
+     */
+    virtual size_t get_size (void) const;
+
+    /**
+     * Get writable storage
+     *
+     * Throws if buffer is frozen.
+     */
+    virtual void *get_data (void);
+
+    /**
+     * Get read-only storage
+     */
+    virtual const void *get_data (void) const;
+
+    /**
+     * Whether storage is backed by huge pages
+     */
+    virtual bool get_huge_pages (void) const;
+
+    /**
+     * Whether storage is a mapped file
+     */
+    virtual bool get_file (void) const;
+
+    /**
+     * Set expected access pattern
+     *
+     * This only matters for mapped files.
+     */
+    virtual void advise (Access access);
+
+    /**
+     * Ask for part of the buffer to be read ahead of use
+     *
+     * @param offset offset of part in bytes
+     * @param size   size of part in bytes
+     */
+    virtual void prefetch (size_t offset, size_t size);
+    //@}
+
+
+    // _________________________________________________________________________
+
+    /**
+     * @name Freeze
+     */
+    /**
+     * Make buffer read-only, this cannot be undone
+     */
+    virtual void freeze (void);
+
+    /**
+     * Whether buffer is read-only
+     */
+    virtual bool get_frozen (void) const;
+    //@}
+
+
+protected:
+
+    // _________________________________________________________________________
+
+    /**
+     * Storage
+     */
+    void *data_;
+
+    /**
+     * Size in bytes
+     */
+    size_t size_;
+
+    /**
+     * Start of mapped pages, if storage is mapped
+     */
+    void *mapping_;
+
+    /**
+     * Size of mapped pages, 0 if storage is not mapped
+     */
+    size_t mapped_;
+
+    /**
+     * Whether storage is a mapped file
+     */
+    bool file_;
+
+    /**
+     * Whether storage is backed by huge pages
+     */
+    bool huge_pages_;
+
+    /**
+     * Whether buffer is read-only
+     */
+    bool frozen_;
+
+
+private:
+
+    /**
+     * Buffers cannot be copied, share them through BufferPtr
+     */
+    Buffer (const Buffer &other);
+    Buffer &operator= (const Buffer &other);
+};
+
+#endif
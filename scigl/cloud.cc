@@ -14,10 +14,55 @@
  * this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 #include "cloud.h"
+#include "render-queue.h"
 #include "shapes.h"
+#include "picker.h"
 
 #include <iostream>
 
+// Program used for points of individual sizes, fragments are left to the
+// fixed pipeline such that point smoothing and blending are unchanged. Points
+// are unlit (see Cloud::render), hence the color is passed as is.
+static const char *sized_points_vertex_source =
+    "attribute float size;\n"
+    "void main() {\n"
+    "    gl_Position = ftransform();\n"
+    "    gl_FrontColor = gl_Color;\n"
+    "    gl_PointSize = size;\n"
+    "}\n";
+
+// ________________________________________________________ sized_points_program
+static GLuint
+sized_points_program (void)
+{
+    static GLuint program = 0;
+    static bool tried = false;
+    if (tried)
+        return program;
+    tried = true;
+    if (not glewIsSupported ("GL_VERSION_2_0"))
+        return 0;
+
+    GLuint shader = glCreateShader (GL_VERTEX_SHADER);
+    glShaderSource (shader, 1, &sized_points_vertex_source, 0);
+    glCompileShader (shader);
+    GLint status;
+    glGetShaderiv (shader, GL_COMPILE_STATUS, &status);
+    if (status) {
+        program = glCreateProgram ();
+        glAttachShader (program, shader);
+        glBindAttribLocation (program, POINT_SIZE_ATTRIBUTE, "size");
+        glLinkProgram (program);
+        glGetProgramiv (program, GL_LINK_STATUS, &status);
+        if (not status) {
+            glDeleteProgram (program);
+            program = 0;
+        }
+    }
+    glDeleteShader (shader);
+    return program;
+}
+
 // ________________________________________________________________________ Cloud
 Cloud::Cloud (void) : Object ()
 {
@@ -40,6 +85,43 @@ Cloud::~Cloud (void)
 {}
 
 
+// _____________________________________________________________________ prepare
+void
+Cloud::prepare (WorkerPool &pool)
+{
+    if ((not xdata_) or (not ydata_) or (not zdata_)) {
+        return;
+    }
+    compute_visibility();
+    if (!get_visible()) {
+        return;
+    }
+    kernel_.prepare (kernel_source(), pool);
+}
+
+
+// ______________________________________________________________________ submit
+bool
+Cloud::submit (RenderQueue &queue)
+{
+    // Spheres and individually sized points are drawn by render
+    if (sdata_ or ((thickness_ > 0) and (thickness_ <= 1.0)))
+        return false;
+    if ((not xdata_) or (not ydata_) or (not zdata_))
+        return true;
+    compute_visibility();
+    if (not get_visible())
+        return true;
+    if (not kernel_.consume())
+        kernel_.prepare (kernel_source());
+    if (thickness_ == 0)
+        queue.submit (kernel_, RenderKernel::POINTS, 1.0);
+    else
+        queue.submit (kernel_, RenderKernel::POINTS, thickness_);
+    return true;
+}
+
+
 // ______________________________________________________________________ render
 void
 Cloud::render (void)
@@ -51,373 +133,144 @@ Cloud::render (void)
     if (!get_visible()) {
         return;
     }
-    unsigned int width        = xdata_->get_width();
-    unsigned int xdata_stride = xdata_->get_stride();
-    unsigned int ydata_stride = ydata_->get_stride();
-    unsigned int zdata_stride = zdata_->get_stride();
-    Color c;
-    double x, y, z, s, v, r, g, b, a;
-    r = fg_color_.r;
-    g = fg_color_.g;
-    b = fg_color_.b;
-    a = fg_color_.a;
+    if (not kernel_.consume())
+        kernel_.prepare (kernel_source());
 
     // -------------------------------------------------------------------------
     //  Rendering using GL_POINTS
     // -------------------------------------------------------------------------
     if ((thickness_ == 0) or (thickness_ > 1.0)) {
-        glEnable (GL_BLEND);
-        glEnable (GL_POINT_SMOOTH);
-        //glColor4f (r,g,b,a*alpha_);
+        // Points have no normal: they are drawn unlit, as by RenderQueue,
+        // whether their sizes are individual (shader) or not.
+        GLboolean lighting = glIsEnabled (GL_LIGHTING);
+        glDisable (GL_LIGHTING);
+        if (not Picker::get_active()) {
+            glEnable (GL_BLEND);
+            glEnable (GL_POINT_SMOOTH);
+        }
         if (thickness_ == 0)
             glPointSize (1.0);
         else
             glPointSize (thickness_);
-
-        // XYZ
-        // ---------------------------------------------------------------------
-        if ((not cdata_) and (not sdata_)) {
-            GLbyte *xdata = (GLbyte *) xdata_->get_data();
-            GLbyte *ydata = (GLbyte *) ydata_->get_data();
-            GLbyte *zdata = (GLbyte *) zdata_->get_data();
-	    glColor4f (r,g,b,a*alpha_);
-            glBegin(GL_POINTS);
-            for (unsigned int i=0; i<width; i++) {
-                x = * (GLdouble *)(xdata+i*xdata_stride);
-                y = * (GLdouble *)(ydata+i*ydata_stride);
-                z = * (GLdouble *)(zdata+i*zdata_stride);
-                glVertex3f (x,y,z);
-            }
-            glEnd();
-        }
-
-        // XYZ + S
-        // ---------------------------------------------------------------------
-        else if ((not cdata_) and (sdata_)) {
-            GLbyte *xdata = (GLbyte *) xdata_->get_data();
-            GLbyte *ydata = (GLbyte *) ydata_->get_data();
-            GLbyte *zdata = (GLbyte *) zdata_->get_data();
-            GLbyte *sdata = (GLbyte *) sdata_->get_data();
-            unsigned int sdata_stride = sdata_->get_stride();
-	    glColor4f (r,g,b,a*alpha_);
-            for (unsigned int i=0; i<width; i++) {
-                x = * (GLdouble *)(xdata+i*xdata_stride);
-                y = * (GLdouble *)(ydata+i*ydata_stride);
-                z = * (GLdouble *)(zdata+i*zdata_stride);
-                s = * (GLdouble *)(sdata+i*sdata_stride);
-                glPointSize (thickness_*s);
-                glBegin(GL_POINTS);
-                glVertex3f (x,y,z);
-                glEnd();
-            }
-
-        }
-        else if ((cdata_) and (not sdata_)) {
-            GLbyte *xdata = (GLbyte *) xdata_->get_data();
-            GLbyte *ydata = (GLbyte *) ydata_->get_data();
-            GLbyte *zdata = (GLbyte *) zdata_->get_data();
-            GLbyte *cdata = (GLbyte *) cdata_->get_data();
-            unsigned int cdata_stride = cdata_->get_stride();
-            
-            // XYZ + C
-            // -----------------------------------------------------------------
-            if (cdata_->get_depth() == 1) {
-                glBegin(GL_POINTS);
-                for (unsigned int i=0; i<width; i++) {
-                    x = * (GLdouble *)(xdata+i*xdata_stride);
-                    y = * (GLdouble *)(ydata+i*ydata_stride);
-                    z = * (GLdouble *)(zdata+i*zdata_stride);
-                    v = * (GLdouble *)(cdata+i*cdata_stride + 0*sizeof(GLdouble));
-                    Color c = (*cmap_)(v);
-                    r = c.r;
-                    g = c.g;
-                    b = c.b;
-                    a = c.a;
-                    glColor4f(r,g,b,a*alpha_);
-		    glVertex3f (x,y,z);
-                }
-                glEnd();
-            }
-            // XYZ + RGB
-            // -----------------------------------------------------------------
-            else if (cdata_->get_depth() == 3) {
-                glBegin(GL_POINTS);
-                for (unsigned int i=0; i<width; i++) {
-                    x = * (GLdouble *)(xdata+i*xdata_stride);
-                    y = * (GLdouble *)(ydata+i*ydata_stride);
-                    z = * (GLdouble *)(zdata+i*zdata_stride);
-                    r = * (GLdouble *)(cdata+i*cdata_stride + 0*sizeof(GLdouble));
-                    g = * (GLdouble *)(cdata+i*cdata_stride + 1*sizeof(GLdouble));
-                    b = * (GLdouble *)(cdata+i*cdata_stride + 2*sizeof(GLdouble));
-                    glColor4f(r,g,b,alpha_);
-                    glVertex3f (x,y,z);
-                }
-                glEnd();
-            }
-            // XYZ + RGBA
-            // -----------------------------------------------------------------
-            else if (cdata_->get_depth() == 4) {
-	      glBegin(GL_POINTS);
-                for (unsigned int i=0; i<width; i++) {
-                    x = * (GLdouble *)(xdata+i*xdata_stride);
-                    y = * (GLdouble *)(ydata+i*ydata_stride);
-                    z = * (GLdouble *)(zdata+i*zdata_stride);
-                    r = * (GLdouble *)(cdata+i*cdata_stride + 0*sizeof(GLdouble));
-                    g = * (GLdouble *)(cdata+i*cdata_stride + 1*sizeof(GLdouble));
-                    b = * (GLdouble *)(cdata+i*cdata_stride + 2*sizeof(GLdouble));
-                    a = * (GLdouble *)(cdata+i*cdata_stride + 3*sizeof(GLdouble));
-                    glColor4f(r,g,b,a*alpha_);
-                    glVertex3f (x,y,z);
-                }
-		glEnd();
-            }
-        }
-        else if ((cdata_) and (sdata_)) {
-            GLbyte *xdata = (GLbyte *) xdata_->get_data();
-            GLbyte *ydata = (GLbyte *) ydata_->get_data();
-            GLbyte *zdata = (GLbyte *) zdata_->get_data();
-            GLbyte *cdata = (GLbyte *) cdata_->get_data();
-            GLbyte *sdata = (GLbyte *) sdata_->get_data();
-            unsigned int cdata_stride = cdata_->get_stride();
-            unsigned int sdata_stride = sdata_->get_stride();
-            
-            // XYZ + S + C
-            // -----------------------------------------------------------------
-            if (cdata_->get_depth() == 1) {
-                for (unsigned int i=0; i<width; i++) {
-                    x = * (GLdouble *)(xdata+i*xdata_stride);
-                    y = * (GLdouble *)(ydata+i*ydata_stride);
-                    z = * (GLdouble *)(zdata+i*zdata_stride);
-                    s = * (GLdouble *)(sdata+i*sdata_stride);
-                    v = * (GLdouble *)(cdata+i*cdata_stride + 0*sizeof(GLdouble));
-                    Color c = (*cmap_)(v);
-                    r = c.r;
-                    g = c.g;
-                    b = c.b;
-                    a = c.a;
-                    glPointSize (thickness_*s);
-                    glBegin(GL_POINTS);
-                    glVertex3f (x,y,z);
-                    glEnd();
-                }
-            }
-            // XYZ + S + RGB
-            // -----------------------------------------------------------------
-            else if (cdata_->get_depth() == 3) {
-                for (unsigned int i=0; i<width; i++) {
-                    x = * (GLdouble *)(xdata+i*xdata_stride);
-                    y = * (GLdouble *)(ydata+i*ydata_stride);
-                    z = * (GLdouble *)(zdata+i*zdata_stride);
-                    s = * (GLdouble *)(sdata+i*sdata_stride);
-                    r = * (GLdouble *)(cdata+i*cdata_stride + 0*sizeof(GLdouble));
-                    g = * (GLdouble *)(cdata+i*cdata_stride + 1*sizeof(GLdouble));
-                    b = * (GLdouble *)(cdata+i*cdata_stride + 2*sizeof(GLdouble));
-                    glColor4f(r,g,b,a*alpha_);
-                    glPointSize (thickness_*s);
-                    glBegin(GL_POINTS);
-                    glVertex3f (x,y,z);
-                    glEnd();
-                }
-            }
-            // XYZ + S + RGBA
-            // -----------------------------------------------------------------
-            else if (cdata_->get_depth() == 4) {
-                for (unsigned int i=0; i<width; i++) {
-                    x = * (GLdouble *)(xdata+i*xdata_stride);
-                    y = * (GLdouble *)(ydata+i*ydata_stride);
-                    z = * (GLdouble *)(zdata+i*zdata_stride);
-                    s = * (GLdouble *)(sdata+i*sdata_stride);
-                    r = * (GLdouble *)(cdata+i*cdata_stride + 0*sizeof(GLdouble));
-                    g = * (GLdouble *)(cdata+i*cdata_stride + 1*sizeof(GLdouble));
-                    b = * (GLdouble *)(cdata+i*cdata_stride + 2*sizeof(GLdouble));
-                    a = * (GLdouble *)(cdata+i*cdata_stride + 3*sizeof(GLdouble));
-                    glColor4f(r,g,b,a*alpha_);
-                    glPointSize (thickness_*s);
-                    glBegin(GL_POINTS);
-                    glVertex3f (x,y,z);
-                    glEnd();
-                }
-            }
-        }
-	glDisable (GL_BLEND);
+        if (sdata_)
+            render_sized_points ();
+        else
+            kernel_.draw (RenderKernel::POINTS, false);
+        glDisable (GL_BLEND);
         glDisable (GL_POINT_SMOOTH);
+        if (lighting)
+            glEnable (GL_LIGHTING);
     }
 
-
     // -------------------------------------------------------------------------
     //  Rendering using sphere
     // -------------------------------------------------------------------------
     else {
         glPolygonMode (GL_FRONT_AND_BACK, GL_FILL);
-    
-        // XYZ
-        // ---------------------------------------------------------------------
-        if ((not cdata_) and (not sdata_)) {
-            GLbyte *xdata = (GLbyte *) xdata_->get_data();
-            GLbyte *ydata = (GLbyte *) ydata_->get_data();
-            GLbyte *zdata = (GLbyte *) zdata_->get_data();
-	    glColor4f (r,g,b,a*alpha_);
-            for (unsigned int i=0; i<width; i++) {
-                x = * (GLdouble *)(xdata+i*xdata_stride);
-                y = * (GLdouble *)(ydata+i*ydata_stride);
-                z = * (GLdouble *)(zdata+i*zdata_stride);
-                sphere (x,y,z, thickness_);
-            }
-        }
-        // XYZ + S
-        // ---------------------------------------------------------------------
-        else if ((not cdata_) and (sdata_)) {
-            GLbyte *xdata = (GLbyte *) xdata_->get_data();
-            GLbyte *ydata = (GLbyte *) ydata_->get_data();
-            GLbyte *zdata = (GLbyte *) zdata_->get_data();
-            GLbyte *sdata = (GLbyte *) sdata_->get_data();
-	    glColor4f (r,g,b,a*alpha_);
-            unsigned int sdata_stride = sdata_->get_stride();
-            for (unsigned int i=0; i<width; i++) {
-                x = * (GLdouble *)(xdata+i*xdata_stride);
-                y = * (GLdouble *)(ydata+i*ydata_stride);
-                z = * (GLdouble *)(zdata+i*zdata_stride);
-                s = * (GLdouble *)(sdata+i*sdata_stride);
-                sphere (x,y,z, thickness_*s);
-            }
-        }
-        else if ((cdata_) and (not sdata_)) {
-            GLbyte *xdata = (GLbyte *) xdata_->get_data();
-            GLbyte *ydata = (GLbyte *) ydata_->get_data();
-            GLbyte *zdata = (GLbyte *) zdata_->get_data();
-            GLbyte *cdata = (GLbyte *) cdata_->get_data();
-            unsigned int cdata_stride = cdata_->get_stride();
-            
-            // XYZ + C
-            // -----------------------------------------------------------------
-            if (cdata_->get_depth() == 1) {
-                for (unsigned int i=0; i<width; i++) {
-                    x = * (GLdouble *)(xdata+i*xdata_stride);
-                    y = * (GLdouble *)(ydata+i*ydata_stride);
-                    z = * (GLdouble *)(zdata+i*zdata_stride);
-                    v = * (GLdouble *)(cdata+i*cdata_stride + 0*sizeof(GLdouble));
-                    Color c = (*cmap_)(v);
-                    r = c.r;
-                    g = c.g;
-                    b = c.b;
-                    a = c.a;
-                    glColor4f(r,g,b,a*alpha_);
-                    sphere (x,y,z, thickness_);
-                }
-            }
-            // XYZ + RGB
-            // -----------------------------------------------------------------
-            else if (cdata_->get_depth() == 3) {
-                for (unsigned int i=0; i<width; i++) {
-                    x = * (GLdouble *)(xdata+i*xdata_stride);
-                    y = * (GLdouble *)(ydata+i*ydata_stride);
-                    z = * (GLdouble *)(zdata+i*zdata_stride);
-                    r = * (GLdouble *)(cdata+i*cdata_stride + 0*sizeof(GLdouble));
-                    g = * (GLdouble *)(cdata+i*cdata_stride + 1*sizeof(GLdouble));
-                    b = * (GLdouble *)(cdata+i*cdata_stride + 2*sizeof(GLdouble));
-                    glColor4f(r,g,b,a*alpha_);
-                    sphere (x,y,z, thickness_);
-                }
-            }
-            // XYZ + RGBA
-            // -----------------------------------------------------------------
-            else if (cdata_->get_depth() == 4) {
-	      for (unsigned int i=0; i<width; i++) {
-                    x = * (GLdouble *)(xdata+i*xdata_stride);
-                    y = * (GLdouble *)(ydata+i*ydata_stride);
-                    z = * (GLdouble *)(zdata+i*zdata_stride);
-                    r = * (GLdouble *)(cdata+i*cdata_stride + 0*sizeof(GLdouble));
-                    g = * (GLdouble *)(cdata+i*cdata_stride + 1*sizeof(GLdouble));
-                    b = * (GLdouble *)(cdata+i*cdata_stride + 2*sizeof(GLdouble));
-                    a = * (GLdouble *)(cdata+i*cdata_stride + 3*sizeof(GLdouble));
-                    glColor4f(r,g,b,a*alpha_);
-                    sphere (x,y,z, thickness_);
-                }
-            }
-        }
+        kernel_.draw (RenderKernel::POINTS, true);
+    }
+}
+
+
+
+// ________________________________________________________________ needs_redraw
+bool
+Cloud::needs_redraw (void) const
+{
+    return Object::needs_redraw() or
+           (get_visible() and kernel_.get_outdated (kernel_source()));
+}
+
+
+// _______________________________________________________________ kernel_source
+RenderKernel::Source
+Cloud::kernel_source (void) const
+{
+    RenderKernel::Source source;
+    source.xdata = xdata_;
+    source.ydata = ydata_;
+    source.zdata = zdata_;
+    source.sdata = sdata_;
+    source.cdata = cdata_;
+    source.cmap = cmap_;
+    source.color = fg_color_;
+    source.alpha = alpha_;
+    source.thickness = thickness_;
+    return source;
+}
 
-        else if ((cdata_) and (sdata_)) {
-            GLbyte *xdata = (GLbyte *) xdata_->get_data();
-            GLbyte *ydata = (GLbyte *) ydata_->get_data();
-            GLbyte *zdata = (GLbyte *) zdata_->get_data();
-            GLbyte *cdata = (GLbyte *) cdata_->get_data();
-            GLbyte *sdata = (GLbyte *) sdata_->get_data();
-            unsigned int cdata_stride = cdata_->get_stride();
-            unsigned int sdata_stride = sdata_->get_stride();
-            
-            // XYZ + S + C
-            // -----------------------------------------------------------------
-            if (cdata_->get_depth() == 1) {
-                for (unsigned int i=0; i<width; i++) {
-                    x = * (GLdouble *)(xdata+i*xdata_stride);
-                    y = * (GLdouble *)(ydata+i*ydata_stride);
-                    z = * (GLdouble *)(zdata+i*zdata_stride);
-                    s = * (GLdouble *)(sdata+i*sdata_stride);
-                    v = * (GLdouble *)(cdata+i*cdata_stride + 0*sizeof(GLdouble));
-                    Color c = (*cmap_)(v);
-                    r = c.r;
-                    g = c.g;
-                    b = c.b;
-                    a = c.a;
-                    glColor4f(r,g,b,a*alpha_);
-                    sphere (x,y,z, thickness_*s);
-                }
-            }
-            // XYZ + S + RGB
-            // -----------------------------------------------------------------
-            else if (cdata_->get_depth() == 3) {
-                for (unsigned int i=0; i<width; i++) {
-                    x = * (GLdouble *)(xdata+i*xdata_stride);
-                    y = * (GLdouble *)(ydata+i*ydata_stride);
-                    z = * (GLdouble *)(zdata+i*zdata_stride);
-                    s = * (GLdouble *)(sdata+i*sdata_stride);
-                    r = * (GLdouble *)(cdata+i*cdata_stride + 0*sizeof(GLdouble));
-                    g = * (GLdouble *)(cdata+i*cdata_stride + 1*sizeof(GLdouble));
-                    b = * (GLdouble *)(cdata+i*cdata_stride + 2*sizeof(GLdouble));
-                    glColor4f(r,g,b,a*alpha_);
-                    sphere (x,y,z, thickness_*s);
-                }
-            }
-            // XYZ + S + RGBA
-            // -----------------------------------------------------------------
-            else if (cdata_->get_depth() == 4) {
-                for (unsigned int i=0; i<width; i++) {
-                    x = * (GLdouble *)(xdata+i*xdata_stride);
-                    y = * (GLdouble *)(ydata+i*ydata_stride);
-                    z = * (GLdouble *)(zdata+i*zdata_stride);
-                    s = * (GLdouble *)(sdata+i*sdata_stride);
-                    r = * (GLdouble *)(cdata+i*cdata_stride + 0*sizeof(GLdouble));
-                    g = * (GLdouble *)(cdata+i*cdata_stride + 1*sizeof(GLdouble));
-                    b = * (GLdouble *)(cdata+i*cdata_stride + 2*sizeof(GLdouble));
-                    a = * (GLdouble *)(cdata+i*cdata_stride + 3*sizeof(GLdouble));
-                    glColor4f(r,g,b,a*alpha_);
-                    sphere (x,y,z, thickness_*s);
-                }
-            }
+
+// ______________________________________________________________________ select
+bool
+Cloud::select (Position origin, Direction direction)
+{
+    selection_ = -1;
+    if (not get_index())
+        return false;
+    // Spheres (thickness up to 1) bound selection by their radius, points
+    // are selected whatever their distance to the ray.
+    if ((thickness_ <= 0) or (thickness_ > 1.0)) {
+        selection_ = index_->nearest_to_ray (origin, direction);
+    } else if (not sdata_) {
+        selection_ = index_->nearest_to_ray (origin, direction, thickness_);
+    } else {
+        unsigned int n = sdata_->get_width();
+        const GLbyte *s = (const GLbyte *) sdata_->get_data();
+        unsigned int stride = sdata_->get_stride();
+        std::vector<GLfloat> radii (n);
+        for (unsigned int i=0; i<n; i++, s+=stride) {
+            if (sdata_->get_type() == GL_FLOAT)
+                radii[i] = thickness_ * (* (const GLfloat *) s);
+            else
+                radii[i] = thickness_ * (* (const GLdouble *) s);
         }
+        selection_ = index_->nearest_to_ray (origin, direction, radii);
     }
+    return selection_ >= 0;
 }
 
 
+// _______________________________________________________________ get_selection
+int
+Cloud::get_selection (void) const
+{
+    return selection_;
+}
+
+
+// ___________________________________________________________________ get_index
+PointIndexPtr
+Cloud::get_index (void)
+{
+    if ((not xdata_) or (not ydata_) or (not zdata_))
+        return PointIndexPtr();
+    if (not index_)
+        index_ = PointIndexPtr (new PointIndex (xdata_, ydata_, zdata_));
+    else
+        index_->update();
+    return index_;
+}
+
 
 // ________________________________________________________________ set_xyz_data
 void
 Cloud::set_xyz_data (DataPtr xdata, DataPtr ydata, DataPtr zdata)
 {
+    set_dirty ();
     if ((not xdata) or (not ydata) or (not zdata)) {
         throw std::invalid_argument
             ("cloud: X,Y,Z data must be valid data");
     }
-    if ((not (xdata->get_type() == xdata->get_type())) or
+    if ((not (xdata->get_type() == ydata->get_type())) or
         (not (xdata->get_type() == zdata->get_type()))) {
         throw std::invalid_argument
             ("cloud: X,Y,Z data must be of same type");
     }
-    if ((not (xdata->get_type() == GL_DOUBLE))) {
+    if (not RenderKernel::supports (xdata->get_type())) {
         throw std::invalid_argument
-            ("cloud: X,Y,Z data must be of type GL_DOUBLE");
+            ("cloud: X,Y,Z data must be of type GL_FLOAT or GL_DOUBLE");
     }
-    if ((not (xdata->get_width() == xdata->get_width())) or
+    if ((not (xdata->get_width() == ydata->get_width())) or
         (not (xdata->get_width() == zdata->get_width()))) {
         throw std::invalid_argument
             ("cloud: X,Y,Z data must be of same size");
@@ -432,8 +285,7 @@ Cloud::set_xyz_data (DataPtr xdata, DataPtr ydata, DataPtr zdata)
     xdata_ = xdata;
     ydata_ = ydata;
     zdata_ = zdata;
-    id_ = id_counter_;
-    id_ += xdata->get_width();
+    set_id (id_counter_ + xdata->get_width());
 }
 
 
@@ -442,21 +294,22 @@ void
 Cloud::set_xyz_s_data (DataPtr xdata, DataPtr ydata, DataPtr zdata,
                        DataPtr sdata)
 {
+    set_dirty ();
     if ((not xdata) or (not ydata) or (not zdata) or
         (not sdata) ) {
         throw std::invalid_argument
             ("cloud: X,Y,Z,S data must be valid data");
     }
-    if ((not (xdata->get_type() == xdata->get_type())) or
+    if ((not (xdata->get_type() == ydata->get_type())) or
         (not (xdata->get_type() == zdata->get_type()))) {
         throw std::invalid_argument
             ("cloud: X,Y,Z data must be of same type");
     }
-    if ((not (xdata->get_type() == GL_DOUBLE))) {
+    if (not RenderKernel::supports (xdata->get_type())) {
         throw std::invalid_argument
-            ("cloud: X,Y,Z data must be of type GL_DOUBLE");
+            ("cloud: X,Y,Z data must be of type GL_FLOAT or GL_DOUBLE");
     }
-    if ((not (xdata->get_width() == xdata->get_width())) or
+    if ((not (xdata->get_width() == ydata->get_width())) or
         (not (xdata->get_width() == zdata->get_width())) or
         (not (xdata->get_width() == sdata->get_width()))) {
         throw std::invalid_argument
@@ -469,17 +322,16 @@ Cloud::set_xyz_s_data (DataPtr xdata, DataPtr ydata, DataPtr zdata,
         throw std::invalid_argument
             ("cloud: X,Y,Z,S data must be linear (height=1)");
     }
-    if ((not (sdata->get_type() == GL_DOUBLE))) {
+    if ((not (sdata->get_type() == xdata->get_type()))) {
         throw std::invalid_argument
-            ("cloud: S data must be of type GL_DOUBLE");
+            ("cloud: S data must be of same type as X,Y,Z data");
     }
     reset_data();
     xdata_ = xdata;
     ydata_ = ydata;
     zdata_ = zdata;
     sdata_ = sdata;
-    id_ = id_counter_;
-    id_ += xdata->get_width();
+    set_id (id_counter_ + xdata->get_width());
 }
 
 
@@ -488,20 +340,21 @@ void
 Cloud::set_xyz_c_data (DataPtr xdata, DataPtr ydata, DataPtr zdata,
                        DataPtr cdata)
 {
+    set_dirty ();
     if ((not xdata) or (not ydata) or (not zdata) or (not cdata)) {
         throw std::invalid_argument
             ("cloud: X,Y,Z,C data must be valid data");
     }
-    if ((not (xdata->get_type() == xdata->get_type())) or
+    if ((not (xdata->get_type() == ydata->get_type())) or
         (not (xdata->get_type() == zdata->get_type()))) {
         throw std::invalid_argument
             ("cloud: X,Y,Z data must be of same type");
     }
-    if ((not (xdata->get_type() == GL_DOUBLE))) {
+    if (not RenderKernel::supports (xdata->get_type())) {
         throw std::invalid_argument
-            ("cloud: X,Y,Z data must be of type GL_DOUBLE");
+            ("cloud: X,Y,Z data must be of type GL_FLOAT or GL_DOUBLE");
     }
-    if ((not (xdata->get_width() == xdata->get_width())) or
+    if ((not (xdata->get_width() == ydata->get_width())) or
         (not (xdata->get_width() == zdata->get_width())) or
         (not (xdata->get_width() == cdata->get_width()))) {
         throw std::invalid_argument
@@ -514,9 +367,9 @@ Cloud::set_xyz_c_data (DataPtr xdata, DataPtr ydata, DataPtr zdata,
         throw std::invalid_argument
             ("cloud: X,Y,Z,C data must be linear (height=1)");
     }
-    if ((not (cdata->get_type() == GL_DOUBLE))) {
+    if ((not (cdata->get_type() == xdata->get_type()))) {
         throw std::invalid_argument
-            ("cloud: C data must be of type GL_DOUBLE");
+            ("cloud: C data must be of same type as X,Y,Z data");
     }
     if ((not (cdata->get_depth() == 1)) and
         (not (cdata->get_depth() == 3)) and
@@ -529,8 +382,7 @@ Cloud::set_xyz_c_data (DataPtr xdata, DataPtr ydata, DataPtr zdata,
     ydata_ = ydata;
     zdata_ = zdata;
     cdata_ = cdata;
-    id_ = id_counter_;
-    id_ += xdata->get_width();
+    set_id (id_counter_ + xdata->get_width());
 
 }
 
@@ -539,21 +391,22 @@ void
 Cloud::set_xyz_s_c_data (DataPtr xdata, DataPtr ydata, DataPtr zdata,
                         DataPtr sdata, DataPtr cdata)
 {
+    set_dirty ();
     if ((not xdata) or (not ydata) or (not zdata) or
         (not cdata) or (not sdata)) {
         throw std::invalid_argument
             ("cloud: X,Y,Z,S,C data must be valid data");
     }
-    if ((not (xdata->get_type() == xdata->get_type())) or
+    if ((not (xdata->get_type() == ydata->get_type())) or
         (not (xdata->get_type() == zdata->get_type()))) {
         throw std::invalid_argument
             ("cloud: X,Y,Z data must be of same type");
     }
-    if ((not (xdata->get_type() == GL_DOUBLE))) {
+    if (not RenderKernel::supports (xdata->get_type())) {
         throw std::invalid_argument
-            ("cloud: X,Y,Z data must be of type GL_DOUBLE");
+            ("cloud: X,Y,Z data must be of type GL_FLOAT or GL_DOUBLE");
     }
-    if ((not (xdata->get_width() == xdata->get_width())) or
+    if ((not (xdata->get_width() == ydata->get_width())) or
         (not (xdata->get_width() == zdata->get_width())) or
         (not (xdata->get_width() == sdata->get_width())) or
         (not (xdata->get_width() == cdata->get_width()))) {
@@ -568,10 +421,10 @@ Cloud::set_xyz_s_c_data (DataPtr xdata, DataPtr ydata, DataPtr zdata,
         throw std::invalid_argument
             ("cloud: X,Y,Z,C data must be cloudar (height=1)");
     }
-    if ((not (sdata->get_type() == GL_DOUBLE)) or
-        (not (cdata->get_type() == GL_DOUBLE))) {
+    if ((not (sdata->get_type() == xdata->get_type())) or
+        (not (cdata->get_type() == xdata->get_type()))) {
         throw std::invalid_argument
-            ("cloud: S,C data must be of type GL_DOUBLE");
+            ("cloud: S,C data must be of same type as X,Y,Z data");
     }
     if ((not (cdata->get_depth() == 1)) and
         (not (cdata->get_depth() == 3)) and
@@ -585,8 +438,7 @@ Cloud::set_xyz_s_c_data (DataPtr xdata, DataPtr ydata, DataPtr zdata,
     zdata_ = zdata;
     cdata_ = cdata;
     sdata_ = sdata;
-    id_ = id_counter_;
-    id_ += xdata->get_width();
+    set_id (id_counter_ + xdata->get_width());
 }
 
 // __________________________________________________________________ reset_data
@@ -599,13 +451,52 @@ Cloud::reset_data (void)
     zdata_ = DataPtr();
     sdata_ = DataPtr();
     cdata_ = DataPtr();
+    index_ = PointIndexPtr();
 #else
     xdata_ = 0;
     ydata_ = 0;
     zdata_ = 0;
     sdata_ = 0;
     cdata_ = 0;
+    index_ = 0;
 #endif
+    selection_ = -1;
+}
+
+
+// _________________________________________________________ render_sized_points
+void
+Cloud::render_sized_points (void)
+{
+    unsigned int count = kernel_.get_count();
+    if (not count)
+        return;
+    const std::vector<GLfloat> &sizes = kernel_.get_sizes();
+
+    // A program is already in use during identifier passes, it honours the
+    // size attribute as well
+    GLuint current = RenderState::get_program ();
+    GLuint program = current ? 0 : sized_points_program();
+    kernel_.bind ();
+    if (current or program) {
+        if (program)
+            RenderState::use_program (program);
+        glEnable (GL_VERTEX_PROGRAM_POINT_SIZE);
+        glEnableVertexAttribArray (POINT_SIZE_ATTRIBUTE);
+        glVertexAttribPointer (POINT_SIZE_ATTRIBUTE, 1, GL_FLOAT, GL_FALSE, 0,
+                               &sizes[0]);
+        glDrawArrays (GL_POINTS, 0, count);
+        glDisableVertexAttribArray (POINT_SIZE_ATTRIBUTE);
+        glDisable (GL_VERTEX_PROGRAM_POINT_SIZE);
+        if (program)
+            RenderState::use_program (0);
+    } else {
+        for (unsigned int i=0; i<count; i++) {
+            glPointSize (sizes[i]);
+            glDrawArrays (GL_POINTS, i, 1);
+        }
+    }
+    kernel_.unbind ();
 }
 
 
@@ -621,6 +512,7 @@ Cloud::get_thickness (void) const
 void
 Cloud::set_thickness (float thickness)
 {
+    set_dirty ();
     thickness_ = thickness;
 }
 
@@ -637,5 +529,6 @@ Cloud::get_colormap (void)
 void
 Cloud::set_colormap (ColormapPtr colormap)
 {
+    set_dirty ();
     cmap_ = colormap;
 }
@@ -18,6 +18,8 @@
 #include "object.h"
 #include "colormap.h"
 #include "data.h"
+#include "point-index.h"
+#include "render-kernel.h"
 
 #if defined(HAVE_BOOST)
 #   include <boost/shared_ptr.hpp>
@@ -52,10 +54,25 @@ public:
     /**
      *  @name Rendering
      */
+    /**
+     * Convert data into vertices using a worker pool
+     */
+    virtual void prepare (WorkerPool &pool);
+
+    /**
+     * Submit thin points to render queue
+     */
+    virtual bool submit (RenderQueue &queue);
+
     /**
      * 
      */
     void render	(void);
+
+    /**
+     * Whether object needs to be redrawn, including when data changed
+     */
+    virtual bool needs_redraw (void) const;
     //@}
 
 
@@ -119,6 +136,43 @@ public:
     //@}
 
 
+    // _________________________________________________________________________
+
+    /**
+     *  @name Selection
+     */
+    /**
+     * Select point nearest to a ray
+     *
+     * When rendered as spheres, only points whose sphere is hit are
+     * considered, the radius of each sphere being thickness times its scale
+     * value when scale data is given.
+     *
+     * @param origin    ray origin
+     * @param direction ray direction
+     * @return whether a point has been selected
+     */
+    virtual bool select (Position origin, Direction direction);
+
+    /**
+     * Get index of selected point
+     *
+     * @return point index or -1 if no point is selected
+     */
+    virtual int get_selection (void) const;
+
+    /**
+     * Get spatial index over points
+     *
+     * The index is built on first call and updated with appended points on
+     * subsequent calls.
+     *
+     * @return point index or an empty PointIndexPtr if there is no data
+     */
+    virtual PointIndexPtr get_index (void);
+    //@}
+
+
     // _________________________________________________________________________
 
     /**
@@ -165,6 +219,21 @@ protected:
      */
     void reset_data (void);    
 
+    /**
+     * Get kernel input from current data and parameters
+     */
+    RenderKernel::Source kernel_source (void) const;
+
+    /**
+     * Render prepared points with their individual sizes.
+     *
+     * Sizes are passed through a per-vertex attribute (see
+     * POINT_SIZE_ATTRIBUTE) such that all points are drawn at once. If
+     * shaders are not available, each point falls back to its own
+     * glPointSize and draw call.
+     */
+    void render_sized_points (void);
+
 
 protected:
 
@@ -205,6 +274,21 @@ protected:
      * Data colors
      */
     DataPtr cdata_;
+
+    /**
+     * Spatial index over x,y,z data
+     */
+    PointIndexPtr index_;
+
+    /**
+     * Selected point
+     */
+    int selection_;
+
+    /**
+     * Vertices prepared for rendering
+     */
+    RenderKernel kernel_;
 };
 
 #endif
@@ -1,10 +1,16 @@
 // File: convert.h
+#ifndef __CONVERT_H__
+#define __CONVERT_H__
 #include <iostream>
 #include <sstream>
 #include <string>
 #include <stdexcept>
 #include <algorithm>
 #include <vector>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <clocale>
 
 class BadConversion : public std::runtime_error
 {
@@ -14,37 +20,191 @@ class BadConversion : public std::runtime_error
     { }
 };
 
-inline double to_double(const std::string& s)
+/**
+ * Powers of ten exactly representable as doubles.
+ */
+inline double exact_power_of_ten(int e)
+{
+  static const double powers[] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+  return powers[e];
+}
+/**
+ * Parse a decimal number starting at 'p' without going past 'end'.
+ * Parsing does not depend on locale, does not allocate nor throw. On success
+ * 'p' is moved right after the number.
+ * @param p start of number, updated on success
+ * @param end end of input
+ * @param x parsed value
+ * @return whether there was a number at 'p'
+ */
+inline bool parse_number(const char*& p, const char* end, double& x)
+{
+  const char* q = p;
+  bool negative = false;
+  if (q < end && (*q == '-' || *q == '+')) {
+    negative = (*q == '-');
+    q++;
+  }
+  // Up to 19 significant digits are kept, the others only count in exponent
+  unsigned long long mantissa = 0;
+  int digits = 0, exponent = 0;
+  bool any = false;
+  while (q < end && *q >= '0' && *q <= '9') {
+    if (digits < 19) {
+      mantissa = mantissa*10 + (*q - '0');
+      if (mantissa) digits++;
+    }
+    else
+      exponent++;
+    any = true;
+    q++;
+  }
+  if (q < end && *q == '.') {
+    q++;
+    while (q < end && *q >= '0' && *q <= '9') {
+      if (digits < 19) {
+        mantissa = mantissa*10 + (*q - '0');
+        if (mantissa) digits++;
+        exponent--;
+      }
+      any = true;
+      q++;
+    }
+  }
+  if (!any)
+    return false;
+  if (q < end && (*q == 'e' || *q == 'E')) {
+    const char* r = q+1;
+    bool negative_exponent = false;
+    if (r < end && (*r == '-' || *r == '+')) {
+      negative_exponent = (*r == '-');
+      r++;
+    }
+    if (r < end && *r >= '0' && *r <= '9') {
+      int e = 0;
+      while (r < end && *r >= '0' && *r <= '9') {
+        if (e < 100000) e = e*10 + (*r - '0');
+        r++;
+      }
+      exponent += negative_exponent ? -e : e;
+      q = r;
+    }
+  }
+  // Exact mantissa and power of ten give a correctly rounded result
+  if (digits <= 15 && exponent >= -22 && exponent <= 22) {
+    x = (double) mantissa;
+    if (exponent < 0)
+      x /= exact_power_of_ten(-exponent);
+    else
+      x *= exact_power_of_ten(exponent);
+  }
+  else if (mantissa == 0)
+    x = 0;
+  else {
+    // Rare long numbers go through strtod, made to use C decimal point
+    char buffer[128];
+    size_t size = q - p;
+    if (size >= sizeof(buffer)) {
+      x = (double) ((long double) mantissa * powl(10.0L, exponent));
+    }
+    else {
+      memcpy(buffer, p, size);
+      buffer[size] = 0;
+      char* dot = (char*) memchr(buffer, '.', size);
+      if (dot) *dot = *localeconv()->decimal_point;
+      x = strtod(buffer, 0);
+      negative = false;
+    }
+  }
+  if (negative)
+    x = -x;
+  p = q;
+  return true;
+}
+inline bool parse_number(const char*& p, const char* end, float& x)
 {
-  std::istringstream i(s);
-  double x;
-  if (!(i >> x))
-    throw BadConversion("convertToDouble(\"" + s + "\")");
+  double d;
+  if (!parse_number(p, end, d))
+    return false;
+  x = (float) d;
+  return true;
+}
+inline bool parse_number(const char*& p, const char* end, int& x)
+{
+  const char* q = p;
+  bool negative = false;
+  if (q < end && (*q == '-' || *q == '+')) {
+    negative = (*q == '-');
+    q++;
+  }
+  if (q == end || *q < '0' || *q > '9')
+    return false;
+  long long value = 0;
+  while (q < end && *q >= '0' && *q <= '9') {
+    value = value*10 + (*q - '0');
+    if (value > 2147483648LL)
+      return false;
+    q++;
+  }
+  if (negative)
+    value = -value;
+  if (value > 2147483647LL)
+    return false;
+  x = (int) value;
+  p = q;
+  return true;
+}
+inline bool parse_number(const char*& p, const char* end, unsigned int& x)
+{
+  const char* q = p;
+  if (q < end && *q == '+')
+    q++;
+  if (q == end || *q < '0' || *q > '9')
+    return false;
+  unsigned long long value = 0;
+  while (q < end && *q >= '0' && *q <= '9') {
+    value = value*10 + (*q - '0');
+    if (value > 4294967295ULL)
+      return false;
+    q++;
+  }
+  x = (unsigned int) value;
+  p = q;
+  return true;
+}
+/**
+ * Parse a number from a string, leading spaces being skipped.
+ * @throw BadConversion if string does not start with a number
+ */
+template <typename T>
+inline T to_number(const std::string& s, const char* name)
+{
+  const char* p = s.c_str();
+  const char* end = p + s.size();
+  while (p < end && (*p == ' ' || *p == '\t' || *p == '\n' || *p == '\r'))
+    p++;
+  T x;
+  if (!parse_number(p, end, x))
+    throw BadConversion(std::string(name) + "(\"" + s + "\")");
   return x;
 }
+inline double to_double(const std::string& s)
+{
+  return to_number<double>(s, "convertToDouble");
+}
 inline float to_float(const std::string& s)
 {
-  std::istringstream i(s);
-  float x;
-  if (!(i >> x))
-    throw BadConversion("convertToFloat(\"" + s + "\")");
-  return x;
+  return to_number<float>(s, "convertToFloat");
 }
 inline int to_int(const std::string& s)
 {
-  std::istringstream i(s);
-  int x;
-  if (!(i >> x))
-    throw BadConversion("convertToInt(\"" + s + "\")");
-  return x;
+  return to_number<int>(s, "convertToInt");
 }
 inline int to_unsigned_int(const std::string& s)
 {
-  std::istringstream i(s);
-  unsigned int x;
-  if (!(i >> x))
-    throw BadConversion("convertToUnsignedInt(\"" + s + "\")");
-  return x;
+  return to_number<unsigned int>(s, "convertToUnsignedInt");
 }
 /**
  * Tokenize a string 'str' into a vector of strings according to delimiter.
@@ -52,7 +212,7 @@ inline int to_unsigned_int(const std::string& s)
  * @param tokens vector of string token
  * @param delimiters between each token
  */
-void tokenize(const std::string& str,
+inline void tokenize(const std::string& str,
                       std::vector<std::string>& tokens,
                       const std::string& delimiters = " ")
 {
@@ -71,3 +231,4 @@ void tokenize(const std::string& str,
         pos = str.find_first_of(delimiters, lastPos);
     }
 }
+#endif
@@ -42,9 +42,6 @@ Cube::render (void)
     compute_visibility();
     if (not get_visible()) return;
 
-    GLint mode;
-    glGetIntegerv (GL_RENDER_MODE, &mode);
-
     struct face {
         float vertices[4*3];
         float normal[3];
@@ -67,8 +64,7 @@ Cube::render (void)
 
     /* Cube faces are z sorted for correct translucency */
     /* z sorting is done on faces center */
-	float m[16];
-	glGetFloatv (GL_MODELVIEW_MATRIX, m);
+    const float *m = RenderState::get_modelview ();
     for (int i=0; i<6; i++)
         faces[i].z = faces[i].normal[0]*m[2]
                   +  faces[i].normal[1]*m[6]
@@ -84,13 +80,9 @@ Cube::render (void)
     glEnable (GL_LINE_SMOOTH);
 
 
-    if (mode == GL_SELECT) {
-        glLoadName (id_);
-    }
-
-    glPushMatrix();
-    glScalef (get_size().x, get_size().y, get_size().z);
-    glTranslatef (get_position().x, get_position().y, get_position().z);
+    RenderState::push_matrix();
+    RenderState::scale (get_size().x, get_size().y, get_size().z);
+    RenderState::translate (get_position().x, get_position().y, get_position().z);
 
     for (int i=0; i<6; i++) {
         glPolygonMode (GL_FRONT_AND_BACK, GL_FILL);
@@ -119,9 +111,6 @@ Cube::render (void)
         glEnd();
         glDepthMask (GL_TRUE);
     }
-    glPopMatrix();
-    if (mode == GL_SELECT) {
-        glLoadName (0);
-    }
+    RenderState::pop_matrix();
     glPopAttrib();
 }
@@ -16,6 +16,7 @@
  * 25 may 2011 : modified by Alain Dutech
  */
 #include "curve.h"
+#include "picker.h"
 //#include "shapes.h"
 #include <iostream>
 
@@ -60,8 +61,10 @@ Curve::render (void)
     //  Rendering using GL_LINE_STRIP
     // -------------------------------------------------------------------------
     if ((thickness_ == 0) or (thickness_ > 1.0)) {
-        glEnable (GL_BLEND);
-        glEnable (GL_LINE_SMOOTH);
+        if (not Picker::get_active()) {
+            glEnable (GL_BLEND);
+            glEnable (GL_LINE_SMOOTH);
+        }
         if (thickness_ == 0)
             glLineWidth (1.0);
         else
@@ -89,6 +92,7 @@ Curve::render (void)
 void
 Curve::add_xyz ( double x, double y, double z )
 {
+  set_dirty ();
   Position point(x, y, z, 0.0);
 
   if( _data.size() > (unsigned int) (_cache_size)) {
@@ -104,6 +108,7 @@ Curve::add_xyz ( double x, double y, double z )
 void
 Curve::add_xyz_c ( double x, double y, double z, DataPtr cdata)
 {
+  set_dirty ();
   add_xyz( x, y, z);
 }
 
@@ -111,6 +116,7 @@ Curve::add_xyz_c ( double x, double y, double z, DataPtr cdata)
 void
 Curve::add_yz ( double y, double z )
 {
+  set_dirty ();
   Position point(0.0, y, z, 0.0);
 
   if( _data.size() > (unsigned int) (_cache_size)) {
@@ -126,12 +132,14 @@ Curve::add_yz ( double y, double z )
 void
 Curve::add_yz_c ( double y, double z, DataPtr cdata)
 {
+  set_dirty ();
   add_yz( y, z);
 }
 // __________________________________________________________________ reset_data
 void
 Curve::reset_data (void)
 {
+  set_dirty ();
   _data.clear();
 }
 
@@ -148,6 +156,7 @@ Curve::get_thickness (void) const
 void
 Curve::set_thickness (float thickness)
 {
+    set_dirty ();
     thickness_ = thickness;
 }
 
@@ -164,6 +173,7 @@ Curve::get_colormap (void)
 void
 Curve::set_colormap (ColormapPtr colormap)
 {
+    set_dirty ();
     cmap_ = colormap;
 }
 
@@ -171,6 +181,7 @@ Curve::set_colormap (ColormapPtr colormap)
 void
 Curve::set_range_coordX (Range range)
 {
+  set_dirty ();
   _rgX = range;
   _rgX.min = 0.0;
   _cache_size = (unsigned int ) abs(ceil(_rgX.max));
@@ -189,6 +200,7 @@ Curve::get_range_coordX (void)
 void
 Curve::set_range_coordY (Range range)
 {
+  set_dirty ();
   _rgY = range;
 }
 Range
@@ -200,6 +212,7 @@ Curve::get_range_coordY (void)
 void
 Curve::set_range_coordZ (Range range)
 {
+  set_dirty ();
   _rgZ = range;
 }
 Range
@@ -0,0 +1,253 @@
+/*
+ * Copyright (C) 2008 Nicolas P. Rougier
+ *
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <climits>
+#include <stdexcept>
+#include "data-view.h"
+
+
+// ____________________________________________________________________ DataView
+DataView::DataView (DataPtr parent,
+                    unsigned int first, unsigned int step, int component,
+                    unsigned int width, unsigned int height) : Data ()
+{
+    if (not parent) {
+        throw std::invalid_argument ("Data view parent must be valid data");
+    }
+    parent_ = parent;
+    first_ = first;
+    step_ = step;
+    component_ = component;
+    width_ = width;
+    height_ = height;
+    parent_version_ = parent_->get_version();
+}
+
+
+// ___________________________________________________________________ ~DataView
+DataView::~DataView (void)
+{}
+
+
+// __________________________________________________________________ get_parent
+DataPtr
+DataView::get_parent (void) const
+{
+    return parent_;
+}
+
+
+// _______________________________________________________________________ slide
+void
+DataView::slide (unsigned int first)
+{
+    size_t size = size_t(get_width())*get_height();
+    size_t total = size_t(parent_->get_width())*parent_->get_height();
+    if ((size > 0) and ((first >= total) or
+                        ((size-1)*size_t(step_) > (total-1-first)))) {
+        throw std::invalid_argument ("Data view out of range");
+    }
+    sync ();
+    first_ = first;
+    record (0, UINT_MAX);
+}
+
+
+// ___________________________________________________________________ get_first
+unsigned int
+DataView::get_first (void) const
+{
+    return first_;
+}
+
+
+// __________________________________________________________________ get_buffer
+BufferPtr
+DataView::get_buffer (void) const
+{
+    return parent_->get_buffer();
+}
+
+
+// ____________________________________________________________________ get_data
+const void *
+DataView::get_data (void) const
+{
+    const GLbyte *data = (const GLbyte *) parent_->get_data();
+    if (not data)
+        return 0;
+    data += size_t(first_)*parent_->get_stride();
+    if (component_ >= 0)
+        data += component_*type_size (parent_->get_type());
+    return data;
+}
+
+
+// ____________________________________________________________________ set_data
+void
+DataView::set_data (const void *data)
+{
+    throw std::invalid_argument ("Data view storage cannot be changed");
+}
+
+
+// ___________________________________________________________________ set_width
+void
+DataView::set_width (const unsigned int width)
+{
+    throw std::invalid_argument ("Data view width cannot be changed");
+}
+
+
+// __________________________________________________________________ set_height
+void
+DataView::set_height (const unsigned int height)
+{
+    throw std::invalid_argument ("Data view height cannot be changed");
+}
+
+
+// ___________________________________________________________________ get_depth
+unsigned int
+DataView::get_depth (void) const
+{
+    if (component_ >= 0)
+        return 1;
+    return parent_->get_depth();
+}
+
+
+// ___________________________________________________________________ set_depth
+void
+DataView::set_depth (const unsigned int depth)
+{
+    throw std::invalid_argument ("Data view depth cannot be changed");
+}
+
+
+// ____________________________________________________________________ get_type
+unsigned int
+DataView::get_type (void) const
+{
+    return parent_->get_type();
+}
+
+
+// ____________________________________________________________________ set_type
+void
+DataView::set_type (const unsigned int type)
+{
+    throw std::invalid_argument ("Data view type cannot be changed");
+}
+
+
+// __________________________________________________________________ get_stride
+unsigned int
+DataView::get_stride (void) const
+{
+    return step_*parent_->get_stride();
+}
+
+
+// __________________________________________________________________ set_stride
+void
+DataView::set_stride (const unsigned int stride)
+{
+    throw std::invalid_argument ("Data view stride cannot be changed");
+}
+
+
+// __________________________________________________________________ mark_dirty
+void
+DataView::mark_dirty (void)
+{
+    mark_dirty (0, get_width()*get_height());
+}
+
+
+// __________________________________________________________________ mark_dirty
+void
+DataView::mark_dirty (unsigned int offset, unsigned int count)
+{
+    if (count == 0) {
+        parent_->mark_dirty (first_, 0);
+        return;
+    }
+    parent_->mark_dirty (first_ + offset*step_, (count-1)*step_ + 1);
+}
+
+
+// _________________________________________________________________ get_version
+unsigned long
+DataView::get_version (void) const
+{
+    const_cast<DataView *>(this)->sync ();
+    return version_;
+}
+
+
+// _________________________________________________________________ get_tracked
+bool
+DataView::get_tracked (void) const
+{
+    return parent_->get_tracked();
+}
+
+
+// _________________________________________________________________ get_pending
+bool
+DataView::get_pending (void) const
+{
+    return parent_->get_pending();
+}
+
+
+// ___________________________________________________________________ get_dirty
+bool
+DataView::get_dirty (unsigned long version,
+                     unsigned int &offset, unsigned int &count) const
+{
+    const_cast<DataView *>(this)->sync ();
+    return Data::get_dirty (version, offset, count);
+}
+
+
+// ________________________________________________________________________ sync
+void
+DataView::sync (void)
+{
+    unsigned long version = parent_->get_version();
+    if (version == parent_version_)
+        return;
+    unsigned int offset, count;
+    bool dirty = parent_->get_dirty (parent_version_, offset, count);
+    parent_version_ = version;
+    unsigned int size = get_width()*get_height();
+    if ((not dirty) or (count == 0) or (size == 0))
+        return;
+
+    // Parent elements [offset,offset+count[ translated into view elements
+    unsigned int end = offset+count;
+    if (end <= first_)
+        return;
+    unsigned int b = 0;
+    if (offset > first_)
+        b = (offset - first_ + step_ - 1)/step_;
+    unsigned int e = (end - 1 - first_)/step_ + 1;
+    if (e > size)
+        e = size;
+    if (b < e)
+        record (b, e);
+}
@@ -0,0 +1,156 @@
+/*
+ * Copyright (C) 2008 Nicolas P. Rougier
+ *
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef __DATA_VIEW_H__
+#define __DATA_VIEW_H__
+#include "data.h"
+
+
+/**
+ * View over part of a data.
+ *
+ * A view does not own nor copy anything: element k of the view is element
+ * first + k*step of its parent data (possibly restricted to one component),
+ * read directly from parent storage. Views follow the parent: changes marked
+ * on the parent are reported by the view for the elements it covers, and
+ * changes marked on the view are marked on the parent.
+ *
+ * Views are obtained from Data::slice, Data::row, Data::column and
+ * Data::component. A slice can be moved over its parent (see slide), for
+ * example to render the last points of a growing array.
+ */
+class DataView : public Data {
+public:
+
+    // _________________________________________________________________________
+
+    /**
+     * @name Creation/Destruction
+     */
+    /**
+     * Default constructor
+     *
+     * @param parent    viewed data
+     * @param first     index of parent element of first view element
+     * @param step      index offset of consecutive view elements in parent
+     * @param component viewed component or -1 for all components
+     * @param width     view width
+     * @param height    view height
+     */
+    DataView (DataPtr parent,
+              unsigned int first, unsigned int step, int component,
+              unsigned int width, unsigned int height);
+
+    /**
+     * Destructor
+     */
+    virtual ~DataView (void);
+    //@}
+
+
+    // _________________________________________________________________________
+
+    /**
+     * @name View
+     */
+    /**
+     * Get viewed data
+     */
+    virtual DataPtr get_parent (void) const;
+
+    /**
+     * Move view over parent data
+     *
+     * @param first index of parent element of first view element
+     */
+    virtual void slide (unsigned int first);
+
+    /**
+     * Get index of parent element of first view element
+     */
+    virtual unsigned int get_first (void) const;
+    //@}
+
+
+    // _________________________________________________________________________
+
+    /**
+     * @name Data
+     */
+    virtual BufferPtr get_buffer (void) const;
+    virtual const void *get_data (void) const;
+    virtual void set_data (const void *data);
+    virtual void set_width (const unsigned int width);
+    virtual void set_height (const unsigned int height);
+    virtual unsigned int get_depth (void) const;
+    virtual void set_depth (const unsigned int depth);
+    virtual unsigned int get_type (void) const;
+    virtual void set_type (const unsigned int type = GL_FLOAT);
+    virtual unsigned int get_stride (void) const;
+    virtual void set_stride (const unsigned int stride = 0);
+    //@}
+
+
+    // _________________________________________________________________________
+
+    /**
+     * @name Versioning
+     */
+    virtual void mark_dirty (void);
+    virtual void mark_dirty (unsigned int offset, unsigned int count);
+    virtual unsigned long get_version (void) const;
+    virtual bool get_tracked (void) const;
+    virtual bool get_pending (void) const;
+    virtual bool get_dirty (unsigned long version,
+                            unsigned int &offset, unsigned int &count) const;
+    //@}
+
+
+protected:
+
+    // _________________________________________________________________________
+
+    /**
+     * Record changes of parent since last synchronization
+     */
+    void sync (void);
+
+    /**
+     * Viewed data
+     */
+    DataPtr parent_;
+
+    /**
+     * Index of parent element of first view element
+     */
+    unsigned int first_;
+
+    /**
+     * Index offset of consecutive view elements in parent
+     */
+    unsigned int step_;
+
+    /**
+     * Viewed component (-1 for all)
+     */
+    int component_;
+
+    /**
+     * Parent version at last synchronization
+     */
+    unsigned long parent_version_;
+};
+
+#endif
@@ -14,7 +14,9 @@
  * this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 #include <stdexcept>
+#include <climits>
 #include "data.h"
+#include "data-view.h"
 
 
 // ________________________________________________________________________ Data
@@ -24,6 +26,8 @@ Data::Data (void)
     type_ = 0;
     data_ = 0;
     stride_ = 0;
+    version_ = 0;
+    tracked_ = false;
 }
 
 
@@ -45,6 +49,62 @@ Data::set (void *data, unsigned int width, unsigned int height,
     set_stride(stride);
 }
 
+// _________________________________________________________________________ set
+void
+Data::set (BufferPtr buffer, unsigned int width, unsigned int height,
+           unsigned int depth, unsigned int type, unsigned int stride)
+{
+    if (not buffer) {
+        throw std::invalid_argument ("Data buffer must be valid");
+    }
+    if ((height > 0) and (width > UINT_MAX/height)) {
+        throw std::invalid_argument ("Data width*height is too large");
+    }
+    const Buffer &storage = *buffer;
+    set ((void *) storage.get_data(), width, height, depth, type, stride);
+    size_t size = size_t (width)*height;
+    if ((size > 0) and (((size-1)*get_stride() + depth*type_size (type)) >
+                        storage.get_size())) {
+        set_data (0);
+        throw std::invalid_argument ("Data does not fit in buffer");
+    }
+    buffer_ = buffer;
+}
+
+
+// _________________________________________________________________________ map
+void
+Data::map (const std::string &filename, size_t offset,
+           unsigned int width, unsigned int height, unsigned int depth,
+           unsigned int type, unsigned int stride, Buffer::Access access)
+{
+    unsigned int size = type_size (type);
+    if (size == 0) {
+        throw std::invalid_argument
+            ("Data type must be GL_[BYTE,SHORT,INT,FLOAT,DOUBLE]");
+    }
+    if ((height > 0) and (width > UINT_MAX/height)) {
+        throw std::invalid_argument ("Data width*height is too large");
+    }
+    size_t n = size_t (width)*height;
+    if (n == 0) {
+        throw std::invalid_argument ("Data must not be empty");
+    }
+    if (stride == 0)
+        stride = depth*size;
+    size_t length = (n-1)*stride + depth*size;
+    BufferPtr buffer = BufferPtr (new Buffer (filename, offset, length, access));
+    set (buffer, width, height, depth, type, stride);
+}
+
+
+// __________________________________________________________________ get_buffer
+BufferPtr
+Data::get_buffer (void) const
+{
+    return buffer_;
+}
+
 // ___________________________________________________________________ get_width
 unsigned int
 Data::get_width (void) const
@@ -58,6 +118,7 @@ void
 Data::set_width (const unsigned int width)
 {
     width_ = width;
+    record (0, UINT_MAX);
 }
 
 
@@ -74,6 +135,7 @@ void
 Data::set_height (const unsigned int height)
 {
     height_ = height;
+    record (0, UINT_MAX);
 }
 
 
@@ -91,6 +153,7 @@ Data::set_depth (const unsigned int depth)
 {
     if (depth > 0) {
         depth_ = depth;
+        record (0, UINT_MAX);
         return;
     }
     throw std::invalid_argument ("Data depth must be at least 1");    
@@ -115,6 +178,7 @@ Data::set_type (const unsigned int type)
         (type == GL_FLOAT) or
         (type == GL_DOUBLE)) {
         type_ = type;
+        record (0, UINT_MAX);
         return;
     }
     throw std::invalid_argument
@@ -128,17 +192,7 @@ Data::get_stride (void) const
 {
     if (stride_ != 0)
         return stride_;
-    else if (type_ == GL_BYTE)
-        return depth_*sizeof (GLbyte);
-    else if (type_ == GL_SHORT)
-        return depth_*sizeof (GLshort);
-    else if (type_ == GL_INT)
-        return depth_*sizeof (GLint);
-    else if (type_ == GL_FLOAT)
-        return depth_*sizeof (GLfloat);
-    else if (type_ == GL_DOUBLE)
-        return depth_*sizeof (GLdouble);
-    return 0;
+    return depth_*type_size (type_);
 }
 
 
@@ -147,6 +201,7 @@ void
 Data::set_stride (const unsigned int stride)
 {
     stride_ = stride;
+    record (0, UINT_MAX);
 } 
 
 // ___________________________________________________________________ get_data
@@ -162,4 +217,170 @@ void
 Data::set_data (const void *data)
 {
     data_ = data;
+    buffer_ = BufferPtr();
+    record (0, UINT_MAX);
+}
+
+
+// __________________________________________________________________ mark_dirty
+void
+Data::mark_dirty (void)
+{
+    tracked_ = true;
+    record (0, UINT_MAX);
+}
+
+
+// __________________________________________________________________ mark_dirty
+void
+Data::mark_dirty (unsigned int offset, unsigned int count)
+{
+    tracked_ = true;
+    record (offset, offset+count);
+}
+
+
+// _________________________________________________________________ get_version
+unsigned long
+Data::get_version (void) const
+{
+    return version_;
+}
+
+
+// _________________________________________________________________ get_tracked
+bool
+Data::get_tracked (void) const
+{
+    return tracked_;
+}
+
+
+// _________________________________________________________________ get_pending
+bool
+Data::get_pending (void) const
+{
+    return false;
+}
+
+
+// ___________________________________________________________________ get_dirty
+bool
+Data::get_dirty (unsigned long version,
+                 unsigned int &offset, unsigned int &count) const
+{
+    unsigned int size = width_*height_;
+    offset = 0;
+    count = size;
+    if (not get_tracked())
+        return true;
+    if (version == version_)
+        return false;
+    if ((version > version_) or ((version_ - version) > history_size))
+        return true;
+
+    unsigned int begin = UINT_MAX, end = 0;
+    for (unsigned long v=version+1; v<=version_; v++) {
+        const Range &range = history_[v % history_size];
+        if (range.begin < begin)
+            begin = range.begin;
+        if (range.end > end)
+            end = range.end;
+    }
+    if (end > size)
+        end = size;
+    if (begin >= end) {
+        count = 0;
+        return true;
+    }
+    offset = begin;
+    count = end-begin;
+    return true;
+}
+
+
+// _______________________________________________________________________ slice
+DataPtr
+Data::slice (unsigned int offset, unsigned int count)
+{
+    size_t size = size_t(get_width())*get_height();
+    if ((count > size) or (offset > (size - count))) {
+        throw std::invalid_argument ("Data slice out of range");
+    }
+    return DataPtr (new DataView (self(), offset, 1, -1, count, 1));
+}
+
+
+// _________________________________________________________________________ row
+DataPtr
+Data::row (unsigned int j)
+{
+    if (j >= get_height()) {
+        throw std::invalid_argument ("Data row out of range");
+    }
+    return slice (j*get_width(), get_width());
+}
+
+
+// ______________________________________________________________________ column
+DataPtr
+Data::column (unsigned int i)
+{
+    if (i >= get_width()) {
+        throw std::invalid_argument ("Data column out of range");
+    }
+    return DataPtr (new DataView (self(), i, get_width(), -1,
+                                  get_height(), 1));
+}
+
+
+// ___________________________________________________________________ component
+DataPtr
+Data::component (unsigned int k)
+{
+    if (k >= get_depth()) {
+        throw std::invalid_argument ("Data component out of range");
+    }
+    return DataPtr (new DataView (self(), 0, 1, k,
+                                  get_width(), get_height()));
+}
+
+
+// ___________________________________________________________________ type_size
+unsigned int
+Data::type_size (unsigned int type)
+{
+    if (type == GL_BYTE)
+        return sizeof (GLbyte);
+    else if (type == GL_SHORT)
+        return sizeof (GLshort);
+    else if (type == GL_INT)
+        return sizeof (GLint);
+    else if (type == GL_FLOAT)
+        return sizeof (GLfloat);
+    else if (type == GL_DOUBLE)
+        return sizeof (GLdouble);
+    return 0;
+}
+
+
+// ________________________________________________________________________ self
+DataPtr
+Data::self (void)
+{
+#if defined(HAVE_BOOST)
+    return shared_from_this();
+#else
+    return this;
+#endif
+}
+
+
+// ______________________________________________________________________ record
+void
+Data::record (unsigned int begin, unsigned int end)
+{
+    version_++;
+    history_[version_ % history_size].begin = begin;
+    history_[version_ % history_size].end = end;
 }
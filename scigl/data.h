@@ -16,9 +16,11 @@
 #ifndef __DATA_H__
 #define __DATA_H__
 #include "object.h"
+#include "buffer.h"
 
 #if defined(HAVE_BOOST)
 #   include <boost/shared_ptr.hpp>
+#   include <boost/enable_shared_from_this.hpp>
     typedef boost::shared_ptr<class Data> DataPtr;
 #else
     typedef class Data *                  DataPtr;
@@ -28,8 +30,15 @@
 /**
  * Encapsulation of raw data
  *
+ * Views over part of a data (see slice, row, column and component) share its
+ * storage and its changes. Data must be held by a DataPtr for views to be
+ * created.
  */
-class Data {
+class Data
+#if defined(HAVE_BOOST)
+    : public boost::enable_shared_from_this<Data>
+#endif
+{
 public:
 
     // _________________________________________________________________________
@@ -79,6 +88,49 @@ public:
                       unsigned int depth = 1,
                       unsigned int type = GL_FLOAT,
                       unsigned int stride = 0);
+
+    /**
+     * Set data structure over an owned buffer
+     *
+     * Data keeps a reference on the buffer such that it stays alive as long
+     * as data uses it. Arguments are the same as above.
+     *
+     * @param buffer Specifies the buffer holding the data array.
+     */
+    virtual void set (BufferPtr buffer,
+                      unsigned int width = 1,
+                      unsigned int height = 1,
+                      unsigned int depth = 1,
+                      unsigned int type = GL_FLOAT,
+                      unsigned int stride = 0);
+
+    /**
+     * Get buffer holding data
+     *
+     * @return buffer or an empty BufferPtr if data is not held by a buffer
+     */
+    virtual BufferPtr get_buffer (void) const;
+
+    /**
+     * Set data structure over a memory mapped file
+     *
+     * The file is mapped read-only and pages are only read from disk when
+     * accessed, such that arrays larger than memory can be used. Data must
+     * be laid out in the file as it would be in memory. Arguments are the
+     * same as above.
+     *
+     * @param filename Specifies the file holding the data array.
+     * @param offset   Specifies the offset of the first element in the file.
+     * @param access   Specifies the expected access pattern.
+     */
+    virtual void map (const std::string &filename,
+                      size_t offset,
+                      unsigned int width = 1,
+                      unsigned int height = 1,
+                      unsigned int depth = 1,
+                      unsigned int type = GL_FLOAT,
+                      unsigned int stride = 0,
+                      Buffer::Access access = Buffer::ACCESS_NORMAL);
     //@}
 
     // _________________________________________________________________________
@@ -160,6 +212,8 @@ public:
     /**
      * Set data pointer
      *
+     * Any buffer previously set is released.
+     *
      * @param data Specifies a pointer to the data array.
      */
     virtual void set_data (const void *data);
@@ -188,6 +242,14 @@ public:
      *
      */
     virtual void set_type (const unsigned int type = GL_FLOAT);
+
+    /**
+     * Get size in bytes of a data type
+     *
+     * @param type data type (GL_[BYTE,SHORT,INT,FLOAT,DOUBLE])
+     * @return type size, 0 if type is not supported
+     */
+    static unsigned int type_size (unsigned int type);
     //@}
 
     // _________________________________________________________________________
@@ -213,6 +275,104 @@ public:
     //@}
 
 
+    // _________________________________________________________________________
+
+    /**
+     * @name Versioning
+     */
+    /**
+     * Signal that the whole data array changed
+     */
+    virtual void mark_dirty (void);
+
+    /**
+     * Signal that part of the data array changed
+     *
+     * @param offset index of first changed element (row major for 2d data)
+     * @param count  number of changed elements
+     */
+    virtual void mark_dirty (unsigned int offset, unsigned int count);
+
+    /**
+     * Get data version
+     *
+     * Version is incremented each time data is marked as dirty or its
+     * structure is changed through one of the setters.
+     *
+     * @return current version
+     */
+    virtual unsigned long get_version (void) const;
+
+    /**
+     * Whether changes of data are signalled through mark_dirty
+     *
+     * Data is tracked as soon as mark_dirty has been called once. Untracked
+     * data is considered to change at any time.
+     */
+    virtual bool get_tracked (void) const;
+
+    /**
+     * Whether changes are waiting to be reflected by the version
+     *
+     * Data whose version only moves at the start of a rendering frame (see
+     * TripleData) report here that a new frame has been published since, so
+     * that an on demand rendering loop knows it has to render.
+     */
+    virtual bool get_pending (void) const;
+
+    /**
+     * Get range of elements changed since a given version
+     *
+     * The range covers all elements if data is not tracked or if version is
+     * too old for changes to be known.
+     *
+     * @param version version previously read with get_version
+     * @param offset  index of first changed element
+     * @param count   number of changed elements
+     * @return whether some elements changed
+     */
+    virtual bool get_dirty (unsigned long version,
+                            unsigned int &offset, unsigned int &count) const;
+    //@}
+
+
+    // _________________________________________________________________________
+
+    /**
+     * @name Views
+     */
+    /**
+     * Get a linear view over consecutive elements
+     *
+     * @param offset index of first element (row major for 2d data)
+     * @param count  number of elements
+     * @return view sharing data storage
+     */
+    virtual DataPtr slice (unsigned int offset, unsigned int count);
+
+    /**
+     * Get a linear view over a row of 2d data
+     *
+     * @param j row index
+     */
+    virtual DataPtr row (unsigned int j);
+
+    /**
+     * Get a linear view over a column of 2d data
+     *
+     * @param i column index
+     */
+    virtual DataPtr column (unsigned int i);
+
+    /**
+     * Get a view over a single component (depth) of data
+     *
+     * @param k component index
+     */
+    virtual DataPtr component (unsigned int k);
+    //@}
+
+
 protected:
 
     // _________________________________________________________________________
@@ -222,6 +382,11 @@ protected:
      */
     const void * data_;
 
+    /**
+     * Buffer holding data, if any
+     */
+    BufferPtr buffer_;
+
     /**
      * Type
      */
@@ -246,6 +411,43 @@ protected:
      * Stride
      */
     unsigned int stride_;
+
+    /**
+     * Get a pointer to this data
+     */
+    DataPtr self (void);
+
+    /**
+     * Record a change of elements [begin,end[ as a new version
+     */
+    void record (unsigned int begin, unsigned int end);
+
+    /**
+     * Number of versions whose changed range is remembered
+     */
+    static const unsigned int history_size = 16;
+
+    /**
+     * Changed range of a version
+     */
+    struct Range {
+        unsigned int begin, end;
+    };
+
+    /**
+     * Changed ranges of last versions, indexed by version % history_size
+     */
+    Range history_[history_size];
+
+    /**
+     * Current version
+     */
+    unsigned long version_;
+
+    /**
+     * Whether changes are signalled
+     */
+    bool tracked_;
 };
 
 #endif
@@ -0,0 +1,339 @@
+/*
+ * Copyright (C) 2008 Nicolas P. Rougier
+ *
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+#include "font-registry.h"
+#include "font_12.h"
+#include "font_16.h"
+#include "font_24.h"
+#include "font_32.h"
+
+
+// ____________________________________________________________________ bitmaps
+// Glyph bitmaps are only referenced from here such that the library holds a
+// single copy of them whatever the number of files including font.h. They are
+// run length encoded (see tools/rle-font.py) and decoded on first request.
+static const struct {
+    unsigned int size;
+    unsigned int width;
+    unsigned int height;
+    unsigned int length;
+    const unsigned char *data;
+} bitmaps[] = {
+    {12, font_12.width, font_12.height, font_12.length, font_12.data},
+    {16, font_16.width, font_16.height, font_16.length, font_16.data},
+    {24, font_24.width, font_24.height, font_24.length, font_24.data},
+    {32, font_32.width, font_32.height, font_32.length, font_32.data}
+};
+
+
+// ________________________________________________________________ static state
+FontPtr FontRegistry::fonts_[FontRegistry::count_];
+bool FontRegistry::uploaded_[FontRegistry::count_] = {false, false, false, false};
+std::vector<unsigned char> FontRegistry::cache_[FontRegistry::count_];
+GLuint FontRegistry::texture_ = 0;
+FontPtr FontRegistry::sdf_font_;
+GLuint FontRegistry::sdf_texture_ = 0;
+GLuint FontRegistry::sdf_program_ = 0;
+bool FontRegistry::sdf_tried_ = false;
+
+// Distance (in pixels of the 32 glyphs) covered by the distance field
+static const unsigned int sdf_spread = 4;
+
+// Coverage is the distance mapped through a smoothstep as wide as a screen
+// pixel, such that edges are antialiased whatever the scale.
+static const char *sdf_fragment_source =
+    "uniform sampler2D atlas;\n"
+    "void main() {\n"
+    "    float d = texture2D (atlas, gl_TexCoord[0].st).a;\n"
+    "    float w = max (fwidth (d), 1.0/255.0);\n"
+    "    float a = smoothstep (0.5-w, 0.5+w, d);\n"
+    "    gl_FragColor = vec4 (gl_Color.rgb, gl_Color.a*a);\n"
+    "}\n";
+
+
+// _______________________________________________________________________ index
+unsigned int
+FontRegistry::index (unsigned int size)
+{
+    for (unsigned int i=0; i<count_; i++) {
+        if (bitmaps[i].size == size)
+            return i;
+    }
+    throw std::invalid_argument ("FontRegistry: no font of that size");
+}
+
+
+// _________________________________________________________________________ has
+bool
+FontRegistry::has (unsigned int size)
+{
+    for (unsigned int i=0; i<count_; i++) {
+        if (bitmaps[i].size == size)
+            return true;
+    }
+    return false;
+}
+
+
+// _________________________________________________________________________ get
+FontPtr
+FontRegistry::get (unsigned int size)
+{
+    unsigned int i = index (size);
+    if (not fonts_[i])
+        fonts_[i] = FontPtr (new Font (size));
+    return fonts_[i];
+}
+
+
+// _____________________________________________________________________ get_sdf
+FontPtr
+FontRegistry::get_sdf (void)
+{
+    if (not sdf_font_)
+        sdf_font_ = FontPtr (new Font (32, true));
+    return sdf_font_;
+}
+
+
+// ___________________________________________________________________ get_width
+unsigned int
+FontRegistry::get_width (void)
+{
+    unsigned int width = 0;
+    for (unsigned int i=0; i<count_; i++) {
+        if (bitmaps[i].width > width)
+            width = bitmaps[i].width;
+    }
+    return width;
+}
+
+
+// __________________________________________________________________ get_height
+unsigned int
+FontRegistry::get_height (void)
+{
+    // One empty row between sizes such that linear filtering at the bottom
+    // of a glyph never picks the top of the glyphs of the next size.
+    unsigned int height = 0;
+    for (unsigned int i=0; i<count_; i++)
+        height += bitmaps[i].height + 1;
+    return height;
+}
+
+
+// __________________________________________________________________ get_region
+FontRegistry::Region
+FontRegistry::get_region (unsigned int size)
+{
+    unsigned int j = index (size);
+    Region region;
+    region.x = 0;
+    region.y = 0;
+    for (unsigned int i=0; i<j; i++)
+        region.y += bitmaps[i].height + 1;
+    region.width = bitmaps[j].width;
+    region.height = bitmaps[j].height;
+    return region;
+}
+
+
+// ______________________________________________________________________ decode
+void
+FontRegistry::decode (const unsigned char *packed, unsigned int length,
+                      unsigned char *bitmap, unsigned int size)
+{
+    const unsigned char *end = packed + length;
+    unsigned int n = 0;
+    while (packed < end) {
+        unsigned int c = *packed++;
+        if (c < 128) {
+            c += 1;
+            if ((packed+c > end) or (n+c > size))
+                break;
+            for (unsigned int i=0; i<c; i++)
+                bitmap[n++] = *packed++;
+        } else {
+            c -= 126;
+            if ((packed >= end) or (n+c > size))
+                break;
+            for (unsigned int i=0; i<c; i++)
+                bitmap[n++] = *packed;
+            packed++;
+        }
+    }
+    if ((packed != end) or (n != size))
+        throw std::runtime_error ("FontRegistry: corrupted glyph bitmap");
+}
+
+
+// __________________________________________________________________ get_bitmap
+const unsigned char *
+FontRegistry::get_bitmap (unsigned int size)
+{
+    unsigned int i = index (size);
+    if (cache_[i].empty()) {
+        cache_[i].resize (bitmaps[i].width*bitmaps[i].height);
+        decode (bitmaps[i].data, bitmaps[i].length,
+                &cache_[i][0], cache_[i].size());
+    }
+    return &cache_[i][0];
+}
+
+
+// _____________________________________________________________ get_packed_size
+unsigned int
+FontRegistry::get_packed_size (unsigned int size)
+{
+    return bitmaps[index (size)].length;
+}
+
+
+// _________________________________________________________________ get_texture
+GLuint
+FontRegistry::get_texture (void)
+{
+    return texture_;
+}
+
+
+// ______________________________________________________________________ upload
+GLuint
+FontRegistry::upload (unsigned int size)
+{
+    unsigned int i = index (size);
+    if (not texture_) {
+        // Texture is allocated at its final size once and for all but left
+        // empty (zeroed), glyphs being copied in as sizes are requested.
+        unsigned int width = get_width();
+        unsigned int height = get_height();
+        std::vector<unsigned char> zero (width*height, 0);
+        glGenTextures (1, &texture_);
+        glBindTexture (GL_TEXTURE_2D, texture_);
+        glTexParameterf (GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameterf (GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexImage2D (GL_TEXTURE_2D, 0, GL_ALPHA, width, height,
+                      0, GL_ALPHA, GL_UNSIGNED_BYTE, &zero[0]);
+        for (unsigned int j=0; j<count_; j++)
+            uploaded_[j] = false;
+    } else {
+        glBindTexture (GL_TEXTURE_2D, texture_);
+    }
+    if (not uploaded_[i]) {
+        Region region = get_region (size);
+        glTexSubImage2D (GL_TEXTURE_2D, 0, region.x, region.y,
+                         region.width, region.height,
+                         GL_ALPHA, GL_UNSIGNED_BYTE, get_bitmap (size));
+        uploaded_[i] = true;
+    }
+    return texture_;
+}
+
+
+// ______________________________________________________________ distance_field
+void
+FontRegistry::distance_field (const unsigned char *bitmap,
+                              unsigned int width, unsigned int height,
+                              unsigned int columns, unsigned int rows,
+                              unsigned int spread, unsigned char *field)
+{
+    int cw = width/columns, ch = height/rows;
+    int r = spread;
+    for (int y=0; y<int(height); y++) {
+        int cy = (y/ch)*ch;
+        for (int x=0; x<int(width); x++) {
+            int cx = (x/cw)*cw;
+            bool inside = bitmap[y*width+x] >= 128;
+
+            // Nearest pixel on the other side of the edge within the cell
+            int best = (r+1)*(r+1);
+            for (int j=std::max(y-r, cy); j<std::min(y+r+1, cy+ch); j++) {
+                for (int i=std::max(x-r, cx); i<std::min(x+r+1, cx+cw); i++) {
+                    if ((bitmap[j*width+i] >= 128) != inside) {
+                        int d = (i-x)*(i-x) + (j-y)*(j-y);
+                        if (d < best)
+                            best = d;
+                    }
+                }
+            }
+            // Edge lies half way between the two pixel centers
+            float d = sqrt (float (best)) - .5f;
+            if (d > r)
+                d = r;
+            if (not inside)
+                d = -d;
+            float v = 127.5f + 127.5f*d/r;
+            field[y*width+x] = (unsigned char) (std::max (0.0f, std::min (255.0f, v)) + .5f);
+        }
+    }
+}
+
+
+// __________________________________________________________________ upload_sdf
+GLuint
+FontRegistry::upload_sdf (void)
+{
+    if (sdf_texture_) {
+        glBindTexture (GL_TEXTURE_2D, sdf_texture_);
+        return sdf_texture_;
+    }
+    unsigned int i = index (32);
+    unsigned int width = bitmaps[i].width;
+    unsigned int height = bitmaps[i].height;
+    std::vector<unsigned char> field (width*height);
+    distance_field (get_bitmap (32), width, height, 16, 12, sdf_spread, &field[0]);
+
+    glGenTextures (1, &sdf_texture_);
+    glBindTexture (GL_TEXTURE_2D, sdf_texture_);
+    glTexParameterf (GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameterf (GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexImage2D (GL_TEXTURE_2D, 0, GL_ALPHA, width, height,
+                  0, GL_ALPHA, GL_UNSIGNED_BYTE, &field[0]);
+    return sdf_texture_;
+}
+
+
+// _____________________________________________________________ get_sdf_program
+GLuint
+FontRegistry::get_sdf_program (void)
+{
+    if (sdf_tried_)
+        return sdf_program_;
+    sdf_tried_ = true;
+    if (not glewIsSupported ("GL_VERSION_2_0"))
+        return 0;
+
+    GLuint shader = glCreateShader (GL_FRAGMENT_SHADER);
+    glShaderSource (shader, 1, &sdf_fragment_source, 0);
+    glCompileShader (shader);
+    GLint status;
+    glGetShaderiv (shader, GL_COMPILE_STATUS, &status);
+    if (status) {
+        sdf_program_ = glCreateProgram ();
+        glAttachShader (sdf_program_, shader);
+        glLinkProgram (sdf_program_);
+        glGetProgramiv (sdf_program_, GL_LINK_STATUS, &status);
+        if (not status) {
+            glDeleteProgram (sdf_program_);
+            sdf_program_ = 0;
+        }
+    }
+    glDeleteShader (shader);
+    return sdf_program_;
+}
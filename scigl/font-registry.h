@@ -0,0 +1,258 @@
+/*
+ * Copyright (C) 2008 Nicolas P. Rougier
+ *
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef __FONT_REGISTRY_H__
+#define __FONT_REGISTRY_H__
+#include <vector>
+#include "font.h"
+
+
+/**
+ * Registry of built-in fonts sharing a single atlas texture.
+ *
+ * Glyph bitmaps of all built-in sizes (12, 16, 24 and 32) are packed one
+ * above the other into a single alpha texture such that switching from one
+ * size to another while rendering does not require to bind another texture.
+ *
+ * The atlas texture is created on first use and the glyphs of a given size
+ * are only decoded and uploaded the first time a font of that size is set up:
+ * sizes that are never rendered cost nothing but their share of the (zeroed)
+ * texture. Glyph bitmaps are compiled in run length encoded.
+ *
+ * A distance field atlas is also derived once from the largest glyphs such
+ * that text drawn at an arbitrary scale (axis labels for example) stays crisp
+ * with a single texture (see get_sdf).
+ *
+ * There is a single registry per process. Its texture and the display lists
+ * of its fonts belong to the share group of the context that was current when
+ * they were created. Contexts rendering text must therefore share objects
+ * with that context.
+ */
+class FontRegistry {
+public:
+
+    /**
+     * Location of the glyphs of one size in the atlas.
+     */
+    struct Region {
+        unsigned int x;        /*!< left of glyph bitmap in atlas   */
+        unsigned int y;        /*!< top of glyph bitmap in atlas    */
+        unsigned int width;    /*!< width of glyph bitmap           */
+        unsigned int height;   /*!< height of glyph bitmap          */
+    };
+
+
+public:
+
+    // _________________________________________________________________________
+
+    /**
+     * @name Fonts
+     */
+    /**
+     * Get built-in font of given size
+     *
+     * The font is created on first call and shared by all subsequent calls.
+     *
+     * @param size font size (12, 16, 24 or 32)
+     * @return font using the atlas
+     */
+    static FontPtr get (unsigned int size);
+
+    /**
+     * Whether a font size is available
+     *
+     * @param size font size
+     */
+    static bool has (unsigned int size);
+
+    /**
+     * Get distance field font
+     *
+     * This font has the glyph size of the 32 font and is meant to be scaled
+     * to any size. Its glyphs are rendered through a threshold shader (or
+     * alpha test if shaders are not available).
+     *
+     * @return font using the distance field atlas
+     */
+    static FontPtr get_sdf (void);
+    //@}
+
+
+    // _________________________________________________________________________
+
+    /**
+     * @name Atlas
+     */
+    /**
+     * Make sure glyphs of given size are in the atlas texture.
+     *
+     * Texture is created if needed and glyphs are uploaded if this is the
+     * first request for that size. Texture stays bound on return.
+     *
+     * @param size font size (12, 16, 24 or 32)
+     * @return atlas texture
+     */
+    static GLuint upload (unsigned int size);
+
+    /**
+     * Get atlas texture (0 if not yet created)
+     */
+    static GLuint get_texture (void);
+
+    /**
+     * Get atlas width in pixels
+     */
+    static unsigned int get_width (void);
+
+    /**
+     * Get atlas height in pixels
+     */
+    static unsigned int get_height (void);
+
+    /**
+     * Get location of the glyphs of given size in the atlas
+     *
+     * @param size font size (12, 16, 24 or 32)
+     */
+    static Region get_region (unsigned int size);
+
+    /**
+     * Get glyph bitmap of given size
+     *
+     * Bitmap is decoded on first call and kept for subsequent ones.
+     *
+     * @param size font size (12, 16, 24 or 32)
+     * @return width x height alpha values (see get_region)
+     */
+    static const unsigned char * get_bitmap (unsigned int size);
+
+    /**
+     * Get size of the encoded glyph bitmap compiled into the library
+     *
+     * @param size font size (12, 16, 24 or 32)
+     */
+    static unsigned int get_packed_size (unsigned int size);
+    //@}
+
+
+    // _________________________________________________________________________
+
+    /**
+     * @name Distance field
+     */
+    /**
+     * Make sure the distance field atlas exists.
+     *
+     * Distance field is computed from the 32 glyphs on first call. Texture
+     * stays bound on return. It has the same layout as the 32 glyph bitmap
+     * (see get_region).
+     *
+     * @return distance field texture
+     */
+    static GLuint upload_sdf (void);
+
+    /**
+     * Get threshold program for distance field glyphs
+     *
+     * @return program or 0 if shaders are not available
+     */
+    static GLuint get_sdf_program (void);
+
+    /**
+     * Compute a signed distance field from a glyph bitmap.
+     *
+     * Bitmap is made of columns x rows cells, distances are only searched
+     * within a cell. Distance in pixels is mapped to [0,255] with 128 on glyph
+     * edges and 0 (resp. 255) at spread pixels outside (resp. inside).
+     *
+     * @param bitmap  glyph bitmap (alpha)
+     * @param width   bitmap width
+     * @param height  bitmap height
+     * @param columns number of cells per row
+     * @param rows    number of cells per column
+     * @param spread  largest distance represented
+     * @param field   distance field (width x height)
+     */
+    static void distance_field (const unsigned char *bitmap,
+                                unsigned int width, unsigned int height,
+                                unsigned int columns, unsigned int rows,
+                                unsigned int spread, unsigned char *field);
+    //@}
+
+
+protected:
+
+    /**
+     * Get index of a font size
+     *
+     * @param size font size
+     * @return index in registry tables
+     * @throw std::invalid_argument if size is not available
+     */
+    static unsigned int index (unsigned int size);
+
+    /**
+     * Decode a run length encoded bitmap (see tools/rle-font.py)
+     *
+     * @param packed encoded bitmap
+     * @param length encoded bitmap length
+     * @param bitmap decoded bitmap
+     * @param size   decoded bitmap size
+     * @throw std::runtime_error if encoded data does not decode to size bytes
+     */
+    static void decode (const unsigned char *packed, unsigned int length,
+                        unsigned char *bitmap, unsigned int size);
+
+
+protected:
+
+    // _________________________________________________________________________
+
+    /**
+     * Number of built-in sizes
+     */
+    static const unsigned int count_ = 4;
+
+    /**
+     * Fonts, created on demand
+     */
+    static FontPtr fonts_[count_];
+
+    /**
+     * Whether glyphs of each size have been uploaded
+     */
+    static bool uploaded_[count_];
+
+    /**
+     * Decoded glyph bitmaps, empty until requested
+     */
+    static std::vector<unsigned char> cache_[count_];
+
+    /**
+     * Atlas texture
+     */
+    static GLuint texture_;
+
+    /**
+     * Distance field font, texture and program
+     */
+    static FontPtr sdf_font_;
+    static GLuint  sdf_texture_;
+    static GLuint  sdf_program_;
+    static bool    sdf_tried_;
+};
+
+#endif
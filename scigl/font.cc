@@ -16,7 +16,10 @@
  */
 #include <vector>
 #include <sstream>
+#include <stdexcept>
 #include "font.h"
+#include "font-registry.h"
+#include "render-state.h"
 
 
 // ________________________________________________________________________ Font
@@ -28,7 +31,37 @@ Font::Font (const unsigned char *data,
 {
     base_ = 0;
     texture_ = 0;
+    size_ = 0;
+    sdf_ = false;
+    program_ = 0;
+    switched_ = false;
+    glyph_size_ = Size (data_width_/16.0, data_height_/12.0);
+    setup_colors();
+}
+
 
+// ________________________________________________________________________ Font
+Font::Font (unsigned int size, bool sdf) : data_ (0),
+                                           data_width_ (FontRegistry::get_region (size).width),
+                                           data_height_ (FontRegistry::get_region (size).height)
+{
+    if (sdf and (size != 32))
+        throw std::invalid_argument ("Font: distance field only exists for size 32");
+    base_ = 0;
+    texture_ = 0;
+    size_ = size;
+    sdf_ = sdf;
+    program_ = 0;
+    switched_ = false;
+    glyph_size_ = Size (data_width_/16.0, data_height_/12.0);
+    setup_colors();
+}
+
+
+// ________________________________________________________________ setup_colors
+void
+Font::setup_colors (void)
+{
     // Setup 256 colors
     colors_[ 0] = Color ( 46/256.0f,  52/256.0f,  54/256.0f, 1.0f);
     colors_[ 1] = Color (204/256.0f,   0/256.0f,   0/256.0f, 1.0f);
@@ -68,20 +101,40 @@ Font::~Font (void)
 void
 Font::setup (void)
 {
-    glGenTextures (1, &texture_);
-    glBindTexture (GL_TEXTURE_2D, texture_);
-    glTexParameterf (GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-    glTexParameterf (GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexImage2D (GL_TEXTURE_2D, 0, GL_ALPHA, data_width_, data_height_,
-                  0, GL_ALPHA, GL_UNSIGNED_BYTE, data_);
+    // Glyphs occupy [x0,x0+data_width_[ x [y0,y0+data_height_[ in a texture
+    // of size width x height.
+    float x0 = 0, y0 = 0;
+    float width = data_width_, height = data_height_;
+    if (sdf_) {
+        texture_ = FontRegistry::upload_sdf ();
+    } else if (size_) {
+        texture_ = FontRegistry::upload (size_);
+        FontRegistry::Region region = FontRegistry::get_region (size_);
+        x0 = region.x;
+        y0 = region.y;
+        width = FontRegistry::get_width();
+        height = FontRegistry::get_height();
+    } else {
+        glGenTextures (1, &texture_);
+        glBindTexture (GL_TEXTURE_2D, texture_);
+        glTexParameterf (GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glTexParameterf (GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+        glTexImage2D (GL_TEXTURE_2D, 0, GL_ALPHA, data_width_, data_height_,
+                      0, GL_ALPHA, GL_UNSIGNED_BYTE, data_);
+    }
     base_ = glGenLists (2*128);
     float cw = data_width_/16.0;
     float ch = data_height_/12.0;
     glyph_size_ = Size (cw,ch);
-    float dx = cw / float (data_width_);
-    float dy = ch / float (data_height_);
+    float dx = cw / width;
+    float dy = ch / height;
+    float ox = x0 / width;
+    float oy = y0 / height;
     for (int t=0; t<2; t++) {
         for (int c=0; c<128; c++) {
+            // Glyphs move the cursor through the modelview matrix when the
+            // list is called, hence raw GL (RenderState only mirrors calls
+            // made outside display lists).
             glNewList (base_+t*128+c, GL_COMPILE);
             if (c == '\n') {
                 glPopMatrix ();
@@ -91,10 +144,10 @@ Font::setup (void)
                 int y = (c-32) / 16 + t*6;
                 int x = (c-32) % 16;
                 glBegin(GL_QUADS);
-                glTexCoord2f((x  )*dx, (y+1)*dy); glVertex2f(0, -ch);
-                glTexCoord2f((x  )*dx, (y  )*dy); glVertex2f(0,   0);
-                glTexCoord2f((x+1)*dx, (y  )*dy); glVertex2f(cw,  0);
-                glTexCoord2f((x+1)*dx, (y+1)*dy); glVertex2f(cw,-ch);
+                glTexCoord2f(ox+(x  )*dx, oy+(y+1)*dy); glVertex2f(0, -ch);
+                glTexCoord2f(ox+(x  )*dx, oy+(y  )*dy); glVertex2f(0,   0);
+                glTexCoord2f(ox+(x+1)*dx, oy+(y  )*dy); glVertex2f(cw,  0);
+                glTexCoord2f(ox+(x+1)*dx, oy+(y+1)*dy); glVertex2f(cw,-ch);
                 glEnd();
             }
             // FIXME: is that right ?
@@ -187,9 +240,10 @@ Font::render (const std::string &text)
 {
     if ((not texture_) or (not base_))
         setup();
-    glBindTexture (GL_TEXTURE_2D, texture_);
+    bind();
     glListBase (base_);
     glCallLists (text.size(), GL_UNSIGNED_BYTE, text.c_str());
+    unbind();
 }
 
 // __________________________________________________________ render_ansi_string
@@ -197,23 +251,34 @@ Size
 Font::render_ansi_string (const std::string &text,
                           float alpha,
                           int justification)
+{
+    Color foreground;
+    glGetFloatv (GL_CURRENT_COLOR, foreground.data);
+    return render_ansi_string (text, foreground, alpha, justification);
+}
+
+// __________________________________________________________ render_ansi_string
+Size
+Font::render_ansi_string (const std::string &text,
+                          const Color &color,
+                          float alpha,
+                          int justification)
 {
     int cw = glyph_size_.x;
     int ch = glyph_size_.y;
 
     if ((not texture_) or (not base_))
         setup();
-    glBindTexture (GL_TEXTURE_2D, texture_);
+    bind();
     glEnable(GL_BLEND);
 
     bool use_underline = false;
     bool use_background = false;
-    Color foreground, fg, bg;
+    Color foreground = color, fg, bg;
 
-    glGetFloatv (GL_CURRENT_COLOR, foreground.data);
-    glColor4f (fg.r, fg.g, fg.b, fg.a*alpha);
     fg = foreground;
     fg.a = 1;
+    glColor4f (fg.r, fg.g, fg.b, fg.a*alpha);
 
     std::vector <std::pair <std::vector<int>, std::string> > fragments;
     fragments = parse_ansi_string (text);
@@ -233,11 +298,11 @@ Font::render_ansi_string (const std::string &text,
             if (justification == -1) {
                 
             } else if (justification == 0) {
-                glPushMatrix();
-                glTranslatef (-textsize*cw/2,0,0);
+                RenderState::push_matrix();
+                RenderState::translate (-textsize*cw/2,0,0);
             } else if (justification == +1) {
-                glPushMatrix();
-                glTranslatef (-textsize*cw,0,0);
+                RenderState::push_matrix();
+                RenderState::translate (-textsize*cw,0,0);
             }
             for (unsigned int j=start; j<=i; j++) {
                 std::vector<int> codes = fragments[j].first;
@@ -298,6 +363,7 @@ Font::render_ansi_string (const std::string &text,
                     }
                 }
                 if ((use_background) and (text.size() > 0)) {
+                    unbind();
                     glDisable(GL_TEXTURE_2D);
                     glColor4f (bg.r, bg.g, bg.b, bg.a*alpha);
                     glBegin(GL_QUADS);
@@ -307,12 +373,14 @@ Font::render_ansi_string (const std::string &text,
                     glVertex2f (cw*int(text.size()), 0);
                     glEnd();
                     glEnable(GL_TEXTURE_2D);
+                    bind();
                     glColor4f (fg.r, fg.g, fg.b, fg.a*alpha);
-                    glTranslatef (0,0,1);
+                    RenderState::translate (0,0,1);
                 }
                 if ((use_underline) and (text.size() > 0)) {
                     if (text[text.size()-1] == '\n') {
                         glCallLists (text.size()-1, GL_UNSIGNED_BYTE, text.c_str());
+                        unbind();
                         glDisable(GL_TEXTURE_2D);
                         glBegin(GL_LINES);
                         glVertex2f (-cw*int(text.size()), -ch-.5);
@@ -322,6 +390,7 @@ Font::render_ansi_string (const std::string &text,
                         
                     } else {
                         glCallLists (text.size(), GL_UNSIGNED_BYTE, text.c_str());
+                        unbind();
                         glDisable(GL_TEXTURE_2D);
                         glBegin(GL_LINES);
                         glVertex2f (-cw*int(text.size()), -ch-.5);
@@ -329,6 +398,7 @@ Font::render_ansi_string (const std::string &text,
                         glEnd();
                     }
                     glEnable(GL_TEXTURE_2D);
+                    bind();
                 } else {
                     glCallLists (text.size(), GL_UNSIGNED_BYTE, text.c_str());
                 }
@@ -336,10 +406,10 @@ Font::render_ansi_string (const std::string &text,
 
             if (justification == -1) {
             } else if (justification == 0) {
-                glPopMatrix();
+                RenderState::pop_matrix();
             } else if (justification == +1) {
-                glPopMatrix();
-                glTranslatef (-textsize*cw,0,0);
+                RenderState::pop_matrix();
+                RenderState::translate (-textsize*cw,0,0);
             }
             start = i+1;
             if (text[text.size()-1] == '\n') {
@@ -355,11 +425,48 @@ Font::render_ansi_string (const std::string &text,
             textsize = 0;
         }
     }
+    unbind();
     return size;
 }
 
 
 
+// ________________________________________________________________________ bind
+void
+Font::bind (void)
+{
+    glBindTexture (GL_TEXTURE_2D, texture_);
+    if (not sdf_)
+        return;
+    // A program already in use (identifier passes) is left bound, as it is
+    // by Cloud for sized points
+    GLuint program = FontRegistry::get_sdf_program();
+    program_ = RenderState::get_program();
+    switched_ = program and not program_;
+    if (switched_) {
+        RenderState::use_program (program);
+    } else if (not program) {
+        glPushAttrib (GL_ENABLE_BIT | GL_COLOR_BUFFER_BIT);
+        glEnable (GL_ALPHA_TEST);
+        glAlphaFunc (GL_GEQUAL, 0.5f);
+    }
+}
+
+
+// ______________________________________________________________________ unbind
+void
+Font::unbind (void)
+{
+    if (not sdf_)
+        return;
+    if (switched_)
+        RenderState::use_program (program_);
+    else if (not FontRegistry::get_sdf_program())
+        glPopAttrib ();
+    switched_ = false;
+}
+
+
 // ______________________________________________________________ get_glyph_size
 Size
 Font::get_glyph_size (void)
@@ -387,54 +494,33 @@ Font::get_texture (void)
 // ______________________________________________________________________ Font12
 FontPtr
 Font::Font12 (void) {
-#if defined(HAVE_BOOST)
-    static FontPtr font = FontPtr();
-#else
-    static FontPtr font = 0;
-#endif
-    if (not font)
-        font = FontPtr (new Font(font_12.data, font_12.width, font_12.height));
-    return font;
+    return FontRegistry::get (12);
 }
 
 
 // ______________________________________________________________________ Font16
 FontPtr
 Font::Font16 (void) {
-#if defined(HAVE_BOOST)
-    static FontPtr font = FontPtr();
-#else
-    static FontPtr font = 0;
-#endif
-    if (not font)
-        font = FontPtr (new Font(font_16.data, font_16.width, font_16.height));
-    return font;
+    return FontRegistry::get (16);
 }
 
 
 // ______________________________________________________________________ Font24
 FontPtr
 Font::Font24 (void) {
-#if defined(HAVE_BOOST)
-    static FontPtr font = FontPtr();
-#else
-    static FontPtr font = 0;
-#endif
-    if (not font)
-        font = FontPtr (new Font(font_24.data, font_24.width, font_24.height));
-    return font;
+    return FontRegistry::get (24);
 }
 
 
 // ______________________________________________________________________ Font32
 FontPtr
 Font::Font32 (void) {
-#if defined(HAVE_BOOST)
-    static FontPtr font = FontPtr();
-#else
-    static FontPtr font = 0;
-#endif
-    if (not font)
-        font = FontPtr (new Font(font_32.data, font_32.width, font_32.height));
-    return font;
+    return FontRegistry::get (32);
+}
+
+
+// _____________________________________________________________________ FontSDF
+FontPtr
+Font::FontSDF (void) {
+    return FontRegistry::get_sdf ();
 }
@@ -19,10 +19,6 @@
 #include <string>
 #include "object.h"
 #include "vec4f.h"
-#include "font_12.h"
-#include "font_16.h"
-#include "font_24.h"
-#include "font_32.h"
 
 #if defined(HAVE_BOOST)
 #   include <boost/shared_ptr.hpp>
@@ -40,6 +36,9 @@
  * and caching them in display lists. Displaying a line of text is then
  * straightforward.
  *
+ * Built-in fonts (see FontRegistry) all use the same atlas texture, fonts
+ * built from user data have their own texture. The distance field font
+ * (FontSDF) is meant to be scaled: it stays crisp at any size.
  */
 class Font {
 public:
@@ -56,6 +55,14 @@ public:
           const unsigned int data_width,
           const unsigned int data_height);
 
+    /**
+     * Built-in font using the registry atlas
+     *
+     * @param size font size (12, 16, 24 or 32)
+     * @param sdf  whether to use the distance field atlas (32 only)
+     */
+    Font (unsigned int size, bool sdf = false);
+
     /**
      * Destructor
      */
@@ -69,7 +76,7 @@ public:
      */
 
     /**
-     * Build the texture for the font.
+     * Build the texture (or upload glyphs to the atlas) for the font.
      */
     void setup (void);
 
@@ -83,6 +90,9 @@ public:
     /**
      * Render string with ansi codes
      *
+     * Default foreground color is read from GL current color, which stalls
+     * the pipeline: prefer giving it explicitly.
+     *
      * @param text           ansi string to be rendered
      * @param alpha          alpha transparency level
      * @param justification  -1 left, 0 center, +1 right
@@ -92,6 +102,21 @@ public:
     virtual Size render_ansi_string (const std::string &text,
                                      float alpha = 1,
                                      int justification=-1);
+
+    /**
+     * Render string with ansi codes
+     *
+     * @param text           ansi string to be rendered
+     * @param color          default foreground color (alpha is ignored)
+     * @param alpha          alpha transparency level
+     * @param justification  -1 left, 0 center, +1 right
+     *
+     * @return size of text in terms of columns x lines
+     */
+    virtual Size render_ansi_string (const std::string &text,
+                                     const Color &color,
+                                     float alpha = 1,
+                                     int justification=-1);
     //@}
 
     
@@ -126,6 +151,15 @@ public:
      * @return Bitstream Vera Sans Mono 32 font
      */
     static FontPtr Font32 (void);
+
+    /**
+     * Bitstream Vera Sans Mono as a distance field
+     *
+     * Glyph size is the one of Font32, text can be scaled to any size.
+     *
+     * @return distance field font
+     */
+    static FontPtr FontSDF (void);
     //@}
 
 
@@ -157,6 +191,24 @@ public:
 
 
 
+protected:
+    /**
+     * Setup default ansi colors
+     */
+    void setup_colors (void);
+
+    /**
+     * Bind font texture (and threshold program for distance field font,
+     * unless a program is already in use)
+     */
+    void bind (void);
+
+    /**
+     * Restore state changed by bind
+     */
+    void unbind (void);
+
+
 protected:
     /**
      * Display list base
@@ -169,7 +221,7 @@ protected:
     GLuint texture_;
 
     /**
-     * Font data
+     * Font data (0 for built-in fonts, see FontRegistry::get_bitmap)
      */
     const unsigned char *data_;
 
@@ -190,6 +242,26 @@ protected:
      */
     Size glyph_size_;
 
+    /**
+     * Size in registry atlas (0 if font has its own texture)
+     */
+    unsigned int size_;
+
+    /**
+     * Whether glyphs are a distance field
+     */
+    bool sdf_;
+
+    /**
+     * Program installed before bind (distance field font only)
+     */
+    GLuint program_;
+
+    /**
+     * Whether bind installed the threshold program
+     */
+    bool switched_;
+
 
 public:
     /**
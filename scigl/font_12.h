@@ -1,4 +1,4 @@
-/* This file has been generated by makefont.py */
+/* This file has been generated by makefont.py and rle-font.py */
 
 #ifndef __FONT_12__
 #define __FONT_12__
@@ -6,728 +6,460 @@
 static const struct {
     unsigned int width;
     unsigned int height;
-    unsigned char data[112*168+1];
+    unsigned int length;
+    unsigned char data[9654+1];
 } font_12 = {
-    112, 168,
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\200\251\0\0\0\251\177\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\377\0\0\0\0\0\377\0\377\0\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\0\0\0\122\351\346\116\0\0\0\0\0\116\340\377\377\0\0\0\0\377\0\0\0"
-    "\0\0\0\23\353\32\0\0\0\32\353\22\0\0\0\0\0\377\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\100\300\0\0\0"
-    "\0\0\0\0\0\0\0\377\0\0\0\0\0\377\0\377\0\0\0\0\52\276\0\327\21\0\116"
-    "\344\377\332\131\0\351\72\73\347\0\0\0\0\0\351\113\2\0\0\0\0\0\377"
-    "\0\0\0\0\0\0\161\232\0\0\0\0\0\233\160\0\0\0\237\34\377\34\237\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\300"
-    "\100\0\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\377\0\377\0\0\0\0\166\162\51"
-    "\302\0\0\345\106\377\40\241\0\352\70\72\351\0\0\31\0\0\361\30\0\0"
-    "\0\0\0\0\377\0\0\0\0\0\0\274\105\0\0\0\0\0\106\273\0\0\0\34\250\377"
-    "\250\33\0\0\0\0\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\100\300\0\0\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0\0\0\0\130"
-    "\377\377\377\377\377\377\0\366\13\377\0\0\0\122\352\351\123\133\271"
-    "\137\0\0\241\232\0\0\0\0\0\0\0\0\0\0\0\0\0\352\23\0\0\0\0\0\23\352"
-    "\0\0\0\34\250\377\247\33\0\0\0\0\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\300\100\0\0\0\0\0\0\0\0\0\0\0\360\0\0\0"
-    "\0\0\0\0\0\0\0\0\2\344\4\242\106\0\0\222\261\377\56\0\0\0\10\152\273"
-    "\147\7\0\0\70\345\344\114\0\0\0\0\0\0\0\0\0\0\0\0\373\2\0\0\0\0\0"
-    "\3\372\0\0\0\237\34\377\34\240\0\0\0\0\377\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\100\300\0\0\0\0\0\0\0\0\0\0\0\0\325"
-    "\0\0\0\0\0\0\0\0\0\0\0\61\273\0\332\15\0\0\0\76\377\272\201\0\116"
-    "\272\131\125\351\346\114\0\316\111\75\346\24\370\0\0\0\0\0\0\0\0\0"
-    "\0\352\23\0\0\0\0\0\23\352\0\0\0\0\0\377\0\0\0\377\377\377\377\377"
-    "\377\377\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\300"
-    "\100\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377"
-    "\377\377\130\0\0\0\377\15\364\0\16\0\0\351\72\74\346\0\371\15\0\211"
-    "\256\276\0\0\0\0\0\0\0\0\0\0\274\106\0\0\0\0\0\107\273\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\100\300\0\0\0\0\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0\0\0\0\0\256"
-    "\75\136\213\0\0\0\232\32\377\102\342\0\0\0\0\353\70\72\350\0\275\244"
-    "\36\7\332\101\0\0\0\0\0\0\0\0\0\0\160\233\0\0\0\0\0\234\161\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\377\0\0\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\0\0\0\0\0\300\100\0\0\0\0\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0\0\0"
-    "\0\6\337\3\252\101\0\0\0\142\341\377\341\107\0\0\0\0\127\353\351\117"
-    "\0\32\263\367\313\221\257\0\0\0\0\0\0\0\0\0\0\22\353\33\0\0\0\34\354"
-    "\23\0\0\0\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\73\304\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\377\0\0\0\0\100\300\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\177\252\0\0\0\253\177\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\276\101\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\300"
-    "\100\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\2\216\357\357"
-    "\214\1\0\377\377\377\0\0\0\0\116\305\371\355\242\25\0\105\273\370"
-    "\354\241\25\0\0\0\0\266\377\0\0\377\377\377\377\377\0\0\0\102\304"
-    "\366\345\146\0\377\377\377\377\377\361\0\46\272\365\365\271\44\0\31"
-    "\264\366\355\221\3\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\131\326\372\325\103\0\155\304\31\31\306"
-    "\151\0\0\0\377\0\0\0\0\273\112\14\22\212\275\0\267\105\12\23\203\276"
-    "\0\0\0\125\325\377\0\0\377\0\0\0\0\0\0\72\345\115\11\33\231\0\0\0"
-    "\0\0\217\213\0\317\176\17\17\176\316\0\261\224\17\22\240\164\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\253\55\3\101\346\0\310\77\0\0\102\306\0\0\0\377\0\0\0\0\0\0\0\0"
-    "\11\372\0\0\0\0\0\10\370\0\0\15\343\74\377\0\0\377\0\0\0\0\0\0\263"
-    "\127\0\0\0\0\0\0\0\0\20\355\33\0\367\7\0\0\7\366\0\365\17\0\0\22\313"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\10\137\312\0\0\0\0\0\0\0\0\312"
-    "\137\10\0\0\0\0\0\0\0\0\126\351\0\361\15\0\0\17\360\0\0\0\377\0\0"
-    "\0\0\0\0\0\0\111\325\0\0\0\0\17\177\275\0\0\221\234\0\377\0\0\377"
-    "\353\373\334\174\4\0\354\154\346\366\262\27\0\0\0\0\172\240\0\0\255"
-    "\172\16\16\172\252\0\364\16\0\0\22\362\0\0\0\377\0\0\0\0\0\0\377\0"
-    "\0\0\0\0\42\212\350\260\113\0\0\0\0\0\0\0\0\113\260\350\212\41\0\0"
-    "\0\0\21\221\365\133\0\375\2\0\303\2\374\0\0\0\377\0\0\0\0\0\0\0\51"
-    "\350\110\0\0\0\377\377\347\40\0\62\347\22\0\377\0\0\0\0\3\54\273\221"
-    "\0\375\227\22\16\222\257\0\0\0\7\346\53\0\0\30\333\377\377\333\30"
-    "\0\260\217\16\22\231\374\0\0\0\377\0\0\0\0\0\0\377\0\0\0\0\265\333"
-    "\172\31\0\0\0\377\377\377\377\377\377\0\0\0\31\172\333\265\0\0\0\305"
-    "\213\30\0\0\361\15\0\0\17\360\0\0\0\377\0\0\0\0\0\0\66\347\142\0\0"
-    "\0\0\0\20\202\266\0\312\137\0\0\377\0\0\0\0\0\0\27\360\0\362\21\0"
-    "\0\16\364\0\0\0\145\264\0\0\0\266\176\17\20\200\270\0\31\264\366\346"
-    "\156\353\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\265\333\171\30\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\31\171\333\265\0\0\0\377\0\0\0\0\310\76\0\0\101\306\0"
-    "\0\0\377\0\0\0\0\0\117\352\113\0\0\0\0\0\0\0\10\367\0\377\377\377"
-    "\377\377\377\0\0\0\0\0\23\361\0\314\21\0\0\17\364\0\0\1\330\76\0\0"
-    "\0\367\7\0\0\10\367\0\0\0\0\0\127\262\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\42\213\350\257\112\0\377\377\377\377\377\377\0\112\257\350\213"
-    "\42\0\0\0\0\0\0\0\0\0\155\302\30\30\304\151\0\0\0\377\0\0\0\0\157"
-    "\346\63\0\0\0\0\257\67\6\24\211\310\0\0\0\0\0\377\0\0\253\61\5\36"
-    "\253\233\0\166\235\22\16\222\256\0\0\120\310\0\0\0\0\322\200\20\17"
-    "\177\320\0\227\31\11\115\345\72\0\0\0\377\0\0\0\0\0\0\377\0\0\0\0"
-    "\0\0\0\10\140\313\0\0\0\0\0\0\0\0\313\140\10\0\0\0\0\0\0\377\0\0\0"
-    "\0\2\217\360\360\215\1\0\377\377\377\377\377\0\0\377\377\377\377\377"
-    "\377\20\120\311\371\356\253\35\0\0\0\0\0\377\0\0\140\330\373\346\217"
-    "\11\0\4\223\356\367\263\27\0\0\305\122\0\0\0\0\51\274\366\366\274"
-    "\50\0\147\347\366\304\103\0\0\0\0\377\0\0\0\0\0\73\304\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\276\101\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\306\305\0\0\0\377\377\377\363\266\44\0\0\77\304\367\345\146"
-    "\0\377\377\360\275\102\0\0\377\377\377\377\377\377\0\377\377\377\377"
-    "\377\377\0\0\103\310\367\342\144\0\377\0\0\0\0\377\0\377\377\377\377"
-    "\377\0\0\0\0\377\377\377\0\0\377\0\0\0\147\237\1\377\0\0\0\0\0\0\377"
-    "\153\0\0\154\377\0\377\254\0\0\0\377\0\3\223\360\360\221\2\0\0\72"
-    "\312\370\303\25\0\0\15\363\363\15\0\0\377\0\0\14\155\314\0\65\340"
-    "\104\7\45\241\0\377\0\20\116\341\77\0\377\0\0\0\0\0\0\377\0\0\0\0"
-    "\0\0\67\337\100\6\44\240\0\377\0\0\0\0\377\0\0\0\377\0\0\0\0\0\0\0"
-    "\0\377\0\0\377\0\0\136\256\3\0\377\0\0\0\0\0\0\377\310\0\0\310\377"
-    "\0\377\337\46\0\0\377\0\163\272\26\26\272\157\0\44\350\115\11\233"
-    "\236\0\0\114\275\275\113\0\0\377\0\0\0\7\370\0\257\130\0\0\0\0\0\377"
-    "\0\0\0\121\266\0\377\0\0\0\0\0\0\377\0\0\0\0\0\0\261\126\0\0\0\0\0"
-    "\377\0\0\0\0\377\0\0\0\377\0\0\0\0\0\0\0\0\377\0\0\377\0\125\273\7"
-    "\0\0\377\0\0\0\0\0\0\377\277\51\52\270\377\0\377\160\234\0\0\377\0"
-    "\313\67\0\0\70\311\0\232\170\0\0\42\351\0\0\217\172\173\216\0\0\377"
-    "\0\0\15\171\306\0\353\23\0\0\0\0\0\377\0\0\0\23\354\0\377\0\0\0\0"
-    "\0\0\377\0\0\0\0\0\0\353\23\0\0\0\0\0\377\0\0\0\0\377\0\0\0\377\0"
-    "\0\0\0\0\0\0\0\377\0\0\377\114\333\15\0\0\0\377\0\0\0\0\0\0\377\146"
-    "\210\211\130\377\0\377\13\347\32\0\377\0\362\14\0\0\15\361\0\335\45"
-    "\143\362\262\376\0\0\322\67\70\321\0\0\377\377\377\377\354\55\0\374"
-    "\3\0\0\0\0\0\377\0\0\0\3\373\0\377\377\377\377\377\377\0\377\377\377"
-    "\377\377\377\0\374\2\0\0\377\377\0\377\377\377\377\377\377\0\0\0\377"
-    "\0\0\0\0\0\0\0\0\377\0\0\377\312\345\74\0\0\0\377\0\0\0\0\0\0\377"
-    "\22\337\325\10\377\0\377\0\204\214\0\377\0\375\1\0\0\2\375\0\371\5"
-    "\355\66\67\377\0\26\360\3\3\360\25\0\377\0\0\15\171\274\0\353\23\0"
-    "\0\0\0\0\377\0\0\0\22\354\0\377\0\0\0\0\0\0\377\0\0\0\0\0\0\355\22"
-    "\0\0\0\377\0\377\0\0\0\0\377\0\0\0\377\0\0\0\0\0\0\0\0\377\0\0\377"
-    "\31\121\331\10\0\0\377\0\0\0\0\0\0\377\0\264\230\0\377\0\377\0\26"
-    "\352\21\377\0\363\14\0\0\15\361\0\370\7\355\64\66\377\0\130\377\377"
-    "\377\377\127\0\377\0\0\0\6\367\0\261\130\0\0\0\0\0\377\0\0\0\120\266"
-    "\0\377\0\0\0\0\0\0\377\0\0\0\0\0\0\267\122\0\0\0\377\0\377\0\0\0\0"
-    "\377\0\0\0\377\0\0\0\0\0\0\0\12\366\0\0\377\0\0\251\213\0\0\377\0"
-    "\0\0\0\0\0\377\0\0\0\0\377\0\377\0\0\230\174\377\0\314\67\0\0\67\311"
-    "\0\332\55\143\362\257\377\0\233\156\0\0\156\232\0\377\0\0\12\153\326"
-    "\0\67\341\104\6\41\236\0\377\0\17\114\337\77\0\377\0\0\0\0\0\0\377"
-    "\0\0\0\0\0\0\104\336\72\4\52\377\0\377\0\0\0\0\377\0\0\0\377\0\0\0"
-    "\0\243\47\5\152\306\0\0\377\0\0\25\350\66\0\377\0\0\0\0\0\0\377\0"
-    "\0\0\0\377\0\377\0\0\44\347\377\0\165\270\25\25\270\161\0\222\214"
-    "\0\0\0\0\0\336\52\0\0\52\336\0\377\377\377\365\300\60\0\0\102\306"
-    "\367\345\147\0\377\377\361\275\103\0\0\377\377\377\377\377\377\0\377"
-    "\0\0\0\0\0\0\0\125\325\372\336\156\0\377\0\0\0\0\377\0\377\377\377"
-    "\377\377\0\0\134\333\372\317\63\0\0\377\0\0\0\130\324\6\377\377\377"
-    "\377\377\377\0\377\0\0\0\0\377\0\377\0\0\0\253\377\0\4\225\361\361"
-    "\224\3\0\33\351\153\13\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\54\274\366\327\1\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\361\264\42\0\3\223\360\360"
-    "\221\2\0\377\377\377\356\256\37\0\22\234\352\371\305\115\377\377\377"
-    "\377\377\377\377\0\377\0\0\0\0\377\0\337\51\0\0\51\336\362\16\0\0"
-    "\0\16\365\0\271\145\0\0\150\265\263\171\0\0\0\171\262\0\377\377\377"
-    "\377\377\377\0\0\0\377\0\0\0\0\300\100\0\0\0\0\0\0\0\377\0\0\0\0\17"
-    "\325\325\17\0\0\0\0\0\0\0\0\0\0\377\0\0\27\211\312\0\163\272\26\26"
-    "\272\157\0\377\0\0\25\207\307\0\270\215\31\7\71\257\0\0\0\377\0\0"
-    "\0\0\377\0\0\0\0\377\0\234\153\0\0\154\233\325\42\20\365\20\42\337"
-    "\0\55\332\3\6\334\46\41\354\35\0\36\354\40\0\0\0\0\0\226\236\0\0\0"
-    "\377\0\0\0\0\100\300\0\0\0\0\0\0\0\377\0\0\0\4\271\150\151\270\3\0"
-    "\0\0\0\0\0\0\0\0\377\0\0\0\11\371\0\313\67\0\0\70\311\0\377\0\0\0"
-    "\10\370\0\372\12\0\0\0\0\0\0\0\377\0\0\0\0\377\0\0\0\0\377\0\131\256"
-    "\0\0\257\131\270\67\131\377\131\66\311\0\0\234\135\150\215\0\0\176"
-    "\255\0\256\175\0\0\0\0\0\103\341\17\0\0\0\377\0\0\0\0\0\300\100\0"
-    "\0\0\0\0\0\377\0\0\0\224\165\0\0\165\224\0\0\0\0\0\0\0\0\0\377\0\0"
-    "\27\211\312\0\362\14\0\0\15\361\0\377\0\0\20\174\275\0\307\226\44"
-    "\0\0\0\0\0\0\377\0\0\0\0\377\0\0\0\0\377\0\27\356\2\2\356\27\233\113"
-    "\247\314\250\112\263\0\0\31\313\313\17\0\0\7\333\216\333\7\0\0\0\0"
-    "\15\340\105\0\0\0\0\377\0\0\0\0\0\100\300\0\0\0\0\0\0\377\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\362\266\44\0\375\1\0\0\2"
-    "\375\0\377\375\373\377\307\20\0\30\231\345\356\235\26\0\0\0\377\0"
-    "\0\0\0\377\0\0\0\0\377\0\0\324\64\65\323\0\176\144\357\102\361\144"
-    "\235\0\0\0\315\266\0\0\0\0\110\377\110\0\0\0\0\0\233\230\0\0\0\0\0"
-    "\377\0\0\0\0\0\0\300\100\0\0\0\0\0\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\377\0\0\0\0\0\0\362\14\0\0\15\364\0\377\0\0\47\330\133\0"
-    "\0\0\0\30\215\300\0\0\0\377\0\0\0\0\377\0\0\0\0\377\0\0\221\166\167"
-    "\221\0\141\267\325\0\342\270\210\0\0\105\325\344\62\0\0\0\0\377\0"
-    "\0\0\0\0\107\336\14\0\0\0\0\0\377\0\0\0\0\0\0\100\300\0\0\0\0\0\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\312\67\0\0\67"
-    "\322\0\377\0\0\0\77\333\2\0\0\0\0\12\372\0\0\0\377\0\0\0\0\363\5\0"
-    "\0\5\363\0\0\117\271\272\116\0\104\375\214\0\237\375\162\0\0\303\127"
-    "\152\266\0\0\0\0\377\0\0\0\0\17\341\100\0\0\0\0\0\0\377\0\0\0\0\0"
-    "\0\0\300\100\0\0\0\0\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\0"
-    "\0\0\0\0\0\161\270\25\25\270\205\0\377\0\0\0\0\307\122\264\75\10\24"
-    "\206\312\0\0\0\377\0\0\0\0\272\170\14\14\172\272\0\0\17\362\362\17"
-    "\0\47\377\104\0\134\377\134\0\102\326\2\6\337\72\0\0\0\377\0\0\0\0"
-    "\240\222\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0\100\300\0\0\0\0\377\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\3\223\360\377\322\14"
-    "\0\377\0\0\0\0\122\306\117\307\371\361\263\43\0\0\0\377\0\0\0\0\33"
-    "\262\364\364\262\33\0\0\0\311\311\0\0\12\364\7\0\32\377\106\0\301"
-    "\133\0\0\142\276\0\0\0\377\0\0\0\0\377\377\377\377\377\377\0\0\0\377"
-    "\0\0\0\0\0\0\0\0\300\100\0\0\0\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\125\365\54\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\100\300"
-    "\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\202\123\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\176\252\1\0\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0\0\0\0\0\146\363\377\0\0\0\0\0\0"
-    "\0\0\0\377\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0\377\0\0\0\377\0\0\0\0"
-    "\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\172\216\0\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\377\0\0\0\0\0\0\0\0\0\0\0\346\60\0\0\0\0\0\0\0\0\0\0\377\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0\0\377\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0\0\0"
-    "\0\0\376\0\0\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\377\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\40\272\370\276\40\0\0\377\206\366\310"
-    "\32\0\0\5\216\353\357\161\0\0\32\307\366\206\377\0\0\16\256\367\313"
-    "\36\0\0\377\377\377\377\377\0\0\30\306\366\202\377\0\0\377\146\354"
-    "\352\115\0\0\377\377\377\0\0\0\0\0\377\377\377\0\0\0\377\0\0\170\314"
-    "\15\0\0\0\377\0\0\0\0\377\351\212\304\203\0\0\377\146\354\352\115"
-    "\0\0\33\304\371\304\33\0\0\0\0\0\0\0\0\0\334\103\7\156\275\0\0\377"
-    "\212\11\211\244\0\0\205\266\33\16\210\0\0\245\211\11\214\377\0\0\225"
-    "\230\11\171\252\0\0\0\0\377\0\0\0\0\240\215\11\210\377\0\0\377\206"
-    "\12\142\326\0\0\0\0\377\0\0\0\0\0\0\0\377\0\0\0\377\0\142\327\24\0"
-    "\0\0\0\377\0\0\0\0\377\147\377\147\337\0\0\377\206\12\142\326\0\0"
-    "\247\212\11\215\246\0\0\0\0\0\0\0\0\0\0\0\0\10\366\0\0\377\30\0\30"
-    "\352\0\0\343\44\0\0\0\0\0\353\30\0\31\377\0\0\347\32\0\17\355\0\0"
-    "\0\0\377\0\0\0\0\351\30\0\30\377\0\0\377\21\0\6\374\0\0\0\0\377\0"
-    "\0\0\0\0\0\0\377\0\0\0\377\115\337\36\0\0\0\0\0\377\0\0\0\0\377\12"
-    "\377\12\372\0\0\377\21\0\6\374\0\0\353\30\0\31\353\0\0\0\0\0\0\0\0"
-    "\0\112\326\374\377\377\0\0\377\2\0\3\374\0\0\374\3\0\0\0\0\0\375\2"
-    "\0\3\377\0\0\374\374\375\377\376\0\0\0\0\377\0\0\0\0\375\2\0\3\377"
-    "\0\0\377\0\0\0\377\0\0\0\0\377\0\0\0\0\0\0\0\377\0\0\0\377\356\212"
-    "\0\0\0\0\0\0\377\0\0\0\0\377\0\377\0\377\0\0\377\0\0\0\377\0\0\375"
-    "\2\0\3\374\0\0\0\0\0\0\0\0\0\350\121\6\15\377\0\0\377\27\0\27\351"
-    "\0\0\344\43\0\0\0\0\0\352\27\0\31\377\0\0\344\11\0\0\0\0\0\0\0\377"
-    "\0\0\0\0\351\31\0\30\377\0\0\377\0\0\0\377\0\0\0\0\377\0\0\0\0\0\0"
-    "\0\377\0\0\0\377\41\312\70\0\0\0\0\0\376\3\0\0\0\377\0\377\0\377\0"
-    "\0\377\0\0\0\377\0\0\354\27\0\31\353\0\0\0\0\0\0\0\0\0\360\74\15\212"
-    "\377\0\0\377\210\10\207\241\0\0\207\264\31\15\204\0\0\244\207\10\212"
-    "\377\0\0\222\216\15\36\241\0\0\0\0\377\0\0\0\0\240\216\11\206\377"
-    "\0\0\377\0\0\0\377\0\0\0\0\377\0\0\0\0\0\0\0\377\0\0\0\377\0\42\315"
-    "\16\0\0\0\0\336\77\0\0\0\377\0\377\0\377\0\0\377\0\0\0\377\0\0\250"
-    "\210\10\213\250\0\0\0\0\0\0\0\0\0\143\355\356\155\377\0\0\377\210"
-    "\367\307\31\0\0\6\221\354\360\164\0\0\33\310\367\206\377\0\0\14\243"
-    "\364\342\140\0\0\0\0\377\0\0\0\0\30\307\366\177\376\0\0\377\0\0\0"
-    "\377\0\0\377\377\377\377\377\0\0\0\0\0\377\0\0\0\377\0\0\117\242\0"
-    "\0\0\0\130\362\377\0\0\377\0\377\0\377\0\0\377\0\0\0\377\0\0\35\306"
-    "\372\305\34\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\21\354\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\5\375\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\213\14\166\254\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\125\327\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\167\363\317"
-    "\42\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\352\112\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\160\350\376\0\0\0\0"
-    "\377\0\0\0\0\375\350\160\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\357\65\1\0\0\0\0\377\0\0\0\0\1\71\356\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\0\0"
-    "\0\0\0\0\377\0\0\0\0\0\0\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\206\366\307\31\0\0\33\310\366\204\377\0\0\0\377\164\342\365\164\0"
-    "\107\322\372\340\141\0\0\377\377\377\377\377\0\0\377\0\0\0\377\0\0"
-    "\335\53\0\53\334\0\331\53\0\0\0\6\351\27\263\147\0\147\263\0\0\337"
-    "\51\0\30\354\6\0\377\377\377\377\377\0\0\0\1\376\0\0\0\0\0\0\377\0"
-    "\0\0\0\0\0\376\1\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\212\11\211"
-    "\241\0\0\244\211\11\214\377\0\0\0\377\262\37\21\275\0\352\114\6\42"
-    "\240\0\0\0\0\377\0\0\0\0\377\0\0\0\377\0\0\227\161\0\162\226\0\214"
-    "\172\0\0\0\120\276\0\42\327\12\330\42\0\0\236\153\0\153\237\0\0\0"
-    "\0\0\147\236\0\0\2\116\342\0\0\0\0\0\0\377\0\0\0\0\0\0\342\115\2\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\30\0\30\351\0\0\352\30\0\31\377"
-    "\0\0\0\377\33\0\0\0\0\342\166\53\6\0\0\0\0\0\377\0\0\0\0\377\0\0\0"
-    "\377\0\0\121\270\0\271\120\0\77\311\23\374\20\255\150\0\0\201\276"
-    "\200\0\0\0\134\256\0\300\111\0\0\0\0\74\301\7\0\0\377\377\143\0\0"
-    "\0\0\0\0\377\0\0\0\0\0\0\142\376\377\0\0\203\364\321\116\14\206\0"
-    "\0\0\0\0\0\0\0\377\2\0\3\374\0\0\375\2\0\3\377\0\0\0\377\0\0\0\0\0"
-    "\65\255\343\364\147\0\0\0\0\377\0\0\0\0\377\0\0\0\377\0\0\16\362\21"
-    "\362\16\0\4\355\150\373\135\365\25\0\0\47\377\46\0\0\0\32\356\32\353"
-    "\5\0\0\0\34\316\31\0\0\0\3\146\343\0\0\0\0\0\0\377\0\0\0\0\0\0\343"
-    "\145\3\0\0\205\13\74\277\364\203\0\0\0\0\0\0\0\0\377\27\0\27\352\0"
-    "\0\353\27\0\31\377\0\0\0\377\0\0\0\0\0\0\0\0\106\356\0\0\0\0\377\1"
-    "\0\0\0\374\7\0\25\377\0\0\0\304\215\303\0\0\0\245\347\260\344\273"
-    "\0\0\0\242\243\241\0\0\0\0\331\237\236\0\0\0\10\303\66\0\0\0\0\0\10"
-    "\377\0\0\0\0\0\0\377\0\0\0\0\0\0\377\7\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\377\210\10\207\244\0\0\247\207\10\212\377\0\0\0\377\0\0\0\0"
-    "\0\253\55\6\124\346\0\0\0\0\355\65\0\0\0\327\142\11\207\377\0\0\0"
-    "\176\370\175\0\0\0\130\377\112\377\145\0\0\60\325\4\326\57\0\0\0\227"
-    "\376\115\0\0\0\241\140\0\0\0\0\0\0\0\377\0\0\0\0\0\0\377\0\0\0\0\0"
-    "\0\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\211\367\310\33\0\0"
-    "\34\311\366\203\377\0\0\0\377\0\0\0\0\0\126\327\373\322\103\0\0\0"
-    "\0\171\365\377\0\0\116\352\354\146\377\0\0\0\67\377\67\0\0\0\20\353"
-    "\2\354\23\0\0\272\140\0\141\271\0\0\0\125\366\11\0\0\0\377\377\377"
-    "\377\377\0\0\0\0\357\65\1\0\0\0\0\377\0\0\0\0\1\67\356\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\133\261\0\0\0\0\0\0\0\0\0\0\0\0\0\163\351"
-    "\376\0\0\0\0\377\0\0\0\0\376\351\162\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\377\0\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\7\300\137\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0\0\0\0"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\277\6\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\77\325\0\0\0\0\326\77\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\377\377\0\0\377\377\0\0\0\0\0\0"
-    "\0\0\0\0\377\0\0\0\117\350\350\115\0\0\0\0\0\167\362\225\0\0\0\0\0"
-    "\377\377\0\0\0\0\6\333\215\0\0\0\0\215\332\5\0\0\0\0\0\377\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\100"
-    "\300\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\377\377\0\0\377\377\0\0\142"
-    "\342\4\361\121\62\272\362\377\377\377\0\351\72\73\350\0\0\0\0\0\362"
-    "\377\104\0\0\0\0\0\377\377\0\0\0\0\140\377\121\0\0\0\0\122\377\135"
-    "\0\0\0\257\66\377\67\257\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\300\100\0\0\0\0\0\0\0\0\0\0\377\377\0\0"
-    "\0\377\377\0\0\377\377\0\0\246\236\72\373\17\342\377\63\377\36\232"
-    "\0\352\70\72\350\0\0\0\0\0\265\377\37\0\0\0\0\0\377\377\0\0\0\0\270"
-    "\377\46\0\0\0\0\47\377\265\0\0\0\75\331\377\331\75\0\0\0\0\377\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\100\300\0\0\0"
-    "\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\130\377\377\377\377\377"
-    "\377\343\377\141\377\0\0\0\122\351\351\120\75\223\141\0\0\145\377"
-    "\144\0\0\0\0\0\0\0\0\0\0\0\354\377\13\0\0\0\0\14\377\353\0\0\0\75"
-    "\330\377\330\75\0\0\0\0\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\300\100\0\0\0\0\0\0\0\0\0\0\0\355\355\0\0\0\0\0"
-    "\0\0\0\0\0\63\377\21\307\175\0\60\270\370\377\351\227\21\0\24\162"
-    "\234\140\12\0\0\152\374\322\271\11\375\0\0\0\0\0\0\0\0\0\375\377\2"
-    "\0\0\0\0\3\377\374\0\0\0\257\65\377\65\257\0\0\0\0\377\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\100\300\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\314\317\0\0\0\0\0\0\0\0\0\0\151\333\5\367\107\0\0"
-    "\0\4\377\207\377\267\136\207\51\117\351\350\115\0\347\366\157\373"
-    "\76\360\0\0\0\0\0\0\0\0\0\354\377\13\0\0\0\0\14\377\353\0\0\0\0\0"
-    "\377\0\0\0\377\377\377\377\377\377\377\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\300\100\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\377\377\377\377\377\377\130\171\0\0\377\11\377\371"
-    "\0\0\0\351\72\74\350\0\370\377\54\376\364\307\0\0\0\0\0\0\0\0\0\271"
-    "\377\47\0\0\0\0\50\377\266\0\0\0\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\100\300\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\3\357\116\206\275\0\0\377\226\27"
-    "\377\121\377\303\0\0\0\352\70\72\350\0\275\377\143\322\377\177\0\0"
-    "\0\0\0\0\0\0\0\140\377\122\0\0\0\0\122\377\135\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\377\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0"
-    "\0\300\100\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\71"
-    "\373\16\312\167\0\0\101\256\356\377\360\250\31\0\0\0\122\352\351\117"
-    "\0\46\320\370\307\343\302\0\0\0\0\0\0\0\0\0\5\332\215\0\0\0\0\216"
-    "\331\4\0\0\0\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\6\377\362\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\377\377\0\0\0\100\300\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\77\325\0\0\0\0\326\76\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\134\374\112\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\300\100\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\311"
-    "\155\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\3\221\360\360\221\2\0\377\377\377\377\0\0\0\114\302\370\353\241\24"
-    "\0\115\303\371\355\252\35\0\0\0\35\364\377\0\0\377\377\377\377\377"
-    "\0\0\0\167\343\363\167\0\0\377\377\377\377\377\377\0\42\266\365\365"
-    "\265\40\0\27\264\367\355\223\4\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\131\326\373\331\117\0\157\377"
-    "\153\155\377\157\0\0\0\377\377\0\0\0\262\71\11\144\377\270\0\270\106"
-    "\12\130\377\307\0\0\0\257\377\377\0\0\377\377\0\0\0\0\0\140\377\225"
-    "\13\174\0\0\0\0\0\67\377\346\0\311\377\113\113\377\310\0\255\377\124"
-    "\127\377\170\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\233\31\51\377\356\0\311\377\34\37\377\311\0\0"
-    "\0\377\377\0\0\0\0\0\0\11\377\363\0\0\0\0\10\377\370\0\0\113\357\377"
-    "\377\0\0\377\377\0\0\0\0\0\303\377\35\0\0\0\0\0\0\0\226\377\212\0"
-    "\371\377\6\7\377\370\0\363\377\11\12\377\315\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\17\152\316\0\0\0\0\0\0\0\0\315\151\17\0\0\0\0\0\0\0"
-    "\101\377\310\0\362\377\5\7\377\361\0\0\0\377\377\0\0\0\0\0\0\122\377"
-    "\233\0\0\0\0\123\377\244\0\11\336\155\377\377\0\0\377\377\366\361"
-    "\236\14\0\360\377\302\372\324\56\0\0\0\7\356\377\54\0\237\377\113"
-    "\113\377\234\0\371\377\11\12\377\362\0\0\0\377\377\0\0\0\0\0\377\377"
-    "\0\0\0\0\76\242\366\353\226\0\0\0\0\0\0\0\0\226\354\366\241\75\0\0"
-    "\0\0\66\361\274\23\0\375\377\0\305\377\375\0\0\0\377\377\0\0\0\0\0"
-    "\33\347\344\24\0\0\0\377\377\254\6\0\204\322\3\377\377\0\0\0\0\20"
-    "\237\377\237\0\375\377\124\127\377\303\0\0\0\124\377\315\0\0\3\244"
-    "\377\377\245\3\0\305\377\124\127\377\374\0\0\0\377\377\0\0\0\0\0\377"
-    "\377\0\0\0\331\365\247\114\5\0\0\377\377\377\377\377\377\0\0\5\114"
-    "\250\366\331\0\0\0\332\377\23\0\0\362\377\5\7\377\361\0\0\0\377\377"
-    "\0\0\0\0\12\314\360\57\0\0\0\0\1\133\377\254\0\370\100\0\377\377\0"
-    "\0\0\0\0\22\377\362\0\363\377\11\12\377\370\0\0\0\263\377\156\0\0"
-    "\246\377\115\117\377\244\0\60\325\373\306\377\357\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\334\361\240\107\3\0\0\0\0\0\0\0\0\0\0\4\107\240\361"
-    "\334\0\0\0\377\377\0\0\0\311\377\34\37\377\311\0\0\0\377\377\0\0\0"
-    "\2\257\365\73\0\0\0\0\0\0\11\377\371\0\377\377\377\377\377\377\0\0"
-    "\0\0\23\377\357\0\316\377\11\12\377\362\0\0\26\373\372\25\0\0\372"
-    "\377\6\7\377\371\0\0\0\0\37\377\302\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\1\101\245\367\351\224\0\377\377\377\377\377\377\0\224\352\367\244"
-    "\101\1\0\0\0\0\0\0\0\0\157\377\151\154\377\157\0\0\0\377\377\0\0\0"
-    "\215\371\106\0\0\0\0\244\51\7\146\377\315\0\0\0\0\377\377\0\0\230"
-    "\32\15\225\377\225\0\170\377\124\127\377\253\0\0\161\377\261\0\0\0"
-    "\315\377\114\120\377\314\0\0\170\12\226\377\135\0\0\0\377\377\0\0"
-    "\0\0\0\377\377\0\0\0\0\0\0\20\153\316\0\0\0\0\0\0\0\0\316\153\20\0"
-    "\0\0\0\0\0\377\377\0\0\0\3\221\360\360\221\3\0\377\377\377\377\377"
-    "\377\0\377\377\377\377\377\377\4\124\315\372\360\263\44\0\0\0\0\377"
-    "\377\0\0\125\321\373\343\207\6\0\5\224\355\367\262\26\0\0\320\377"
-    "\123\0\0\0\47\275\366\366\275\47\0\0\167\364\343\165\0\0\0\0\377\377"
-    "\0\0\0\0\6\377\362\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\134\374\112\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\311\155\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\15\374\374\14\0\0\377\377"
-    "\377\366\301\56\0\0\101\302\365\352\156\0\377\377\370\323\143\0\0"
-    "\377\377\377\377\377\377\0\377\377\377\377\377\377\0\0\106\310\367"
-    "\342\145\0\377\377\0\0\377\377\0\377\377\377\377\377\377\0\0\0\377"
-    "\377\377\377\0\377\377\0\0\251\376\115\377\377\0\0\0\0\0\377\176\0"
-    "\0\177\377\0\377\377\141\0\377\377\0\2\216\357\357\214\1\0\34\245"
-    "\356\370\300\52\0\0\105\377\377\104\0\0\377\377\0\103\377\323\0\72"
-    "\373\317\41\23\223\0\377\377\7\235\377\131\0\377\377\0\0\0\0\0\377"
-    "\377\0\0\0\0\0\74\374\307\34\21\211\0\377\377\0\0\377\377\0\0\0\377"
-    "\377\0\0\0\0\0\0\0\377\377\0\377\377\0\155\377\202\0\377\377\0\0\0"
-    "\0\0\377\360\22\22\361\377\0\377\377\254\0\377\377\0\155\377\152\154"
-    "\377\151\21\340\211\27\13\155\321\0\0\200\366\361\177\0\0\377\377"
-    "\0\5\377\372\0\263\377\107\0\0\0\0\377\377\0\53\377\302\0\377\377"
-    "\0\0\0\0\0\377\377\0\0\0\0\0\264\377\101\0\0\0\0\377\377\0\0\377\377"
-    "\0\0\0\377\377\0\0\0\0\0\0\0\377\377\0\377\377\67\371\267\2\0\377"
-    "\377\0\0\0\0\0\377\377\210\211\377\377\0\377\377\357\5\377\377\0\310"
-    "\377\34\36\377\306\210\237\34\301\372\311\376\0\0\273\311\305\272"
-    "\0\0\377\377\0\76\377\270\0\354\377\17\0\0\0\0\377\377\0\12\377\360"
-    "\0\377\377\0\0\0\0\0\377\377\0\0\0\0\0\354\377\16\0\0\0\0\377\377"
-    "\0\0\377\377\0\0\0\377\377\0\0\0\0\0\0\0\377\377\0\377\377\341\374"
-    "\27\0\0\377\377\0\0\0\0\0\377\377\365\365\377\377\0\377\377\311\103"
-    "\377\377\0\361\377\5\7\377\360\327\62\262\200\10\203\377\0\3\363\232"
-    "\230\362\3\0\377\377\377\377\307\23\0\374\377\2\0\0\0\0\377\377\0"
-    "\2\377\374\0\377\377\377\377\377\0\0\377\377\377\377\377\0\0\374\377"
-    "\1\0\0\0\0\377\377\377\377\377\377\0\0\0\377\377\0\0\0\0\0\0\0\377"
-    "\377\0\377\377\376\377\147\0\0\377\377\0\0\0\0\0\377\377\343\343\377"
-    "\377\0\377\377\201\216\377\377\0\375\377\0\1\377\374\370\7\364\20"
-    "\0\20\377\0\61\377\153\153\377\60\0\377\377\0\103\377\264\0\354\377"
-    "\17\0\0\0\0\377\377\0\12\377\357\0\377\377\0\0\0\0\0\377\377\0\0\0"
-    "\0\0\355\377\12\377\377\377\0\377\377\0\0\377\377\0\0\0\377\377\0"
-    "\0\0\0\0\0\0\377\377\0\377\377\126\346\344\10\0\377\377\0\0\0\0\0"
-    "\377\377\0\0\377\377\0\377\377\71\332\377\377\0\361\377\5\7\377\360"
-    "\367\11\364\20\0\20\377\0\154\377\377\377\377\153\0\377\377\0\5\377"
-    "\371\0\263\377\106\0\0\0\0\377\377\0\54\377\302\0\377\377\0\0\0\0"
-    "\0\377\377\0\0\0\0\0\267\377\60\0\377\377\0\377\377\0\0\377\377\0"
-    "\0\0\377\377\0\0\0\0\0\0\3\377\375\0\377\377\0\155\377\164\0\377\377"
-    "\0\0\0\0\0\377\377\0\0\377\377\0\377\377\3\355\377\377\0\310\377\34"
-    "\36\377\306\320\72\261\200\7\202\377\0\247\370\4\4\370\246\0\377\377"
-    "\0\74\377\336\0\72\373\315\40\22\221\0\377\377\7\234\377\133\0\377"
-    "\377\0\0\0\0\0\377\377\0\0\0\0\0\104\376\235\14\377\377\0\377\377"
-    "\0\0\377\377\0\0\0\377\377\0\0\0\246\53\6\132\377\326\0\377\377\0"
-    "\7\343\354\15\377\377\0\0\0\0\0\377\377\0\0\377\377\0\377\377\0\251"
-    "\377\377\0\155\377\151\154\377\151\170\260\34\302\373\315\377\0\342"
-    "\317\0\0\317\342\0\377\377\377\371\315\77\0\0\102\303\366\352\155"
-    "\0\377\377\371\324\146\0\0\377\377\377\377\377\377\0\377\377\0\0\0"
-    "\0\0\0\125\325\373\353\247\0\377\377\0\0\377\377\0\377\377\377\377"
-    "\377\377\0\116\304\371\364\303\65\0\377\377\0\0\151\377\200\377\377"
-    "\377\377\377\377\0\377\377\0\0\377\377\0\377\377\0\140\377\377\0\2"
-    "\217\360\360\215\1\10\310\246\50\6\102\211\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\13\205\335"
-    "\373\354\227\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\154\0\0\0\0\0\0\0"
-    "\0\0\124\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\376"
-    "\360\272\55\0\2\216\357\357\211\1\0\377\377\377\363\277\60\0\27\246"
-    "\356\370\306\120\0\377\377\377\377\377\377\0\377\377\0\0\377\377\0"
-    "\345\323\0\0\323\344\361\217\0\0\0\220\362\0\300\362\16\17\362\300"
-    "\272\373\46\0\0\46\373\271\377\377\377\377\377\377\0\0\377\377\0\0"
-    "\0\0\304\217\0\0\0\0\0\0\0\377\377\0\0\0\4\264\377\263\4\0\0\0\0\0"
-    "\0\0\0\0\377\377\2\116\377\321\0\155\377\152\154\377\144\0\377\377"
-    "\1\112\377\323\0\275\377\130\11\64\255\0\0\0\377\377\0\0\0\377\377"
-    "\0\0\377\377\0\257\372\6\6\373\256\324\246\0\0\0\241\326\0\100\377"
-    "\163\164\377\100\57\375\256\0\0\257\375\56\0\0\0\32\357\360\0\0\377"
-    "\377\0\0\0\0\115\364\22\0\0\0\0\0\0\377\377\0\0\1\241\370\224\370"
-    "\240\1\0\0\0\0\0\0\0\0\377\377\0\5\377\372\0\310\377\34\36\377\303"
-    "\0\377\377\0\6\377\372\0\372\357\0\0\0\0\0\0\0\377\377\0\0\0\377\377"
-    "\0\0\377\377\0\171\377\57\60\377\170\266\275\106\377\110\261\272\0"
-    "\0\300\342\342\301\0\0\240\377\73\74\377\237\0\0\0\0\265\377\134\0"
-    "\0\377\377\0\0\0\0\1\324\176\0\0\0\0\0\0\377\377\0\0\213\347\70\0"
-    "\71\347\213\0\0\0\0\0\0\0\0\377\377\2\117\377\322\0\361\377\5\7\377"
-    "\356\0\377\377\1\115\377\275\0\323\377\254\61\0\0\0\0\0\377\377\0"
-    "\0\0\377\377\0\0\377\377\0\103\377\135\136\377\102\230\324\163\377"
-    "\170\302\237\0\0\100\377\377\102\0\0\34\366\307\310\366\34\0\0\0\140"
-    "\377\252\0\0\0\377\377\0\0\0\0\0\136\353\12\0\0\0\0\0\377\377\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\361\275\57\0\375\377\0"
-    "\1\377\374\0\377\377\377\377\260\13\0\52\306\377\377\256\23\0\0\0"
-    "\377\377\0\0\0\377\377\0\0\377\377\0\16\375\214\215\375\15\172\353"
-    "\237\322\250\322\203\0\0\0\347\352\1\0\0\0\206\377\377\205\0\0\0\33"
-    "\357\346\22\0\0\0\377\377\0\0\0\0\0\4\341\156\0\0\0\0\0\377\377\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\361\377\5\7\377"
-    "\362\0\377\377\11\271\373\57\0\0\0\67\304\377\270\0\0\0\377\377\0"
-    "\0\0\377\377\0\0\377\377\0\0\326\272\273\325\0\135\376\317\162\331"
-    "\343\150\0\0\115\377\377\117\0\0\0\16\377\377\16\0\0\0\266\377\110"
-    "\0\0\0\0\377\377\0\0\0\0\0\0\156\340\4\0\0\0\0\377\377\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\310\377\34\36\377\311\0\377"
-    "\377\0\50\375\263\0\0\0\0\23\377\370\0\0\0\377\377\0\0\0\367\377\3"
-    "\3\377\366\0\0\240\350\351\237\0\77\377\374\26\371\370\114\0\0\311"
-    "\334\335\312\0\0\0\0\377\377\0\0\0\142\377\226\0\0\0\0\0\377\377\0"
-    "\0\0\0\0\0\12\354\135\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\377\377\0\0\0\0\0\155\377\151\154\377\155\0\377\377\0\0\250"
-    "\377\70\260\67\6\117\377\305\0\0\0\377\377\0\0\0\300\377\113\113\377"
-    "\276\0\0\152\377\377\151\0\41\377\335\0\323\377\61\0\106\377\161\162"
-    "\377\106\0\0\0\377\377\0\0\0\360\332\12\0\0\0\0\0\377\377\0\0\0\0"
-    "\0\0\0\177\323\1\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\0\0\0\0\0\2\221\361\377\300\3\0\377\377\0\0\52\375\275\122\311"
-    "\371\361\263\42\0\0\0\377\377\0\0\0\47\300\367\367\277\45\0\0\63\377"
-    "\377\63\0\5\375\257\0\241\377\25\0\302\363\17\17\363\302\0\0\0\377"
-    "\377\0\0\0\377\377\377\377\377\377\0\0\377\377\0\0\0\0\0\0\0\23\364"
-    "\114\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\114\330\60\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\377\377\377\154\0\0\0\0\0\0\220\304\0\124\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\377\377\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\203"
-    "\325\12\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\377\377\0\0\0\0\0\0\0\0\0\0\142\344\375\377\0\0\0\0\0\0\0\0\377"
-    "\377\0\0\0\0\0\0\0\377\377\0\0\0\0\0\377\377\0\0\0\377\377\0\0\0\0"
-    "\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\211\240\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\353\377\34\0\0\0\0\0\0\0\0\0\377"
-    "\377\0\0\0\0\0\0\0\377\377\0\0\0\0\0\377\377\0\0\0\377\377\0\0\0\0"
-    "\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\377\377\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\152\350"
-    "\366\277\43\0\377\377\244\370\313\36\0\0\153\327\371\334\137\0\40"
-    "\314\370\244\377\377\0\6\225\357\362\241\13\0\377\377\377\377\377"
-    "\377\0\27\304\371\262\377\377\0\377\377\240\365\353\136\0\377\377"
-    "\377\377\0\0\0\377\377\377\377\0\0\0\377\377\0\174\377\155\0\0\377"
-    "\377\0\0\0\0\377\304\367\260\365\225\0\377\377\241\365\352\133\0\6"
-    "\226\360\360\226\6\0\0\0\0\0\0\0\0\0\232\30\46\377\265\0\377\377\146"
-    "\146\377\250\0\161\377\257\24\26\222\0\253\377\145\150\377\377\0\207"
-    "\377\140\124\377\223\0\0\0\377\377\0\0\0\236\377\150\153\377\377\0"
-    "\377\377\132\72\377\351\0\0\0\377\377\0\0\0\0\0\377\377\0\0\0\377"
-    "\377\115\376\211\0\0\0\377\377\0\0\0\0\377\377\15\377\15\353\0\377"
-    "\377\132\72\377\350\0\207\377\145\146\377\207\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\377\356\0\377\377\22\22\377\353\0\337\377\42\0\0\0\0\354\377"
-    "\22\23\377\377\0\343\377\17\11\377\347\0\0\0\377\377\0\0\0\350\377"
-    "\25\27\377\377\0\377\377\7\2\377\377\0\0\0\377\377\0\0\0\0\0\377\377"
-    "\0\0\0\377\377\361\277\1\0\0\0\377\377\0\0\0\0\377\377\0\377\0\375"
-    "\0\377\377\7\2\377\377\0\343\377\22\22\377\343\0\0\0\0\0\0\0\0\113"
-    "\321\370\377\377\376\0\377\377\1\2\377\374\0\373\377\3\0\0\0\0\375"
-    "\377\1\2\377\377\0\374\377\377\377\377\376\0\0\0\377\377\0\0\0\374"
-    "\377\4\4\377\377\0\377\377\0\0\377\377\0\0\0\377\377\0\0\0\0\0\377"
-    "\377\0\0\0\377\377\364\362\27\0\0\0\377\377\0\0\0\0\377\377\0\377"
-    "\0\377\0\377\377\0\0\377\377\0\374\377\1\2\377\373\0\0\0\0\0\0\0\0"
-    "\353\377\75\14\377\377\0\377\377\22\22\377\353\0\337\377\41\0\0\0"
-    "\0\355\377\22\23\377\377\0\345\377\15\0\0\0\0\0\0\377\377\0\0\0\354"
-    "\377\25\27\377\377\0\377\377\0\0\377\377\0\0\0\377\377\0\0\0\0\0\377"
-    "\377\0\0\0\377\377\53\373\231\0\0\0\374\377\2\0\0\0\377\377\0\377"
-    "\0\377\0\377\377\0\0\377\377\0\344\377\22\22\377\343\0\0\0\0\0\0\0"
-    "\0\355\377\50\144\377\377\0\377\377\144\144\377\252\0\163\377\255"
-    "\23\25\220\0\255\377\143\147\377\377\0\210\377\204\10\42\242\0\0\0"
-    "\377\377\0\0\0\245\377\146\151\377\377\0\377\377\0\0\377\377\0\0\0"
-    "\377\377\0\0\0\0\0\377\377\0\0\0\377\377\0\237\374\53\0\0\327\377"
-    "\72\0\0\0\377\377\0\377\0\377\0\377\377\0\0\377\377\0\211\377\143"
-    "\144\377\211\0\0\0\0\0\0\0\0\132\346\367\244\377\377\0\377\377\246"
-    "\370\317\41\0\1\156\331\372\337\143\0\43\320\370\245\377\377\0\6\212"
-    "\346\372\321\127\0\0\0\377\377\0\0\0\32\310\371\263\377\377\0\377"
-    "\377\0\0\377\377\0\377\377\377\377\377\377\0\0\0\377\377\0\0\0\377"
-    "\377\0\45\374\270\0\0\107\335\376\377\0\0\377\377\0\377\0\377\0\377"
-    "\377\0\0\377\377\0\7\230\361\361\230\7\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\13\377\361\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\4\377\373"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\207\15\145\377\265\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\121\377\322\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\147\346\367\276\42\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\377\375\326\77\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\153\340\373\377\0\0\0\377\0\0\0\0\377\373\340\150"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\360"
-    "\377\63\0\0\0\0\377\0\0\0\0\0\66\377\357\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\377\0\0\0"
-    "\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\244\367\316"
-    "\37\0\41\317\367\243\377\377\0\0\377\377\246\367\377\0\64\274\362"
-    "\371\307\121\377\377\377\377\377\377\0\0\377\377\0\0\377\377\0\334"
-    "\331\0\0\332\333\353\267\0\0\0\267\352\0\267\377\76\100\377\267\0"
-    "\332\353\0\1\352\327\0\377\377\377\377\377\377\0\0\3\377\377\0\0\0"
-    "\0\0\377\0\0\0\0\0\0\377\377\2\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\146\146\377\251\0\254\377\145\150\377\377\0\0\377\377\222\13"
-    "\147\0\343\377\72\6\57\250\0\0\377\377\0\0\0\0\377\377\0\0\377\377"
-    "\0\223\377\25\26\377\222\301\315\0\0\0\316\300\0\52\373\262\271\374"
-    "\52\0\216\377\42\54\377\207\0\0\0\0\42\341\343\0\2\124\377\336\0\0"
-    "\0\0\0\377\0\0\0\0\0\0\336\377\125\2\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\377\377\22\22\377\353\0\354\377\22\23\377\377\0\0\377\377\24\0\0"
-    "\0\353\377\231\71\3\0\0\0\377\377\0\0\0\0\377\377\0\0\377\377\0\113"
-    "\377\120\121\377\112\227\344\120\377\120\345\226\0\0\224\376\377\225"
-    "\0\0\102\377\131\153\377\66\0\0\0\42\342\340\42\0\377\377\352\103"
-    "\0\0\0\0\0\377\0\0\0\0\0\0\102\351\377\377\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\377\377\1\2\377\374\0\375\377\1\2\377\377\0\0\377\377\1\0\0"
-    "\0\107\323\377\377\351\120\0\0\377\377\0\0\0\0\377\377\0\0\377\377"
-    "\0\12\370\214\215\367\11\154\372\210\361\211\373\153\0\0\75\377\377"
-    "\100\0\0\5\360\220\253\344\1\0\0\43\342\336\37\0\0\4\151\377\334\0"
-    "\0\0\0\0\377\0\0\0\0\0\0\335\377\151\4\0\202\364\321\116\14\207\0"
-    "\0\0\0\0\0\0\0\377\377\22\22\377\353\0\354\377\22\23\377\377\0\0\377"
-    "\377\0\0\0\0\0\0\25\163\377\353\0\0\377\377\0\0\0\0\377\377\2\6\377"
-    "\377\0\0\272\307\310\271\0\102\377\320\217\323\377\101\0\0\263\366"
-    "\371\264\0\0\0\252\310\352\225\0\0\43\343\334\35\0\0\0\0\11\377\377"
-    "\0\0\0\0\0\377\0\0\0\0\0\0\377\377\11\0\0\201\12\71\277\364\203\0"
-    "\0\0\0\0\0\0\0\377\377\144\144\377\250\0\253\377\143\147\377\377\0"
-    "\0\377\377\0\0\0\0\255\64\6\66\377\346\0\0\356\377\44\0\0\0\351\377"
-    "\72\130\377\377\0\0\161\372\372\160\0\30\377\376\41\376\377\27\0\70"
-    "\377\237\245\377\71\0\0\136\376\377\105\0\0\343\332\33\0\0\0\0\0\0"
-    "\377\377\0\0\0\0\0\377\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\377\377\244\370\314\36\0\40\314\370\244\377\377\0\0\377"
-    "\377\0\0\0\0\112\275\366\367\313\102\0\0\151\344\375\377\0\0\136\353"
-    "\366\244\377\377\0\0\50\377\377\50\0\0\355\327\0\330\355\0\0\275\377"
-    "\67\72\377\275\0\0\24\375\357\5\0\0\377\377\377\377\377\377\0\0\0"
-    "\361\377\61\0\0\0\0\377\0\0\0\0\0\64\377\360\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\14\365\244\0\0\0\0\0\0\0\0\0\0\0\0\155\342\374\377"
-    "\0\0\0\377\0\0\0\0\377\374\342\153\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\377\377\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\2\177\377\113\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0"
-    "\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\371\227\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0"
+    112, 168, 9654,
+    "\377\0\251\0\1\200\251\201\0\1\251\177\265\0\0\377\203\0\2\377\0"
+    "\377\212\0\0\377\201\0\3R\351\346N\203\0\1N\340\200\377\202\0\0"
+    "\377\204\0\2\23\353\32\201\0\2\32\353\22\203\0\0\377\242\0\1@\300"
+    "\210\0\0\377\203\0\2\377\0\377\202\0\17*\276\0\327\21\0N\344\377"
+    "\332Y\0\351:;\347\203\0\2\351K\2\203\0\0\377\204\0\1q\232\203\0\1"
+    "\233p\201\0\4\237\34\377\34\237\240\0\1\300@\210\0\0\377\203\0\2"
+    "\377\0\377\202\0\3vr)\302\200\0\11\345F\377 \241\0\352\70:\351\200"
+    "\0\0\31\200\0\1\361\30\204\0\0\377\204\0\1\274E\203\0\1F\273\201\0"
+    "\4\34\250\377\250\33\202\0\0\377\232\0\1@\300\211\0\0\377\210\0\0X"
+    "\204\377\3\0\366\13\377\201\0\6R\352\351S[\271_\200\0\1\241\232"
+    "\213\0\1\352\23\203\0\1\23\352\201\0\4\34\250\377\247\33\202\0\0"
+    "\377\232\0\1\300@\211\0\0\360\211\0\4\2\344\4\242F\200\0\3\222\261"
+    "\377.\201\0\4\10j\273g\7\200\0\3\70\345\344L\212\0\1\373\2\203\0\1"
+    "\3\372\201\0\4\237\34\377\34\240\202\0\0\377\231\0\1@\300\212\0\0"
+    "\325\211\0\4\61\273\0\332\15\201\0\22>\377\272\201\0N\272YU\351"
+    "\346L\0\316I=\346\24\370\210\0\1\352\23\203\0\1\23\352\203\0\0\377"
+    "\201\0\205\377\207\0\201\377\212\0\1\300@\225\0\204\377\0X\201\0\4"
+    "\377\15\364\0\16\200\0\12\351:<\346\0\371\15\0\211\256\276\210\0\1"
+    "\274F\203\0\1G\273\212\0\0\377\230\0\1@\300\213\0\0\377\211\0\3"
+    "\256=^\213\201\0\4\232\32\377B\342\202\0\12\353\70:\350\0\275\244"
+    "\36\7\332A\210\0\1p\233\203\0\1\234q\212\0\0\377\204\0\0\377\213\0"
+    "\0\377\203\0\1\300@\213\0\0\377\210\0\4\6\337\3\252A\201\0\4b\341"
+    "\377\341G\202\0\12W\353\351O\0\32\263\367\313\221\257\210\0\2\22"
+    "\353\33\201\0\2\34\354\23\212\0\0\377\203\0\1;\304\213\0\0\377\202"
+    "\0\1@\300\241\0\0\377\232\0\1\177\252\201\0\1\253\177\221\0\1\276A"
+    "\220\0\1\300@\241\0\0\377\377\0\377\0\377\0\234\0\1\2\216\200\357"
+    "\2\214\1\0\201\377\202\0\14N\305\371\355\242\25\0E\273\370\354\241"
+    "\25\202\0\1\266\377\200\0\203\377\201\0\5B\304\366\345f\0\203\377"
+    "\3\361\0&\272\200\365\10\271$\0\31\264\366\355\221\3\243\0\7Y\326"
+    "\372\325C\0m\304\200\31\1\306i\201\0\0\377\202\0\14\273J\14\22\212"
+    "\275\0\267E\12\23\203\276\201\0\2U\325\377\200\0\0\377\204\0\5:"
+    "\345M\11\33\231\203\0\4\217\213\0\317~\200\17\10~\316\0\261\224\17"
+    "\22\240t\243\0\7\253-\3A\346\0\310\77\200\0\1B\306\201\0\0\377\206"
+    "\0\1\11\372\203\0\1\10\370\200\0\3\15\343<\377\200\0\0\377\204\0\1"
+    "\263W\206\0\5\20\355\33\0\367\7\200\0\4\7\366\0\365\17\200\0\1\22"
+    "\313\220\0\2\10_\312\206\0\2\312_\10\206\0\4V\351\0\361\15\200\0\1"
+    "\17\360\201\0\0\377\206\0\1I\325\202\0\2\17\177\275\200\0\3\221"
+    "\234\0\377\200\0\14\377\353\373\334|\4\0\354l\346\366\262\27\202\0"
+    "\1z\240\200\0\1\255z\200\16\4z\252\0\364\16\200\0\1\22\362\201\0\0"
+    "\377\204\0\0\377\203\0\4\42\212\350\260K\206\0\4K\260\350\212!\202"
+    "\0\12\21\221\365[\0\375\2\0\303\2\374\201\0\0\377\205\0\2)\350H"
+    "\201\0\200\377\7\347 \0\62\347\22\0\377\202\0\12\3,\273\221\0\375"
+    "\227\22\16\222\257\201\0\2\7\346+\200\0\1\30\333\200\377\10\333\30"
+    "\0\260\217\16\22\231\374\201\0\0\377\204\0\0\377\202\0\3\265\333z"
+    "\31\201\0\204\377\201\0\3\31z\333\265\201\0\2\305\213\30\200\0\1"
+    "\361\15\200\0\1\17\360\201\0\0\377\204\0\2\66\347b\203\0\5\20\202"
+    "\266\0\312_\200\0\0\377\204\0\4\27\360\0\362\21\200\0\1\16\364\201"
+    "\0\1e\264\201\0\14\266~\17\20\200\270\0\31\264\366\346n\353\215\0"
+    "\3\265\333y\30\212\0\3\31y\333\265\201\0\0\377\202\0\1\310>\200\0"
+    "\1A\306\201\0\0\377\203\0\2O\352K\205\0\2\10\367\0\204\377\203\0\4"
+    "\23\361\0\314\21\200\0\1\17\364\200\0\2\1\330>\201\0\1\367\7\200\0"
+    "\1\10\367\203\0\1W\262\216\0\5\42\213\350\257J\0\204\377\5\0J\257"
+    "\350\213\42\207\0\1m\302\200\30\1\304i\201\0\0\377\202\0\2o\346\63"
+    "\202\0\5\257\67\6\24\211\310\203\0\0\377\200\0\14\253\61\5\36\253"
+    "\233\0v\235\22\16\222\256\200\0\1P\310\202\0\14\322\200\20\17\177"
+    "\320\0\227\31\11M\345:\201\0\0\377\204\0\0\377\205\0\2\10`\313\206"
+    "\0\2\313`\10\204\0\0\377\202\0\1\2\217\200\360\2\215\1\0\203\377"
+    "\200\0\204\377\6\20P\311\371\356\253\35\203\0\0\377\200\0\14`\330"
+    "\373\346\217\11\0\4\223\356\367\263\27\200\0\1\305R\202\0\1)\274"
+    "\200\366\7\274(\0g\347\366\304C\202\0\0\377\203\0\1;\304\231\0\0"
+    "\377\320\0\1\276A\377\0\377\0\377\0\344\0\1\306\305\201\0\201\377"
+    "\2\363\266$\200\0\5\77\304\367\345f\0\200\377\2\360\275B\200\0\204"
+    "\377\0\0\204\377\200\0\6C\310\367\342d\0\377\202\0\1\377\0\203\377"
+    "\202\0\201\377\200\0\0\377\201\0\3g\237\1\377\204\0\1\377k\200\0\4"
+    "l\377\0\377\254\201\0\3\377\0\3\223\200\360\1\221\2\200\0\4:\312"
+    "\370\303\25\200\0\0\15\200\363\0\15\200\0\0\377\200\0\22\14m\314\0"
+    "\65\340D\7%\241\0\377\0\20N\341\77\0\377\204\0\0\377\204\0\7\67"
+    "\337@\6$\240\0\377\202\0\0\377\201\0\0\377\206\0\0\377\200\0\0\377"
+    "\200\0\4^\256\3\0\377\204\0\1\377\310\200\0\5\310\377\0\377\337&"
+    "\200\0\3\377\0s\272\200\26\10\272o\0$\350M\11\233\236\200\0\0L\200"
+    "\275\0K\200\0\0\377\201\0\4\7\370\0\257X\203\0\0\377\201\0\3Q\266"
+    "\0\377\204\0\0\377\204\0\1\261V\203\0\0\377\202\0\0\377\201\0\0"
+    "\377\206\0\0\377\200\0\4\377\0U\273\7\200\0\0\377\204\0\11\377\277"
+    ")*\270\377\0\377p\234\200\0\3\377\0\313\67\200\0\4\70\311\0\232x"
+    "\200\0\1\42\351\200\0\3\217z{\216\200\0\0\377\200\0\5\15y\306\0"
+    "\353\23\203\0\0\377\201\0\3\23\354\0\377\204\0\0\377\204\0\1\353"
+    "\23\203\0\0\377\202\0\0\377\201\0\0\377\206\0\0\377\200\0\3\377L"
+    "\333\15\201\0\0\377\204\0\17\377f\210\211X\377\0\377\13\347\32\0"
+    "\377\0\362\14\200\0\10\15\361\0\335%c\362\262\376\200\0\3\322\67"
+    "\70\321\200\0\202\377\4\354-\0\374\3\203\0\0\377\201\0\2\3\373\0"
+    "\204\377\0\0\204\377\2\0\374\2\200\0\200\377\0\0\204\377\201\0\0"
+    "\377\206\0\0\377\200\0\3\377\312\345<\201\0\0\377\204\0\17\377\22"
+    "\337\325\10\377\0\377\0\204\214\0\377\0\375\1\200\0\13\2\375\0\371"
+    "\5\355\66\67\377\0\26\360\200\3\3\360\25\0\377\200\0\5\15y\274\0"
+    "\353\23\203\0\0\377\201\0\3\22\354\0\377\204\0\0\377\204\0\1\355"
+    "\22\201\0\2\377\0\377\202\0\0\377\201\0\0\377\206\0\0\377\200\0\4"
+    "\377\31Q\331\10\200\0\0\377\204\0\17\377\0\264\230\0\377\0\377\0"
+    "\26\352\21\377\0\363\14\200\0\12\15\361\0\370\7\355\64\66\377\0X"
+    "\202\377\2W\0\377\201\0\4\6\367\0\261X\203\0\0\377\201\0\3P\266\0"
+    "\377\204\0\0\377\204\0\1\267R\201\0\2\377\0\377\202\0\0\377\201\0"
+    "\0\377\205\0\1\12\366\200\0\0\377\200\0\1\251\213\200\0\0\377\204"
+    "\0\0\377\202\0\2\377\0\377\200\0\5\230|\377\0\314\67\200\0\13\67"
+    "\311\0\332-c\362\257\377\0\233n\200\0\3n\232\0\377\200\0\22\12k"
+    "\326\0\67\341D\6!\236\0\377\0\17L\337\77\0\377\204\0\0\377\204\0\7"
+    "D\336:\4*\377\0\377\202\0\0\377\201\0\0\377\202\0\4\243'\5j\306"
+    "\200\0\0\377\200\0\4\25\350\66\0\377\204\0\0\377\202\0\2\377\0\377"
+    "\200\0\5$\347\377\0u\270\200\25\4\270q\0\222\214\203\0\1\336*\200"
+    "\0\2*\336\0\201\377\2\365\300\60\200\0\5B\306\367\345g\0\200\377\2"
+    "\361\275C\200\0\204\377\1\0\377\205\0\6U\325\372\336n\0\377\202\0"
+    "\1\377\0\203\377\200\0\4\134\333\372\317\63\200\0\0\377\201\0\2X"
+    "\324\6\204\377\1\0\377\202\0\2\377\0\377\201\0\4\253\377\0\4\225"
+    "\200\361\6\224\3\0\33\351k\13\353\0\4,\274\366\327\1\377\0\377\0"
+    "\377\0\224\0\200\377\211\0\200\377\220\0\201\377\5\361\264\42\0\3"
+    "\223\200\360\2\221\2\0\201\377\11\356\256\37\0\22\234\352\371\305M"
+    "\205\377\1\0\377\202\0\3\377\0\337)\200\0\3)\336\362\16\201\0\4\16"
+    "\365\0\271e\200\0\3h\265\263y\201\0\2y\262\0\204\377\201\0\0\377"
+    "\202\0\1\300@\205\0\0\377\202\0\0\17\200\325\0\17\210\0\0\377\200"
+    "\0\5\27\211\312\0s\272\200\26\3\272o\0\377\200\0\11\25\207\307\0"
+    "\270\215\31\7\71\257\201\0\0\377\202\0\0\377\202\0\3\377\0\234k"
+    "\200\0\26l\233\325\42\20\365\20\42\337\0-\332\3\6\334&!\354\35\0"
+    "\36\354 \203\0\1\226\236\201\0\0\377\202\0\1@\300\205\0\0\377\201"
+    "\0\5\4\271hi\270\3\207\0\0\377\201\0\4\11\371\0\313\67\200\0\3\70"
+    "\311\0\377\201\0\4\10\370\0\372\12\205\0\0\377\202\0\0\377\202\0\3"
+    "\377\0Y\256\200\0\10\257Y\270\67Y\377Y\66\311\200\0\3\234]h\215"
+    "\200\0\4~\255\0\256}\203\0\2C\341\17\201\0\0\377\203\0\1\300@\204"
+    "\0\0\377\201\0\1\224u\200\0\1u\224\207\0\0\377\200\0\5\27\211\312"
+    "\0\362\14\200\0\3\15\361\0\377\200\0\6\20|\275\0\307\226$\204\0\0"
+    "\377\202\0\0\377\202\0\3\377\0\27\356\200\2\10\356\27\233K\247\314"
+    "\250J\263\200\0\0\31\200\313\0\17\200\0\4\7\333\216\333\7\202\0\2"
+    "\15\340E\202\0\0\377\203\0\1@\300\204\0\0\377\220\0\201\377\5\362"
+    "\266$\0\375\1\200\0\17\2\375\0\377\375\373\377\307\20\0\30\231\345"
+    "\356\235\26\201\0\0\377\202\0\0\377\202\0\0\377\200\0\13\324\64\65"
+    "\323\0~d\357B\361d\235\201\0\1\315\266\202\0\2H\377H\203\0\1\233"
+    "\230\203\0\0\377\204\0\1\300@\203\0\0\377\220\0\0\377\204\0\1\362"
+    "\14\200\0\3\15\364\0\377\200\0\2'\330[\202\0\2\30\215\300\201\0\0"
+    "\377\202\0\0\377\202\0\0\377\200\0\13\221vw\221\0a\267\325\0\342"
+    "\270\210\200\0\3E\325\344\62\202\0\0\377\203\0\2G\336\14\203\0\0"
+    "\377\204\0\1@\300\203\0\0\377\220\0\0\377\204\0\1\312\67\200\0\3"
+    "\67\322\0\377\201\0\2\77\333\2\202\0\1\12\372\201\0\0\377\202\0\1"
+    "\363\5\200\0\1\5\363\200\0\13O\271\272N\0D\375\214\0\237\375r\200"
+    "\0\3\303Wj\266\202\0\0\377\202\0\2\17\341@\204\0\0\377\205\0\1\300"
+    "@\202\0\0\377\220\0\0\377\204\0\1q\270\200\25\3\270\205\0\377\202"
+    "\0\7\307R\264=\10\24\206\312\201\0\0\377\202\0\1\272x\200\14\1z"
+    "\272\200\0\0\17\200\362\17\17\0'\377D\0\134\377\134\0B\326\2\6\337"
+    ":\201\0\0\377\202\0\1\240\222\205\0\0\377\205\0\1@\300\202\0\0\377"
+    "\220\0\0\377\204\0\7\3\223\360\377\322\14\0\377\202\0\7R\306O\307"
+    "\371\361\263#\201\0\0\377\202\0\1\33\262\200\364\1\262\33\201\0"
+    "\200\311\200\0\11\12\364\7\0\32\377F\0\301[\200\0\1b\276\201\0\0"
+    "\377\202\0\204\377\201\0\0\377\206\0\1\300@\201\0\0\377\232\0\2U"
+    "\365,\300\0\200\377\205\0\1@\300\200\0\200\377\233\0\1\202S\377\0"
+    "\310\0\205\377\360\0\2~\252\1\210\0\0\377\217\0\0\377\211\0\2f\363"
+    "\377\207\0\0\377\206\0\0\377\205\0\0\377\201\0\0\377\204\0\201\377"
+    "\231\0\1z\216\210\0\0\377\217\0\0\377\211\0\1\346\60\210\0\0\377"
+    "\222\0\0\377\206\0\0\377\245\0\0\377\217\0\0\377\211\0\0\376\211\0"
+    "\0\377\222\0\0\377\206\0\0\377\236\0\4 \272\370\276 \200\0\4\377"
+    "\206\366\310\32\200\0\4\5\216\353\357q\200\0\4\32\307\366\206\377"
+    "\200\0\4\16\256\367\313\36\200\0\203\377\200\0\4\30\306\366\202"
+    "\377\200\0\4\377f\354\352M\200\0\201\377\203\0\201\377\201\0\0\377"
+    "\200\0\2x\314\15\201\0\0\377\202\0\4\377\351\212\304\203\200\0\4"
+    "\377f\354\352M\200\0\4\33\304\371\304\33\207\0\4\334C\7n\275\200\0"
+    "\4\377\212\11\211\244\200\0\4\205\266\33\16\210\200\0\4\245\211\11"
+    "\214\377\200\0\4\225\230\11y\252\202\0\0\377\202\0\4\240\215\11"
+    "\210\377\200\0\4\377\206\12b\326\202\0\0\377\205\0\0\377\201\0\4"
+    "\377\0b\327\24\202\0\0\377\202\0\4\377g\377g\337\200\0\4\377\206"
+    "\12b\326\200\0\4\247\212\11\215\246\212\0\1\10\366\200\0\4\377\30"
+    "\0\30\352\200\0\1\343$\203\0\4\353\30\0\31\377\200\0\4\347\32\0\17"
+    "\355\202\0\0\377\202\0\4\351\30\0\30\377\200\0\4\377\21\0\6\374"
+    "\202\0\0\377\205\0\0\377\201\0\3\377M\337\36\203\0\0\377\202\0\4"
+    "\377\12\377\12\372\200\0\4\377\21\0\6\374\200\0\4\353\30\0\31\353"
+    "\207\0\2J\326\374\200\377\200\0\4\377\2\0\3\374\200\0\1\374\3\203"
+    "\0\4\375\2\0\3\377\200\0\200\374\2\375\377\376\202\0\0\377\202\0\4"
+    "\375\2\0\3\377\200\0\0\377\201\0\0\377\202\0\0\377\205\0\0\377\201"
+    "\0\2\377\356\212\204\0\0\377\202\0\4\377\0\377\0\377\200\0\0\377"
+    "\201\0\0\377\200\0\4\375\2\0\3\374\207\0\4\350Q\6\15\377\200\0\4"
+    "\377\27\0\27\351\200\0\1\344#\203\0\4\352\27\0\31\377\200\0\1\344"
+    "\11\205\0\0\377\202\0\4\351\31\0\30\377\200\0\0\377\201\0\0\377"
+    "\202\0\0\377\205\0\0\377\201\0\3\377!\312\70\203\0\1\376\3\201\0\4"
+    "\377\0\377\0\377\200\0\0\377\201\0\0\377\200\0\4\354\27\0\31\353"
+    "\207\0\4\360<\15\212\377\200\0\4\377\210\10\207\241\200\0\4\207"
+    "\264\31\15\204\200\0\4\244\207\10\212\377\200\0\4\222\216\15\36"
+    "\241\202\0\0\377\202\0\4\240\216\11\206\377\200\0\0\377\201\0\0"
+    "\377\202\0\0\377\205\0\0\377\201\0\4\377\0\42\315\16\202\0\1\336"
+    "\77\201\0\4\377\0\377\0\377\200\0\0\377\201\0\0\377\200\0\4\250"
+    "\210\10\213\250\207\0\4c\355\356m\377\200\0\4\377\210\367\307\31"
+    "\200\0\4\6\221\354\360t\200\0\4\33\310\367\206\377\200\0\4\14\243"
+    "\364\342`\202\0\0\377\202\0\4\30\307\366\177\376\200\0\0\377\201\0"
+    "\0\377\200\0\203\377\203\0\0\377\201\0\0\377\200\0\1O\242\202\0\2X"
+    "\362\377\200\0\4\377\0\377\0\377\200\0\0\377\201\0\0\377\200\0\4"
+    "\35\306\372\305\34\264\0\1\21\354\220\0\1\5\375\326\0\3\213\14v"
+    "\254\220\0\1U\327\326\0\3w\363\317\42\217\0\2\377\352J\377\0\342\0"
+    "\2p\350\376\202\0\0\377\202\0\2\375\350p\256\0\0\377\256\0\2\357"
+    "\65\1\202\0\0\377\202\0\2\1\71\356\256\0\0\377\256\0\0\377\204\0\0"
+    "\377\204\0\0\377\220\0\4\377\206\366\307\31\200\0\4\33\310\366\204"
+    "\377\201\0\12\377t\342\365t\0G\322\372\340a\200\0\203\377\200\0\0"
+    "\377\201\0\0\377\200\0\7\335+\0+\334\0\331+\201\0\7\6\351\27\263g"
+    "\0g\263\200\0\6\337)\0\30\354\6\0\203\377\201\0\1\1\376\204\0\0"
+    "\377\204\0\1\376\1\217\0\4\377\212\11\211\241\200\0\4\244\211\11"
+    "\214\377\201\0\12\377\262\37\21\275\0\352L\6\42\240\202\0\0\377"
+    "\202\0\0\377\201\0\0\377\200\0\7\227q\0r\226\0\214z\201\0\7P\276\0"
+    "\42\327\12\330\42\200\0\4\236k\0k\237\203\0\1g\236\200\0\2\2N\342"
+    "\204\0\0\377\204\0\2\342M\2\216\0\4\377\30\0\30\351\200\0\4\352\30"
+    "\0\31\377\201\0\1\377\33\202\0\3\342v+\6\203\0\0\377\202\0\0\377"
+    "\201\0\0\377\200\0\14Q\270\0\271P\0\77\311\23\374\20\255h\200\0\2"
+    "\201\276\200\201\0\4\134\256\0\300I\202\0\2<\301\7\200\0\200\377\0"
+    "c\204\0\0\377\204\0\2b\376\377\200\0\5\203\364\321N\14\206\206\0\4"
+    "\377\2\0\3\374\200\0\4\375\2\0\3\377\201\0\0\377\203\0\4\65\255"
+    "\343\364g\202\0\0\377\202\0\0\377\201\0\0\377\200\0\14\16\362\21"
+    "\362\16\0\4\355h\373]\365\25\200\0\2'\377&\201\0\4\32\356\32\353\5"
+    "\201\0\2\34\316\31\201\0\2\3f\343\204\0\0\377\204\0\2\343e\3\200\0"
+    "\5\205\13<\277\364\203\206\0\4\377\27\0\27\352\200\0\4\353\27\0\31"
+    "\377\201\0\0\377\206\0\1F\356\202\0\1\377\1\201\0\4\374\7\0\25\377"
+    "\201\0\2\304\215\303\201\0\4\245\347\260\344\273\201\0\2\242\243"
+    "\241\202\0\2\331\237\236\201\0\2\10\303\66\203\0\1\10\377\204\0\0"
+    "\377\204\0\1\377\7\217\0\4\377\210\10\207\244\200\0\4\247\207\10"
+    "\212\377\201\0\0\377\203\0\4\253-\6T\346\202\0\1\355\65\201\0\4"
+    "\327b\11\207\377\201\0\2~\370}\201\0\4X\377J\377e\200\0\4\60\325\4"
+    "\326/\201\0\2\227\376M\201\0\1\241`\205\0\0\377\204\0\0\377\204\0"
+    "\0\377\220\0\4\377\211\367\310\33\200\0\4\34\311\366\203\377\201\0"
+    "\0\377\203\0\4V\327\373\322C\202\0\2y\365\377\200\0\4N\352\354f"
+    "\377\201\0\2\67\377\67\201\0\4\20\353\2\354\23\200\0\4\272`\0a\271"
+    "\201\0\2U\366\11\201\0\203\377\202\0\2\357\65\1\202\0\0\377\202\0"
+    "\2\1\67\356\220\0\0\377\210\0\0\377\262\0\1[\261\213\0\2s\351\376"
+    "\202\0\0\377\202\0\2\376\351r\220\0\0\377\210\0\0\377\261\0\2\7"
+    "\300_\222\0\0\377\227\0\0\377\210\0\0\377\261\0\2\377\277\6\377\0"
+    "\325\0\1\77\325\202\0\1\326\77\265\0\200\377\201\0\200\377\200\0"
+    "\200\377\210\0\0\377\201\0\0O\200\350\0M\203\0\2w\362\225\203\0"
+    "\200\377\202\0\2\6\333\215\202\0\2\215\332\5\203\0\0\377\242\0\1@"
+    "\300\210\0\200\377\201\0\200\377\200\0\200\377\200\0\7b\342\4\361Q"
+    "\62\272\362\201\377\4\0\351:;\350\203\0\2\362\377D\203\0\200\377"
+    "\202\0\2`\377Q\202\0\2R\377]\201\0\4\257\66\377\67\257\240\0\1\300"
+    "@\210\0\200\377\201\0\200\377\200\0\200\377\200\0\17\246\236:\373"
+    "\17\342\377\63\377\36\232\0\352\70:\350\203\0\2\265\377\37\203\0"
+    "\200\377\202\0\2\270\377&\202\0\2'\377\265\201\0\4=\331\377\331="
+    "\202\0\0\377\232\0\1@\300\211\0\200\377\207\0\0X\204\377\3\343\377"
+    "a\377\201\0\0R\200\351\3P=\223a\200\0\2e\377d\211\0\2\354\377\13"
+    "\202\0\2\14\377\353\201\0\4=\330\377\330=\202\0\0\377\232\0\1\300@"
+    "\211\0\200\355\210\0\22\63\377\21\307}\0\60\270\370\377\351\227\21"
+    "\0\24r\234`\12\200\0\5j\374\322\271\11\375\207\0\2\375\377\2\202\0"
+    "\2\3\377\374\201\0\4\257\65\377\65\257\202\0\0\377\212\0\202\377"
+    "\211\0\1@\300\212\0\1\314\317\210\0\4i\333\5\367G\201\0\22\4\377"
+    "\207\377\267^\207)O\351\350M\0\347\366o\373>\360\207\0\2\354\377"
+    "\13\202\0\2\14\377\353\203\0\0\377\201\0\205\377\207\0\202\377\211"
+    "\0\1\300@\225\0\204\377\1Xy\200\0\3\377\11\377\371\201\0\12\351:<"
+    "\350\0\370\377,\376\364\307\207\0\2\271\377'\202\0\2(\377\266\212"
+    "\0\0\377\230\0\1@\300\213\0\200\377\207\0\4\3\357N\206\275\200\0\6"
+    "\377\226\27\377Q\377\303\201\0\12\352\70:\350\0\275\377c\322\377"
+    "\177\207\0\2`\377R\202\0\2R\377]\212\0\0\377\204\0\200\377\212\0"
+    "\200\377\202\0\1\300@\213\0\200\377\207\0\4\71\373\16\312w\200\0\6"
+    "A\256\356\377\360\250\31\201\0\12R\352\351O\0&\320\370\307\343\302"
+    "\207\0\2\5\332\215\202\0\2\216\331\4\212\0\0\377\203\0\2\6\377\362"
+    "\212\0\200\377\201\0\1@\300\241\0\0\377\231\0\1\77\325\202\0\1\326"
+    ">\221\0\2\134\374J\217\0\1\300@\241\0\0\377\264\0\1\311m\377\0\377"
+    "\0\345\0\1\3\221\200\360\2\221\2\0\202\377\201\0\14L\302\370\353"
+    "\241\24\0M\303\371\355\252\35\201\0\2\35\364\377\200\0\203\377\201"
+    "\0\3w\343\363w\200\0\204\377\2\0\42\266\200\365\10\265 \0\27\264"
+    "\367\355\223\4\243\0\13Y\326\373\331O\0o\377km\377o\201\0\200\377"
+    "\201\0\14\262\71\11d\377\270\0\270F\12X\377\307\201\0\0\257\200"
+    "\377\200\0\200\377\203\0\4`\377\225\13|\203\0\5\67\377\346\0\311"
+    "\377\200K\10\377\310\0\255\377TW\377x\243\0\13\233\31)\377\356\0"
+    "\311\377\34\37\377\311\201\0\200\377\204\0\2\11\377\363\202\0\2\10"
+    "\377\370\200\0\1K\357\200\377\200\0\200\377\203\0\2\303\377\35\205"
+    "\0\20\226\377\212\0\371\377\6\7\377\370\0\363\377\11\12\377\315"
+    "\220\0\2\17j\316\206\0\2\315i\17\205\0\11A\377\310\0\362\377\5\7"
+    "\377\361\201\0\200\377\204\0\2R\377\233\202\0\6S\377\244\0\11\336m"
+    "\200\377\200\0\200\377\12\366\361\236\14\0\360\377\302\372\324."
+    "\201\0\6\7\356\377,\0\237\377\200K\10\377\234\0\371\377\11\12\377"
+    "\362\201\0\200\377\203\0\200\377\202\0\4>\242\366\353\226\206\0\4"
+    "\226\354\366\241=\202\0\12\66\361\274\23\0\375\377\0\305\377\375"
+    "\201\0\200\377\203\0\3\33\347\344\24\201\0\200\377\5\254\6\0\204"
+    "\322\3\200\377\202\0\12\20\237\377\237\0\375\377TW\377\303\201\0\2"
+    "T\377\315\200\0\1\3\244\200\377\10\245\3\0\305\377TW\377\374\201\0"
+    "\200\377\203\0\200\377\201\0\4\331\365\247L\5\200\0\204\377\200\0"
+    "\4\5L\250\366\331\201\0\2\332\377\23\200\0\5\362\377\5\7\377\361"
+    "\201\0\200\377\202\0\3\12\314\360/\202\0\7\1[\377\254\0\370@\0\200"
+    "\377\203\0\11\22\377\362\0\363\377\11\12\377\370\201\0\2\263\377n"
+    "\200\0\14\246\377MO\377\244\0\60\325\373\306\377\357\215\0\4\334"
+    "\361\240G\3\210\0\4\4G\240\361\334\201\0\200\377\201\0\5\311\377"
+    "\34\37\377\311\201\0\200\377\201\0\3\2\257\365;\204\0\3\11\377\371"
+    "\0\204\377\202\0\11\23\377\357\0\316\377\11\12\377\362\200\0\3\26"
+    "\373\372\25\200\0\5\372\377\6\7\377\371\202\0\2\37\377\302\215\0\6"
+    "\1A\245\367\351\224\0\204\377\6\0\224\352\367\244A\1\206\0\5o\377i"
+    "l\377o\201\0\200\377\201\0\2\215\371F\202\0\5\244)\7f\377\315\202"
+    "\0\200\377\200\0\14\230\32\15\225\377\225\0x\377TW\377\253\200\0\2"
+    "q\377\261\201\0\5\315\377LP\377\314\200\0\4x\12\226\377]\201\0\200"
+    "\377\203\0\200\377\204\0\2\20k\316\206\0\2\316k\20\204\0\200\377"
+    "\201\0\1\3\221\200\360\2\221\3\0\204\377\0\0\204\377\6\4T\315\372"
+    "\360\263$\202\0\200\377\200\0\14U\321\373\343\207\6\0\5\224\355"
+    "\367\262\26\200\0\2\320\377S\201\0\1'\275\200\366\1\275'\200\0\3w"
+    "\364\343u\202\0\200\377\202\0\2\6\377\362\230\0\200\377\317\0\2"
+    "\134\374J\353\0\1\311m\377\0\377\0\364\0\0\15\200\374\0\14\200\0"
+    "\201\377\2\366\301.\200\0\5A\302\365\352n\0\200\377\2\370\323c\200"
+    "\0\204\377\0\0\204\377\200\0\5F\310\367\342e\0\200\377\200\0\200"
+    "\377\0\0\204\377\201\0\202\377\0\0\200\377\200\0\2\251\376M\200"
+    "\377\203\0\1\377~\200\0\2\177\377\0\200\377\1a\0\200\377\2\0\2\216"
+    "\200\357\10\214\1\0\34\245\356\370\300*\200\0\0E\200\377\0D\200\0"
+    "\200\377\13\0C\377\323\0:\373\317!\23\223\0\200\377\4\7\235\377Y\0"
+    "\200\377\203\0\200\377\203\0\6<\374\307\34\21\211\0\200\377\200\0"
+    "\200\377\201\0\200\377\205\0\200\377\0\0\200\377\4\0m\377\202\0"
+    "\200\377\203\0\1\377\360\200\22\2\361\377\0\200\377\1\254\0\200"
+    "\377\15\0m\377jl\377i\21\340\211\27\13m\321\200\0\3\200\366\361"
+    "\177\200\0\200\377\7\0\5\377\372\0\263\377G\202\0\200\377\4\0+\377"
+    "\302\0\200\377\203\0\200\377\203\0\2\264\377A\202\0\200\377\200\0"
+    "\200\377\201\0\200\377\205\0\200\377\0\0\200\377\4\67\371\267\2\0"
+    "\200\377\203\0\200\377\1\210\211\200\377\0\0\200\377\1\357\5\200"
+    "\377\15\0\310\377\34\36\377\306\210\237\34\301\372\311\376\200\0\3"
+    "\273\311\305\272\200\0\200\377\7\0>\377\270\0\354\377\17\202\0\200"
+    "\377\4\0\12\377\360\0\200\377\203\0\200\377\203\0\2\354\377\16\202"
+    "\0\200\377\200\0\200\377\201\0\200\377\205\0\200\377\0\0\200\377\2"
+    "\341\374\27\200\0\200\377\203\0\200\377\200\365\200\377\0\0\200"
+    "\377\1\311C\200\377\25\0\361\377\5\7\377\360\327\62\262\200\10\203"
+    "\377\0\3\363\232\230\362\3\0\202\377\5\307\23\0\374\377\2\202\0"
+    "\200\377\4\0\2\377\374\0\203\377\200\0\203\377\200\0\2\374\377\1"
+    "\202\0\204\377\201\0\200\377\205\0\200\377\0\0\200\377\2\376\377g"
+    "\200\0\200\377\203\0\200\377\200\343\200\377\0\0\200\377\1\201\216"
+    "\200\377\20\0\375\377\0\1\377\374\370\7\364\20\0\20\377\0\61\377"
+    "\200k\2\377\60\0\200\377\7\0C\377\264\0\354\377\17\202\0\200\377\4"
+    "\0\12\377\357\0\200\377\203\0\200\377\203\0\2\355\377\12\201\377\0"
+    "\0\200\377\200\0\200\377\201\0\200\377\205\0\200\377\0\0\200\377\4"
+    "V\346\344\10\0\200\377\203\0\200\377\200\0\200\377\0\0\200\377\1"
+    "\71\332\200\377\17\0\361\377\5\7\377\360\367\11\364\20\0\20\377\0l"
+    "\202\377\1k\0\200\377\7\0\5\377\371\0\263\377F\202\0\200\377\4\0,"
+    "\377\302\0\200\377\203\0\200\377\203\0\3\267\377\60\0\200\377\0\0"
+    "\200\377\200\0\200\377\201\0\200\377\204\0\3\3\377\375\0\200\377\4"
+    "\0m\377t\0\200\377\203\0\200\377\200\0\200\377\0\0\200\377\1\3\355"
+    "\200\377\20\0\310\377\34\36\377\306\320:\261\200\7\202\377\0\247"
+    "\370\200\4\2\370\246\0\200\377\13\0<\377\336\0:\373\315 \22\221\0"
+    "\200\377\4\7\234\377[\0\200\377\203\0\200\377\203\0\3D\376\235\14"
+    "\200\377\0\0\200\377\200\0\200\377\201\0\200\377\201\0\6\246+\6Z"
+    "\377\326\0\200\377\4\0\7\343\354\15\200\377\203\0\200\377\200\0"
+    "\200\377\0\0\200\377\1\0\251\200\377\20\0m\377il\377ix\260\34\302"
+    "\373\315\377\0\342\317\200\0\2\317\342\0\201\377\2\371\315\77\200"
+    "\0\5B\303\366\352m\0\200\377\2\371\324f\200\0\204\377\0\0\200\377"
+    "\204\0\5U\325\373\353\247\0\200\377\200\0\200\377\0\0\204\377\7\0N"
+    "\304\371\364\303\65\0\200\377\200\0\2i\377\200\204\377\0\0\200\377"
+    "\200\0\200\377\0\0\200\377\1\0`\200\377\2\0\2\217\200\360\10\215\1"
+    "\10\310\246(\6B\211\350\0\5\13\205\335\373\354\227\377\0\377\0\377"
+    "\0\223\0\201\377\0l\207\0\0T\201\377\217\0\200\377\6\376\360\272-"
+    "\0\2\216\200\357\2\211\1\0\201\377\12\363\277\60\0\27\246\356\370"
+    "\306P\0\204\377\0\0\200\377\200\0\200\377\2\0\345\323\200\0\3\323"
+    "\344\361\217\201\0\13\220\362\0\300\362\16\17\362\300\272\373&\200"
+    "\0\2&\373\271\204\377\200\0\200\377\202\0\1\304\217\205\0\200\377"
+    "\201\0\4\4\264\377\263\4\207\0\200\377\13\2N\377\321\0m\377jl\377d"
+    "\0\200\377\12\1J\377\323\0\275\377X\11\64\255\201\0\200\377\201\0"
+    "\200\377\200\0\200\377\2\0\257\372\200\6\3\373\256\324\246\201\0"
+    "\13\241\326\0@\377st\377@/\375\256\200\0\2\257\375.\201\0\2\32\357"
+    "\360\200\0\200\377\202\0\2M\364\22\204\0\200\377\200\0\6\1\241\370"
+    "\224\370\240\1\206\0\200\377\13\0\5\377\372\0\310\377\34\36\377"
+    "\303\0\200\377\6\0\6\377\372\0\372\357\205\0\200\377\201\0\200\377"
+    "\200\0\200\377\15\0y\377/\60\377x\266\275F\377H\261\272\200\0\0"
+    "\300\200\342\0\301\200\0\5\240\377;<\377\237\202\0\2\265\377\134"
+    "\200\0\200\377\202\0\2\1\324~\204\0\200\377\200\0\6\213\347\70\0"
+    "\71\347\213\206\0\200\377\13\2O\377\322\0\361\377\5\7\377\356\0"
+    "\200\377\10\1M\377\275\0\323\377\254\61\203\0\200\377\201\0\200"
+    "\377\200\0\200\377\15\0C\377]^\377B\230\324s\377x\302\237\200\0\0@"
+    "\200\377\0B\200\0\5\34\366\307\310\366\34\201\0\2`\377\252\201\0"
+    "\200\377\203\0\2^\353\12\203\0\200\377\217\0\201\377\12\361\275/\0"
+    "\375\377\0\1\377\374\0\202\377\4\260\13\0*\306\200\377\1\256\23"
+    "\201\0\200\377\201\0\200\377\200\0\200\377\15\0\16\375\214\215\375"
+    "\15z\353\237\322\250\322\203\201\0\2\347\352\1\201\0\0\206\200\377"
+    "\0\205\201\0\3\33\357\346\22\201\0\200\377\203\0\2\4\341n\203\0"
+    "\200\377\217\0\200\377\203\0\6\361\377\5\7\377\362\0\200\377\3\11"
+    "\271\373/\201\0\3\67\304\377\270\201\0\200\377\201\0\200\377\200\0"
+    "\200\377\200\0\13\326\272\273\325\0]\376\317r\331\343h\200\0\0M"
+    "\200\377\0O\201\0\0\16\200\377\0\16\201\0\2\266\377H\202\0\200\377"
+    "\204\0\2n\340\4\202\0\200\377\217\0\200\377\203\0\6\310\377\34\36"
+    "\377\311\0\200\377\3\0(\375\263\202\0\2\23\377\370\201\0\200\377"
+    "\201\0\1\367\377\200\3\1\377\366\200\0\13\240\350\351\237\0\77\377"
+    "\374\26\371\370L\200\0\3\311\334\335\312\202\0\200\377\201\0\2b"
+    "\377\226\203\0\200\377\204\0\2\12\354]\202\0\200\377\217\0\200\377"
+    "\203\0\6m\377il\377m\0\200\377\200\0\10\250\377\70\260\67\6O\377"
+    "\305\201\0\200\377\201\0\1\300\377\200K\1\377\276\200\0\0j\200\377"
+    "\17i\0!\377\335\0\323\377\61\0F\377qr\377F\201\0\200\377\201\0\2"
+    "\360\332\12\203\0\200\377\205\0\2\177\323\1\201\0\200\377\217\0"
+    "\200\377\203\0\6\2\221\361\377\300\3\0\200\377\200\0\10*\375\275R"
+    "\311\371\361\263\42\201\0\200\377\201\0\1'\300\200\367\1\277%\200"
+    "\0\0\63\200\377\13\63\0\5\375\257\0\241\377\25\0\302\363\200\17\1"
+    "\363\302\201\0\200\377\201\0\204\377\200\0\200\377\205\0\2\23\364L"
+    "\201\0\200\377\231\0\2L\330\60\277\0\201\377\0l\204\0\3\220\304\0T"
+    "\201\377\377\0\346\0\205\377\357\0\2\203\325\12\211\0\200\377\216"
+    "\0\200\377\210\0\3b\344\375\377\206\0\200\377\205\0\200\377\203\0"
+    "\200\377\201\0\200\377\202\0\202\377\230\0\1\211\240\211\0\200\377"
+    "\216\0\200\377\210\0\2\353\377\34\207\0\200\377\205\0\200\377\203"
+    "\0\200\377\201\0\200\377\204\0\200\377\245\0\200\377\216\0\200\377"
+    "\210\0\200\377\210\0\200\377\221\0\200\377\204\0\200\377\237\0\5j"
+    "\350\366\277#\0\200\377\3\244\370\313\36\200\0\11k\327\371\334_\0 "
+    "\314\370\244\200\377\7\0\6\225\357\362\241\13\0\204\377\4\0\27\304"
+    "\371\262\200\377\0\0\200\377\4\240\365\353^\0\202\377\201\0\202"
+    "\377\201\0\200\377\3\0|\377m\200\0\200\377\202\0\6\377\304\367\260"
+    "\365\225\0\200\377\6\241\365\352[\0\6\226\200\360\1\226\6\207\0\5"
+    "\232\30&\377\265\0\200\377\200f\15\377\250\0q\377\257\24\26\222\0"
+    "\253\377eh\200\377\6\0\207\377`T\377\223\201\0\200\377\201\0\3\236"
+    "\377hk\200\377\0\0\200\377\3Z:\377\351\201\0\200\377\203\0\200\377"
+    "\201\0\200\377\2M\376\211\201\0\200\377\202\0\200\377\4\15\377\15"
+    "\353\0\200\377\12Z:\377\350\0\207\377ef\377\207\212\0\2\377\356\0"
+    "\200\377\200\22\5\377\353\0\337\377\42\202\0\3\354\377\22\23\200"
+    "\377\6\0\343\377\17\11\377\347\201\0\200\377\201\0\3\350\377\25\27"
+    "\200\377\0\0\200\377\1\7\2\200\377\201\0\200\377\203\0\200\377\201"
+    "\0\200\377\2\361\277\1\201\0\200\377\202\0\200\377\4\0\377\0\375\0"
+    "\200\377\1\7\2\200\377\2\0\343\377\200\22\1\377\343\206\0\2K\321"
+    "\370\200\377\1\376\0\200\377\7\1\2\377\374\0\373\377\3\202\0\3\375"
+    "\377\1\2\200\377\1\0\374\202\377\0\376\201\0\200\377\201\0\1\374"
+    "\377\200\4\200\377\0\0\200\377\200\0\200\377\201\0\200\377\203\0"
+    "\200\377\201\0\200\377\2\364\362\27\201\0\200\377\202\0\200\377\4"
+    "\0\377\0\377\0\200\377\200\0\200\377\6\0\374\377\1\2\377\373\206\0"
+    "\3\353\377=\14\200\377\0\0\200\377\200\22\5\377\353\0\337\377!\202"
+    "\0\3\355\377\22\23\200\377\3\0\345\377\15\204\0\200\377\201\0\3"
+    "\354\377\25\27\200\377\0\0\200\377\200\0\200\377\201\0\200\377\203"
+    "\0\200\377\201\0\200\377\2+\373\231\201\0\2\374\377\2\201\0\200"
+    "\377\4\0\377\0\377\0\200\377\200\0\200\377\2\0\344\377\200\22\1"
+    "\377\343\206\0\3\355\377(d\200\377\0\0\200\377\200d\15\377\252\0s"
+    "\377\255\23\25\220\0\255\377cg\200\377\6\0\210\377\204\10\42\242"
+    "\201\0\200\377\201\0\3\245\377fi\200\377\0\0\200\377\200\0\200\377"
+    "\201\0\200\377\203\0\200\377\201\0\200\377\3\0\237\374+\200\0\2"
+    "\327\377:\201\0\200\377\4\0\377\0\377\0\200\377\200\0\200\377\6\0"
+    "\211\377cd\377\211\206\0\3Z\346\367\244\200\377\0\0\200\377\17\246"
+    "\370\317!\0\1n\331\372\337c\0#\320\370\245\200\377\6\0\6\212\346"
+    "\372\321W\201\0\200\377\201\0\3\32\310\371\263\200\377\0\0\200\377"
+    "\200\0\200\377\0\0\204\377\201\0\200\377\201\0\200\377\3\0%\374"
+    "\270\200\0\3G\335\376\377\200\0\200\377\4\0\377\0\377\0\200\377"
+    "\200\0\200\377\2\0\7\230\200\361\1\230\7\263\0\2\13\377\361\216\0"
+    "\2\4\377\373\326\0\4\207\15e\377\265\216\0\2Q\377\322\326\0\4g\346"
+    "\367\276\42\215\0\3\377\375\326\77\377\0\342\0\3k\340\373\377\201"
+    "\0\0\377\202\0\3\377\373\340h\254\0\200\377\256\0\2\360\377\63\202"
+    "\0\0\377\203\0\2\66\377\357\254\0\200\377\256\0\200\377\203\0\0"
+    "\377\204\0\200\377\217\0\200\377\10\244\367\316\37\0!\317\367\243"
+    "\200\377\200\0\200\377\11\246\367\377\0\64\274\362\371\307Q\204"
+    "\377\200\0\200\377\200\0\200\377\2\0\334\331\200\0\3\332\333\353"
+    "\267\201\0\20\267\352\0\267\377>@\377\267\0\332\353\0\1\352\327\0"
+    "\204\377\200\0\0\3\200\377\203\0\0\377\204\0\200\377\0\2\216\0\200"
+    "\377\200f\6\377\251\0\254\377eh\200\377\200\0\200\377\11\222\13g\0"
+    "\343\377:\6/\250\200\0\200\377\202\0\200\377\200\0\200\377\10\0"
+    "\223\377\25\26\377\222\301\315\201\0\17\316\300\0*\373\262\271\374"
+    "*\0\216\377\42,\377\207\202\0\7\42\341\343\0\2T\377\336\203\0\0"
+    "\377\204\0\3\336\377U\2\215\0\200\377\200\22\6\377\353\0\354\377"
+    "\22\23\200\377\200\0\200\377\0\24\201\0\4\353\377\231\71\3\201\0"
+    "\200\377\202\0\200\377\200\0\200\377\15\0K\377PQ\377J\227\344P\377"
+    "P\345\226\200\0\3\224\376\377\225\200\0\5B\377Yk\377\66\201\0\4\42"
+    "\342\340\42\0\200\377\1\352C\203\0\0\377\204\0\1B\351\200\377\215"
+    "\0\200\377\10\1\2\377\374\0\375\377\1\2\200\377\200\0\200\377\0\1"
+    "\201\0\1G\323\200\377\1\351P\200\0\200\377\202\0\200\377\200\0\200"
+    "\377\15\0\12\370\214\215\367\11l\372\210\361\211\373k\200\0\0=\200"
+    "\377\0@\200\0\5\5\360\220\253\344\1\200\0\3#\342\336\37\200\0\3\4i"
+    "\377\334\203\0\0\377\204\0\12\335\377i\4\0\202\364\321N\14\207\206"
+    "\0\200\377\200\22\6\377\353\0\354\377\22\23\200\377\200\0\200\377"
+    "\204\0\3\25s\377\353\200\0\200\377\202\0\200\377\1\2\6\200\377\200"
+    "\0\13\272\307\310\271\0B\377\320\217\323\377A\200\0\3\263\366\371"
+    "\264\201\0\3\252\310\352\225\200\0\3#\343\334\35\202\0\0\11\200"
+    "\377\203\0\0\377\204\0\200\377\0\11\200\0\5\201\12\71\277\364\203"
+    "\206\0\200\377\200d\6\377\250\0\253\377cg\200\377\200\0\200\377"
+    "\202\0\5\255\64\6\66\377\346\200\0\2\356\377$\201\0\3\351\377:X"
+    "\200\377\200\0\0q\200\372\17p\0\30\377\376!\376\377\27\0\70\377"
+    "\237\245\377\71\200\0\3^\376\377E\200\0\2\343\332\33\204\0\200\377"
+    "\203\0\0\377\204\0\200\377\217\0\200\377\10\244\370\314\36\0 \314"
+    "\370\244\200\377\200\0\200\377\202\0\5J\275\366\367\313B\200\0\3i"
+    "\344\375\377\200\0\3^\353\366\244\200\377\200\0\0(\200\377\0(\200"
+    "\0\4\355\327\0\330\355\200\0\5\275\377\67:\377\275\200\0\3\24\375"
+    "\357\5\200\0\204\377\201\0\2\361\377\61\202\0\0\377\203\0\2\64\377"
+    "\360\217\0\200\377\207\0\200\377\261\0\2\14\365\244\212\0\3m\342"
+    "\374\377\201\0\0\377\202\0\3\377\374\342k\217\0\200\377\207\0\200"
+    "\377\260\0\3\2\177\377K\221\0\0\377\227\0\200\377\207\0\200\377"
+    "\260\0\2\377\371\227\253\0"
 };
 #endif
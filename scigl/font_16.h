@@ -1,4 +1,4 @@
-/* This file has been generated by makefont.py */
+/* This file has been generated by makefont.py and rle-font.py */
 
 #ifndef __FONT_16__
 #define __FONT_16__
@@ -6,1344 +6,697 @@
 static const struct {
     unsigned int width;
     unsigned int height;
-    unsigned char data[160*228+1];
+    unsigned int length;
+    unsigned char data[14863+1];
 } font_16 = {
-    160, 228,
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\0\0\0\0\0\0\0\0\377\0\0\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\1\0\0\0\43\306\371\302\40\0\0\0\0\0\0\0\46\274\367\377\377\0\0\0"
-    "\0\0\0\0\377\0\0\0\0\0\0\0\0\0\41\370\230\0\0\0\0\0\230\370\40\0\0"
-    "\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\73\304\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0\0\377\0\0\377\0\0\0"
-    "\0\0\0\0\343\153\0\225\270\0\0\0\0\0\0\377\3\0\0\0\306\170\14\170"
-    "\300\0\0\0\0\0\0\0\316\162\12\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0"
-    "\0\0\241\323\7\0\0\0\0\0\7\324\240\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\262\116\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\377\0\0\0\0\0\0\0\0\377\0\0\377\0\0\0\0\0\0\54\377\41\0\336\160\0"
-    "\0\0\20\233\353\377\352\246\76\0\372\13\0\14\371\0\0\0\0\0\0\0\373"
-    "\13\0\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0\0\31\372\75\0\0\0\0\0\0"
-    "\0\77\372\27\0\0\0\0\0\247\153\5\377\5\154\247\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\51\325\1\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0"
-    "\0\0\377\0\0\377\0\0\0\0\0\0\164\330\0\47\377\50\0\0\0\257\225\26"
-    "\377\22\122\276\0\307\163\13\170\305\0\0\11\56\0\0\0\325\142\0\0\0"
-    "\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0\0\161\277\0\0\0\0\0\0\0\0\0\303\155"
-    "\0\0\0\0\0\6\147\272\377\272\147\6\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\236"
-    "\142\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\20\377\377\377\377\377\377\377\377\377\0\0\370\12\0\377\0\0"
-    "\0\0\45\307\372\306\42\12\162\322\142\0\0\0\230\360\44\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\266\142\0\0\0\0\0\0\0\0\0\145\263\0\0\0\0"
-    "\0\6\146\272\377\272\146\6\0\0\0\0\0\0\377\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\32\337\6\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\370\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\10\371\112\0\265\227\0\0\0\0\343\116\0\377\0\0\0\0\0\0\0\13\164"
-    "\320\163\12\0\0\0\62\367\240\312\5\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\344\44\0\0\0\0\0\0\0\0\0\47\342\0\0\0\0\0\250\154\5\377\5\155\250"
-    "\0\0\0\0\0\0\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\212\166\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\345\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\74\376\21\1\355\135\0"
-    "\0\0\0\131\371\306\377\146\25\0\0\0\14\167\317\156\10\0\0\0\0\0\255"
-    "\207\0\261\212\0\1\374\0\0\0\0\0\0\0\0\0\0\0\0\0\0\373\6\0\0\0\0\0"
-    "\0\0\0\0\7\372\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\17\342\16\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\321\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\167\325\0\47\377\44\0\0\0\0\0\43\170\377\326\363"
-    "\111\0\121\315\151\6\43\306\371\300\36\0\0\354\37\0\24\344\105\10"
-    "\355\0\0\0\0\0\0\0\0\0\0\0\0\0\0\373\6\0\0\0\0\0\0\0\0\0\7\372\0\0"
-    "\0\0\0\0\0\0\377\0\0\0\0\0\0\377\377\377\377\377\377\377\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\167\211\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377\377\20\0\0\0\0\0\377"
-    "\0\132\335\0\30\5\0\0\306\166\14\173\275\0\0\371\10\0\0\103\345\106"
-    "\301\0\0\0\0\0\0\0\0\0\0\0\0\0\0\344\45\0\0\0\0\0\0\0\0\0\47\342\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\6\337\31\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\16"
-    "\372\103\0\274\220\0\0\0\0\0\0\0\0\377\0\12\367\0\0\0\0\0\372\13\0"
-    "\14\371\0\0\315\116\0\0\0\211\366\152\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\266\142\0\0\0\0\0\0\0\0\0\146\263\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\143\235\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\122\363\6\13\370\110\0\0\0\0\0\270"
-    "\110\16\377\23\217\251\0\0\0\0\0\310\163\13\170\305\0\0\117\350\114"
-    "\7\46\241\377\75\0\0\0\0\0\0\0\0\0\0\0\0\0\0\161\277\0\0\0\0\0\0\0"
-    "\0\0\305\155\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0"
-    "\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0"
-    "\1\325\50\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\233\260\0\114\367\11\0\0\0\0\0\104\261\356\377"
-    "\352\231\15\0\0\0\0\0\47\311\372\305\42\0\0\0\122\322\372\347\233"
-    "\174\275\0\0\0\0\0\0\0\0\0\0\0\0\0\0\31\372\75\0\0\0\0\0\0\0\102\372"
-    "\27\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\2\377\373"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\117\261\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\241\323\7\0\0\0\0"
-    "\0\10\326\240\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\73\377\211\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\305\73\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\41\370"
-    "\230\0\0\0\0\0\232\370\41\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\212\341\13\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\331\116\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\42\261\362"
-    "\362\260\40\0\0\0\0\63\231\363\377\0\0\0\0\0\74\242\342\372\355\264"
-    "\74\0\0\0\64\225\334\372\356\273\116\0\0\0\0\0\0\17\347\377\0\0\0"
-    "\0\0\377\377\377\377\377\377\0\0\0\0\10\201\334\371\325\131\0\0\0"
-    "\377\377\377\377\377\377\377\372\0\0\2\160\321\370\370\321\160\2\0"
-    "\0\0\125\315\370\357\257\45\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\115\300\366\362\251\25\0\0\0\17\341\167\20\21\170\337\15\0\0"
-    "\0\325\200\53\377\0\0\0\0\0\377\333\137\23\6\73\315\117\0\0\314\156"
-    "\54\11\7\65\301\160\0\0\0\0\0\216\235\377\0\0\0\0\0\377\0\0\0\0\0"
-    "\0\0\0\1\271\225\42\6\56\247\0\0\0\0\0\0\0\0\0\163\245\0\0\217\301"
-    "\66\10\7\64\277\216\0\0\122\344\113\12\15\130\326\24\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\273\113\15\41\263\265\0\0\0\167\236\0\0"
-    "\0\0\242\163\0\0\0\0\0\0\377\0\0\0\0\0\231\10\0\0\0\0\50\327\0\0\0"
-    "\0\0\0\0\0\32\351\0\0\0\0\46\360\33\377\0\0\0\0\0\377\0\0\0\0\0\0"
-    "\0\0\131\247\0\0\0\0\0\0\0\0\0\0\0\0\0\2\337\65\0\0\362\30\0\0\0\0"
-    "\30\361\0\0\311\113\0\0\0\0\127\176\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\24\370\0\0\0\301\103\0\0\0\0\105\277\0\0\0\0\0"
-    "\0\377\0\0\0\0\0\0\0\0\0\0\0\12\363\0\0\0\0\0\0\0\0\32\360\0\0\0\0"
-    "\265\206\0\377\0\0\0\0\0\377\0\0\0\0\0\0\0\0\263\75\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\121\305\0\0\0\355\26\0\0\0\0\27\354\0\0\367\12\0\0\0"
-    "\0\14\305\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\10"
-    "\137\312\0\0\0\0\0\0\0\0\0\0\0\0\312\136\10\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\50\344\0\0\0\351\26\0\0\0\0\27\350\0\0\0\0\0\0\377\0\0\0\0\0\0"
-    "\0\0\0\0\0\130\252\0\0\0\0\0\0\14\101\312\216\0\0\0\110\354\17\0\377"
-    "\0\0\0\0\0\377\350\374\351\251\52\0\0\0\344\75\271\364\364\302\107"
-    "\0\0\0\0\0\0\0\0\300\125\0\0\0\173\273\62\7\7\62\273\172\0\0\366\11"
-    "\0\0\0\0\14\352\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\377\377\0\0\0\0"
-    "\0\0\0\0\40\211\354\370\247\0\0\0\0\0\0\0\0\0\0\0\0\247\371\353\210"
-    "\40\0\0\0\0\0\0\0\0\0\14\311\175\0\0\0\372\4\0\305\303\0\5\371\0\0"
-    "\0\0\0\0\377\0\0\0\0\0\0\0\0\0\0\40\337\45\0\0\0\0\377\377\377\377"
-    "\264\3\0\0\4\326\160\0\0\377\0\0\0\0\0\255\70\7\22\143\347\61\0\0"
-    "\371\334\130\15\12\112\343\111\0\0\0\0\0\0\57\341\4\0\0\0\0\246\377"
-    "\377\377\377\246\0\0\0\305\110\0\0\0\0\127\372\0\0\0\0\0\377\377\0"
-    "\0\0\0\0\0\0\0\377\377\0\0\0\0\0\1\110\263\375\330\163\24\0\0\0\377"
-    "\377\377\377\377\377\377\377\0\0\0\24\164\330\375\262\107\1\0\0\0"
-    "\0\0\26\313\231\4\0\0\0\372\4\0\310\305\0\5\371\0\0\0\0\0\0\377\0"
-    "\0\0\0\0\0\0\0\0\40\333\133\0\0\0\0\0\0\0\21\130\347\156\0\0\157\336"
-    "\6\0\0\377\0\0\0\0\0\0\0\0\0\0\134\271\0\0\372\127\0\0\0\0\113\305"
-    "\0\0\0\0\0\0\236\166\0\0\0\0\163\331\104\11\12\106\334\163\0\0\111"
-    "\340\107\11\14\127\334\371\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\333\370\245\77\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\77\245"
-    "\370\333\0\0\0\0\0\271\155\0\0\0\0\0\351\26\0\0\0\0\27\350\0\0\0\0"
-    "\0\0\377\0\0\0\0\0\0\0\0\56\344\147\0\0\0\0\0\0\0\0\0\0\75\333\0\0"
-    "\356\131\0\0\0\377\0\0\0\0\0\0\0\0\0\0\15\364\0\0\353\14\0\0\0\0\12"
-    "\366\0\0\0\0\0\25\354\21\0\0\0\0\333\63\0\0\0\0\65\333\0\0\0\110\303"
-    "\365\365\275\100\344\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\333"
-    "\364\236\71\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\72\236\364\333"
-    "\0\0\0\0\0\373\4\0\0\0\0\0\301\103\0\0\0\0\105\277\0\0\0\0\0\0\377"
-    "\0\0\0\0\0\0\0\100\355\132\0\0\0\0\0\0\0\0\0\0\0\6\371\0\0\377\377"
-    "\377\377\377\377\377\377\0\0\0\0\0\0\0\0\14\364\0\0\305\14\0\0\0\0"
-    "\12\366\0\0\0\0\0\174\226\0\0\0\0\0\371\5\0\0\0\0\6\371\0\0\0\0\0"
-    "\0\0\0\77\263\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\1\111\264"
-    "\375\325\161\24\0\0\0\377\377\377\377\377\377\377\377\0\0\0\24\162"
-    "\325\375\263\110\1\0\0\0\0\0\377\0\0\0\0\0\0\167\236\0\0\0\0\242\164"
-    "\0\0\0\0\0\0\377\0\0\0\0\0\0\126\370\146\0\0\0\0\0\0\0\0\0\0\0\0\72"
-    "\331\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0\0\0\0\133\271\0\0\200\127\0\0"
-    "\0\0\112\307\0\0\0\0\5\344\50\0\0\0\0\0\340\64\0\0\0\0\64\337\0\0"
-    "\0\0\0\0\0\0\251\132\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\41\212\354\371\251\0\0\0\0\0\0\0\0\0\0\0\0\252\371\354\211\40"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\17\341\166\20\20\170\337\15\0\0\0\0"
-    "\0\0\377\0\0\0\0\0\161\376\216\0\0\0\0\0\0\0\305\141\40\4\16\117\337"
-    "\130\0\0\0\0\0\0\0\377\0\0\0\0\301\132\33\4\24\145\346\61\0\0\25\330"
-    "\130\14\11\110\342\120\0\0\0\0\132\267\0\0\0\0\0\0\160\332\104\11"
-    "\11\102\330\155\0\0\0\245\52\5\41\225\273\1\0\0\0\0\0\377\377\0\0"
-    "\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\10\140\313\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\312\137\10\0\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0\43\262"
-    "\363\362\260\41\0\0\0\0\0\377\377\377\377\377\0\0\0\377\377\377\377"
-    "\377\377\377\377\24\0\76\245\344\373\356\271\105\0\0\0\0\0\0\0\0\377"
-    "\0\0\0\0\114\271\356\373\346\244\47\0\0\0\0\50\261\360\371\316\123"
-    "\0\0\0\0\0\311\107\0\0\0\0\0\0\0\142\315\367\367\315\140\0\0\0\0\133"
-    "\331\371\335\203\11\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\2\377\373\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\73\377\211\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\212\341\13\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\331\116\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\5\361"
-    "\361\5\0\0\0\0\377\377\377\377\365\315\157\2\0\0\0\0\121\277\360\370"
-    "\306\120\0\0\377\377\370\342\254\105\0\0\0\0\377\377\377\377\377\377"
-    "\377\377\0\0\377\377\377\377\377\377\377\377\0\0\0\0\127\303\361\366"
-    "\301\116\0\0\377\0\0\0\0\0\0\377\0\0\0\377\377\377\377\377\0\0\0\0"
-    "\0\0\0\377\377\377\377\0\0\0\377\0\0\0\0\73\355\116\0\0\377\0\0\0"
-    "\0\0\0\0\0\0\377\346\2\0\0\3\347\377\0\0\377\337\5\0\0\0\0\377\0\0"
-    "\0\47\265\363\363\264\46\0\0\0\0\0\111\305\365\351\206\3\0\0\0\0\75"
-    "\312\313\74\0\0\0\0\377\0\0\0\11\60\260\215\0\0\0\201\267\64\10\35"
-    "\224\377\0\0\377\0\6\34\123\307\207\0\0\0\377\0\0\0\0\0\0\0\0\0\377"
-    "\0\0\0\0\0\0\0\0\0\0\206\263\60\7\41\220\376\0\0\377\0\0\0\0\0\0\377"
-    "\0\0\0\0\0\377\0\0\0\0\0\0\0\0\0\0\0\0\377\0\0\0\377\0\0\0\73\354"
-    "\116\0\0\0\377\0\0\0\0\0\0\0\0\0\377\340\104\0\0\107\335\377\0\0\377"
-    "\351\145\0\0\0\0\377\0\0\23\343\150\16\16\150\341\21\0\0\0\135\340"
-    "\112\11\44\310\175\0\0\0\0\200\207\210\200\0\0\0\0\377\0\0\0\0\0\21"
-    "\357\0\0\72\310\4\0\0\0\0\160\0\0\377\0\0\0\0\4\310\103\0\0\377\0"
-    "\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0\0\0\74\305\3\0\0\0\0\154\0\0\377"
-    "\0\0\0\0\0\0\377\0\0\0\0\0\377\0\0\0\0\0\0\0\0\0\0\0\0\377\0\0\0\377"
-    "\0\0\72\354\116\0\0\0\0\377\0\0\0\0\0\0\0\0\0\377\210\237\0\0\243"
-    "\202\377\0\0\377\163\340\5\0\0\0\377\0\0\175\215\0\0\0\0\216\172\0"
-    "\0\27\352\47\0\0\0\54\341\0\0\0\0\304\103\104\303\0\0\0\0\377\0\0"
-    "\0\0\0\32\361\0\0\244\127\0\0\0\0\0\0\0\0\377\0\0\0\0\0\124\252\0"
-    "\0\377\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0\0\0\245\126\0\0\0\0\0\0"
-    "\0\0\377\0\0\0\0\0\0\377\0\0\0\0\0\377\0\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\0\0\0\377\0\71\353\116\0\0\0\0\0\377\0\0\0\0\0\0\0\0\0\377\55\361"
-    "\10\13\363\50\377\0\0\377\11\347\150\0\0\0\377\0\0\304\73\0\0\0\0"
-    "\73\303\0\0\171\226\0\11\264\366\233\375\0\0\0\14\362\10\11\362\13"
-    "\0\0\0\377\0\0\0\11\65\274\240\0\0\337\35\0\0\0\0\0\0\0\0\377\0\0"
-    "\0\0\0\35\341\0\0\377\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0\0\0\340"
-    "\34\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\377\0\0\0\0\0\377\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\377\0\0\0\377\70\361\165\0\0\0\0\0\0\377\0\0\0\0\0\0"
-    "\0\0\0\377\0\322\125\134\315\0\377\0\0\377\0\160\342\6\0\0\377\0\0"
-    "\353\23\0\0\0\0\24\352\0\0\277\105\0\201\247\15\246\377\0\0\0\112"
-    "\274\0\0\275\112\0\0\0\377\377\377\377\377\377\321\15\0\0\370\6\0"
-    "\0\0\0\0\0\0\0\377\0\0\0\0\0\7\367\0\0\377\377\377\377\377\377\377"
-    "\377\0\0\377\377\377\377\377\377\377\0\0\0\370\5\0\0\0\0\0\0\0\0\377"
-    "\377\377\377\377\377\377\377\0\0\0\0\0\377\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\377\0\0\0\377\356\253\325\5\0\0\0\0\0\377\0\0\0\0\0\0\0\0\0\377\0"
-    "\167\260\270\162\0\377\0\0\377\0\10\346\152\0\0\377\0\0\373\4\0\0"
-    "\0\0\5\372\0\0\351\30\0\326\55\0\56\377\0\0\0\216\171\0\0\172\215"
-    "\0\0\0\377\0\0\0\14\103\326\202\0\0\370\6\0\0\0\0\0\0\0\0\377\0\0"
-    "\0\0\0\6\370\0\0\377\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0\0\0\371\6"
-    "\0\0\0\377\377\377\0\0\377\0\0\0\0\0\0\377\0\0\0\0\0\377\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\377\0\0\0\377\127\0\273\173\0\0\0\0\0\377\0\0\0\0\0"
-    "\0\0\0\0\377\0\36\370\371\32\0\377\0\0\377\0\0\155\344\7\0\377\0\0"
-    "\373\4\0\0\0\0\5\372\0\0\372\5\0\371\6\0\6\377\0\0\0\321\65\0\0\66"
-    "\320\0\0\0\377\0\0\0\0\0\63\334\0\0\340\35\0\0\0\0\0\0\0\0\377\0\0"
-    "\0\0\0\34\342\0\0\377\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0\0\0\342"
-    "\35\0\0\0\0\0\377\0\0\377\0\0\0\0\0\0\377\0\0\0\0\0\377\0\0\0\0\0"
-    "\0\0\0\0\0\0\1\376\0\0\0\377\0\0\40\353\43\0\0\0\0\377\0\0\0\0\0\0"
-    "\0\0\0\377\0\0\301\275\0\0\377\0\0\377\0\0\7\344\155\0\377\0\0\353"
-    "\23\0\0\0\0\24\352\0\0\370\7\0\371\6\0\6\377\0\0\25\376\377\377\377"
-    "\377\376\25\0\0\377\0\0\0\0\0\5\371\0\0\246\126\0\0\0\0\0\0\0\0\377"
-    "\0\0\0\0\0\124\253\0\0\377\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0\0\0"
-    "\254\126\0\0\0\0\0\377\0\0\377\0\0\0\0\0\0\377\0\0\0\0\0\377\0\0\0"
-    "\0\0\0\0\0\0\0\0\15\361\0\0\0\377\0\0\0\155\272\0\0\0\0\377\0\0\0"
-    "\0\0\0\0\0\0\377\0\0\0\0\0\0\377\0\0\377\0\0\0\152\345\10\377\0\0"
-    "\305\72\0\0\0\0\72\303\0\0\344\35\0\326\54\0\55\377\0\0\130\256\0"
-    "\0\0\0\257\127\0\0\377\0\0\0\0\0\45\344\0\0\76\307\3\0\0\0\0\156\0"
-    "\0\377\0\0\0\0\4\307\105\0\0\377\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0"
-    "\0\0\0\113\307\3\0\0\0\0\377\0\0\377\0\0\0\0\0\0\377\0\0\0\0\0\377"
-    "\0\0\0\0\0\0\172\0\0\0\0\70\310\0\0\0\377\0\0\0\2\304\133\0\0\0\377"
-    "\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\377\0\0\377\0\0\0\6\342\160\377"
-    "\0\0\177\215\0\0\0\0\214\172\0\0\264\122\0\201\245\14\245\377\0\0"
-    "\233\153\0\0\0\0\154\232\0\0\377\0\0\0\11\70\305\174\0\0\0\210\265"
-    "\63\7\33\220\377\0\0\377\0\5\33\123\307\212\0\0\0\377\0\0\0\0\0\0"
-    "\0\0\0\377\0\0\0\0\0\0\0\0\0\0\243\270\67\10\12\114\377\0\0\377\0"
-    "\0\0\0\0\0\377\0\0\0\0\0\377\0\0\0\0\0\0\377\252\61\4\40\277\151\0"
-    "\0\0\377\0\0\0\0\47\341\21\0\0\377\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0"
-    "\0\377\0\0\377\0\0\0\0\147\347\377\0\0\25\345\147\16\16\146\340\21"
-    "\0\0\145\260\0\11\264\367\232\377\0\0\336\51\0\0\0\0\51\336\0\0\377"
-    "\377\377\377\366\315\152\1\0\0\0\0\126\302\361\370\306\121\0\0\377"
-    "\377\371\344\255\107\0\0\0\0\377\377\377\377\377\377\377\377\0\0\377"
-    "\0\0\0\0\0\0\0\0\0\0\3\160\323\370\362\302\134\0\0\377\0\0\0\0\0\0"
-    "\377\0\0\0\377\377\377\377\377\0\0\0\0\104\264\357\372\332\164\1\0"
-    "\0\0\377\0\0\0\0\0\170\233\0\0\377\377\377\377\377\377\377\377\0\0"
-    "\377\0\0\0\0\0\0\377\0\0\377\0\0\0\0\5\337\377\0\0\0\52\267\363\363"
-    "\265\46\0\0\0\11\337\114\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\66\351\164\30\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\43\243\350\373\307\1\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\376\360\302\127\0\0\0\0"
-    "\47\265\363\363\263\45\0\0\0\377\377\377\376\355\271\111\0\0\0\0\127"
-    "\312\367\360\261\103\0\0\377\377\377\377\377\377\377\377\377\0\0\377"
-    "\0\0\0\0\0\0\377\0\0\337\51\0\0\0\0\51\336\0\355\27\0\0\0\0\0\0\27"
-    "\354\0\273\146\0\0\0\0\147\273\0\263\171\0\0\0\0\0\171\262\0\0\377"
-    "\377\377\377\377\377\377\377\0\0\0\0\0\377\377\377\0\0\0\0\305\73"
-    "\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\4\257\377\257\4\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\377\0\0\1\22\127\345\150\0\0\23\343\150\16"
-    "\16\150\340\20\0\0\377\0\0\1\24\131\344\131\0\0\145\311\64\5\42\240"
-    "\377\0\0\0\0\0\0\377\0\0\0\0\0\0\377\0\0\0\0\0\0\377\0\0\234\153\0"
-    "\0\0\0\154\233\0\306\75\0\0\0\0\0\0\76\305\0\63\341\7\0\0\5\337\63"
-    "\0\41\354\35\0\0\0\36\354\40\0\0\0\0\0\0\0\0\144\320\0\0\0\0\0\377"
-    "\0\0\0\0\0\0\117\261\0\0\0\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\1\243"
-    "\354\144\355\243\1\0\0\0\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\74\334\0"
-    "\0\175\215\0\0\0\0\216\170\0\0\377\0\0\0\0\0\74\326\0\0\336\41\0\0"
-    "\0\0\171\0\0\0\0\0\0\377\0\0\0\0\0\0\377\0\0\0\0\0\0\377\0\0\131\256"
-    "\0\0\0\0\257\131\0\237\143\0\0\0\0\0\0\145\237\0\0\250\157\0\0\144"
-    "\251\0\0\0\175\255\0\0\0\256\174\0\0\0\0\0\0\0\0\46\352\51\0\0\0\0"
-    "\0\377\0\0\0\0\0\0\1\325\50\0\0\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0"
-    "\225\345\53\0\53\346\225\0\0\0\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\7\372"
-    "\0\0\304\73\0\0\0\0\73\301\0\0\377\0\0\0\0\0\6\372\0\0\372\10\0\0"
-    "\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\377\0\0\0\0\0\0\377\0\0\27\355"
-    "\2\0\0\2\355\27\0\171\211\0\0\257\256\0\0\213\170\0\0\44\343\12\4"
-    "\330\45\0\0\0\7\333\107\0\110\332\7\0\0\0\0\0\0\0\5\315\147\0\0\0"
-    "\0\0\0\377\0\0\0\0\0\0\0\143\235\0\0\0\0\0\0\0\0\0\0\0\377\0\0\0\0"
-    "\0\207\336\42\0\0\0\42\336\207\0\0\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0"
-    "\74\335\0\0\353\23\0\0\0\0\24\350\0\0\377\0\0\0\0\0\63\343\0\0\313"
-    "\165\0\0\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\377\0\0\0\0\0\0\377\0\0"
-    "\0\324\63\0\0\64\323\0\0\122\257\0\1\347\346\0\0\262\121\0\0\0\225"
-    "\170\140\227\0\0\0\0\0\107\332\17\333\106\0\0\0\0\0\0\0\0\213\256"
-    "\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0\6\337\31\0\0\0\0\0\0\0\0\0\0\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\0\0\0\21\127"
-    "\345\153\0\0\373\4\0\0\0\0\5\371\0\0\377\0\0\0\17\113\331\167\0\0"
-    "\57\337\322\204\131\34\0\0\0\0\0\0\0\377\0\0\0\0\0\0\377\0\0\0\0\0"
-    "\0\377\0\0\0\221\166\0\0\167\221\0\0\53\325\0\54\306\307\52\0\331"
-    "\53\0\0\0\35\355\334\37\0\0\0\0\0\0\254\327\253\0\0\0\0\0\0\0\0\104"
-    "\342\22\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0\0\167\211\0\0\0\0\0\0\0\0"
-    "\0\0\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\377\362\304\133\0\0\0\372\4\0\0\0\0\5\374\0\0\377\375\366\361"
-    "\374\376\177\0\0\0\0\5\113\205\256\353\261\26\0\0\0\0\0\377\0\0\0"
-    "\0\0\0\377\0\0\0\0\0\0\377\0\0\0\117\270\0\0\271\116\0\0\7\365\2\152"
-    "\204\205\150\4\367\7\0\0\0\141\327\352\144\0\0\0\0\0\0\34\377\34\0"
-    "\0\0\0\0\0\0\23\343\101\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0\0\17\342"
-    "\16\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\377\0\0\0\0\0\0\0\0\0\352\23\0\0\0\0\24\361\0\0\377\0\0"
-    "\0\6\137\355\47\0\0\0\0\0\0\0\6\220\265\0\0\0\0\0\377\0\0\0\0\0\0"
-    "\377\0\0\0\0\0\0\377\0\0\0\17\361\6\6\362\17\0\0\0\336\41\250\103"
-    "\104\246\46\335\0\0\0\2\330\130\162\332\2\0\0\0\0\0\0\377\0\0\0\0"
-    "\0\0\0\0\260\207\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0\0\0\212\166\0"
-    "\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\377\0\0\0\0\0\0\0\0\0\303\72\0\0\0\0\72\326\0\0\377\0\0\0\0\0"
-    "\163\260\0\0\0\0\0\0\0\0\14\370\0\0\0\0\0\377\0\0\0\0\0\0\367\1\0"
-    "\0\0\0\1\367\0\0\0\0\311\76\77\311\0\0\0\0\267\110\335\10\11\334\115"
-    "\267\0\0\0\125\326\2\10\344\126\0\0\0\0\0\0\377\0\0\0\0\0\0\0\151"
-    "\312\5\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0\0\0\32\337\6\0\0\0\0\0"
-    "\0\0\0\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\0"
-    "\0\0\0\0\0\0\0\0\173\215\0\0\0\0\214\242\0\0\377\0\0\0\0\0\7\354\32"
-    "\0\216\3\0\0\0\0\43\344\0\0\0\0\0\377\0\0\0\0\0\0\327\31\0\0\0\0\33"
-    "\327\0\0\0\0\207\200\201\206\0\0\0\0\221\222\277\0\0\300\225\220\0"
-    "\0\0\316\131\0\0\150\317\0\0\0\0\0\0\377\0\0\0\0\0\0\52\351\43\0\0"
-    "\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0\0\0\0\236\142\0\0\0\0\0\0\0\0\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0"
-    "\0\0\0\22\341\147\16\16\146\372\107\0\0\377\0\0\0\0\0\0\232\164\0"
-    "\377\312\117\17\10\74\314\166\0\0\0\0\0\377\0\0\0\0\0\0\152\301\66"
-    "\10\10\67\302\154\0\0\0\0\104\303\304\103\0\0\0\0\152\356\176\0\0"
-    "\177\360\151\0\0\111\327\2\0\0\5\336\111\0\0\0\0\0\377\0\0\0\0\0\0"
-    "\320\137\0\0\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0\0\0\0\51\324\1\0"
-    "\0\0\0\0\0\0\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\377\0\0\0\0\0\0\0\0\0\0\45\261\362\377\377\241\0\0\0\377\0\0\0\0"
-    "\0\0\76\321\0\75\244\343\373\362\304\136\0\0\0\0\0\0\377\0\0\0\0\0"
-    "\0\0\136\313\367\367\313\136\0\0\0\0\0\11\362\362\10\0\0\0\0\103\377"
-    "\74\0\0\75\377\103\0\0\303\133\0\0\0\0\136\303\0\0\0\0\0\377\0\0\0"
-    "\0\0\0\377\377\377\377\377\377\377\377\0\0\0\0\0\377\0\0\0\0\0\0\0"
-    "\0\0\0\0\262\116\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\45\327\347\41\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0"
-    "\0\0\0\0\0\0\73\304\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\17\263\116\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377"
-    "\377\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\214\354\37\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\1\242\313\7\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\122\344\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\377\0\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\377\0\0\0\0\0\0\0\0"
-    "\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\4\267\234\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\341\105\2\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\376\1\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\103\261\357"
-    "\371\332\204\7\0\0\377\120\313\370\361\264\56\0\0\0\0\37\240\346\371"
-    "\320\127\0\0\0\0\55\262\360\370\316\122\377\0\0\0\41\246\354\370\313"
-    "\106\0\0\0\0\377\377\377\377\377\377\0\0\0\0\51\261\361\367\312\111"
-    "\377\0\0\377\57\256\352\373\344\214\10\0\0\0\377\377\377\0\0\0\0\0"
-    "\0\0\0\377\377\377\0\0\0\0\0\377\0\0\0\36\322\141\0\0\0\0\0\0\377"
-    "\0\0\0\0\0\0\377\261\367\212\304\364\135\0\0\0\377\57\256\352\373"
-    "\344\214\10\0\0\0\101\302\365\365\301\77\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\277\130\31\3\34\232\243\0\0\377\360\132\15\14\131\345\51\0\0\37"
-    "\341\153\23\6\62\252\0\0\0\51\344\130\14\16\135\361\377\0\0\36\345"
-    "\165\24\10\110\342\72\0\0\0\0\0\377\0\0\0\0\0\0\43\342\137\17\13\126"
-    "\354\377\0\0\377\342\136\22\4\53\275\221\0\0\0\0\0\377\0\0\0\0\0\0"
-    "\0\0\0\0\377\0\0\0\0\0\377\0\0\56\340\130\0\0\0\0\0\0\0\377\0\0\0"
-    "\0\0\0\377\112\112\377\114\107\320\0\0\0\377\342\136\22\4\53\275\221"
-    "\0\0\72\354\130\14\15\132\354\67\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\14\361\0\0\377\150\0\0\0\0\150\250\0\0\240\162\0\0\0\0\0\0\0\0"
-    "\251\145\0\0\0\0\152\377\0\0\237\173\0\0\0\0\123\264\0\0\0\0\0\377"
-    "\0\0\0\0\0\0\243\151\0\0\0\0\145\377\0\0\377\120\0\0\0\0\42\350\0"
-    "\0\0\0\0\377\0\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\377\0\101\352\120\0"
-    "\0\0\0\0\0\0\0\377\0\0\0\0\0\0\377\14\13\377\14\13\362\0\0\0\377\120"
-    "\0\0\0\0\42\350\0\0\263\145\0\0\0\0\150\261\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\1\153\311\363\377\377\377\377\0\0\377\27\0\0\0\0\30\351\0\0\347"
-    "\32\0\0\0\0\0\0\0\0\352\27\0\0\0\0\31\377\0\0\347\31\0\0\0\0\16\355"
-    "\0\0\0\0\0\377\0\0\0\0\0\0\350\27\0\0\0\0\27\377\0\0\377\10\0\0\0"
-    "\0\1\376\0\0\0\0\0\377\0\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\377\127\360"
-    "\225\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\377\0\1\377\0\1\375\0\0\0\377"
-    "\10\0\0\0\0\1\376\0\0\354\27\0\0\0\0\30\352\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\211\312\104\20\1\0\4\377\0\0\377\3\0\0\0\0\4\373\0\0\373\4\0\0"
-    "\0\0\0\0\0\0\374\3\0\0\0\0\4\377\0\0\373\377\377\377\377\377\377\376"
-    "\0\0\0\0\0\377\0\0\0\0\0\0\374\3\0\0\0\0\4\377\0\0\377\0\0\0\0\0\0"
-    "\377\0\0\0\0\0\377\0\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\377\235\33\332"
-    "\117\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\377\0\0\377\0\0\377\0\0\0\377"
-    "\0\0\0\0\0\0\377\0\0\374\3\0\0\0\0\4\373\0\0\0\0\0\0\0\0\0\0\0\0\355"
-    "\35\0\0\0\0\45\377\0\0\377\27\0\0\0\0\30\347\0\0\347\32\0\0\0\0\0"
-    "\0\0\0\351\26\0\0\0\0\31\377\0\0\345\5\0\0\0\0\0\0\0\0\0\0\0\377\0"
-    "\0\0\0\0\0\350\31\0\0\0\0\30\377\0\0\377\0\0\0\0\0\0\377\0\0\0\0\0"
-    "\377\0\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\377\0\0\47\343\67\0\0\0\0\0"
-    "\0\0\377\0\0\0\0\0\0\377\0\0\377\0\0\377\0\0\0\377\0\0\0\0\0\0\377"
-    "\0\0\354\27\0\0\0\0\30\353\0\0\0\0\0\0\0\0\0\0\0\0\364\22\0\0\0\0"
-    "\220\377\0\0\377\147\0\0\0\0\146\245\0\0\241\163\0\0\0\0\0\0\0\0\246"
-    "\143\0\0\0\0\152\377\0\0\236\122\0\0\0\0\0\0\0\0\0\0\0\377\0\0\0\0"
-    "\0\0\244\154\0\0\0\0\146\377\0\0\377\0\0\0\0\0\0\377\0\0\0\0\0\377"
-    "\0\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\377\0\0\0\75\343\43\0\0\0\0\0\0"
-    "\370\14\0\0\0\0\0\377\0\0\377\0\0\377\0\0\0\377\0\0\0\0\0\0\377\0"
-    "\0\264\145\0\0\0\0\150\262\0\0\0\0\0\0\0\0\0\0\0\0\236\254\41\4\41"
-    "\215\354\377\0\0\377\360\132\14\13\127\342\47\0\0\40\343\153\23\5"
-    "\57\246\0\0\0\47\341\126\13\15\134\361\377\0\0\34\325\142\24\4\40"
-    "\143\307\0\0\0\0\0\377\0\0\0\0\0\0\44\345\141\17\12\125\350\377\0"
-    "\0\377\0\0\0\0\0\0\377\0\0\0\0\0\377\0\0\0\0\0\0\0\0\0\0\377\0\0\0"
-    "\0\0\377\0\0\0\0\130\331\24\0\0\0\0\0\305\156\1\0\0\0\0\377\0\0\377"
-    "\0\0\377\0\0\0\377\0\0\0\0\0\0\377\0\0\74\355\130\14\14\131\355\71"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\10\213\343\374\353\254\47\377\0\0\377\122"
-    "\316\371\361\262\54\0\0\0\0\41\242\350\372\322\130\0\0\0\0\54\262"
-    "\361\371\315\121\377\0\0\0\31\227\341\372\352\251\77\0\0\0\0\0\377"
-    "\0\0\0\0\0\0\0\53\262\362\367\312\104\375\0\0\377\0\0\0\0\0\0\377"
-    "\0\0\377\377\377\377\377\377\377\0\0\0\0\0\0\0\377\0\0\0\0\0\377\0"
-    "\0\0\0\0\167\306\11\0\0\0\0\64\333\377\377\0\0\0\377\0\0\377\0\0\377"
-    "\0\0\0\377\0\0\0\0\0\0\377\0\0\0\104\304\366\366\303\102\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\41\336\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\10\367\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\301\125\23\4\54\274\161\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\135\310\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\112\276\366\366\314\144\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\377\377\346\75\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\130"
-    "\342\375\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0\375\341\130\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\336\115\2\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0\2\120\335\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\374\4\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0\0\5\373\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\121\315\367\360\263\54"
-    "\0\0\0\0\54\262\360\367\315\120\377\0\0\0\0\377\26\247\357\353\160"
-    "\0\0\6\167\314\363\374\346\251\101\0\0\377\377\377\377\377\377\0\0"
-    "\0\0\377\0\0\0\0\0\0\377\0\0\324\73\0\0\0\0\74\324\0\342\44\0\0\0"
-    "\0\0\0\41\343\0\232\240\0\0\0\0\237\231\0\0\314\106\0\0\0\0\74\322"
-    "\0\0\377\377\377\377\377\377\377\377\0\0\0\0\0\377\0\0\0\0\0\0\0\0"
-    "\0\377\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\377\360\132\15\14\127\342\46\0\0\47\342\127\14\15\133"
-    "\360\377\0\0\0\0\377\272\132\13\30\225\0\0\251\213\42\5\7\45\145\306"
-    "\0\0\0\0\377\0\0\0\0\0\0\0\377\0\0\0\0\0\0\377\0\0\175\223\0\0\0\0"
-    "\224\174\0\246\134\0\0\12\40\0\0\124\252\0\6\306\140\0\0\134\306\6"
-    "\0\0\144\253\0\0\0\0\224\167\0\0\0\0\0\0\0\0\101\271\0\0\0\0\0\377"
-    "\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\150\0\0\0\0\145\245\0\0\246\145"
-    "\0\0\0\0\150\377\0\0\0\0\377\155\0\0\0\0\0\0\370\14\0\0\0\0\0\0\0"
-    "\0\0\0\377\0\0\0\0\0\0\0\377\0\0\0\0\0\0\377\0\0\45\347\2\0\0\3\350"
-    "\44\0\151\224\0\0\311\333\0\0\207\161\0\0\31\333\52\47\332\31\0\0"
-    "\0\13\353\26\0\0\3\346\36\0\0\0\0\0\0\0\127\256\12\0\0\0\0\13\371"
-    "\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0\0\0\372\12\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\27\0\0\0\0\27\347\0\0\350\27"
-    "\0\0\0\0\30\377\0\0\0\0\377\33\0\0\0\0\0\0\314\265\112\21\0\0\0\0"
-    "\0\0\0\0\377\0\0\0\0\0\0\0\377\0\0\0\0\0\0\377\0\0\0\316\102\0\0\103"
-    "\315\0\0\55\314\0\35\273\307\56\0\272\70\0\0\0\72\316\312\71\0\0\0"
-    "\0\0\224\165\0\0\103\302\0\0\0\0\0\0\0\157\236\4\0\0\0\0\3\153\315"
-    "\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0\0\0\315\153\3\0\0\0\0\153\337"
-    "\371\306\136\17\36\237\0\0\0\0\0\0\0\0\0\0\0\0\377\3\0\0\0\0\4\373"
-    "\0\0\374\3\0\0\0\0\4\377\0\0\0\0\377\2\0\0\0\0\0\0\36\244\353\377"
-    "\341\300\204\21\0\0\0\0\377\0\0\0\0\0\0\0\377\0\0\0\0\0\0\377\0\0"
-    "\0\166\232\0\0\233\165\0\0\1\351\11\155\145\165\200\0\345\6\0\0\0"
-    "\0\301\301\0\0\0\0\0\0\54\331\0\0\232\147\0\0\0\0\0\1\210\210\0\0"
-    "\0\0\0\0\377\376\114\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0\0\0\112\376"
-    "\377\0\0\0\0\235\37\10\110\257\364\342\153\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\377\27\0\0\0\0\27\351\0\0\352\26\0\0\0\0\30\377\0\0\0\0\377\0\0\0"
-    "\0\0\0\0\0\0\0\13\57\147\315\302\0\0\0\0\377\0\0\0\0\0\0\0\376\1\0"
-    "\0\0\0\11\377\0\0\0\40\353\4\5\354\37\0\0\0\264\74\271\23\42\321\40"
-    "\306\0\0\0\0\154\232\233\153\0\0\0\0\0\0\303\77\5\347\22\0\0\0\0\5"
-    "\240\157\0\0\0\0\0\0\0\3\146\314\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0"
-    "\0\0\0\314\145\3\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\147\0\0\0\0\144\250\0\0\251\143\0\0\0\0\150\377\0\0\0\0\377\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\20\366\0\0\0\0\373\6\0\0\0\0\0\0\351\41\0\0\0"
-    "\0\120\377\0\0\0\0\307\111\112\306\0\0\0\0\167\206\263\0\0\317\166"
-    "\215\0\0\0\60\327\14\15\330\57\0\0\0\0\0\133\244\111\261\0\0\0\0\13"
-    "\261\127\0\0\0\0\0\0\0\0\0\10\371\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0"
-    "\0\0\0\0\371\7\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\360\132\14\13\125\342\51\0\0\51\342\125\13\14\132\357\377\0\0\0\0"
-    "\377\0\0\0\0\0\0\0\315\163\61\13\3\44\233\241\0\0\0\0\327\135\2\0"
-    "\0\0\0\0\225\274\52\4\21\133\340\377\0\0\0\0\160\241\242\157\0\0\0"
-    "\0\73\363\141\0\0\174\355\124\0\0\14\327\77\0\0\100\326\13\0\0\0\0"
-    "\7\343\262\124\0\0\0\0\275\103\0\0\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0"
-    "\0\0\0\0\377\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\377\123\317\370\361\264\56\0\0\0\0\56\264\361"
-    "\370\315\117\377\0\0\0\0\377\0\0\0\0\0\0\0\70\233\337\373\364\314"
-    "\164\5\0\0\0\0\114\341\376\377\0\0\0\0\12\221\346\374\353\255\56\377"
-    "\0\0\0\0\32\356\357\31\0\0\0\0\6\361\20\0\0\51\377\34\0\0\242\217"
-    "\0\0\0\0\217\241\0\0\0\0\0\212\360\10\0\0\0\0\377\377\377\377\377"
-    "\377\377\377\0\0\0\0\0\377\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0\0\0"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\166\233\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\374\4\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0"
-    "\0\5\373\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\51\346\63\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\336\113\1\0\0\0\0\0\0\0\377\0\0\0\0"
-    "\0\0\0\1\117\335\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\357\163"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\133\343\376\0\0\0\0\0\0\0\377"
-    "\0\0\0\0\0\0\0\375\343\132\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\377\377\0\0\0\0\0\0\377\377\0\0\377\377\0\0\0\0\0\61\377\236\0\275"
-    "\376\27\0\0\0\0\377\0\0\0\0\0\42\305\371\303\40\0\0\0\0\0\0\0\20\227"
-    "\345\373\325\130\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\33\362\275\0"
-    "\0\0\0\0\275\362\32\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\73\377\304\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0"
-    "\0\0\0\0\377\377\0\0\377\377\0\0\0\0\0\162\377\133\7\367\322\0\0\0"
-    "\0\0\377\0\0\0\0\0\306\170\14\170\303\0\0\0\0\0\0\0\262\377\377\377"
-    "\377\377\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\235\377\100\0\0\0\0\0"
-    "\102\377\233\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\262\377\116\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0"
-    "\377\377\0\0\377\377\0\0\0\0\0\263\377\31\77\377\216\0\0\24\243\356"
-    "\377\377\377\0\0\0\372\13\0\14\371\0\0\0\0\0\0\0\370\377\76\6\55\250"
-    "\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\31\372\326\0\0\0\0\0\0\0\331\371"
-    "\27\0\0\0\0\0\260\215\33\377\33\215\260\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\51\376\326\1\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0"
-    "\377\377\0\0\377\377\0\0\20\377\377\377\377\377\377\377\377\377\0"
-    "\266\377\377\377\377\377\0\0\0\306\166\13\166\305\0\0\0\0\0\0\0\324"
-    "\377\75\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\162\377\202\0\0\0"
-    "\0\0\0\0\205\377\156\0\0\0\0\0\41\222\355\377\357\224\42\0\0\0\0\0"
-    "\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\236\377\142\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\20\377\377\377\377\377\377\377"
-    "\377\377\0\371\377\53\377\0\0\0\0\0\44\306\372\305\42\0\63\224\145"
-    "\0\0\0\110\377\332\17\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\267\377\110"
-    "\0\0\0\0\0\0\0\105\377\265\0\0\0\0\0\41\221\354\377\355\223\41\0\0"
-    "\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\32\371\345\6\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\370\370\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\156\377\136\5\360\331"
-    "\0\0\0\334\377\274\377\74\2\0\0\0\0\0\0\6\133\240\157\17\0\0\0\3\242"
-    "\377\377\265\2\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\344\377\33\0\0\0\0"
-    "\0\0\0\32\377\343\0\0\0\0\0\260\215\31\377\31\215\260\0\0\0\0\0\0"
-    "\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\212\377\166\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\341"
-    "\341\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\272\375\24\102\377\213\0\0\0"
-    "\104\355\377\377\377\322\36\0\0\0\32\176\231\105\1\0\0\0\0\0\170\377"
-    "\211\366\377\213\0\377\373\0\0\0\0\0\0\0\0\0\0\0\0\0\373\377\10\0"
-    "\0\0\0\0\0\0\4\377\372\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\377\377\377"
-    "\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\17\361\360\16\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\310\313\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377"
-    "\377\377\20\0\0\14\125\377\337\377\264\0\0\137\202\37\0\42\305\371"
-    "\303\40\0\0\337\377\3\126\376\377\136\377\340\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\373\377\11\0\0\0\0\0\0\0\4\377\372\0\0\0\0\0\0\0\0\377\0\0"
-    "\0\0\0\0\377\377\377\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\167\377\211\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\377\377\377\377\377\377\377\377\377\20\0\0\0\0\377\30\377\365\0\0"
-    "\0\0\0\0\306\166\14\176\303\0\0\373\377\34\0\176\377\370\377\217\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\344\377\34\0\0\0\0\0\0\0\33\377\343\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\6\346\371\31"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\161\377\133\5\363\323\0\0\0\0\275\116\17\377\104\377\356\0\0"
-    "\0\0\0\0\372\13\0\15\371\0\0\327\377\266\31\26\336\377\351\20\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\267\377\111\0\0\0\0\0\0\0\106\377\265\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\377\377\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\143\377\235\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\262\377\31\72\377\221\0\0\0\0\377\377\377\377\377\377\225"
-    "\0\0\0\0\0\0\306\163\13\173\304\0\0\130\377\377\377\377\377\377\376"
-    "\60\0\0\0\0\0\0\0\0\0\0\0\0\0\162\377\203\0\0\0\0\0\0\0\207\377\156"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\1\327\376\50"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\3\360\330\0\173\377\120\0\0\0\0\101\256\357\377\354\221\10"
-    "\0\0\0\0\0\0\44\306\372\304\41\0\0\0\121\311\370\365\275\262\377\272"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\31\372\327\0\0\0\0\0\0\0\332\371\27\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\45\377\332\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\117\377\261\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\3\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\234\377\101\0\0\0\0"
-    "\0\102\377\232\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\175\377\203\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\305\377\73\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\1\377\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\32"
-    "\362\275\0\0\0\0\0\275\362\32\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\324\377\53\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\44\263\363"
-    "\363\263\44\0\0\0\0\75\270\377\377\0\0\0\0\0\72\236\340\373\356\273"
-    "\114\0\0\0\73\237\341\373\356\274\120\0\0\0\0\0\0\3\311\377\377\0"
-    "\0\0\377\377\377\377\377\377\377\0\0\0\0\13\206\334\371\330\132\0"
-    "\0\0\377\377\377\377\377\377\377\377\0\0\0\137\313\367\367\313\137"
-    "\0\0\0\0\123\316\370\357\260\50\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\102\255\352\373\342\214\12\0\0\0\20\344\377\377\377\377\344"
-    "\20\0\0\0\377\377\377\377\0\0\0\0\0\377\377\377\377\377\377\377\146"
-    "\0\0\377\377\377\377\377\377\377\153\0\0\0\0\0\170\377\377\377\0\0"
-    "\0\377\377\377\377\377\377\377\0\0\0\3\303\377\377\377\377\377\0\0"
-    "\0\377\377\377\377\377\377\377\372\0\0\162\377\377\377\377\377\377"
-    "\161\0\0\116\377\377\377\377\377\352\26\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\377\377\377\377\377\377\244\0\0\0\171\377\310\32\33\313"
-    "\377\171\0\0\0\300\100\377\377\0\0\0\0\0\313\154\50\6\31\222\377\341"
-    "\0\0\307\146\42\5\30\217\377\344\0\0\0\0\52\370\301\377\377\0\0\0"
-    "\377\377\0\0\0\0\0\0\0\0\142\377\340\75\6\52\251\0\0\0\0\0\0\0\0\224"
-    "\377\236\0\0\344\377\203\21\21\204\377\343\0\0\304\377\230\21\17\230"
-    "\377\202\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\277\125\26\6\117\377"
-    "\365\0\0\0\302\377\110\0\0\113\377\302\0\0\0\0\0\377\377\0\0\0\0\0"
-    "\0\0\0\0\0\12\377\360\0\0\0\0\0\0\0\11\377\370\0\0\0\3\311\364\42"
-    "\377\377\0\0\0\377\377\0\0\0\0\0\0\0\0\270\377\116\0\0\0\0\0\0\0\0"
-    "\0\0\0\25\366\376\50\0\0\371\377\7\0\0\10\377\370\0\0\364\377\20\0"
-    "\0\20\377\307\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\17\152\316\0\0\0\0\0\0\0\0\0\0\0\0\315\151\17\0\0\0\0\0\0\0\0\0"
-    "\0\0\45\377\342\0\0\0\352\377\25\0\0\27\377\351\0\0\0\0\0\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\102\377\237\0\0\0\0\0\0\25\207\377\274\0\0\0"
-    "\170\377\151\0\377\377\0\0\0\377\377\345\374\345\237\40\0\0\0\347"
-    "\377\155\334\372\334\155\0\0\0\0\0\0\0\202\377\256\0\0\0\273\377\203"
-    "\20\21\205\377\267\0\0\372\377\17\0\0\20\377\353\0\0\0\0\0\377\377"
-    "\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\76\242\366\377\372\0\0\377"
-    "\377\377\377\377\377\377\377\0\0\372\377\366\241\75\0\0\0\0\0\0\0"
-    "\0\17\316\377\146\0\0\0\372\377\3\305\304\4\377\372\0\0\0\0\0\377"
-    "\377\0\0\0\0\0\0\0\0\0\36\341\355\34\0\0\0\0\377\377\377\377\271\33"
-    "\0\0\52\370\272\0\0\377\377\0\0\0\377\377\377\377\377\377\356\50\0"
-    "\0\372\377\377\377\377\377\377\147\0\0\0\0\0\13\355\377\66\0\0\0\27"
-    "\264\377\377\377\377\263\25\0\0\324\377\227\20\17\227\377\372\0\0"
-    "\0\0\0\377\377\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\27\166\331\377\376"
-    "\304\151\23\0\0\377\377\377\377\377\377\377\377\0\0\23\151\304\376"
-    "\377\330\165\26\0\0\0\0\13\311\377\231\0\0\0\0\372\377\3\307\305\4"
-    "\377\372\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\47\341\367\100\0\0\0\0"
-    "\0\377\377\377\377\327\55\0\0\311\361\35\0\0\377\377\0\0\0\271\112"
-    "\17\7\71\310\377\263\0\0\373\377\225\17\21\233\377\323\0\0\0\0\0\160"
-    "\377\277\0\0\0\0\42\321\377\377\377\377\322\41\0\0\151\377\377\377"
-    "\377\377\377\371\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\377\377\0\0\0\0"
-    "\0\372\377\325\172\40\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\40\172\325"
-    "\377\372\0\0\0\0\242\377\211\1\0\0\0\0\352\377\25\0\0\27\377\351\0"
-    "\0\0\0\0\377\377\0\0\0\0\0\0\0\67\354\370\110\0\0\0\0\0\0\0\0\30\224"
-    "\377\305\0\0\377\377\377\377\377\377\377\377\0\0\0\0\0\0\0\33\377"
-    "\363\0\0\354\377\17\0\0\20\377\371\0\0\0\0\5\342\377\107\0\0\0\0\302"
-    "\377\210\22\22\212\377\277\0\0\0\161\336\373\340\166\377\345\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\374\377\315\162\32\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\32\162\315\377\374\0\0\0\0\367\377\15"
-    "\0\0\0\0\0\302\377\110\0\0\113\377\302\0\0\0\0\0\377\377\0\0\0\0\0"
-    "\0\113\365\367\107\0\0\0\0\0\0\0\0\0\0\12\377\371\0\0\377\377\377"
-    "\377\377\377\377\377\0\0\0\0\0\0\0\27\377\362\0\0\307\377\17\0\0\20"
-    "\377\363\0\0\0\0\137\377\316\0\0\0\0\0\372\377\10\0\0\11\377\371\0"
-    "\0\0\0\0\0\0\116\377\267\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\31\172\334\377\375\275\143\20\0\0\377\377\377\377\377\377\377\377"
-    "\0\0\20\143\276\375\377\333\171\31\0\0\0\0\377\377\0\0\0\0\0\0\171"
-    "\377\310\32\32\312\377\171\0\0\0\0\0\377\377\0\0\0\0\0\143\373\367"
-    "\105\0\0\0\0\0\0\277\127\34\4\27\205\377\346\0\0\0\0\0\0\0\377\377"
-    "\0\0\0\267\107\16\5\57\272\377\265\0\0\203\377\224\17\20\232\377\301"
-    "\0\0\0\1\324\377\127\0\0\0\0\0\345\377\206\21\22\212\377\344\0\0\0"
-    "\247\50\5\74\341\377\141\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\377\377"
-    "\0\0\0\0\0\0\0\1\101\244\367\377\370\0\0\377\377\377\377\377\377\377"
-    "\377\0\0\370\377\366\244\100\1\0\0\0\0\0\0\0\0\0\0\0\0\0\0\20\344"
-    "\377\377\377\377\346\21\0\0\377\377\377\377\377\377\377\377\0\0\377"
-    "\377\377\377\377\377\377\377\4\0\377\377\377\377\377\377\377\170\0"
-    "\0\0\0\0\0\0\377\377\0\0\0\377\377\377\377\377\377\357\53\0\0\30\354"
-    "\377\377\377\377\377\113\0\0\0\115\377\334\3\0\0\0\0\0\175\377\377"
-    "\377\377\377\377\172\0\0\0\377\377\377\377\377\303\3\0\0\0\0\0\377"
-    "\377\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\20\153\316\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\316\153\20\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0"
-    "\0\0\45\263\363\363\264\46\0\0\0\377\377\377\377\377\377\377\377\0"
-    "\0\377\377\377\377\377\377\377\377\4\0\100\252\346\374\361\303\136"
-    "\0\0\0\0\0\0\0\0\377\377\0\0\0\101\255\353\373\343\237\42\0\0\0\0"
-    "\52\262\360\371\316\121\0\0\0\0\304\377\147\0\0\0\0\0\0\1\155\322"
-    "\370\370\321\153\1\0\0\0\131\331\371\334\206\13\0\0\0\0\0\0\377\377"
-    "\0\0\0\0\0\0\0\45\377\332\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\175\377\203\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\324\377\53\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\131\377\377\131\0\0\0\0\377\377\377\377\370\324"
-    "\167\3\0\0\0\0\123\274\356\371\317\130\0\0\377\377\372\350\270\133"
-    "\1\0\0\0\377\377\377\377\377\377\377\377\0\0\377\377\377\377\377\377"
-    "\377\377\0\0\0\0\135\303\361\367\302\117\0\0\377\377\0\0\0\0\377\377"
-    "\0\0\0\377\377\377\377\377\377\0\0\0\0\0\0\377\377\377\377\377\0\0"
-    "\377\377\0\0\4\301\377\314\7\0\377\377\0\0\0\0\0\0\0\0\377\377\322"
-    "\0\0\326\377\377\0\0\377\377\256\0\0\0\377\377\0\0\0\42\261\362\362"
-    "\260\41\0\0\0\0\54\251\351\370\312\75\0\0\0\0\0\224\377\377\224\0"
-    "\0\0\0\377\377\377\377\377\377\377\212\0\0\0\213\377\377\377\377\377"
-    "\377\0\0\377\377\377\377\377\377\250\0\0\0\377\377\377\377\377\377"
-    "\377\377\0\0\377\377\377\377\377\377\377\377\0\0\0\224\377\377\377"
-    "\377\377\377\0\0\377\377\0\0\0\0\377\377\0\0\0\377\377\377\377\377"
-    "\377\0\0\0\0\0\0\377\377\377\377\377\0\0\377\377\0\0\211\377\355\37"
-    "\0\0\377\377\0\0\0\0\0\0\0\0\377\377\375\20\22\376\377\377\0\0\377"
-    "\377\372\27\0\0\377\377\0\0\17\342\377\377\377\377\340\15\0\0\112"
-    "\370\377\377\377\377\367\53\0\0\0\0\317\377\377\317\0\0\0\0\377\377"
-    "\0\0\12\163\377\351\0\0\102\377\373\160\23\10\76\263\0\0\377\377\0"
-    "\20\133\360\377\127\0\0\377\377\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0"
-    "\0\0\0\105\377\370\146\20\10\67\251\0\0\377\377\0\0\0\0\377\377\0"
-    "\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\377\377\0\115\376"
-    "\375\107\0\0\0\377\377\0\0\0\0\0\0\0\0\377\377\374\112\115\374\377"
-    "\377\0\0\377\377\377\167\0\0\377\377\0\0\167\377\310\32\33\313\377"
-    "\163\0\27\356\377\231\32\21\260\377\244\0\0\0\15\374\340\332\374\15"
-    "\0\0\0\377\377\0\0\0\13\377\372\0\0\250\377\204\0\0\0\0\0\0\0\377"
-    "\377\0\0\0\153\377\263\0\0\377\377\0\0\0\0\0\0\0\0\377\377\0\0\0\0"
-    "\0\0\0\0\252\377\175\0\0\0\0\0\0\0\377\377\0\0\0\0\377\377\0\0\0\0"
-    "\0\377\377\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\377\377\40\356\377\176"
-    "\0\0\0\0\377\377\0\0\0\0\0\0\0\0\377\377\321\206\210\321\377\377\0"
-    "\0\377\377\327\333\1\0\377\377\0\0\301\377\107\0\0\113\377\277\0\200"
-    "\377\271\0\0\0\45\377\344\0\0\0\105\377\231\225\377\105\0\0\0\377"
-    "\377\0\0\11\155\377\313\0\0\341\377\50\0\0\0\0\0\0\0\377\377\0\0\0"
-    "\40\377\344\0\0\377\377\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\341"
-    "\377\46\0\0\0\0\0\0\0\377\377\0\0\0\0\377\377\0\0\0\0\0\377\377\0"
-    "\0\0\0\0\0\0\0\0\0\0\377\377\0\0\377\377\313\377\302\1\0\0\0\0\377"
-    "\377\0\0\0\0\0\0\0\0\377\377\233\302\304\234\377\377\0\0\377\377\163"
-    "\377\101\0\377\377\0\0\351\377\25\0\0\27\377\350\0\311\377\110\55"
-    "\314\370\224\377\373\0\0\0\200\377\122\120\377\200\0\0\0\377\377\377"
-    "\377\377\377\327\66\0\0\370\377\6\0\0\0\0\0\0\0\377\377\0\0\0\5\377"
-    "\370\0\0\377\377\377\377\377\377\377\0\0\0\377\377\377\377\377\377"
-    "\377\0\0\0\370\377\6\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377"
-    "\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\377\377\377\377"
-    "\350\13\0\0\0\0\377\377\0\0\0\0\0\0\0\0\377\377\144\367\370\147\377"
-    "\377\0\0\377\377\24\371\246\0\377\377\0\0\372\377\3\0\0\4\377\371"
-    "\0\360\377\21\315\377\377\377\377\377\0\0\0\273\373\17\17\373\273"
-    "\0\0\0\377\377\377\377\377\377\342\71\0\0\370\377\6\0\0\0\0\0\0\0"
-    "\377\377\0\0\0\6\377\367\0\0\377\377\377\377\377\377\377\0\0\0\377"
-    "\377\377\377\377\377\377\0\0\0\371\377\6\0\377\377\377\377\0\0\377"
-    "\377\377\377\377\377\377\377\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0"
-    "\0\377\377\0\0\377\377\353\357\377\172\0\0\0\0\377\377\0\0\0\0\0\0"
-    "\0\0\377\377\56\377\377\62\377\377\0\0\377\377\0\250\370\23\377\377"
-    "\0\0\372\377\3\0\0\4\377\371\0\373\377\3\373\377\64\64\377\377\0\0"
-    "\3\363\377\377\377\377\363\3\0\0\377\377\0\0\12\163\377\311\0\0\341"
-    "\377\50\0\0\0\0\0\0\0\377\377\0\0\0\40\377\343\0\0\377\377\0\0\0\0"
-    "\0\0\0\0\377\377\0\0\0\0\0\0\0\0\342\377\44\0\377\377\377\377\0\0"
-    "\377\377\0\0\0\0\377\377\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\0\0\377\377\105\175\377\357\20\0\0\0\377\377\0\0\0\0\0\0\0\0"
-    "\377\377\3\364\370\5\377\377\0\0\377\377\0\102\377\160\377\377\0\0"
-    "\351\377\25\0\0\26\377\350\0\355\377\26\315\377\377\377\377\377\0"
-    "\0\61\377\377\377\377\377\377\61\0\0\377\377\0\0\0\13\377\371\0\0"
-    "\250\377\202\0\0\0\0\0\0\0\377\377\0\0\0\154\377\262\0\0\377\377\0"
-    "\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\255\377\165\0\0\0\377\377\0"
-    "\0\377\377\0\0\0\0\377\377\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\4"
-    "\377\374\0\0\377\377\0\16\356\377\206\0\0\0\377\377\0\0\0\0\0\0\0"
-    "\0\377\377\0\0\0\0\377\377\0\0\377\377\0\1\333\325\377\377\0\0\301"
-    "\377\106\0\0\112\377\277\0\302\377\126\55\314\371\231\377\377\0\0"
-    "\154\377\350\0\1\352\377\154\0\0\377\377\0\0\10\147\377\360\0\0\103"
-    "\377\372\156\22\7\73\261\0\0\377\377\0\17\132\360\377\126\0\0\377"
-    "\377\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\115\377\364\126\10\22"
-    "\377\377\0\0\377\377\0\0\0\0\377\377\0\0\0\0\0\377\377\0\0\0\0\0\302"
-    "\135\37\4\16\172\377\341\0\0\377\377\0\0\173\377\364\27\0\0\377\377"
-    "\0\0\0\0\0\0\0\0\377\377\0\0\0\0\377\377\0\0\377\377\0\0\167\377\377"
-    "\377\0\0\167\377\307\31\32\311\377\164\0\161\377\323\11\0\0\0\0\0"
-    "\0\0\247\377\251\0\0\254\377\247\0\0\377\377\377\377\377\377\377\242"
-    "\0\0\0\216\377\377\377\377\377\377\0\0\377\377\377\377\377\377\250"
-    "\0\0\0\377\377\377\377\377\377\377\377\0\0\377\377\0\0\0\0\0\0\0\0"
-    "\0\247\377\377\377\377\377\375\0\0\377\377\0\0\0\0\377\377\0\0\0\377"
-    "\377\377\377\377\377\0\0\0\377\377\377\377\377\377\377\203\0\0\377"
-    "\377\0\0\15\355\377\222\0\0\377\377\377\377\377\377\377\377\0\0\377"
-    "\377\0\0\0\0\377\377\0\0\377\377\0\0\26\372\377\377\0\0\17\343\377"
-    "\377\377\377\341\15\0\15\337\377\310\77\10\34\237\67\0\0\342\377\153"
-    "\0\0\154\377\342\0\0\377\377\377\377\372\334\216\14\0\0\0\0\125\275"
-    "\357\372\316\126\0\0\377\377\373\351\271\134\1\0\0\0\377\377\377\377"
-    "\377\377\377\377\0\0\377\377\0\0\0\0\0\0\0\0\0\4\162\324\370\357\263"
-    "\72\0\0\377\377\0\0\0\0\377\377\0\0\0\377\377\377\377\377\377\0\0"
-    "\0\73\240\341\373\364\316\165\3\0\0\377\377\0\0\0\171\377\371\37\0"
-    "\377\377\377\377\377\377\377\377\0\0\377\377\0\0\0\0\377\377\0\0\377"
-    "\377\0\0\0\253\377\377\0\0\0\43\262\363\362\261\42\0\0\0\56\346\377"
-    "\377\377\377\377\272\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\23"
-    "\205\324\366\363\267\65\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\377\377\377\373\352\275\133\0\0\0\0\42\261\362\362"
-    "\260\40\0\0\0\377\377\377\376\361\311\157\2\0\0\0\147\324\371\356"
-    "\263\105\0\0\0\377\377\377\377\377\377\377\377\0\0\377\377\0\0\0\0"
-    "\377\377\0\0\345\377\152\0\0\153\377\345\0\360\366\1\0\0\0\0\3\371"
-    "\361\0\300\377\235\0\0\235\377\300\0\272\377\304\0\0\0\0\305\377\271"
-    "\0\377\377\377\377\377\377\377\377\0\0\0\0\377\377\377\344\0\0\0\0"
-    "\303\361\17\0\0\0\0\0\0\0\0\310\377\377\377\0\0\0\0\0\0\23\331\377"
-    "\331\23\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\162"
-    "\0\0\17\342\377\377\377\377\337\14\0\0\377\377\377\377\377\377\377"
-    "\207\0\0\161\377\377\377\377\377\377\0\0\0\377\377\377\377\377\377"
-    "\377\377\0\0\377\377\0\0\0\0\377\377\0\0\257\377\227\0\0\230\377\257"
-    "\0\320\377\40\0\0\0\0\46\377\323\0\100\377\370\27\27\370\377\100\0"
-    "\57\375\377\116\0\0\122\377\375\56\0\377\377\377\377\377\377\377\377"
-    "\0\0\0\0\377\377\0\0\0\0\0\0\110\377\173\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\0\0\0\0\0\10\304\377\370\377\304\10\0\0\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\0\2\27\176\377\336\0\0\167\377\310\32\33\313\377\162\0\0\377"
-    "\377\0\1\23\172\377\346\0\0\340\377\145\10\21\120\273\0\0\0\0\0\0"
-    "\377\377\0\0\0\0\0\377\377\0\0\0\0\377\377\0\0\171\377\304\0\0\305"
-    "\377\171\0\260\377\110\0\0\0\0\120\377\265\0\0\300\377\202\203\377"
-    "\301\0\0\0\241\377\324\3\4\331\377\240\0\0\0\0\0\0\42\365\377\246"
-    "\0\0\0\0\377\377\0\0\0\0\0\0\0\315\353\12\0\0\0\0\0\0\0\0\0\377\377"
-    "\0\0\0\0\2\254\377\256\25\256\377\254\2\0\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\0\0\0\7\377\372\0\0\301\377\107\0\0\113\377\277\0\0\377\377\0"
-    "\0\0\7\377\373\0\0\373\377\37\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0"
-    "\0\377\377\0\0\0\0\377\377\0\0\103\377\361\0\1\361\377\103\0\220\377"
-    "\160\4\374\373\2\171\377\230\0\0\100\377\353\353\377\102\0\0\0\35"
-    "\367\377\142\151\377\366\34\0\0\0\0\0\1\276\377\347\22\0\0\0\0\377"
-    "\377\0\0\0\0\0\0\0\122\377\161\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\217"
-    "\377\211\1\0\1\207\377\217\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\1\25"
-    "\173\377\336\0\0\351\377\25\0\0\27\377\347\0\0\377\377\0\0\22\173"
-    "\377\323\0\0\327\377\335\147\22\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0"
-    "\377\377\0\0\0\0\377\377\0\0\16\376\377\37\40\377\376\16\0\160\377"
-    "\230\40\377\377\31\243\377\172\0\0\0\300\377\377\302\0\0\0\0\0\207"
-    "\377\343\350\377\206\0\0\0\0\0\0\146\377\377\115\0\0\0\0\0\377\377"
-    "\0\0\0\0\0\0\0\1\326\345\6\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\162"
-    "\0\0\372\377\3\0\0\4\377\371\0\0\377\377\377\377\377\377\356\104\0"
-    "\0\114\370\377\377\374\276\101\0\0\0\0\0\0\377\377\0\0\0\0\0\377\377"
-    "\0\0\0\0\377\377\0\0\0\327\377\114\115\377\327\0\0\120\377\300\77"
-    "\374\374\65\314\377\134\0\0\0\101\377\377\104\0\0\0\0\0\17\353\377"
-    "\377\353\16\0\0\0\0\0\34\361\377\240\0\0\0\0\0\0\377\377\0\0\0\0\0"
-    "\0\0\0\135\377\146\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\374\353\276\134\0\0\0\372\377"
-    "\3\0\0\4\377\374\0\0\377\377\377\377\377\377\226\0\0\0\0\47\243\366"
-    "\377\377\375\124\0\0\0\0\0\377\377\0\0\0\0\0\377\377\0\0\0\0\377\377"
-    "\0\0\0\241\377\171\172\377\241\0\0\60\377\350\137\322\320\122\364"
-    "\377\77\0\0\0\126\377\377\130\0\0\0\0\0\0\156\377\377\155\0\0\0\0"
-    "\0\0\264\377\343\17\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\4\336\335"
-    "\3\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\377\377\0\0\0\0\0\0\0\0\351\377\25\0\0\26\377\355\0\0\377"
-    "\377\0\21\230\377\375\42\0\0\0\0\0\11\115\306\377\325\0\0\0\0\0\377"
-    "\377\0\0\0\0\0\376\377\0\0\0\0\377\376\0\0\0\153\377\247\250\377\153"
-    "\0\0\20\377\377\216\236\231\214\377\377\41\0\0\1\320\377\377\322\1"
-    "\0\0\0\0\0\5\377\377\5\0\0\0\0\0\134\377\377\107\0\0\0\0\0\0\0\377"
-    "\377\0\0\0\0\0\0\0\0\0\147\377\134\0\0\0\0\0\0\0\377\377\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\300"
-    "\377\106\0\0\112\377\312\0\0\377\377\0\0\4\325\377\213\0\0\0\0\0\0"
-    "\0\22\377\372\0\0\0\0\0\377\377\0\0\0\0\0\357\377\16\0\0\16\377\356"
-    "\0\0\0\65\377\324\325\377\65\0\0\0\360\377\326\152\141\321\377\375"
-    "\5\0\0\116\377\342\343\377\117\0\0\0\0\0\0\377\377\0\0\0\0\0\26\354"
-    "\377\232\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\7\345\325\1\0\0"
-    "\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\377\377\0\0\0\0\0\0\0\0\165\377\307\31\32\311\377\212\0\0\377\377"
-    "\0\0\0\155\377\354\10\0\311\152\50\7\16\163\377\340\0\0\0\0\0\377"
-    "\377\0\0\0\0\0\300\377\227\20\20\227\377\277\0\0\0\6\370\373\373\370"
-    "\6\0\0\0\320\377\377\66\52\376\377\346\0\0\0\311\377\167\171\377\312"
-    "\0\0\0\0\0\0\377\377\0\0\0\0\0\252\377\340\15\0\0\0\0\0\0\0\0\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\162\377\121\0\0\0\0\0\0\377\377\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\16"
-    "\340\377\377\377\377\370\44\0\0\377\377\0\0\0\26\373\377\140\0\377"
-    "\377\377\377\377\377\377\165\0\0\0\0\0\377\377\0\0\0\0\0\123\377\377"
-    "\377\377\377\377\123\0\0\0\0\311\377\377\311\0\0\0\0\260\377\372\7"
-    "\2\361\377\310\0\0\106\377\365\21\23\366\377\106\0\0\0\0\0\377\377"
-    "\0\0\0\0\0\377\377\377\377\377\377\377\377\0\0\0\0\377\377\0\0\0\0"
-    "\0\0\0\0\0\0\13\354\313\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\40\257\362"
-    "\377\377\241\0\0\0\377\377\0\0\0\0\266\377\312\0\77\247\344\374\362"
-    "\307\143\0\0\0\0\0\0\377\377\0\0\0\0\0\0\133\316\367\367\316\133\0"
-    "\0\0\0\0\223\377\377\223\0\0\0\0\220\377\316\0\0\274\377\252\0\0\302"
-    "\377\227\0\0\233\377\302\0\0\0\0\0\377\377\0\0\0\0\0\377\377\377\377"
-    "\377\377\377\377\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\174\377\107"
-    "\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\66\361\376\117\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0"
-    "\20\361\302\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\73\273\22\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\344\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\310\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377"
-    "\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\221\377\125\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\2\260\352\25\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\111\325\372\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\377"
-    "\377\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\12\311\252\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\334\377\377\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\377\377\0"
-    "\0\0\0\0\0\0\0\377\377\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\377\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\375\377\24\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0"
-    "\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\114\276\364\371\333"
-    "\204\6\0\0\377\377\55\311\370\327\130\0\0\0\0\17\206\326\367\363\272"
-    "\112\0\0\0\131\327\370\311\54\377\377\0\0\0\57\267\363\366\310\116"
-    "\0\0\0\377\377\377\377\377\377\377\0\0\0\0\112\322\370\322\102\377"
-    "\377\0\0\377\377\55\300\365\356\240\15\0\0\0\377\377\377\377\0\0\0"
-    "\0\0\0\377\377\377\377\0\0\0\0\0\377\377\0\0\224\377\371\116\0\0\0"
-    "\0\377\377\0\0\0\0\0\0\377\377\216\356\130\320\357\123\0\0\377\377"
-    "\56\300\365\356\240\15\0\0\0\60\270\364\364\270\56\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\377\377\377\377\377\377\206\0\0\377\377\344\377\377\377"
-    "\376\107\0\0\25\332\377\377\377\377\377\377\0\0\107\376\377\377\377"
-    "\344\377\377\0\0\50\363\377\377\377\377\377\116\0\0\377\377\377\377"
-    "\377\377\377\0\0\0\67\373\377\377\377\363\377\377\0\0\377\377\342"
-    "\377\377\377\377\232\0\0\0\377\377\377\377\0\0\0\0\0\0\377\377\377"
-    "\377\0\0\0\0\0\377\377\0\207\377\367\110\0\0\0\0\0\377\377\0\0\0\0"
-    "\0\0\377\377\375\377\374\377\377\311\0\0\377\377\344\377\377\377\377"
-    "\231\0\0\51\363\377\377\377\377\362\46\0\0\0\0\0\0\0\0\0\0\0\0\0\267"
-    "\106\14\11\122\377\334\0\0\377\377\265\27\25\265\377\270\0\0\226\377"
-    "\330\103\11\14\102\262\0\0\271\377\264\25\27\267\377\377\0\0\246\377"
-    "\151\14\11\130\377\311\0\0\0\0\377\377\0\0\0\0\0\0\256\377\271\27"
-    "\31\274\377\377\0\0\377\377\246\27\10\163\377\351\0\0\0\0\0\377\377"
-    "\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\377\377\170\377\364\102\0\0\0\0"
-    "\0\0\377\377\0\0\0\0\0\0\377\377\70\377\377\70\377\356\0\0\377\377"
-    "\246\27\10\163\377\351\0\0\250\377\264\26\26\265\377\246\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\3\136\312\377\377\377\371\0\0\377\377\44\0\0\45\377"
-    "\355\0\0\344\377\63\0\0\0\0\0\0\0\356\377\44\0\0\46\377\377\0\0\350"
-    "\377\374\375\376\377\377\367\0\0\0\0\377\377\0\0\0\0\0\0\352\377\47"
-    "\0\0\50\377\377\0\0\377\377\23\0\0\6\377\376\0\0\0\0\0\377\377\0\0"
-    "\0\0\0\0\0\0\377\377\0\0\0\0\0\377\377\377\377\206\0\0\0\0\0\0\0\377"
-    "\377\0\0\0\0\0\0\377\377\1\377\377\1\377\373\0\0\377\377\24\0\0\6"
-    "\377\376\0\0\351\377\44\0\0\45\377\347\0\0\0\0\0\0\0\0\0\0\0\0\50"
-    "\323\377\377\377\377\377\377\0\0\377\377\3\0\0\4\377\374\0\0\373\377"
-    "\5\0\0\0\0\0\0\0\375\377\3\0\0\4\377\377\0\0\373\377\377\377\377\377"
-    "\377\377\0\0\0\0\377\377\0\0\0\0\0\0\374\377\3\0\0\4\377\377\0\0\377"
-    "\377\0\0\0\0\377\377\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\377\377\0\0"
-    "\0\0\0\377\377\361\377\362\36\0\0\0\0\0\0\377\377\0\0\0\0\0\0\377"
-    "\377\0\377\377\0\377\377\0\0\377\377\0\0\0\0\377\377\0\0\374\377\3"
-    "\0\0\4\377\373\0\0\0\0\0\0\0\0\0\0\0\0\332\377\216\40\3\20\377\377"
-    "\0\0\377\377\44\0\0\44\377\354\0\0\345\377\62\0\0\0\0\0\0\0\356\377"
-    "\44\0\0\45\377\377\0\0\352\377\24\0\0\0\0\0\0\0\0\0\377\377\0\0\0"
-    "\0\0\0\356\377\46\0\0\50\377\377\0\0\377\377\0\0\0\0\377\377\0\0\0"
-    "\0\0\377\377\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\377\377\53\247\377"
-    "\267\0\0\0\0\0\0\375\377\3\0\0\0\0\0\377\377\0\377\377\0\377\377\0"
-    "\0\377\377\0\0\0\0\377\377\0\0\351\377\44\0\0\44\377\350\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\362\377\114\5\35\247\377\377\0\0\377\377\263\26\24"
-    "\262\377\270\0\0\231\377\326\100\10\12\77\261\0\0\271\377\262\24\26"
-    "\265\377\377\0\0\251\377\255\43\3\25\123\277\0\0\0\0\377\377\0\0\0"
-    "\0\0\0\266\377\267\26\27\272\377\377\0\0\377\377\0\0\0\0\377\377\0"
-    "\0\0\0\0\377\377\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\377\377\0\32\362"
-    "\377\137\0\0\0\0\0\351\377\124\1\0\0\0\0\377\377\0\377\377\0\377\377"
-    "\0\0\377\377\0\0\0\0\377\377\0\0\250\377\262\25\25\263\377\246\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\243\377\377\377\377\353\377\377\0\0\377\377\343"
-    "\377\377\377\377\111\0\0\27\336\377\377\377\377\377\377\0\0\111\377"
-    "\377\377\377\342\377\377\0\0\51\361\377\377\377\377\377\377\0\0\0"
-    "\0\377\377\0\0\0\0\0\0\77\375\377\377\377\364\377\377\0\0\377\377"
-    "\0\0\0\0\377\377\0\0\377\377\377\377\377\377\377\377\0\0\0\0\0\377"
-    "\377\0\0\0\0\0\377\377\0\0\163\377\355\27\0\0\0\0\254\377\377\377"
-    "\377\0\0\0\377\377\0\377\377\0\377\377\0\0\377\377\0\0\0\0\377\377"
-    "\0\0\52\364\377\377\377\377\363\50\0\0\0\0\0\0\0\0\0\0\0\0\15\231"
-    "\353\371\303\60\377\377\0\0\377\377\61\313\371\334\136\0\0\0\0\22"
-    "\212\331\370\364\300\117\0\0\0\137\334\371\312\57\377\377\0\0\0\47"
-    "\245\347\373\353\257\103\0\0\0\0\377\377\0\0\0\0\0\0\0\120\324\371"
-    "\331\113\377\374\0\0\377\377\0\0\0\0\377\377\0\0\377\377\377\377\377"
-    "\377\377\377\0\0\0\0\4\377\374\0\0\0\0\0\377\377\0\0\4\324\377\254"
-    "\0\0\0\0\41\304\373\377\377\0\0\0\377\377\0\377\377\0\377\377\0\0"
-    "\377\377\0\0\0\0\377\377\0\0\0\62\272\364\364\271\60\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\261\74\11\11\145\377\340\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\121\377\351\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\377\377\377\377\377\377\202\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\377\377\377\377\253\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\115\302\366\370\325\172\4\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\374\306\42\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\123\330\372\377\0\0\0\0\0\0\377\377\0\0\0\0\0\0\377"
-    "\372\330\120\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\340\377\110\0\0\0\0\0\0\0\377\377\0\0"
-    "\0\0\0\0\0\113\377\337\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\375\377\4\0\0\0\0\0\0\0\377"
-    "\377\0\0\0\0\0\0\0\6\377\375\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\377\377\57\311\370\332\134\0\0\0\0\134\332\370\310\55"
-    "\377\377\0\0\0\377\377\52\265\362\377\377\0\0\10\174\317\364\373\342"
-    "\244\76\0\0\377\377\377\377\377\377\377\0\0\0\377\377\0\0\0\0\377"
-    "\377\0\0\332\377\163\0\0\163\377\332\11\372\370\3\0\0\0\0\3\371\371"
-    "\10\252\377\344\7\10\346\377\253\0\0\316\377\225\0\0\211\377\325\0"
-    "\0\377\377\377\377\377\377\377\377\0\0\0\0\0\377\377\0\0\0\0\0\0\0"
-    "\0\377\377\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\377\377\343\377\377\377\376\107\0\0\107\377\377"
-    "\377\377\342\377\377\0\0\0\377\377\346\377\377\377\377\0\0\257\377"
-    "\377\377\377\377\377\377\0\0\377\377\377\377\377\377\377\0\0\0\377"
-    "\377\0\0\0\0\377\377\0\0\217\377\261\0\0\262\377\216\0\312\377\44"
-    "\0\0\0\0\46\377\304\0\25\352\377\154\156\377\353\25\0\0\152\377\352"
-    "\4\0\313\377\200\0\0\377\377\377\377\377\377\377\371\0\0\0\0\0\377"
-    "\377\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\265\27\25\265\377\270"
-    "\0\0\271\377\264\25\27\267\377\377\0\0\0\377\377\273\60\5\0\0\0\0"
-    "\371\377\122\11\5\41\136\302\0\0\0\0\377\377\0\0\0\0\0\0\377\377\0"
-    "\0\0\0\377\377\0\0\103\377\356\2\2\357\377\102\0\221\377\115\5\370"
-    "\372\6\117\377\207\0\0\123\377\344\344\377\127\0\0\0\17\366\377\111"
-    "\17\374\377\53\0\0\0\0\0\0\142\376\373\120\0\0\0\0\20\377\370\0\0"
-    "\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\371\377\17\0\0\0\0\151\337\371"
-    "\306\136\17\36\240\0\0\0\0\0\0\0\0\0\0\0\0\377\377\44\0\0\45\377\354"
-    "\0\0\356\377\44\0\0\46\377\377\0\0\0\377\377\31\0\0\0\0\0\0\314\377"
-    "\372\327\264\205\56\0\0\0\0\0\377\377\0\0\0\0\0\0\377\377\0\0\0\0"
-    "\377\377\0\0\5\362\377\57\60\377\361\5\0\127\377\165\63\377\377\63"
-    "\170\377\112\0\0\0\250\377\377\255\0\0\0\0\0\241\377\243\116\377\326"
-    "\0\0\0\0\0\0\136\375\374\124\0\0\0\0\4\163\377\302\0\0\0\0\0\0\0\0"
-    "\377\377\0\0\0\0\0\0\0\0\303\377\163\4\0\0\0\377\377\377\377\377\377"
-    "\377\377\0\0\0\0\0\0\0\0\0\0\0\0\377\377\3\0\0\4\377\374\0\0\375\377"
-    "\3\0\0\4\377\377\0\0\0\377\377\1\0\0\0\0\0\0\43\264\372\377\377\377"
-    "\375\136\0\0\0\0\377\377\0\0\0\0\0\0\377\377\0\0\0\0\377\377\0\0\0"
-    "\254\377\155\156\377\253\0\0\36\377\236\147\347\350\146\241\375\17"
-    "\0\0\0\111\377\377\121\0\0\0\0\0\75\377\363\231\377\202\0\0\0\0\0"
-    "\131\375\375\131\0\0\0\0\0\377\377\342\50\0\0\0\0\0\0\0\0\377\377"
-    "\0\0\0\0\0\0\0\0\47\341\377\377\0\0\0\233\36\7\106\257\364\342\153"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\377\377\44\0\0\44\377\355\0\0\356\377\44"
-    "\0\0\45\377\377\0\0\0\377\377\0\0\0\0\0\0\0\0\0\7\43\114\233\377\340"
-    "\0\0\0\0\377\377\0\0\0\0\0\0\377\377\5\0\0\23\377\377\0\0\0\141\377"
-    "\254\255\377\140\0\0\0\344\306\233\256\257\231\312\320\0\0\0\4\323"
-    "\377\377\326\5\0\0\0\0\0\330\377\373\377\55\0\0\0\0\125\374\375\136"
-    "\0\0\0\0\0\0\4\151\377\277\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0"
-    "\277\377\151\4\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\263\26\24\262\377\271\0\0\272\377\262\24\26\265\377\377\0\0\0\377"
-    "\377\0\0\0\0\0\0\0\307\146\45\6\7\106\377\372\0\0\0\0\366\377\65\0"
-    "\0\0\0\0\353\377\155\7\25\243\377\377\0\0\0\27\376\352\352\376\26"
-    "\0\0\0\253\356\320\165\166\314\362\223\0\0\0\166\377\304\312\377\171"
-    "\0\0\0\0\0\164\377\377\330\0\0\0\0\121\373\376\142\0\0\0\0\0\0\0\0"
-    "\11\377\367\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\371\377\11\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\344\377\377\377"
-    "\377\110\0\0\111\377\377\377\377\344\377\377\0\0\0\377\377\0\0\0\0"
-    "\0\0\0\377\377\377\377\377\377\377\273\0\0\0\0\307\377\377\377\377"
-    "\0\0\0\232\377\377\377\377\345\377\377\0\0\0\0\312\377\377\311\0\0"
-    "\0\0\162\377\376\74\75\376\377\126\0\0\36\364\377\124\130\377\365"
-    "\37\0\0\0\0\25\372\377\203\0\0\0\0\372\377\377\377\377\377\377\377"
-    "\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\56\313"
-    "\371\330\133\0\0\0\0\133\330\371\313\56\377\377\0\0\0\377\377\0\0"
-    "\0\0\0\0\0\70\232\333\372\371\334\223\22\0\0\0\0\64\311\370\377\377"
-    "\0\0\0\15\237\357\366\302\60\377\377\0\0\0\0\176\377\377\175\0\0\0"
-    "\0\71\377\372\11\11\372\377\32\0\0\261\377\340\3\4\341\377\261\0\0"
-    "\0\0\7\361\377\57\0\0\0\0\377\377\377\377\377\377\377\377\0\0\0\0"
-    "\0\377\377\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\377\377\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\1\151\377\332\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\375\377\4\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\6"
-    "\377\375\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\170"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\340\377\106\0\0\0\0\0\0\0\377"
-    "\377\0\0\0\0\0\0\0\113\377\337\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\377\375\264\10\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\125\332"
-    "\372\377\0\0\0\0\0\0\377\377\0\0\0\0\0\0\377\372\332\123\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
+    160, 228, 14863,
+    "\377\0\377\0\377\0\351\0\0\377\206\0\0\377\200\0\0\377\220\0\1\377"
+    "\1\201\0\4#\306\371\302 \205\0\2&\274\367\200\377\205\0\0\377\207"
+    "\0\2!\370\230\203\0\2\230\370 \207\0\0\377\261\0\1;\304\216\0\0"
+    "\377\206\0\0\377\200\0\0\377\205\0\4\343k\0\225\270\204\0\1\377\3"
+    "\201\0\4\306x\14x\300\205\0\2\316r\12\207\0\0\377\207\0\2\241\323"
+    "\7\203\0\2\7\324\240\207\0\0\377\261\0\1\262N\216\0\0\377\206\0\0"
+    "\377\200\0\0\377\204\0\5,\377!\0\336p\201\0\14\20\233\353\377\352"
+    "\246>\0\372\13\0\14\371\205\0\1\373\13\210\0\0\377\206\0\2\31\372="
+    "\205\0\2\77\372\27\203\0\6\247k\5\377\5l\247\255\0\2)\325\1\216\0"
+    "\0\377\206\0\0\377\200\0\0\377\204\0\5t\330\0'\377(\201\0\14\257"
+    "\225\26\377\22R\276\0\307s\13x\305\200\0\1\11.\201\0\1\325b\210\0"
+    "\0\377\206\0\1q\277\207\0\1\303m\203\0\6\6g\272\377\272g\6\255\0\1"
+    "\236b\217\0\0\377\215\0\0\20\207\377\200\0\3\370\12\0\377\202\0\10"
+    "%\307\372\306\42\12r\322b\201\0\2\230\360$\220\0\1\266b\207\0\1e"
+    "\263\203\0\6\6f\272\377\272f\6\204\0\0\377\245\0\2\32\337\6\217\0"
+    "\0\370\217\0\5\10\371J\0\265\227\202\0\3\343N\0\377\205\0\4\13t"
+    "\320s\12\201\0\4\62\367\240\312\5\217\0\1\344$\207\0\1'\342\203\0"
+    "\6\250l\5\377\5m\250\204\0\0\377\245\0\1\212v\220\0\0\345\217\0\5<"
+    "\376\21\1\355]\202\0\5Y\371\306\377f\25\201\0\4\14w\317n\10\203\0"
+    "\7\255\207\0\261\212\0\1\374\214\0\1\373\6\207\0\1\7\372\206\0\0"
+    "\377\207\0\0\377\244\0\2\17\342\16\220\0\0\321\217\0\5w\325\0'\377"
+    "$\203\0\17#x\377\326\363I\0Q\315i\6#\306\371\300\36\200\0\7\354\37"
+    "\0\24\344E\10\355\214\0\1\373\6\207\0\1\7\372\206\0\0\377\204\0"
+    "\205\377\215\0\202\377\216\0\1w\211\241\0\207\377\0\20\203\0\6\377"
+    "\0Z\335\0\30\5\200\0\4\306v\14{\275\200\0\1\371\10\200\0\3C\345F"
+    "\301\214\0\1\344%\207\0\1'\342\220\0\0\377\243\0\2\6\337\31\242\0"
+    "\5\16\372C\0\274\220\206\0\3\377\0\12\367\203\0\4\372\13\0\14\371"
+    "\200\0\1\315N\201\0\2\211\366j\214\0\1\266b\207\0\1f\263\220\0\0"
+    "\377\243\0\1c\235\222\0\0\377\216\0\5R\363\6\13\370H\203\0\6\270H"
+    "\16\377\23\217\251\203\0\4\310s\13x\305\200\0\7O\350L\7&\241\377="
+    "\214\0\1q\277\207\0\1\305m\220\0\0\377\207\0\200\377\220\0\200\377"
+    "\203\0\2\1\325(\222\0\0\377\216\0\5\233\260\0L\367\11\203\0\6D\261"
+    "\356\377\352\231\15\203\0\4'\311\372\305\42\201\0\6R\322\372\347"
+    "\233|\275\214\0\2\31\372=\205\0\2B\372\27\231\0\2\2\377\373\220\0"
+    "\200\377\203\0\1O\261\262\0\0\377\244\0\2\241\323\7\203\0\2\10\326"
+    "\240\232\0\2;\377\211\227\0\1\305;\262\0\0\377\244\0\2!\370\230"
+    "\203\0\2\232\370!\232\0\2\212\341\13\377\0\232\0\1\331N\377\0\377"
+    "\0\377\0\377\0\377\0\236\0\1\42\261\200\362\1\260 \202\0\3\63\231"
+    "\363\377\203\0\6<\242\342\372\355\264<\201\0\6\64\225\334\372\356"
+    "\273N\204\0\2\17\347\377\203\0\204\377\202\0\5\10\201\334\371\325Y"
+    "\201\0\205\377\0\372\200\0\2\2p\321\200\370\2\321p\2\201\0\5U\315"
+    "\370\357\257%\264\0\5M\300\366\362\251\25\201\0\7\17\341w\20\21x"
+    "\337\15\201\0\3\325\200+\377\203\0\7\377\333_\23\6;\315O\200\0\7"
+    "\314n,\11\7\65\301p\203\0\2\216\235\377\203\0\0\377\206\0\6\1\271"
+    "\225\42\6.\247\207\0\1s\245\200\0\7\217\301\66\10\7\64\277\216\200"
+    "\0\7R\344K\12\15X\326\24\263\0\5\273K\15!\263\265\201\0\1w\236\202"
+    "\0\1\242s\204\0\0\377\203\0\1\231\10\202\0\1(\327\206\0\1\32\351"
+    "\202\0\3&\360\33\377\203\0\0\377\206\0\1Y\247\213\0\2\2\337\65\200"
+    "\0\1\362\30\202\0\1\30\361\200\0\1\311K\202\0\1W~\267\0\1\24\370"
+    "\201\0\1\301C\202\0\1E\277\204\0\0\377\211\0\1\12\363\206\0\1\32"
+    "\360\202\0\3\265\206\0\377\203\0\0\377\206\0\1\263=\213\0\1Q\305"
+    "\201\0\1\355\26\202\0\1\27\354\200\0\1\367\12\202\0\1\14\305\231\0"
+    "\2\10_\312\212\0\2\312^\10\212\0\1(\344\201\0\1\351\26\202\0\1\27"
+    "\350\204\0\0\377\211\0\1X\252\204\0\3\14A\312\216\201\0\4H\354\17"
+    "\0\377\203\0\5\377\350\374\351\251*\201\0\2\344=\271\200\364\1\302"
+    "G\206\0\1\300U\201\0\2{\273\62\200\7\2\62\273z\200\0\1\366\11\202"
+    "\0\1\14\352\203\0\200\377\206\0\200\377\206\0\4 \211\354\370\247"
+    "\212\0\4\247\371\353\210 \207\0\2\14\311}\201\0\7\372\4\0\305\303"
+    "\0\5\371\204\0\0\377\210\0\2 \337%\202\0\202\377\1\264\3\200\0\2\4"
+    "\326p\200\0\0\377\203\0\6\255\70\7\22c\347\61\200\0\7\371\334X\15"
+    "\12J\343I\204\0\2/\341\4\202\0\0\246\202\377\0\246\201\0\1\305H"
+    "\202\0\1W\372\203\0\200\377\206\0\200\377\203\0\6\1H\263\375\330s"
+    "\24\201\0\206\377\201\0\6\24t\330\375\262G\1\203\0\3\26\313\231\4"
+    "\201\0\7\372\4\0\310\305\0\5\371\204\0\0\377\207\0\2 \333[\205\0\3"
+    "\21X\347n\200\0\2o\336\6\200\0\0\377\210\0\1\134\271\200\0\1\372W"
+    "\202\0\1K\305\204\0\1\236v\202\0\7s\331D\11\12F\334s\200\0\7I\340G"
+    "\11\14W\334\371\224\0\3\333\370\245\77\222\0\3\77\245\370\333\203"
+    "\0\1\271m\203\0\1\351\26\202\0\1\27\350\204\0\0\377\206\0\2.\344g"
+    "\210\0\1=\333\200\0\1\356Y\201\0\0\377\210\0\1\15\364\200\0\1\353"
+    "\14\202\0\1\12\366\203\0\2\25\354\21\202\0\1\333\63\202\0\1\65\333"
+    "\201\0\1H\303\200\365\2\275@\344\224\0\3\333\364\236\71\222\0\3:"
+    "\236\364\333\203\0\1\373\4\203\0\1\301C\202\0\1E\277\204\0\0\377"
+    "\205\0\2@\355Z\211\0\1\6\371\200\0\206\377\206\0\1\14\364\200\0\1"
+    "\305\14\202\0\1\12\366\203\0\1|\226\203\0\1\371\5\202\0\1\6\371"
+    "\206\0\1\77\263\224\0\6\1I\264\375\325q\24\201\0\206\377\201\0\6"
+    "\24r\325\375\263H\1\203\0\0\377\204\0\1w\236\202\0\1\242t\204\0\0"
+    "\377\204\0\2V\370f\212\0\1:\331\205\0\0\377\210\0\1[\271\200\0\1"
+    "\200W\202\0\1J\307\202\0\2\5\344(\203\0\1\340\64\202\0\1\64\337"
+    "\206\0\1\251Z\227\0\4!\212\354\371\251\212\0\4\252\371\354\211 "
+    "\215\0\2\17\341v\200\20\2x\337\15\204\0\0\377\203\0\2q\376\216\205"
+    "\0\7\305a \4\16O\337X\205\0\0\377\202\0\7\301Z\33\4\24e\346\61\200"
+    "\0\7\25\330X\14\11H\342P\202\0\1Z\267\204\0\2p\332D\200\11\2B\330m"
+    "\201\0\6\245*\5!\225\273\1\203\0\200\377\206\0\200\377\210\0\2\10`"
+    "\313\212\0\2\312_\10\210\0\0\377\205\0\5#\262\363\362\260!\203\0"
+    "\203\377\201\0\206\377\10\24\0>\245\344\373\356\271E\206\0\0\377"
+    "\202\0\6L\271\356\373\346\244'\202\0\5(\261\360\371\316S\203\0\1"
+    "\311G\205\0\1b\315\200\367\1\315`\202\0\5[\331\371\335\203\11\204"
+    "\0\200\377\205\0\2\2\377\373\244\0\0\377\364\0\2;\377\211\377\0"
+    "\232\0\2\212\341\13\377\0\232\0\1\331N\377\0\377\0\377\0\377\0\377"
+    "\0\263\0\0\5\200\361\0\5\202\0\202\377\3\365\315o\2\202\0\5Q\277"
+    "\360\370\306P\200\0\200\377\3\370\342\254E\202\0\206\377\200\0\206"
+    "\377\202\0\5W\303\361\366\301N\200\0\0\377\204\0\0\377\201\0\203"
+    "\377\205\0\202\377\201\0\0\377\202\0\2;\355N\200\0\0\377\207\0\2"
+    "\377\346\2\200\0\2\3\347\377\200\0\2\377\337\5\202\0\0\377\201\0\1"
+    "'\265\200\363\1\264&\203\0\5I\305\365\351\206\3\202\0\3=\312\313<"
+    "\202\0\0\377\201\0\3\11\60\260\215\201\0\6\201\267\64\10\35\224"
+    "\377\200\0\6\377\0\6\34S\307\207\201\0\0\377\207\0\0\377\210\0\6"
+    "\206\263\60\7!\220\376\200\0\0\377\204\0\0\377\203\0\0\377\212\0\0"
+    "\377\201\0\0\377\201\0\2;\354N\201\0\0\377\207\0\2\377\340D\200\0"
+    "\2G\335\377\200\0\2\377\351e\202\0\0\377\200\0\2\23\343h\200\16\2h"
+    "\341\21\201\0\6]\340J\11$\310}\202\0\3\200\207\210\200\202\0\0\377"
+    "\203\0\1\21\357\200\0\2:\310\4\202\0\0p\200\0\0\377\202\0\2\4\310C"
+    "\200\0\0\377\207\0\0\377\207\0\2<\305\3\202\0\0l\200\0\0\377\204\0"
+    "\0\377\203\0\0\377\212\0\0\377\201\0\0\377\200\0\2:\354N\202\0\0"
+    "\377\207\0\2\377\210\237\200\0\2\243\202\377\200\0\3\377s\340\5"
+    "\201\0\0\377\200\0\1}\215\202\0\1\216z\200\0\2\27\352'\201\0\1,"
+    "\341\202\0\3\304CD\303\202\0\0\377\203\0\1\32\361\200\0\1\244W\206"
+    "\0\0\377\203\0\1T\252\200\0\0\377\207\0\0\377\207\0\1\245V\206\0\0"
+    "\377\204\0\0\377\203\0\0\377\212\0\0\377\201\0\4\377\0\71\353N\203"
+    "\0\0\377\207\0\7\377-\361\10\13\363(\377\200\0\3\377\11\347h\201\0"
+    "\0\377\200\0\1\304;\202\0\1;\303\200\0\7y\226\0\11\264\366\233\375"
+    "\201\0\5\14\362\10\11\362\13\201\0\0\377\201\0\3\11\65\274\240\200"
+    "\0\1\337\35\206\0\0\377\203\0\1\35\341\200\0\0\377\207\0\0\377\207"
+    "\0\1\340\34\206\0\0\377\204\0\0\377\203\0\0\377\212\0\0\377\201\0"
+    "\3\377\70\361u\204\0\0\377\207\0\7\377\0\322U\134\315\0\377\200\0"
+    "\4\377\0p\342\6\200\0\0\377\200\0\1\353\23\202\0\1\24\352\200\0\7"
+    "\277E\0\201\247\15\246\377\201\0\1J\274\200\0\1\275J\201\0\204\377"
+    "\1\321\15\200\0\1\370\6\206\0\0\377\203\0\1\7\367\200\0\206\377"
+    "\200\0\205\377\201\0\1\370\5\206\0\206\377\203\0\0\377\212\0\0\377"
+    "\201\0\4\377\356\253\325\5\203\0\0\377\207\0\7\377\0w\260\270r\0"
+    "\377\200\0\4\377\0\10\346j\200\0\0\377\200\0\1\373\4\202\0\1\5\372"
+    "\200\0\7\351\30\0\326-\0.\377\201\0\1\216y\200\0\1z\215\201\0\0"
+    "\377\201\0\3\14C\326\202\200\0\1\370\6\206\0\0\377\203\0\1\6\370"
+    "\200\0\0\377\207\0\0\377\207\0\1\371\6\201\0\201\377\200\0\0\377"
+    "\204\0\0\377\203\0\0\377\212\0\0\377\201\0\4\377W\0\273{\203\0\0"
+    "\377\207\0\7\377\0\36\370\371\32\0\377\200\0\0\377\200\0\4m\344\7"
+    "\0\377\200\0\1\373\4\202\0\1\5\372\200\0\7\372\5\0\371\6\0\6\377"
+    "\201\0\1\321\65\200\0\1\66\320\201\0\0\377\203\0\1\63\334\200\0\1"
+    "\340\35\206\0\0\377\203\0\1\34\342\200\0\0\377\207\0\0\377\207\0\1"
+    "\342\35\203\0\0\377\200\0\0\377\204\0\0\377\203\0\0\377\211\0\1\1"
+    "\376\201\0\0\377\200\0\2 \353#\202\0\0\377\207\0\0\377\200\0\1\301"
+    "\275\200\0\0\377\200\0\0\377\200\0\4\7\344m\0\377\200\0\1\353\23"
+    "\202\0\1\24\352\200\0\7\370\7\0\371\6\0\6\377\200\0\1\25\376\202"
+    "\377\1\376\25\200\0\0\377\203\0\1\5\371\200\0\1\246V\206\0\0\377"
+    "\203\0\1T\253\200\0\0\377\207\0\0\377\207\0\1\254V\203\0\0\377\200"
+    "\0\0\377\204\0\0\377\203\0\0\377\211\0\1\15\361\201\0\0\377\201\0"
+    "\1m\272\202\0\0\377\207\0\0\377\204\0\0\377\200\0\0\377\201\0\3j"
+    "\345\10\377\200\0\1\305:\202\0\1:\303\200\0\7\344\35\0\326,\0-\377"
+    "\200\0\1X\256\202\0\1\257W\200\0\0\377\203\0\1%\344\200\0\2>\307\3"
+    "\202\0\0n\200\0\0\377\202\0\2\4\307E\200\0\0\377\207\0\0\377\207\0"
+    "\2K\307\3\202\0\0\377\200\0\0\377\204\0\0\377\203\0\0\377\204\0\0z"
+    "\202\0\1\70\310\201\0\0\377\201\0\2\2\304[\201\0\0\377\207\0\0\377"
+    "\204\0\0\377\200\0\0\377\201\0\3\6\342p\377\200\0\1\177\215\202\0"
+    "\1\214z\200\0\7\264R\0\201\245\14\245\377\200\0\1\233k\202\0\1l"
+    "\232\200\0\0\377\201\0\3\11\70\305|\201\0\6\210\265\63\7\33\220"
+    "\377\200\0\6\377\0\5\33S\307\212\201\0\0\377\207\0\0\377\210\0\6"
+    "\243\270\67\10\12L\377\200\0\0\377\204\0\0\377\203\0\0\377\204\0\6"
+    "\377\252\61\4 \277i\201\0\0\377\202\0\2'\341\21\200\0\0\377\207\0"
+    "\0\377\204\0\0\377\200\0\0\377\202\0\2g\347\377\200\0\2\25\345g"
+    "\200\16\2f\340\21\200\0\7e\260\0\11\264\367\232\377\200\0\1\336)"
+    "\202\0\1)\336\200\0\202\377\3\366\315j\1\202\0\5V\302\361\370\306Q"
+    "\200\0\200\377\3\371\344\255G\202\0\206\377\200\0\0\377\210\0\6\3p"
+    "\323\370\362\302\134\200\0\0\377\204\0\0\377\201\0\203\377\202\0\6"
+    "D\264\357\372\332t\1\201\0\0\377\203\0\1x\233\200\0\206\377\200\0"
+    "\0\377\204\0\0\377\200\0\0\377\202\0\2\5\337\377\201\0\1*\267\200"
+    "\363\1\265&\201\0\2\11\337L\377\0\233\0\3\66\351t\30\377\0\232\0\5"
+    "#\243\350\373\307\1\377\0\377\0\377\0\377\0\377\0\377\0\220\0\201"
+    "\377\3\376\360\302W\202\0\1'\265\200\363\1\263%\201\0\201\377\3"
+    "\376\355\271I\202\0\5W\312\367\360\261C\200\0\207\377\200\0\0\377"
+    "\204\0\0\377\200\0\1\337)\202\0\4)\336\0\355\27\204\0\4\27\354\0"
+    "\273f\202\0\4g\273\0\263y\203\0\1y\262\200\0\206\377\203\0\201\377"
+    "\202\0\1\305;\210\0\201\377\205\0\4\4\257\377\257\4\213\0\0\377"
+    "\200\0\4\1\22W\345h\200\0\2\23\343h\200\16\2h\340\20\200\0\0\377"
+    "\200\0\4\1\24Y\344Y\200\0\6e\311\64\5\42\240\377\204\0\0\377\204\0"
+    "\0\377\204\0\0\377\200\0\1\234k\202\0\4l\233\0\306=\204\0\5>\305\0"
+    "\63\341\7\200\0\6\5\337\63\0!\354\35\201\0\2\36\354 \206\0\1d\320"
+    "\203\0\0\377\204\0\1O\261\212\0\0\377\204\0\6\1\243\354d\355\243\1"
+    "\212\0\0\377\203\0\1<\334\200\0\1}\215\202\0\1\216x\200\0\0\377"
+    "\203\0\1<\326\200\0\1\336!\202\0\0y\204\0\0\377\204\0\0\377\204\0"
+    "\0\377\200\0\1Y\256\202\0\4\257Y\0\237c\204\0\1e\237\200\0\1\250o"
+    "\200\0\1d\251\201\0\1}\255\201\0\1\256|\206\0\2&\352)\203\0\0\377"
+    "\204\0\2\1\325(\211\0\0\377\204\0\6\225\345+\0+\346\225\212\0\0"
+    "\377\203\0\1\7\372\200\0\1\304;\202\0\1;\301\200\0\0\377\203\0\1\6"
+    "\372\200\0\1\372\10\211\0\0\377\204\0\0\377\204\0\0\377\200\0\2\27"
+    "\355\2\200\0\5\2\355\27\0y\211\200\0\1\257\256\200\0\1\213x\200\0"
+    "\5$\343\12\4\330%\201\0\6\7\333G\0H\332\7\205\0\2\5\315g\204\0\0"
+    "\377\205\0\1c\235\211\0\0\377\203\0\2\207\336\42\201\0\2\42\336"
+    "\207\211\0\0\377\203\0\1<\335\200\0\1\353\23\202\0\1\24\350\200\0"
+    "\0\377\203\0\1\63\343\200\0\1\313u\211\0\0\377\204\0\0\377\204\0\0"
+    "\377\201\0\1\324\63\200\0\1\64\323\200\0\5R\257\0\1\347\346\200\0"
+    "\1\262Q\201\0\3\225x`\227\203\0\4G\332\17\333F\206\0\1\213\256\205"
+    "\0\0\377\205\0\2\6\337\31\210\0\0\377\227\0\0\377\201\0\3\21W\345k"
+    "\200\0\1\373\4\202\0\1\5\371\200\0\0\377\201\0\3\17K\331w\200\0\5/"
+    "\337\322\204Y\34\205\0\0\377\204\0\0\377\204\0\0\377\201\0\1\221v"
+    "\200\0\1w\221\200\0\11+\325\0,\306\307*\0\331+\201\0\3\35\355\334"
+    "\37\204\0\2\254\327\253\206\0\2D\342\22\205\0\0\377\206\0\1w\211"
+    "\210\0\0\377\227\0\202\377\2\362\304[\201\0\1\372\4\202\0\1\5\374"
+    "\200\0\6\377\375\366\361\374\376\177\202\0\6\5K\205\256\353\261\26"
+    "\203\0\0\377\204\0\0\377\204\0\0\377\201\0\1O\270\200\0\1\271N\200"
+    "\0\11\7\365\2j\204\205h\4\367\7\201\0\3a\327\352d\204\0\2\34\377"
+    "\34\205\0\2\23\343A\206\0\0\377\206\0\2\17\342\16\207\0\0\377\227"
+    "\0\0\377\207\0\1\352\23\202\0\1\24\361\200\0\0\377\201\0\3\6_\355'"
+    "\205\0\2\6\220\265\203\0\0\377\204\0\0\377\204\0\0\377\201\0\1\17"
+    "\361\200\6\1\362\17\201\0\7\336!\250CD\246&\335\201\0\5\2\330Xr"
+    "\332\2\204\0\0\377\206\0\1\260\207\207\0\0\377\207\0\1\212v\207\0"
+    "\0\377\227\0\0\377\207\0\1\303:\202\0\1:\326\200\0\0\377\203\0\1s"
+    "\260\206\0\1\14\370\203\0\0\377\204\0\1\367\1\202\0\1\1\367\202\0"
+    "\3\311>\77\311\202\0\7\267H\335\10\11\334M\267\201\0\5U\326\2\10"
+    "\344V\204\0\0\377\205\0\2i\312\5\207\0\0\377\207\0\2\32\337\6\206"
+    "\0\0\377\227\0\0\377\207\0\1{\215\202\0\1\214\242\200\0\0\377\203"
+    "\0\5\7\354\32\0\216\3\202\0\1#\344\203\0\0\377\204\0\1\327\31\202"
+    "\0\1\33\327\202\0\3\207\200\201\206\202\0\2\221\222\277\200\0\2"
+    "\300\225\220\201\0\1\316Y\200\0\1h\317\204\0\0\377\204\0\2*\351#"
+    "\210\0\0\377\210\0\1\236b\206\0\0\377\227\0\0\377\207\0\2\22\341g"
+    "\200\16\2f\372G\200\0\0\377\204\0\12\232t\0\377\312O\17\10<\314v"
+    "\203\0\0\377\204\0\2j\301\66\200\10\2\67\302l\202\0\3D\303\304C"
+    "\202\0\2j\356~\200\0\2\177\360i\200\0\2I\327\2\200\0\2\5\336I\203"
+    "\0\0\377\204\0\1\320_\211\0\0\377\210\0\2)\324\1\205\0\0\377\227\0"
+    "\0\377\210\0\2%\261\362\200\377\0\241\201\0\0\377\204\0\11>\321\0="
+    "\244\343\373\362\304^\204\0\0\377\205\0\1^\313\200\367\1\313^\203"
+    "\0\0\11\200\362\0\10\202\0\2C\377<\200\0\2=\377C\200\0\1\303[\202"
+    "\0\1^\303\203\0\0\377\204\0\206\377\203\0\0\377\211\0\1\262N\205\0"
+    "\0\377\245\0\3%\327\347!\335\0\0\377\211\0\1;\304\205\0\0\377\246"
+    "\0\2\17\263N\335\0\201\377\216\0\201\377\377\0\377\0\312\0\210\377"
+    "\377\0\377\0\276\0\2\214\354\37\377\0\232\0\3\1\242\313\7\215\0\0"
+    "\377\230\0\0\377\215\0\1R\344\200\377\213\0\0\377\212\0\0\377\210"
+    "\0\0\377\203\0\0\377\207\0\202\377\244\0\2\4\267\234\215\0\0\377"
+    "\230\0\0\377\215\0\2\341E\2\214\0\0\377\212\0\0\377\210\0\0\377"
+    "\203\0\0\377\212\0\0\377\266\0\0\377\230\0\0\377\215\0\1\376\1\215"
+    "\0\0\377\233\0\0\377\212\0\0\377\255\0\6C\261\357\371\332\204\7"
+    "\200\0\6\377P\313\370\361\264.\202\0\5\37\240\346\371\320W\202\0\6"
+    "-\262\360\370\316R\377\201\0\5!\246\354\370\313F\202\0\204\377\202"
+    "\0\6)\261\361\367\312I\377\200\0\7\377/\256\352\373\344\214\10\201"
+    "\0\201\377\206\0\201\377\203\0\0\377\201\0\2\36\322a\204\0\0\377"
+    "\204\0\6\377\261\367\212\304\364]\201\0\7\377/\256\352\373\344\214"
+    "\10\201\0\1A\302\200\365\1\301\77\214\0\6\277X\31\3\34\232\243\200"
+    "\0\7\377\360Z\15\14Y\345)\200\0\6\37\341k\23\6\62\252\201\0\7)\344"
+    "X\14\16]\361\377\200\0\7\36\345u\24\10H\342:\203\0\0\377\204\0\7#"
+    "\342_\17\13V\354\377\200\0\7\377\342^\22\4+\275\221\203\0\0\377"
+    "\210\0\0\377\203\0\0\377\200\0\2.\340X\205\0\0\377\204\0\0\377\200"
+    "J\3\377LG\320\201\0\7\377\342^\22\4+\275\221\200\0\7:\354X\14\15Z"
+    "\354\67\220\0\1\14\361\200\0\1\377h\202\0\1h\250\200\0\1\240r\206"
+    "\0\1\251e\202\0\1j\377\200\0\1\237{\202\0\1S\264\203\0\0\377\204\0"
+    "\1\243i\202\0\1e\377\200\0\1\377P\202\0\1\42\350\203\0\0\377\210\0"
+    "\0\377\203\0\4\377\0A\352P\206\0\0\377\204\0\6\377\14\13\377\14\13"
+    "\362\201\0\1\377P\202\0\1\42\350\200\0\1\263e\202\0\1h\261\212\0\3"
+    "\1k\311\363\202\377\200\0\1\377\27\202\0\1\30\351\200\0\1\347\32"
+    "\206\0\1\352\27\202\0\1\31\377\200\0\1\347\31\202\0\1\16\355\203\0"
+    "\0\377\204\0\1\350\27\202\0\1\27\377\200\0\1\377\10\202\0\1\1\376"
+    "\203\0\0\377\210\0\0\377\203\0\3\377W\360\225\207\0\0\377\204\0\6"
+    "\377\0\1\377\0\1\375\201\0\1\377\10\202\0\1\1\376\200\0\1\354\27"
+    "\202\0\1\30\352\212\0\7\211\312D\20\1\0\4\377\200\0\1\377\3\202\0"
+    "\1\4\373\200\0\1\373\4\206\0\1\374\3\202\0\1\4\377\200\0\0\373\204"
+    "\377\0\376\203\0\0\377\204\0\1\374\3\202\0\1\4\377\200\0\0\377\204"
+    "\0\0\377\203\0\0\377\210\0\0\377\203\0\4\377\235\33\332O\206\0\0"
+    "\377\204\0\0\377\200\0\0\377\200\0\0\377\201\0\0\377\204\0\0\377"
+    "\200\0\1\374\3\202\0\1\4\373\212\0\1\355\35\202\0\1%\377\200\0\1"
+    "\377\27\202\0\1\30\347\200\0\1\347\32\206\0\1\351\26\202\0\1\31"
+    "\377\200\0\1\345\5\211\0\0\377\204\0\1\350\31\202\0\1\30\377\200\0"
+    "\0\377\204\0\0\377\203\0\0\377\210\0\0\377\203\0\0\377\200\0\2'"
+    "\343\67\205\0\0\377\204\0\0\377\200\0\0\377\200\0\0\377\201\0\0"
+    "\377\204\0\0\377\200\0\1\354\27\202\0\1\30\353\212\0\1\364\22\202"
+    "\0\1\220\377\200\0\1\377g\202\0\1f\245\200\0\1\241s\206\0\1\246c"
+    "\202\0\1j\377\200\0\1\236R\211\0\0\377\204\0\1\244l\202\0\1f\377"
+    "\200\0\0\377\204\0\0\377\203\0\0\377\210\0\0\377\203\0\0\377\201\0"
+    "\2=\343#\204\0\1\370\14\203\0\0\377\200\0\0\377\200\0\0\377\201\0"
+    "\0\377\204\0\0\377\200\0\1\264e\202\0\1h\262\212\0\7\236\254!\4!"
+    "\215\354\377\200\0\7\377\360Z\14\13W\342'\200\0\6 \343k\23\5/\246"
+    "\201\0\7'\341V\13\15\134\361\377\200\0\7\34\325b\24\4 c\307\203\0"
+    "\0\377\204\0\7$\345a\17\12U\350\377\200\0\0\377\204\0\0\377\203\0"
+    "\0\377\210\0\0\377\203\0\0\377\202\0\2X\331\24\203\0\2\305n\1\202"
+    "\0\0\377\200\0\0\377\200\0\0\377\201\0\0\377\204\0\0\377\200\0\2<"
+    "\355X\200\14\2Y\355\71\212\0\7\10\213\343\374\353\254'\377\200\0\6"
+    "\377R\316\371\361\262,\202\0\5!\242\350\372\322X\202\0\6,\262\361"
+    "\371\315Q\377\201\0\6\31\227\341\372\352\251\77\203\0\0\377\205\0"
+    "\6+\262\362\367\312D\375\200\0\0\377\204\0\0\377\200\0\205\377\205"
+    "\0\0\377\203\0\0\377\203\0\2w\306\11\202\0\1\64\333\200\377\201\0"
+    "\0\377\200\0\0\377\200\0\0\377\201\0\0\377\204\0\0\377\201\0\1D"
+    "\304\200\366\1\303B\315\0\1!\336\227\0\1\10\367\374\0\6\301U\23\4,"
+    "\274q\227\0\1]\310\374\0\1J\276\200\366\1\314d\226\0\200\377\1\346"
+    "=\377\0\377\0\377\0\377\0\377\0\377\0\240\0\2X\342\375\205\0\0\377"
+    "\205\0\2\375\341X\302\0\0\377\304\0\2\336M\2\205\0\0\377\205\0\2\2"
+    "P\335\302\0\0\377\304\0\1\374\4\206\0\0\377\206\0\1\5\373\230\0\6"
+    "\377Q\315\367\360\263,\202\0\6,\262\360\367\315P\377\202\0\5\377"
+    "\26\247\357\353p\200\0\7\6w\314\363\374\346\251A\200\0\204\377\202"
+    "\0\0\377\204\0\0\377\200\0\1\324;\202\0\4<\324\0\342$\204\0\4!\343"
+    "\0\232\240\202\0\1\237\231\200\0\1\314F\202\0\1<\322\200\0\206\377"
+    "\203\0\0\377\207\0\0\377\207\0\0\377\230\0\7\377\360Z\15\14W\342&"
+    "\200\0\7'\342W\14\15[\360\377\202\0\5\377\272Z\13\30\225\200\0\7"
+    "\251\213\42\5\7%e\306\202\0\0\377\205\0\0\377\204\0\0\377\200\0\1}"
+    "\223\202\0\4\224|\0\246\134\200\0\1\12 \200\0\5T\252\0\6\306`\200"
+    "\0\2\134\306\6\200\0\1d\253\202\0\1\224w\206\0\1A\271\203\0\0\377"
+    "\207\0\0\377\207\0\0\377\230\0\1\377h\202\0\1e\245\200\0\1\246e"
+    "\202\0\1h\377\202\0\1\377m\204\0\1\370\14\210\0\0\377\205\0\0\377"
+    "\204\0\0\377\200\0\2%\347\2\200\0\5\3\350$\0i\224\200\0\1\311\333"
+    "\200\0\1\207q\200\0\5\31\333*'\332\31\201\0\2\13\353\26\200\0\2\3"
+    "\346\36\205\0\2W\256\12\202\0\1\13\371\207\0\0\377\207\0\1\372\12"
+    "\227\0\1\377\27\202\0\1\27\347\200\0\1\350\27\202\0\1\30\377\202\0"
+    "\1\377\33\204\0\3\314\265J\21\206\0\0\377\205\0\0\377\204\0\0\377"
+    "\201\0\1\316B\200\0\1C\315\200\0\11-\314\0\35\273\307.\0\272\70"
+    "\201\0\3:\316\312\71\203\0\1\224u\200\0\1C\302\205\0\2o\236\4\202"
+    "\0\2\3k\315\207\0\0\377\207\0\2\315k\3\202\0\7k\337\371\306^\17\36"
+    "\237\212\0\1\377\3\202\0\1\4\373\200\0\1\374\3\202\0\1\4\377\202\0"
+    "\1\377\2\204\0\7\36\244\353\377\341\300\204\21\202\0\0\377\205\0\0"
+    "\377\204\0\0\377\201\0\1v\232\200\0\1\233u\200\0\11\1\351\11meu"
+    "\200\0\345\6\202\0\200\301\204\0\1,\331\200\0\1\232g\203\0\0\1\200"
+    "\210\204\0\2\377\376L\207\0\0\377\207\0\2J\376\377\202\0\7\235\37"
+    "\10H\257\364\342k\212\0\1\377\27\202\0\1\27\351\200\0\1\352\26\202"
+    "\0\1\30\377\202\0\0\377\210\0\4\13/g\315\302\202\0\0\377\205\0\1"
+    "\376\1\202\0\1\11\377\201\0\5 \353\4\5\354\37\201\0\7\264<\271\23"
+    "\42\321 \306\202\0\3l\232\233k\204\0\4\303\77\5\347\22\202\0\2\5"
+    "\240o\205\0\2\3f\314\207\0\0\377\207\0\2\314e\3\226\0\1\377g\202\0"
+    "\1d\250\200\0\1\251c\202\0\1h\377\202\0\0\377\213\0\1\20\366\202\0"
+    "\1\373\6\204\0\1\351!\202\0\1P\377\202\0\3\307IJ\306\202\0\2w\206"
+    "\263\200\0\2\317v\215\201\0\5\60\327\14\15\330/\203\0\3[\244I\261"
+    "\202\0\2\13\261W\207\0\1\10\371\207\0\0\377\207\0\1\371\7\227\0\7"
+    "\377\360Z\14\13U\342)\200\0\7)\342U\13\14Z\357\377\202\0\0\377\205"
+    "\0\7\315s\61\13\3$\233\241\202\0\2\327]\2\203\0\7\225\274*\4\21["
+    "\340\377\202\0\3p\241\242o\202\0\2;\363a\200\0\2|\355T\200\0\2\14"
+    "\327\77\200\0\2@\326\13\202\0\3\7\343\262T\202\0\1\275C\211\0\0"
+    "\377\207\0\0\377\207\0\0\377\230\0\6\377S\317\370\361\264.\202\0\6"
+    ".\264\361\370\315O\377\202\0\0\377\205\0\7\70\233\337\373\364\314t"
+    "\5\202\0\3L\341\376\377\202\0\7\12\221\346\374\353\255.\377\202\0"
+    "\3\32\356\357\31\202\0\2\6\361\20\200\0\2)\377\34\200\0\1\242\217"
+    "\202\0\1\217\241\203\0\2\212\360\10\202\0\206\377\203\0\0\377\207"
+    "\0\0\377\207\0\0\377\230\0\0\377\216\0\0\377\311\0\1v\233\220\0\1"
+    "\374\4\206\0\0\377\206\0\1\5\373\230\0\0\377\216\0\0\377\310\0\2)"
+    "\346\63\220\0\2\336K\1\205\0\0\377\205\0\2\1O\335\230\0\0\377\216"
+    "\0\0\377\307\0\2\377\357s\221\0\2[\343\376\205\0\0\377\205\0\2\375"
+    "\343Z\377\0\222\0\0\377\377\0\377\0\377\0\377\0\213\0\200\377\204"
+    "\0\200\377\200\0\200\377\203\0\6\61\377\236\0\275\376\27\202\0\0"
+    "\377\203\0\4\42\305\371\303 \205\0\5\20\227\345\373\325X\204\0\200"
+    "\377\206\0\2\33\362\275\203\0\2\275\362\32\207\0\0\377\261\0\2;"
+    "\377\304\215\0\200\377\204\0\200\377\200\0\200\377\203\0\5r\377[\7"
+    "\367\322\203\0\0\377\203\0\4\306x\14x\303\205\0\0\262\203\377\204"
+    "\0\200\377\206\0\2\235\377@\203\0\2B\377\233\207\0\0\377\261\0\2"
+    "\262\377N\215\0\200\377\204\0\200\377\200\0\200\377\203\0\5\263"
+    "\377\31\77\377\216\200\0\2\24\243\356\201\377\201\0\4\372\13\0\14"
+    "\371\205\0\5\370\377>\6-\250\204\0\200\377\205\0\2\31\372\326\205"
+    "\0\2\331\371\27\203\0\6\260\215\33\377\33\215\260\255\0\3)\376\326"
+    "\1\215\0\200\377\204\0\200\377\200\0\200\377\200\0\0\20\207\377\1"
+    "\0\266\203\377\201\0\4\306v\13v\305\205\0\2\324\377=\207\0\200\377"
+    "\205\0\2r\377\202\205\0\2\205\377n\203\0\6!\222\355\377\357\224\42"
+    "\204\0\200\377\245\0\2\236\377b\216\0\200\377\214\0\0\20\207\377\4"
+    "\0\371\377+\377\203\0\10$\306\372\305\42\0\63\224e\201\0\3H\377"
+    "\332\17\217\0\2\267\377H\205\0\2E\377\265\203\0\6!\221\354\377\355"
+    "\223!\204\0\200\377\244\0\3\32\371\345\6\216\0\200\370\216\0\5n"
+    "\377^\5\360\331\201\0\5\334\377\274\377<\2\204\0\4\6[\240o\17\201"
+    "\0\1\3\242\200\377\1\265\2\216\0\2\344\377\33\205\0\2\32\377\343"
+    "\203\0\6\260\215\31\377\31\215\260\204\0\200\377\244\0\2\212\377v"
+    "\217\0\200\341\216\0\5\272\375\24B\377\213\201\0\1D\355\201\377\1"
+    "\322\36\201\0\4\32~\231E\1\203\0\10x\377\211\366\377\213\0\377\373"
+    "\213\0\2\373\377\10\205\0\2\4\377\372\206\0\0\377\204\0\206\377"
+    "\240\0\3\17\361\360\16\217\0\1\310\313\214\0\207\377\0\20\200\0\5"
+    "\14U\377\337\377\264\200\0\10_\202\37\0\42\305\371\303 \200\0\10"
+    "\337\377\3V\376\377^\377\340\213\0\2\373\377\11\205\0\2\4\377\372"
+    "\206\0\0\377\204\0\206\377\213\0\203\377\216\0\2w\377\211\240\0"
+    "\207\377\0\20\202\0\3\377\30\377\365\204\0\4\306v\14~\303\200\0\10"
+    "\373\377\34\0~\377\370\377\217\213\0\2\344\377\34\205\0\2\33\377"
+    "\343\220\0\200\377\216\0\203\377\215\0\3\6\346\371\31\241\0\5q\377"
+    "[\5\363\323\202\0\6\275N\17\377D\377\356\204\0\4\372\13\0\15\371"
+    "\200\0\10\327\377\266\31\26\336\377\351\20\213\0\2\267\377I\205\0"
+    "\2F\377\265\220\0\200\377\206\0\200\377\220\0\200\377\204\0\2c\377"
+    "\235\221\0\200\377\215\0\5\262\377\31:\377\221\202\0\204\377\0\225"
+    "\204\0\4\306s\13{\304\200\0\0X\204\377\1\376\60\213\0\2r\377\203"
+    "\205\0\2\207\377n\220\0\200\377\206\0\200\377\220\0\200\377\203\0"
+    "\3\1\327\376(\221\0\200\377\214\0\6\3\360\330\0{\377P\202\0\6A\256"
+    "\357\377\354\221\10\204\0\4$\306\372\304!\201\0\7Q\311\370\365\275"
+    "\262\377\272\213\0\2\31\372\327\205\0\2\332\371\27\231\0\2%\377"
+    "\332\220\0\200\377\203\0\2O\377\261\257\0\1\3\377\245\0\2\234\377A"
+    "\203\0\2B\377\232\232\0\2}\377\203\227\0\2\305\377;\257\0\1\1\377"
+    "\245\0\2\32\362\275\203\0\2\275\362\32\232\0\2\324\377+\377\0\377"
+    "\0\377\0\377\0\377\0\377\0\274\0\1$\263\200\363\1\263$\202\0\1="
+    "\270\200\377\203\0\6:\236\340\373\356\273L\201\0\6;\237\341\373"
+    "\356\274P\204\0\1\3\311\200\377\201\0\205\377\202\0\5\13\206\334"
+    "\371\330Z\201\0\206\377\201\0\1_\313\200\367\1\313_\202\0\5S\316"
+    "\370\357\260(\263\0\6B\255\352\373\342\214\12\201\0\1\20\344\202"
+    "\377\1\344\20\201\0\202\377\203\0\205\377\0f\200\0\205\377\0k\203"
+    "\0\0x\201\377\201\0\205\377\201\0\1\3\303\203\377\201\0\205\377\0"
+    "\372\200\0\0r\204\377\0q\200\0\0N\203\377\1\352\26\262\0\204\377\0"
+    "\244\201\0\7y\377\310\32\33\313\377y\201\0\1\300@\200\377\203\0\7"
+    "\313l(\6\31\222\377\341\200\0\7\307f\42\5\30\217\377\344\202\0\2*"
+    "\370\301\200\377\201\0\200\377\206\0\6b\377\340=\6*\251\206\0\2"
+    "\224\377\236\200\0\2\344\377\203\200\21\2\204\377\343\200\0\7\304"
+    "\377\230\21\17\230\377\202\262\0\6\277U\26\6O\377\365\201\0\2\302"
+    "\377H\200\0\2K\377\302\203\0\200\377\210\0\2\12\377\360\205\0\2\11"
+    "\377\370\201\0\3\3\311\364\42\200\377\201\0\200\377\206\0\2\270"
+    "\377N\211\0\3\25\366\376(\200\0\2\371\377\7\200\0\2\10\377\370\200"
+    "\0\2\364\377\20\200\0\2\20\377\307\231\0\2\17j\316\212\0\2\315i\17"
+    "\211\0\2%\377\342\201\0\2\352\377\25\200\0\2\27\377\351\203\0\200"
+    "\377\210\0\2B\377\237\204\0\3\25\207\377\274\201\0\3x\377i\0\200"
+    "\377\201\0\200\377\4\345\374\345\237 \201\0\6\347\377m\334\372\334"
+    "m\205\0\2\202\377\256\201\0\7\273\377\203\20\21\205\377\267\200\0"
+    "\2\372\377\17\200\0\2\20\377\353\203\0\200\377\206\0\200\377\206\0"
+    "\4>\242\366\377\372\200\0\206\377\200\0\4\372\377\366\241=\206\0\3"
+    "\17\316\377f\201\0\7\372\377\3\305\304\4\377\372\203\0\200\377\207"
+    "\0\3\36\341\355\34\202\0\202\377\1\271\33\200\0\2*\370\272\200\0"
+    "\200\377\201\0\204\377\1\356(\200\0\0\372\204\377\0g\203\0\3\13"
+    "\355\377\66\201\0\1\27\264\202\377\1\263\25\200\0\7\324\377\227\20"
+    "\17\227\377\372\203\0\200\377\206\0\200\377\203\0\7\27v\331\377"
+    "\376\304i\23\200\0\206\377\200\0\7\23i\304\376\377\330u\26\202\0\3"
+    "\13\311\377\231\202\0\7\372\377\3\307\305\4\377\372\203\0\200\377"
+    "\206\0\3'\341\367@\203\0\202\377\1\327-\200\0\2\311\361\35\200\0"
+    "\200\377\201\0\7\271J\17\7\71\310\377\263\200\0\7\373\377\225\17"
+    "\21\233\377\323\203\0\2p\377\277\202\0\1\42\321\202\377\1\322!\200"
+    "\0\0i\204\377\0\371\203\0\200\377\206\0\200\377\203\0\4\372\377"
+    "\325z \220\0\4 z\325\377\372\202\0\3\242\377\211\1\202\0\2\352\377"
+    "\25\200\0\2\27\377\351\203\0\200\377\205\0\3\67\354\370H\206\0\3"
+    "\30\224\377\305\200\0\206\377\205\0\2\33\377\363\200\0\2\354\377"
+    "\17\200\0\2\20\377\371\202\0\3\5\342\377G\202\0\2\302\377\210\200"
+    "\22\2\212\377\277\201\0\6q\336\373\340v\377\345\224\0\4\374\377"
+    "\315r\32\220\0\4\32r\315\377\374\202\0\2\367\377\15\203\0\2\302"
+    "\377H\200\0\2K\377\302\203\0\200\377\204\0\3K\365\367G\210\0\2\12"
+    "\377\371\200\0\206\377\205\0\2\27\377\362\200\0\2\307\377\17\200\0"
+    "\2\20\377\363\202\0\2_\377\316\203\0\2\372\377\10\200\0\2\11\377"
+    "\371\205\0\2N\377\267\224\0\7\31z\334\377\375\275c\20\200\0\206"
+    "\377\200\0\7\20c\276\375\377\333y\31\202\0\200\377\204\0\2y\377"
+    "\310\200\32\2\312\377y\203\0\200\377\203\0\3c\373\367E\204\0\7\277"
+    "W\34\4\27\205\377\346\205\0\200\377\201\0\7\267G\16\5/\272\377\265"
+    "\200\0\7\203\377\224\17\20\232\377\301\201\0\3\1\324\377W\203\0\7"
+    "\345\377\206\21\22\212\377\344\201\0\6\247(\5<\341\377a\203\0\200"
+    "\377\206\0\200\377\205\0\5\1A\244\367\377\370\200\0\206\377\200\0"
+    "\5\370\377\366\244@\1\214\0\1\20\344\202\377\1\346\21\200\0\206"
+    "\377\200\0\206\377\1\4\0\205\377\0x\205\0\200\377\201\0\204\377\1"
+    "\357+\200\0\1\30\354\203\377\0K\201\0\3M\377\334\3\203\0\0}\204"
+    "\377\0z\201\0\203\377\1\303\3\203\0\200\377\206\0\200\377\210\0\2"
+    "\20k\316\212\0\2\316k\20\207\0\200\377\205\0\1%\263\200\363\1\264&"
+    "\201\0\206\377\200\0\206\377\10\4\0@\252\346\374\361\303^\206\0"
+    "\200\377\201\0\6A\255\353\373\343\237\42\202\0\5*\262\360\371\316Q"
+    "\202\0\2\304\377g\204\0\2\1m\322\200\370\2\321k\1\201\0\5Y\331\371"
+    "\334\206\13\204\0\200\377\205\0\2%\377\332\243\0\200\377\364\0\2}"
+    "\377\203\377\0\232\0\2\324\377+\377\0\377\0\377\0\377\0\377\0\377"
+    "\0\321\0\0Y\200\377\0Y\202\0\202\377\3\370\324w\3\202\0\5S\274\356"
+    "\371\317X\200\0\200\377\4\372\350\270[\1\201\0\206\377\200\0\206"
+    "\377\202\0\5]\303\361\367\302O\200\0\200\377\202\0\200\377\201\0"
+    "\204\377\204\0\203\377\200\0\200\377\200\0\5\4\301\377\314\7\0\200"
+    "\377\206\0\200\377\0\322\200\0\0\326\200\377\200\0\200\377\0\256"
+    "\201\0\200\377\201\0\1\42\261\200\362\1\260!\202\0\5,\251\351\370"
+    "\312=\203\0\0\224\200\377\0\224\202\0\205\377\0\212\201\0\0\213"
+    "\204\377\200\0\204\377\0\250\201\0\206\377\200\0\206\377\201\0\0"
+    "\224\204\377\200\0\200\377\202\0\200\377\201\0\204\377\204\0\203"
+    "\377\200\0\200\377\200\0\3\211\377\355\37\200\0\200\377\206\0\200"
+    "\377\3\375\20\22\376\200\377\200\0\200\377\1\372\27\200\0\200\377"
+    "\200\0\1\17\342\202\377\1\340\15\200\0\1J\370\202\377\1\367+\202\0"
+    "\0\317\200\377\0\317\202\0\200\377\200\0\3\12s\377\351\200\0\7B"
+    "\377\373p\23\10>\263\200\0\200\377\5\0\20[\360\377W\200\0\200\377"
+    "\206\0\200\377\206\0\7E\377\370f\20\10\67\251\200\0\200\377\202\0"
+    "\200\377\203\0\200\377\211\0\200\377\200\0\200\377\4\0M\376\375G"
+    "\201\0\200\377\206\0\200\377\3\374JM\374\200\377\200\0\201\377\0w"
+    "\200\0\200\377\200\0\21w\377\310\32\33\313\377s\0\27\356\377\231"
+    "\32\21\260\377\244\201\0\5\15\374\340\332\374\15\201\0\200\377\201"
+    "\0\2\13\377\372\200\0\2\250\377\204\205\0\200\377\201\0\2k\377\263"
+    "\200\0\200\377\206\0\200\377\206\0\2\252\377}\205\0\200\377\202\0"
+    "\200\377\203\0\200\377\211\0\200\377\200\0\200\377\3 \356\377~\202"
+    "\0\200\377\206\0\200\377\3\321\206\210\321\200\377\200\0\200\377\3"
+    "\327\333\1\0\200\377\200\0\2\301\377G\200\0\6K\377\277\0\200\377"
+    "\271\201\0\2%\377\344\201\0\5E\377\231\225\377E\201\0\200\377\200"
+    "\0\3\11m\377\313\200\0\2\341\377(\205\0\200\377\201\0\2 \377\344"
+    "\200\0\200\377\206\0\200\377\206\0\2\341\377&\205\0\200\377\202\0"
+    "\200\377\203\0\200\377\211\0\200\377\200\0\200\377\3\313\377\302\1"
+    "\202\0\200\377\206\0\200\377\3\233\302\304\234\200\377\200\0\200"
+    "\377\3s\377A\0\200\377\200\0\2\351\377\25\200\0\14\27\377\350\0"
+    "\311\377H-\314\370\224\377\373\201\0\5\200\377RP\377\200\201\0\204"
+    "\377\1\327\66\200\0\2\370\377\6\205\0\200\377\201\0\2\5\377\370"
+    "\200\0\205\377\201\0\205\377\201\0\2\370\377\6\205\0\206\377\203\0"
+    "\200\377\211\0\200\377\200\0\202\377\1\350\13\202\0\200\377\206\0"
+    "\200\377\3d\367\370g\200\377\200\0\200\377\3\24\371\246\0\200\377"
+    "\200\0\2\372\377\3\200\0\7\4\377\371\0\360\377\21\315\203\377\201"
+    "\0\1\273\373\200\17\1\373\273\201\0\204\377\1\342\71\200\0\2\370"
+    "\377\6\205\0\200\377\201\0\2\6\377\367\200\0\205\377\201\0\205\377"
+    "\201\0\3\371\377\6\0\202\377\200\0\206\377\203\0\200\377\211\0\200"
+    "\377\200\0\200\377\3\353\357\377z\202\0\200\377\206\0\200\377\0."
+    "\200\377\0\62\200\377\200\0\200\377\3\0\250\370\23\200\377\200\0\2"
+    "\372\377\3\200\0\10\4\377\371\0\373\377\3\373\377\200\64\200\377"
+    "\200\0\1\3\363\202\377\1\363\3\200\0\200\377\200\0\3\12s\377\311"
+    "\200\0\2\341\377(\205\0\200\377\201\0\2 \377\343\200\0\200\377\206"
+    "\0\200\377\206\0\3\342\377$\0\202\377\200\0\200\377\202\0\200\377"
+    "\203\0\200\377\211\0\200\377\200\0\200\377\4E}\377\357\20\201\0"
+    "\200\377\206\0\200\377\3\3\364\370\5\200\377\200\0\200\377\3\0B"
+    "\377p\200\377\200\0\2\351\377\25\200\0\7\26\377\350\0\355\377\26"
+    "\315\203\377\200\0\0\61\204\377\0\61\200\0\200\377\201\0\2\13\377"
+    "\371\200\0\2\250\377\202\205\0\200\377\201\0\2l\377\262\200\0\200"
+    "\377\206\0\200\377\206\0\2\255\377u\201\0\200\377\200\0\200\377"
+    "\202\0\200\377\203\0\200\377\210\0\2\4\377\374\200\0\200\377\4\0"
+    "\16\356\377\206\201\0\200\377\206\0\200\377\202\0\200\377\200\0"
+    "\200\377\3\0\1\333\325\200\377\200\0\2\301\377F\200\0\12J\377\277"
+    "\0\302\377V-\314\371\231\200\377\200\0\7l\377\350\0\1\352\377l\200"
+    "\0\200\377\200\0\3\10g\377\360\200\0\7C\377\372n\22\7;\261\200\0"
+    "\200\377\5\0\17Z\360\377V\200\0\200\377\206\0\200\377\206\0\5M\377"
+    "\364V\10\22\200\377\200\0\200\377\202\0\200\377\203\0\200\377\203"
+    "\0\7\302]\37\4\16z\377\341\200\0\200\377\200\0\3{\377\364\27\200\0"
+    "\200\377\206\0\200\377\202\0\200\377\200\0\200\377\200\0\0w\201"
+    "\377\200\0\14w\377\307\31\32\311\377t\0q\377\323\11\205\0\2\247"
+    "\377\251\200\0\2\254\377\247\200\0\205\377\0\242\201\0\0\216\204"
+    "\377\200\0\204\377\0\250\201\0\206\377\200\0\200\377\207\0\0\247"
+    "\203\377\0\375\200\0\200\377\202\0\200\377\201\0\204\377\201\0\205"
+    "\377\0\203\200\0\200\377\200\0\3\15\355\377\222\200\0\206\377\200"
+    "\0\200\377\202\0\200\377\200\0\200\377\200\0\1\26\372\200\377\200"
+    "\0\1\17\343\202\377\13\341\15\0\15\337\377\310\77\10\34\237\67\200"
+    "\0\2\342\377k\200\0\2l\377\342\200\0\202\377\3\372\334\216\14\202"
+    "\0\5U\275\357\372\316V\200\0\200\377\4\373\351\271\134\1\201\0\206"
+    "\377\200\0\200\377\207\0\6\4r\324\370\357\263:\200\0\200\377\202\0"
+    "\200\377\201\0\204\377\201\0\7;\240\341\373\364\316u\3\200\0\200"
+    "\377\201\0\4y\377\371\37\0\206\377\200\0\200\377\202\0\200\377\200"
+    "\0\200\377\201\0\0\253\200\377\201\0\5#\262\363\362\261\42\201\0\1"
+    ".\346\203\377\0\272\377\0\226\0\6\23\205\324\366\363\267\65\377\0"
+    "\377\0\377\0\377\0\377\0\377\0\377\0\257\0\201\377\3\373\352\275["
+    "\202\0\1\42\261\200\362\1\260 \201\0\201\377\4\376\361\311o\2\201"
+    "\0\5g\324\371\356\263E\201\0\206\377\200\0\200\377\202\0\200\377"
+    "\200\0\2\345\377j\200\0\6k\377\345\0\360\366\1\202\0\6\3\371\361\0"
+    "\300\377\235\200\0\6\235\377\300\0\272\377\304\202\0\3\305\377\271"
+    "\0\206\377\202\0\201\377\0\344\202\0\2\303\361\17\206\0\0\310\201"
+    "\377\204\0\4\23\331\377\331\23\214\0\205\377\0r\200\0\1\17\342\202"
+    "\377\1\337\14\200\0\205\377\0\207\200\0\0q\204\377\201\0\206\377"
+    "\200\0\200\377\202\0\200\377\200\0\2\257\377\227\200\0\6\230\377"
+    "\257\0\320\377 \202\0\6&\377\323\0@\377\370\200\27\7\370\377@\0/"
+    "\375\377N\200\0\4R\377\375.\0\206\377\202\0\200\377\204\0\2H\377{"
+    "\210\0\200\377\203\0\6\10\304\377\370\377\304\10\213\0\200\377\5\0"
+    "\2\27~\377\336\200\0\7w\377\310\32\33\313\377r\200\0\200\377\5\0\1"
+    "\23z\377\346\200\0\6\340\377e\10\21P\273\204\0\200\377\203\0\200"
+    "\377\202\0\200\377\200\0\2y\377\304\200\0\6\305\377y\0\260\377H"
+    "\202\0\2P\377\265\200\0\5\300\377\202\203\377\301\201\0\7\241\377"
+    "\324\3\4\331\377\240\204\0\3\42\365\377\246\202\0\200\377\205\0\2"
+    "\315\353\12\207\0\200\377\202\0\10\2\254\377\256\25\256\377\254\2"
+    "\212\0\200\377\201\0\2\7\377\372\200\0\2\301\377G\200\0\2K\377\277"
+    "\200\0\200\377\201\0\2\7\377\373\200\0\2\373\377\37\210\0\200\377"
+    "\203\0\200\377\202\0\200\377\200\0\22C\377\361\0\1\361\377C\0\220"
+    "\377p\4\374\373\2y\377\230\200\0\1@\377\200\353\1\377B\201\0\7\35"
+    "\367\377bi\377\366\34\203\0\4\1\276\377\347\22\202\0\200\377\205\0"
+    "\2R\377q\207\0\200\377\202\0\10\217\377\211\1\0\1\207\377\217\212"
+    "\0\200\377\5\0\1\25{\377\336\200\0\2\351\377\25\200\0\2\27\377\347"
+    "\200\0\200\377\200\0\3\22{\377\323\200\0\4\327\377\335g\22\206\0"
+    "\200\377\203\0\200\377\202\0\200\377\200\0\14\16\376\377\37 \377"
+    "\376\16\0p\377\230 \200\377\3\31\243\377z\201\0\0\300\200\377\0"
+    "\302\203\0\5\207\377\343\350\377\206\204\0\0f\200\377\0M\203\0\200"
+    "\377\205\0\3\1\326\345\6\206\0\200\377\227\0\205\377\0r\200\0\2"
+    "\372\377\3\200\0\2\4\377\371\200\0\204\377\1\356D\200\0\1L\370\200"
+    "\377\2\374\276A\204\0\200\377\203\0\200\377\202\0\200\377\201\0\5"
+    "\327\377LM\377\327\200\0\3P\377\300\77\200\374\3\65\314\377\134"
+    "\201\0\0A\200\377\0D\203\0\1\17\353\200\377\1\353\16\203\0\3\34"
+    "\361\377\240\204\0\200\377\206\0\2]\377f\206\0\200\377\227\0\201"
+    "\377\3\374\353\276\134\201\0\2\372\377\3\200\0\2\4\377\374\200\0"
+    "\204\377\0\226\202\0\2'\243\366\200\377\1\375T\203\0\200\377\203\0"
+    "\200\377\202\0\200\377\201\0\5\241\377yz\377\241\200\0\11\60\377"
+    "\350_\322\320R\364\377\77\201\0\0V\200\377\0X\204\0\0n\200\377\0m"
+    "\204\0\3\264\377\343\17\204\0\200\377\206\0\3\4\336\335\3\205\0"
+    "\200\377\227\0\200\377\206\0\2\351\377\25\200\0\2\26\377\355\200\0"
+    "\200\377\5\0\21\230\377\375\42\203\0\4\11M\306\377\325\203\0\200"
+    "\377\203\0\1\376\377\202\0\1\377\376\201\0\5k\377\247\250\377k\200"
+    "\0\0\20\200\377\3\216\236\231\214\200\377\0!\200\0\1\1\320\200\377"
+    "\1\322\1\203\0\0\5\200\377\0\5\203\0\0\134\200\377\0G\205\0\200"
+    "\377\207\0\2g\377\134\205\0\200\377\227\0\200\377\206\0\2\300\377F"
+    "\200\0\2J\377\312\200\0\200\377\200\0\3\4\325\377\213\205\0\2\22"
+    "\377\372\203\0\200\377\203\0\2\357\377\16\200\0\2\16\377\356\201\0"
+    "\5\65\377\324\325\377\65\201\0\10\360\377\326ja\321\377\375\5\200"
+    "\0\5N\377\342\343\377O\204\0\200\377\203\0\3\26\354\377\232\206\0"
+    "\200\377\207\0\3\7\345\325\1\204\0\200\377\227\0\200\377\206\0\7u"
+    "\377\307\31\32\311\377\212\200\0\200\377\201\0\14m\377\354\10\0"
+    "\311j(\7\16s\377\340\203\0\200\377\203\0\2\300\377\227\200\20\2"
+    "\227\377\277\201\0\1\6\370\200\373\1\370\6\201\0\0\320\200\377\4"
+    "\66*\376\377\346\201\0\5\311\377wy\377\312\204\0\200\377\203\0\3"
+    "\252\377\340\15\206\0\200\377\210\0\2r\377Q\204\0\200\377\227\0"
+    "\200\377\206\0\1\16\340\202\377\1\370$\200\0\200\377\201\0\4\26"
+    "\373\377`\0\205\377\0u\203\0\200\377\203\0\0S\204\377\0S\202\0\0"
+    "\311\200\377\0\311\202\0\7\260\377\372\7\2\361\377\310\200\0\7F"
+    "\377\365\21\23\366\377F\203\0\200\377\203\0\206\377\202\0\200\377"
+    "\210\0\2\13\354\313\204\0\200\377\227\0\200\377\207\0\2 \257\362"
+    "\200\377\0\241\201\0\200\377\202\0\12\266\377\312\0\77\247\344\374"
+    "\362\307c\204\0\200\377\204\0\1[\316\200\367\1\316[\203\0\0\223"
+    "\200\377\0\223\202\0\2\220\377\316\200\0\2\274\377\252\200\0\2\302"
+    "\377\227\200\0\2\233\377\302\203\0\200\377\203\0\206\377\202\0\200"
+    "\377\211\0\2|\377G\203\0\200\377\245\0\3\66\361\376O\334\0\200\377"
+    "\211\0\2\20\361\302\203\0\200\377\246\0\2;\273\22\334\0\201\377\0"
+    "\344\215\0\0\310\201\377\377\0\377\0\312\0\210\377\377\0\377\0\276"
+    "\0\2\221\377U\327\0\200\377\206\0\200\377\266\0\3\2\260\352\25\215"
+    "\0\200\377\226\0\200\377\214\0\2I\325\372\200\377\213\0\200\377"
+    "\211\0\200\377\206\0\200\377\203\0\200\377\206\0\202\377\244\0\2"
+    "\12\311\252\215\0\200\377\226\0\200\377\214\0\0\334\202\377\213\0"
+    "\200\377\211\0\200\377\206\0\200\377\203\0\200\377\206\0\202\377"
+    "\266\0\200\377\226\0\200\377\214\0\2\375\377\24\215\0\200\377\232"
+    "\0\200\377\210\0\200\377\255\0\6L\276\364\371\333\204\6\200\0\200"
+    "\377\4-\311\370\327X\202\0\6\17\206\326\367\363\272J\201\0\4Y\327"
+    "\370\311,\200\377\201\0\5/\267\363\366\310N\201\0\205\377\202\0\4J"
+    "\322\370\322B\200\377\200\0\200\377\5-\300\365\356\240\15\201\0"
+    "\202\377\204\0\202\377\203\0\200\377\200\0\3\224\377\371N\202\0"
+    "\200\377\204\0\200\377\5\216\356X\320\357S\200\0\200\377\5.\300"
+    "\365\356\240\15\201\0\1\60\270\200\364\1\270.\214\0\204\377\0\206"
+    "\200\0\200\377\0\344\201\377\1\376G\200\0\1\25\332\204\377\200\0\1"
+    "G\376\201\377\0\344\200\377\200\0\1(\363\203\377\0N\200\0\205\377"
+    "\201\0\1\67\373\201\377\0\363\200\377\200\0\200\377\0\342\202\377"
+    "\0\232\201\0\202\377\204\0\202\377\203\0\200\377\4\0\207\377\367H"
+    "\203\0\200\377\204\0\200\377\2\375\377\374\200\377\0\311\200\0\200"
+    "\377\0\344\202\377\0\231\200\0\1)\363\202\377\1\362&\213\0\6\267F"
+    "\14\11R\377\334\200\0\200\377\5\265\27\25\265\377\270\200\0\7\226"
+    "\377\330C\11\14B\262\200\0\5\271\377\264\25\27\267\200\377\200\0\7"
+    "\246\377i\14\11X\377\311\202\0\200\377\204\0\5\256\377\271\27\31"
+    "\274\200\377\200\0\200\377\5\246\27\10s\377\351\203\0\200\377\206"
+    "\0\200\377\203\0\200\377\3x\377\364B\204\0\200\377\204\0\200\377\0"
+    "\70\200\377\2\70\377\356\200\0\200\377\5\246\27\10s\377\351\200\0"
+    "\2\250\377\264\200\26\2\265\377\246\213\0\2\3^\312\201\377\0\371"
+    "\200\0\200\377\0$\200\0\2%\377\355\200\0\2\344\377\63\205\0\2\356"
+    "\377$\200\0\0&\200\377\200\0\4\350\377\374\375\376\200\377\0\367"
+    "\202\0\200\377\204\0\2\352\377'\200\0\0(\200\377\200\0\200\377\0"
+    "\23\200\0\2\6\377\376\203\0\200\377\206\0\200\377\203\0\202\377\0"
+    "\206\205\0\200\377\204\0\200\377\0\1\200\377\2\1\377\373\200\0\200"
+    "\377\0\24\200\0\2\6\377\376\200\0\2\351\377$\200\0\2%\377\347\212"
+    "\0\1(\323\204\377\200\0\200\377\0\3\200\0\2\4\377\374\200\0\2\373"
+    "\377\5\205\0\2\375\377\3\200\0\0\4\200\377\200\0\0\373\205\377\202"
+    "\0\200\377\204\0\2\374\377\3\200\0\0\4\200\377\200\0\200\377\202\0"
+    "\200\377\203\0\200\377\206\0\200\377\203\0\200\377\3\361\377\362"
+    "\36\204\0\200\377\204\0\200\377\0\0\200\377\0\0\200\377\200\0\200"
+    "\377\202\0\200\377\200\0\2\374\377\3\200\0\2\4\377\373\212\0\5\332"
+    "\377\216 \3\20\200\377\200\0\200\377\0$\200\0\2$\377\354\200\0\2"
+    "\345\377\62\205\0\2\356\377$\200\0\0%\200\377\200\0\2\352\377\24"
+    "\207\0\200\377\204\0\2\356\377&\200\0\0(\200\377\200\0\200\377\202"
+    "\0\200\377\203\0\200\377\206\0\200\377\203\0\200\377\3+\247\377"
+    "\267\204\0\2\375\377\3\203\0\200\377\0\0\200\377\0\0\200\377\200\0"
+    "\200\377\202\0\200\377\200\0\2\351\377$\200\0\2$\377\350\212\0\5"
+    "\362\377L\5\35\247\200\377\200\0\200\377\5\263\26\24\262\377\270"
+    "\200\0\7\231\377\326@\10\12\77\261\200\0\5\271\377\262\24\26\265"
+    "\200\377\200\0\7\251\377\255#\3\25S\277\202\0\200\377\204\0\5\266"
+    "\377\267\26\27\272\200\377\200\0\200\377\202\0\200\377\203\0\200"
+    "\377\206\0\200\377\203\0\200\377\4\0\32\362\377_\203\0\3\351\377T"
+    "\1\202\0\200\377\0\0\200\377\0\0\200\377\200\0\200\377\202\0\200"
+    "\377\200\0\2\250\377\262\200\25\2\263\377\246\212\0\0\243\202\377"
+    "\0\353\200\377\200\0\200\377\0\343\202\377\0I\200\0\1\27\336\204"
+    "\377\200\0\0I\202\377\0\342\200\377\200\0\1)\361\204\377\202\0\200"
+    "\377\204\0\1\77\375\201\377\0\364\200\377\200\0\200\377\202\0\200"
+    "\377\200\0\206\377\203\0\200\377\203\0\200\377\200\0\3s\377\355\27"
+    "\202\0\0\254\202\377\201\0\200\377\0\0\200\377\0\0\200\377\200\0"
+    "\200\377\202\0\200\377\200\0\1*\364\202\377\1\363(\212\0\5\15\231"
+    "\353\371\303\60\200\377\200\0\200\377\4\61\313\371\334^\202\0\6\22"
+    "\212\331\370\364\300O\201\0\4_\334\371\312/\200\377\201\0\6'\245"
+    "\347\373\353\257C\202\0\200\377\205\0\6P\324\371\331K\377\374\200"
+    "\0\200\377\202\0\200\377\200\0\206\377\202\0\2\4\377\374\203\0\200"
+    "\377\200\0\3\4\324\377\254\202\0\2!\304\373\200\377\201\0\200\377"
+    "\0\0\200\377\0\0\200\377\200\0\200\377\202\0\200\377\201\0\1\62"
+    "\272\200\364\1\271\60\310\0\1\261<\200\11\2e\377\340\226\0\2Q\377"
+    "\351\374\0\204\377\0\202\224\0\202\377\0\253\374\0\6M\302\366\370"
+    "\325z\4\224\0\200\377\2\374\306\42\377\0\377\0\377\0\377\0\377\0"
+    "\377\0\240\0\3S\330\372\377\204\0\200\377\204\0\3\377\372\330P\301"
+    "\0\200\377\303\0\2\340\377H\205\0\200\377\205\0\2K\377\337\301\0"
+    "\200\377\303\0\2\375\377\4\205\0\200\377\205\0\2\6\377\375\227\0"
+    "\200\377\4/\311\370\332\134\202\0\4\134\332\370\310-\200\377\201\0"
+    "\200\377\2*\265\362\200\377\200\0\7\10|\317\364\373\342\244>\200\0"
+    "\205\377\201\0\200\377\202\0\200\377\200\0\2\332\377s\200\0\6s\377"
+    "\332\11\372\370\3\202\0\0\3\200\371\10\10\252\377\344\7\10\346\377"
+    "\253\200\0\2\316\377\225\200\0\2\211\377\325\200\0\206\377\203\0"
+    "\200\377\206\0\200\377\206\0\200\377\227\0\200\377\0\343\201\377\1"
+    "\376G\200\0\0G\202\377\0\342\200\377\201\0\200\377\0\346\202\377"
+    "\200\0\0\257\205\377\200\0\205\377\201\0\200\377\202\0\200\377\200"
+    "\0\2\217\377\261\200\0\6\262\377\216\0\312\377$\202\0\13&\377\304"
+    "\0\25\352\377ln\377\353\25\200\0\7j\377\352\4\0\313\377\200\200\0"
+    "\205\377\0\371\203\0\200\377\206\0\200\377\206\0\200\377\227\0\200"
+    "\377\5\265\27\25\265\377\270\200\0\5\271\377\264\25\27\267\200\377"
+    "\201\0\200\377\2\273\60\5\202\0\7\371\377R\11\5!^\302\202\0\200"
+    "\377\204\0\200\377\202\0\200\377\200\0\2C\377\356\200\2\15\357\377"
+    "B\0\221\377M\5\370\372\6O\377\207\200\0\1S\377\200\344\1\377W\201"
+    "\0\7\17\366\377I\17\374\377+\204\0\3b\376\373P\202\0\2\20\377\370"
+    "\206\0\200\377\206\0\2\371\377\17\202\0\7i\337\371\306^\17\36\240"
+    "\212\0\200\377\0$\200\0\2%\377\354\200\0\2\356\377$\200\0\0&\200"
+    "\377\201\0\200\377\0\31\204\0\6\314\377\372\327\264\205.\203\0\200"
+    "\377\204\0\200\377\202\0\200\377\200\0\14\5\362\377/\60\377\361\5"
+    "\0W\377u\63\200\377\3\63x\377J\201\0\0\250\200\377\0\255\203\0\5"
+    "\241\377\243N\377\326\204\0\3^\375\374T\202\0\3\4s\377\302\206\0"
+    "\200\377\206\0\3\303\377s\4\201\0\206\377\212\0\200\377\0\3\200\0"
+    "\2\4\377\374\200\0\2\375\377\3\200\0\0\4\200\377\201\0\200\377\0\1"
+    "\204\0\2#\264\372\201\377\1\375^\202\0\200\377\204\0\200\377\202\0"
+    "\200\377\201\0\5\254\377mn\377\253\200\0\11\36\377\236g\347\350f"
+    "\241\375\17\201\0\0I\200\377\0Q\203\0\5=\377\363\231\377\202\203\0"
+    "\0Y\200\375\0Y\203\0\200\377\1\342(\206\0\200\377\206\0\1'\341\200"
+    "\377\201\0\7\233\36\7F\257\364\342k\212\0\200\377\0$\200\0\2$\377"
+    "\355\200\0\2\356\377$\200\0\0%\200\377\201\0\200\377\207\0\5\7#L"
+    "\233\377\340\202\0\200\377\204\0\200\377\0\5\200\0\0\23\200\377"
+    "\201\0\5a\377\254\255\377`\201\0\7\344\306\233\256\257\231\312\320"
+    "\201\0\1\4\323\200\377\1\326\5\203\0\4\330\377\373\377-\202\0\3U"
+    "\374\375^\204\0\3\4i\377\277\206\0\200\377\206\0\3\277\377i\4\225"
+    "\0\200\377\5\263\26\24\262\377\271\200\0\5\272\377\262\24\26\265"
+    "\200\377\201\0\200\377\205\0\7\307f%\6\7F\377\372\202\0\2\366\377"
+    "\65\203\0\5\353\377m\7\25\243\200\377\201\0\1\27\376\200\352\1\376"
+    "\26\201\0\7\253\356\320uv\314\362\223\201\0\5v\377\304\312\377y"
+    "\203\0\0t\200\377\0\330\202\0\3Q\373\376b\206\0\2\11\377\367\206\0"
+    "\200\377\206\0\2\371\377\11\226\0\200\377\0\344\202\377\0H\200\0\0"
+    "I\202\377\0\344\200\377\201\0\200\377\205\0\205\377\0\273\202\0\0"
+    "\307\202\377\201\0\0\232\202\377\0\345\200\377\202\0\0\312\200\377"
+    "\0\311\202\0\7r\377\376<=\376\377V\200\0\7\36\364\377TX\377\365\37"
+    "\202\0\3\25\372\377\203\202\0\0\372\205\377\203\0\200\377\206\0"
+    "\200\377\206\0\200\377\227\0\200\377\4.\313\371\330[\202\0\4[\330"
+    "\371\313.\200\377\201\0\200\377\205\0\7\70\232\333\372\371\334\223"
+    "\22\202\0\2\64\311\370\200\377\201\0\5\15\237\357\366\302\60\200"
+    "\377\202\0\0~\200\377\0}\202\0\2\71\377\372\200\11\2\372\377\32"
+    "\200\0\7\261\377\340\3\4\341\377\261\202\0\3\7\361\377/\202\0\206"
+    "\377\203\0\200\377\206\0\200\377\206\0\200\377\227\0\200\377\214\0"
+    "\200\377\307\0\3\1i\377\332\220\0\2\375\377\4\205\0\200\377\205\0"
+    "\2\6\377\375\227\0\200\377\214\0\200\377\307\0\201\377\0x\220\0\2"
+    "\340\377F\205\0\200\377\205\0\2K\377\337\227\0\200\377\214\0\200"
+    "\377\307\0\3\377\375\264\10\220\0\3U\332\372\377\204\0\200\377\204"
+    "\0\3\377\372\332S\377\0\221\0\200\377\240\0"
 };
 #endif
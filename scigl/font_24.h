@@ -1,4 +1,4 @@
-/* This file has been generated by makefont.py */
+/* This file has been generated by makefont.py and rle-font.py */
 
 #ifndef __FONT_24__
 #define __FONT_24__
@@ -6,2803 +6,1258 @@
 static const struct {
     unsigned int width;
     unsigned int height;
-    unsigned char data[224*336+1];
+    unsigned int length;
+    unsigned char data[25875+1];
 } font_24 = {
-    224, 336,
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0"
-    "\0\0\0\0\0\0\377\377\0\0\377\377\0\0\0\0\0\0\0\0\0\52\377\251\0\0"
-    "\207\377\111\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0\135\330\371\324\127"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\102\277\364\364\270\107\0\0\0\0\0\0\0\0\0"
-    "\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\37\367\272\0\0\0\0\0\0\0\0\273"
-    "\367\36\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\72\377\306\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0"
-    "\0\377\377\0\0\377\377\0\0\0\0\0\0\0\0\0\147\377\154\0\0\305\375\17"
-    "\0\0\0\0\0\0\0\0\377\1\0\0\0\0\0\135\377\377\377\377\377\126\0\0\0"
-    "\0\0\0\0\0\0\0\106\375\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\0\0\242\377\64\0\0\0\0\0\0\0\0\66\377\240"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\255\377\122\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\0\0\377\377\0\0\0\0\0\0\0\0\0\244\377\57\0\10\371\317\0\0\0\0\0\0"
-    "\0\0\0\377\3\0\0\0\0\0\330\377\170\14\170\377\324\0\0\0\0\0\0\0\0"
-    "\0\0\310\377\252\34\6\65\253\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\42\374\274\0\0\0\0\0\0\0\0\0\0\277\373\41\0\0\0\0\0"
-    "\0\0\0\236\236\45\0\0\377\0\0\45\236\235\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\43\375\334\2\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\0\0\377\377\0\0\0\0\0\0\0\0\0\341\360\2\0\100\377\222\0\0\0\0\0\10"
-    "\160\303\360\377\360\305\204\57\0\0\372\377\13\0\14\377\371\0\0\0"
-    "\0\0\0\0\0\0\0\370\377\22\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\216\377\123\0\0\0\0\0\0\0\0\0\0\127\377\213\0"
-    "\0\0\0\0\0\0\0\73\253\371\245\53\377\53\246\371\253\73\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\223\377\154\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0"
-    "\0\0\0\377\377\0\0\377\377\0\0\0\0\0\0\0\0\36\377\266\0\0\175\377"
-    "\126\0\0\0\0\26\323\377\377\376\377\377\377\377\377\0\0\331\377\163"
-    "\13\170\377\327\0\0\0\0\0\51\7\0\0\0\362\377\22\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\4\353\361\6\0\0\0\0\0\0\0"
-    "\0\0\0\11\364\350\3\0\0\0\0\0\0\0\0\0\36\212\354\377\354\212\36\0"
-    "\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\21\364\356\13\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\377\377\0\0\377\377\0\0\0\0\0\260\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\0\0\241\377\326\103\6\377"
-    "\14\63\165\316\0\0\140\377\377\377\377\377\133\0\0\0\10\204\371\126"
-    "\0\0\0\273\377\140\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0"
-    "\0\0\0\0\0\102\377\253\0\0\0\0\0\0\0\0\0\0\0\0\260\377\76\0\0\0\0"
-    "\0\0\0\0\0\34\210\354\377\354\210\34\0\0\0\0\0\0\0\0\0\377\377\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\172\377\206\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\0\0\377\377\0\0\0\0\0\260\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\0\0\356\377\52\0\0\377\0\0\0\0\0\0\0\140\331\372\330"
-    "\133\0\0\0\105\334\344\123\0\0\0\0\117\377\340\13\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\206\377\155\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\161\377\202\0\0\0\0\0\0\0\70\250\370\246\53\377\54\247"
-    "\370\250\70\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\6\346\371\31\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\306"
-    "\375\17\0\46\377\255\0\0\0\0\0\367\377\11\0\0\377\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\27\246\374\223\15\0\0\0\0\0\106\374\377\236\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\272\377\76\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\101\377\270\0\0\0\0\0\0\0\237\237\45\0\0\377\0\0\45\237"
-    "\237\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\140\377\237\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\367"
-    "\366\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\11\371\320\0\0"
-    "\143\377\157\0\0\0\0\0\300\377\201\1\0\377\0\0\0\0\0\0\0\0\0\0\0\1"
-    "\147\357\316\64\0\0\0\0\0\0\120\373\343\365\377\157\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\340\377\34\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\37\377\336\0\0\0\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\322\377\55"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\353\352\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\100\377\223\0\0\240\377\61"
-    "\0\0\0\0\0\65\365\377\331\225\377\57\4\0\0\0\0\0\0\0\0\55\306\363"
-    "\162\3\0\0\0\0\0\0\40\364\347\35\125\376\374\106\0\0\0\6\377\374\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\366\377\10\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\11\377\365\0\0\0\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\106\377\271\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\337\336\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\175\377\126"
-    "\0\0\335\360\2\0\0\0\0\0\0\53\262\373\377\377\377\357\225\27\0\0\0"
-    "\0\12\211\373\260\35\0\0\0\0\0\0\0\0\227\377\136\0\0\201\377\357\47"
-    "\0\0\6\377\354\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\376\377\2\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\2\377\375\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\377\377\377\377\377\377\377\377\377\377\377\377\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\272\377\106\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\322\322\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\377\377\377\377\377\377\377\377\377\377\377\377\260\0\0\0\0"
-    "\0\0\21\110\377\255\352\377\347\44\0\0\112\337\343\121\0\0\0\135\330"
-    "\371\322\121\0\0\342\377\17\0\0\1\254\377\331\20\0\51\377\311\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\366\377\10\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\11\377\364\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377"
-    "\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\56\377\321\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\260\0\0\0\0\0\0\0\0\377\0\5\217\377\264\0\21\365\220"
-    "\14\0\0\0\135\377\377\377\377\377\117\0\373\377\10\0\0\0\13\317\377"
-    "\272\3\211\377\206\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\337\377\35"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\40\377\335\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\240\377\137\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\56\377\245\0\0\213"
-    "\377\105\0\0\0\0\0\0\0\0\0\0\0\377\0\0\14\377\364\0\0\31\0\0\0\0\0"
-    "\330\377\166\14\173\377\320\0\352\377\75\0\0\0\0\36\351\377\275\374"
-    "\371\35\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\271\377\77\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\102\377\267\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\31\371\346\6"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\153\377\150\0\0\311\374\14\0"
-    "\0\0\0\0\0\0\0\0\0\0\377\0\0\50\377\354\0\0\0\0\0\0\0\0\372\377\13"
-    "\0\14\377\371\0\251\377\302\4\0\0\0\0\116\377\377\377\156\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\206\377\156\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\163\377\203\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\206\377\171\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\250\377\53\0\13\373\313\0"
-    "\0\0\0\0\0\0\321\172\67\13\0\377\12\104\323\377\230\0\0\0\0\0\0\0"
-    "\0\331\377\163\13\170\377\327\0\60\372\377\301\75\10\33\160\351\377"
-    "\377\377\204\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\102\377\254\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\262\377\77\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0"
-    "\0\0\13\356\364\21\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\345\355"
-    "\1\0\104\377\216\0\0\0\0\0\0\0\377\377\377\377\364\377\377\377\377"
-    "\307\17\0\0\0\0\0\0\0\0\141\377\377\377\377\377\133\0\0\126\367\377"
-    "\377\377\377\377\377\356\200\376\370\43\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\4\353\362\7\0\0\0\0\0\0\0\0\0\0\12\365\351\3\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\10\377\377\357\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\377\377\377\0\0\0\0\0\0\0\155\377\222\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\42\377\262\0\0\201\377\122\0\0\0\0\0\0\0\52\167\263"
-    "\335\366\377\357\303\152\5\0\0\0\0\0\0\0\0\0\0\141\332\372\327\133"
-    "\0\0\0\0\47\233\340\372\361\311\175\23\0\237\377\264\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\216\377\124\0\0\0\0\0\0\0\0\0\0\132\377\214"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\73\377\377\211\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\2\335\375\42\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\3\377"
-    "\2\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\42\374\275\0\0\0\0\0\0"
-    "\0\0\0\0\301\374\42\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\164\377\373\35\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\123\377\254\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\2\377\1\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\242\377"
-    "\64\0\0\0\0\0\0\0\0\70\377\241\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\254\377\250\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\306\377"
-    "\71\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\1\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\37\370\272\0\0\0\0\0\0\0\0\274\367\37\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\344\377\70\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\30\231\345\374\345\230\27\0\0\0\0\0\0\42\146\252\354\377\377"
-    "\0\0\0\0\0\0\0\54\175\273\345\371\366\331\231\53\0\0\0\0\0\0\52\172"
-    "\275\353\373\351\262\110\0\0\0\0\0\0\0\0\0\0\46\370\377\377\0\0\0"
-    "\0\0\0\377\377\377\377\377\377\377\377\377\0\0\0\0\0\0\0\104\257\351"
-    "\374\350\251\101\0\0\0\0\377\377\377\377\377\377\377\377\377\377\377"
-    "\0\0\0\0\1\134\274\354\373\354\274\133\1\0\0\0\0\0\0\117\273\356\373"
-    "\341\230\33\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\53\243\351\373\342\232\33\0\0\0"
-    "\0\0\0\35\343\377\377\377\377\377\343\34\0\0\0\0\0\377\377\377\377"
-    "\377\377\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377\373\155\0\0"
-    "\0\0\0\377\377\377\377\377\377\377\377\217\0\0\0\0\0\0\0\0\0\275\355"
-    "\377\377\0\0\0\0\0\0\377\377\377\377\377\377\377\377\377\0\0\0\0\0"
-    "\0\216\377\377\377\377\377\377\377\0\0\0\0\377\377\377\377\377\377"
-    "\377\377\377\377\317\0\0\0\5\260\377\377\377\377\377\377\377\256\4"
-    "\0\0\0\0\203\377\377\377\377\377\377\352\50\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\156"
-    "\372\377\377\377\377\377\350\40\0\0\0\0\0\270\377\313\64\10\64\315"
-    "\377\270\0\0\0\0\0\340\240\140\40\377\377\0\0\0\0\0\0\0\331\216\122"
-    "\47\13\4\42\204\374\377\112\0\0\0\0\322\175\75\24\4\26\150\363\377"
-    "\134\0\0\0\0\0\0\0\134\377\152\377\377\0\0\0\0\0\0\377\377\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\155\377\372\206\46\6\24\120\272\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\300\377\147\0\0\0\166\377\363\152\31\4\31\152\363\377\164\0"
-    "\0\0\74\377\376\206\36\5\45\236\377\313\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\334"
-    "\141\24\10\106\336\377\246\0\0\0\0\57\377\356\26\0\0\0\30\360\377"
-    "\56\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\167\377"
-    "\300\0\0\0\0\0\0\0\0\0\0\0\136\377\307\0\0\0\0\0\0\20\351\320\3\377"
-    "\377\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\16\360\377\130\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\50\377\363\15\0\0\0\326\377\135\0\0"
-    "\0\0\0\135\377\325\0\0\0\245\377\221\0\0\0\0\0\250\377\76\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\231\10\0\0\0\0\65\377\354\0\0\0\0\201\377\221\0\0\0\0\0\225"
-    "\377\177\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\25"
-    "\377\363\0\0\0\0\0\0\0\0\0\0\0\16\377\364\0\0\0\0\0\0\230\377\77\0"
-    "\377\377\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\143\377\272\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\216\377\230\0\0\0\0\371\377\15\0"
-    "\0\0\0\0\16\377\370\0\0\0\340\377\55\0\0\0\0\0\66\377\213\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\10\377\370\0\0\0\0\271\377\116\0\0\0\0\0\120"
-    "\377\270\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\13"
-    "\377\377\5\0\0\0\0\0\0\0\0\0\0\16\377\365\0\0\0\0\0\67\375\251\0\0"
-    "\377\377\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\250\377\136\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\10\355\377\61\0\0\0\0\357\377\13\0"
-    "\0\0\0\0\14\377\356\0\0\0\370\377\7\0\0\0\0\0\11\377\276\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\10\137\312\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\312\137\10\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\127\377\317\0\0\0\0\336\377\45\0\0\0"
-    "\0\0\47\377\334\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\104\377\356\0\0\0\0\0\0\0\0\0\0\0\154\377\301\0\0\0\0\3\317\365"
-    "\35\0\0\377\377\0\0\0\0\0\0\377\377\311\366\366\330\220\35\0\0\0\0"
-    "\0\325\377\51\111\310\371\360\276\122\0\0\0\0\0\0\0\0\0\0\0\135\377"
-    "\311\0\0\0\0\0\256\377\131\0\0\0\0\0\133\377\253\0\0\0\370\377\7\0"
-    "\0\0\0\0\11\377\340\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0"
-    "\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\42\212\354\377\377\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\354\212\41\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\57\356\377\142\0\0\0\0\364\377\14\0\0\0\0\0\16\377\362"
-    "\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\1\301\377\234"
-    "\0\0\0\0\0\0\0\0\6\51\206\373\374\103\0\0\0\0\162\377\175\0\0\0\377"
-    "\377\0\0\0\0\0\0\377\377\377\377\377\377\377\361\103\0\0\0\0\361\377"
-    "\143\376\377\377\377\377\377\204\0\0\0\0\0\0\0\0\0\0\304\377\142\0"
-    "\0\0\0\0\52\362\361\150\27\3\30\151\363\361\47\0\0\0\337\377\53\0"
-    "\0\0\0\0\66\377\363\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0"
-    "\0\377\377\377\0\0\0\0\0\0\0\0\0\0\2\112\265\375\377\377\305\137\0"
-    "\0\377\377\377\377\377\377\377\377\377\377\377\377\0\0\137\306\377"
-    "\377\375\264\112\2\0\0\0\0\0\0\0\0\0\0\0\0\74\357\377\257\0\0\0\0"
-    "\0\376\377\3\0\254\367\250\0\4\377\375\0\0\0\0\0\0\0\0\377\377\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\200\377\363\36\0\0\0\0\0\0\377\377\377\377"
-    "\377\324\110\0\0\0\0\34\363\337\10\0\0\0\377\377\0\0\0\0\0\0\277\131"
-    "\34\5\20\112\310\377\360\34\0\0\0\375\377\354\234\45\5\36\205\376"
-    "\377\74\0\0\0\0\0\0\0\0\53\377\360\12\0\0\0\0\0\0\55\274\377\377\377"
-    "\377\377\274\55\0\0\0\0\245\377\215\0\0\0\0\0\250\377\375\0\0\0\0"
-    "\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0"
-    "\0\23\165\335\377\377\356\221\53\0\0\0\0\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\0\0\0\0\53\221\356\377\377\335\164\22\0\0\0\0"
-    "\0\0\0\0\0\51\362\377\254\7\0\0\0\0\0\376\377\3\0\257\370\252\0\4"
-    "\377\375\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\141\377"
-    "\377\131\0\0\0\0\0\0\0\377\377\377\377\377\331\110\0\0\0\0\256\377"
-    "\122\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\5\303\377\216\0\0\0\376"
-    "\377\245\0\0\0\0\0\222\377\245\0\0\0\0\0\0\0\0\222\377\223\0\0\0\0"
-    "\0\0\0\121\337\377\377\377\377\377\337\121\0\0\0\0\76\377\375\201"
-    "\35\5\45\236\355\377\374\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0"
-    "\0\0\0\377\377\377\0\0\0\0\0\0\65\237\367\377\377\303\135\10\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\10\135\303\377\377\367"
-    "\237\65\0\0\0\0\0\0\0\261\377\241\2\0\0\0\0\0\0\364\377\14\0\0\0\0"
-    "\0\16\377\362\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\134"
-    "\375\377\171\0\0\0\0\0\0\0\0\0\0\6\54\214\375\373\73\0\0\113\377\273"
-    "\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\100\377\327\0\0\0\364"
-    "\377\64\0\0\0\0\0\55\377\337\0\0\0\0\0\0\0\12\357\377\53\0\0\0\0\0"
-    "\0\102\375\364\155\31\4\32\161\366\375\102\0\0\0\0\210\377\377\377"
-    "\377\377\376\145\377\357\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\377\377\354\217\51\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\51\217\354\377\377\0\0\0\0\0\0\0"
-    "\357\377\27\0\0\0\0\0\0\0\336\377\45\0\0\0\0\0\47\377\334\0\0\0\0"
-    "\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\135\375\377\200\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\161\377\271\0\0\337\373\53\0\0\0\0\0\377\377\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\12\377\366\0\0\0\341\377\10\0\0\0\0\0\7\377"
-    "\367\0\0\0\0\0\0\0\141\377\304\0\0\0\0\0\0\0\273\377\136\0\0\0\0\0"
-    "\142\377\273\0\0\0\0\0\123\277\360\372\313\114\52\377\324\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\347\207"
-    "\43\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\44"
-    "\207\347\377\377\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\271\377\116"
-    "\0\0\0\0\0\120\377\270\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0"
-    "\142\375\377\172\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\17\377\361\0\0\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0"
-    "\12\377\365\0\0\0\300\377\10\0\0\0\0\0\7\377\367\0\0\0\0\0\0\0\310"
-    "\377\134\0\0\0\0\0\0\0\361\377\14\0\0\0\0\0\15\377\360\0\0\0\0\0\0"
-    "\0\0\0\0\0\137\377\246\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\65\240\367\377\376\275\130\7\0\0\0\0\0\0\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\0\0\0\0\0\0\7\131\275\376"
-    "\377\367\240\65\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\201\377\221"
-    "\0\0\0\0\0\225\377\177\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\151"
-    "\376\376\160\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\21\377\367\0\0\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\75"
-    "\377\324\0\0\0\214\377\64\0\0\0\0\0\55\377\335\0\0\0\0\0\0\57\377"
-    "\354\10\0\0\0\0\0\0\0\372\377\15\0\0\0\0\0\16\377\371\0\0\0\0\0\0"
-    "\0\0\0\0\0\272\377\141\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\23\166\336\377\377\354\217\53\0\0\0\0\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\0\0\0\0\54\220\355\377\377"
-    "\335\165\23\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\60\377\356\25\0"
-    "\0\0\27\360\377\56\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\162\377"
-    "\375\143\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\162\377\317\0\0\0\0\0\0"
-    "\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\3\274\377\211\0\0\0\100\377"
-    "\245\0\0\0\0\0\220\377\243\0\0\0\0\0\0\227\377\215\0\0\0\0\0\0\0\0"
-    "\331\377\141\0\0\0\0\0\140\377\327\0\0\0\0\0\0\0\0\0\0\125\377\357"
-    "\15\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0"
-    "\0\0\0\0\0\0\0\0\0\2\113\266\375\377\377\306\142\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\142\306\377\377\375\265\113\2\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\270\377\313\63\10\63\314\377\270\0\0\0\0\0"
-    "\0\0\0\0\377\377\0\0\0\0\0\0\0\173\377\372\126\0\0\0\0\0\0\0\0\0\0"
-    "\322\176\77\27\4\11\57\215\375\377\146\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\0\0\0\0\0\317\167\70\22\3\17\107\302\377\353\26\0\0\0\1\316\377\234"
-    "\45\5\35\203\376\376\71\0\0\0\0\0\14\362\377\47\0\0\0\0\0\0\0\0\176"
-    "\377\365\156\31\3\31\156\365\377\172\0\0\0\0\271\114\22\5\45\204\371"
-    "\377\153\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\0\0\42\213\355\377\377\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\377\377\354\213\42\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\0\0\0\0\0\0\0\0\0\36\344\377\377\377\377\377\343\35\0\0\0\0\0"
-    "\377\377\377\377\377\377\377\377\377\377\0\0\0\377\377\377\377\377"
-    "\377\377\377\377\377\377\40\0\0\377\377\377\377\377\377\377\377\377"
-    "\222\1\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\377\377\377\377\377\377"
-    "\377\377\347\66\0\0\0\0\0\53\354\377\377\377\377\377\377\177\0\0\0"
-    "\0\0\0\145\377\276\0\0\0\0\0\0\0\0\0\10\273\377\377\377\377\377\377"
-    "\377\270\6\0\0\0\0\377\377\377\377\377\377\377\216\0\0\0\0\0\0\0\0"
-    "\0\377\377\377\0\0\0\0\0\0\0\0\0\0\10\377\377\357\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\10\140\313\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\313\140"
-    "\10\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\30"
-    "\231\347\375\346\231\30\0\0\0\0\0\0\377\377\377\377\377\377\377\377"
-    "\377\377\0\0\0\377\377\377\377\377\377\377\377\377\377\377\40\0\0"
-    "\55\200\277\347\372\367\336\244\77\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\0\0\0\0\0\70\226\320\360\374\362\314\176\23\0\0\0\0\0\0\0\36\232"
-    "\343\374\357\273\115\0\0\0\0\0\0\0\314\377\127\0\0\0\0\0\0\0\0\0\0"
-    "\3\144\300\356\374\356\277\142\2\0\0\0\0\0\103\256\352\374\351\260"
-    "\104\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\73\377\377"
-    "\211\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\164\377\373\35"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\254\377\250\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\344\377\70\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\146\377\377\145\0\0"
-    "\0\0\0\0\377\377\377\377\377\363\313\164\6\0\0\0\0\0\0\0\0\33\213"
-    "\324\367\371\336\240\74\0\0\0\377\377\377\375\355\307\201\33\0\0\0"
-    "\0\0\0\377\377\377\377\377\377\377\377\377\377\377\0\0\0\377\377\377"
-    "\377\377\377\377\377\377\377\377\0\0\0\0\0\0\40\222\330\371\370\332"
-    "\235\73\0\0\0\377\377\0\0\0\0\0\0\0\377\377\0\0\0\0\377\377\377\377"
-    "\377\377\377\377\377\377\0\0\0\0\0\0\0\377\377\377\377\377\377\0\0"
-    "\0\0\377\377\0\0\0\0\0\0\47\352\377\261\4\0\377\377\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\377\377\377\44\0\0\0\0\45\377\377\377\0\0\377\377\354\10"
-    "\0\0\0\0\0\377\377\0\0\0\0\0\13\175\323\370\370\323\175\12\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\251\377\377\250\0\0\0\0\0\0\377"
-    "\377\377\377\377\377\377\377\304\11\0\0\0\0\0\0\117\362\377\377\377"
-    "\377\377\377\377\0\0\0\377\377\377\377\377\377\377\365\141\0\0\0\0"
-    "\0\377\377\377\377\377\377\377\377\377\377\377\0\0\0\377\377\377\377"
-    "\377\377\377\377\377\377\377\0\0\0\0\0\126\365\377\377\377\377\377"
-    "\377\377\0\0\0\377\377\0\0\0\0\0\0\0\377\377\0\0\0\0\377\377\377\377"
-    "\377\377\377\377\377\377\0\0\0\0\0\0\0\377\377\377\377\377\377\0\0"
-    "\0\0\377\377\0\0\0\0\0\34\341\377\300\10\0\0\377\377\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\377\377\377\164\0\0\0\0\167\377\377\377\0\0\377\377\377"
-    "\137\0\0\0\0\0\377\377\0\0\0\0\22\322\377\377\377\377\377\377\321"
-    "\22\0\0\0\0\0\0\35\204\313\362\373\344\243\53\0\0\0\0\0\0\1\352\377"
-    "\377\352\1\0\0\0\0\0\377\377\0\0\0\15\107\333\377\176\0\0\0\0\0\65"
-    "\371\376\233\62\11\11\53\151\307\0\0\0\377\377\0\5\27\106\242\376"
-    "\376\124\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\73\373\375\224\56\10\12\52\150\306\0\0\0\377\377"
-    "\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\377\377\0\0\0\0\377\377\0\0\0\0\24\327\377\315\16\0\0\0"
-    "\377\377\0\0\0\0\0\0\0\0\0\0\0\0\377\377\334\305\0\0\0\0\311\333\377"
-    "\377\0\0\377\377\377\312\0\0\0\0\0\377\377\0\0\0\0\252\377\332\113"
-    "\15\15\113\332\377\251\0\0\0\0\0\157\367\377\377\377\377\377\377\370"
-    "\122\0\0\0\0\0\60\377\342\342\377\57\0\0\0\0\0\377\377\0\0\0\0\0\75"
-    "\377\325\0\0\0\0\1\320\377\163\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0"
-    "\0\132\377\347\10\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\2\325\377\153\0\0\0\0\0\0\0\0\0\0\377\377\0"
-    "\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\377\377\0\0\0\0\377\377\0\0\0\14\312\377\331\25\0\0\0\0\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\0\377\377\213\375\30\0\0\34\376\212\377"
-    "\377\0\0\377\377\316\377\64\0\0\0\0\377\377\0\0\0\50\377\360\34\0"
-    "\0\0\0\35\360\376\47\0\0\0\204\377\377\245\77\16\6\62\263\377\365"
-    "\43\0\0\0\0\163\377\237\240\377\162\0\0\0\0\0\377\377\0\0\0\0\0\7"
-    "\377\367\0\0\0\0\102\377\317\1\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0"
-    "\0\0\265\377\133\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\106\377\313\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0"
-    "\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\377\377\0\0\0\0\377\377\0\0\7\274\377\343\36\0\0\0\0\0\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\0\377\377\72\377\147\0\0\155\377\71\377"
-    "\377\0\0\377\377\143\377\237\0\0\0\0\377\377\0\0\0\175\377\217\0\0"
-    "\0\0\0\0\217\377\174\0\0\115\377\372\123\0\0\0\0\0\1\270\377\225\0"
-    "\0\0\0\266\377\133\134\377\266\0\0\0\0\0\377\377\0\0\0\0\0\15\377"
-    "\366\0\0\0\0\225\377\160\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0"
-    "\136\377\244\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\227\377\156\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0"
-    "\0\0\0\377\377\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\377\377\0\0\0\0\377\377\0\3\255\377\353\50\0\0\0\0\0\0\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\377\377\2\347\270\0\0\276\346\1\377\377\0"
-    "\0\377\377\11\356\366\22\0\0\0\377\377\0\0\0\266\377\112\0\0\0\0\0"
-    "\0\113\377\266\0\3\334\377\166\0\0\0\0\0\0\0\72\377\331\0\0\0\5\364"
-    "\377\31\32\377\364\5\0\0\0\0\377\377\0\0\0\0\0\116\377\315\0\0\0\0"
-    "\311\377\66\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\54\377\322\0"
-    "\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\312\377\65\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\377\377"
-    "\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0"
-    "\0\0\377\377\0\234\377\362\64\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\377\377\0\227\372\17\23\374\226\0\377\377\0\0\377\377\0"
-    "\215\377\164\0\0\0\377\377\0\0\0\335\377\41\0\0\0\0\0\0\43\377\333"
-    "\0\114\377\336\4\0\0\21\230\352\363\253\36\377\366\0\0\0\75\377\325"
-    "\0\0\326\377\74\0\0\0\0\377\377\0\0\0\16\120\345\377\146\0\0\0\0\352"
-    "\377\22\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\17\377\357\0\0\0"
-    "\377\377\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\353"
-    "\377\22\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\377\377\0\0\0"
-    "\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\377"
-    "\377\212\377\377\215\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\377\377\0\106\377\132\142\377\105\0\377\377\0\0\377\377\0\44\376"
-    "\334\1\0\0\377\377\0\0\0\364\377\13\0\0\0\0\0\0\14\377\362\0\231\377"
-    "\176\0\0\11\320\377\377\377\377\312\377\377\0\0\0\200\377\222\0\0"
-    "\223\377\200\0\0\0\0\377\377\377\377\377\377\377\350\165\0\0\0\0\0"
-    "\371\377\5\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\3\377\373\0\0"
-    "\0\377\377\377\377\377\377\377\377\377\377\0\0\0\0\377\377\377\377"
-    "\377\377\377\377\377\377\0\0\0\0\371\377\5\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\377\377\377\377\377\377\377\377\377\0\0\0\0\0\0\0\0\377\377\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\377\377\377\373\377\366"
-    "\45\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\5\357"
-    "\253\264\356\5\0\377\377\0\0\377\377\0\0\270\377\111\0\0\377\377\0"
-    "\0\0\376\377\1\0\0\0\0\0\0\2\377\375\0\316\377\100\0\0\172\377\343"
-    "\74\6\74\343\377\377\0\0\0\304\377\117\0\0\120\377\303\0\0\0\0\377"
-    "\377\377\377\377\377\377\371\265\51\0\0\0\0\371\377\5\0\0\0\0\0\0"
-    "\0\0\0\0\0\377\377\0\0\0\0\0\0\3\377\374\0\0\0\377\377\377\377\377"
-    "\377\377\377\377\377\0\0\0\0\377\377\377\377\377\377\377\377\377\377"
-    "\0\0\0\0\371\377\5\0\0\0\0\377\377\377\377\377\0\0\377\377\377\377"
-    "\377\377\377\377\377\377\377\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\377\377\0\0\0\0\377\377\376\130\241\377\302\1\0\0"
-    "\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\243\364\370\242"
-    "\0\0\377\377\0\0\377\377\0\0\115\377\264\0\0\377\377\0\0\0\376\377"
-    "\1\0\0\0\0\0\0\2\377\375\0\356\377\27\0\0\321\377\115\0\0\0\115\377"
-    "\377\0\0\14\372\374\17\0\0\20\375\372\13\0\0\0\377\377\0\0\0\11\52"
-    "\177\370\357\44\0\0\0\353\377\22\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0"
-    "\0\0\0\0\17\377\357\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\352\377\23\0\0\0\0\377\377\377\377\377\0"
-    "\0\377\377\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\377\377\155\0\21\347\377\155"
-    "\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\122\377\377"
-    "\121\0\0\377\377\0\0\377\377\0\0\2\337\375\40\0\377\377\0\0\0\364"
-    "\377\13\0\0\0\0\0\0\14\377\362\0\374\377\6\0\0\367\377\13\0\0\0\13"
-    "\377\377\0\0\112\377\311\0\0\0\0\312\377\112\0\0\0\377\377\0\0\0\0"
-    "\0\0\146\377\247\0\0\0\313\377\65\0\0\0\0\0\0\0\0\0\0\0\377\377\0"
-    "\0\0\0\0\0\53\377\323\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\311\377\67\0\0\0\0\0\0\0\377\377\0\0\377"
-    "\377\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\377\377\0\0\0\0\377\377\0\0\0\117\377\364\41\0\0\0"
-    "\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\12\366\366\12\0\0"
-    "\377\377\0\0\377\377\0\0\0\167\377\211\0\377\377\0\0\0\335\377\41"
-    "\0\0\0\0\0\0\42\377\333\0\374\377\10\0\0\367\377\12\0\0\0\13\377\377"
-    "\0\0\216\377\377\377\377\377\377\377\377\215\0\0\0\377\377\0\0\0\0"
-    "\0\0\21\377\352\0\0\0\227\377\160\0\0\0\0\0\0\0\0\0\0\0\377\377\0"
-    "\0\0\0\0\0\136\377\245\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\225\377\162\0\0\0\0\0\0\0\377\377\0\0\377"
-    "\377\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\10\377\372\0\0\0\0\377\377\0\0\0\0\246\377\276\1\0\0"
-    "\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\377\377"
-    "\0\0\377\377\0\0\0\24\370\353\7\377\377\0\0\0\270\377\112\0\0\0\0"
-    "\0\0\112\377\266\0\352\377\33\0\0\321\377\114\0\0\0\114\377\377\0"
-    "\0\321\377\377\377\377\377\377\377\377\320\0\0\0\377\377\0\0\0\0\0"
-    "\0\11\377\371\0\0\0\106\377\316\1\0\0\0\0\0\0\0\0\0\0\377\377\0\0"
-    "\0\0\0\0\265\377\135\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\102\377\322\2\0\0\0\0\0\0\377\377\0\0\377"
-    "\377\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\42\377\345\0\0\0\0\377\377\0\0\0\0\24\351\377\150\0\0"
-    "\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\377\377"
-    "\0\0\377\377\0\0\0\0\241\377\136\377\377\0\0\0\200\377\216\0\0\0\0"
-    "\0\0\216\377\174\0\306\377\115\0\0\172\377\341\73\6\72\341\377\377"
-    "\0\25\376\366\7\0\0\0\0\7\366\376\25\0\0\377\377\0\0\0\0\0\0\117\377"
-    "\334\0\0\0\2\325\377\160\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\132"
-    "\377\351\11\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\1\320\377\176\0\0\0\0\0\0\377\377\0\0\377\377\0\0"
-    "\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\231\11\0"
-    "\0\0\0\0\146\377\271\0\0\0\0\377\377\0\0\0\0\0\124\377\362\35\0\0"
-    "\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\377\377"
-    "\0\0\377\377\0\0\0\0\66\377\310\377\377\0\0\0\55\377\357\33\0\0\0"
-    "\0\33\357\376\50\0\214\377\226\0\0\11\320\377\377\377\377\314\377"
-    "\377\0\130\377\273\0\0\0\0\0\0\273\377\127\0\0\377\377\0\0\0\6\43"
-    "\153\356\377\202\0\0\0\0\73\373\376\231\60\10\10\47\145\305\0\0\0"
-    "\377\377\0\4\26\106\242\376\377\127\0\0\0\0\377\377\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\65\371\377\252\76\17"
-    "\3\36\157\377\377\0\0\377\377\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0"
-    "\0\377\377\0\0\0\0\0\0\0\377\341\161\45\4\16\123\354\377\146\0\0\0"
-    "\0\377\377\0\0\0\0\0\0\253\377\270\0\0\0\377\377\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\377\377\0\0\0\0\0\0\0\0\377\377\0\0\377\377\0\0\0\0\0\313\377"
-    "\377\377\0\0\0\0\260\377\330\111\14\14\111\330\377\251\0\0\67\377"
-    "\363\24\0\0\22\231\353\365\260\31\377\377\0\233\377\170\0\0\0\0\0"
-    "\0\170\377\232\0\0\377\377\377\377\377\377\377\377\377\271\11\0\0"
-    "\0\0\0\124\364\377\377\377\377\377\377\377\0\0\0\377\377\377\377\377"
-    "\377\377\366\144\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377"
-    "\377\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\115\362\377\377\377"
-    "\377\377\377\376\210\0\0\377\377\0\0\0\0\0\0\0\377\377\0\0\0\0\377"
-    "\377\377\377\377\377\377\377\377\377\0\0\0\377\377\377\377\377\377"
-    "\377\377\302\5\0\0\0\0\377\377\0\0\0\0\0\0\26\354\377\142\0\0\377"
-    "\377\377\377\377\377\377\377\377\377\377\0\0\0\377\377\0\0\0\0\0\0"
-    "\0\0\377\377\0\0\377\377\0\0\0\0\0\140\377\377\377\0\0\0\0\26\326"
-    "\377\377\377\377\377\377\322\22\0\0\0\302\377\260\1\0\0\0\0\0\0\0"
-    "\0\0\0\336\377\65\0\0\0\0\0\0\65\377\336\0\0\377\377\377\377\377\367"
-    "\341\257\127\1\0\0\0\0\0\0\0\36\216\326\370\372\336\241\74\0\0\0\377"
-    "\377\377\375\357\310\203\35\0\0\0\0\0\0\377\377\377\377\377\377\377"
-    "\377\377\377\377\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\32\211"
-    "\323\367\370\336\235\60\0\0\0\377\377\0\0\0\0\0\0\0\377\377\0\0\0"
-    "\0\377\377\377\377\377\377\377\377\377\377\0\0\0\60\210\311\357\374"
-    "\361\311\165\10\0\0\0\0\0\377\377\0\0\0\0\0\0\0\131\377\360\33\0\377"
-    "\377\377\377\377\377\377\377\377\377\377\0\0\0\377\377\0\0\0\0\0\0"
-    "\0\0\377\377\0\0\377\377\0\0\0\0\0\10\354\377\377\0\0\0\0\0\14\200"
-    "\325\371\371\324\175\13\0\0\0\0\54\366\377\235\7\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\117\372\377\334\155\46\6\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\72\331\377\377\377\377\377\377\320\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\4\126\252\336\370\372\330\216\5\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\377\377\377\377\377\371\344\261\122\0\0\0\0\0\0\0\13\175"
-    "\323\370\370\323\175\12\0\0\0\0\377\377\377\377\377\367\337\251\107"
-    "\0\0\0\0\0\0\0\75\253\346\372\360\307\206\57\0\0\0\0\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\0\0\377\377\0\0\0\0\0\0\0\377\377"
-    "\0\0\0\337\377\65\0\0\0\0\0\0\65\377\336\0\356\377\26\0\0\0\0\0\0"
-    "\0\0\26\377\356\0\270\377\217\0\0\0\0\0\0\226\377\266\0\263\377\245"
-    "\0\0\0\0\0\0\0\0\242\377\262\0\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\306\377\71"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0"
-    "\0\22\340\377\340\22\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\377\377\377\377\377\377\252\3\0\0\0\0\22\322\377\377\377\377"
-    "\377\377\321\22\0\0\0\377\377\377\377\377\377\377\377\377\235\2\0"
-    "\0\0\0\174\376\377\377\377\377\377\377\377\0\0\0\0\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\0\0\377\377\0\0\0\0\0\0\0\377\377"
-    "\0\0\0\234\377\167\0\0\0\0\0\0\170\377\233\0\312\377\72\0\0\0\0\0"
-    "\0\0\0\72\377\312\0\54\374\371\43\0\0\0\0\56\374\372\47\0\41\366\377"
-    "\77\0\0\0\0\0\0\76\377\366\40\0\377\377\377\377\377\377\377\377\377"
-    "\377\377\376\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\123\377\254"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0"
-    "\2\270\377\377\377\267\2\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\0\0\0\6\51\207\374\377\156\0\0\0\0\252\377\332\113\15\15\113\332"
-    "\377\251\0\0\0\377\377\0\0\0\10\54\210\373\377\147\0\0\0\112\377\366"
-    "\167\37\4\15\62\161\314\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\377"
-    "\377\0\0\0\0\0\0\0\377\377\0\0\0\131\377\272\0\0\0\0\0\0\273\377\131"
-    "\0\246\377\136\0\0\0\0\0\0\0\0\136\377\246\0\0\232\377\254\0\0\0\0"
-    "\276\377\216\0\0\0\175\377\325\5\0\0\0\0\4\323\377\174\0\0\0\0\0\0"
-    "\0\0\0\0\5\320\377\221\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\2\335\375"
-    "\42\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\201"
-    "\377\355\120\356\377\200\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\0\0\0\0\0\0\156\377\316\0\0\0\50\377\360\34\0\0\0\0\35\360\376\47"
-    "\0\0\377\377\0\0\0\0\0\0\155\377\313\0\0\0\273\377\136\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\377"
-    "\377\0\0\0\27\377\365\6\0\0\0\0\7\366\377\27\0\202\377\202\0\0\0\0"
-    "\0\0\0\0\202\377\202\0\0\30\363\377\73\0\0\123\377\352\17\0\0\0\7"
-    "\333\377\165\0\0\0\0\164\377\332\7\0\0\0\0\0\0\0\0\0\0\202\377\332"
-    "\12\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\155\377\222\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\112\376\370\74\0\75\370"
-    "\375\111\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\17"
-    "\377\365\0\0\0\175\377\217\0\0\0\0\0\0\217\377\174\0\0\377\377\0\0"
-    "\0\0\0\0\20\377\365\0\0\0\360\377\11\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\377\377\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\377\377\0\0\0\0\324"
-    "\377\77\0\0\0\0\100\377\323\0\0\136\377\246\0\0\0\0\0\0\0\0\246\377"
-    "\136\0\0\0\174\377\310\0\10\336\377\146\0\0\0\0\0\107\377\363\33\0"
-    "\0\33\363\377\106\0\0\0\0\0\0\0\0\0\0\62\373\375\72\0\0\0\0\0\0\0"
-    "\377\377\0\0\0\0\0\0\0\0\0\13\356\364\21\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\377\377\0\0\0\0\0\0\0\41\356\376\125\0\0\0\126\376\355\40\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\17\377\365\0\0\0"
-    "\266\377\112\0\0\0\0\0\0\113\377\266\0\0\377\377\0\0\0\0\0\0\15\377"
-    "\366\0\0\0\372\377\12\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0"
-    "\0\0\0\0\0\377\377\0\0\0\0\0\0\0\377\377\0\0\0\0\221\377\201\0\0\0"
-    "\0\202\377\221\0\0\72\377\312\0\0\125\377\377\121\0\0\312\377\72\0"
-    "\0\0\11\343\377\130\174\377\317\2\0\0\0\0\0\0\255\377\252\0\0\252"
-    "\377\254\0\0\0\0\0\0\0\0\0\0\6\323\377\213\0\0\0\0\0\0\0\0\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\206\377\171\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\0\0\0\0\0\0\10\315\377\161\0\0\0\0\0\162\377\315\10\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\156\377\317\0\0\0\335\377"
-    "\41\0\0\0\0\0\0\43\377\333\0\0\377\377\0\0\0\0\0\0\135\377\305\0\0"
-    "\0\327\377\133\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0"
-    "\0\377\377\0\0\0\0\0\0\0\377\377\0\0\0\0\117\377\304\0\0\0\0\305\377"
-    "\116\0\0\26\377\356\0\0\210\377\377\203\0\0\355\377\26\0\0\0\0\136"
-    "\377\342\364\377\76\0\0\0\0\0\0\0\35\364\377\105\105\377\364\35\0"
-    "\0\0\0\0\0\0\0\0\0\206\377\326\10\0\0\0\0\0\0\0\0\377\377\0\0\0\0"
-    "\0\0\0\0\0\0\31\371\346\6\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0"
-    "\0\0\0\0\235\377\220\0\0\0\0\0\0\0\221\377\234\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\377\377\0\0\0\5\50\206\373\377\160\0\0\0\364\377\13\0\0"
-    "\0\0\0\0\14\377\362\0\0\377\377\0\0\0\5\42\165\365\376\115\0\0\0\163"
-    "\377\367\203\43\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0"
-    "\377\377\0\0\0\0\0\0\0\377\377\0\0\0\0\17\374\372\13\0\0\14\372\374"
-    "\17\0\0\0\361\377\22\0\273\364\364\266\0\20\377\361\0\0\0\0\0\1\315"
-    "\377\377\253\0\0\0\0\0\0\0\0\0\167\377\331\331\377\166\0\0\0\0\0\0"
-    "\0\0\0\0\65\374\374\65\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0"
-    "\0\0\240\377\137\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\377\377\377\377\377\377\256\4\0\0\0\376\377\1\0\0\0\0\0\0\2\377\375"
-    "\0\0\377\377\377\377\377\377\377\377\342\132\0\0\0\0\2\235\377\377"
-    "\377\337\240\124\6\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\377\377"
-    "\0\0\0\0\0\0\0\377\377\0\0\0\0\0\311\377\111\0\0\112\377\311\0\0\0"
-    "\0\316\377\66\0\355\300\301\351\0\65\377\316\0\0\0\0\0\0\146\377\377"
-    "\76\0\0\0\0\0\0\0\0\0\5\326\377\377\326\5\0\0\0\0\0\0\0\0\0\7\326"
-    "\377\205\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\56\377"
-    "\321\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\372"
-    "\345\263\126\0\0\0\0\0\375\377\1\0\0\0\0\0\0\2\377\374\0\0\377\377"
-    "\377\377\377\377\377\370\170\0\0\0\0\0\0\0\75\245\355\377\377\377"
-    "\343\111\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\377\377\0\0\0\0\0"
-    "\0\0\377\377\0\0\0\0\0\207\377\213\0\0\214\377\206\0\0\0\0\252\377"
-    "\132\41\377\211\212\377\34\131\377\252\0\0\0\0\0\0\307\377\377\243"
-    "\0\0\0\0\0\0\0\0\0\0\101\377\377\101\0\0\0\0\0\0\0\0\0\0\212\377\322"
-    "\6\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\272\377\106"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\363\377\13\0\0\0\0\0\0\14\377\363\0\0\377\377\0\0\1\25\150\365"
-    "\377\165\0\0\0\0\0\0\0\0\2\56\155\311\377\373\75\0\0\0\0\0\0\0\0\377"
-    "\377\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\377\377\0\0\0\0\0\104\377"
-    "\316\0\0\317\377\103\0\0\0\0\206\377\176\123\377\122\123\377\116\175"
-    "\377\206\0\0\0\0\0\106\377\355\371\375\51\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\70\375\372\61\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\106\377\271\0\0\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\334\377\41\0\0\0\0\0\0\42\377"
-    "\337\0\0\377\377\0\0\0\0\0\125\377\364\25\0\0\0\0\0\0\0\0\0\0\0\216"
-    "\377\273\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\376\377\0\0\0\0\0\0"
-    "\0\377\374\0\0\0\0\0\11\370\375\22\23\376\370\10\0\0\0\0\142\377\242"
-    "\206\377\32\33\377\201\241\377\142\0\0\0\0\0\305\377\170\225\377\251"
-    "\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\11\330\377\200\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\322\377\55"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\265\377\112\0\0\0\0\0\0\112\377\276\0\0\377\377\0\0\0\0\0\0\271\377"
-    "\201\0\0\0\0\0\0\0\0\0\0\0\24\377\363\0\0\0\0\0\0\0\0\377\377\0\0"
-    "\0\0\0\0\0\364\377\1\0\0\0\0\0\2\377\363\0\0\0\0\0\0\277\377\123\124"
-    "\377\276\0\0\0\0\0\76\377\306\271\343\0\0\344\264\304\377\76\0\0\0"
-    "\0\105\377\354\14\32\366\376\56\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0"
-    "\0\0\0\0\0\216\377\316\5\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\140\377\237\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\0\173\377\216\0\0\0\0\0\0\216\377\214\0"
-    "\0\377\377\0\0\0\0\0\0\71\377\353\11\0\0\0\0\0\0\0\0\0\0\13\377\363"
-    "\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\337\377\17\0\0\0\0\0\17\377"
-    "\336\0\0\0\0\0\0\174\377\225\226\377\173\0\0\0\0\0\32\377\352\353"
-    "\254\0\0\255\347\350\377\32\0\0\0\0\304\377\171\0\0\215\377\260\0"
-    "\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\74\375\371\55\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\6\346\371\31\0\0"
-    "\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\46\376"
-    "\357\33\0\0\0\0\33\357\377\103\0\0\377\377\0\0\0\0\0\0\0\305\377\151"
-    "\0\0\0\0\0\0\0\0\0\0\143\377\311\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0"
-    "\0\0\261\377\131\0\0\0\0\0\131\377\261\0\0\0\0\0\0\71\377\330\331"
-    "\377\71\0\0\0\0\0\0\365\377\377\165\0\0\166\377\377\365\0\0\0\0\103"
-    "\377\354\14\0\0\25\364\377\64\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0"
-    "\0\12\333\377\172\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\172\377\206\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\246\377\330\111\14\14\111\330\377\322\1"
-    "\0\0\377\377\0\0\0\0\0\0\0\122\377\332\2\0\325\204\105\34\7\5\45\176"
-    "\371\377\145\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\115\377\362\152"
-    "\32\5\32\154\363\377\116\0\0\0\0\0\0\4\362\377\377\362\4\0\0\0\0\0"
-    "\0\322\377\377\75\0\0\76\377\377\322\0\0\0\0\302\377\172\0\0\0\0\206"
-    "\377\267\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\222\377\312\3\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\21\364"
-    "\356\13\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\21\317\377\377\377\377\377\377\363\62\0\0\0\377\377\0\0\0\0"
-    "\0\0\0\2\333\377\121\0\377\377\377\377\377\377\377\377\377\234\1\0"
-    "\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\220\377\377\377\377\377\377"
-    "\377\220\0\0\0\0\0\0\0\0\264\377\377\263\0\0\0\0\0\0\0\256\377\374"
-    "\12\0\0\13\374\377\256\0\0\0\101\377\355\15\0\0\0\0\21\360\377\72"
-    "\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\376\377\377\377\377\377\377\377"
-    "\377\377\377\377\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\223\377\154\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\11\172\323\371\377\377\377\137\0\0\0\0\377\377\0\0\0"
-    "\0\0\0\0\0\152\377\305\0\55\177\275\346\372\371\342\253\111\0\0\0"
-    "\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\111\264\353\373\353\265\112"
-    "\0\0\0\0\0\0\0\0\0\161\377\377\161\0\0\0\0\0\0\0\212\377\317\0\0\0"
-    "\0\320\377\212\0\0\0\300\377\173\0\0\0\0\0\0\176\377\276\0\0\0\0\0"
-    "\0\0\377\377\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\43\375"
-    "\334\2\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\32\323\377\356\55\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\255\377\122\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\21\306\377\347\23\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\72\377\306\0\0\0\0\0\0\377\377\377\377\377\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\12\263\146\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\176\377\331\23\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\171\377\304\10\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\127\310\364\377\377\377\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\377\377\0"
-    "\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\164\377\254\2\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\127\377\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\377\377\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\157"
-    "\377\217\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\310\377\206\21\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0"
-    "\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\365\377\13\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\57\205\306\356\373\352\274\146\3\0\0\0\0\377\377\0\151\326\373\353"
-    "\260\66\0\0\0\0\0\0\0\13\163\304\356\373\343\245\76\0\0\0\0\0\0\65"
-    "\257\352\373\330\160\1\377\377\0\0\0\0\0\24\211\327\367\362\302\125"
-    "\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377\377\0\0\0\0\0\63"
-    "\257\354\373\327\155\0\377\377\0\0\0\377\377\0\67\257\354\373\345"
-    "\235\33\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\377\377\377\0\0\0\0\0\0\0\377\377\0\0\0\0\26\322\377\333\36\0\0\0"
-    "\0\0\0\377\377\0\0\0\0\0\0\0\0\0\377\377\72\326\364\245\10\140\344"
-    "\364\240\6\0\0\377\377\0\67\257\354\373\345\235\33\0\0\0\0\0\0\72"
-    "\256\350\372\350\256\71\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\377\377\377\377\377\377\276\10\0\0\0\377\377\211\377\377\377"
-    "\377\377\374\131\0\0\0\0\0\46\333\377\377\377\377\377\377\377\0\0"
-    "\0\0\0\131\374\377\377\377\377\377\221\377\377\0\0\0\0\60\350\377"
-    "\377\377\377\377\377\210\0\0\0\0\377\377\377\377\377\377\377\377\377"
-    "\377\377\0\0\0\0\121\373\377\377\377\377\377\206\377\377\0\0\0\377"
-    "\377\127\374\377\377\377\377\377\343\23\0\0\0\0\377\377\377\377\377"
-    "\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\0\0\0\0\0\0\0\377\377\0"
-    "\0\0\33\330\377\326\31\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\377"
-    "\377\351\377\377\377\254\375\377\377\377\163\0\0\377\377\127\374\377"
-    "\377\377\377\377\343\23\0\0\0\0\144\376\377\377\377\377\377\375\141"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\317\171\72\22\3\21\116\335"
-    "\377\175\0\0\0\377\377\376\233\44\6\43\232\377\364\36\0\0\0\12\332"
-    "\377\321\116\21\4\31\124\275\0\0\0\0\37\365\377\230\43\6\45\236\376"
-    "\377\377\0\0\0\15\340\377\231\52\5\24\143\362\377\101\0\0\0\0\0\0"
-    "\0\377\377\0\0\0\0\0\0\0\0\32\361\377\243\50\6\41\226\374\377\377"
-    "\0\0\0\377\377\363\245\60\7\16\123\352\377\211\0\0\0\0\0\0\0\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\377\377\0\0\40\335"
-    "\377\320\25\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\377\377\204"
-    "\7\175\377\377\207\10\171\377\277\0\0\377\377\363\245\60\7\16\123"
-    "\352\377\211\0\0\0\46\371\377\230\44\6\44\232\377\370\43\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\74\377\323\0\0\0\377\377"
-    "\256\0\0\0\0\0\256\377\210\0\0\0\160\377\323\13\0\0\0\0\0\0\0\0\0"
-    "\0\210\377\252\0\0\0\0\0\261\377\377\0\0\0\163\377\221\0\0\0\0\0\137"
-    "\377\254\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\202\377\263\0\0\0\0"
-    "\0\253\377\377\0\0\0\377\377\247\0\0\0\0\0\126\377\322\0\0\0\0\0\0"
-    "\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\377\377"
-    "\0\45\342\377\312\21\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\377"
-    "\377\42\0\37\377\377\42\0\36\377\344\0\0\377\377\247\0\0\0\0\0\126"
-    "\377\322\0\0\0\216\377\252\0\0\0\0\0\256\377\214\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\5\377\363\0\0\0\377\377\101\0\0\0"
-    "\0\0\102\377\314\0\0\0\302\377\124\0\0\0\0\0\0\0\0\0\0\0\315\377\100"
-    "\0\0\0\0\0\103\377\377\0\0\0\303\377\36\0\0\0\0\0\20\377\344\0\0\0"
-    "\0\0\0\0\377\377\0\0\0\0\0\0\0\0\312\377\103\0\0\0\0\0\100\377\377"
-    "\0\0\0\377\377\62\0\0\0\0\0\21\377\363\0\0\0\0\0\0\0\377\377\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\377\377\53\347\377\303"
-    "\16\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\377\377\11\0\11"
-    "\377\377\11\0\11\377\366\0\0\377\377\62\0\0\0\0\0\21\377\363\0\0\0"
-    "\317\377\100\0\0\0\0\0\102\377\315\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\12\161\277\352\372\377\377\377\377\376\0\0\0\377\377\20\0\0\0"
-    "\0\0\21\377\360\0\0\0\355\377\25\0\0\0\0\0\0\0\0\0\0\0\361\377\20"
-    "\0\0\0\0\0\22\377\377\0\0\0\356\377\374\374\375\375\376\376\377\377"
-    "\372\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\360\377\20\0\0\0\0\0\20"
-    "\377\377\0\0\0\377\377\7\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\377\377\353\377\377"
-    "\210\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\377\377\1\0\1"
-    "\377\377\1\0\1\377\376\0\0\377\377\7\0\0\0\0\0\0\377\377\0\0\0\361"
-    "\377\20\0\0\0\0\0\21\377\360\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\33"
-    "\332\377\377\377\377\377\377\377\377\377\0\0\0\377\377\3\0\0\0\0\0"
-    "\4\377\373\0\0\0\373\377\4\0\0\0\0\0\0\0\0\0\0\0\374\377\3\0\0\0\0"
-    "\0\4\377\377\0\0\0\374\377\377\377\377\377\377\377\377\377\377\0\0"
-    "\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\374\377\3\0\0\0\0\0\3\377\377\0"
-    "\0\0\377\377\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\377\377\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\377\377\377\306\375\375\103"
-    "\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\377\377\0\0\0\377\377"
-    "\0\0\0\377\377\0\0\377\377\0\0\0\0\0\0\0\377\377\0\0\0\374\377\3\0"
-    "\0\0\0\0\4\377\374\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\247\377\327\127"
-    "\34\5\0\0\5\377\377\0\0\0\377\377\20\0\0\0\0\0\21\377\357\0\0\0\355"
-    "\377\25\0\0\0\0\0\0\0\0\0\0\0\360\377\20\0\0\0\0\0\22\377\377\0\0"
-    "\0\357\363\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0"
-    "\360\377\21\0\0\0\0\0\21\377\377\0\0\0\377\377\0\0\0\0\0\0\0\377\377"
-    "\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0"
-    "\0\0\377\377\254\5\202\377\346\25\0\0\0\0\0\0\0\0\0\377\377\0\0\0"
-    "\0\0\0\0\0\0\377\377\0\0\0\377\377\0\0\0\377\377\0\0\377\377\0\0\0"
-    "\0\0\0\0\377\377\0\0\0\361\377\20\0\0\0\0\0\22\377\360\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\357\377\42\0\0\0\0\0\54\377\377\0\0\0\377\377"
-    "\102\0\0\0\0\0\101\377\310\0\0\0\302\377\125\0\0\0\0\0\0\0\0\0\0\0"
-    "\312\377\77\0\0\0\0\0\104\377\377\0\0\0\307\377\40\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\312\377\105\0\0\0\0\0\102\377"
-    "\377\0\0\0\377\377\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\377\377\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\377\377\3\0\3\302\377"
-    "\265\1\0\0\0\0\0\0\0\0\373\377\4\0\0\0\0\0\0\0\0\377\377\0\0\0\377"
-    "\377\0\0\0\377\377\0\0\377\377\0\0\0\0\0\0\0\377\377\0\0\0\320\377"
-    "\100\0\0\0\0\0\102\377\316\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\367\377"
-    "\25\0\0\0\0\0\251\377\377\0\0\0\377\377\256\0\0\0\0\0\254\377\202"
-    "\0\0\0\160\377\323\13\0\0\0\0\0\0\0\0\0\0\205\377\250\0\0\0\0\0\261"
-    "\377\377\0\0\0\174\377\230\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0"
-    "\0\0\0\0\0\0\0\202\377\265\0\0\0\0\0\255\377\377\0\0\0\377\377\0\0"
-    "\0\0\0\0\0\377\377\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\377\377\0\0\0\0\0\0\0\377\377\0\0\0\34\355\377\161\0\0\0\0\0\0\0"
-    "\0\344\377\57\0\0\0\0\0\0\0\0\377\377\0\0\0\377\377\0\0\0\377\377"
-    "\0\0\377\377\0\0\0\0\0\0\0\377\377\0\0\0\217\377\253\0\0\0\0\0\256"
-    "\377\215\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\300\377\272\61\5\12\73"
-    "\261\363\377\377\0\0\0\377\377\376\232\43\5\42\227\377\362\33\0\0"
-    "\0\13\333\377\320\115\20\4\27\117\272\0\0\0\0\35\364\377\225\41\5"
-    "\44\235\376\377\377\0\0\0\24\352\377\236\55\6\13\61\164\316\0\0\0"
-    "\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\32\362\377\245\50\5\40\227\367"
-    "\377\377\0\0\0\377\377\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\377\377\0\0\0\0\116"
-    "\377\371\62\0\0\0\0\0\0\0\242\377\301\41\0\0\0\0\0\0\0\377\377\0\0"
-    "\0\377\377\0\0\0\377\377\0\0\377\377\0\0\0\0\0\0\0\377\377\0\0\0\47"
-    "\372\377\227\43\5\43\232\377\370\45\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\66\365\377\377\377\377\377\374\130\377\377\0\0\0\377\377\216"
-    "\377\377\377\377\377\373\123\0\0\0\0\0\50\336\377\377\377\377\377"
-    "\377\377\0\0\0\0\0\127\374\377\377\377\377\377\215\377\377\0\0\0\0"
-    "\77\361\377\377\377\377\377\377\377\0\0\0\0\0\0\0\0\377\377\0\0\0"
-    "\0\0\0\0\0\0\122\373\377\377\377\377\377\174\377\377\0\0\0\377\377"
-    "\0\0\0\0\0\0\0\377\377\0\0\0\377\377\377\377\377\377\377\377\377\377"
-    "\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\377\377\0\0\0\0\0\222\377"
-    "\332\14\0\0\0\0\0\0\51\365\377\377\377\377\377\0\0\0\0\377\377\0\0"
-    "\0\377\377\0\0\0\377\377\0\0\377\377\0\0\0\0\0\0\0\377\377\0\0\0\0"
-    "\150\376\377\377\377\377\377\375\144\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\52\246\350\374\355\262\72\0\377\377\0\0\0\377\377\1\156\330"
-    "\373\354\256\64\0\0\0\0\0\0\0\14\164\306\357\373\345\247\77\0\0\0"
-    "\0\0\0\65\257\354\373\330\155\1\377\377\0\0\0\0\0\36\223\334\370\365"
-    "\320\217\63\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\64\257\355"
-    "\373\326\151\4\377\366\0\0\0\377\377\0\0\0\0\0\0\0\377\377\0\0\0\377"
-    "\377\377\377\377\377\377\377\377\377\0\0\0\0\0\0\0\0\0\377\377\0\0"
-    "\0\0\0\0\0\377\377\0\0\0\0\0\7\316\377\242\0\0\0\0\0\0\0\63\272\364"
-    "\377\377\377\0\0\0\0\377\377\0\0\0\377\377\0\0\0\377\377\0\0\377\377"
-    "\0\0\0\0\0\0\0\377\377\0\0\0\0\0\74\257\352\373\351\257\73\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\37\377\334\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\4\377\372\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\172\377\236\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\60\377\341\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\320"
-    "\171\65\15\4\40\172\371\374\61\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\40\300\377\240\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\377\377\377\377\377\377\377\375\153\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\364\46"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\65\221\323\366\371\341\243\65\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\364"
-    "\272\62\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\5\176\323\364\377\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0"
-    "\0\0\0\0\0\377\364\322\174\5\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\176\377\377\377\377\0\0\0\0\0\0\0\0\0\377"
-    "\377\0\0\0\0\0\0\0\0\0\377\377\377\377\172\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\322\377\204\20\0\0\0\0\0\0"
-    "\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\21\207\377\320\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\364\377\22\0\0\0"
-    "\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\24\377\363\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\376\377\1\0"
-    "\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\1\377\376\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\377\377\1\155\327\373\353\257\65\0\0\0\0\0\0\0\65\257\353\373\327"
-    "\155\1\377\377\0\0\0\0\0\377\377\0\56\260\357\371\312\124\0\0\0\0"
-    "\31\207\315\360\374\361\316\217\64\0\0\0\377\377\377\377\377\377\377"
-    "\377\377\377\377\0\0\0\0\377\377\0\0\0\0\0\0\0\377\377\0\0\0\326\377"
-    "\101\0\0\0\0\0\102\377\326\0\343\377\51\0\0\0\0\0\0\0\0\51\377\342"
-    "\0\0\246\377\306\3\0\0\0\4\312\377\245\0\0\0\321\377\122\0\0\0\0\0"
-    "\111\377\323\0\0\0\377\377\377\377\377\377\377\377\377\377\377\0\0"
-    "\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\377\377\216\377\377\377\377\377\374\126\0\0"
-    "\0\0\0\126\374\377\377\377\377\377\215\377\377\0\0\0\0\0\377\377\71"
-    "\366\377\377\377\377\377\0\0\0\62\356\377\377\377\377\377\377\377"
-    "\377\0\0\0\377\377\377\377\377\377\377\377\377\377\377\0\0\0\0\377"
-    "\377\0\0\0\0\0\0\0\377\377\0\0\0\203\377\225\0\0\0\0\0\226\377\202"
-    "\0\251\377\143\0\0\0\0\0\0\0\0\144\377\250\0\0\20\341\377\176\0\0"
-    "\0\204\377\341\17\0\0\0\164\377\260\0\0\0\0\0\243\377\171\0\0\0\377"
-    "\377\377\377\377\377\377\377\377\377\376\0\0\0\0\0\0\0\377\377\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\377\377\376\233\45\6\42\227\377\363\34\0\0\0\35\364\377\227\43\6"
-    "\45\233\376\377\377\0\0\0\0\0\377\377\323\312\105\15\10\73\257\0\0"
-    "\0\303\377\264\70\15\3\20\65\164\316\0\0\0\0\0\0\0\377\377\0\0\0\0"
-    "\0\0\0\0\0\377\377\0\0\0\0\0\0\0\377\377\0\0\0\60\377\346\2\0\0\0"
-    "\2\347\377\57\0\156\377\235\0\0\0\0\0\0\0\0\236\377\155\0\0\0\77\375"
-    "\373\66\0\74\374\375\76\0\0\0\0\31\374\372\23\0\0\0\11\362\377\41"
-    "\0\0\0\0\0\0\0\0\0\0\121\375\377\166\0\0\0\0\0\0\6\377\374\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\375\377\6\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\256\0\0\0\0\0\253\377\204\0\0\0\205\377\252\0\0\0\0\0\256\377"
-    "\377\0\0\0\0\0\377\377\324\11\0\0\0\0\0\0\0\0\367\377\17\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0"
-    "\377\377\0\0\0\0\334\377\74\0\0\0\75\377\333\0\0\64\377\327\0\0\0"
-    "\0\0\0\0\0\330\377\63\0\0\0\0\210\377\332\32\337\377\207\0\0\0\0\0"
-    "\0\270\377\154\0\0\0\126\377\307\0\0\0\0\0\0\0\0\0\0\75\367\377\216"
-    "\0\0\0\0\0\0\0\63\377\351\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\351\377\63\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\101\0\0\0\0\0\100\377\311"
-    "\0\0\0\312\377\100\0\0\0\0\0\102\377\377\0\0\0\0\0\377\377\132\0\0"
-    "\0\0\0\0\0\0\0\346\377\217\41\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0"
-    "\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\377\377\0\0\0\0\211\377\220"
-    "\0\0\0\221\377\210\0\0\4\365\376\23\0\17\373\370\13\0\23\377\364\4"
-    "\0\0\0\0\5\315\377\354\377\315\5\0\0\0\0\0\0\132\377\312\0\0\0\257"
-    "\377\155\0\0\0\0\0\0\0\0\0\53\356\377\244\1\0\0\0\0\0\12\71\313\377"
-    "\250\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\251\377"
-    "\313\70\11\0\0\0\0\120\263\352\374\353\267\160\53\10\20\116\274\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\20\0\0\0\0\0\20\377\357\0"
-    "\0\0\360\377\20\0\0\0\0\0\22\377\377\0\0\0\0\0\377\377\32\0\0\0\0"
-    "\0\0\0\0\0\164\377\377\377\347\271\220\153\52\0\0\0\0\0\0\0\0\377"
-    "\377\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\377\377\0\0\0\0\66\377"
-    "\342\1\0\1\343\377\65\0\0\0\277\377\114\0\122\377\377\114\0\115\377"
-    "\276\0\0\0\0\0\0\50\366\377\365\47\0\0\0\0\0\0\0\11\362\377\47\0\20"
-    "\370\374\27\0\0\0\0\0\0\0\0\34\343\377\271\5\0\0\0\0\0\377\377\377"
-    "\376\273\31\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\31\271\376\377\377\377\0\0\0\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\3\0\0\0\0\0"
-    "\3\377\373\0\0\0\374\377\3\0\0\0\0\0\4\377\377\0\0\0\0\0\377\377\3"
-    "\0\0\0\0\0\0\0\0\0\0\130\310\375\377\377\377\377\377\257\14\0\0\0"
-    "\0\0\0\377\377\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\377\377\0\0"
-    "\0\0\0\341\377\67\0\70\377\340\0\0\0\0\204\377\206\0\231\350\351\224"
-    "\0\207\377\203\0\0\0\0\0\0\2\320\377\317\2\0\0\0\0\0\0\0\0\236\377"
-    "\205\0\143\377\273\0\0\0\0\0\0\0\0\20\324\377\312\14\0\0\0\0\0\0\377"
-    "\377\377\376\270\27\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\26\266\375\377\377\377\0\0\0\273\117\23\3\37\130\237\335"
-    "\372\356\266\117\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\20\0\0"
-    "\0\0\0\20\377\360\0\0\0\361\377\20\0\0\0\0\0\22\377\377\0\0\0\0\0"
-    "\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\15\64\127\205\312\377\377\232\0"
-    "\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\7\377\377"
-    "\0\0\0\0\0\217\377\213\0\214\377\216\0\0\0\0\112\377\301\0\340\237"
-    "\240\334\0\302\377\111\0\0\0\0\0\0\161\377\377\377\160\0\0\0\0\0\0"
-    "\0\0\101\377\341\1\274\377\141\0\0\0\0\0\0\0\10\302\377\332\25\0\0"
-    "\0\0\0\0\0\0\13\75\322\377\245\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\245\377\320\74\13\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\102\0\0\0\0\0\100\377"
-    "\314\0\0\0\316\377\77\0\0\0\0\0\102\377\377\0\0\0\0\0\377\377\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\122\377\355\0\0\0\0\0\0\376\377\1"
-    "\0\0\0\0\0\0\0\0\365\377\20\0\0\0\0\0\63\377\377\0\0\0\0\0\73\377"
-    "\336\1\337\377\72\0\0\0\0\21\376\365\53\377\124\125\377\51\366\376"
-    "\20\0\0\0\0\0\41\364\377\222\377\364\40\0\0\0\0\0\0\0\1\341\377\131"
-    "\375\370\17\0\0\0\0\0\0\2\255\377\346\40\0\0\0\0\0\0\0\0\0\0\0\71"
-    "\377\350\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\350"
-    "\377\67\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\377\377\256\0\0\0\0\0\250\377\210\0\0\0\211\377\250\0"
-    "\0\0\0\0\256\377\377\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\32\377\364\0\0\0\0\0\0\362\377\32\0\0\0\0\0\0\0\0\324\377"
-    "\124\0\0\0\0\0\246\377\377\0\0\0\0\0\1\346\377\146\377\345\1\0\0\0"
-    "\0\0\325\377\243\372\16\17\373\242\377\324\0\0\0\0\0\0\273\377\245"
-    "\0\246\377\272\0\0\0\0\0\0\0\0\205\377\357\377\260\0\0\0\0\0\0\0\225"
-    "\377\360\56\0\0\0\0\0\0\0\0\0\0\0\0\10\377\374\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\375\377\7\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\376\232"
-    "\44\5\41\224\377\365\37\0\0\0\37\365\377\224\41\5\43\233\375\377\377"
-    "\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\331\216\122\46\12\2\23\113"
-    "\316\377\263\0\0\0\0\0\0\307\377\245\34\1\0\0\0\0\0\0\213\377\350"
-    "\121\15\6\57\244\362\377\377\0\0\0\0\0\0\225\377\361\377\224\0\0\0"
-    "\0\0\0\232\377\374\276\0\0\277\374\377\231\0\0\0\0\0\142\377\352\24"
-    "\0\24\353\377\141\0\0\0\0\0\0\0\47\377\377\377\133\0\0\0\0\0\0\174"
-    "\377\370\77\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\220\377"
-    "\377\377\377\377\374\131\0\0\0\0\0\132\374\377\377\377\377\377\203"
-    "\377\377\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377"
-    "\377\377\377\377\331\36\0\0\0\0\0\0\140\377\377\377\377\377\377\0"
-    "\0\0\0\26\347\377\377\377\377\377\373\125\377\377\0\0\0\0\0\0\101"
-    "\377\377\377\100\0\0\0\0\0\0\140\377\377\163\0\0\164\377\377\137\0"
-    "\0\0\0\30\357\377\131\0\0\0\132\377\356\30\0\0\0\0\0\0\0\311\377\370"
-    "\16\0\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377\377\0\0\0"
-    "\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\377\377\1\160\331\373\354\260\67\0\0\0\0\0\0"
-    "\0\67\260\354\373\326\146\0\377\377\0\0\0\0\0\377\377\0\0\0\0\0\0"
-    "\0\0\0\0\51\167\265\342\371\372\347\273\153\11\0\0\0\0\0\0\0\0\142"
-    "\312\364\377\377\377\0\0\0\0\0\37\240\346\374\354\256\65\0\377\377"
-    "\0\0\0\0\0\0\3\352\377\352\3\0\0\0\0\0\0\45\377\377\51\0\0\51\377"
-    "\377\45\0\0\0\0\255\377\263\0\0\0\0\0\263\377\255\0\0\0\0\0\0\0\177"
-    "\377\263\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377\377"
-    "\0\0\0\0\0\0\0\376\377\1\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0"
-    "\0\0\0\0\0\1\377\376\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\276\377\136\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\364\377\21\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\23\377\363\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\44\376\370\16\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\321\377\201\17\0\0\0\0\0"
-    "\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\17\205\377\320\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\22\267"
-    "\377\250\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\175\377"
-    "\377\377\377\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\377\172\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\377\377\377\371\54\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\6\200\324\365\377\0\0\0\0\0\0\0\0\0\377\377\0\0\0"
-    "\0\0\0\0\0\0\377\365\323\175\5\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\374\323\107\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\377\377\377\0\0\0\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0"
-    "\0\0\133\327\371\326\126\0\0\0\0\0\0\0\0\0\0\0\0\25\206\317\362\373"
-    "\343\243\75\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\13\342"
-    "\377\275\0\0\0\0\0\0\0\0\276\377\342\13\0\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\72\377\377\306\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\377\377\377\0\0\0\0\0\0\0\0\377\377\377\0\0\0\377\377\377\0"
-    "\0\0\0\0\0\0\236\377\347\1\0\312\377\304\0\0\0\0\0\0\0\377\377\0\0"
-    "\0\0\0\0\133\377\377\377\377\377\126\0\0\0\0\0\0\0\0\0\0\46\350\377"
-    "\377\377\377\377\377\377\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0"
-    "\0\0\0\0\205\377\377\73\0\0\0\0\0\0\0\0\74\377\377\203\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\255\377\377\122\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\377\377\377\0\0"
-    "\0\377\377\377\0\0\0\0\0\0\0\343\377\243\0\20\375\377\175\0\0\0\0"
-    "\0\0\0\377\377\0\0\0\0\0\0\330\377\170\14\170\377\326\0\0\0\0\0\0"
-    "\0\0\0\0\264\377\377\377\377\377\377\377\377\0\0\0\0\0\0\0\0\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\26\365\377\305\0\0\0\0\0\0\0\0\0\0\307\377"
-    "\364\25\0\0\0\0\0\0\122\255\42\0\0\377\377\0\0\43\255\122\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\43\375\377"
-    "\334\2\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0"
-    "\0\0\0\0\0\377\377\377\0\0\0\377\377\377\0\0\0\0\0\0\50\377\377\135"
-    "\0\122\377\377\66\0\0\0\6\154\303\360\377\377\361\306\206\60\0\0\372"
-    "\377\13\0\14\377\371\0\0\0\0\0\0\0\0\0\0\363\377\377\155\17\5\37\136"
-    "\302\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\202\377\377\135"
-    "\0\0\0\0\0\0\0\0\0\0\140\377\377\177\0\0\0\0\0\0\314\377\371\212\16"
-    "\377\377\16\212\371\377\313\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\223\377\377\154\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\377\377\377\0\0\0"
-    "\377\377\377\0\0\0\0\0\0\155\377\376\30\0\226\377\355\2\0\0\17\312"
-    "\377\377\377\377\377\377\377\377\377\0\0\330\377\166\13\166\377\326"
-    "\0\0\0\0\0\0\0\0\0\0\363\377\377\25\0\0\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\377\0\0\0\0\0\0\0\0\0\3\346\377\365\12\0\0\0\0\0\0\0\0\0\0\14"
-    "\370\377\342\1\0\0\0\0\0\33\234\374\377\351\377\377\352\377\374\235"
-    "\33\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\21\364\377\356\13\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\377\377\377\0\0\0\0\0\0\0\0\377\377\377\0\0\0\377\377\377\0\0\0"
-    "\260\377\377\377\377\377\377\377\377\377\377\377\377\0\224\377\377"
-    "\377\377\377\377\377\377\377\377\0\0\133\377\377\377\377\377\130\0"
-    "\0\0\0\67\304\73\0\0\0\270\377\377\214\0\0\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\377\0\0\0\0\0\0\0\0\0\77\377\377\261\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\266\377\377\73\0\0\0\0\0\0\0\51\260\377\377\377\377\264\53\0\0\0"
-    "\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\172\377\377\206\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\377\0\0\0\0\0\0\0\0\377\377\377\0\0\0\377\377\377\0\0\0\260\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\0\346\377\377\204\26"
-    "\377\377\15\60\155\307\0\0\0\133\330\372\327\131\0\0\0\41\250\367"
-    "\213\20\0\0\0\112\377\377\376\113\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\205\377\377\161\0\0\0\0\0\0\0\0\0\0\0\0\165"
-    "\377\377\201\0\0\0\0\0\0\0\50\257\377\377\377\377\263\53\0\0\0\0\0"
-    "\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\6\346"
-    "\377\371\31\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\260\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\0\372\377\377\12\0\377\377\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\20\213\367\245\37\0\0\0\0\0\121\374\377\377\361\47"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\272\377\377\100\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\103\377\377\270\0\0\0\0\0\32\233\374\377\345"
-    "\377\377\345\377\374\234\33\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\140\377\377\237\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\374\377\374\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\124\377\377\60\0\170\377\374\20\0\0\0\326\377\377"
-    "\237\34\377\377\0\0\0\0\0\0\0\0\0\0\0\5\156\354\277\63\0\0\0\0\0\0"
-    "\144\376\377\377\377\377\327\15\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\340\377\377\36\0\0\0\0\0\0\0\0\0\0\0\0\40\377\377\336\0"
-    "\0\0\0\0\314\377\367\205\14\377\377\14\206\370\377\313\0\0\0\0\0\0"
-    "\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\322\377\377"
-    "\55\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\351\377\350\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\234\377\347\1\0\300\377"
-    "\304\0\0\0\0\147\377\377\377\377\377\377\237\142\20\0\0\0\0\0\0\0"
-    "\122\332\326\115\0\0\0\0\0\0\0\52\372\377\336\155\376\377\377\257"
-    "\1\0\377\377\376\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\366\377\377\10"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\11\377\377\364\0\0\0\0\0\122\255\41\0\0\377"
-    "\377\0\0\41\255\122\0\0\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\106\377\377\271\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\323\377\323\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\343\377\240\0\15\372\377\174\0\0\0\0\0"
-    "\173\371\377\377\377\377\377\377\361\144\0\0\0\0\66\303\350\150\3"
-    "\0\0\0\0\0\0\0\0\237\377\377\111\0\201\377\377\377\173\0\377\377\355"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\375\377\377\2\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\2\377\377\375\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\272\377\377\106\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\275\377\276\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\377\377\377\377\377\377\377\377\377\377\377\377\260\0\0\0"
-    "\0\34\170\273\377\377\377\377\377\377\124\0\32\247\364\202\14\0\0"
-    "\0\133\327\371\325\125\0\0\344\377\377\11\0\1\261\377\377\375\111"
-    "\377\377\307\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\365\377\377\10\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\12\377\377\364\0\0\0\0\0\0\0\0\0\0\377\377\0"
-    "\0\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377\377\377\377\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\56\377\377\321\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\247\377\252\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\260\0\0\0\0\0\0\0\377\377\73\255\377\377\315\0\56\235\32\0\0"
-    "\0\0\133\377\377\377\377\377\126\0\373\377\377\31\0\0\16\327\377\377"
-    "\357\377\377\175\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\337\377\377\37"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\41\377\377\335\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\377\377\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\240\377\377\137\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\260\0\0\0\0\0\0\0\377"
-    "\377\0\13\377\377\367\0\0\0\0\0\0\0\0\330\377\166\14\176\377\326\0"
-    "\351\377\377\205\0\0\0\46\360\377\377\377\351\22\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\271\377\377\102\0\0\0\0\0\0\0\0\0\0\0\0\104\377\377"
-    "\270\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\31\371\377\346\6\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\306\377\301\0\1\350\377\235\0\0\0\0\0\327\213\115"
-    "\37\7\377\377\30\214\377\377\351\0\0\0\0\0\0\0\0\372\377\13\0\15\377"
-    "\371\0\247\377\377\376\212\36\4\61\303\377\377\377\125\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\204\377\377\163\0\0\0\0\0\0\0\0\0\0\0\0\167"
-    "\377\377\203\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\206\377\377"
-    "\171\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\16\373\377\174\0\56\377"
-    "\377\130\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377\377\227"
-    "\0\0\0\0\0\0\0\0\330\377\163\13\173\377\326\0\54\370\377\377\377\377"
-    "\377\377\377\377\377\377\245\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\76"
-    "\377\377\263\0\0\0\0\0\0\0\0\0\0\0\0\270\377\377\76\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0"
-    "\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\377\377\0\0\0\0\0\0\0\13\356\377\364\21\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\116\377\377\67\0\162\377\376\25\0\0\0\0\0\377\377"
-    "\377\377\377\377\377\377\377\377\314\20\0\0\0\0\0\0\0\0\133\377\377"
-    "\377\377\377\130\0\0\113\361\377\377\377\377\377\377\377\377\377\376"
-    "\61\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\2\345\377\366\13\0\0\0\0\0\0"
-    "\0\0\0\0\15\370\377\344\2\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0"
-    "\0\155\377\377\222\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\222\377"
-    "\357\3\0\266\377\316\0\0\0\0\0\0\50\163\260\334\367\377\377\363\310"
-    "\160\6\0\0\0\0\0\0\0\0\0\0\133\330\372\326\130\0\0\0\0\33\211\321"
-    "\364\375\351\263\122\264\377\377\272\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\202\377\377\137\0\0\0\0\0\0\0\0\0\0\142\377\377\201\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\15\377\377\377\345\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\377\377\377\377\0\0\0\0\0\0\2\335\377\375\42\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\3\377\377\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\26\365\377\307\0\0\0\0\0\0"
-    "\0\0\0\0\310\377\364\26\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\101\377\377\377\175\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\123\377\377"
-    "\254\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\2\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\205"
-    "\377\377\73\0\0\0\0\0\0\0\0\75\377\377\203\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\170\377\377\371"
-    "\27\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\306\377\377\71\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\1\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\13\342\377\275\0\0\0\0\0\0\0\0\276\377\342\13\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\256\377\377\243\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\345\377\377\66\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\12\173\323\370\370\322\173"
-    "\11\0\0\0\0\0\43\151\257\361\377\377\377\0\0\0\0\0\0\47\161\254\330"
-    "\364\373\356\311\207\41\0\0\0\0\0\53\173\271\345\372\366\335\247\105"
-    "\0\0\0\0\0\0\0\0\0\4\322\377\377\377\0\0\0\0\0\377\377\377\377\377"
-    "\377\377\377\377\377\0\0\0\0\0\0\42\215\321\364\373\341\241\74\0\0"
-    "\0\377\377\377\377\377\377\377\377\377\377\377\377\0\0\0\0\106\251"
-    "\340\370\370\340\251\105\0\0\0\0\0\0\57\243\343\372\364\314\171\13"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\57\204\302\351\373\365\321\203\17\0\0\0\0\21"
-    "\317\377\377\377\377\377\377\315\17\0\0\0\0\377\377\377\377\377\377"
-    "\377\0\0\0\0\0\0\377\377\377\377\377\377\377\377\377\370\153\0\0\0"
-    "\0\377\377\377\377\377\377\377\377\377\244\4\0\0\0\0\0\0\0\163\377"
-    "\377\377\377\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377\0\0"
-    "\0\0\0\147\370\377\377\377\377\377\377\377\0\0\0\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\0\0\3\236\377\377\377\377\377\377\377"
-    "\377\235\3\0\0\0\134\373\377\377\377\377\377\377\327\30\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\377\377\377\377\377\377\377\377\336\33\0\0\0\247\377\377"
-    "\377\377\377\377\377\377\243\0\0\0\0\377\377\377\377\377\377\377\0"
-    "\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377\377\116\0\0\0\377"
-    "\377\377\377\377\377\377\377\377\377\170\0\0\0\0\0\0\34\363\377\377"
-    "\377\377\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377\0\0\0\0"
-    "\125\377\377\377\377\377\377\377\377\377\0\0\0\377\377\377\377\377"
-    "\377\377\377\377\377\377\362\0\0\162\377\377\377\377\377\377\377\377"
-    "\377\377\161\0\0\46\370\377\377\377\377\377\377\377\377\270\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\377\377\377\377\377\377\377\377\377\245\0\0\47\376\377"
-    "\377\205\22\22\205\377\377\376\44\0\0\0\340\240\140\40\377\377\377"
-    "\0\0\0\0\0\0\334\227\137\62\21\3\22\125\342\377\377\304\0\0\0\322"
-    "\175\75\22\3\23\120\326\377\377\332\0\0\0\0\0\0\254\377\353\377\377"
-    "\377\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\11\347\377\377\321"
-    "\115\20\5\43\146\307\0\0\0\0\0\0\0\0\0\0\0\264\377\377\221\0\0\327"
-    "\377\377\311\74\10\11\72\306\377\377\326\0\0\223\377\377\351\122\14"
-    "\13\117\350\377\377\62\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\322\175\76\25\3\23\177\377"
-    "\377\355\0\0\173\377\377\270\0\0\0\0\271\377\377\171\0\0\0\0\0\0\0"
-    "\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\67\377\377\364\0\0\0\0\0"
-    "\0\0\0\0\0\43\377\377\372\0\0\0\0\0\110\377\377\144\377\377\377\0"
-    "\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\133\377\377\331\14\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\45\376\377\375\43\0\0\372\377\377\33\0"
-    "\0\0\0\32\377\377\371\0\0\326\377\377\120\0\0\0\0\117\377\377\205"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\7\136\312\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\311\135\7\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\4\377\377\365\0\0\265\377\377"
-    "\132\0\0\0\0\134\377\377\265\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\10\377\377\337\0\0\0\0\0\0\0\0\0\0\32\377\377\345"
-    "\0\0\0\0\10\334\377\311\1\377\377\377\0\0\0\0\0\377\377\377\0\0\0"
-    "\0\0\0\0\0\0\0\243\377\377\137\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\222"
-    "\377\377\262\0\0\0\346\377\377\33\0\0\0\0\34\377\377\345\0\0\365\377"
-    "\377\13\0\0\0\0\13\377\377\273\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\35\206\352\377\377\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\377\377\352\205\35\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\20\377\377\277\0\0\334\377\377\51\0\0\0\0\51\377\377"
-    "\333\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\101\377"
-    "\377\220\0\0\0\0\0\0\0\1\21\110\314\377\377\217\0\0\0\0\202\377\375"
-    "\64\0\377\377\377\0\0\0\0\0\377\377\377\321\371\364\322\205\24\0\0"
-    "\0\0\324\377\377\55\214\335\371\356\274\122\0\0\0\0\0\0\0\0\0\0\16"
-    "\362\377\377\102\0\0\0\213\377\377\307\72\7\10\73\311\377\377\210"
-    "\0\0\372\377\377\12\0\0\0\0\13\377\377\336\0\0\0\0\0\0\377\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\102"
-    "\256\374\377\377\377\377\0\0\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\0\0\377\377\377\377\374\255\101\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\12\230\377\375\76\0\0\363\377\377\16\0\207\363\207\17\377\377\362"
-    "\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\10\315\377\365"
-    "\33\0\0\0\0\0\377\377\377\377\377\377\377\271\13\0\0\0\45\370\377"
-    "\232\0\0\377\377\377\0\0\0\0\0\377\377\377\377\377\377\377\377\347"
-    "\64\0\0\0\360\377\377\323\377\377\377\377\377\377\212\0\0\0\0\0\0"
-    "\0\0\0\160\377\377\321\0\0\0\0\10\254\377\377\377\377\377\377\377"
-    "\377\253\7\0\0\345\377\377\117\0\0\0\0\116\377\377\363\0\0\0\0\0\0"
-    "\377\377\377\377\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0"
-    "\0\14\152\325\377\377\377\377\364\240\75\0\0\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\0\0\75\240\364\377\377\377\377\324\151\14"
-    "\0\0\0\0\0\0\0\0\0\0\36\333\377\377\163\0\0\0\376\377\377\3\0\364"
-    "\377\363\4\377\377\375\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\6\262\377\377\144\0\0\0\0\0\0\377\377\377\377\377\376\233\6"
-    "\0\0\0\0\272\377\355\23\0\0\377\377\377\0\0\0\0\0\377\377\377\377"
-    "\377\377\377\377\377\350\24\0\0\375\377\377\377\377\377\377\377\377"
-    "\377\377\104\0\0\0\0\0\0\0\2\335\377\377\142\0\0\0\0\0\2\230\377\377"
-    "\377\377\377\377\234\3\0\0\0\257\377\377\350\117\13\12\115\346\377"
-    "\377\375\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\377\0\0\0\0\0\0\47\222\361\377\377\377\377\307\144\15\0\0\0\0\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\0\0\0\0\15\145\307\377"
-    "\377\377\377\361\221\46\0\0\0\0\0\0\0\10\330\377\377\242\0\0\0\0\376"
-    "\377\377\3\0\211\364\207\4\377\377\375\0\0\0\0\0\0\0\377\377\377\0"
-    "\0\0\0\0\0\0\0\0\0\0\13\271\377\377\220\0\0\0\0\0\0\0\377\377\377"
-    "\377\377\377\377\311\14\0\0\127\377\377\150\0\0\0\377\377\377\0\0"
-    "\0\0\0\313\156\55\12\6\52\217\375\377\377\206\0\0\376\377\377\350"
-    "\117\13\14\122\352\377\377\255\0\0\0\0\0\0\0\117\377\377\352\7\0\0"
-    "\0\0\6\271\377\377\377\377\377\377\377\377\271\5\0\0\110\377\377\377"
-    "\377\377\377\377\377\377\377\373\0\0\0\0\0\0\377\377\377\377\0\0\0"
-    "\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\376\377\377\377\350\213"
-    "\51\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\51\214\350"
-    "\377\377\377\376\0\0\0\0\0\0\4\246\377\371\152\1\0\0\0\0\363\377\377"
-    "\15\0\0\0\0\17\377\377\362\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0"
-    "\0\0\0\24\311\377\377\233\1\0\0\0\0\0\0\0\0\0\2\31\147\357\377\377"
-    "\205\0\0\345\377\315\2\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\166"
-    "\377\377\324\0\0\365\377\377\116\0\0\0\0\121\377\377\344\0\0\0\0\0"
-    "\0\0\276\377\377\202\0\0\0\0\0\172\377\377\343\116\13\13\116\343\377"
-    "\377\167\0\0\0\222\377\377\377\377\377\377\332\377\377\356\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\227"
-    "\7\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\7\227"
-    "\377\377\377\0\0\0\0\0\0\235\377\377\145\0\0\0\0\0\0\334\377\377\50"
-    "\0\0\0\0\51\377\377\333\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0"
-    "\0\40\331\377\377\235\1\0\0\0\0\0\0\0\0\0\0\0\0\0\115\377\377\331"
-    "\0\0\377\377\377\377\377\377\377\377\377\377\377\377\0\0\0\0\0\0\0"
-    "\0\0\0\20\377\377\365\0\0\337\377\377\12\0\0\0\0\13\377\377\372\0"
-    "\0\0\0\0\0\55\377\377\371\30\0\0\0\0\0\330\377\377\74\0\0\0\0\74\377"
-    "\377\327\0\0\0\0\126\276\357\372\337\221\61\377\377\322\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\376\377\377\377"
-    "\342\203\43\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\43"
-    "\204\343\377\377\377\376\0\0\0\0\0\0\365\377\377\27\0\0\0\0\0\0\265"
-    "\377\377\132\0\0\0\0\133\377\377\265\0\0\0\0\0\0\0\377\377\377\0\0"
-    "\0\0\0\0\0\0\61\347\377\377\232\1\0\0\0\0\0\0\0\0\0\0\0\0\0\0\7\377"
-    "\377\371\0\0\377\377\377\377\377\377\377\377\377\377\377\377\0\0\0"
-    "\0\0\0\0\0\0\0\20\377\377\363\0\0\274\377\377\12\0\0\0\0\13\377\377"
-    "\363\0\0\0\0\0\0\234\377\377\243\0\0\0\0\0\0\373\377\377\6\0\0\0\0"
-    "\7\377\377\372\0\0\0\0\0\0\0\0\0\0\136\377\377\243\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\47\223\361\377\377\377"
-    "\376\300\136\12\0\0\0\0\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\0\0\0\0\12\136\300\376\377\377\377\361\222\47\0\0\0\0\0\0\377"
-    "\377\377\1\0\0\0\0\0\0\173\377\377\266\0\0\0\0\267\377\377\172\0\0"
-    "\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\104\362\377\377\226\1\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\63\377\377\361\0\0\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\162\377\377\316\0\0\206"
-    "\377\377\116\0\0\0\0\120\377\377\324\0\0\0\0\0\24\367\377\377\63\0"
-    "\0\0\0\0\0\360\377\377\74\0\0\0\0\100\377\377\357\0\0\0\0\0\0\0\0"
-    "\0\13\330\377\377\132\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\14\153\325\377\377\377\377\361\232\70\0\0\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\0\0\70\232\361\377\377"
-    "\377\377\325\152\14\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\47\376"
-    "\377\377\203\21\22\203\377\377\376\45\0\0\0\0\0\0\0\377\377\377\0"
-    "\0\0\0\0\0\134\372\377\377\223\0\0\0\0\0\0\0\0\0\324\205\112\43\13"
-    "\2\22\127\342\377\377\300\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\316"
-    "\167\71\23\3\13\62\217\375\377\377\172\0\0\66\377\377\346\115\12\13"
-    "\120\350\377\377\220\0\0\0\0\0\173\377\377\303\0\0\0\0\0\0\0\276\377"
-    "\377\343\116\13\13\121\346\377\377\276\0\0\0\306\141\40\5\17\114\320"
-    "\377\377\347\10\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\377\377\0\0\0\0\0\0\0\0\0\0\0\103\257\374\377\377\377\377\0\0"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\0\0\377\377\377\377"
-    "\374\256\102\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\247\377\377"
-    "\377\377\377\377\377\377\246\0\0\0\0\377\377\377\377\377\377\377\377"
-    "\377\377\377\0\0\376\377\377\377\377\377\377\377\377\377\377\377\10"
-    "\0\377\377\377\377\377\377\377\377\377\377\377\120\0\0\0\0\0\0\0\0"
-    "\0\377\377\377\0\0\0\0\377\377\377\377\377\377\377\377\377\377\331"
-    "\13\0\0\0\275\377\377\377\377\377\377\377\377\366\43\0\0\0\0\5\345"
-    "\377\377\123\0\0\0\0\0\0\0\123\377\377\377\377\377\377\377\377\377"
-    "\377\123\0\0\0\377\377\377\377\377\377\377\377\377\124\0\0\0\0\0\0"
-    "\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\36\207\352\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\377\377\352\206\35\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0"
-    "\0\0\0\0\21\320\377\377\377\377\377\377\320\21\0\0\0\0\377\377\377"
-    "\377\377\377\377\377\377\377\377\0\0\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\10\0\377\377\377\377\377\377\377\377\377\373\165"
-    "\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\377\377\377\377\377\377\377"
-    "\377\377\313\36\0\0\0\0\33\331\377\377\377\377\377\377\372\130\0\0"
-    "\0\0\0\131\377\377\337\3\0\0\0\0\0\0\0\0\210\377\377\377\377\377\377"
-    "\377\377\210\0\0\0\0\377\377\377\377\377\377\377\370\147\0\0\0\0\0"
-    "\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\7\137\312\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\312"
-    "\136\7\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0"
-    "\12\173\323\370\371\324\174\12\0\0\0\0\0\377\377\377\377\377\377\377"
-    "\377\377\377\377\0\0\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\10\0\54\174\270\340\367\374\357\314\216\51\0\0\0\0\0\0\0\0\0\0\0"
-    "\377\377\377\0\0\0\0\54\176\274\345\372\370\342\256\127\4\0\0\0\0"
-    "\0\0\14\172\315\365\372\343\243\56\0\0\0\0\0\0\310\377\377\163\0\0"
-    "\0\0\0\0\0\0\0\0\77\246\340\370\370\340\246\77\0\0\0\0\0\73\241\342"
-    "\374\364\321\215\42\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0"
-    "\0\0\0\15\377\377\377\345\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\101\377\377\377\175\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\170\377\377\371\27\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\256"
-    "\377\377\243\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\345\377\377"
-    "\66\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\116\377\377\377\377\116\0\0\0\0\0\377\377\377\377\377"
-    "\375\356\307\166\11\0\0\0\0\0\0\0\0\33\207\317\363\373\344\251\102"
-    "\0\0\0\377\377\377\375\363\331\253\142\13\0\0\0\0\0\377\377\377\377"
-    "\377\377\377\377\377\377\377\0\0\0\377\377\377\377\377\377\377\377"
-    "\377\377\377\0\0\0\0\0\45\223\327\367\371\333\234\73\0\0\0\0\377\377"
-    "\377\0\0\0\0\0\377\377\377\0\0\0\0\377\377\377\377\377\377\377\377"
-    "\377\0\0\0\0\0\0\0\377\377\377\377\377\377\377\0\0\0\377\377\377\0"
-    "\0\0\0\23\342\377\377\340\23\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\377"
-    "\377\377\377\55\0\0\62\377\377\377\377\0\0\377\377\377\307\0\0\0\0"
-    "\377\377\377\0\0\0\0\0\7\165\320\367\367\320\165\7\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\223\377\377\377\377\222\0\0\0\0\0\377\377"
-    "\377\377\377\377\377\377\377\324\23\0\0\0\0\0\0\125\363\377\377\377"
-    "\377\377\377\377\0\0\0\377\377\377\377\377\377\377\377\351\115\0\0"
-    "\0\0\377\377\377\377\377\377\377\377\377\377\377\0\0\0\377\377\377"
-    "\377\377\377\377\377\377\377\377\0\0\0\0\143\370\377\377\377\377\377"
-    "\377\377\0\0\0\0\377\377\377\0\0\0\0\0\377\377\377\0\0\0\0\377\377"
-    "\377\377\377\377\377\377\377\0\0\0\0\0\0\0\377\377\377\377\377\377"
-    "\377\0\0\0\377\377\377\0\0\0\1\267\377\377\370\64\0\0\0\0\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\377\377\377\377\151\0\0\155\377\377\377\377"
-    "\0\0\377\377\377\376\36\0\0\0\377\377\377\0\0\0\0\14\306\377\377\377"
-    "\377\377\377\306\14\0\0\0\0\0\0\40\211\317\364\372\342\242\57\0\0"
-    "\0\0\0\0\330\377\377\377\377\327\0\0\0\0\0\377\377\377\377\377\377"
-    "\377\377\377\377\223\0\0\0\0\0\103\374\377\377\377\377\377\377\377"
-    "\377\0\0\0\377\377\377\377\377\377\377\377\377\375\113\0\0\0\377\377"
-    "\377\377\377\377\377\377\377\377\377\0\0\0\377\377\377\377\377\377"
-    "\377\377\377\377\377\0\0\0\114\376\377\377\377\377\377\377\377\377"
-    "\0\0\0\0\377\377\377\0\0\0\0\0\377\377\377\0\0\0\0\377\377\377\377"
-    "\377\377\377\377\377\0\0\0\0\0\0\0\377\377\377\377\377\377\377\0\0"
-    "\0\377\377\377\0\0\0\174\377\377\377\144\0\0\0\0\0\377\377\377\0\0"
-    "\0\0\0\0\0\0\0\377\377\377\377\245\0\0\251\377\377\377\377\0\0\377"
-    "\377\377\377\163\0\0\0\377\377\377\0\0\0\0\233\377\377\377\377\377"
-    "\377\377\377\232\0\0\0\0\0\163\371\377\377\377\377\377\377\372\136"
-    "\0\0\0\0\34\377\377\336\346\377\377\34\0\0\0\0\377\377\377\0\0\2\36"
-    "\242\377\377\341\0\0\0\0\4\335\377\377\346\134\23\12\101\274\377\0"
-    "\0\0\377\377\377\0\6\40\150\346\377\377\345\7\0\0\377\377\377\0\0"
-    "\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\6\342\377\377\336"
-    "\121\17\7\67\250\377\0\0\0\0\377\377\377\0\0\0\0\0\377\377\377\0\0"
-    "\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0"
-    "\0\377\377\377\0\0\102\375\377\377\235\0\0\0\0\0\0\377\377\377\0\0"
-    "\0\0\0\0\0\0\0\377\377\377\377\341\0\0\344\377\377\377\377\0\0\377"
-    "\377\377\377\311\0\0\0\377\377\377\0\0\0\37\374\377\377\203\22\22"
-    "\204\377\377\374\36\0\0\0\206\377\377\257\103\16\5\51\225\377\372"
-    "\57\0\0\0\141\377\377\244\253\377\377\140\0\0\0\0\377\377\377\0\0"
-    "\0\0\21\377\377\372\0\0\0\0\121\377\377\366\47\0\0\0\0\1\206\0\0\0"
-    "\377\377\377\0\0\0\0\36\357\377\377\133\0\0\377\377\377\0\0\0\0\0"
-    "\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\125\377\377\361\35\0"
-    "\0\0\0\0\164\0\0\0\0\377\377\377\0\0\0\0\0\377\377\377\0\0\0\0\0\0"
-    "\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\377\377"
-    "\377\0\31\350\377\377\314\10\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0"
-    "\0\0\377\377\377\334\377\34\40\377\342\377\377\377\0\0\377\377\377"
-    "\377\377\40\0\0\377\377\377\0\0\0\166\377\377\266\0\0\0\0\267\377"
-    "\377\164\0\0\114\377\376\150\0\0\0\0\0\0\221\377\242\0\0\0\246\377"
-    "\377\152\160\377\377\245\0\0\0\0\377\377\377\0\0\0\0\17\377\377\354"
-    "\0\0\0\0\236\377\377\221\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0"
-    "\203\377\377\243\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\240\377\377\210\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\377\377\377\0\0\0\377\377\377\4\302\377\377\355\40"
-    "\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\377\377\377\246\377\131"
-    "\133\377\255\377\377\377\0\0\377\377\377\316\377\166\0\0\377\377\377"
-    "\0\0\0\262\377\377\131\0\0\0\0\132\377\377\262\0\3\334\377\214\0\0"
-    "\0\0\0\0\0\44\377\341\0\0\1\351\377\377\60\65\377\377\350\1\0\0\0"
-    "\377\377\377\0\0\1\32\232\377\377\253\0\0\0\0\320\377\377\102\0\0"
-    "\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\73\377\377\323\0\0\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\321\377"
-    "\377\75\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\377\377\377\0"
-    "\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0"
-    "\0\0\377\377\377\211\377\377\375\110\0\0\0\0\0\0\0\0\377\377\377\0"
-    "\0\0\0\0\0\0\0\0\377\377\377\161\377\225\226\377\170\377\377\377\0"
-    "\0\377\377\377\170\377\314\0\0\377\377\377\0\0\0\332\377\377\50\0"
-    "\0\0\0\51\377\377\331\0\113\377\350\12\0\2\151\312\364\367\314\133"
-    "\377\372\0\0\57\377\377\362\3\4\365\377\377\56\0\0\0\377\377\377\377"
-    "\377\377\377\377\377\345\43\0\0\0\0\357\377\377\27\0\0\0\0\0\0\0\0"
-    "\0\0\377\377\377\0\0\0\0\0\25\377\377\357\0\0\377\377\377\377\377"
-    "\377\377\377\377\377\0\0\0\0\377\377\377\377\377\377\377\377\377\377"
-    "\0\0\0\357\377\377\25\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377"
-    "\377\377\377\377\377\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\377\377\377\0\0\0\377\377\377\376\377\377\363\23\0\0\0\0"
-    "\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\377\377\377\74\377\321\322"
-    "\377\102\377\377\377\0\0\377\377\377\42\377\377\42\0\377\377\377\0"
-    "\0\0\362\377\377\15\0\0\0\0\17\377\377\361\0\231\377\210\0\2\257\377"
-    "\377\377\377\377\377\377\377\0\0\164\377\377\274\0\0\277\377\377\163"
-    "\0\0\0\377\377\377\377\377\377\377\377\323\77\0\0\0\0\0\375\377\377"
-    "\6\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\5\377\377\374\0\0\377"
-    "\377\377\377\377\377\377\377\377\377\0\0\0\0\377\377\377\377\377\377"
-    "\377\377\377\377\0\0\0\375\377\377\5\0\0\0\377\377\377\377\377\0\0"
-    "\0\377\377\377\377\377\377\377\377\377\377\377\0\0\0\0\0\0\0\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\377\377\377\377"
-    "\377\377\377\214\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\377"
-    "\377\377\12\374\375\375\376\17\377\377\377\0\0\377\377\377\0\313\377"
-    "\171\0\377\377\377\0\0\0\375\377\377\3\0\0\0\0\4\377\377\374\0\316"
-    "\377\104\0\153\377\355\125\14\15\127\356\377\377\0\0\270\377\377\202"
-    "\0\0\204\377\377\270\0\0\0\377\377\377\377\377\377\377\377\377\377"
-    "\233\2\0\0\0\375\377\377\6\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0"
-    "\0\6\377\377\373\0\0\377\377\377\377\377\377\377\377\377\377\0\0\0"
-    "\0\377\377\377\377\377\377\377\377\377\377\0\0\0\371\377\377\6\0\0"
-    "\0\377\377\377\377\377\0\0\0\377\377\377\377\377\377\377\377\377\377"
-    "\377\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\0\0\0\377\377\377\377\371\377\377\367\33\0\0\0\0\0\0\0\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\377\377\377\0\321\377\377\330\0\377\377\377"
-    "\0\0\377\377\377\0\164\377\317\0\377\377\377\0\0\0\375\377\377\3\0"
-    "\0\0\0\4\377\377\374\0\356\377\30\0\315\377\125\0\0\0\0\127\377\377"
-    "\0\7\366\377\377\110\0\0\111\377\377\365\6\0\0\377\377\377\0\0\1\22"
-    "\114\330\377\377\152\0\0\0\357\377\377\27\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\377\0\0\0\0\0\25\377\377\356\0\0\377\377\377\0\0\0\0\0\0\0\0"
-    "\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\352\377\377\30\0\0\0\377\377"
-    "\377\377\377\0\0\0\377\377\377\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0"
-    "\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\377\377"
-    "\377\344\70\373\377\377\231\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0"
-    "\0\0\0\377\377\377\0\234\377\377\243\0\377\377\377\0\0\377\377\377"
-    "\0\36\376\377\45\377\377\377\0\0\0\362\377\377\15\0\0\0\0\17\377\377"
-    "\361\0\374\377\7\0\366\377\13\0\0\0\0\14\377\377\0\102\377\377\377"
-    "\377\377\377\377\377\377\377\101\0\0\377\377\377\0\0\0\0\0\63\377"
-    "\377\315\0\0\0\320\377\377\102\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0"
-    "\0\0\0\74\377\377\322\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\312\377\377\103\0\0\0\0\0\377\377\377\0\0"
-    "\0\377\377\377\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\377\377\377\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\377\377\377\72\0\233\377"
-    "\377\373\43\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\0\147\377\377\156\0\377\377\377\0\0\377\377\377\0\0\307\377\173\377"
-    "\377\377\0\0\0\332\377\377\50\0\0\0\0\51\377\377\331\0\373\377\11"
-    "\0\366\377\13\0\0\0\0\14\377\377\0\206\377\377\377\377\377\377\377"
-    "\377\377\377\206\0\0\377\377\377\0\0\0\0\0\5\377\377\365\0\0\0\236"
-    "\377\377\221\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\204\377\377"
-    "\242\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0"
-    "\0\0\0\0\227\377\377\223\0\0\0\0\0\377\377\377\0\0\0\377\377\377\0"
-    "\0\0\0\0\377\377\377\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\5\377\377\373\0\0\0\377\377\377\0\0\37\372\377\377\245\0\0"
-    "\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\377"
-    "\377\377\0\0\377\377\377\0\0\160\377\322\377\377\377\0\0\0\262\377"
-    "\377\131\0\0\0\0\132\377\377\262\0\351\377\35\0\313\377\125\0\0\0"
-    "\0\127\377\377\0\313\377\377\377\377\377\377\377\377\377\377\312\0"
-    "\0\377\377\377\0\0\0\0\0\50\377\377\367\0\0\0\121\377\377\366\47\0"
-    "\0\0\0\1\205\0\0\0\377\377\377\0\0\0\0\36\357\377\377\131\0\0\377"
-    "\377\377\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\106"
-    "\377\377\367\51\0\0\0\0\377\377\377\0\0\0\377\377\377\0\0\0\0\0\377"
-    "\377\377\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\241\15\0\0\0\0\0\67"
-    "\377\377\351\0\0\0\377\377\377\0\0\0\230\377\377\375\55\0\0\0\0\0"
-    "\377\377\377\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\377\377\377"
-    "\0\0\377\377\377\0\0\33\376\377\377\377\377\0\0\0\166\377\377\266"
-    "\0\0\0\0\267\377\377\165\0\305\377\117\0\151\377\354\124\13\14\127"
-    "\356\377\377\22\375\377\377\115\0\0\0\0\124\377\377\375\22\0\377\377"
-    "\377\0\0\1\16\77\312\377\377\326\0\0\0\4\335\377\377\346\134\22\12"
-    "\101\273\377\0\0\0\377\377\377\0\5\37\147\345\377\377\344\7\0\0\377"
-    "\377\377\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\2\325"
-    "\377\377\347\135\22\4\61\377\377\377\0\0\0\377\377\377\0\0\0\0\0\377"
-    "\377\377\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\377\353\174\56\7\7"
-    "\74\323\377\377\272\0\0\0\377\377\377\0\0\0\35\371\377\377\262\0\0"
-    "\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\377\377"
-    "\377\0\0\377\377\377\0\0\0\303\377\377\377\377\0\0\0\40\374\377\377"
-    "\203\21\22\203\377\377\374\37\0\212\377\231\0\2\254\377\377\377\377"
-    "\377\377\377\377\124\377\377\376\22\0\0\0\0\26\377\377\377\124\0\377"
-    "\377\377\377\377\377\377\377\377\377\377\177\0\0\0\0\103\374\377\377"
-    "\377\377\377\377\377\377\0\0\0\377\377\377\377\377\377\377\377\377"
-    "\375\112\0\0\0\377\377\377\377\377\377\377\377\377\377\377\0\0\0\377"
-    "\377\377\0\0\0\0\0\0\0\0\0\0\0\72\373\377\377\377\377\377\377\377"
-    "\377\377\0\0\0\377\377\377\0\0\0\0\0\377\377\377\0\0\0\0\377\377\377"
-    "\377\377\377\377\377\377\0\0\0\377\377\377\377\377\377\377\377\377"
-    "\377\140\0\0\0\377\377\377\0\0\0\0\225\377\377\377\70\0\0\0\0\377"
-    "\377\377\377\377\377\377\377\377\377\377\0\377\377\377\0\0\0\0\0\0"
-    "\377\377\377\0\0\377\377\377\0\0\0\155\377\377\377\377\0\0\0\0\233"
-    "\377\377\377\377\377\377\377\377\232\0\0\63\377\365\27\0\2\147\312"
-    "\365\370\321\141\377\377\231\377\377\323\0\0\0\0\0\0\326\377\377\230"
-    "\0\377\377\377\377\377\377\377\377\377\377\276\12\0\0\0\0\0\125\363"
-    "\377\377\377\377\377\377\377\0\0\0\377\377\377\377\377\377\377\377"
-    "\351\115\0\0\0\0\377\377\377\377\377\377\377\377\377\377\377\0\0\0"
-    "\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\123\364\377\377\377\377\377\377"
-    "\377\254\0\0\0\377\377\377\0\0\0\0\0\377\377\377\0\0\0\0\377\377\377"
-    "\377\377\377\377\377\377\0\0\0\377\377\377\377\377\377\377\377\377"
-    "\257\2\0\0\0\377\377\377\0\0\0\0\33\367\377\377\275\0\0\0\0\377\377"
-    "\377\377\377\377\377\377\377\377\377\0\377\377\377\0\0\0\0\0\0\377"
-    "\377\377\0\0\377\377\377\0\0\0\31\375\377\377\377\0\0\0\0\14\307\377"
-    "\377\377\377\377\377\306\14\0\0\0\274\377\265\1\0\0\0\0\0\0\0\0\0"
-    "\336\377\377\226\0\0\0\0\0\0\227\377\377\335\0\377\377\377\377\377"
-    "\376\364\334\254\130\2\0\0\0\0\0\0\0\33\210\320\364\374\345\250\101"
-    "\0\0\0\377\377\377\376\365\333\255\144\13\0\0\0\0\0\377\377\377\377"
-    "\377\377\377\377\377\377\377\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\35\214\324\367\371\340\245\101\0\0\0\0\377\377\377\0\0\0\0"
-    "\0\377\377\377\0\0\0\0\377\377\377\377\377\377\377\377\377\0\0\0\54"
-    "\175\272\344\371\371\345\265\133\1\0\0\0\0\377\377\377\0\0\0\0\0\221"
-    "\377\377\377\104\0\0\0\377\377\377\377\377\377\377\377\377\377\377"
-    "\0\377\377\377\0\0\0\0\0\0\377\377\377\0\0\377\377\377\0\0\0\0\277"
-    "\377\377\377\0\0\0\0\0\7\166\321\370\370\321\166\7\0\0\0\0\46\362"
-    "\377\244\11\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\105\366\377"
-    "\340\162\52\7\5\41\141\307\67\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\61\322"
-    "\377\377\377\377\377\377\377\377\270\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\2\117\244\332\367\374\354\304\176\32\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377"
-    "\375\361\326\243\105\0\0\0\0\0\0\7\165\320\367\367\320\165\7\0\0\0"
-    "\0\0\377\377\377\377\377\366\342\263\134\2\0\0\0\0\0\0\127\273\355"
-    "\373\356\307\211\61\0\0\0\0\377\377\377\377\377\377\377\377\377\377"
-    "\377\0\0\377\377\377\0\0\0\0\0\377\377\377\0\0\0\343\377\377\225\0"
-    "\0\0\0\0\226\377\377\342\361\377\377\17\0\0\0\0\0\0\25\377\377\362"
-    "\266\377\377\330\5\0\0\0\0\5\330\377\377\265\0\305\377\377\351\6\0"
-    "\0\0\6\351\377\377\305\0\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\0\0\0\0\0\0\377\377\377\377\377\330\0\0\0\0\304\377\337\3\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\254\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\111"
-    "\376\377\376\111\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\377\377\377\377\377\377\235\1\0\0\0\14\306\377\377\377\377\377\377"
-    "\306\14\0\0\0\0\377\377\377\377\377\377\377\377\377\270\6\0\0\0\1"
-    "\241\377\377\377\377\377\377\377\377\0\0\0\0\377\377\377\377\377\377"
-    "\377\377\377\377\377\0\0\377\377\377\0\0\0\0\0\377\377\377\0\0\0\250"
-    "\377\377\310\0\0\0\0\0\311\377\377\247\324\377\377\46\0\0\0\0\0\0"
-    "\47\377\377\326\47\372\377\377\160\0\0\0\0\163\377\377\372\46\0\120"
-    "\377\377\377\130\0\0\0\131\377\377\377\117\0\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\0\0\0\0\0\0\377\377\377\377\377\330\0\0\0"
-    "\0\115\377\377\133\0\0\0\0\0\0\0\0\0\0\0\0\254\377\377\377\377\377"
-    "\0\0\0\0\0\0\0\0\0\30\352\377\377\377\351\30\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377\135\0\0\0"
-    "\233\377\377\377\377\377\377\377\377\232\0\0\0\0\377\377\377\377\377"
-    "\377\377\377\377\377\161\0\0\0\143\377\377\377\377\377\377\377\377"
-    "\377\0\0\0\0\377\377\377\377\377\377\377\377\377\377\377\0\0\377\377"
-    "\377\0\0\0\0\0\377\377\377\0\0\0\155\377\377\367\4\0\0\0\5\367\377"
-    "\377\155\266\377\377\75\0\0\0\0\0\0\70\377\377\272\0\214\377\377\357"
-    "\24\0\0\26\361\377\377\214\0\0\2\331\377\377\300\0\0\0\301\377\377"
-    "\330\1\0\377\377\377\377\377\377\377\377\377\377\377\377\0\0\0\0\0"
-    "\0\377\377\377\0\0\0\0\0\0\0\1\324\377\321\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\377\377\377\0\0\0\0\0\0\0\0\1\272\377\377\377\377\377\272\1"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\1\15\76\312\377"
-    "\377\275\0\0\37\374\377\377\203\22\22\204\377\377\374\36\0\0\0\377"
-    "\377\377\0\0\11\66\306\377\377\311\0\0\0\310\377\377\250\37\3\34\151"
-    "\341\377\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\377\377\377\0\0\0"
-    "\0\0\377\377\377\0\0\0\63\377\377\377\57\0\0\0\60\377\377\377\62\230"
-    "\377\377\124\0\0\0\0\0\0\112\377\377\236\0\16\350\377\377\227\0\0"
-    "\234\377\377\350\16\0\0\0\145\377\377\377\50\0\51\377\377\377\144"
-    "\0\0\0\0\0\0\0\0\0\164\377\377\377\244\0\0\0\0\0\0\377\377\377\0\0"
-    "\0\0\0\0\0\0\136\377\377\112\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\0\0\0\0\0\0\0\0\166\377\377\366\171\367\377\377\165\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\52\377\377\354\0\0\166"
-    "\377\377\266\0\0\0\0\267\377\377\164\0\0\0\377\377\377\0\0\0\0\50"
-    "\377\377\361\0\0\0\364\377\377\30\0\0\0\0\10\234\0\0\0\0\0\0\0\0\377"
-    "\377\377\0\0\0\0\0\0\377\377\377\0\0\0\0\0\377\377\377\0\0\0\4\364"
-    "\377\377\142\0\0\0\143\377\377\363\3\172\377\377\153\0\0\0\0\0\0\134"
-    "\377\377\202\0\0\142\377\377\374\55\63\375\377\377\143\0\0\0\0\7\350"
-    "\377\377\220\0\221\377\377\347\7\0\0\0\0\0\0\0\0\45\366\377\377\346"
-    "\21\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\4\341\377\302\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\65\372\377\370\107"
-    "\0\107\370\377\372\64\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\0\0\0\0\5\377\377\373\0\0\262\377\377\131\0\0\0\0\132\377\377\261"
-    "\0\0\0\377\377\377\0\0\0\0\5\377\377\373\0\0\0\371\377\377\74\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\377\377\377\0\0\0"
-    "\0\0\377\377\377\0\0\0\0\275\377\377\226\0\0\0\227\377\377\275\0\135"
-    "\377\377\202\0\206\377\377\212\0\155\377\377\147\0\0\1\313\377\377"
-    "\275\304\377\377\314\2\0\0\0\0\0\173\377\377\356\22\357\377\377\172"
-    "\0\0\0\0\0\0\0\0\1\301\377\377\377\113\0\0\0\0\0\0\0\377\377\377\0"
-    "\0\0\0\0\0\0\0\0\156\377\377\71\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\0\0\0\0\0\0\15\334\377\371\114\0\0\0\114\372\377\333\15\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\52\377\377\354\0\0"
-    "\332\377\377\50\0\0\0\0\51\377\377\331\0\0\0\377\377\377\0\0\0\0\51"
-    "\377\377\345\0\0\0\324\377\377\355\161\17\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\377\377\377\0\0\0\0\0\0\377\377\377\0\0\0\0\0\377\377\377\0\0\0\0"
-    "\203\377\377\311\0\0\0\312\377\377\202\0\77\377\377\231\0\262\377"
-    "\377\276\0\177\377\377\113\0\0\0\71\376\377\377\377\377\377\73\0\0"
-    "\0\0\0\0\21\364\377\377\275\377\377\363\20\0\0\0\0\0\0\0\0\153\377"
-    "\377\377\236\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\12\354"
-    "\377\261\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\243\377"
-    "\373\121\0\0\0\0\0\121\373\377\243\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\377\377\377\0\0\15\75\312\377\377\275\0\0\362\377\377\15\0\0\0\0"
-    "\17\377\377\361\0\0\0\377\377\377\0\0\10\66\306\377\377\242\0\0\0"
-    "\165\377\377\377\377\367\262\137\7\0\0\0\0\0\0\0\0\0\377\377\377\0"
-    "\0\0\0\0\0\377\377\377\0\0\0\0\0\377\377\377\0\0\0\0\110\377\377\367"
-    "\4\0\5\370\377\377\107\0\41\377\377\260\0\336\377\377\360\1\220\377"
-    "\377\57\0\0\0\0\243\377\377\377\377\245\0\0\0\0\0\0\0\0\220\377\377"
-    "\377\377\377\217\0\0\0\0\0\0\0\0\37\363\377\377\342\17\0\0\0\0\0\0"
-    "\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\177\377\376\51\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377"
-    "\135\0\0\375\377\377\3\0\0\0\0\4\377\377\374\0\0\0\377\377\377\377"
-    "\377\377\377\377\377\354\43\0\0\0\3\236\377\377\377\377\377\377\336"
-    "\67\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\377\377\377\0\0\0\0\0"
-    "\377\377\377\0\0\0\0\17\375\377\377\60\0\61\377\377\375\17\0\5\375"
-    "\377\307\13\376\376\376\377\46\242\377\377\23\0\0\0\0\32\366\377\377"
-    "\367\34\0\0\0\0\0\0\0\0\37\373\377\377\377\373\36\0\0\0\0\0\0\0\0"
-    "\271\377\377\377\105\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0"
-    "\0\0\23\364\377\240\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\377\377\377\377\377\377\235\1\0\0\375\377\377\3\0\0\0\0\4\377"
-    "\377\374\0\0\0\377\377\377\377\377\377\377\377\266\34\0\0\0\0\0\0"
-    "\114\316\377\377\377\377\377\360\41\0\0\0\0\0\0\0\377\377\377\0\0"
-    "\0\0\0\0\377\377\377\0\0\0\0\0\377\377\377\0\0\0\0\0\323\377\377\143"
-    "\0\144\377\377\322\0\0\0\345\377\336\66\377\333\332\377\133\264\377"
-    "\367\0\0\0\0\0\66\376\377\377\377\70\0\0\0\0\0\0\0\0\0\245\377\377"
-    "\377\244\0\0\0\0\0\0\0\0\141\377\377\377\230\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\377\0\0\0\0\0\0\0\0\0\0\0\220\377\372\35\0\0\0\0\0\0\0\0\0\0"
-    "\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\377\377\377\377\376\363\330\243\106\0\0\0\0\362"
-    "\377\377\15\0\0\0\0\17\377\377\363\0\0\0\377\377\377\377\377\377\377"
-    "\377\370\46\0\0\0\0\0\0\0\0\66\207\343\377\377\377\234\0\0\0\0\0\0"
-    "\0\377\377\377\0\0\0\0\0\0\377\377\377\0\0\0\0\0\377\377\377\0\0\0"
-    "\0\0\230\377\377\226\0\227\377\377\227\0\0\0\310\377\365\142\377\251"
-    "\244\377\217\305\377\334\0\0\0\0\0\304\377\377\377\377\307\0\0\0\0"
-    "\0\0\0\0\0\60\377\377\377\60\0\0\0\0\0\0\0\31\357\377\377\337\14\0"
-    "\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\35\372\377\217"
-    "\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0"
-    "\0\0\332\377\377\50\0\0\0\0\51\377\377\336\0\0\0\377\377\377\0\10"
-    "\156\376\377\377\237\0\0\0\0\0\0\0\0\0\0\5\242\377\377\343\0\0\0\0"
-    "\0\0\0\377\377\377\0\0\0\0\0\0\374\377\377\0\0\0\0\0\377\377\374\0"
-    "\0\0\0\0\135\377\377\312\0\313\377\377\135\0\0\0\252\377\377\232\377"
-    "\166\157\377\303\327\377\300\0\0\0\0\126\377\377\375\376\377\377\130"
-    "\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\260\377\377\376\101"
-    "\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\241\377"
-    "\364\22\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0"
-    "\0\0\0\0\0\261\377\377\131\0\0\0\0\132\377\377\273\0\0\0\377\377\377"
-    "\0\0\0\221\377\377\373\44\0\0\0\0\0\0\0\0\0\0\21\377\377\373\0\0\0"
-    "\0\0\0\0\377\377\377\0\0\0\0\0\0\360\377\377\6\0\0\0\7\377\377\357"
-    "\0\0\0\0\0\43\377\377\370\12\370\377\377\42\0\0\0\214\377\377\336"
-    "\377\104\72\377\364\353\377\244\0\0\0\7\336\377\377\236\246\377\377"
-    "\337\7\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\130\377\377\377\223"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\53\376"
-    "\377\176\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0"
-    "\0\0\0\0\0\164\377\377\266\0\0\0\0\267\377\377\210\0\0\0\377\377\377"
-    "\0\0\0\27\367\377\377\246\0\0\0\250\30\0\0\0\0\0\34\377\377\363\0"
-    "\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\321\377\377\76\0\0\0\100\377"
-    "\377\320\0\0\0\0\0\0\350\377\377\143\377\377\347\0\0\0\0\156\377\377"
-    "\377\377\22\11\373\377\377\377\210\0\0\0\166\377\377\365\33\37\370"
-    "\377\377\170\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\25\353\377\377"
-    "\333\12\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\262\377\353\12\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\36\374\377\377\203\21\22\203\377\377\377\77\0"
-    "\0\0\377\377\377\0\0\0\0\217\377\377\376\55\0\0\377\364\223\102\23"
-    "\4\55\277\377\377\314\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\231\377"
-    "\377\326\63\5\64\331\377\377\231\0\0\0\0\0\0\255\377\377\312\377\377"
-    "\255\0\0\0\0\121\377\377\377\337\0\0\317\377\377\377\155\0\0\25\361"
-    "\377\377\203\0\0\210\377\377\361\26\0\0\0\0\0\0\0\377\377\377\0\0"
-    "\0\0\0\0\247\377\377\375\74\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\72\377\377\156\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\227\377\377\377\377\377"
-    "\377\377\377\323\1\0\0\0\377\377\377\0\0\0\0\27\365\377\377\261\0"
-    "\0\377\377\377\377\377\377\377\377\377\377\156\0\0\0\0\0\0\0\377\377"
-    "\377\0\0\0\0\0\0\71\377\377\377\377\377\377\377\377\377\70\0\0\0\0"
-    "\0\0\163\377\377\377\377\377\162\0\0\0\0\63\377\377\377\255\0\0\232"
-    "\377\377\377\121\0\0\227\377\377\350\14\0\0\16\352\377\377\230\0\0"
-    "\0\0\0\0\0\377\377\377\0\0\0\0\0\0\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\302\377\340\4\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0"
-    "\0\0\0\0\0\0\0\0\12\302\377\377\377\377\377\377\364\66\0\0\0\0\377"
-    "\377\377\0\0\0\0\0\213\377\377\377\67\0\377\377\377\377\377\377\377"
-    "\377\377\255\4\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\214\377\377"
-    "\377\377\377\377\377\214\0\0\0\0\0\0\0\70\377\377\377\377\377\67\0"
-    "\0\0\0\25\377\377\377\173\0\0\144\377\377\377\65\0\53\374\377\377"
-    "\150\0\0\0\0\152\377\377\374\53\0\0\0\0\0\0\377\377\377\0\0\0\0\0"
-    "\0\377\377\377\377\377\377\377\377\377\377\377\377\0\0\0\0\0\0\377"
-    "\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\113\377\377\135\0\0\0\0\0\0\0"
-    "\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\5\161\316\367"
-    "\377\377\377\336\23\0\0\0\0\377\377\377\0\0\0\0\0\25\363\377\377\275"
-    "\0\57\203\300\347\372\371\343\261\124\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\0\0\0\0\0\0\0\0\124\272\354\373\354\273\125\0\0\0\0\0\0\0\0\6\367"
-    "\377\377\377\367\5\0\0\0\0\0\366\377\377\111\0\0\57\377\377\377\31"
-    "\0\270\377\377\326\3\0\0\0\0\4\327\377\377\270\0\0\0\0\0\0\377\377"
-    "\377\0\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377\377\377\0"
-    "\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\322\377\323\1"
-    "\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\33\335\377\377\303\7\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\134\377\377\114\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\40\342\377\347\44\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\330\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\4\337\377\304\0\0\0\0\254\377\377\377\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\44\302\41\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\377\377\330\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\254\377\377"
-    "\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\377\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\160"
-    "\375\377\333\24\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\122\367\377\306\11\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\3\167\323\366\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\377\377\377\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0"
-    "\377\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\72"
-    "\354\377\255\2\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\166\377\377"
-    "\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\377\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\45\334\377\220"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\322\377\377\377\377\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\366\377\377\71\1\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\57\204\300\347\371\370\345\266\134\1\0\0\0"
-    "\377\377\377\0\123\316\372\354\265\100\0\0\0\0\0\0\0\3\130\261\345"
-    "\371\365\324\226\67\0\0\0\0\101\265\354\372\316\123\0\377\377\377"
-    "\0\0\0\0\20\201\321\363\366\330\222\36\0\0\0\0\0\377\377\377\377\377"
-    "\377\377\377\377\377\0\0\0\0\0\55\252\352\372\326\154\1\377\377\377"
-    "\0\0\0\377\377\377\0\146\322\372\357\263\56\0\0\0\0\0\377\377\377"
-    "\377\377\377\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\0\0\0\0\0\0"
-    "\377\377\377\0\0\0\67\361\377\377\357\73\0\0\0\0\0\377\377\377\0\0"
-    "\0\0\0\0\0\377\377\377\56\320\364\213\4\220\361\357\230\4\0\0\377"
-    "\377\377\0\151\324\372\357\261\54\0\0\0\0\0\22\204\323\365\365\323"
-    "\204\22\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377"
-    "\377\377\377\377\256\1\0\0\377\377\377\153\377\377\377\377\377\376"
-    "\146\0\0\0\0\0\27\305\377\377\377\377\377\377\377\377\0\0\0\152\377"
-    "\377\377\377\377\377\153\377\377\377\0\0\0\53\344\377\377\377\377"
-    "\377\377\361\103\0\0\0\0\377\377\377\377\377\377\377\377\377\377\0"
-    "\0\0\0\111\370\377\377\377\377\377\226\377\377\377\0\0\0\377\377\377"
-    "\173\377\377\377\377\377\362\44\0\0\0\0\377\377\377\377\377\377\0"
-    "\0\0\0\0\0\0\0\0\377\377\377\377\377\377\0\0\0\0\0\0\377\377\377\0"
-    "\0\64\360\377\377\350\57\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\377"
-    "\377\377\327\377\377\377\272\377\377\377\377\161\0\0\377\377\377\201"
-    "\377\377\377\377\377\361\42\0\0\0\55\345\377\377\377\377\377\377\345"
-    "\55\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377"
-    "\377\377\377\131\0\0\377\377\377\371\377\377\377\377\377\377\371\45"
-    "\0\0\0\5\313\377\377\377\377\377\377\377\377\377\0\0\47\372\377\377"
-    "\377\377\377\377\371\377\377\377\0\0\13\334\377\377\377\377\377\377"
-    "\377\377\356\30\0\0\0\377\377\377\377\377\377\377\377\377\377\0\0"
-    "\0\25\355\377\377\377\377\377\377\377\377\377\377\0\0\0\377\377\377"
-    "\365\377\377\377\377\377\377\234\0\0\0\0\377\377\377\377\377\377\0"
-    "\0\0\0\0\0\0\0\0\377\377\377\377\377\377\0\0\0\0\0\0\377\377\377\0"
-    "\60\356\377\377\340\44\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\273\0\0\377\377\377\367"
-    "\377\377\377\377\377\377\232\0\0\14\336\377\377\377\377\377\377\377"
-    "\377\336\14\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\324\201\104\32\7\4\43"
-    "\221\377\377\260\0\0\377\377\377\370\150\17\16\144\367\377\377\215"
-    "\0\0\0\144\377\377\377\235\61\10\10\46\143\303\0\0\217\377\377\367"
-    "\144\16\17\150\370\377\377\377\0\0\160\377\377\325\103\12\7\64\300"
-    "\377\377\203\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\173\377\377\371"
-    "\152\17\20\155\372\377\377\377\0\0\0\377\377\377\341\100\6\33\253"
-    "\377\377\335\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\377\0\0\0\0\0\0\377\377\377\55\354\377\377\326\33\0\0\0\0\0\0"
-    "\0\0\377\377\377\0\0\0\0\0\0\0\377\377\377\106\116\377\377\377\113"
-    "\110\377\377\340\0\0\377\377\377\342\102\6\33\253\377\377\335\0\0"
-    "\162\377\377\366\143\16\16\143\366\377\377\162\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\3\377\377\340\0\0\377\377\377\165\0\0"
-    "\0\0\164\377\377\315\0\0\0\275\377\377\222\0\0\0\0\0\0\0\0\0\317\377"
-    "\377\163\0\0\0\0\166\377\377\377\0\0\301\377\377\52\0\0\0\0\32\377"
-    "\377\314\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\305\377\377\171\0\0"
-    "\0\0\174\377\377\377\0\0\0\377\377\377\110\0\0\0\36\377\377\370\0"
-    "\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0"
-    "\0\0\0\377\377\377\351\377\377\317\23\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\0\0\0\0\0\0\0\377\377\377\6\10\377\377\377\7\7\377\377\364\0\0\377"
-    "\377\377\111\0\0\0\37\377\377\370\0\0\303\377\377\160\0\0\0\0\161"
-    "\377\377\302\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\24\175\304\352\371"
-    "\377\377\377\377\377\367\0\0\377\377\377\33\0\0\0\0\33\377\377\360"
-    "\0\0\0\353\377\377\41\0\0\0\0\0\0\0\0\0\361\377\377\32\0\0\0\0\33"
-    "\377\377\377\0\0\355\377\377\374\374\375\376\376\377\377\377\360\0"
-    "\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\355\377\377\34\0\0\0\0\35\377"
-    "\377\377\0\0\0\377\377\377\11\0\0\0\1\377\377\377\0\0\0\0\0\0\0\377"
-    "\377\377\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\377\377\377"
-    "\377\377\377\336\14\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\377"
-    "\377\377\0\0\377\377\377\0\0\377\377\375\0\0\377\377\377\11\0\0\0"
-    "\2\377\377\377\0\0\355\377\377\31\0\0\0\0\32\377\377\355\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\52\351\377\377\377\377\377\377\377\377\377"
-    "\377\0\0\377\377\377\4\0\0\0\0\4\377\377\374\0\0\0\373\377\377\4\0"
-    "\0\0\0\0\0\0\0\0\374\377\377\3\0\0\0\0\4\377\377\377\0\0\373\377\377"
-    "\377\377\377\377\377\377\377\377\376\0\0\0\0\0\0\377\377\377\0\0\0"
-    "\0\0\0\0\374\377\377\4\0\0\0\0\5\377\377\377\0\0\0\377\377\377\0\0"
-    "\0\0\0\377\377\377\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\377\377\377\0\0\0\0\0\0\377\377\377\377\374\377\377\230\0\0\0\0"
-    "\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\377\377\377\0\0\377\377\377\0"
-    "\0\377\377\377\0\0\377\377\377\0\0\0\0\0\377\377\377\0\0\373\377\377"
-    "\3\0\0\0\0\4\377\377\373\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\267\377\377"
-    "\377\377\377\377\377\377\377\377\377\0\0\377\377\377\33\0\0\0\0\32"
-    "\377\377\360\0\0\0\355\377\377\40\0\0\0\0\0\0\0\0\0\361\377\377\32"
-    "\0\0\0\0\33\377\377\377\0\0\360\377\377\377\377\377\377\377\377\377"
-    "\377\377\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\362\377\377\34\0\0"
-    "\0\0\35\377\377\377\0\0\0\377\377\377\0\0\0\0\0\377\377\377\0\0\0"
-    "\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0"
-    "\0\377\377\377\225\121\377\377\377\106\0\0\0\0\0\0\0\0\376\377\377"
-    "\1\0\0\0\0\0\0\377\377\377\0\0\377\377\377\0\0\377\377\377\0\0\377"
-    "\377\377\0\0\0\0\0\377\377\377\0\0\355\377\377\31\0\0\0\0\32\377\377"
-    "\355\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\363\377\377\166\47\15\3\0\30"
-    "\377\377\377\0\0\377\377\377\164\0\0\0\0\162\377\377\316\0\0\0\277"
-    "\377\377\216\0\0\0\0\0\0\0\0\0\317\377\377\161\0\0\0\0\164\377\377"
-    "\377\0\0\312\377\377\31\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0"
-    "\0\0\0\0\0\0\316\377\377\170\0\0\0\0\174\377\377\377\0\0\0\377\377"
-    "\377\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\377\377\377\0\0\0\0\0\0\377\377\377\0\0\253\377\377\343"
-    "\17\0\0\0\0\0\0\0\363\377\377\35\0\0\0\0\0\0\377\377\377\0\0\377\377"
-    "\377\0\0\377\377\377\0\0\377\377\377\0\0\0\0\0\377\377\377\0\0\303"
-    "\377\377\160\0\0\0\0\161\377\377\302\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\363\377\377\137\22\2\21\111\313\377\377\377\0\0\377\377\377\367"
-    "\145\16\15\142\366\377\377\216\0\0\0\150\377\377\377\232\57\7\7\43"
-    "\140\303\0\0\217\377\377\366\142\15\16\146\367\377\377\377\0\0\200"
-    "\377\377\305\100\16\2\20\65\166\317\0\0\0\0\0\0\0\377\377\377\0\0"
-    "\0\0\0\0\0\210\377\377\371\151\16\17\154\372\377\377\377\0\0\0\377"
-    "\377\377\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\377\377\377\0\0\30\357\377"
-    "\377\240\0\0\0\0\0\0\0\324\377\377\241\24\0\0\0\0\0\377\377\377\0"
-    "\0\377\377\377\0\0\377\377\377\0\0\377\377\377\0\0\0\0\0\377\377\377"
-    "\0\0\162\377\377\366\142\15\15\142\366\377\377\162\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\266\377\377\377\377\377\377\377\375\377\377\377\0"
-    "\0\377\377\377\366\377\377\377\377\377\377\372\46\0\0\0\6\320\377"
-    "\377\377\377\377\377\377\377\377\0\0\47\372\377\377\377\377\377\377"
-    "\366\377\377\377\0\0\26\354\377\377\377\377\377\377\377\377\377\0"
-    "\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\36\364\377\377\377\377\377"
-    "\377\377\377\377\377\0\0\0\377\377\377\0\0\0\0\0\377\377\377\0\0\0"
-    "\377\377\377\377\377\377\377\377\377\377\377\0\0\0\0\0\0\0\0\377\377"
-    "\377\0\0\0\0\0\0\377\377\377\0\0\0\144\377\377\377\115\0\0\0\0\0\0"
-    "\230\377\377\377\377\377\377\377\0\0\377\377\377\0\0\377\377\377\0"
-    "\0\377\377\377\0\0\377\377\377\0\0\0\0\0\377\377\377\0\0\15\337\377"
-    "\377\377\377\377\377\377\377\336\14\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\53\355\377\377\377\377\377\377\162\377\377\377\0\0\377\377\377"
-    "\156\377\377\377\377\377\377\154\0\0\0\0\0\33\313\377\377\377\377"
-    "\377\377\377\377\0\0\0\154\377\377\377\377\377\377\152\377\377\377"
-    "\0\0\0\75\355\377\377\377\377\377\377\377\377\0\0\0\0\0\0\0\377\377"
-    "\377\0\0\0\0\0\0\0\0\126\373\377\377\377\377\377\241\377\377\377\0"
-    "\0\0\377\377\377\0\0\0\0\0\377\377\377\0\0\0\377\377\377\377\377\377"
-    "\377\377\377\377\377\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\377\377"
-    "\377\0\0\0\1\300\377\377\350\23\0\0\0\0\0\51\366\377\377\377\377\377"
-    "\377\0\0\377\377\377\0\0\377\377\377\0\0\377\377\377\0\0\377\377\377"
-    "\0\0\0\0\0\377\377\377\0\0\0\55\345\377\377\377\377\377\377\345\55"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\35\224\333\371\367\304\112\0"
-    "\377\377\377\0\0\377\377\377\0\131\316\372\360\274\106\0\0\0\0\0\0"
-    "\0\5\135\265\347\372\366\331\234\73\0\0\0\0\107\274\360\372\316\126"
-    "\0\377\377\377\0\0\0\0\30\205\317\362\374\355\310\212\62\0\0\0\0\0"
-    "\0\0\377\377\377\0\0\0\0\0\0\0\0\0\63\256\353\374\336\177\7\377\377"
-    "\370\0\0\0\377\377\377\0\0\0\0\0\377\377\377\0\0\0\377\377\377\377"
-    "\377\377\377\377\377\377\377\0\0\0\0\0\0\0\4\377\377\375\0\0\0\0\0"
-    "\0\377\377\377\0\0\0\0\46\367\377\377\251\0\0\0\0\0\0\71\273\362\377"
-    "\377\377\377\0\0\377\377\377\0\0\377\377\377\0\0\377\377\377\0\0\377"
-    "\377\377\0\0\0\0\0\377\377\377\0\0\0\0\22\204\323\365\365\323\204"
-    "\22\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\57\377\377\343\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\37\377\377\362\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\315\163\65\21\3\14\104\324\377\377\255\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\16\231\377"
-    "\377\325\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377"
-    "\107\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\377\377\377\377\377\377\377\233\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377"
-    "\377\377\377\377\377\207\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\372\60\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\62\213\313\360\374\363\330\240\75\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\366\306\104"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\7\201\322\363\376\377\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0"
-    "\0\0\377\376\363\323\202\7\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\207\377\377\377\377\377\0\0\0\0\0\0\0\0\377"
-    "\377\377\0\0\0\0\0\0\0\0\377\377\377\377\377\206\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\332\377\377\166\6\0\0"
-    "\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\7\173\377\377\331\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\370\377"
-    "\377\22\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\24\377"
-    "\377\366\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\377\377\377\1\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0"
-    "\0\2\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\377\377\377\0\131\316\371\357\272\106\0\0\0\0\0"
-    "\0\106\272\357\371\315\126\0\377\377\377\0\0\0\0\377\377\377\0\77"
-    "\270\361\370\303\117\0\0\0\0\31\210\317\362\374\357\311\212\62\0\0"
-    "\0\0\377\377\377\377\377\377\377\377\377\377\0\0\0\0\377\377\377\0"
-    "\0\0\0\0\377\377\377\0\0\331\377\377\231\0\0\0\0\231\377\377\330\0"
-    "\351\377\356\0\0\0\0\0\0\0\0\357\377\351\0\247\377\377\377\107\0\0"
-    "\113\377\377\377\247\0\0\320\377\377\302\0\0\0\0\274\377\377\323\0"
-    "\0\377\377\377\377\377\377\377\377\377\377\377\0\0\0\0\0\0\0\0\377"
-    "\377\377\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\377\377\377\155\377\377\377\377\377\377\153\0\0\0\0\154"
-    "\377\377\377\377\377\377\152\377\377\377\0\0\0\0\377\377\377\130\375"
-    "\377\377\377\377\377\0\0\0\61\355\377\377\377\377\377\377\377\377"
-    "\0\0\0\0\377\377\377\377\377\377\377\377\377\377\0\0\0\0\377\377\377"
-    "\0\0\0\0\0\377\377\377\0\0\213\377\377\333\0\0\0\0\334\377\377\212"
-    "\0\274\377\377\25\0\0\0\0\0\0\26\377\377\273\0\21\344\377\377\314"
-    "\1\1\317\377\377\345\21\0\0\157\377\377\375\30\0\0\14\371\377\377"
-    "\172\0\0\377\377\377\377\377\377\377\377\377\377\377\0\0\0\0\0\0\0"
-    "\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0"
-    "\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\377\377\377\366\377\377\377\377\377\377\371\46"
-    "\0\0\47\372\377\377\377\377\377\377\365\377\377\377\0\0\0\0\377\377"
-    "\377\355\377\377\377\377\377\377\0\0\0\302\377\377\377\377\377\377"
-    "\377\377\377\0\0\0\0\377\377\377\377\377\377\377\377\377\377\0\0\0"
-    "\0\377\377\377\0\0\0\0\0\377\377\377\0\0\74\377\377\377\35\0\0\36"
-    "\377\377\377\73\0\216\377\377\74\0\0\0\0\0\0\75\377\377\215\0\0\104"
-    "\376\377\377\124\127\377\377\377\110\0\0\0\24\372\377\377\153\0\0"
-    "\116\377\377\377\42\0\0\377\377\377\377\377\377\377\377\377\377\350"
-    "\0\0\0\0\0\0\0\14\377\377\375\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0"
-    "\0\0\0\0\0\0\0\0\0\0\375\377\377\13\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\370\150\17\16\144"
-    "\367\377\377\216\0\0\217\377\377\367\144\16\17\150\370\377\377\377"
-    "\0\0\0\0\377\377\377\377\226\60\10\14\75\255\0\0\0\370\377\377\145"
-    "\22\2\17\63\161\314\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\377"
-    "\377\377\0\0\0\0\0\377\377\377\0\0\2\353\377\377\140\0\0\141\377\377"
-    "\352\2\0\141\377\377\142\0\166\377\377\170\0\144\377\377\140\0\0\0"
-    "\221\377\377\330\330\377\377\227\0\0\0\0\0\256\377\377\300\0\0\226"
-    "\377\377\311\0\0\0\0\0\0\0\0\13\312\377\377\364\63\0\0\0\0\0\0\0\102"
-    "\377\377\353\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0"
-    "\0\354\377\377\100\0\0\0\0\0\116\262\352\374\353\267\160\53\10\20"
-    "\116\300\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\165\0\0\0\0\164"
-    "\377\377\316\0\0\317\377\377\163\0\0\0\0\166\377\377\377\0\0\0\0\377"
-    "\377\377\206\0\0\0\0\0\0\0\0\0\351\377\377\272\176\120\45\1\0\0\0"
-    "\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\377"
-    "\377\377\0\0\0\237\377\377\242\0\0\243\377\377\236\0\0\63\377\377"
-    "\211\0\251\377\377\252\0\213\377\377\62\0\0\0\10\326\377\377\377\377"
-    "\333\13\0\0\0\0\0\116\377\377\375\30\0\336\377\377\161\0\0\0\0\0\0"
-    "\0\4\265\377\377\373\111\0\0\0\0\0\0\13\100\327\377\377\255\0\0\0"
-    "\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\256\377\377\324"
-    "\77\13\0\0\0\377\377\377\377\377\377\377\377\377\377\377\377\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\33\0\0\0\0\33\377\377\360\0"
-    "\0\361\377\377\32\0\0\0\0\33\377\377\377\0\0\0\0\377\377\377\36\0"
-    "\0\0\0\0\0\0\0\0\212\377\377\377\377\377\377\354\234\40\0\0\0\0\0"
-    "\0\0\377\377\377\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\377\377\377"
-    "\0\0\0\121\377\377\344\0\0\345\377\377\120\0\0\11\374\377\257\0\334"
-    "\377\377\333\0\261\377\374\10\0\0\0\0\62\372\377\377\374\71\0\0\0"
-    "\0\0\0\4\350\377\377\152\47\377\377\375\32\0\0\0\0\0\0\0\233\377\377"
-    "\377\142\0\0\0\0\0\0\377\377\377\377\371\264\33\0\0\0\0\0\0\0\0\0"
-    "\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\33\264\371\377\377\377\377"
-    "\0\0\377\377\377\377\377\377\377\377\377\377\377\377\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\377\377\377\4\0\0\0\0\4\377\377\374\0\0\374\377"
-    "\377\3\0\0\0\0\4\377\377\377\0\0\0\0\377\377\377\4\0\0\0\0\0\0\0\0"
-    "\0\5\216\370\377\377\377\377\377\377\360\55\0\0\0\0\0\0\377\377\377"
-    "\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\377\377\377\0\0\0\13\367\377"
-    "\377\47\50\377\377\366\12\0\0\0\330\377\326\20\377\342\343\376\16"
-    "\330\377\327\0\0\0\0\0\5\334\377\377\344\10\0\0\0\0\0\0\0\214\377"
-    "\377\276\160\377\377\300\0\0\0\0\0\0\0\177\377\377\377\176\0\0\0\0"
-    "\0\0\0\377\377\377\377\370\256\27\0\0\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\27\255\370\377\377\377\377\0\0\270\114\22\3"
-    "\33\126\237\335\372\356\266\117\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\377\33\0\0\0\0\32\377\377\360\0\0\361\377\377\32\0\0\0\0\33\377"
-    "\377\377\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\22\127\200\250"
-    "\332\377\377\377\267\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\377\377"
-    "\377\1\0\0\0\11\377\377\377\0\0\0\0\264\377\377\151\152\377\377\263"
-    "\0\0\0\0\253\377\371\105\377\252\253\377\103\372\377\252\0\0\0\0\0"
-    "\176\377\377\377\377\206\0\0\0\0\0\0\0\54\377\377\374\314\377\377"
-    "\147\0\0\0\0\0\0\142\377\377\377\233\0\0\0\0\0\0\0\0\0\13\77\324\377"
-    "\377\250\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\251"
-    "\377\377\322\76\13\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\377\377\377\164\0\0\0\0\162\377\377\316\0\0\320\377"
-    "\377\161\0\0\0\0\164\377\377\377\0\0\0\0\377\377\377\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\72\377\377\362\0\0\0\0\0\0\376\377\377\3\0\0"
-    "\0\0\0\0\0\371\377\377\34\0\0\0\106\377\377\377\0\0\0\0\145\377\377"
-    "\253\254\377\377\144\0\0\0\0\175\377\377\230\377\162\163\377\226\377"
-    "\377\174\0\0\0\0\50\370\377\372\374\377\372\55\0\0\0\0\0\0\0\313\377"
-    "\377\377\377\373\23\0\0\0\0\0\111\373\377\377\264\3\0\0\0\0\0\0\0"
-    "\0\0\0\0\75\377\377\352\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0"
-    "\0\0\0\0\0\0\0\352\377\377\73\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\367\145\16\15\142\366\377"
-    "\377\216\0\0\220\377\377\366\142\15\16\146\367\377\377\377\0\0\0\0"
-    "\377\377\377\0\0\0\0\0\0\0\0\0\0\325\206\111\40\10\2\26\154\377\377"
-    "\370\0\0\0\0\0\0\361\377\377\134\3\0\0\0\0\0\0\336\377\377\245\31"
-    "\5\76\337\377\377\377\0\0\0\0\30\376\377\354\354\377\376\27\0\0\0"
-    "\0\120\377\377\354\377\73\74\377\352\377\377\117\0\0\0\1\302\377\377"
-    "\237\246\377\377\307\2\0\0\0\0\0\0\153\377\377\377\377\266\0\0\0\0"
-    "\0\64\364\377\377\312\13\0\0\0\0\0\0\0\0\0\0\0\0\12\377\377\375\0"
-    "\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\375\377\377"
-    "\11\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\377\377\377\370\377\377\377\377\377\377\371\46\0\0\50\372\377"
-    "\377\377\377\377\377\370\377\377\377\0\0\0\0\377\377\377\0\0\0\0\0"
-    "\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377\310\0\0\0\0\0\0"
-    "\307\377\377\377\377\377\377\0\0\0\0\234\377\377\377\377\377\377\370"
-    "\377\377\377\0\0\0\0\0\310\377\377\377\377\307\0\0\0\0\0\42\377\377"
-    "\377\372\10\11\372\377\377\377\41\0\0\0\150\377\377\376\53\56\377"
-    "\377\377\153\0\0\0\0\0\0\21\370\377\377\377\135\0\0\0\0\0\350\377"
-    "\377\377\377\377\377\377\377\377\377\0\0\0\0\0\0\0\0\377\377\377\0"
-    "\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\377\377\377\153\377\377\377\377\377\377\151\0\0\0\0\155\377\377"
-    "\377\377\377\377\152\377\377\377\0\0\0\0\377\377\377\0\0\0\0\0\0\0"
-    "\0\0\0\377\377\377\377\377\377\377\377\377\364\73\0\0\0\0\0\0\151"
-    "\377\377\377\377\377\377\0\0\0\0\44\362\377\377\377\377\377\205\377"
-    "\377\377\0\0\0\0\0\172\377\377\377\377\171\0\0\0\0\0\1\363\377\377"
-    "\313\0\0\314\377\377\362\1\0\0\32\360\377\377\264\0\0\265\377\377"
-    "\361\33\0\0\0\0\0\0\252\377\377\367\15\0\0\0\0\0\377\377\377\377\377"
-    "\377\377\377\377\377\377\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0"
-    "\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\0\127\320\373\356\267\103\0\0\0\0\0\0\104\267\356\373\320\127\0\377"
-    "\377\377\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\51\167\263\336\366"
-    "\375\361\317\217\42\0\0\0\0\0\0\0\1\153\314\363\376\377\377\0\0\0"
-    "\0\0\55\261\357\373\326\155\1\377\377\377\0\0\0\0\0\53\377\377\377"
-    "\377\53\0\0\0\0\0\0\307\377\377\223\0\0\224\377\377\306\0\0\0\256"
-    "\377\377\377\76\0\0\74\377\377\377\257\0\0\0\0\0\0\226\377\377\254"
-    "\0\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377\377\0\0\0\0\0"
-    "\0\0\0\377\377\377\1\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0"
-    "\0\0\0\2\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\7\354\377\377\124\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\370\377\377\23\0\0\0\0\0\0\0\0\0\0"
-    "\377\377\377\0\0\0\0\0\0\0\0\0\0\25\377\377\366\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\14\213\377"
-    "\377\362\11\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\331"
-    "\377\377\165\6\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\7\174"
-    "\377\377\330\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\377\377\377\377\377\227\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\206\377\377\377\377\377\0\0\0\0\0\0\0\0"
-    "\377\377\377\0\0\0\0\0\0\0\0\377\377\377\377\377\205\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\377\356\33\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\7"
-    "\202\323\364\376\377\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\377"
-    "\376\364\323\203\7\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\377\377\375\316\66\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0"
+    224, 336, 25875,
+    "\377\0\377\0\377\0\377\0\377\0\377\0\377\0\213\0\200\377\210\0\200"
+    "\377\200\0\200\377\207\0\2*\377\251\200\0\2\207\377I\206\0\0\377"
+    "\205\0\4]\330\371\324W\212\0\1B\277\200\364\1\270G\210\0\200\377"
+    "\213\0\2\37\367\272\206\0\2\273\367\36\214\0\0\377\305\0\2:\377"
+    "\306\224\0\200\377\210\0\200\377\200\0\200\377\207\0\2g\377l\200\0"
+    "\2\305\375\17\206\0\1\377\1\203\0\0]\203\377\0V\210\0\1F\375\203"
+    "\377\210\0\200\377\213\0\2\242\377\64\206\0\2\66\377\240\214\0\0"
+    "\377\305\0\2\255\377R\224\0\200\377\210\0\200\377\200\0\200\377"
+    "\207\0\6\244\377/\0\10\371\317\207\0\1\377\3\203\0\6\330\377x\14x"
+    "\377\324\210\0\6\310\377\252\34\6\65\253\210\0\200\377\212\0\2\42"
+    "\374\274\210\0\2\277\373!\206\0\200\236\0%\200\0\0\377\200\0\2%"
+    "\236\235\277\0\3#\375\334\2\224\0\200\377\210\0\200\377\200\0\200"
+    "\377\207\0\6\341\360\2\0@\377\222\203\0\10\10p\303\360\377\360\305"
+    "\204/\200\0\6\372\377\13\0\14\377\371\210\0\2\370\377\22\214\0\200"
+    "\377\212\0\2\216\377S\210\0\2W\377\213\206\0\12;\253\371\245+\377+"
+    "\246\371\253;\277\0\2\223\377l\225\0\200\377\210\0\200\377\200\0"
+    "\200\377\206\0\2\36\377\266\200\0\2}\377V\202\0\1\26\323\200\377\0"
+    "\376\203\377\200\0\6\331\377s\13x\377\327\203\0\1)\7\201\0\2\362"
+    "\377\22\214\0\200\377\211\0\3\4\353\361\6\210\0\3\11\364\350\3\207"
+    "\0\6\36\212\354\377\354\212\36\207\0\200\377\265\0\3\21\364\356\13"
+    "\225\0\200\377\210\0\200\377\200\0\200\377\203\0\0\260\212\377\200"
+    "\0\11\241\377\326C\6\377\14\63u\316\200\0\0`\203\377\0[\201\0\3\10"
+    "\204\371V\201\0\2\273\377`\214\0\200\377\211\0\2B\377\253\212\0\2"
+    "\260\377>\207\0\6\34\210\354\377\354\210\34\207\0\200\377\265\0\2z"
+    "\377\206\226\0\200\377\210\0\200\377\200\0\200\377\203\0\0\260\212"
+    "\377\200\0\2\356\377*\200\0\0\377\205\0\4`\331\372\330[\201\0\3E"
+    "\334\344S\202\0\3O\377\340\13\213\0\200\377\211\0\2\206\377m\212\0"
+    "\2q\377\202\205\0\12\70\250\370\246+\377,\247\370\250\70\205\0\200"
+    "\377\264\0\3\6\346\371\31\226\0\200\377\226\0\6\306\375\17\0&\377"
+    "\255\203\0\2\367\377\11\200\0\0\377\213\0\4\27\246\374\223\15\203"
+    "\0\3F\374\377\236\230\0\2\272\377>\212\0\2A\377\270\205\0\200\237"
+    "\0%\200\0\0\377\200\0\0%\200\237\205\0\200\377\264\0\2`\377\237"
+    "\227\0\1\367\366\225\0\2\11\371\320\200\0\2c\377o\203\0\5\300\377"
+    "\201\1\0\377\211\0\4\1g\357\316\64\204\0\5P\373\343\365\377o\227\0"
+    "\2\340\377\34\212\0\2\37\377\336\212\0\0\377\212\0\200\377\264\0\2"
+    "\322\377-\227\0\1\353\352\225\0\2@\377\223\200\0\2\240\377\61\203"
+    "\0\7\65\365\377\331\225\377/\4\206\0\4-\306\363r\3\204\0\7 \364"
+    "\347\35U\376\374F\201\0\2\6\377\374\220\0\2\366\377\10\212\0\2\11"
+    "\377\365\212\0\0\377\205\0\212\377\256\0\2F\377\271\230\0\1\337"
+    "\336\225\0\2}\377V\200\0\2\335\360\2\204\0\2+\262\373\201\377\2"
+    "\357\225\27\202\0\4\12\211\373\260\35\206\0\2\227\377^\200\0\3\201"
+    "\377\357'\200\0\2\6\377\354\220\0\2\376\377\2\212\0\2\2\377\375"
+    "\222\0\212\377\221\0\204\377\225\0\2\272\377F\230\0\200\322\222\0"
+    "\212\377\0\260\204\0\7\21H\377\255\352\377\347$\200\0\3J\337\343Q"
+    "\201\0\4]\330\371\322Q\200\0\2\342\377\17\200\0\10\1\254\377\331"
+    "\20\0)\377\311\220\0\2\366\377\10\212\0\2\11\377\364\227\0\200\377"
+    "\226\0\204\377\224\0\2.\377\321\257\0\212\377\0\260\206\0\12\377\0"
+    "\5\217\377\264\0\21\365\220\14\201\0\0]\203\377\4O\0\373\377\10"
+    "\201\0\7\13\317\377\272\3\211\377\206\220\0\2\337\377\35\212\0\2 "
+    "\377\335\227\0\200\377\262\0\2\240\377_\261\0\2.\377\245\200\0\2"
+    "\213\377E\211\0\0\377\200\0\2\14\377\364\200\0\0\31\203\0\12\330"
+    "\377v\14{\377\320\0\352\377=\202\0\6\36\351\377\275\374\371\35\220"
+    "\0\2\271\377\77\212\0\2B\377\267\227\0\200\377\261\0\3\31\371\346"
+    "\6\261\0\2k\377h\200\0\2\311\374\14\211\0\0\377\200\0\2(\377\354"
+    "\206\0\13\372\377\13\0\14\377\371\0\251\377\302\4\202\0\0N\201\377"
+    "\0n\221\0\2\206\377n\212\0\2s\377\203\227\0\200\377\212\0\201\377"
+    "\227\0\201\377\206\0\2\206\377y\232\0\200\377\224\0\6\250\377+\0"
+    "\13\373\313\205\0\12\321z\67\13\0\377\12D\323\377\230\206\0\20\331"
+    "\377s\13x\377\327\0\60\372\377\301=\10\33p\351\201\377\0\204\221\0"
+    "\2B\377\254\212\0\2\262\377\77\227\0\200\377\212\0\201\377\227\0"
+    "\201\377\205\0\3\13\356\364\21\232\0\200\377\224\0\6\345\355\1\0D"
+    "\377\216\205\0\202\377\0\364\202\377\1\307\17\206\0\0a\203\377\0["
+    "\200\0\1V\367\204\377\4\356\200\376\370#\220\0\3\4\353\362\7\210\0"
+    "\3\12\365\351\3\244\0\0\10\200\377\0\357\227\0\201\377\205\0\2m"
+    "\377\222\233\0\200\377\223\0\2\42\377\262\200\0\2\201\377R\205\0"
+    "\11*w\263\335\366\377\357\303j\5\210\0\4a\332\372\327[\202\0\13'"
+    "\233\340\372\361\311}\23\0\237\377\264\221\0\2\216\377T\210\0\2Z"
+    "\377\214\245\0\0;\200\377\0\211\227\0\201\377\204\0\3\2\335\375\42"
+    "\305\0\2\3\377\2\263\0\2\42\374\275\210\0\2\301\374\42\245\0\3t"
+    "\377\373\35\240\0\2S\377\254\306\0\2\2\377\1\264\0\2\242\377\64"
+    "\206\0\2\70\377\241\246\0\2\254\377\250\241\0\2\306\377\71\306\0\1"
+    "\1\377\265\0\2\37\370\272\206\0\2\274\367\37\246\0\2\344\377\70"
+    "\355\0\0\377\377\0\377\0\377\0\377\0\377\0\377\0\377\0\377\0\377\0"
+    "\377\0\377\0\327\0\6\30\231\345\374\345\230\27\204\0\3\42f\252\354"
+    "\200\377\205\0\10,}\273\345\371\366\331\231+\204\0\7*z\275\353\373"
+    "\351\262H\210\0\1&\370\200\377\204\0\207\377\205\0\6D\257\351\374"
+    "\350\251A\202\0\211\377\202\0\10\1\134\274\354\373\354\274[\1\204"
+    "\0\6O\273\356\373\341\230\33\313\0\6+\243\351\373\342\232\33\204\0"
+    "\1\35\343\203\377\1\343\34\203\0\204\377\205\0\206\377\1\373m\203"
+    "\0\206\377\0\217\207\0\1\275\355\200\377\204\0\207\377\204\0\0\216"
+    "\205\377\202\0\210\377\0\317\201\0\1\5\260\205\377\1\256\4\202\0\0"
+    "\203\204\377\1\352(\311\0\1n\372\203\377\1\350 \203\0\10\270\377"
+    "\313\64\10\64\315\377\270\203\0\3\340\240` \200\377\205\0\12\331"
+    "\216R'\13\4\42\204\374\377J\202\0\11\322}=\24\4\26h\363\377\134"
+    "\205\0\2\134\377j\200\377\204\0\200\377\212\0\10m\377\372\206&\6"
+    "\24P\272\212\0\2\300\377g\201\0\12v\377\363j\31\4\31j\363\377t\201"
+    "\0\11<\377\376\206\36\5%\236\377\313\311\0\10\377\334a\24\10F\336"
+    "\377\246\202\0\3/\377\356\26\201\0\3\30\360\377.\206\0\200\377\215"
+    "\0\2w\377\300\211\0\2^\377\307\204\0\3\20\351\320\3\200\377\204\0"
+    "\200\377\211\0\3\16\360\377X\217\0\3(\377\363\15\201\0\2\326\377]"
+    "\203\0\2]\377\325\201\0\2\245\377\221\203\0\2\250\377>\310\0\1\231"
+    "\10\202\0\2\65\377\354\202\0\2\201\377\221\203\0\2\225\377\177\206"
+    "\0\200\377\215\0\2\25\377\363\211\0\2\16\377\364\204\0\3\230\377"
+    "\77\0\200\377\204\0\200\377\211\0\2c\377\272\220\0\2\216\377\230"
+    "\202\0\2\371\377\15\203\0\2\16\377\370\201\0\2\340\377-\203\0\2\66"
+    "\377\213\316\0\2\10\377\370\202\0\2\271\377N\203\0\2P\377\270\206"
+    "\0\200\377\215\0\0\13\200\377\0\5\210\0\2\16\377\365\203\0\2\67"
+    "\375\251\200\0\200\377\204\0\200\377\211\0\2\250\377^\217\0\3\10"
+    "\355\377\61\202\0\2\357\377\13\203\0\2\14\377\356\201\0\2\370\377"
+    "\7\203\0\2\11\377\276\245\0\2\10_\312\216\0\2\312_\10\221\0\2W\377"
+    "\317\202\0\2\336\377%\203\0\2'\377\334\206\0\200\377\215\0\2D\377"
+    "\356\211\0\2l\377\301\202\0\3\3\317\365\35\200\0\200\377\204\0\200"
+    "\377\0\311\200\366\2\330\220\35\203\0\10\325\377)I\310\371\360\276"
+    "R\211\0\2]\377\311\203\0\2\256\377Y\203\0\2[\377\253\201\0\2\370"
+    "\377\7\203\0\2\11\377\340\205\0\201\377\211\0\201\377\213\0\2\42"
+    "\212\354\200\377\216\0\200\377\2\354\212!\216\0\3/\356\377b\202\0"
+    "\2\364\377\14\203\0\2\16\377\362\206\0\200\377\214\0\3\1\301\377"
+    "\234\206\0\5\6)\206\373\374C\202\0\2r\377}\201\0\200\377\204\0\205"
+    "\377\1\361C\202\0\3\361\377c\376\203\377\0\204\210\0\2\304\377b"
+    "\203\0\12*\362\361h\27\3\30i\363\361'\201\0\2\337\377+\203\0\2\66"
+    "\377\363\205\0\201\377\211\0\201\377\210\0\3\2J\265\375\200\377\1"
+    "\305_\200\0\212\377\200\0\1_\306\200\377\3\375\264J\2\212\0\3<\357"
+    "\377\257\203\0\12\376\377\3\0\254\367\250\0\4\377\375\206\0\200"
+    "\377\214\0\3\200\377\363\36\204\0\203\377\1\324H\202\0\3\34\363"
+    "\337\10\201\0\200\377\204\0\11\277Y\34\5\20J\310\377\360\34\201\0"
+    "\12\375\377\354\234%\5\36\205\376\377<\206\0\3+\377\360\12\204\0\1"
+    "-\274\203\377\1\274-\202\0\2\245\377\215\203\0\2\250\377\375\205\0"
+    "\201\377\211\0\201\377\206\0\2\23u\335\200\377\2\356\221+\202\0"
+    "\212\377\202\0\2+\221\356\200\377\2\335t\22\207\0\4)\362\377\254\7"
+    "\203\0\12\376\377\3\0\257\370\252\0\4\377\375\206\0\200\377\213\0"
+    "\0a\200\377\0Y\205\0\203\377\1\331H\202\0\2\256\377R\202\0\200\377"
+    "\212\0\3\5\303\377\216\201\0\2\376\377\245\203\0\2\222\377\245\206"
+    "\0\2\222\377\223\205\0\1Q\337\203\377\1\337Q\202\0\12>\377\375\201"
+    "\35\5%\236\355\377\374\205\0\201\377\211\0\201\377\204\0\2\65\237"
+    "\367\200\377\2\303]\10\226\0\2\10]\303\200\377\2\367\237\65\205\0"
+    "\3\261\377\241\2\204\0\2\364\377\14\203\0\2\16\377\362\206\0\200"
+    "\377\212\0\3\134\375\377y\210\0\5\6,\214\375\373;\200\0\2K\377\273"
+    "\203\0\200\377\213\0\2@\377\327\201\0\2\364\377\64\203\0\2-\377"
+    "\337\205\0\3\12\357\377+\204\0\12B\375\364m\31\4\32q\366\375B\202"
+    "\0\0\210\203\377\3\376e\377\357\234\0\200\377\2\354\217)\234\0\2)"
+    "\217\354\200\377\205\0\2\357\377\27\205\0\2\336\377%\203\0\2'\377"
+    "\334\206\0\200\377\211\0\3]\375\377\200\214\0\2q\377\271\200\0\2"
+    "\337\373+\203\0\200\377\213\0\2\12\377\366\201\0\2\341\377\10\203"
+    "\0\2\7\377\367\205\0\2a\377\304\205\0\2\273\377^\203\0\2b\377\273"
+    "\203\0\10S\277\360\372\313L*\377\324\234\0\200\377\2\347\207#\234"
+    "\0\2$\207\347\200\377\205\0\200\377\206\0\2\271\377N\203\0\2P\377"
+    "\270\206\0\200\377\210\0\3b\375\377z\215\0\2\17\377\361\200\0\212"
+    "\377\211\0\2\12\377\365\201\0\2\300\377\10\203\0\2\7\377\367\205\0"
+    "\2\310\377\134\205\0\2\361\377\14\203\0\2\15\377\360\211\0\2_\377"
+    "\246\234\0\7\65\240\367\377\376\275X\7\204\0\212\377\204\0\7\7Y"
+    "\275\376\377\367\240\65\205\0\200\377\206\0\2\201\377\221\203\0\2"
+    "\225\377\177\206\0\200\377\207\0\0i\200\376\0p\216\0\2\21\377\367"
+    "\200\0\212\377\211\0\2=\377\324\201\0\2\214\377\64\203\0\2-\377"
+    "\335\204\0\3/\377\354\10\205\0\2\372\377\15\203\0\2\16\377\371\211"
+    "\0\2\272\377a\236\0\2\23v\336\200\377\2\354\217+\202\0\212\377\202"
+    "\0\2,\220\355\200\377\2\335u\23\221\0\3\60\377\356\25\201\0\3\27"
+    "\360\377.\206\0\200\377\206\0\3r\377\375c\217\0\2r\377\317\210\0"
+    "\200\377\212\0\3\3\274\377\211\201\0\2@\377\245\203\0\2\220\377"
+    "\243\204\0\2\227\377\215\206\0\2\331\377a\203\0\2`\377\327\210\0\3"
+    "U\377\357\15\205\0\201\377\211\0\201\377\210\0\3\2K\266\375\200"
+    "\377\1\306b\216\0\1b\306\200\377\3\375\265K\2\224\0\10\270\377\313"
+    "\63\10\63\314\377\270\207\0\200\377\205\0\3{\377\372V\210\0\12\322"
+    "~\77\27\4\11/\215\375\377f\210\0\200\377\203\0\12\317w\70\22\3\17G"
+    "\302\377\353\26\201\0\7\1\316\377\234%\5\35\203\200\376\0\71\203\0"
+    "\3\14\362\377'\206\0\12~\377\365n\31\3\31n\365\377z\202\0\10\271L"
+    "\22\5%\204\371\377k\206\0\201\377\211\0\201\377\213\0\2\42\213\355"
+    "\200\377\216\0\200\377\2\354\213\42\214\0\200\377\207\0\1\36\344"
+    "\203\377\1\343\35\203\0\210\377\201\0\211\377\0 \200\0\207\377\1"
+    "\222\1\210\0\200\377\203\0\206\377\1\347\66\203\0\1+\354\204\377\0"
+    "\177\204\0\2e\377\276\207\0\1\10\273\205\377\1\270\6\202\0\205\377"
+    "\0\216\207\0\201\377\210\0\0\10\200\377\0\357\215\0\2\10`\313\216"
+    "\0\2\313`\10\216\0\200\377\210\0\6\30\231\347\375\346\231\30\204\0"
+    "\210\377\201\0\211\377\0 \200\0\10-\200\277\347\372\367\336\244\77"
+    "\212\0\200\377\203\0\10\70\226\320\360\374\362\314~\23\205\0\6\36"
+    "\232\343\374\357\273M\205\0\2\314\377W\210\0\10\3d\300\356\374\356"
+    "\277b\2\203\0\6C\256\352\374\351\260D\210\0\201\377\210\0\0;\200"
+    "\377\0\211\263\0\200\377\377\0\242\0\3t\377\373\35\377\0\331\0\2"
+    "\254\377\250\377\0\332\0\2\344\377\70\377\0\377\0\377\0\377\0\377"
+    "\0\377\0\377\0\377\0\377\0\377\0\377\0\377\0\343\0\0f\200\377\0e"
+    "\204\0\203\377\3\363\313t\6\206\0\7\33\213\324\367\371\336\240<"
+    "\201\0\201\377\4\375\355\307\201\33\204\0\211\377\201\0\211\377"
+    "\204\0\7 \222\330\371\370\332\235;\201\0\200\377\205\0\200\377\202"
+    "\0\210\377\205\0\204\377\202\0\200\377\204\0\5'\352\377\261\4\0"
+    "\200\377\212\0\201\377\0$\202\0\0%\201\377\200\0\200\377\1\354\10"
+    "\203\0\200\377\203\0\2\13}\323\200\370\2\323}\12\224\0\0\251\200"
+    "\377\0\250\204\0\206\377\1\304\11\204\0\1O\362\205\377\201\0\205"
+    "\377\1\365a\203\0\211\377\201\0\211\377\203\0\1V\365\205\377\201\0"
+    "\200\377\205\0\200\377\202\0\210\377\205\0\204\377\202\0\200\377"
+    "\203\0\4\34\341\377\300\10\200\0\200\377\212\0\201\377\0t\202\0\0w"
+    "\201\377\200\0\201\377\0_\203\0\200\377\202\0\1\22\322\204\377\1"
+    "\321\22\204\0\7\35\204\313\362\373\344\243+\204\0\1\1\352\200\377"
+    "\1\352\1\203\0\200\377\201\0\4\15G\333\377~\203\0\4\65\371\376\233"
+    "\62\200\11\2+i\307\201\0\200\377\4\0\5\27F\242\200\376\0T\202\0"
+    "\200\377\212\0\200\377\213\0\11;\373\375\224.\10\12*h\306\201\0"
+    "\200\377\205\0\200\377\206\0\200\377\215\0\200\377\202\0\200\377"
+    "\202\0\4\24\327\377\315\16\201\0\200\377\212\0\200\377\1\334\305"
+    "\202\0\1\311\333\200\377\200\0\201\377\0\312\203\0\200\377\202\0\3"
+    "\252\377\332K\200\15\3K\332\377\251\203\0\1o\367\204\377\1\370R"
+    "\203\0\1\60\377\200\342\1\377/\203\0\200\377\203\0\2=\377\325\202"
+    "\0\3\1\320\377s\210\0\200\377\203\0\3Z\377\347\10\201\0\200\377"
+    "\212\0\200\377\212\0\3\2\325\377k\210\0\200\377\205\0\200\377\206"
+    "\0\200\377\215\0\200\377\202\0\200\377\201\0\4\14\312\377\331\25"
+    "\202\0\200\377\212\0\200\377\2\213\375\30\200\0\2\34\376\212\200"
+    "\377\200\0\200\377\2\316\377\64\202\0\200\377\201\0\3(\377\360\34"
+    "\202\0\3\35\360\376'\201\0\0\204\200\377\10\245\77\16\6\62\263\377"
+    "\365#\202\0\5s\377\237\240\377r\203\0\200\377\203\0\2\7\377\367"
+    "\202\0\3B\377\317\1\210\0\200\377\204\0\2\265\377[\201\0\200\377"
+    "\212\0\200\377\212\0\2F\377\313\211\0\200\377\205\0\200\377\206\0"
+    "\200\377\215\0\200\377\202\0\200\377\200\0\4\7\274\377\343\36\203"
+    "\0\200\377\212\0\200\377\2:\377g\200\0\2m\377\71\200\377\200\0\200"
+    "\377\2c\377\237\202\0\200\377\201\0\2}\377\217\204\0\2\217\377|"
+    "\200\0\3M\377\372S\203\0\3\1\270\377\225\202\0\5\266\377[\134\377"
+    "\266\203\0\200\377\203\0\2\15\377\366\202\0\2\225\377p\211\0\200"
+    "\377\204\0\2^\377\244\201\0\200\377\212\0\200\377\212\0\2\227\377n"
+    "\211\0\200\377\205\0\200\377\206\0\200\377\215\0\200\377\202\0\200"
+    "\377\5\0\3\255\377\353(\204\0\200\377\212\0\200\377\2\2\347\270"
+    "\200\0\2\276\346\1\200\377\200\0\200\377\3\11\356\366\22\201\0\200"
+    "\377\201\0\2\266\377J\204\0\7K\377\266\0\3\334\377v\205\0\2:\377"
+    "\331\201\0\7\5\364\377\31\32\377\364\5\202\0\200\377\203\0\2N\377"
+    "\315\202\0\2\311\377\66\211\0\200\377\204\0\2,\377\322\201\0\200"
+    "\377\212\0\200\377\212\0\2\312\377\65\211\0\200\377\205\0\200\377"
+    "\206\0\200\377\215\0\200\377\202\0\200\377\4\0\234\377\362\64\205"
+    "\0\200\377\212\0\200\377\7\0\227\372\17\23\374\226\0\200\377\200\0"
+    "\200\377\3\0\215\377t\201\0\200\377\201\0\2\335\377!\204\0\7#\377"
+    "\333\0L\377\336\4\200\0\7\21\230\352\363\253\36\377\366\201\0\2="
+    "\377\325\200\0\2\326\377<\202\0\200\377\201\0\4\16P\345\377f\202\0"
+    "\2\352\377\22\211\0\200\377\204\0\2\17\377\357\201\0\200\377\212\0"
+    "\200\377\212\0\2\353\377\22\211\0\200\377\205\0\200\377\206\0\200"
+    "\377\215\0\200\377\202\0\200\377\0\212\200\377\0\215\206\0\200\377"
+    "\212\0\200\377\7\0F\377Zb\377E\0\200\377\200\0\200\377\4\0$\376"
+    "\334\1\200\0\200\377\201\0\2\364\377\13\204\0\6\14\377\362\0\231"
+    "\377~\200\0\1\11\320\202\377\0\312\200\377\201\0\2\200\377\222\200"
+    "\0\2\223\377\200\202\0\205\377\1\350u\203\0\2\371\377\5\211\0\200"
+    "\377\204\0\2\3\377\373\201\0\210\377\202\0\210\377\202\0\2\371\377"
+    "\5\211\0\211\377\206\0\200\377\215\0\200\377\202\0\201\377\3\373"
+    "\377\366%\205\0\200\377\212\0\200\377\7\0\5\357\253\264\356\5\0"
+    "\200\377\200\0\200\377\200\0\2\270\377I\200\0\200\377\201\0\2\376"
+    "\377\1\204\0\6\2\377\375\0\316\377@\200\0\6z\377\343<\6<\343\200"
+    "\377\201\0\2\304\377O\200\0\2P\377\303\202\0\205\377\2\371\265)"
+    "\202\0\2\371\377\5\211\0\200\377\204\0\2\3\377\374\201\0\210\377"
+    "\202\0\210\377\202\0\2\371\377\5\202\0\203\377\200\0\211\377\206\0"
+    "\200\377\215\0\200\377\202\0\200\377\5\376X\241\377\302\1\204\0"
+    "\200\377\212\0\200\377\200\0\3\243\364\370\242\200\0\200\377\200\0"
+    "\200\377\200\0\2M\377\264\200\0\200\377\201\0\2\376\377\1\204\0\6"
+    "\2\377\375\0\356\377\27\200\0\2\321\377M\201\0\0M\200\377\200\0\3"
+    "\14\372\374\17\200\0\3\20\375\372\13\201\0\200\377\201\0\5\11*\177"
+    "\370\357$\201\0\2\353\377\22\211\0\200\377\204\0\2\17\377\357\201"
+    "\0\200\377\212\0\200\377\212\0\2\352\377\23\202\0\203\377\200\0"
+    "\200\377\205\0\200\377\206\0\200\377\215\0\200\377\202\0\200\377\5"
+    "m\0\21\347\377m\204\0\200\377\212\0\200\377\200\0\0R\200\377\0Q"
+    "\200\0\200\377\200\0\200\377\200\0\4\2\337\375 \0\200\377\201\0\2"
+    "\364\377\13\204\0\6\14\377\362\0\374\377\6\200\0\2\367\377\13\201"
+    "\0\0\13\200\377\200\0\2J\377\311\202\0\2\312\377J\201\0\200\377"
+    "\204\0\2f\377\247\201\0\2\313\377\65\211\0\200\377\204\0\2+\377"
+    "\323\201\0\200\377\212\0\200\377\212\0\2\311\377\67\205\0\200\377"
+    "\200\0\200\377\205\0\200\377\206\0\200\377\215\0\200\377\202\0\200"
+    "\377\201\0\3O\377\364!\203\0\200\377\212\0\200\377\200\0\0\12\200"
+    "\366\0\12\200\0\200\377\200\0\200\377\201\0\3w\377\211\0\200\377"
+    "\201\0\2\335\377!\204\0\6\42\377\333\0\374\377\10\200\0\2\367\377"
+    "\12\201\0\0\13\200\377\200\0\0\216\206\377\0\215\201\0\200\377\204"
+    "\0\2\21\377\352\201\0\2\227\377p\211\0\200\377\204\0\2^\377\245"
+    "\201\0\200\377\212\0\200\377\212\0\2\225\377r\205\0\200\377\200\0"
+    "\200\377\205\0\200\377\206\0\200\377\214\0\2\10\377\372\202\0\200"
+    "\377\202\0\3\246\377\276\1\202\0\200\377\212\0\200\377\206\0\200"
+    "\377\200\0\200\377\201\0\3\24\370\353\7\200\377\201\0\2\270\377J"
+    "\204\0\6J\377\266\0\352\377\33\200\0\2\321\377L\201\0\0L\200\377"
+    "\200\0\0\321\206\377\0\320\201\0\200\377\204\0\2\11\377\371\201\0"
+    "\3F\377\316\1\210\0\200\377\204\0\2\265\377]\201\0\200\377\212\0"
+    "\200\377\212\0\3B\377\322\2\204\0\200\377\200\0\200\377\205\0\200"
+    "\377\206\0\200\377\214\0\2\42\377\345\202\0\200\377\202\0\3\24\351"
+    "\377h\202\0\200\377\212\0\200\377\206\0\200\377\200\0\200\377\202"
+    "\0\2\241\377^\200\377\201\0\2\200\377\216\204\0\6\216\377|\0\306"
+    "\377M\200\0\6z\377\341;\6:\341\200\377\4\0\25\376\366\7\202\0\3\7"
+    "\366\376\25\200\0\200\377\204\0\2O\377\334\201\0\3\2\325\377p\210"
+    "\0\200\377\203\0\3Z\377\351\11\201\0\200\377\212\0\200\377\212\0\3"
+    "\1\320\377~\204\0\200\377\200\0\200\377\205\0\200\377\206\0\200"
+    "\377\205\0\1\231\11\203\0\2f\377\271\202\0\200\377\203\0\3T\377"
+    "\362\35\201\0\200\377\212\0\200\377\206\0\200\377\200\0\200\377"
+    "\202\0\2\66\377\310\200\377\201\0\3-\377\357\33\202\0\7\33\357\376"
+    "(\0\214\377\226\200\0\1\11\320\202\377\0\314\200\377\3\0X\377\273"
+    "\204\0\2\273\377W\200\0\200\377\201\0\5\6#k\356\377\202\202\0\4;"
+    "\373\376\231\60\200\10\2'e\305\201\0\200\377\7\0\4\26F\242\376\377"
+    "W\202\0\200\377\212\0\200\377\213\0\10\65\371\377\252>\17\3\36o"
+    "\200\377\200\0\200\377\205\0\200\377\206\0\200\377\205\0\11\377"
+    "\341q%\4\16S\354\377f\202\0\200\377\204\0\2\253\377\270\201\0\200"
+    "\377\212\0\200\377\206\0\200\377\200\0\200\377\203\0\0\313\201\377"
+    "\202\0\3\260\377\330I\200\14\3I\330\377\251\200\0\3\67\377\363\24"
+    "\200\0\5\22\231\353\365\260\31\200\377\3\0\233\377x\204\0\2x\377"
+    "\232\200\0\207\377\1\271\11\203\0\1T\364\205\377\201\0\205\377\1"
+    "\366d\203\0\211\377\201\0\200\377\214\0\1M\362\204\377\1\376\210"
+    "\200\0\200\377\205\0\200\377\202\0\210\377\201\0\206\377\1\302\5"
+    "\202\0\200\377\204\0\3\26\354\377b\200\0\211\377\201\0\200\377\206"
+    "\0\200\377\200\0\200\377\203\0\0`\201\377\202\0\1\26\326\204\377\1"
+    "\322\22\201\0\3\302\377\260\1\210\0\2\336\377\65\204\0\2\65\377"
+    "\336\200\0\203\377\4\367\341\257W\1\205\0\7\36\216\326\370\372\336"
+    "\241<\201\0\201\377\4\375\357\310\203\35\204\0\211\377\201\0\200"
+    "\377\215\0\7\32\211\323\367\370\336\235\60\201\0\200\377\205\0\200"
+    "\377\202\0\210\377\201\0\10\60\210\311\357\374\361\311u\10\203\0"
+    "\200\377\205\0\4Y\377\360\33\0\211\377\201\0\200\377\206\0\200\377"
+    "\200\0\200\377\203\0\1\10\354\200\377\203\0\2\14\200\325\200\371\2"
+    "\324}\13\202\0\4,\366\377\235\7\377\0\331\0\6O\372\377\334m&\6\377"
+    "\0\327\0\1:\331\204\377\0\320\377\0\325\0\10\4V\252\336\370\372"
+    "\330\216\5\377\0\377\0\377\0\377\0\377\0\377\0\377\0\377\0\377\0"
+    "\377\0\377\0\377\0\206\0\203\377\3\371\344\261R\205\0\2\13}\323"
+    "\200\370\2\323}\12\202\0\203\377\3\367\337\251G\205\0\7=\253\346"
+    "\372\360\307\206/\202\0\212\377\200\0\200\377\205\0\200\377\201\0"
+    "\2\337\377\65\204\0\6\65\377\336\0\356\377\26\206\0\6\26\377\356\0"
+    "\270\377\217\204\0\6\226\377\266\0\263\377\245\206\0\3\242\377\262"
+    "\0\212\377\204\0\203\377\203\0\2\306\377\71\214\0\203\377\210\0\4"
+    "\22\340\377\340\22\221\0\207\377\1\252\3\202\0\1\22\322\204\377\1"
+    "\321\22\201\0\207\377\1\235\2\202\0\1|\376\205\377\202\0\212\377"
+    "\200\0\200\377\205\0\200\377\201\0\2\234\377w\204\0\6x\377\233\0"
+    "\312\377:\206\0\7:\377\312\0,\374\371#\202\0\10.\374\372'\0!\366"
+    "\377\77\204\0\4>\377\366 \0\211\377\0\376\204\0\203\377\203\0\2S"
+    "\377\254\214\0\203\377\207\0\1\2\270\201\377\1\267\2\220\0\200\377"
+    "\201\0\5\6)\207\374\377n\202\0\3\252\377\332K\200\15\3K\332\377"
+    "\251\201\0\200\377\201\0\5\10,\210\373\377g\201\0\11J\377\366w\37"
+    "\4\15\62q\314\207\0\200\377\205\0\200\377\205\0\200\377\201\0\2Y"
+    "\377\272\204\0\6\273\377Y\0\246\377^\206\0\2^\377\246\200\0\2\232"
+    "\377\254\202\0\2\276\377\216\201\0\3}\377\325\5\202\0\3\4\323\377|"
+    "\210\0\3\5\320\377\221\204\0\200\377\206\0\3\2\335\375\42\216\0"
+    "\200\377\207\0\6\201\377\355P\356\377\200\220\0\200\377\204\0\2n"
+    "\377\316\201\0\3(\377\360\34\202\0\3\35\360\376'\200\0\200\377\204"
+    "\0\2m\377\313\201\0\2\273\377^\216\0\200\377\205\0\200\377\205\0"
+    "\200\377\201\0\3\27\377\365\6\202\0\7\7\366\377\27\0\202\377\202"
+    "\206\0\2\202\377\202\200\0\3\30\363\377;\200\0\3S\377\352\17\201\0"
+    "\3\7\333\377u\202\0\3t\377\332\7\210\0\3\202\377\332\12\204\0\200"
+    "\377\207\0\2m\377\222\216\0\200\377\206\0\10J\376\370<\0=\370\375I"
+    "\217\0\200\377\204\0\2\17\377\365\201\0\2}\377\217\204\0\2\217\377"
+    "|\200\0\200\377\204\0\2\20\377\365\201\0\2\360\377\11\216\0\200"
+    "\377\205\0\200\377\205\0\200\377\202\0\2\324\377\77\202\0\2@\377"
+    "\323\200\0\2^\377\246\206\0\2\246\377^\201\0\7|\377\310\0\10\336"
+    "\377f\203\0\3G\377\363\33\200\0\3\33\363\377F\210\0\3\62\373\375:"
+    "\205\0\200\377\207\0\3\13\356\364\21\215\0\200\377\205\0\3!\356"
+    "\376U\201\0\3V\376\355 \216\0\200\377\204\0\2\17\377\365\201\0\2"
+    "\266\377J\204\0\2K\377\266\200\0\200\377\204\0\2\15\377\366\201\0"
+    "\2\372\377\12\216\0\200\377\205\0\200\377\205\0\200\377\202\0\2"
+    "\221\377\201\202\0\2\202\377\221\200\0\2:\377\312\200\0\0U\200\377"
+    "\0Q\200\0\2\312\377:\201\0\7\11\343\377X|\377\317\2\204\0\2\255"
+    "\377\252\200\0\2\252\377\254\210\0\3\6\323\377\213\206\0\200\377"
+    "\210\0\2\206\377y\215\0\200\377\204\0\3\10\315\377q\203\0\3r\377"
+    "\315\10\215\0\200\377\204\0\2n\377\317\201\0\2\335\377!\204\0\2#"
+    "\377\333\200\0\200\377\204\0\2]\377\305\201\0\2\327\377[\216\0\200"
+    "\377\205\0\200\377\205\0\200\377\202\0\2O\377\304\202\0\2\305\377N"
+    "\200\0\2\26\377\356\200\0\0\210\200\377\0\203\200\0\2\355\377\26"
+    "\202\0\5^\377\342\364\377>\205\0\2\35\364\377\200E\2\377\364\35"
+    "\210\0\3\206\377\326\10\206\0\200\377\210\0\3\31\371\346\6\214\0"
+    "\200\377\204\0\2\235\377\220\205\0\2\221\377\234\215\0\200\377\201"
+    "\0\5\5(\206\373\377p\201\0\2\364\377\13\204\0\2\14\377\362\200\0"
+    "\200\377\201\0\5\5\42u\365\376M\201\0\4s\377\367\203#\214\0\200"
+    "\377\205\0\200\377\205\0\200\377\202\0\3\17\374\372\13\200\0\3\14"
+    "\372\374\17\201\0\4\361\377\22\0\273\200\364\4\266\0\20\377\361"
+    "\203\0\1\1\315\200\377\0\253\207\0\1w\377\200\331\1\377v\210\0\0"
+    "\65\200\374\0\65\207\0\200\377\211\0\2\240\377_\214\0\200\377\240"
+    "\0\207\377\1\256\4\201\0\2\376\377\1\204\0\2\2\377\375\200\0\206"
+    "\377\1\342Z\202\0\1\2\235\201\377\3\337\240T\6\210\0\200\377\205\0"
+    "\200\377\205\0\200\377\203\0\2\311\377I\200\0\2J\377\311\202\0\13"
+    "\316\377\66\0\355\300\301\351\0\65\377\316\204\0\0f\200\377\0>\207"
+    "\0\1\5\326\200\377\1\326\5\207\0\3\7\326\377\205\210\0\200\377\211"
+    "\0\2.\377\321\214\0\200\377\240\0\203\377\3\372\345\263V\203\0\2"
+    "\375\377\1\204\0\2\2\377\374\200\0\205\377\1\370x\205\0\2=\245\355"
+    "\201\377\1\343I\207\0\200\377\205\0\200\377\205\0\200\377\203\0\2"
+    "\207\377\213\200\0\2\214\377\206\202\0\13\252\377Z!\377\211\212"
+    "\377\34Y\377\252\204\0\0\307\200\377\0\243\210\0\0A\200\377\0A\210"
+    "\0\3\212\377\322\6\210\0\200\377\212\0\2\272\377F\213\0\200\377"
+    "\240\0\200\377\212\0\2\363\377\13\204\0\2\14\377\363\200\0\200\377"
+    "\200\0\5\1\25h\365\377u\206\0\6\2.m\311\377\373=\206\0\200\377\205"
+    "\0\200\377\205\0\200\377\203\0\2D\377\316\200\0\2\317\377C\202\0"
+    "\13\206\377~S\377RS\377N}\377\206\203\0\5F\377\355\371\375)\210\0"
+    "\200\377\210\0\3\70\375\372\61\211\0\200\377\212\0\2F\377\271\213"
+    "\0\200\377\240\0\200\377\212\0\2\334\377!\204\0\2\42\377\337\200\0"
+    "\200\377\203\0\3U\377\364\25\211\0\2\216\377\273\206\0\200\377\205"
+    "\0\1\376\377\205\0\1\377\374\203\0\7\11\370\375\22\23\376\370\10"
+    "\202\0\13b\377\242\206\377\32\33\377\201\241\377b\203\0\5\305\377x"
+    "\225\377\251\210\0\200\377\207\0\3\11\330\377\200\212\0\200\377"
+    "\213\0\2\322\377-\212\0\200\377\240\0\200\377\212\0\2\265\377J\204"
+    "\0\2J\377\276\200\0\200\377\204\0\2\271\377\201\211\0\2\24\377\363"
+    "\206\0\200\377\205\0\2\364\377\1\203\0\2\2\377\363\204\0\5\277\377"
+    "ST\377\276\203\0\4>\377\306\271\343\200\0\4\344\264\304\377>\202\0"
+    "\7E\377\354\14\32\366\376.\207\0\200\377\207\0\3\216\377\316\5\212"
+    "\0\200\377\213\0\2`\377\237\212\0\200\377\240\0\200\377\212\0\2{"
+    "\377\216\204\0\2\216\377\214\200\0\200\377\204\0\3\71\377\353\11"
+    "\210\0\2\13\377\363\206\0\200\377\205\0\2\337\377\17\203\0\2\17"
+    "\377\336\204\0\5|\377\225\226\377{\203\0\4\32\377\352\353\254\200"
+    "\0\4\255\347\350\377\32\202\0\2\304\377y\200\0\2\215\377\260\207\0"
+    "\200\377\206\0\3<\375\371-\213\0\200\377\213\0\3\6\346\371\31\211"
+    "\0\200\377\240\0\200\377\212\0\3&\376\357\33\202\0\3\33\357\377C"
+    "\200\0\200\377\205\0\2\305\377i\210\0\2c\377\311\206\0\200\377\205"
+    "\0\2\261\377Y\203\0\2Y\377\261\204\0\5\71\377\330\331\377\71\204\0"
+    "\0\365\200\377\0u\200\0\0v\200\377\0\365\202\0\3C\377\354\14\200\0"
+    "\3\25\364\377\64\206\0\200\377\205\0\3\12\333\377z\214\0\200\377"
+    "\214\0\2z\377\206\211\0\200\377\240\0\200\377\213\0\3\246\377\330I"
+    "\200\14\4I\330\377\322\1\200\0\200\377\205\0\17R\377\332\2\0\325"
+    "\204E\34\7\5%~\371\377e\206\0\200\377\205\0\12M\377\362j\32\5\32l"
+    "\363\377N\204\0\1\4\362\200\377\1\362\4\204\0\0\322\200\377\0=\200"
+    "\0\0>\200\377\0\322\202\0\2\302\377z\202\0\2\206\377\267\206\0\200"
+    "\377\205\0\3\222\377\312\3\214\0\200\377\214\0\3\21\364\356\13\210"
+    "\0\200\377\240\0\200\377\213\0\1\21\317\204\377\1\363\62\201\0\200"
+    "\377\205\0\4\2\333\377Q\0\207\377\1\234\1\206\0\200\377\206\0\0"
+    "\220\205\377\0\220\206\0\0\264\200\377\0\263\205\0\3\256\377\374"
+    "\12\200\0\3\13\374\377\256\201\0\3A\377\355\15\202\0\3\21\360\377:"
+    "\205\0\200\377\205\0\0\376\211\377\204\0\200\377\215\0\2\223\377l"
+    "\210\0\200\377\240\0\200\377\214\0\3\11z\323\371\201\377\0_\202\0"
+    "\200\377\206\0\14j\377\305\0-\177\275\346\372\371\342\253I\210\0"
+    "\200\377\207\0\6I\264\353\373\353\265J\207\0\0q\200\377\0q\205\0\2"
+    "\212\377\317\202\0\2\320\377\212\201\0\2\300\377{\204\0\2~\377\276"
+    "\205\0\200\377\205\0\212\377\204\0\200\377\215\0\3#\375\334\2\207"
+    "\0\200\377\264\0\4\32\323\377\356-\377\0\202\0\200\377\216\0\2\255"
+    "\377R\207\0\200\377\265\0\4\21\306\377\347\23\377\0\201\0\203\377"
+    "\213\0\2:\377\306\204\0\203\377\266\0\2\12\263f\377\0\202\0\203"
+    "\377\224\0\203\377\377\0\377\0\377\0\316\0\214\377\377\0\317\0\214"
+    "\377\377\0\377\0\377\0\377\0\377\0\234\0\3~\377\331\23\377\0\332\0"
+    "\3y\377\304\10\224\0\200\377\241\0\200\377\224\0\2W\310\364\201"
+    "\377\217\0\200\377\216\0\200\377\213\0\200\377\205\0\200\377\211\0"
+    "\204\377\264\0\3t\377\254\2\223\0\200\377\241\0\200\377\223\0\0W"
+    "\204\377\217\0\200\377\216\0\200\377\213\0\200\377\205\0\200\377"
+    "\211\0\204\377\265\0\2o\377\217\223\0\200\377\241\0\200\377\223\0"
+    "\3\310\377\206\21\222\0\200\377\216\0\200\377\213\0\200\377\205\0"
+    "\200\377\215\0\200\377\315\0\200\377\241\0\200\377\223\0\2\365\377"
+    "\13\223\0\200\377\246\0\200\377\215\0\200\377\315\0\200\377\241\0"
+    "\200\377\223\0\200\377\224\0\200\377\246\0\200\377\215\0\200\377"
+    "\300\0\10/\205\306\356\373\352\274f\3\202\0\200\377\6\0i\326\373"
+    "\353\260\66\205\0\7\13s\304\356\373\343\245>\204\0\6\65\257\352"
+    "\373\330p\1\200\377\203\0\6\24\211\327\367\362\302U\203\0\211\377"
+    "\203\0\6\63\257\354\373\327m\0\200\377\201\0\200\377\7\0\67\257"
+    "\354\373\345\235\33\203\0\203\377\207\0\204\377\205\0\200\377\202"
+    "\0\4\26\322\377\333\36\204\0\200\377\207\0\200\377\11:\326\364\245"
+    "\10`\344\364\240\6\200\0\200\377\7\0\67\257\354\373\345\235\33\204"
+    "\0\6:\256\350\372\350\256\71\222\0\206\377\1\276\10\201\0\200\377"
+    "\0\211\203\377\1\374Y\203\0\1&\333\205\377\203\0\1Y\374\203\377\0"
+    "\221\200\377\202\0\1\60\350\204\377\0\210\202\0\211\377\202\0\1Q"
+    "\373\203\377\0\206\200\377\201\0\200\377\1W\374\203\377\1\343\23"
+    "\202\0\203\377\207\0\204\377\205\0\200\377\201\0\4\33\330\377\326"
+    "\31\205\0\200\377\207\0\200\377\0\351\201\377\1\254\375\201\377\0s"
+    "\200\0\200\377\1W\374\203\377\1\343\23\202\0\1d\376\203\377\1\375a"
+    "\221\0\11\317y:\22\3\21N\335\377}\201\0\200\377\10\376\233$\6#\232"
+    "\377\364\36\201\0\11\12\332\377\321N\21\4\31T\275\202\0\10\37\365"
+    "\377\230#\6%\236\376\200\377\201\0\12\15\340\377\231*\5\24c\362"
+    "\377A\205\0\200\377\206\0\10\32\361\377\243(\6!\226\374\200\377"
+    "\201\0\200\377\10\363\245\60\7\16S\352\377\211\205\0\200\377\213\0"
+    "\200\377\205\0\200\377\200\0\4 \335\377\320\25\206\0\200\377\207\0"
+    "\200\377\2\204\7}\200\377\4\207\10y\377\277\200\0\200\377\10\363"
+    "\245\60\7\16S\352\377\211\201\0\12&\371\377\230$\6$\232\377\370#"
+    "\227\0\2<\377\323\201\0\200\377\0\256\203\0\2\256\377\210\201\0\3p"
+    "\377\323\13\210\0\2\210\377\252\203\0\0\261\200\377\201\0\2s\377"
+    "\221\203\0\2_\377\254\205\0\200\377\206\0\2\202\377\263\203\0\0"
+    "\253\200\377\201\0\200\377\0\247\203\0\2V\377\322\205\0\200\377"
+    "\213\0\200\377\205\0\200\377\5\0%\342\377\312\21\207\0\200\377\207"
+    "\0\200\377\2\42\0\37\200\377\4\42\0\36\377\344\200\0\200\377\0\247"
+    "\203\0\2V\377\322\201\0\2\216\377\252\203\0\2\256\377\214\227\0\2"
+    "\5\377\363\201\0\200\377\0A\203\0\2B\377\314\201\0\2\302\377T\211"
+    "\0\2\315\377@\203\0\0C\200\377\201\0\2\303\377\36\203\0\2\20\377"
+    "\344\205\0\200\377\206\0\2\312\377C\203\0\0@\200\377\201\0\200\377"
+    "\0\62\203\0\2\21\377\363\205\0\200\377\213\0\200\377\205\0\200\377"
+    "\4+\347\377\303\16\210\0\200\377\207\0\200\377\2\11\0\11\200\377\4"
+    "\11\0\11\377\366\200\0\200\377\0\62\203\0\2\21\377\363\201\0\2\317"
+    "\377@\203\0\2B\377\315\220\0\4\12q\277\352\372\202\377\0\376\201\0"
+    "\200\377\0\20\203\0\2\21\377\360\201\0\2\355\377\25\211\0\2\361"
+    "\377\20\203\0\0\22\200\377\201\0\1\356\377\200\374\200\375\200\376"
+    "\200\377\0\372\205\0\200\377\206\0\2\360\377\20\203\0\0\20\200\377"
+    "\201\0\200\377\0\7\204\0\200\377\205\0\200\377\213\0\200\377\205\0"
+    "\200\377\0\353\200\377\0\210\211\0\200\377\207\0\200\377\2\1\0\1"
+    "\200\377\4\1\0\1\377\376\200\0\200\377\0\7\204\0\200\377\201\0\2"
+    "\361\377\20\203\0\2\21\377\360\217\0\1\33\332\207\377\201\0\200"
+    "\377\0\3\203\0\2\4\377\373\201\0\2\373\377\4\211\0\2\374\377\3\203"
+    "\0\0\4\200\377\201\0\0\374\210\377\205\0\200\377\206\0\2\374\377\3"
+    "\203\0\0\3\200\377\201\0\200\377\205\0\200\377\205\0\200\377\213\0"
+    "\200\377\205\0\201\377\0\306\200\375\0C\210\0\200\377\207\0\200"
+    "\377\201\0\200\377\201\0\200\377\200\0\200\377\205\0\200\377\201\0"
+    "\2\374\377\3\203\0\2\4\377\374\217\0\5\247\377\327W\34\5\200\0\0\5"
+    "\200\377\201\0\200\377\0\20\203\0\2\21\377\357\201\0\2\355\377\25"
+    "\211\0\2\360\377\20\203\0\0\22\200\377\201\0\1\357\363\216\0\200"
+    "\377\206\0\2\360\377\21\203\0\0\21\200\377\201\0\200\377\205\0\200"
+    "\377\205\0\200\377\213\0\200\377\205\0\200\377\5\254\5\202\377\346"
+    "\25\207\0\200\377\207\0\200\377\201\0\200\377\201\0\200\377\200\0"
+    "\200\377\205\0\200\377\201\0\2\361\377\20\203\0\2\22\377\360\217\0"
+    "\2\357\377\42\203\0\0,\200\377\201\0\200\377\0B\203\0\2A\377\310"
+    "\201\0\2\302\377U\211\0\2\312\377\77\203\0\0D\200\377\201\0\2\307"
+    "\377 \215\0\200\377\206\0\2\312\377E\203\0\0B\200\377\201\0\200"
+    "\377\205\0\200\377\205\0\200\377\213\0\200\377\205\0\200\377\6\3\0"
+    "\3\302\377\265\1\206\0\2\373\377\4\206\0\200\377\201\0\200\377\201"
+    "\0\200\377\200\0\200\377\205\0\200\377\201\0\2\320\377@\203\0\2B"
+    "\377\316\217\0\2\367\377\25\203\0\0\251\200\377\201\0\200\377\0"
+    "\256\203\0\2\254\377\202\201\0\3p\377\323\13\210\0\2\205\377\250"
+    "\203\0\0\261\200\377\201\0\2|\377\230\215\0\200\377\206\0\2\202"
+    "\377\265\203\0\0\255\200\377\201\0\200\377\205\0\200\377\205\0\200"
+    "\377\213\0\200\377\205\0\200\377\201\0\3\34\355\377q\206\0\2\344"
+    "\377/\206\0\200\377\201\0\200\377\201\0\200\377\200\0\200\377\205"
+    "\0\200\377\201\0\2\217\377\253\203\0\2\256\377\215\217\0\10\300"
+    "\377\272\61\5\12;\261\363\200\377\201\0\200\377\10\376\232#\5\42"
+    "\227\377\362\33\201\0\11\13\333\377\320M\20\4\27O\272\202\0\10\35"
+    "\364\377\225!\5$\235\376\200\377\201\0\11\24\352\377\236-\6\13\61t"
+    "\316\206\0\200\377\206\0\10\32\362\377\245(\5 \227\367\200\377\201"
+    "\0\200\377\205\0\200\377\205\0\200\377\213\0\200\377\205\0\200\377"
+    "\202\0\3N\377\371\62\205\0\3\242\377\301!\205\0\200\377\201\0\200"
+    "\377\201\0\200\377\200\0\200\377\205\0\200\377\201\0\12'\372\377"
+    "\227#\5#\232\377\370%\217\0\1\66\365\203\377\1\374X\200\377\201\0"
+    "\200\377\0\216\203\377\1\373S\203\0\1(\336\205\377\203\0\1W\374"
+    "\203\377\0\215\200\377\202\0\1\77\361\205\377\206\0\200\377\207\0"
+    "\1R\373\203\377\0|\200\377\201\0\200\377\205\0\200\377\201\0\210"
+    "\377\207\0\200\377\205\0\200\377\203\0\3\222\377\332\14\204\0\1)"
+    "\365\203\377\202\0\200\377\201\0\200\377\201\0\200\377\200\0\200"
+    "\377\205\0\200\377\202\0\1h\376\203\377\1\375d\221\0\7*\246\350"
+    "\374\355\262:\0\200\377\201\0\200\377\6\1n\330\373\354\256\64\205"
+    "\0\7\14t\306\357\373\345\247\77\204\0\6\65\257\354\373\330m\1\200"
+    "\377\203\0\7\36\223\334\370\365\320\217\63\206\0\200\377\210\0\10"
+    "\64\257\355\373\326i\4\377\366\201\0\200\377\205\0\200\377\201\0"
+    "\210\377\207\0\200\377\205\0\200\377\203\0\3\7\316\377\242\205\0\2"
+    "\63\272\364\201\377\202\0\200\377\201\0\200\377\201\0\200\377\200"
+    "\0\200\377\205\0\200\377\203\0\6<\257\352\373\351\257;\355\0\2\37"
+    "\377\334\241\0\2\4\377\372\377\0\264\0\2z\377\236\241\0\2\60\377"
+    "\341\377\0\255\0\11\320y\65\15\4 z\371\374\61\240\0\3 \300\377\240"
+    "\377\0\255\0\205\377\1\375k\236\0\203\377\1\364&\377\0\255\0\7\65"
+    "\221\323\366\371\341\243\65\237\0\201\377\2\364\272\62\377\0\377\0"
+    "\377\0\377\0\377\0\377\0\377\0\377\0\377\0\377\0\300\0\4\5~\323"
+    "\364\377\207\0\200\377\207\0\4\377\364\322|\5\335\0\200\377\337\0"
+    "\0~\202\377\207\0\200\377\207\0\202\377\0z\335\0\200\377\337\0\3"
+    "\322\377\204\20\210\0\200\377\210\0\3\21\207\377\320\335\0\200\377"
+    "\337\0\2\364\377\22\211\0\200\377\211\0\2\24\377\363\335\0\200\377"
+    "\337\0\2\376\377\1\211\0\200\377\211\0\2\1\377\376\242\0\200\377\6"
+    "\1m\327\373\353\257\65\205\0\6\65\257\353\373\327m\1\200\377\203\0"
+    "\200\377\6\0.\260\357\371\312T\202\0\10\31\207\315\360\374\361\316"
+    "\217\64\201\0\211\377\202\0\200\377\205\0\200\377\201\0\2\326\377A"
+    "\203\0\6B\377\326\0\343\377)\206\0\2)\377\342\200\0\3\246\377\306"
+    "\3\201\0\3\4\312\377\245\201\0\2\321\377R\203\0\2I\377\323\201\0"
+    "\211\377\205\0\200\377\212\0\200\377\212\0\200\377\242\0\200\377\0"
+    "\216\203\377\1\374V\203\0\1V\374\203\377\0\215\200\377\203\0\200"
+    "\377\1\71\366\203\377\201\0\1\62\356\206\377\201\0\211\377\202\0"
+    "\200\377\205\0\200\377\201\0\2\203\377\225\203\0\6\226\377\202\0"
+    "\251\377c\206\0\2d\377\250\200\0\3\20\341\377~\201\0\3\204\377\341"
+    "\17\201\0\2t\377\260\203\0\2\243\377y\201\0\210\377\0\376\205\0"
+    "\200\377\212\0\200\377\212\0\200\377\242\0\200\377\10\376\233%\6"
+    "\42\227\377\363\34\201\0\10\35\364\377\227#\6%\233\376\200\377\203"
+    "\0\200\377\6\323\312E\15\10;\257\201\0\11\303\377\264\70\15\3\20"
+    "\65t\316\205\0\200\377\207\0\200\377\205\0\200\377\201\0\3\60\377"
+    "\346\2\201\0\7\2\347\377/\0n\377\235\206\0\2\236\377m\201\0\10\77"
+    "\375\373\66\0<\374\375>\202\0\3\31\374\372\23\201\0\3\11\362\377!"
+    "\210\0\3Q\375\377v\204\0\2\6\377\374\212\0\200\377\212\0\2\375\377"
+    "\6\241\0\200\377\0\256\203\0\2\253\377\204\201\0\2\205\377\252\203"
+    "\0\0\256\200\377\203\0\200\377\1\324\11\206\0\2\367\377\17\214\0"
+    "\200\377\207\0\200\377\205\0\200\377\202\0\2\334\377<\201\0\2=\377"
+    "\333\200\0\2\64\377\327\206\0\2\330\377\63\202\0\6\210\377\332\32"
+    "\337\377\207\204\0\2\270\377l\201\0\2V\377\307\210\0\3=\367\377"
+    "\216\205\0\2\63\377\351\212\0\200\377\212\0\2\351\377\63\241\0\200"
+    "\377\0A\203\0\2@\377\311\201\0\2\312\377@\203\0\0B\200\377\203\0"
+    "\200\377\0Z\207\0\3\346\377\217!\213\0\200\377\207\0\200\377\205\0"
+    "\200\377\202\0\2\211\377\220\201\0\2\221\377\210\200\0\15\4\365"
+    "\376\23\0\17\373\370\13\0\23\377\364\4\202\0\6\5\315\377\354\377"
+    "\315\5\204\0\2Z\377\312\201\0\2\257\377m\207\0\4+\356\377\244\1"
+    "\203\0\4\12\71\313\377\250\212\0\200\377\212\0\4\251\377\313\70\11"
+    "\202\0\13P\263\352\374\353\267p+\10\20N\274\217\0\200\377\0\20\203"
+    "\0\2\20\377\357\201\0\2\360\377\20\203\0\0\22\200\377\203\0\200"
+    "\377\0\32\207\0\0t\201\377\4\347\271\220k*\206\0\200\377\207\0\200"
+    "\377\205\0\200\377\202\0\10\66\377\342\1\0\1\343\377\65\201\0\4"
+    "\277\377L\0R\200\377\4L\0M\377\276\204\0\4(\366\377\365'\205\0\10"
+    "\11\362\377'\0\20\370\374\27\206\0\4\34\343\377\271\5\203\0\201"
+    "\377\2\376\273\31\212\0\200\377\212\0\2\31\271\376\201\377\201\0"
+    "\212\377\217\0\200\377\0\3\203\0\2\3\377\373\201\0\2\374\377\3\203"
+    "\0\0\4\200\377\203\0\200\377\0\3\210\0\2X\310\375\203\377\1\257\14"
+    "\204\0\200\377\207\0\200\377\205\0\200\377\203\0\6\341\377\67\0\70"
+    "\377\340\202\0\13\204\377\206\0\231\350\351\224\0\207\377\203\204"
+    "\0\4\2\320\377\317\2\206\0\6\236\377\205\0c\377\273\206\0\4\20\324"
+    "\377\312\14\204\0\201\377\2\376\270\27\212\0\200\377\212\0\2\26"
+    "\266\375\201\377\201\0\13\273O\23\3\37X\237\335\372\356\266O\217\0"
+    "\200\377\0\20\203\0\2\20\377\360\201\0\2\361\377\20\203\0\0\22\200"
+    "\377\203\0\200\377\213\0\4\15\64W\205\312\200\377\0\232\204\0\200"
+    "\377\207\0\200\377\204\0\0\7\200\377\203\0\6\217\377\213\0\214\377"
+    "\216\202\0\13J\377\301\0\340\237\240\334\0\302\377I\204\0\0q\201"
+    "\377\0p\206\0\6A\377\341\1\274\377a\205\0\4\10\302\377\332\25\206"
+    "\0\4\13=\322\377\245\212\0\200\377\212\0\4\245\377\320<\13\237\0"
+    "\200\377\0B\203\0\2@\377\314\201\0\2\316\377\77\203\0\0B\200\377"
+    "\203\0\200\377\220\0\2R\377\355\204\0\2\376\377\1\206\0\2\365\377"
+    "\20\203\0\0\63\200\377\203\0\6;\377\336\1\337\377:\202\0\13\21\376"
+    "\365+\377TU\377)\366\376\20\203\0\6!\364\377\222\377\364 \205\0\6"
+    "\1\341\377Y\375\370\17\204\0\4\2\255\377\346 \211\0\2\71\377\350"
+    "\212\0\200\377\212\0\2\350\377\67\241\0\200\377\0\256\203\0\2\250"
+    "\377\210\201\0\2\211\377\250\203\0\0\256\200\377\203\0\200\377\220"
+    "\0\2\32\377\364\204\0\2\362\377\32\206\0\2\324\377T\203\0\0\246"
+    "\200\377\203\0\6\1\346\377f\377\345\1\203\0\11\325\377\243\372\16"
+    "\17\373\242\377\324\204\0\6\273\377\245\0\246\377\272\206\0\4\205"
+    "\377\357\377\260\205\0\3\225\377\360.\212\0\2\10\377\374\212\0\200"
+    "\377\212\0\2\375\377\7\241\0\200\377\10\376\232$\5!\224\377\365\37"
+    "\201\0\10\37\365\377\224!\5#\233\375\200\377\203\0\200\377\210\0"
+    "\12\331\216R&\12\2\23K\316\377\263\204\0\4\307\377\245\34\1\204\0"
+    "\10\213\377\350Q\15\6/\244\362\200\377\204\0\4\225\377\361\377\224"
+    "\204\0\3\232\377\374\276\200\0\3\277\374\377\231\203\0\10b\377\352"
+    "\24\0\24\353\377a\205\0\0'\201\377\0[\204\0\3|\377\370\77\214\0"
+    "\200\377\212\0\200\377\212\0\200\377\242\0\200\377\0\220\203\377\1"
+    "\374Y\203\0\1Z\374\203\377\0\203\200\377\203\0\200\377\210\0\207"
+    "\377\1\331\36\204\0\0`\204\377\202\0\1\26\347\203\377\1\373U\200"
+    "\377\204\0\0A\201\377\0@\204\0\0`\200\377\0s\200\0\0t\200\377\0_"
+    "\202\0\3\30\357\377Y\201\0\3Z\377\356\30\205\0\3\311\377\370\16"
+    "\204\0\211\377\205\0\200\377\212\0\200\377\212\0\200\377\242\0\200"
+    "\377\6\1p\331\373\354\260\67\205\0\6\67\260\354\373\326f\0\200\377"
+    "\203\0\200\377\210\0\11)w\265\342\371\372\347\273k\11\206\0\2b\312"
+    "\364\201\377\203\0\7\37\240\346\374\354\256\65\0\200\377\204\0\4\3"
+    "\352\377\352\3\204\0\0%\200\377\0)\200\0\0)\200\377\0%\202\0\2\255"
+    "\377\263\203\0\2\263\377\255\205\0\2\177\377\263\205\0\211\377\205"
+    "\0\2\376\377\1\211\0\200\377\211\0\2\1\377\376\242\0\200\377\223\0"
+    "\200\377\347\0\2\276\377^\227\0\2\364\377\21\211\0\200\377\211\0\2"
+    "\23\377\363\242\0\200\377\223\0\200\377\346\0\3$\376\370\16\227\0"
+    "\3\321\377\201\17\210\0\200\377\210\0\3\17\205\377\320\242\0\200"
+    "\377\223\0\200\377\345\0\3\22\267\377\250\230\0\0}\202\377\207\0"
+    "\200\377\207\0\202\377\0z\242\0\200\377\223\0\200\377\344\0\201"
+    "\377\1\371,\230\0\4\6\200\324\365\377\207\0\200\377\207\0\4\377"
+    "\365\323}\5\242\0\200\377\223\0\200\377\344\0\3\377\374\323G\247\0"
+    "\200\377\377\0\333\0\200\377\377\0\377\0\377\0\377\0\377\0\377\0"
+    "\377\0\273\0\201\377\206\0\201\377\201\0\201\377\224\0\200\377\205"
+    "\0\4[\327\371\326V\212\0\7\25\206\317\362\373\343\243=\206\0\201"
+    "\377\211\0\3\13\342\377\275\206\0\3\276\377\342\13\212\0\200\377"
+    "\305\0\0:\200\377\0\306\223\0\201\377\206\0\201\377\201\0\201\377"
+    "\205\0\7\236\377\347\1\0\312\377\304\205\0\200\377\204\0\0[\203"
+    "\377\0V\210\0\1&\350\205\377\206\0\201\377\211\0\0\205\200\377\0;"
+    "\206\0\0<\200\377\0\203\212\0\200\377\305\0\0\255\200\377\0R\223\0"
+    "\201\377\206\0\201\377\201\0\201\377\205\0\7\343\377\243\0\20\375"
+    "\377}\205\0\200\377\204\0\6\330\377x\14x\377\326\210\0\0\264\206"
+    "\377\206\0\201\377\210\0\3\26\365\377\305\210\0\3\307\377\364\25"
+    "\204\0\2R\255\42\200\0\200\377\200\0\2#\255R\277\0\4#\375\377\334"
+    "\2\223\0\201\377\206\0\201\377\201\0\201\377\204\0\0(\200\377\2]\0"
+    "R\200\377\0\66\201\0\3\6l\303\360\200\377\3\361\306\206\60\200\0\6"
+    "\372\377\13\0\14\377\371\210\0\0\363\200\377\5m\17\5\37^\302\206\0"
+    "\201\377\210\0\0\202\200\377\0]\210\0\0`\200\377\0\177\204\0\4\314"
+    "\377\371\212\16\200\377\4\16\212\371\377\313\277\0\0\223\200\377\0"
+    "l\224\0\201\377\206\0\201\377\201\0\201\377\204\0\10m\377\376\30\0"
+    "\226\377\355\2\200\0\1\17\312\207\377\200\0\6\330\377v\13v\377\326"
+    "\210\0\0\363\200\377\0\25\213\0\201\377\207\0\4\3\346\377\365\12"
+    "\210\0\4\14\370\377\342\1\203\0\4\33\234\374\377\351\200\377\4\352"
+    "\377\374\235\33\205\0\201\377\264\0\4\21\364\377\356\13\224\0\201"
+    "\377\206\0\201\377\201\0\201\377\201\0\0\260\212\377\1\0\224\210"
+    "\377\200\0\0[\203\377\0X\202\0\2\67\304;\201\0\0\270\200\377\0\214"
+    "\213\0\201\377\207\0\0\77\200\377\0\261\212\0\0\266\200\377\0;\205"
+    "\0\1)\260\202\377\1\264+\207\0\201\377\264\0\0z\200\377\0\206\225"
+    "\0\201\377\206\0\201\377\201\0\201\377\201\0\0\260\212\377\1\0\346"
+    "\200\377\1\204\26\200\377\3\15\60m\307\201\0\4[\330\372\327Y\201\0"
+    "\4!\250\367\213\20\201\0\0J\200\377\1\376K\212\0\201\377\207\0\0"
+    "\205\200\377\0q\212\0\0u\200\377\0\201\205\0\1(\257\202\377\1\263+"
+    "\207\0\201\377\263\0\4\6\346\377\371\31\225\0\201\377\222\0\0\260"
+    "\212\377\1\0\372\200\377\1\12\0\200\377\213\0\4\20\213\367\245\37"
+    "\203\0\1Q\374\200\377\1\361'\225\0\0\272\200\377\0@\212\0\0C\200"
+    "\377\0\270\203\0\4\32\233\374\377\345\200\377\4\345\377\374\234\33"
+    "\205\0\201\377\263\0\0`\200\377\0\237\226\0\2\374\377\374\224\0\0T"
+    "\200\377\5\60\0x\377\374\20\201\0\0\326\200\377\1\237\34\200\377"
+    "\211\0\4\5n\354\277\63\204\0\1d\376\202\377\1\327\15\224\0\0\340"
+    "\200\377\0\36\212\0\0 \200\377\0\336\203\0\4\314\377\367\205\14"
+    "\200\377\4\14\206\370\377\313\205\0\201\377\263\0\0\322\200\377\0-"
+    "\226\0\2\351\377\350\224\0\7\234\377\347\1\0\300\377\304\202\0\0g"
+    "\204\377\2\237b\20\205\0\3R\332\326M\205\0\5*\372\377\336m\376\200"
+    "\377\2\257\1\0\200\377\0\376\217\0\0\366\200\377\0\10\212\0\0\11"
+    "\200\377\0\364\203\0\2R\255!\200\0\200\377\200\0\2!\255R\200\0\213"
+    "\377\255\0\0F\200\377\0\271\227\0\2\323\377\323\224\0\7\343\377"
+    "\240\0\15\372\377|\203\0\1{\371\204\377\1\361d\202\0\4\66\303\350h"
+    "\3\206\0\0\237\200\377\2I\0\201\201\377\1{\0\200\377\0\355\217\0\0"
+    "\375\200\377\0\2\212\0\0\2\200\377\0\375\210\0\200\377\205\0\213"
+    "\377\220\0\205\377\224\0\0\272\200\377\0F\227\0\2\275\377\276\221"
+    "\0\212\377\0\260\202\0\2\34x\273\204\377\6T\0\32\247\364\202\14"
+    "\201\0\4[\327\371\325U\200\0\0\344\200\377\3\11\0\1\261\200\377\1"
+    "\375I\200\377\0\307\217\0\0\365\200\377\0\10\212\0\0\12\200\377\0"
+    "\364\210\0\200\377\205\0\213\377\220\0\205\377\223\0\0.\200\377\0"
+    "\321\230\0\2\247\377\252\221\0\212\377\0\260\205\0\200\377\1;\255"
+    "\200\377\4\315\0.\235\32\202\0\0[\203\377\2V\0\373\200\377\0\31"
+    "\200\0\1\16\327\200\377\0\357\200\377\0}\217\0\0\337\200\377\0\37"
+    "\212\0\0!\200\377\0\335\226\0\201\377\225\0\205\377\223\0\0\240"
+    "\200\377\0_\256\0\212\377\0\260\205\0\200\377\1\0\13\200\377\0\367"
+    "\206\0\10\330\377v\14~\377\326\0\351\200\377\0\205\201\0\1&\360"
+    "\201\377\1\351\22\217\0\0\271\200\377\0B\212\0\0D\200\377\0\270"
+    "\226\0\201\377\260\0\4\31\371\377\346\6\260\0\7\306\377\301\0\1"
+    "\350\377\235\203\0\4\327\213M\37\7\200\377\1\30\214\200\377\0\351"
+    "\206\0\10\372\377\13\0\15\377\371\0\247\200\377\5\376\212\36\4\61"
+    "\303\201\377\0U\220\0\0\204\200\377\0s\212\0\0w\200\377\0\203\226"
+    "\0\201\377\210\0\202\377\226\0\202\377\206\0\0\206\200\377\0y\231"
+    "\0\201\377\222\0\5\16\373\377|\0.\200\377\0X\203\0\211\377\0\227"
+    "\206\0\11\330\377s\13{\377\326\0,\370\210\377\0\245\220\0\0>\200"
+    "\377\0\263\212\0\0\270\200\377\0>\226\0\201\377\210\0\202\377\226"
+    "\0\202\377\205\0\4\13\356\377\364\21\231\0\201\377\222\0\0N\200"
+    "\377\5\67\0r\377\376\25\203\0\210\377\1\314\20\206\0\0[\203\377\0X"
+    "\200\0\1K\361\207\377\1\376\61\217\0\4\2\345\377\366\13\210\0\4\15"
+    "\370\377\344\2\226\0\201\377\210\0\202\377\226\0\202\377\205\0\0m"
+    "\200\377\0\222\232\0\201\377\222\0\7\222\377\357\3\0\266\377\316"
+    "\204\0\4(s\260\334\367\200\377\3\363\310p\6\210\0\4[\330\372\326X"
+    "\202\0\10\33\211\321\364\375\351\263R\264\200\377\0\272\220\0\0"
+    "\202\200\377\0_\210\0\0b\200\377\0\201\243\0\0\15\201\377\0\345"
+    "\226\0\202\377\204\0\4\2\335\377\375\42\303\0\0\3\200\377\263\0\3"
+    "\26\365\377\307\210\0\3\310\377\364\26\243\0\0A\201\377\0}\240\0\0"
+    "S\200\377\0\254\304\0\0\2\200\377\264\0\0\205\200\377\0;\206\0\0="
+    "\200\377\0\203\244\0\0x\200\377\1\371\27\240\0\0\306\200\377\0\71"
+    "\304\0\0\1\200\377\264\0\3\13\342\377\275\206\0\3\276\377\342\13"
+    "\244\0\0\256\200\377\0\243\354\0\200\377\352\0\0\345\200\377\0\66"
+    "\377\0\377\0\377\0\377\0\377\0\377\0\377\0\377\0\377\0\377\0\347\0"
+    "\2\12{\323\200\370\2\322{\11\203\0\3#i\257\361\201\377\204\0\11'q"
+    "\254\330\364\373\356\311\207!\203\0\10+{\271\345\372\366\335\247E"
+    "\207\0\1\4\322\201\377\203\0\210\377\204\0\7\42\215\321\364\373"
+    "\341\241<\201\0\212\377\202\0\2F\251\340\200\370\2\340\251E\204\0"
+    "\7/\243\343\372\364\314y\13\312\0\10/\204\302\351\373\365\321\203"
+    "\17\202\0\1\21\317\204\377\1\315\17\202\0\205\377\204\0\207\377\1"
+    "\370k\202\0\207\377\1\244\4\205\0\0s\202\377\203\0\210\377\203\0\1"
+    "g\370\205\377\201\0\212\377\200\0\1\3\236\206\377\1\235\3\201\0\1"
+    "\134\373\204\377\1\327\30\311\0\206\377\1\336\33\201\0\0\247\206"
+    "\377\0\243\202\0\205\377\204\0\211\377\0N\201\0\210\377\0x\204\0\1"
+    "\34\363\202\377\203\0\210\377\202\0\0U\207\377\201\0\211\377\0\362"
+    "\200\0\0r\210\377\0q\200\0\1&\370\206\377\0\270\311\0\207\377\0"
+    "\245\200\0\1'\376\200\377\0\205\200\22\0\205\200\377\1\376$\201\0"
+    "\3\340\240` \201\377\204\0\10\334\227_\62\21\3\22U\342\200\377\0"
+    "\304\201\0\7\322}=\22\3\23P\326\200\377\0\332\204\0\2\254\377\353"
+    "\201\377\203\0\201\377\210\0\1\11\347\200\377\6\321M\20\5#f\307"
+    "\211\0\0\264\200\377\0\221\200\0\0\327\200\377\5\311<\10\11:\306"
+    "\200\377\0\326\200\0\0\223\200\377\5\351R\14\13O\350\200\377\0\62"
+    "\310\0\6\322}>\25\3\23\177\200\377\0\355\200\0\0{\200\377\0\270"
+    "\202\0\0\271\200\377\0y\205\0\201\377\214\0\0\67\200\377\0\364\210"
+    "\0\0#\200\377\0\372\203\0\0H\200\377\0d\201\377\203\0\201\377\210"
+    "\0\0[\200\377\1\331\14\216\0\4%\376\377\375#\200\0\0\372\200\377\0"
+    "\33\202\0\0\32\200\377\0\371\200\0\0\326\200\377\0P\202\0\0O\200"
+    "\377\0\205\245\0\2\7^\312\216\0\2\311]\7\221\0\0\4\200\377\0\365"
+    "\200\0\0\265\200\377\0Z\202\0\0\134\200\377\0\265\205\0\201\377"
+    "\214\0\0\10\200\377\0\337\210\0\0\32\200\377\0\345\202\0\4\10\334"
+    "\377\311\1\201\377\203\0\201\377\210\0\0\243\200\377\0_\217\0\0"
+    "\222\200\377\0\262\201\0\0\346\200\377\0\33\202\0\0\34\200\377\0"
+    "\345\200\0\0\365\200\377\0\13\202\0\0\13\200\377\0\273\243\0\2\35"
+    "\206\352\200\377\216\0\200\377\2\352\205\35\217\0\0\20\200\377\0"
+    "\277\200\0\0\334\200\377\0)\202\0\0)\200\377\0\333\205\0\201\377"
+    "\214\0\0A\200\377\0\220\205\0\3\1\21H\314\200\377\0\217\202\0\4"
+    "\202\377\375\64\0\201\377\203\0\201\377\5\321\371\364\322\205\24"
+    "\202\0\0\324\200\377\6-\214\335\371\356\274R\210\0\1\16\362\200"
+    "\377\0B\201\0\0\213\200\377\5\307:\7\10;\311\200\377\0\210\200\0\0"
+    "\372\200\377\0\12\202\0\0\13\200\377\0\336\204\0\202\377\210\0\202"
+    "\377\211\0\2B\256\374\202\377\200\0\212\377\200\0\202\377\2\374"
+    "\255A\214\0\4\12\230\377\375>\200\0\0\363\200\377\5\16\0\207\363"
+    "\207\17\200\377\0\362\205\0\201\377\213\0\4\10\315\377\365\33\203"
+    "\0\205\377\1\271\13\201\0\3%\370\377\232\200\0\201\377\203\0\206"
+    "\377\1\347\64\201\0\0\360\200\377\0\323\204\377\0\212\207\0\0p\200"
+    "\377\0\321\202\0\1\10\254\206\377\1\253\7\200\0\0\345\200\377\0O"
+    "\202\0\0N\200\377\0\363\204\0\202\377\210\0\202\377\206\0\2\14j"
+    "\325\202\377\2\364\240=\200\0\212\377\200\0\2=\240\364\202\377\2"
+    "\324i\14\210\0\1\36\333\200\377\0s\201\0\0\376\200\377\5\3\0\364"
+    "\377\363\4\200\377\0\375\205\0\201\377\212\0\1\6\262\200\377\0d"
+    "\204\0\203\377\2\376\233\6\202\0\3\272\377\355\23\200\0\201\377"
+    "\203\0\207\377\1\350\24\200\0\0\375\210\377\0D\205\0\1\2\335\200"
+    "\377\0b\203\0\1\2\230\204\377\1\234\3\201\0\0\257\200\377\5\350O"
+    "\13\12M\346\200\377\0\375\204\0\202\377\210\0\202\377\204\0\2'\222"
+    "\361\202\377\2\307d\15\202\0\212\377\202\0\2\15e\307\202\377\2\361"
+    "\221&\205\0\1\10\330\200\377\0\242\202\0\0\376\200\377\5\3\0\211"
+    "\364\207\4\200\377\0\375\205\0\201\377\211\0\1\13\271\200\377\0"
+    "\220\205\0\205\377\1\311\14\200\0\0W\200\377\0h\201\0\201\377\203"
+    "\0\7\313n-\12\6*\217\375\200\377\0\206\200\0\0\376\200\377\5\350O"
+    "\13\14R\352\200\377\0\255\205\0\0O\200\377\1\352\7\202\0\1\6\271"
+    "\206\377\1\271\5\200\0\0H\210\377\0\373\204\0\202\377\210\0\202"
+    "\377\204\0\0\376\201\377\2\350\213)\230\0\2)\214\350\201\377\0\376"
+    "\204\0\5\4\246\377\371j\1\202\0\0\363\200\377\0\15\202\0\0\17\200"
+    "\377\0\362\205\0\201\377\210\0\1\24\311\200\377\1\233\1\207\0\3\2"
+    "\31g\357\200\377\0\205\200\0\3\345\377\315\2\201\0\201\377\212\0\0"
+    "v\200\377\0\324\200\0\0\365\200\377\0N\202\0\0Q\200\377\0\344\205"
+    "\0\0\276\200\377\0\202\203\0\0z\200\377\1\343N\200\13\1N\343\200"
+    "\377\0w\201\0\0\222\204\377\0\332\200\377\0\356\234\0\201\377\1"
+    "\227\7\234\0\1\7\227\201\377\204\0\0\235\200\377\0e\204\0\0\334"
+    "\200\377\0(\202\0\0)\200\377\0\333\205\0\201\377\207\0\1 \331\200"
+    "\377\1\235\1\213\0\0M\200\377\0\331\200\0\212\377\210\0\0\20\200"
+    "\377\0\365\200\0\0\337\200\377\0\12\202\0\0\13\200\377\0\372\204\0"
+    "\0-\200\377\1\371\30\203\0\0\330\200\377\0<\202\0\0<\200\377\0\327"
+    "\202\0\6V\276\357\372\337\221\61\200\377\0\322\234\0\0\376\201\377"
+    "\2\342\203#\230\0\2#\204\343\201\377\0\376\204\0\0\365\200\377\0"
+    "\27\204\0\0\265\200\377\0Z\202\0\0[\200\377\0\265\205\0\201\377"
+    "\206\0\1\61\347\200\377\1\232\1\214\0\0\7\200\377\0\371\200\0\212"
+    "\377\210\0\0\20\200\377\0\363\200\0\0\274\200\377\0\12\202\0\0\13"
+    "\200\377\0\363\204\0\0\234\200\377\0\243\204\0\0\373\200\377\0\6"
+    "\202\0\0\7\200\377\0\372\210\0\0^\200\377\0\243\234\0\2'\223\361"
+    "\201\377\3\376\300^\12\202\0\212\377\202\0\3\12^\300\376\201\377\2"
+    "\361\222'\204\0\201\377\0\1\204\0\0{\200\377\0\266\202\0\0\267\200"
+    "\377\0z\205\0\201\377\205\0\1D\362\200\377\1\226\1\215\0\0\63\200"
+    "\377\0\361\200\0\212\377\210\0\0r\200\377\0\316\200\0\0\206\200"
+    "\377\0N\202\0\0P\200\377\0\324\203\0\1\24\367\200\377\0\63\204\0\0"
+    "\360\200\377\0<\202\0\0@\200\377\0\357\207\0\1\13\330\200\377\0Z"
+    "\236\0\2\14k\325\202\377\2\361\232\70\200\0\212\377\200\0\2\70\232"
+    "\361\202\377\2\325j\14\206\0\201\377\205\0\1'\376\200\377\3\203\21"
+    "\22\203\200\377\1\376%\205\0\201\377\204\0\1\134\372\200\377\0\223"
+    "\207\0\10\324\205J#\13\2\22W\342\200\377\0\300\207\0\201\377\202\0"
+    "\10\316w\71\23\3\13\62\217\375\200\377\0z\200\0\0\66\200\377\5\346"
+    "M\12\13P\350\200\377\0\220\203\0\0{\200\377\0\303\205\0\0\276\200"
+    "\377\1\343N\200\13\1Q\346\200\377\0\276\201\0\6\306a \5\17L\320"
+    "\200\377\1\347\10\204\0\202\377\210\0\202\377\211\0\2C\257\374\202"
+    "\377\200\0\212\377\200\0\202\377\2\374\256B\224\0\0\247\206\377\0"
+    "\246\202\0\211\377\200\0\0\376\211\377\1\10\0\211\377\0P\207\0\201"
+    "\377\202\0\210\377\1\331\13\201\0\0\275\206\377\1\366#\202\0\1\5"
+    "\345\200\377\0S\205\0\0S\210\377\0S\201\0\207\377\0T\205\0\202\377"
+    "\210\0\202\377\213\0\2\36\207\352\200\377\216\0\200\377\2\352\206"
+    "\35\213\0\201\377\206\0\1\21\320\204\377\1\320\21\202\0\211\377"
+    "\200\0\212\377\1\10\0\207\377\1\373u\210\0\201\377\202\0\207\377\1"
+    "\313\36\202\0\1\33\331\204\377\1\372X\203\0\0Y\200\377\1\337\3\206"
+    "\0\0\210\206\377\0\210\202\0\205\377\1\370g\206\0\202\377\210\0"
+    "\202\377\215\0\2\7_\312\216\0\2\312^\7\215\0\201\377\207\0\7\12{"
+    "\323\370\371\324|\12\203\0\211\377\200\0\212\377\13\10\0,|\270\340"
+    "\367\374\357\314\216)\211\0\201\377\202\0\11,~\274\345\372\370\342"
+    "\256W\4\204\0\7\14z\315\365\372\343\243.\204\0\0\310\200\377\0s"
+    "\210\0\2\77\246\340\200\370\2\340\246\77\203\0\7;\241\342\374\364"
+    "\321\215\42\207\0\202\377\207\0\0\15\201\377\0\345\262\0\201\377"
+    "\377\0\241\0\0A\201\377\0}\377\0\330\0\0x\200\377\1\371\27\377\0"
+    "\330\0\0\256\200\377\0\243\377\0\331\0\0\345\200\377\0\66\377\0"
+    "\377\0\377\0\377\0\377\0\377\0\377\0\377\0\377\0\377\0\377\0\203\0"
+    "\0N\202\377\0N\203\0\203\377\4\375\356\307v\11\206\0\7\33\207\317"
+    "\363\373\344\251B\201\0\201\377\5\375\363\331\253b\13\203\0\211"
+    "\377\201\0\211\377\203\0\7%\223\327\367\371\333\234;\202\0\201\377"
+    "\203\0\201\377\202\0\207\377\205\0\205\377\201\0\201\377\202\0\1"
+    "\23\342\200\377\1\340\23\201\0\201\377\207\0\202\377\0-\200\0\0\62"
+    "\202\377\200\0\201\377\0\307\202\0\201\377\203\0\2\7u\320\200\367"
+    "\2\320u\7\223\0\0\223\202\377\0\222\203\0\207\377\1\324\23\204\0\1"
+    "U\363\205\377\201\0\206\377\1\351M\202\0\211\377\201\0\211\377\202"
+    "\0\1c\370\205\377\202\0\201\377\203\0\201\377\202\0\207\377\205\0"
+    "\205\377\201\0\201\377\201\0\1\1\267\200\377\1\370\64\202\0\201"
+    "\377\207\0\202\377\0i\200\0\0m\202\377\200\0\201\377\1\376\36\201"
+    "\0\201\377\202\0\1\14\306\204\377\1\306\14\204\0\7 \211\317\364"
+    "\372\342\242/\204\0\0\330\202\377\0\327\203\0\210\377\0\223\203\0"
+    "\1C\374\206\377\201\0\207\377\1\375K\201\0\211\377\201\0\211\377"
+    "\201\0\1L\376\206\377\202\0\201\377\203\0\201\377\202\0\207\377"
+    "\205\0\205\377\201\0\201\377\201\0\0|\201\377\0d\203\0\201\377\207"
+    "\0\202\377\0\245\200\0\0\251\202\377\200\0\202\377\0s\201\0\201"
+    "\377\202\0\0\233\206\377\0\232\203\0\1s\371\204\377\1\372^\202\0\0"
+    "\34\200\377\1\336\346\200\377\0\34\202\0\201\377\200\0\2\2\36\242"
+    "\200\377\0\341\202\0\1\4\335\200\377\6\346\134\23\12A\274\377\201"
+    "\0\201\377\4\0\6 h\346\200\377\1\345\7\200\0\201\377\211\0\201\377"
+    "\210\0\1\6\342\200\377\6\336Q\17\7\67\250\377\202\0\201\377\203\0"
+    "\201\377\205\0\201\377\214\0\201\377\201\0\201\377\200\0\1B\375"
+    "\200\377\0\235\204\0\201\377\207\0\202\377\0\341\200\0\0\344\202"
+    "\377\200\0\202\377\0\311\201\0\201\377\201\0\1\37\374\200\377\0"
+    "\203\200\22\0\204\200\377\1\374\36\201\0\0\206\200\377\10\257C\16"
+    "\5)\225\377\372/\201\0\0a\200\377\1\244\253\200\377\0`\202\0\201"
+    "\377\202\0\0\21\200\377\0\372\202\0\0Q\200\377\1\366'\202\0\1\1"
+    "\206\201\0\201\377\202\0\1\36\357\200\377\0[\200\0\201\377\211\0"
+    "\201\377\210\0\0U\200\377\1\361\35\203\0\0t\202\0\201\377\203\0"
+    "\201\377\205\0\201\377\214\0\201\377\201\0\201\377\2\0\31\350\200"
+    "\377\1\314\10\204\0\201\377\207\0\201\377\5\334\377\34 \377\342"
+    "\201\377\200\0\203\377\0 \200\0\201\377\201\0\0v\200\377\0\266\202"
+    "\0\0\267\200\377\0t\200\0\3L\377\376h\204\0\2\221\377\242\201\0\0"
+    "\246\200\377\1jp\200\377\0\245\202\0\201\377\202\0\0\17\200\377\0"
+    "\354\202\0\0\236\200\377\0\221\210\0\201\377\203\0\0\203\200\377\0"
+    "\243\200\0\201\377\211\0\201\377\210\0\0\240\200\377\0\210\211\0"
+    "\201\377\203\0\201\377\205\0\201\377\214\0\201\377\201\0\201\377\1"
+    "\4\302\200\377\1\355 \205\0\201\377\207\0\201\377\5\246\377Y[\377"
+    "\255\201\377\200\0\201\377\2\316\377v\200\0\201\377\201\0\0\262"
+    "\200\377\0Y\202\0\0Z\200\377\5\262\0\3\334\377\214\205\0\2$\377"
+    "\341\200\0\1\1\351\200\377\1\60\65\200\377\1\350\1\201\0\201\377"
+    "\200\0\2\1\32\232\200\377\0\253\202\0\0\320\200\377\0B\210\0\201"
+    "\377\203\0\0;\200\377\0\323\200\0\201\377\211\0\201\377\210\0\0"
+    "\321\200\377\0=\211\0\201\377\203\0\201\377\205\0\201\377\214\0"
+    "\201\377\201\0\201\377\0\211\200\377\1\375H\206\0\201\377\207\0"
+    "\201\377\5q\377\225\226\377x\201\377\200\0\201\377\2x\377\314\200"
+    "\0\201\377\201\0\0\332\200\377\0(\202\0\0)\200\377\17\331\0K\377"
+    "\350\12\0\2i\312\364\367\314[\377\372\200\0\0/\200\377\3\362\3\4"
+    "\365\200\377\0.\201\0\207\377\1\345#\202\0\0\357\200\377\0\27\210"
+    "\0\201\377\203\0\0\25\200\377\0\357\200\0\210\377\202\0\210\377"
+    "\201\0\0\357\200\377\0\25\211\0\211\377\205\0\201\377\214\0\201"
+    "\377\201\0\201\377\0\376\200\377\1\363\23\206\0\201\377\207\0\201"
+    "\377\5<\377\321\322\377B\201\377\200\0\201\377\0\42\200\377\1\42\0"
+    "\201\377\201\0\0\362\200\377\0\15\202\0\0\17\200\377\7\361\0\231"
+    "\377\210\0\2\257\206\377\200\0\0t\200\377\0\274\200\0\0\277\200"
+    "\377\0s\201\0\206\377\1\323\77\203\0\0\375\200\377\0\6\210\0\201"
+    "\377\203\0\0\5\200\377\0\374\200\0\210\377\202\0\210\377\201\0\0"
+    "\375\200\377\0\5\201\0\203\377\201\0\211\377\205\0\201\377\214\0"
+    "\201\377\201\0\205\377\0\214\206\0\201\377\207\0\201\377\1\12\374"
+    "\200\375\1\376\17\201\377\200\0\201\377\4\0\313\377y\0\201\377\201"
+    "\0\0\375\200\377\0\3\202\0\0\4\200\377\15\374\0\316\377D\0k\377"
+    "\355U\14\15W\356\200\377\200\0\0\270\200\377\0\202\200\0\0\204\200"
+    "\377\0\270\201\0\210\377\1\233\2\201\0\0\375\200\377\0\6\210\0\201"
+    "\377\203\0\0\6\200\377\0\373\200\0\210\377\202\0\210\377\201\0\0"
+    "\371\200\377\0\6\201\0\203\377\201\0\211\377\205\0\201\377\214\0"
+    "\201\377\201\0\202\377\0\371\200\377\1\367\33\205\0\201\377\207\0"
+    "\201\377\1\0\321\200\377\1\330\0\201\377\200\0\201\377\4\0t\377"
+    "\317\0\201\377\201\0\0\375\200\377\0\3\202\0\0\4\200\377\10\374\0"
+    "\356\377\30\0\315\377U\202\0\0W\200\377\2\0\7\366\200\377\0H\200\0"
+    "\0I\200\377\1\365\6\200\0\201\377\200\0\3\1\22L\330\200\377\0j\201"
+    "\0\0\357\200\377\0\27\210\0\201\377\203\0\0\25\200\377\0\356\200\0"
+    "\201\377\211\0\201\377\210\0\0\352\200\377\0\30\201\0\203\377\201"
+    "\0\201\377\203\0\201\377\205\0\201\377\214\0\201\377\201\0\201\377"
+    "\2\344\70\373\200\377\0\231\205\0\201\377\207\0\201\377\1\0\234"
+    "\200\377\1\243\0\201\377\200\0\201\377\4\0\36\376\377%\201\377\201"
+    "\0\0\362\200\377\0\15\202\0\0\17\200\377\10\361\0\374\377\7\0\366"
+    "\377\13\202\0\0\14\200\377\1\0B\210\377\0A\200\0\201\377\203\0\0"
+    "\63\200\377\0\315\201\0\0\320\200\377\0B\210\0\201\377\203\0\0<"
+    "\200\377\0\322\200\0\201\377\211\0\201\377\210\0\0\312\200\377\0C"
+    "\203\0\201\377\201\0\201\377\203\0\201\377\205\0\201\377\214\0\201"
+    "\377\201\0\201\377\2:\0\233\200\377\1\373#\204\0\201\377\207\0\201"
+    "\377\1\0g\200\377\1n\0\201\377\200\0\201\377\200\0\2\307\377{\201"
+    "\377\201\0\0\332\200\377\0(\202\0\0)\200\377\10\331\0\373\377\11\0"
+    "\366\377\13\202\0\0\14\200\377\1\0\206\210\377\0\206\200\0\201\377"
+    "\203\0\0\5\200\377\0\365\201\0\0\236\200\377\0\221\210\0\201\377"
+    "\203\0\0\204\200\377\0\242\200\0\201\377\211\0\201\377\210\0\0\227"
+    "\200\377\0\223\203\0\201\377\201\0\201\377\203\0\201\377\205\0\201"
+    "\377\213\0\0\5\200\377\0\373\201\0\201\377\200\0\1\37\372\200\377"
+    "\0\245\204\0\201\377\207\0\201\377\204\0\201\377\200\0\201\377\200"
+    "\0\2p\377\322\201\377\201\0\0\262\200\377\0Y\202\0\0Z\200\377\10"
+    "\262\0\351\377\35\0\313\377U\202\0\0W\200\377\1\0\313\210\377\0"
+    "\312\200\0\201\377\203\0\0(\200\377\0\367\201\0\0Q\200\377\1\366'"
+    "\202\0\1\1\205\201\0\201\377\202\0\1\36\357\200\377\0Y\200\0\201"
+    "\377\211\0\201\377\210\0\0F\200\377\1\367)\202\0\201\377\201\0\201"
+    "\377\203\0\201\377\205\0\201\377\204\0\1\241\15\203\0\0\67\200\377"
+    "\0\351\201\0\201\377\201\0\0\230\200\377\1\375-\203\0\201\377\207"
+    "\0\201\377\204\0\201\377\200\0\201\377\200\0\1\33\376\202\377\201"
+    "\0\0v\200\377\0\266\202\0\0\267\200\377\15u\0\305\377O\0i\377\354T"
+    "\13\14W\356\200\377\1\22\375\200\377\0M\202\0\0T\200\377\2\375\22"
+    "\0\201\377\200\0\3\1\16\77\312\200\377\0\326\201\0\1\4\335\200\377"
+    "\6\346\134\22\12A\273\377\201\0\201\377\4\0\5\37g\345\200\377\1"
+    "\344\7\200\0\201\377\211\0\201\377\210\0\1\2\325\200\377\4\347]\22"
+    "\4\61\201\377\201\0\201\377\203\0\201\377\205\0\201\377\204\0\3"
+    "\377\353|.\200\7\1<\323\200\377\0\272\201\0\201\377\201\0\1\35\371"
+    "\200\377\0\262\203\0\201\377\207\0\201\377\204\0\201\377\200\0\201"
+    "\377\201\0\0\303\202\377\201\0\1 \374\200\377\3\203\21\22\203\200"
+    "\377\10\374\37\0\212\377\231\0\2\254\206\377\0T\200\377\1\376\22"
+    "\202\0\0\26\201\377\1T\0\211\377\0\177\202\0\1C\374\206\377\201\0"
+    "\207\377\1\375J\201\0\211\377\201\0\201\377\211\0\1:\373\207\377"
+    "\201\0\201\377\203\0\201\377\202\0\207\377\201\0\210\377\0`\201\0"
+    "\201\377\202\0\0\225\201\377\0\70\202\0\211\377\0\0\201\377\204\0"
+    "\201\377\200\0\201\377\201\0\0m\202\377\202\0\0\233\206\377\0\232"
+    "\200\0\13\63\377\365\27\0\2g\312\365\370\321a\200\377\0\231\200"
+    "\377\0\323\204\0\0\326\200\377\1\230\0\210\377\1\276\12\203\0\1U"
+    "\363\205\377\201\0\206\377\1\351M\202\0\211\377\201\0\201\377\212"
+    "\0\1S\364\205\377\0\254\201\0\201\377\203\0\201\377\202\0\207\377"
+    "\201\0\207\377\1\257\2\201\0\201\377\202\0\1\33\367\200\377\0\275"
+    "\202\0\211\377\0\0\201\377\204\0\201\377\200\0\201\377\201\0\1\31"
+    "\375\201\377\202\0\1\14\307\204\377\1\306\14\201\0\3\274\377\265\1"
+    "\207\0\0\336\200\377\0\226\204\0\0\227\200\377\1\335\0\203\377\5"
+    "\376\364\334\254X\2\205\0\7\33\210\320\364\374\345\250A\201\0\201"
+    "\377\5\376\365\333\255d\13\203\0\211\377\201\0\201\377\213\0\7\35"
+    "\214\324\367\371\340\245A\202\0\201\377\203\0\201\377\202\0\207"
+    "\377\201\0\3,}\272\344\200\371\3\345\265[\1\202\0\201\377\203\0\0"
+    "\221\201\377\0D\201\0\211\377\0\0\201\377\204\0\201\377\200\0\201"
+    "\377\202\0\0\277\201\377\203\0\2\7v\321\200\370\2\321v\7\202\0\4&"
+    "\362\377\244\11\377\0\331\0\13E\366\377\340r*\7\5!a\307\67\377\0"
+    "\322\0\1\61\322\206\377\0\270\377\0\323\0\11\2O\244\332\367\374"
+    "\354\304~\32\377\0\377\0\377\0\377\0\377\0\377\0\377\0\377\0\377\0"
+    "\377\0\377\0\377\0\206\0\202\377\4\375\361\326\243E\204\0\2\7u\320"
+    "\200\367\2\320u\7\203\0\203\377\4\366\342\263\134\2\204\0\7W\273"
+    "\355\373\356\307\211\61\202\0\211\377\200\0\201\377\203\0\201\377"
+    "\201\0\0\343\200\377\0\225\203\0\0\226\200\377\1\342\361\200\377\0"
+    "\17\204\0\0\25\200\377\1\362\266\200\377\1\330\5\202\0\1\5\330\200"
+    "\377\2\265\0\305\200\377\1\351\6\201\0\1\6\351\200\377\1\305\0\212"
+    "\377\204\0\203\377\0\330\202\0\3\304\377\337\3\212\0\0\254\203\377"
+    "\210\0\4I\376\377\376I\222\0\207\377\1\235\1\201\0\1\14\306\204"
+    "\377\1\306\14\202\0\207\377\1\270\6\201\0\1\1\241\206\377\202\0"
+    "\211\377\200\0\201\377\203\0\201\377\201\0\0\250\200\377\0\310\203"
+    "\0\0\311\200\377\1\247\324\200\377\0&\204\0\0'\200\377\2\326'\372"
+    "\200\377\0p\202\0\0s\200\377\3\372&\0P\201\377\0X\201\0\0Y\201\377"
+    "\1O\0\212\377\204\0\203\377\0\330\202\0\0M\200\377\0[\212\0\0\254"
+    "\203\377\207\0\1\30\352\201\377\1\351\30\221\0\210\377\0]\201\0\0"
+    "\233\206\377\0\232\202\0\210\377\0q\201\0\0c\207\377\202\0\211\377"
+    "\200\0\201\377\203\0\201\377\201\0\0m\200\377\1\367\4\201\0\1\5"
+    "\367\200\377\1m\266\200\377\0=\204\0\0\70\200\377\2\272\0\214\200"
+    "\377\1\357\24\200\0\1\26\361\200\377\0\214\200\0\1\2\331\200\377\0"
+    "\300\201\0\0\301\200\377\2\330\1\0\212\377\204\0\201\377\205\0\3\1"
+    "\324\377\321\215\0\201\377\206\0\1\1\272\203\377\1\272\1\220\0\201"
+    "\377\4\0\1\15>\312\200\377\0\275\200\0\1\37\374\200\377\0\203\200"
+    "\22\0\204\200\377\1\374\36\201\0\201\377\200\0\2\11\66\306\200\377"
+    "\0\311\201\0\0\310\200\377\6\250\37\3\34i\341\377\206\0\201\377"
+    "\204\0\201\377\203\0\201\377\201\0\0\63\201\377\0/\201\0\0\60\201"
+    "\377\1\62\230\200\377\0T\204\0\0J\200\377\3\236\0\16\350\200\377\0"
+    "\227\200\0\0\234\200\377\1\350\16\201\0\0e\201\377\2(\0)\201\377\0"
+    "d\207\0\0t\201\377\0\244\204\0\201\377\206\0\0^\200\377\0J\214\0"
+    "\201\377\206\0\0v\200\377\2\366y\367\200\377\0u\220\0\201\377\202"
+    "\0\0*\200\377\0\354\200\0\0v\200\377\0\266\202\0\0\267\200\377\0t"
+    "\201\0\201\377\202\0\0(\200\377\0\361\201\0\0\364\200\377\0\30\202"
+    "\0\1\10\234\206\0\201\377\204\0\201\377\203\0\201\377\201\0\1\4"
+    "\364\200\377\0b\201\0\0c\200\377\2\363\3z\200\377\0k\204\0\0\134"
+    "\200\377\0\202\200\0\0b\200\377\3\374-\63\375\200\377\0c\202\0\1\7"
+    "\350\200\377\2\220\0\221\200\377\1\347\7\206\0\1%\366\200\377\1"
+    "\346\21\204\0\201\377\206\0\3\4\341\377\302\214\0\201\377\205\0\12"
+    "\65\372\377\370G\0G\370\377\372\64\217\0\201\377\202\0\0\5\200\377"
+    "\0\373\200\0\0\262\200\377\0Y\202\0\0Z\200\377\0\261\201\0\201\377"
+    "\202\0\0\5\200\377\0\373\201\0\0\371\200\377\0<\214\0\201\377\204"
+    "\0\201\377\203\0\201\377\202\0\0\275\200\377\0\226\201\0\0\227\200"
+    "\377\2\275\0]\200\377\2\202\0\206\200\377\2\212\0m\200\377\0g\200"
+    "\0\1\1\313\200\377\1\275\304\200\377\1\314\2\203\0\0{\200\377\2"
+    "\356\22\357\200\377\0z\206\0\1\1\301\201\377\0K\205\0\201\377\207"
+    "\0\0n\200\377\0\71\213\0\201\377\204\0\4\15\334\377\371L\201\0\4L"
+    "\372\377\333\15\216\0\201\377\202\0\0*\200\377\0\354\200\0\0\332"
+    "\200\377\0(\202\0\0)\200\377\0\331\201\0\201\377\202\0\0)\200\377"
+    "\0\345\201\0\0\324\200\377\2\355q\17\212\0\201\377\204\0\201\377"
+    "\203\0\201\377\202\0\0\203\200\377\0\311\201\0\0\312\200\377\2\202"
+    "\0\77\200\377\2\231\0\262\200\377\2\276\0\177\200\377\0K\201\0\1"
+    "\71\376\203\377\0;\204\0\1\21\364\200\377\0\275\200\377\1\363\20"
+    "\206\0\0k\201\377\0\236\206\0\201\377\207\0\3\12\354\377\261\213\0"
+    "\201\377\204\0\3\243\377\373Q\203\0\3Q\373\377\243\216\0\201\377"
+    "\200\0\2\15=\312\200\377\0\275\200\0\0\362\200\377\0\15\202\0\0\17"
+    "\200\377\0\361\201\0\201\377\200\0\2\10\66\306\200\377\0\242\201\0"
+    "\0u\202\377\3\367\262_\7\207\0\201\377\204\0\201\377\203\0\201\377"
+    "\202\0\0H\200\377\4\367\4\0\5\370\200\377\2G\0!\200\377\2\260\0"
+    "\336\200\377\2\360\1\220\200\377\0/\202\0\0\243\202\377\0\245\206"
+    "\0\0\220\203\377\0\217\206\0\1\37\363\200\377\1\342\17\206\0\201"
+    "\377\210\0\3\177\377\376)\212\0\201\377\241\0\210\377\0]\200\0\0"
+    "\375\200\377\0\3\202\0\0\4\200\377\0\374\201\0\207\377\1\354#\201"
+    "\0\1\3\236\204\377\1\336\67\206\0\201\377\204\0\201\377\203\0\201"
+    "\377\202\0\1\17\375\200\377\2\60\0\61\200\377\7\375\17\0\5\375\377"
+    "\307\13\201\376\2\377&\242\200\377\0\23\202\0\1\32\366\200\377\1"
+    "\367\34\206\0\1\37\373\201\377\1\373\36\206\0\0\271\201\377\0E\207"
+    "\0\201\377\210\0\3\23\364\377\240\212\0\201\377\241\0\207\377\1"
+    "\235\1\200\0\0\375\200\377\0\3\202\0\0\4\200\377\0\374\201\0\206"
+    "\377\1\266\34\204\0\1L\316\203\377\1\360!\205\0\201\377\204\0\201"
+    "\377\203\0\201\377\203\0\0\323\200\377\2c\0d\200\377\0\322\201\0"
+    "\13\345\377\336\66\377\333\332\377[\264\377\367\203\0\1\66\376\201"
+    "\377\0\70\207\0\0\245\201\377\0\244\206\0\0a\201\377\0\230\210\0"
+    "\201\377\211\0\3\220\377\372\35\211\0\201\377\241\0\202\377\4\376"
+    "\363\330\243F\202\0\0\362\200\377\0\15\202\0\0\17\200\377\0\363"
+    "\201\0\206\377\1\370&\206\0\2\66\207\343\201\377\0\234\205\0\201"
+    "\377\204\0\201\377\203\0\201\377\203\0\0\230\200\377\2\226\0\227"
+    "\200\377\0\227\201\0\13\310\377\365b\377\251\244\377\217\305\377"
+    "\334\203\0\0\304\202\377\0\307\207\0\0\60\201\377\0\60\205\0\1\31"
+    "\357\200\377\1\337\14\210\0\201\377\211\0\3\35\372\377\217\211\0"
+    "\201\377\241\0\201\377\210\0\0\332\200\377\0(\202\0\0)\200\377\0"
+    "\336\201\0\201\377\3\0\10n\376\200\377\0\237\210\0\1\5\242\200\377"
+    "\0\343\205\0\201\377\204\0\0\374\200\377\203\0\200\377\0\374\203\0"
+    "\0]\200\377\2\312\0\313\200\377\0]\201\0\0\252\200\377\10\232\377v"
+    "o\377\303\327\377\300\202\0\0V\200\377\1\375\376\200\377\0X\207\0"
+    "\201\377\206\0\0\260\200\377\1\376A\211\0\201\377\212\0\3\241\377"
+    "\364\22\210\0\201\377\241\0\201\377\210\0\0\261\200\377\0Y\202\0\0"
+    "Z\200\377\0\273\201\0\201\377\201\0\0\221\200\377\1\373$\210\0\0"
+    "\21\200\377\0\373\205\0\201\377\204\0\0\360\200\377\0\6\201\0\0\7"
+    "\200\377\0\357\203\0\0#\200\377\2\370\12\370\200\377\0\42\201\0\0"
+    "\214\200\377\10\336\377D:\377\364\353\377\244\201\0\1\7\336\200"
+    "\377\1\236\246\200\377\1\337\7\206\0\201\377\205\0\0X\201\377\0"
+    "\223\212\0\201\377\212\0\3+\376\377~\210\0\201\377\241\0\201\377"
+    "\210\0\0t\200\377\0\266\202\0\0\267\200\377\0\210\201\0\201\377"
+    "\201\0\1\27\367\200\377\0\246\201\0\1\250\30\203\0\0\34\200\377\0"
+    "\363\205\0\201\377\204\0\0\321\200\377\0>\201\0\0@\200\377\0\320"
+    "\204\0\0\350\200\377\0c\200\377\0\347\202\0\0n\202\377\2\22\11\373"
+    "\201\377\0\210\201\0\0v\200\377\3\365\33\37\370\200\377\0x\206\0"
+    "\201\377\204\0\1\25\353\200\377\1\333\12\212\0\201\377\213\0\3\262"
+    "\377\353\12\207\0\201\377\241\0\201\377\210\0\1\36\374\200\377\3"
+    "\203\21\22\203\201\377\0\77\201\0\201\377\202\0\0\217\200\377\1"
+    "\376-\200\0\7\377\364\223B\23\4-\277\200\377\0\314\205\0\201\377"
+    "\204\0\0\231\200\377\4\326\63\5\64\331\200\377\0\231\204\0\0\255"
+    "\200\377\0\312\200\377\0\255\202\0\0Q\201\377\0\337\200\0\0\317"
+    "\201\377\0m\200\0\1\25\361\200\377\0\203\200\0\0\210\200\377\1\361"
+    "\26\205\0\201\377\204\0\0\247\200\377\1\375<\213\0\201\377\213\0\0"
+    ":\200\377\0n\207\0\201\377\241\0\201\377\211\0\0\227\206\377\1\323"
+    "\1\201\0\201\377\202\0\1\27\365\200\377\0\261\200\0\210\377\0n\205"
+    "\0\201\377\204\0\0\71\207\377\0\70\204\0\0s\203\377\0r\202\0\0\63"
+    "\201\377\0\255\200\0\0\232\201\377\0Q\200\0\0\227\200\377\1\350\14"
+    "\200\0\1\16\352\200\377\0\230\205\0\201\377\204\0\212\377\204\0"
+    "\201\377\214\0\3\302\377\340\4\206\0\201\377\241\0\201\377\211\0\1"
+    "\12\302\204\377\1\364\66\202\0\201\377\203\0\0\213\201\377\1\67\0"
+    "\207\377\1\255\4\205\0\201\377\205\0\0\214\205\377\0\214\205\0\0"
+    "\70\203\377\0\67\202\0\0\25\201\377\0{\200\0\0d\201\377\3\65\0+"
+    "\374\200\377\0h\202\0\0j\200\377\1\374+\204\0\201\377\204\0\212"
+    "\377\204\0\201\377\214\0\0K\200\377\0]\206\0\201\377\241\0\201\377"
+    "\212\0\3\5q\316\367\201\377\1\336\23\202\0\201\377\203\0\1\25\363"
+    "\200\377\12\275\0/\203\300\347\372\371\343\261T\207\0\201\377\206"
+    "\0\6T\272\354\373\354\273U\206\0\1\6\367\201\377\1\367\5\203\0\0"
+    "\366\200\377\0I\200\0\0/\201\377\2\31\0\270\200\377\1\326\3\202\0"
+    "\1\4\327\200\377\0\270\204\0\201\377\204\0\212\377\204\0\201\377"
+    "\215\0\3\322\377\323\1\205\0\201\377\264\0\1\33\335\200\377\1\303"
+    "\7\377\0\201\0\201\377\215\0\0\134\200\377\0L\205\0\201\377\265\0"
+    "\4 \342\377\347$\377\0\201\0\203\377\0\330\212\0\3\4\337\377\304"
+    "\202\0\0\254\203\377\266\0\2$\302!\377\0\202\0\203\377\0\330\222\0"
+    "\0\254\203\377\377\0\377\0\377\0\316\0\214\377\377\0\317\0\214\377"
+    "\377\0\377\0\377\0\377\0\276\0\201\377\212\0\201\377\312\0\4p\375"
+    "\377\333\24\373\0\201\377\212\0\201\377\313\0\4R\367\377\306\11"
+    "\223\0\201\377\240\0\201\377\222\0\3\3w\323\366\201\377\220\0\201"
+    "\377\215\0\201\377\212\0\201\377\204\0\201\377\211\0\204\377\262\0"
+    "\4:\354\377\255\2\222\0\201\377\240\0\201\377\222\0\0v\204\377\220"
+    "\0\201\377\215\0\201\377\212\0\201\377\204\0\201\377\211\0\204\377"
+    "\263\0\3%\334\377\220\222\0\201\377\240\0\201\377\222\0\0\322\204"
+    "\377\220\0\201\377\245\0\201\377\211\0\204\377\313\0\201\377\240\0"
+    "\201\377\222\0\0\366\200\377\1\71\1\222\0\201\377\245\0\201\377"
+    "\214\0\201\377\313\0\201\377\240\0\201\377\222\0\201\377\224\0\201"
+    "\377\245\0\201\377\214\0\201\377\276\0\11/\204\300\347\371\370\345"
+    "\266\134\1\201\0\201\377\6\0S\316\372\354\265@\205\0\10\3X\261\345"
+    "\371\365\324\226\67\202\0\6A\265\354\372\316S\0\201\377\202\0\7\20"
+    "\201\321\363\366\330\222\36\203\0\210\377\203\0\6-\252\352\372\326"
+    "l\1\201\377\201\0\201\377\6\0f\322\372\357\263.\203\0\204\377\207"
+    "\0\204\377\204\0\201\377\201\0\1\67\361\200\377\1\357;\203\0\201"
+    "\377\205\0\201\377\11.\320\364\213\4\220\361\357\230\4\200\0\201"
+    "\377\6\0i\324\372\357\261,\203\0\2\22\204\323\200\365\2\323\204\22"
+    "\221\0\207\377\1\256\1\200\0\201\377\0k\203\377\1\376f\203\0\1\27"
+    "\305\206\377\201\0\0j\204\377\0k\201\377\201\0\1+\344\204\377\1"
+    "\361C\202\0\210\377\202\0\1I\370\203\377\0\226\201\377\201\0\201"
+    "\377\0{\203\377\1\362$\202\0\204\377\207\0\204\377\204\0\201\377"
+    "\200\0\1\64\360\200\377\1\350/\204\0\201\377\205\0\201\377\0\327"
+    "\201\377\0\272\202\377\0q\200\0\201\377\0\201\203\377\1\361\42\201"
+    "\0\1-\345\204\377\1\345-\220\0\210\377\0Y\200\0\201\377\0\371\204"
+    "\377\1\371%\201\0\1\5\313\207\377\200\0\1'\372\204\377\0\371\201"
+    "\377\200\0\1\13\334\206\377\1\356\30\201\0\210\377\201\0\1\25\355"
+    "\210\377\201\0\201\377\0\365\204\377\0\234\202\0\204\377\207\0\204"
+    "\377\204\0\201\377\2\0\60\356\200\377\1\340$\205\0\201\377\205\0"
+    "\212\377\0\273\200\0\201\377\0\367\204\377\0\232\200\0\1\14\336"
+    "\206\377\1\336\14\217\0\7\324\201D\32\7\4#\221\200\377\0\260\200\0"
+    "\201\377\5\370h\17\16d\367\200\377\0\215\201\0\0d\201\377\1\235\61"
+    "\200\10\2&c\303\200\0\0\217\200\377\5\367d\16\17h\370\201\377\200"
+    "\0\0p\200\377\5\325C\12\7\64\300\200\377\0\203\204\0\201\377\205\0"
+    "\0{\200\377\5\371j\17\20m\372\201\377\201\0\201\377\4\341@\6\33"
+    "\253\200\377\0\335\205\0\201\377\212\0\201\377\204\0\201\377\1-"
+    "\354\200\377\1\326\33\206\0\201\377\205\0\201\377\1FN\201\377\1KH"
+    "\200\377\0\340\200\0\201\377\4\342B\6\33\253\200\377\0\335\200\0\0"
+    "r\200\377\1\366c\200\16\1c\366\200\377\0r\226\0\0\3\200\377\0\340"
+    "\200\0\201\377\0u\202\0\0t\200\377\0\315\201\0\0\275\200\377\0\222"
+    "\207\0\0\317\200\377\0s\202\0\0v\201\377\200\0\0\301\200\377\0*"
+    "\202\0\0\32\200\377\0\314\204\0\201\377\205\0\0\305\200\377\0y\202"
+    "\0\0|\201\377\201\0\201\377\0H\201\0\0\36\200\377\0\370\205\0\201"
+    "\377\212\0\201\377\204\0\201\377\0\351\200\377\1\317\23\207\0\201"
+    "\377\205\0\201\377\1\6\10\201\377\200\7\200\377\0\364\200\0\201"
+    "\377\0I\201\0\0\37\200\377\0\370\200\0\0\303\200\377\0p\202\0\0q"
+    "\200\377\0\302\217\0\4\24}\304\352\371\203\377\0\367\200\0\201\377"
+    "\0\33\202\0\0\33\200\377\0\360\201\0\0\353\200\377\0!\207\0\0\361"
+    "\200\377\0\32\202\0\0\33\201\377\200\0\0\355\200\377\200\374\0\375"
+    "\200\376\201\377\0\360\204\0\201\377\205\0\0\355\200\377\0\34\202"
+    "\0\0\35\201\377\201\0\201\377\0\11\201\0\0\1\201\377\205\0\201\377"
+    "\212\0\201\377\204\0\204\377\1\336\14\207\0\201\377\205\0\201\377"
+    "\200\0\201\377\200\0\200\377\0\375\200\0\201\377\0\11\201\0\0\2"
+    "\201\377\200\0\0\355\200\377\0\31\202\0\0\32\200\377\0\355\216\0\1"
+    "*\351\210\377\200\0\201\377\0\4\202\0\0\4\200\377\0\374\201\0\0"
+    "\373\200\377\0\4\207\0\0\374\200\377\0\3\202\0\0\4\201\377\200\0\0"
+    "\373\210\377\0\376\204\0\201\377\205\0\0\374\200\377\0\4\202\0\0\5"
+    "\201\377\201\0\201\377\203\0\201\377\205\0\201\377\212\0\201\377"
+    "\204\0\202\377\0\374\200\377\0\230\207\0\201\377\205\0\201\377\200"
+    "\0\201\377\200\0\201\377\200\0\201\377\203\0\201\377\200\0\0\373"
+    "\200\377\0\3\202\0\0\4\200\377\0\373\216\0\0\267\211\377\200\0\201"
+    "\377\0\33\202\0\0\32\200\377\0\360\201\0\0\355\200\377\0 \207\0\0"
+    "\361\200\377\0\32\202\0\0\33\201\377\200\0\0\360\211\377\204\0\201"
+    "\377\205\0\0\362\200\377\0\34\202\0\0\35\201\377\201\0\201\377\203"
+    "\0\201\377\205\0\201\377\212\0\201\377\204\0\201\377\1\225Q\201"
+    "\377\0F\206\0\0\376\200\377\0\1\204\0\201\377\200\0\201\377\200\0"
+    "\201\377\200\0\201\377\203\0\201\377\200\0\0\355\200\377\0\31\202"
+    "\0\0\32\200\377\0\355\216\0\0\363\200\377\5v'\15\3\0\30\201\377"
+    "\200\0\201\377\0t\202\0\0r\200\377\0\316\201\0\0\277\200\377\0\216"
+    "\207\0\0\317\200\377\0q\202\0\0t\201\377\200\0\0\312\200\377\0\31"
+    "\214\0\201\377\205\0\0\316\200\377\0x\202\0\0|\201\377\201\0\201"
+    "\377\203\0\201\377\205\0\201\377\212\0\201\377\204\0\201\377\200\0"
+    "\0\253\200\377\1\343\17\205\0\0\363\200\377\0\35\204\0\201\377\200"
+    "\0\201\377\200\0\201\377\200\0\201\377\203\0\201\377\200\0\0\303"
+    "\200\377\0p\202\0\0q\200\377\0\302\216\0\0\363\200\377\5_\22\2\21I"
+    "\313\201\377\200\0\201\377\5\367e\16\15b\366\200\377\0\216\201\0\0"
+    "h\201\377\1\232/\200\7\2#`\303\200\0\0\217\200\377\5\366b\15\16f"
+    "\367\201\377\200\0\0\200\200\377\7\305@\16\2\20\65v\317\205\0\201"
+    "\377\205\0\0\210\200\377\5\371i\16\17l\372\201\377\201\0\201\377"
+    "\203\0\201\377\205\0\201\377\212\0\201\377\204\0\201\377\200\0\1"
+    "\30\357\200\377\0\240\205\0\0\324\200\377\1\241\24\203\0\201\377"
+    "\200\0\201\377\200\0\201\377\200\0\201\377\203\0\201\377\200\0\0r"
+    "\200\377\1\366b\200\15\1b\366\200\377\0r\216\0\0\266\205\377\0\375"
+    "\201\377\200\0\201\377\0\366\204\377\1\372&\201\0\1\6\320\207\377"
+    "\200\0\1'\372\204\377\0\366\201\377\200\0\1\26\354\207\377\205\0"
+    "\201\377\205\0\1\36\364\210\377\201\0\201\377\203\0\201\377\201\0"
+    "\211\377\206\0\201\377\204\0\201\377\201\0\0d\201\377\0M\204\0\0"
+    "\230\205\377\200\0\201\377\200\0\201\377\200\0\201\377\200\0\201"
+    "\377\203\0\201\377\200\0\1\15\337\206\377\1\336\14\216\0\1+\355"
+    "\204\377\0r\201\377\200\0\201\377\0n\204\377\0l\203\0\1\33\313\206"
+    "\377\201\0\0l\204\377\0j\201\377\201\0\1=\355\206\377\205\0\201"
+    "\377\206\0\1V\373\203\377\0\241\201\377\201\0\201\377\203\0\201"
+    "\377\201\0\211\377\206\0\201\377\204\0\201\377\201\0\1\1\300\200"
+    "\377\1\350\23\203\0\1)\366\204\377\200\0\201\377\200\0\201\377\200"
+    "\0\201\377\200\0\201\377\203\0\201\377\201\0\1-\345\204\377\1\345-"
+    "\220\0\7\35\224\333\371\367\304J\0\201\377\200\0\201\377\6\0Y\316"
+    "\372\360\274F\205\0\10\5]\265\347\372\366\331\234;\202\0\6G\274"
+    "\360\372\316V\0\201\377\202\0\10\30\205\317\362\374\355\310\212\62"
+    "\205\0\201\377\207\0\6\63\256\353\374\336\177\7\200\377\0\370\201"
+    "\0\201\377\203\0\201\377\201\0\211\377\205\0\0\4\200\377\0\375\204"
+    "\0\201\377\202\0\1&\367\200\377\0\251\204\0\2\71\273\362\202\377"
+    "\200\0\201\377\200\0\201\377\200\0\201\377\200\0\201\377\203\0\201"
+    "\377\202\0\2\22\204\323\200\365\2\323\204\22\354\0\0/\200\377\0"
+    "\343\241\0\0\37\200\377\0\362\377\0\253\0\7\315s\65\21\3\14D\324"
+    "\200\377\0\255\240\0\1\16\231\200\377\0\325\377\0\253\0\210\377\0G"
+    "\235\0\205\377\0\233\377\0\253\0\207\377\0\207\236\0\204\377\1\372"
+    "\60\377\0\253\0\10\62\213\313\360\374\363\330\240=\237\0\202\377\2"
+    "\366\306D\377\0\377\0\377\0\377\0\377\0\377\0\377\0\377\0\377\0"
+    "\377\0\277\0\5\7\201\322\363\376\377\206\0\201\377\206\0\5\377\376"
+    "\363\323\202\7\334\0\201\377\336\0\0\207\203\377\206\0\201\377\206"
+    "\0\203\377\0\206\334\0\201\377\336\0\0\332\200\377\1v\6\207\0\201"
+    "\377\207\0\1\7{\200\377\0\331\334\0\201\377\336\0\0\370\200\377\0"
+    "\22\210\0\201\377\210\0\0\24\200\377\0\366\334\0\201\377\336\0\201"
+    "\377\0\1\210\0\201\377\210\0\0\2\201\377\240\0\201\377\6\0Y\316"
+    "\371\357\272F\204\0\6F\272\357\371\315V\0\201\377\202\0\201\377\6"
+    "\0\77\270\361\370\303O\202\0\10\31\210\317\362\374\357\311\212\62"
+    "\202\0\210\377\202\0\201\377\203\0\201\377\200\0\0\331\200\377\0"
+    "\231\202\0\0\231\200\377\4\330\0\351\377\356\206\0\4\357\377\351\0"
+    "\247\201\377\0G\200\0\0K\201\377\0\247\200\0\0\320\200\377\0\302"
+    "\202\0\0\274\200\377\0\323\200\0\211\377\206\0\201\377\211\0\201"
+    "\377\211\0\201\377\240\0\201\377\0m\204\377\0k\202\0\0l\204\377\0j"
+    "\201\377\202\0\201\377\1X\375\203\377\201\0\1\61\355\206\377\202\0"
+    "\210\377\202\0\201\377\203\0\201\377\200\0\0\213\200\377\0\333\202"
+    "\0\0\334\200\377\2\212\0\274\200\377\0\25\204\0\0\26\200\377\3\273"
+    "\0\21\344\200\377\0\314\200\1\0\317\200\377\1\345\21\200\0\0o\200"
+    "\377\1\375\30\200\0\1\14\371\200\377\0z\200\0\211\377\206\0\201"
+    "\377\211\0\201\377\211\0\201\377\240\0\201\377\0\366\204\377\1\371"
+    "&\200\0\1'\372\204\377\0\365\201\377\202\0\201\377\0\355\204\377"
+    "\201\0\0\302\207\377\202\0\210\377\202\0\201\377\203\0\201\377\200"
+    "\0\0<\201\377\0\35\200\0\0\36\201\377\2;\0\216\200\377\0<\204\0\0="
+    "\200\377\0\215\200\0\1D\376\200\377\1TW\201\377\0H\201\0\1\24\372"
+    "\200\377\0k\200\0\0N\201\377\0\42\200\0\210\377\0\350\205\0\0\14"
+    "\200\377\0\375\211\0\201\377\211\0\0\375\200\377\0\13\237\0\201"
+    "\377\5\370h\17\16d\367\200\377\0\216\200\0\0\217\200\377\5\367d\16"
+    "\17h\370\201\377\202\0\202\377\5\226\60\10\14=\255\201\0\0\370\200"
+    "\377\6e\22\2\17\63q\314\205\0\201\377\206\0\201\377\203\0\201\377"
+    "\200\0\1\2\353\200\377\0`\200\0\0a\200\377\3\352\2\0a\200\377\2b\0"
+    "v\200\377\2x\0d\200\377\0`\201\0\0\221\200\377\200\330\200\377\0"
+    "\227\203\0\0\256\200\377\0\300\200\0\0\226\200\377\0\311\206\0\1"
+    "\13\312\200\377\1\364\63\205\0\0B\200\377\0\353\211\0\201\377\211"
+    "\0\0\354\200\377\0@\203\0\13N\262\352\374\353\267p+\10\20N\300\216"
+    "\0\201\377\0u\202\0\0t\200\377\0\316\200\0\0\317\200\377\0s\202\0"
+    "\0v\201\377\202\0\201\377\0\206\207\0\0\351\200\377\4\272~P%\1\207"
+    "\0\201\377\206\0\201\377\203\0\201\377\201\0\0\237\200\377\0\242"
+    "\200\0\0\243\200\377\0\236\200\0\0\63\200\377\2\211\0\251\200\377"
+    "\2\252\0\213\200\377\0\62\201\0\1\10\326\202\377\1\333\13\203\0\0N"
+    "\200\377\3\375\30\0\336\200\377\0q\205\0\1\4\265\200\377\1\373I"
+    "\204\0\2\13@\327\200\377\0\255\211\0\201\377\211\0\0\256\200\377\2"
+    "\324\77\13\201\0\212\377\216\0\201\377\0\33\202\0\0\33\200\377\0"
+    "\360\200\0\0\361\200\377\0\32\202\0\0\33\201\377\202\0\201\377\0"
+    "\36\207\0\0\212\204\377\2\354\234 \205\0\201\377\206\0\201\377\203"
+    "\0\201\377\201\0\0Q\200\377\0\344\200\0\0\345\200\377\0P\200\0\5"
+    "\11\374\377\257\0\334\200\377\5\333\0\261\377\374\10\202\0\1\62"
+    "\372\200\377\1\374\71\204\0\1\4\350\200\377\1j'\200\377\1\375\32"
+    "\205\0\0\233\201\377\0b\204\0\202\377\2\371\264\33\211\0\201\377"
+    "\211\0\2\33\264\371\202\377\200\0\212\377\216\0\201\377\0\4\202\0"
+    "\0\4\200\377\0\374\200\0\0\374\200\377\0\3\202\0\0\4\201\377\202\0"
+    "\201\377\0\4\207\0\2\5\216\370\204\377\1\360-\204\0\201\377\206\0"
+    "\201\377\203\0\201\377\201\0\1\13\367\200\377\1'(\200\377\1\366\12"
+    "\201\0\13\330\377\326\20\377\342\343\376\16\330\377\327\203\0\1\5"
+    "\334\200\377\1\344\10\205\0\0\214\200\377\1\276p\200\377\0\300\205"
+    "\0\0\177\201\377\0~\205\0\202\377\2\370\256\27\211\0\201\377\211\0"
+    "\2\27\255\370\202\377\200\0\13\270L\22\3\33V\237\335\372\356\266O"
+    "\216\0\201\377\0\33\202\0\0\32\200\377\0\360\200\0\0\361\200\377\0"
+    "\32\202\0\0\33\201\377\202\0\201\377\212\0\4\22W\200\250\332\201"
+    "\377\0\267\204\0\201\377\206\0\201\377\0\1\201\0\0\11\201\377\202"
+    "\0\0\264\200\377\1ij\200\377\0\263\202\0\13\253\377\371E\377\252"
+    "\253\377C\372\377\252\203\0\0~\202\377\0\206\205\0\0,\200\377\1"
+    "\374\314\200\377\0g\204\0\0b\201\377\0\233\207\0\2\13\77\324\200"
+    "\377\0\250\211\0\201\377\211\0\0\251\200\377\2\322>\13\235\0\201"
+    "\377\0t\202\0\0r\200\377\0\316\200\0\0\320\200\377\0q\202\0\0t\201"
+    "\377\202\0\201\377\217\0\0:\200\377\0\362\204\0\0\376\200\377\0\3"
+    "\205\0\0\371\200\377\0\34\201\0\0F\201\377\202\0\0e\200\377\1\253"
+    "\254\200\377\0d\202\0\0}\200\377\5\230\377rs\377\226\200\377\0|"
+    "\202\0\7(\370\377\372\374\377\372-\205\0\0\313\202\377\1\373\23"
+    "\203\0\1I\373\200\377\1\264\3\211\0\0=\200\377\0\352\211\0\201\377"
+    "\211\0\0\352\200\377\0;\237\0\201\377\5\367e\16\15b\366\200\377\0"
+    "\216\200\0\0\220\200\377\5\366b\15\16f\367\201\377\202\0\201\377"
+    "\210\0\7\325\206I \10\2\26l\200\377\0\370\204\0\0\361\200\377\1"
+    "\134\3\204\0\0\336\200\377\4\245\31\5>\337\201\377\202\0\2\30\376"
+    "\377\200\354\2\377\376\27\202\0\0P\200\377\5\354\377;<\377\352\200"
+    "\377\0O\201\0\1\1\302\200\377\1\237\246\200\377\1\307\2\204\0\0k"
+    "\202\377\0\266\203\0\1\64\364\200\377\1\312\13\212\0\0\12\200\377"
+    "\0\375\211\0\201\377\211\0\0\375\200\377\0\11\237\0\201\377\0\370"
+    "\204\377\1\371&\200\0\1(\372\204\377\0\370\201\377\202\0\201\377"
+    "\210\0\210\377\0\310\204\0\0\307\204\377\202\0\0\234\204\377\0\370"
+    "\201\377\203\0\0\310\202\377\0\307\203\0\0\42\201\377\3\372\10\11"
+    "\372\201\377\0!\201\0\0h\200\377\2\376+.\201\377\0k\204\0\1\21\370"
+    "\201\377\0]\203\0\0\350\210\377\206\0\201\377\211\0\201\377\211\0"
+    "\201\377\240\0\201\377\0k\204\377\0i\202\0\0m\204\377\0j\201\377"
+    "\202\0\201\377\210\0\207\377\1\364;\204\0\0i\204\377\202\0\1$\362"
+    "\203\377\0\205\201\377\203\0\0z\202\377\0y\203\0\1\1\363\200\377\0"
+    "\313\200\0\0\314\200\377\1\362\1\200\0\1\32\360\200\377\0\264\200"
+    "\0\0\265\200\377\1\361\33\204\0\0\252\200\377\1\367\15\203\0\211"
+    "\377\206\0\201\377\211\0\201\377\211\0\201\377\240\0\201\377\6\0W"
+    "\320\373\356\267C\204\0\6D\267\356\373\320W\0\201\377\202\0\201"
+    "\377\210\0\11)w\263\336\366\375\361\317\217\42\205\0\4\1k\314\363"
+    "\376\200\377\203\0\6-\261\357\373\326m\1\201\377\203\0\0+\202\377"
+    "\0+\204\0\0\307\200\377\0\223\200\0\0\224\200\377\0\306\201\0\0"
+    "\256\201\377\0>\200\0\0<\201\377\0\257\204\0\0\226\200\377\0\254"
+    "\204\0\211\377\206\0\201\377\0\1\210\0\201\377\210\0\0\2\201\377"
+    "\240\0\201\377\222\0\201\377\345\0\1\7\354\200\377\0T\227\0\0\370"
+    "\200\377\0\23\210\0\201\377\210\0\0\25\200\377\0\366\240\0\201\377"
+    "\222\0\201\377\344\0\1\14\213\200\377\1\362\11\227\0\0\331\200\377"
+    "\1u\6\207\0\201\377\207\0\1\7|\200\377\0\330\240\0\201\377\222\0"
+    "\201\377\343\0\203\377\0\227\230\0\0\206\203\377\206\0\201\377\206"
+    "\0\203\377\0\205\240\0\201\377\222\0\201\377\343\0\202\377\1\356"
+    "\33\230\0\5\7\202\323\364\376\377\206\0\201\377\206\0\5\377\376"
+    "\364\323\203\7\240\0\201\377\222\0\201\377\343\0\200\377\2\375\316"
+    "\66\247\0\201\377\377\0\332\0\201\377\255\0"
 };
 #endif
@@ -1,4 +1,4 @@
-/* This file has been generated by makefont.py */
+/* This file has been generated by makefont.py and rle-font.py */
 
 #ifndef __FONT_32__
 #define __FONT_32__
@@ -6,5027 +6,1826 @@
 static const struct {
     unsigned int width;
     unsigned int height;
-    unsigned char data[304*444+1];
+    unsigned int length;
+    unsigned char data[37770+1];
 } font_32 = {
-    304, 444,
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\1\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\266\377\275\0\0\0\0\0\0\0\0\0\0\0\276\377\266\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\377\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\21\375\377\155"
-    "\0\0\0\303\377\265\0\0\0\0\0\0\0\0\0\0\0\377\377\2\0\0\0\0\0\0\0\0"
-    "\0\0\125\304\364\363\277\115\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\110\255"
-    "\344\371\364\316\214\62\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\113\377\377\70\0\0\0\0\0\0\0\0\0"
-    "\0\0\72\377\377\112\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\73\377"
-    "\377\304\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\377\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\123\377\377\50\0\0\15\373\377\157\0\0\0\0"
-    "\0\0\0\0\0\0\0\377\377\3\0\0\0\0\0\0\0\0\0\220\377\377\377\377\377"
-    "\377\207\0\0\0\0\0\0\0\0\0\0\0\0\0\2\232\377\377\377\377\377\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\1\322\377\276\0\0\0\0\0\0\0\0\0\0\0\0\0\301\377\320\1\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\262\377\377\116\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\377\377\377\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\230\377\343\0\0\0\115\377\377\52\0\0\0\0\0\0\0\12\154\276\355"
-    "\377\377\363\325\250\155\46\0\0\0\0\126\377\367\152\17\20\154\370"
-    "\377\114\0\0\0\0\0\0\0\0\0\0\0\0\153\377\377\377\377\377\377\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\125\377\377\113\0\0\0\0\0\0\0\0\0\0\0\0\0\116\377\377\123"
-    "\0\0\0\0\0\0\0\0\0\0\0\141\223\12\0\0\0\377\377\0\0\0\12\223\140\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\51\376\377\326\1\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\377\377\377\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\334\377\237\0\0\0\223\377\344\0\0\0\0\0\0\0\61\340"
-    "\377\377\377\377\377\377\377\377\377\377\0\0\0\0\304\377\151\0\0\0"
-    "\0\154\377\275\0\0\0\0\0\0\0\0\0\0\0\0\321\377\377\330\112\15\5\40"
-    "\135\301\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\311\377\343\2\0\0\0\0\0\0\0\0\0\0\0\0\0\3\346\377\306"
-    "\0\0\0\0\0\0\0\0\0\0\0\314\377\333\73\0\0\377\377\0\0\73\333\377\313"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\236\377\377\142\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\377\377\377\0\0\0"
-    "\0\0\0\0\0\0\0\0\41\377\377\132\0\0\0\330\377\237\0\0\0\0\0\0\31\351"
-    "\377\377\377\376\377\377\377\377\377\377\377\0\0\0\0\365\377\16\0"
-    "\0\0\0\17\377\363\0\0\0\0\0\0\0\0\0\0\0\0\370\377\377\51\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\65\377\377\207\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\214\377\377\62"
-    "\0\0\0\0\0\0\0\0\0\0\22\231\375\375\213\7\377\377\10\213\375\375\230"
-    "\22\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\32\371\377"
-    "\345\6\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\377\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\146\377\376\27\0\0\35\377\377\132\0\0\0\0\0"
-    "\0\217\377\377\362\143\17\377\377\12\44\120\214\330\0\0\0\0\365\377"
-    "\16\0\0\0\0\17\377\364\0\0\0\0\0\0\0\0\0\0\0\0\355\377\377\13\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\223\377\377\66\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\74\377\377"
-    "\217\0\0\0\0\0\0\0\0\0\0\0\0\66\314\377\326\377\377\326\377\313\65"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\212\377\377"
-    "\166\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\377\377\377"
-    "\0\0\0\0\0\0\70\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\0\0\0\332\377\377\146\0\0\377\377\0\0\0\0\0\0\0\0"
-    "\0\305\377\145\0\0\0\0\154\377\303\0\0\0\0\0\0\0\0\0\0\0\0\263\377"
-    "\377\114\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\1\350\377\355\1\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\2\356\377\344\0\0\0\0\0\0\0\0\0\0\0\0\0\2\152\357\377\377\357\152"
-    "\2\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\17\361"
-    "\377\360\16\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\377"
-    "\377\377\0\0\0\0\0\0\70\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\0\0\0\370\377\377\26\0\0\377\377\0\0\0\0"
-    "\0\0\0\0\0\130\377\365\144\15\20\154\370\377\125\0\0\0\0\0\63\240"
-    "\31\0\0\0\0\106\377\377\317\5\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\62\377\377\271\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\263\377\377\55\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\2\151\356\377\377\356\150\2\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\167\377\377\211\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\377\377\377\0\0\0\377\377\377\0\0\0\0\0\0\70\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\0\0\0\363\377"
-    "\377\21\0\0\377\377\0\0\0\0\0\0\0\0\0\0\223\377\377\377\377\377\377"
-    "\217\0\0\0\4\126\304\377\375\127\0\0\0\0\0\247\377\377\224\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\160\377\377\205\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\174\377\377"
-    "\155\0\0\0\0\0\0\0\0\0\0\0\64\312\377\326\377\377\326\377\312\63\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\6\346\377\371\31"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\72\377\377\76\0\0\3\361\377\206\0\0\0\0\0\0\0\306\377\377\141"
-    "\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\130\305\365\365\304\124\0\0\23"
-    "\171\343\377\357\215\41\0\0\0\0\0\74\337\377\377\377\142\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\242\377"
-    "\377\121\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\120\377\377\240\0\0\0\0"
-    "\0\0\0\0\0\20\225\375\375\214\10\377\377\10\214\375\375\225\20\0\0"
-    "\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\143\377\377\235\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\364\377"
-    "\363\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\175\377\365\6\0\0\67\377\377\102\0\0\0\0\0\0\0\146\377\377\364"
-    "\160\25\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\56\234\366\377\325"
-    "\151\13\0\0\0\0\0\0\136\372\377\364\377\377\367\61\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\312\377\377\63"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\57\377\377\310\0\0\0\0\0\0\0\0"
-    "\0\313\377\333\73\0\0\377\377\0\0\74\334\377\312\0\0\0\0\0\0\0\0\0"
-    "\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\1\327\377\376\50\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\345\377\344\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\300\377\271"
-    "\0\0\0\170\377\367\10\0\0\0\0\0\0\0\3\265\377\377\377\376\377\377"
-    "\207\123\20\0\0\0\0\0\0\0\0\0\0\0\2\120\276\377\375\262\104\0\0\0"
-    "\0\0\0\0\0\120\375\377\250\23\322\377\377\336\20\0\0\0\5\377\377\376"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\346\377\377\41"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\25\377\377\345\0\0\0\0\0\0\0\0"
-    "\0\141\224\12\0\0\0\377\377\0\0\0\13\224\141\0\0\0\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\117\377\377\261"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\326\377\325\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\12\371\377\167\0\0\0\272\377\274\0\0\0\0\0\0\0\0\0\5\210"
-    "\367\377\377\377\377\377\377\372\247\47\0\0\0\0\0\0\0\20\163\336\377"
-    "\357\215\42\0\0\0\0\0\0\0\0\0\25\357\377\304\4\0\45\361\377\377\263"
-    "\1\0\0\1\377\377\364\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\366\377\377\20\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\11\377\377"
-    "\365\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\305\377"
-    "\377\73\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\307\377\306\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\106\377\377\65\0\0\6\365\377\171\0\0\0\0\0\0\0"
-    "\0\0\0\0\24\151\250\377\377\377\377\377\377\366\127\0\0\0\0\50\225"
-    "\364\377\325\151\13\0\0\126\305\364\362\274\107\0\0\0\204\377\377"
-    "\103\0\0\0\121\377\377\377\174\0\0\12\377\377\327\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\375\377\377\4\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\2\377\377\375\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\377\377\377\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\73\377\377\304\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\270\377"
-    "\267\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\70\0"
-    "\0\0\0\0\0\0\0\0\0\377\377\55\145\305\377\377\373\64\0\0\24\374\375"
-    "\262\105\0\0\0\0\220\377\377\377\377\377\377\173\0\0\323\377\377\11"
-    "\0\0\0\0\212\377\377\375\105\0\46\377\377\241\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\366\377\377\21\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\11\377\377\364\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377"
-    "\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\262\377\377\116\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\70\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\227\377"
-    "\377\257\0\0\0\152\42\0\0\0\0\0\126\377\366\147\16\20\156\371\377"
-    "\104\0\367\377\377\12\0\0\0\0\3\300\377\377\353\35\133\377\377\115"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\346\377\377\42"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\26\377\377\345\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\377\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\51\376\377\326\1\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\70\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\0\0\0\35\377\377\354\0\0\0\0\0\0\0\0\0\0\304\377\147\0\0\0\0"
-    "\157\377\273\0\371\377\377\72\0\0\0\0\0\27\345\377\377\310\301\377"
-    "\322\2\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\311\377"
-    "\377\63\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\60\377\377\310\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\236\377\377\142\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\42\377\377\125\0\0\0\333\377\235"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\20\377\377\367\0\0\0"
-    "\0\0\0\0\0\0\0\365\377\16\0\0\0\0\21\377\363\0\325\377\377\256\0\0"
-    "\0\0\0\0\74\373\377\377\377\366\61\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\241\377\377\123\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\122\377\377\240\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\32\371\377\345\6\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\147\377\375\22\0\0\40\377\377\130\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\0\0\0\166\377\377\322\0\0\0\0\0\0\0\0\0\0\365\377\16\0\0\0\0"
-    "\17\377\364\0\211\377\377\377\201\1\0\0\0\0\0\161\377\377\377\151"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\157\377\377"
-    "\207\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\176\377\377\155\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\212\377\377\166\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\254\377\312"
-    "\0\0\0\145\377\376\25\0\0\0\0\0\0\0\0\0\326\206\106\25\0\0\377\377"
-    "\21\71\237\376\377\377\163\0\0\0\0\0\0\0\0\0\0\307\377\146\0\0\0\0"
-    "\152\377\303\0\30\360\377\377\377\301\122\27\2\5\72\251\377\377\377"
-    "\313\2\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\61\377"
-    "\377\273\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\266\377\377\55\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\17\361\377\360\16\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\2\355\377"
-    "\205\0\0\0\253\377\317\0\0\0\0\0\0\0\0\0\0\377\377\377\377\363\343"
-    "\377\377\377\377\377\377\377\302\5\0\0\0\0\0\0\0\0\0\0\135\377\366"
-    "\146\16\17\152\367\377\122\0\0\114\372\377\377\377\377\377\376\376"
-    "\377\377\303\367\377\377\157\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\1\347\377\356\1\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\3\360"
-    "\377\345\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\167\377\377\211\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\65\377\377\77\0\0\2\355\377\212\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\242\14\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\233\377\377\377\377\377\377\213\0\0\0\0\101\343\377\377\377"
-    "\377\377\377\377\275\15\173\377\377\362\34\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\222\377\377\70\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\77\377\377\217\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\37"
-    "\377\377\377\301\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\6\346\377\371"
-    "\31\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\172\377\364\6\0\0\65\377\377\106\0\0\0\0\0\0\0"
-    "\0\0\0\43\146\234\306\345\370\377\377\356\316\221\60\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\136\310\366\364\303\122\0\0\0\0\0\0\12\150\271\351"
-    "\375\363\303\141\2\0\6\326\377\377\257\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\64\377\377\212\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\220\377\377\62\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\166\377"
-    "\377\362\41\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\143\377\377\235"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\4\377"
-    "\377\3\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\307\377\345\3\0\0\0\0\0\0\0\0\0\0\0\0\0\4\351"
-    "\377\306\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\316\377\377\144\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\1\327\377\376\50\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\3\377\377\2\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\122\377\377\116\0\0\0\0\0\0\0\0\0\0\0\0\0\122\377\377\123\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\45\377\377\265\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\117\377\377\261\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\2\377\377\1\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\1\321\377\300\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\304\377\321\1\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\175\377\355\31\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\305\377"
-    "\377\73\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\1\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\112\377\377\71\0\0\0\0\0\0\0\0\0"
-    "\0\0\73\377\377\112\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\324\377"
-    "\127\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\266\377\275\0\0\0\0\0\0\0\0\0\0\0\276\377\266\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\3\140\274\355\374\355\273"
-    "\137\2\0\0\0\0\0\0\0\0\0\31\114\177\262\346\377\377\377\0\0\0\0\0"
-    "\0\0\0\0\40\137\223\277\336\363\374\364\340\260\151\17\0\0\0\0\0\0"
-    "\0\0\40\140\230\310\352\373\363\332\244\112\1\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\16\345\377\377\377\0\0\0\0\0\0\0\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\27\174\305\356\374\360"
-    "\312\213\63\0\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\0\0\0\0\0\0\0\26\176\307\356\373\356\307\175\25\0"
-    "\0\0\0\0\0\0\0\0\0\74\237\330\362\373\350\267\140\4\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\6"
-    "\133\257\344\373\364\324\216\37\0\0\0\0\0\0\0\0\0\24\305\377\377\377"
-    "\377\377\377\377\302\22\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377\377"
-    "\357\146\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377\277"
-    "\30\0\0\0\0\0\0\0\0\0\0\0\0\0\0\225\377\377\377\377\0\0\0\0\0\0\0"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\0\0\0\0\0\0\0\0\0"
-    "\137\363\377\377\377\377\377\377\377\377\0\0\0\0\0\0\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\350\0\0\0\0\0\0\106\355\377"
-    "\377\377\377\377\377\377\353\103\0\0\0\0\0\0\0\12\245\377\377\377"
-    "\377\377\377\377\377\317\35\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\124\342\377\377\377\377\377\377"
-    "\377\363\120\0\0\0\0\0\0\0\4\306\377\377\377\377\377\377\377\377\377"
-    "\302\3\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377\0\0\0\0\0\0\0"
-    "\0\0\377\377\377\377\377\377\377\377\377\377\377\377\377\214\0\0\0"
-    "\0\0\0\377\377\377\377\377\377\377\377\377\377\377\325\12\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\67\375\371\377\377\377\0\0\0\0\0\0\0\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\0\0\0\0\0\0\0\0\151\377\377\377"
-    "\377\377\377\377\377\377\377\0\0\0\0\0\0\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\206\0\0\0\0\0\47\366\377\377\377\377"
-    "\377\377\377\377\377\365\45\0\0\0\0\0\0\252\377\377\377\377\377\377"
-    "\377\377\377\377\331\15\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\375\375\377\377"
-    "\377\370\55\0\0\0\0\0\0\157\377\377\377\221\42\4\43\223\377\377\377"
-    "\153\0\0\0\0\0\0\0\346\263\200\115\32\377\377\377\0\0\0\0\0\0\0\0"
-    "\0\343\250\167\113\54\22\6\6\41\145\337\377\377\377\112\0\0\0\0\0"
-    "\334\225\133\57\21\4\12\63\223\376\377\377\176\0\0\0\0\0\0\0\0\0\0"
-    "\0\4\320\377\210\377\377\377\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\55\372\377\377\370\204\50\5\13\54\152\307\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\36\375\377\375\41\0\0\0\0\0\241\377\377"
-    "\363\152\31\4\31\152\363\377\377\237\0\0\0\0\0\106\377\377\377\276"
-    "\110\22\4\30\130\325\377\377\210\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\372\243\112\23\0\3\76\325"
-    "\377\377\245\0\0\0\0\0\3\344\377\377\203\0\0\0\0\0\207\377\377\341"
-    "\2\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\16\316\377\377\272\0\0\0\0\0\0\0\0\0\0\0\0\0\0\166\377\377"
-    "\324\0\0\0\0\0\0\0\0\0\0\0\165\377\345\14\377\377\377\0\0\0\0\0\0"
-    "\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\264\377\377\366\73"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\204\377\377\267\0\0"
-    "\0\0\0\0\345\377\377\135\0\0\0\0\0\135\377\377\344\0\0\0\0\0\247\377"
-    "\377\266\2\0\0\0\0\0\13\315\377\361\11\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\256\40\0\0\0\0\0\0\54\377"
-    "\377\346\0\0\0\0\0\102\377\377\347\7\0\0\0\0\0\10\352\377\377\76\0"
-    "\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\100\377\377\360\0\0\0\0\0\0\0\0\0\0\0\0\0\0\22\377\377\367"
-    "\0\0\0\0\0\0\0\0\0\0\37\365\377\133\0\377\377\377\0\0\0\0\0\0\0\377"
-    "\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\37\376\377\377\160\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\4\346\377\377\120\0\0\0\0\0"
-    "\0\372\377\377\15\0\0\0\0\0\16\377\377\372\0\0\0\0\0\340\377\377\70"
-    "\0\0\0\0\0\0\0\105\377\377\117\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\17\151\315\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\315"
-    "\150\16\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\10\377"
-    "\377\373\0\0\0\0\0\204\377\377\221\0\0\0\0\0\0\0\224\377\377\202\0"
-    "\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\11\377\377\377\13\0\0\0\0\0\0\0\0\0\0\0\0\0\20\377\377\357"
-    "\0\0\0\0\0\0\0\0\0\0\264\377\304\0\0\377\377\377\0\0\0\0\0\0\0\377"
-    "\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\154\377\377\352\6\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\123\377\377\345\4\0\0\0\0\0\0"
-    "\346\377\377\13\0\0\0\0\0\14\377\377\345\0\0\0\0\0\367\377\377\11"
-    "\0\0\0\0\0\0\0\13\377\377\215\0\0\0\0\0\0\0\0\0\0\377\377\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\73\240\365\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\377\377\365\237\73\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\115\377\377\344\0\0\0\0\0\265\377\377\124\0\0"
-    "\0\0\0\0\0\126\377\377\263\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\21\377\377\377\35\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\176\377\377\261\0\0\0\0\0\0\0\0\0\125\377\375\61\0\0"
-    "\377\377\377\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\246\377\377\231\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\272\377\377\201\0\0\0\0\0\0\0\235\377\377\131\0\0\0\0\0\133\377\377"
-    "\233\0\0\0\0\0\367\377\377\11\0\0\0\0\0\0\0\13\377\377\272\0\0\0\0"
-    "\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\24\162\326\377\377\377"
-    "\377\374\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\375\377\377\377"
-    "\377\326\162\24\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\35\342\377"
-    "\377\223\0\0\0\0\0\327\377\377\53\0\0\0\0\0\0\0\55\377\377\325\0\0"
-    "\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\131\377\377\371\7\0\0\0\0\0\0\0\0\0\1\21\100\244\377\377\367"
-    "\60\0\0\0\0\0\0\0\0\16\346\377\230\0\0\0\377\377\377\0\0\0\0\0\0\0"
-    "\377\377\377\236\335\373\370\340\256\136\6\0\0\0\0\0\0\0\317\377\377"
-    "\133\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\43\376\377\374"
-    "\35\0\0\0\0\0\0\0\35\354\377\361\150\27\3\30\151\363\377\352\33\0"
-    "\0\0\0\0\340\377\377\70\0\0\0\0\0\0\0\105\377\377\332\0\0\0\0\0\0"
-    "\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\1\105\251\371\377\377\377\377\327"
-    "\170\32\0\0\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\0\0\33\170\327\377\377\377\377\371\251\105\1\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\34\335\377\377\351\26\0\0\0\0\0\356\377"
-    "\377\22\0\0\0\0\0\0\0\23\377\377\354\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\12\331\377\377\260\0\0"
-    "\0\0\0\0\0\0\377\377\377\377\377\377\377\336\75\0\0\0\0\0\0\0\0\0"
-    "\225\377\356\23\0\0\0\377\377\377\0\0\0\0\0\0\0\377\377\377\377\377"
-    "\377\377\377\377\377\336\73\0\0\0\0\0\0\353\377\377\60\0\130\303\365"
-    "\366\340\251\113\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\212\377\377\263\0\0"
-    "\0\0\0\0\0\0\0\53\316\377\377\377\377\377\377\377\316\51\0\0\0\0\0"
-    "\0\250\377\377\264\1\0\0\0\0\0\12\314\377\377\356\0\0\0\0\0\0\0\0"
-    "\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\33\174\337\377\377\377\377\356\227\67\0\0"
-    "\0\0\0\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\0\0\0\0\0\67\227\356\377\377\377\377\336\174\33\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\30\333\377\377\367\74\0\0\0\0\0\0\373\377\377\4"
-    "\0\154\353\350\147\0\0\6\377\377\371\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\1\246\377\377\375\63\0\0"
-    "\0\0\0\0\0\0\377\377\377\377\377\377\245\17\0\0\0\0\0\0\0\0\0\67\375"
-    "\377\154\0\0\0\0\377\377\377\0\0\0\0\0\0\0\377\377\377\377\377\377"
-    "\377\377\377\377\377\370\103\0\0\0\0\0\372\377\377\26\233\377\377"
-    "\377\377\377\377\377\263\15\0\0\0\0\0\0\0\0\0\0\0\0\6\352\377\377"
-    "\113\0\0\0\0\0\0\0\0\0\0\35\256\377\377\377\377\377\256\35\0\0\0\0"
-    "\0\0\0\112\377\377\377\273\106\21\3\27\127\325\354\377\377\372\0\0"
-    "\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\377\377\0\0\0\0\0\0\0\0\0\4\117\263\374\377\377\377\374\266\126"
-    "\7\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\0\0\0\0\0\0\0\7\126\266\374\377\377\377\374\263\116"
-    "\3\0\0\0\0\0\0\0\0\0\0\3\306\377\377\370\112\0\0\0\0\0\0\0\377\377"
-    "\377\0\0\366\377\377\364\0\0\1\377\377\376\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\215\377\377\377\206\0"
-    "\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\355\154\0\0\0\0\0\0\0"
-    "\4\320\377\321\3\0\0\0\0\377\377\377\0\0\0\0\0\0\0\321\175\101\32"
-    "\10\6\32\115\251\376\377\377\352\20\0\0\0\0\377\377\377\162\377\377"
-    "\377\377\377\377\377\377\377\261\0\0\0\0\0\0\0\0\0\0\0\0\131\377\377"
-    "\341\2\0\0\0\0\0\0\0\0\6\217\373\377\377\377\377\377\377\377\373\220"
-    "\6\0\0\0\0\0\0\264\377\377\377\377\377\377\377\377\377\164\377\377"
-    "\376\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\206\346\377\377\377\377\324\165\30\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\31"
-    "\165\324\377\377\377\377\346\206\0\0\0\0\0\0\0\0\0\145\377\377\374"
-    "\115\0\0\0\0\0\0\0\0\373\377\377\4\0\165\355\352\154\0\0\6\377\377"
-    "\372\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\1\220\377\377\377\270\3\0\0\0\0\0\0\0\0\0\0\0\2\21\73\215\365"
-    "\377\377\223\0\0\0\0\0\0\165\377\377\77\0\0\0\0\0\377\377\377\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\111\367\377\377\167\0\0\0\0\373\377\377"
-    "\354\325\131\30\4\22\110\300\377\377\377\110\0\0\0\0\0\0\0\0\0\0\0"
-    "\300\377\377\174\0\0\0\0\0\0\0\0\1\257\377\377\314\120\25\4\26\123"
-    "\317\377\377\261\1\0\0\0\0\0\16\265\377\377\377\377\377\377\377\235"
-    "\27\377\377\370\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\355\224\64\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\65\224\355\377\377\377\0\0\0\0\0\0\0\0\0\300\377\377\204"
-    "\0\0\0\0\0\0\0\0\0\356\377\377\21\0\0\0\0\0\0\0\23\377\377\354\0\0"
-    "\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\5\243"
-    "\377\377\377\277\12\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\47\344\377\377"
-    "\114\0\0\0\0\37\365\377\251\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\173\377\377\306\0\0\0\0\360\377\377\314\12\0"
-    "\0\0\0\0\2\271\377\377\247\0\0\0\0\0\0\0\0\0\0\50\377\377\373\31\0"
-    "\0\0\0\0\0\0\0\132\377\377\303\6\0\0\0\0\0\7\306\377\377\133\0\0\0"
-    "\0\0\0\1\115\252\341\367\366\304\131\0\61\377\377\351\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\377\377\377\347\214\55\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\55\214\347\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\355\377\377\35\0\0\0\0\0\0\0\0\0\327\377\377"
-    "\53\0\0\0\0\0\0\0\55\377\377\325\0\0\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\14\270\377\377\377\261\11\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\123\377\377\271\0\0\0\0\264\377\365\35\0"
-    "\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\40\377\377"
-    "\357\0\0\0\0\333\377\377\104\0\0\0\0\0\0\0\72\377\377\337\0\0\0\0"
-    "\0\0\0\0\0\0\220\377\377\256\0\0\0\0\0\0\0\0\0\273\377\377\77\0\0"
-    "\0\0\0\0\0\101\377\377\274\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\134\377\377"
-    "\316\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\206\346\377\377\377\377\316\157\25\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\26"
-    "\160\317\377\377\377\377\346\206\0\0\0\0\0\0\0\0\0\376\377\377\2\0"
-    "\0\0\0\0\0\0\0\0\265\377\377\124\0\0\0\0\0\0\0\125\377\377\263\0\0"
-    "\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\27\315\377"
-    "\377\377\222\3\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\15\377\377\356"
-    "\0\0\0\0\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\6\377\377\375\0\0\0\0\274\377\377"
-    "\13\0\0\0\0\0\0\0\11\377\377\366\0\0\0\0\0\0\0\0\0\10\356\377\377"
-    "\106\0\0\0\0\0\0\0\0\0\356\377\377\11\0\0\0\0\0\0\0\12\377\377\355"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\232\377\377\245\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\4"
-    "\120\264\374\377\377\377\373\262\123\6\0\0\0\0\0\0\0\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\0\0\0\0\0\0\0"
-    "\7\123\262\373\377\377\377\374\264\117\4\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\204\377\377\220\0\0\0\0\0\0\0\223\377\377"
-    "\202\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\46"
-    "\336\377\377\370\143\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\16"
-    "\377\377\374\0\0\0\0\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\36\377\377\357\0\0\0"
-    "\0\217\377\377\13\0\0\0\0\0\0\0\11\377\377\366\0\0\0\0\0\0\0\0\0\137"
-    "\377\377\335\1\0\0\0\0\0\0\0\0\0\373\377\377\13\0\0\0\0\0\0\0\13\377"
-    "\377\374\0\0\0\0\0\0\0\0\0\0\0\0\0\0\7\352\377\377\154\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\33\175\337\377\377\377\377\355\225\67\0\0\0\0\0\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\0\0\0"
-    "\0\0\67\226\356\377\377\377\377\337\175\33\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\377\377\377\0\0\0\0\0\0\0\0\0\0\102\377\377\346\6\0\0\0\0\0\7\351"
-    "\377\377\77\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0"
-    "\0\72\354\377\377\336\63\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\121\377\377\346\0\0\0\0\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\164\377\377\304"
-    "\0\0\0\0\121\377\377\104\0\0\0\0\0\0\0\72\377\377\336\0\0\0\0\0\0"
-    "\0\0\0\306\377\377\170\0\0\0\0\0\0\0\0\0\0\351\377\377\102\0\0\0\0"
-    "\0\0\0\100\377\377\354\0\0\0\0\0\0\0\0\0\0\0\0\0\0\160\377\377\376"
-    "\37\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\1\106\252\371\377\377\377\377\330"
-    "\171\35\0\0\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\0\0\35\171\330\377\377\377\377\371\252\106\1\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\3\345\377\377\201"
-    "\0\0\0\0\0\205\377\377\342\2\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0"
-    "\0\0\0\0\0\0\0\0\122\367\377\377\255\20\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\34\335\377\377\252\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\73\362\377\377\163\0"
-    "\0\0\0\12\363\377\314\12\0\0\0\0\0\2\267\377\377\244\0\0\0\0\0\0\0"
-    "\0\56\377\377\372\26\0\0\0\0\0\0\0\0\0\0\265\377\377\307\7\0\0\0\0"
-    "\0\5\302\377\377\270\0\0\0\0\0\0\0\0\0\0\0\0\0\72\365\377\377\264"
-    "\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\24\163\327\377"
-    "\377\377\377\375\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\375\377"
-    "\377\377\377\326\163\24\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\161\377\377\377\217\41\3\42\221\377\377\377"
-    "\155\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\160\375"
-    "\377\367\152\0\0\0\0\0\0\0\0\0\0\0\0\0\0\335\232\145\70\32\11\2\16"
-    "\65\200\356\377\377\377\76\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\0\0\0\0\0\0\333\224\135\62\25\7\4\25\104\233\373\377\377\345\15\0"
-    "\0\0\0\0\213\377\377\325\130\27\3\21\106\275\377\377\377\102\0\0\0"
-    "\0\0\0\0\0\226\377\377\251\0\0\0\0\0\0\0\0\0\0\0\125\377\377\377\316"
-    "\122\24\3\24\117\312\377\377\377\127\0\0\0\0\0\0\307\147\51\11\4\47"
-    "\203\367\377\377\372\56\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\74\241\365\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\377\377\365\240\74\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\5\311\377\377\377\377\377"
-    "\377\377\377\377\305\4\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\0\0\0\0\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\50\0\0\0\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\211\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0"
-    "\0\0\0\0\377\377\377\377\377\377\377\377\377\377\377\377\363\71\0"
-    "\0\0\0\0\0\16\333\377\377\377\377\377\377\377\377\377\377\246\0\0"
-    "\0\0\0\0\0\0\13\361\377\377\102\0\0\0\0\0\0\0\0\0\0\0\0\262\377\377"
-    "\377\377\377\377\377\377\377\377\377\263\1\0\0\0\0\0\0\377\377\377"
-    "\377\377\377\377\377\377\377\154\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\17\152\316\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\316\151\17\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\25\310\377\377\377\377"
-    "\377\377\377\305\23\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\0\0\0\0\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\50\0\0\0\377\377\377\377\377\377\377\377\377"
-    "\377\377\362\153\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0"
-    "\0\0\0\377\377\377\377\377\377\377\377\377\377\377\317\57\0\0\0\0"
-    "\0\0\0\0\40\322\377\377\377\377\377\377\377\377\243\11\0\0\0\0\0\0"
-    "\0\0\145\377\377\331\0\0\0\0\0\0\0\0\0\0\0\0\0\11\241\377\377\377"
-    "\377\377\377\377\377\377\235\11\0\0\0\0\0\0\0\377\377\377\377\377"
-    "\377\377\377\364\141\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\37\377\377\377\301\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\3\142\276\356\375\356\275\140\3\0\0\0\0"
-    "\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377\377\377\377\0\0"
-    "\0\0\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\50"
-    "\0\0\0\41\142\227\303\341\364\375\364\340\262\155\22\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\52\166\255\323\355\371"
-    "\375\363\325\237\114\1\0\0\0\0\0\0\0\0\0\0\5\143\271\351\374\364\331"
-    "\237\74\0\0\0\0\0\0\0\0\0\0\314\377\377\163\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\65\226\321\360\374\360\321\225\63\0\0\0\0\0\0\0\0\0\64\217"
-    "\316\362\375\357\306\176\27\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\166\377\377\362\41\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\316\377"
-    "\377\144\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\45\377\377\265\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\175\377\355\31\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\324\377\127"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\23\374\377\377\374\22\0\0\0\0\0"
-    "\0\0\0\0\377\377\377\377\377\377\377\364\337\257\137\10\0\0\0\0\0"
-    "\0\0\0\0\0\0\53\212\311\355\374\363\310\167\21\0\0\0\0\0\377\377\377"
-    "\377\377\367\343\276\203\57\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\0\0\0\0\0\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\0\0\0\0\0\0\0\0\0\64\222\317"
-    "\361\374\357\301\160\17\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\377"
-    "\377\377\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377\377\0\0\0\0"
-    "\0\0\377\377\377\0\0\0\0\0\0\0\0\1\235\377\377\352\51\0\0\0\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\204\0\0\0\0\0\0\0"
-    "\205\377\377\377\377\0\0\0\377\377\377\377\56\0\0\0\0\0\0\0\377\377"
-    "\377\0\0\0\0\0\0\0\0\107\250\340\372\371\337\246\105\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\37\163\276\336\366\362\325\226\54\0\0\0\0\0\0\0\0\0\0\136"
-    "\377\377\377\377\135\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377"
-    "\377\377\377\377\333\61\0\0\0\0\0\0\0\0\16\241\376\377\377\377\377"
-    "\377\377\377\356\136\0\0\0\0\377\377\377\377\377\377\377\377\377\377"
-    "\267\41\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\0\0\0\0\0\0\0\24\254\377\377\377\377\377\377\377\377"
-    "\355\134\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0"
-    "\0\377\377\377\377\377\377\377\377\377\377\377\377\377\0\0\0\0\0\0"
-    "\0\0\0\377\377\377\377\377\377\377\377\377\0\0\0\0\0\0\377\377\377"
-    "\0\0\0\0\0\0\0\0\225\377\377\355\56\0\0\0\0\377\377\377\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\377\377\377\377\334\0\0\0\0\0\0\0\336\377\377\377"
-    "\377\0\0\0\377\377\377\377\232\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0"
-    "\0\14\260\377\377\377\377\377\377\377\377\256\12\0\0\0\0\0\0\0\0\13"
-    "\214\373\377\377\377\377\377\377\377\376\210\2\0\0\0\0\0\0\0\0\255"
-    "\377\377\377\377\254\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\355\32\0\0\0\0\0\0\24\323\377\377\377\377\377"
-    "\377\377\377\377\377\377\0\0\0\0\377\377\377\377\377\377\377\377\377"
-    "\377\377\356\65\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\0\0\0\0\0\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\0\0\0\0\0\0\32\333\377\377\377\377\377\377\377"
-    "\377\377\377\377\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377\377\377\377\0\0"
-    "\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377\377\0\0\0\0\0\0\377"
-    "\377\377\0\0\0\0\0\0\0\214\377\377\360\64\0\0\0\0\0\377\377\377\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\371\377\67\0\0\0\0\0\72\377"
-    "\371\377\377\377\0\0\0\377\377\377\377\365\21\0\0\0\0\0\0\377\377"
-    "\377\0\0\0\0\0\2\273\377\377\377\377\377\377\377\377\377\377\267\2"
-    "\0\0\0\0\0\0\26\324\377\375\251\122\42\10\16\76\242\377\377\214\0"
-    "\0\0\0\0\0\0\10\364\377\377\377\377\363\7\0\0\0\0\0\0\0\0\377\377"
-    "\377\0\0\0\0\11\47\162\361\377\377\225\0\0\0\0\0\3\303\377\377\375"
-    "\237\101\21\3\22\103\227\366\377\0\0\0\0\377\377\377\0\0\11\41\117"
-    "\236\371\377\377\347\25\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\5\313\377"
-    "\377\373\227\73\16\4\27\107\221\362\377\0\0\0\0\377\377\377\0\0\0"
-    "\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\377\377\377"
-    "\0\0\0\0\0\0\203\377\377\363\72\0\0\0\0\0\0\377\377\377\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\377\377\377\262\377\220\0\0\0\0\0\224\377\261\377"
-    "\377\377\0\0\0\377\377\377\377\377\163\0\0\0\0\0\0\377\377\377\0\0"
-    "\0\0\0\152\377\377\377\250\70\14\16\72\251\377\377\377\145\0\0\0\0"
-    "\0\21\325\377\330\66\0\0\0\0\0\0\0\132\376\377\63\0\0\0\0\0\0\113"
-    "\377\377\330\331\377\377\112\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0"
-    "\0\0\121\377\377\336\0\0\0\0\0\155\377\377\365\103\0\0\0\0\0\0\0\26"
-    "\252\0\0\0\0\377\377\377\0\0\0\0\0\0\51\337\377\377\232\0\0\0\0\0"
-    "\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\164\377\377\362\73\0\0\0\0\0\0\0\24\244\0"
-    "\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0"
-    "\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\0\0\0\0\0\0\377\377\377\0\0\0\0\0\172\377\377\366\77\0\0\0\0\0\0"
-    "\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\131\377\346"
-    "\2\0\0\0\4\351\377\130\377\377\377\0\0\0\377\377\377\320\377\335\2"
-    "\0\0\0\0\0\377\377\377\0\0\0\0\2\342\377\377\213\0\0\0\0\0\0\213\377"
-    "\377\337\1\0\0\0\0\237\377\331\27\0\0\0\0\0\0\0\0\0\227\377\236\0"
-    "\0\0\0\0\0\232\377\377\211\212\377\377\231\0\0\0\0\0\0\0\0\377\377"
-    "\377\0\0\0\0\0\0\0\11\377\377\371\0\0\0\0\5\346\377\377\140\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\62\375\377\371\23"
-    "\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\7\351\377\377\132\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0"
-    "\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\0\0\0\0\0\0\377\377\377\0\0\0\0\160\377\377\370\106\0\0\0\0\0"
-    "\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\13\364"
-    "\377\103\0\0\0\110\377\365\13\377\377\377\0\0\0\377\377\377\144\377"
-    "\377\114\0\0\0\0\0\377\377\377\0\0\0\0\100\377\377\343\5\0\0\0\0\0"
-    "\0\6\343\377\377\75\0\0\0\101\377\370\47\0\0\0\0\0\0\0\0\0\0\63\377"
-    "\334\0\0\0\0\0\1\347\377\377\72\73\377\377\346\1\0\0\0\0\0\0\0\377"
-    "\377\377\0\0\0\0\0\0\0\22\377\377\360\0\0\0\0\112\377\377\326\1\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\265\377\377"
-    "\142\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\116\377\377\323\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0"
-    "\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\377\0\0\0\0\0\0\377\377\377\0\0\0\150\377\377\372\114\0\0\0\0"
-    "\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\246"
-    "\377\234\0\0\0\242\377\247\0\377\377\377\0\0\0\377\377\377\11\356"
-    "\377\271\0\0\0\0\0\377\377\377\0\0\0\0\203\377\377\213\0\0\0\0\0\0"
-    "\0\0\214\377\377\201\0\0\0\264\377\202\0\0\0\0\3\153\311\363\362\310"
-    "\150\15\377\365\0\0\0\0\0\70\377\377\351\2\2\351\377\377\67\0\0\0"
-    "\0\0\0\0\377\377\377\0\0\0\0\0\0\0\151\377\377\274\0\0\0\0\221\377"
-    "\377\175\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0"
-    "\147\377\377\237\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\223\377\377\173\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\377\377\377\0\0\0\0\0\0\377\377\377\0\0\137\376\377\374\123"
-    "\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\0\115\377\357\6\0\11\362\377\116\0\377\377\377\0\0\0\377\377"
-    "\377\0\213\377\376\46\0\0\0\0\377\377\377\0\0\0\0\265\377\377\120"
-    "\0\0\0\0\0\0\0\0\121\377\377\263\0\0\35\374\371\24\0\0\0\16\301\377"
-    "\377\377\377\377\377\263\377\377\0\0\0\0\0\207\377\377\235\0\0\235"
-    "\377\377\206\0\0\0\0\0\0\0\377\377\377\0\0\0\0\12\54\201\371\377\377"
-    "\113\0\0\0\0\303\377\377\101\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\0\0\0\0\0\0\0\0\66\377\377\313\0\0\0\0\0\377\377\377\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\305\377\377\100\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0"
-    "\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\377\377\377\0"
-    "\127\374\377\375\132\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\377\377\377\0\6\356\377\117\0\126\377\357\6\0\377"
-    "\377\377\0\0\0\377\377\377\0\41\375\377\222\0\0\0\0\377\377\377\0"
-    "\0\0\0\327\377\377\50\0\0\0\0\0\0\0\0\52\377\377\326\0\0\145\377\256"
-    "\0\0\0\0\256\377\336\121\15\14\117\335\377\377\377\0\0\0\0\0\326\377"
-    "\377\116\0\0\117\377\377\325\0\0\0\0\0\0\0\377\377\377\377\377\377"
-    "\377\377\377\377\377\364\150\0\0\0\0\0\345\377\377\33\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\27\377\377\347\0\0"
-    "\0\0\0\377\377\377\377\377\377\377\377\377\377\377\377\377\0\0\0\0"
-    "\0\0\377\377\377\377\377\377\377\377\377\377\377\377\377\0\0\0\0\0"
-    "\346\377\377\33\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0"
-    "\0\377\377\377\120\373\377\377\257\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\233\377\250\0\260"
-    "\377\234\0\0\377\377\377\0\0\0\377\377\377\0\0\262\377\361\14\0\0"
-    "\0\377\377\377\0\0\0\0\356\377\377\20\0\0\0\0\0\0\0\0\22\377\377\354"
-    "\0\0\233\377\157\0\0\0\103\377\353\32\0\0\0\0\32\354\377\377\0\0\0"
-    "\0\45\377\377\365\11\0\0\12\366\377\377\44\0\0\0\0\0\0\377\377\377"
-    "\377\377\377\377\377\377\377\317\76\0\0\0\0\0\0\370\377\377\7\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\7\377\377\370"
-    "\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377\377\377\377\0\0"
-    "\0\0\0\0\377\377\377\377\377\377\377\377\377\377\377\377\377\0\0\0"
-    "\0\0\370\377\377\7\0\0\0\0\0\0\377\377\377\377\377\377\0\0\0\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\0\0\0\0\0\0\0"
-    "\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\0\0\0\0\0\0\377\377\377\371\377\377\377\376\100\0\0\0\0\0\0\0"
-    "\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\102"
-    "\377\365\34\371\377\103\0\0\377\377\377\0\0\0\377\377\377\0\0\105"
-    "\377\377\153\0\0\0\377\377\377\0\0\0\0\373\377\377\4\0\0\0\0\0\0\0"
-    "\0\5\377\377\372\0\0\314\377\73\0\0\0\244\377\164\0\0\0\0\0\0\164"
-    "\377\377\0\0\0\0\164\377\377\260\0\0\0\0\261\377\377\163\0\0\0\0\0"
-    "\0\377\377\377\377\377\377\377\377\377\377\377\377\250\13\0\0\0\0"
-    "\376\377\377\1\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0"
-    "\0\0\0\1\377\377\376\0\0\0\0\0\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\0\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\0\0\0\0\0\376\377\377\1\0\0\0\0\0\0\377\377\377\377\377"
-    "\377\0\0\0\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\377\377\377\0\0\0\0\0\0\377\377\377\377\376\331\377\377"
-    "\337\15\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\377\377\377\0\0\2\346\377\275\377\347\3\0\0\377\377\377\0\0\0\377"
-    "\377\377\0\0\1\330\377\327\0\0\0\377\377\377\0\0\0\0\377\377\377\0"
-    "\0\0\0\0\0\0\0\0\1\377\377\376\0\0\341\377\34\0\0\0\336\377\47\0\0"
-    "\0\0\0\0\50\377\377\0\0\0\0\303\377\377\141\0\0\0\0\142\377\377\302"
-    "\0\0\0\0\0\0\377\377\377\0\0\0\0\12\46\144\330\377\377\267\1\0\0\0"
-    "\370\377\377\7\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0"
-    "\0\0\0\6\377\377\370\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\370\377\377\6\0"
-    "\0\0\0\0\0\377\377\377\377\377\377\0\0\0\377\377\377\0\0\0\0\0\0\0"
-    "\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\377\377\377\377\157"
-    "\32\355\377\377\236\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\377\377\377\0\0\0\217\377\377\377\221\0\0\0\377\377"
-    "\377\0\0\0\377\377\377\0\0\0\154\377\377\104\0\0\377\377\377\0\0\0"
-    "\0\373\377\377\4\0\0\0\0\0\0\0\0\5\377\377\372\0\0\362\377\15\0\0"
-    "\0\367\377\7\0\0\0\0\0\0\10\377\377\0\0\0\25\375\377\375\25\0\0\0"
-    "\0\26\375\377\374\24\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\12\312\377"
-    "\377\130\0\0\0\346\377\377\33\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\0\0\0\0\0\0\0\0\27\377\377\350\0\0\0\0\0\377\377\377\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\346\377\377\31\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\377\377\377\0"
-    "\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\377\377"
-    "\377\174\0\0\130\377\377\377\116\0\0\0\0\0\0\0\0\0\377\377\377\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\66\377\377\377\70\0\0\0"
-    "\377\377\377\0\0\0\377\377\377\0\0\0\15\362\377\261\0\0\377\377\377"
-    "\0\0\0\0\357\377\377\20\0\0\0\0\0\0\0\0\22\377\377\354\0\0\373\377"
-    "\3\0\0\0\367\377\7\0\0\0\0\0\0\11\377\377\0\0\0\141\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\140\0\0\0\0\0\377\377\377\0\0\0\0"
-    "\0\0\0\0\106\377\377\270\0\0\0\306\377\377\100\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\65\377\377\314\0\0\0\0\0\377"
-    "\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\306\377\377\75\0\0\0\0\0\0\0\0\0\377\377\377\0\0"
-    "\0\377\377\377\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\1\377\377\376\0\0\0"
-    "\0\0\0\377\377\377\0\0\0\0\250\377\377\350\24\0\0\0\0\0\0\0\0\377"
-    "\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\334\377\337"
-    "\0\0\0\0\377\377\377\0\0\0\377\377\377\0\0\0\0\223\377\375\40\0\377"
-    "\377\377\0\0\0\0\330\377\377\50\0\0\0\0\0\0\0\0\52\377\377\326\0\0"
-    "\355\377\21\0\0\0\336\377\50\0\0\0\0\0\0\51\377\377\0\0\0\260\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\257\0\0\0\0\0\377\377"
-    "\377\0\0\0\0\0\0\0\0\16\377\377\352\0\0\0\224\377\377\174\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\146\377\377\241"
-    "\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\225\377\377\167\0\0\0\0\0\0\0\0\0\377"
-    "\377\377\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0"
-    "\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\10\377"
-    "\377\367\0\0\0\0\0\0\377\377\377\0\0\0\0\22\345\377\377\254\0\0\0"
-    "\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0"
-    "\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\377\377\377\0\0\0\0\47\376\377"
-    "\212\0\377\377\377\0\0\0\0\266\377\377\117\0\0\0\0\0\0\0\0\120\377"
-    "\377\263\0\0\333\377\43\0\0\0\244\377\164\0\0\0\0\0\0\165\377\377"
-    "\0\0\11\365\377\377\377\377\377\377\377\377\377\377\377\377\365\11"
-    "\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\7\377\377\373\0\0\0\116\377\377"
-    "\325\1\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\264"
-    "\377\377\144\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\120\377\377\315\0\0\0\0"
-    "\0\0\0\0\0\377\377\377\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\40\377\377\345\0\0\0\0\0\0\377\377\377\0\0\0\0\0\110\377"
-    "\377\377\135\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\377\377\377\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\377\377\377\0"
-    "\0\0\0\0\272\377\355\11\377\377\377\0\0\0\0\204\377\377\212\0\0\0"
-    "\0\0\0\0\0\213\377\377\201\0\0\300\377\113\0\0\0\103\377\353\32\0"
-    "\0\0\0\32\353\377\377\0\0\116\377\377\324\0\0\0\0\0\0\0\0\325\377"
-    "\377\115\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\61\377\377\357\0\0\0"
-    "\7\352\377\377\136\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0"
-    "\0\0\0\60\375\377\372\25\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\10\354\377"
-    "\377\121\0\0\0\0\0\0\0\0\377\377\377\0\0\0\377\377\377\0\0\0\0\0\0"
-    "\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0"
-    "\0\0\202\0\0\0\0\0\0\0\0\121\377\377\304\0\0\0\0\0\0\377\377\377\0"
-    "\0\0\0\0\0\230\377\377\357\34\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0"
-    "\0\377\377\377\0\0\0\0\0\115\377\377\143\377\377\377\0\0\0\0\102\377"
-    "\377\341\5\0\0\0\0\0\0\5\342\377\377\75\0\0\210\377\204\0\0\0\0\257"
-    "\377\335\120\14\14\116\335\377\377\377\0\0\235\377\377\205\0\0\0\0"
-    "\0\0\0\0\206\377\377\234\0\0\0\0\377\377\377\0\0\0\0\0\0\0\1\253\377"
-    "\377\300\0\0\0\0\165\377\377\364\100\0\0\0\0\0\0\0\25\251\0\0\0\0"
-    "\377\377\377\0\0\0\0\0\0\47\335\377\377\235\0\0\0\0\0\0\377\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\171\377\377\356\66\0\0\0\0\0\0\0\377\377\377\0\0\0\377"
-    "\377\377\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\377\245\17\0\0\0\0\0\0\264\377\377\217\0"
-    "\0\0\0\0\0\377\377\377\0\0\0\0\0\0\13\334\377\377\273\1\0\0\0\0\0"
-    "\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0"
-    "\0\0\0\0\377\377\377\0\0\0\377\377\377\0\0\0\0\0\2\336\377\320\377"
-    "\377\377\0\0\0\0\3\345\377\377\210\0\0\0\0\0\0\211\377\377\340\2\0"
-    "\0\113\377\317\0\0\0\0\16\302\377\377\377\377\377\377\267\377\377"
-    "\0\2\351\377\377\67\0\0\0\0\0\0\0\0\67\377\377\351\2\0\0\0\377\377"
-    "\377\0\0\0\0\7\37\123\275\377\377\377\144\0\0\0\0\5\313\377\377\374"
-    "\235\77\20\2\21\101\225\365\377\0\0\0\0\377\377\377\0\0\10\37\115"
-    "\235\370\377\377\351\27\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\7\320\377"
-    "\377\372\226\74\17\2\21\103\255\377\377\377\0\0\0\377\377\377\0\0"
-    "\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0"
-    "\0\0\0\0\0\0\377\377\353\200\60\10\10\60\245\377\377\377\77\0\0\0"
-    "\0\0\0\377\377\377\0\0\0\0\0\0\0\73\375\377\377\154\0\0\0\0\0\377"
-    "\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0"
-    "\0\0\377\377\377\0\0\0\377\377\377\0\0\0\0\0\0\164\377\377\377\377"
-    "\377\0\0\0\0\0\157\377\377\377\246\67\13\14\70\247\377\377\377\147"
-    "\0\0\0\11\353\377\73\0\0\0\0\4\153\312\364\364\314\157\5\377\377\0"
-    "\73\377\377\346\1\0\0\0\0\0\0\0\0\1\347\377\377\72\0\0\0\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\301\3\0\0\0\0\0\32\332\377"
-    "\377\377\377\377\377\377\377\377\377\377\0\0\0\0\377\377\377\377\377"
-    "\377\377\377\377\377\377\357\67\0\0\0\0\0\0\0\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\0\0\0\0\0\377\377\377\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\36\337\377\377\377\377\377\377\377\377"
-    "\377\377\377\256\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\377\377\377\0"
-    "\0\0\0\0\377\377\377\377\377\377\377\377\377\377\377\377\377\0\0\0"
-    "\0\0\377\377\377\377\377\377\377\377\377\377\377\277\0\0\0\0\0\0\0"
-    "\377\377\377\0\0\0\0\0\0\0\0\210\377\377\365\46\0\0\0\0\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\0\0\0\377\377\377\0\0"
-    "\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\377\377\377\0\0\0\0\0\0\21\366"
-    "\377\377\377\377\0\0\0\0\0\3\300\377\377\377\377\377\377\377\377\377"
-    "\377\272\2\0\0\0\0\202\377\276\1\0\0\0\0\0\0\0\0\0\0\0\0\0\0\212\377"
-    "\377\231\0\0\0\0\0\0\0\0\0\0\232\377\377\211\0\0\0\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\247\15\0\0\0\0\0\0\0\22\250\377\377"
-    "\377\377\377\377\377\377\356\136\0\0\0\0\377\377\377\377\377\377\377"
-    "\377\377\377\273\43\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\26\260\377\377\377\377\377\377\377\377\371\176\2"
-    "\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\0\0\0\0\0\115\330\377"
-    "\377\377\377\377\377\377\377\321\31\0\0\0\0\0\0\0\377\377\377\0\0"
-    "\0\0\0\0\0\0\6\321\377\377\310\3\0\0\0\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0"
-    "\0\377\377\377\0\0\0\377\377\377\0\0\0\0\0\0\0\233\377\377\377\377"
-    "\0\0\0\0\0\0\16\266\377\377\377\377\377\377\377\377\261\14\0\0\0\0"
-    "\0\25\352\377\161\0\0\0\0\0\0\0\0\0\0\0\0\0\0\331\377\377\113\0\0"
-    "\0\0\0\0\0\0\0\0\113\377\377\330\0\0\0\377\377\377\377\377\377\377"
-    "\373\350\305\212\60\0\0\0\0\0\0\0\0\0\0\0\57\215\313\357\375\363\310"
-    "\170\21\0\0\0\0\0\377\377\377\377\377\370\345\300\206\61\0\0\0\0\0"
-    "\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\66"
-    "\223\317\361\375\362\312\202\34\0\0\0\0\0\377\377\377\0\0\0\0\0\0"
-    "\0\0\0\377\377\377\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\0\0\0\0\0\0\2\117\241\334\366\373\346\267\144\5\0\0\0"
-    "\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\56\371\377\377\174\0\0\0"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\0\0\0\377"
-    "\377\377\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\377\377\377\0\0\0"
-    "\0\0\0\0\56\377\377\377\377\0\0\0\0\0\0\0\0\113\253\342\372\372\341"
-    "\250\110\0\0\0\0\0\0\0\0\113\377\374\140\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\172\377\376\216\17"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\144\373\377\352\222\105\37\10\14\72\221\204\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\52\263\377\377\377\377"
-    "\377\377\377\377\336\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\51\165\273\332\360\374\352\300\200\6\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377"
-    "\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\377\377\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\377\377\377\377\367\347\277\202\41\0\0\0\0\0\0\0\0\0\0\103\240"
-    "\333\364\363\332\237\103\0\0\0\0\0\0\0\377\377\377\377\377\377\374"
-    "\356\320\232\76\0\0\0\0\0\0\0\0\0\0\0\24\165\272\346\370\370\350\310"
-    "\232\144\41\0\0\0\0\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\0\0\0\333\377\377\104\0\0\0\0\0\0\0\0\0\105\377\377\333\0\355\377"
-    "\377\33\0\0\0\0\0\0\0\0\0\0\0\33\377\377\354\0\0\261\377\377\322\4"
-    "\0\0\0\0\0\0\0\10\331\377\377\255\0\271\377\377\262\0\0\0\0\0\0\0"
-    "\0\0\263\377\377\271\0\0\0\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377"
-    "\0\0\0\0\0\0\0\305\377\377\73\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\377\377\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\107\375\377"
-    "\375\107\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\377\377\377\377\377\377\377\377\377\377\377\374\206\3\0\0\0\0\0\0"
-    "\11\250\377\377\377\377\377\377\377\377\251\11\0\0\0\0\0\377\377\377"
-    "\377\377\377\377\377\377\377\377\264\22\0\0\0\0\0\0\0\0\147\364\377"
-    "\377\377\377\377\377\377\377\377\377\0\0\0\0\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\0\0\0\377\377\377\0\0"
-    "\0\0\0\0\0\0\0\377\377\377\0\0\0\222\377\377\216\0\0\0\0\0\0\0\0\0"
-    "\217\377\377\221\0\307\377\377\101\0\0\0\0\0\0\0\0\0\0\0\102\377\377"
-    "\306\0\0\36\364\377\377\165\0\0\0\0\0\0\0\207\377\377\357\31\0\56"
-    "\375\377\377\100\0\0\0\0\0\0\0\101\377\377\375\56\0\0\0\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\0\0\0\0\0\0\0"
-    "\0\377\377\377\377\377\377\377\0\0\0\0\0\0\0\117\377\377\261\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\42\356\377\377\377\355\41\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\235\0\0\0\0\0\2\262\377\377\377\377\377\377\377"
-    "\377\377\377\263\2\0\0\0\0\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\310\4\0\0\0\0\0\0\202\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\0\0\0\0\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\0\0\0\110\377\377\330\0\0\0\0\0\0\0\0\0\331\377\377\107\0\241\377"
-    "\377\147\0\0\0\0\0\0\0\0\0\0\0\150\377\377\240\0\0\0\163\377\377\364"
-    "\36\0\0\0\0\0\57\373\377\377\145\0\0\0\237\377\377\314\1\0\0\0\0\0"
-    "\1\315\377\377\236\0\0\0\0\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\331\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0"
-    "\0\0\0\0\1\327\377\376\50\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\12\320\377\377\337\377\377"
-    "\320\12\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\377\0\0\0\0\10\45\153\343\377\377\377\102\0\0\0\0\140\377\377"
-    "\377\250\70\14\16\72\251\377\377\377\140\0\0\0\0\377\377\377\0\0\0"
-    "\3\25\112\271\377\377\377\147\0\0\0\0\0\72\376\377\377\323\140\41"
-    "\7\5\22\60\132\222\332\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0"
-    "\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\10\365"
-    "\377\377\41\0\0\0\0\0\0\0\43\377\377\365\7\0\172\377\377\216\0\0\0"
-    "\0\0\0\0\0\0\0\0\216\377\377\171\0\0\0\4\321\377\377\261\0\0\0\0\3"
-    "\314\377\377\277\1\0\0\0\33\366\377\377\133\0\0\0\0\0\134\377\377"
-    "\365\32\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\152\377\377\375\71\0\0\0\0\0"
-    "\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\143\377\377\235\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\244\377\377\262\7\263\377\377\244\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\22\325\377\377"
-    "\247\0\0\0\1\337\377\377\213\0\0\0\0\0\0\213\377\377\340\1\0\0\0\377"
-    "\377\377\0\0\0\0\0\0\1\244\377\377\277\0\0\0\0\0\251\377\377\266\6"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0"
-    "\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\264\377\377"
-    "\154\0\0\0\0\0\0\0\155\377\377\263\0\0\124\377\377\264\0\0\0\0\0\0"
-    "\0\0\0\0\0\264\377\377\123\0\0\0\0\70\376\377\377\120\0\0\0\164\377"
-    "\377\367\44\0\0\0\0\0\204\377\377\340\10\0\0\0\10\341\377\377\203"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\42\364\377\377\211\0\0\0\0\0\0\0\0"
-    "\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\6\346\377\371\31\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\160"
-    "\377\377\307\12\0\12\307\377\377\157\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\111\377\377\340"
-    "\0\0\0\67\377\377\347\6\0\0\0\0\0\0\7\350\377\377\70\0\0\0\377\377"
-    "\377\0\0\0\0\0\0\0\46\377\377\354\0\0\0\0\0\347\377\377\51\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0"
-    "\377\377\377\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\152\377\377\265"
-    "\0\0\0\0\0\0\0\266\377\377\151\0\0\56\377\377\332\0\0\0\0\0\0\0\0"
-    "\0\0\0\333\377\377\55\0\0\0\0\0\227\377\377\342\13\0\42\365\377\377"
-    "\170\0\0\0\0\0\0\15\351\377\377\167\0\0\0\170\377\377\350\14\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\2\302\377\377\325\7\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\0\0\167\377\377\211\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\77\373\377\327"
-    "\23\0\0\0\23\330\377\373\76\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\14\377\377\372\0\0\0\200"
-    "\377\377\217\0\0\0\0\0\0\0\0\220\377\377\202\0\0\0\377\377\377\0\0"
-    "\0\0\0\0\0\6\377\377\372\0\0\0\0\0\374\377\377\5\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\40\377\377\366\10\0\0\0\0\0"
-    "\11\366\377\377\37\0\0\11\376\377\373\5\0\0\77\377\377\377\72\0\0"
-    "\5\373\377\376\10\0\0\0\0\0\20\350\377\377\214\0\274\377\377\317\4"
-    "\0\0\0\0\0\0\0\151\377\377\360\24\0\24\361\377\377\150\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\161\377\377\374\64\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\0\0\17\361\377\360\16\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\34\351\377\346"
-    "\37\0\0\0\0\0\40\346\377\351\33\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\14\377\377\371\0\0\0\255"
-    "\377\377\122\0\0\0\0\0\0\0\0\122\377\377\255\0\0\0\377\377\377\0\0"
-    "\0\0\0\0\0\41\377\377\344\0\0\0\0\0\356\377\377\63\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\326\377\377\111\0\0\0"
-    "\0\0\112\377\377\325\0\0\0\0\341\377\377\47\0\0\164\377\377\377\157"
-    "\0\0\47\377\377\340\0\0\0\0\0\0\0\132\377\377\373\214\377\377\374"
-    "\63\0\0\0\0\0\0\0\0\4\327\377\377\222\0\223\377\377\327\4\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\46\366\377\377\205\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\212\377\377\166\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\7\311\377\361"
-    "\57\0\0\0\0\0\0\0\57\361\377\310\6\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\112\377\377\340\0\0\0\325"
-    "\377\377\55\0\0\0\0\0\0\0\0\56\377\377\325\0\0\0\377\377\377\0\0\0"
-    "\0\0\0\0\221\377\377\242\0\0\0\0\0\270\377\377\315\36\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\214\377\377\223\0\0\0"
-    "\0\0\224\377\377\213\0\0\0\0\273\377\377\115\0\0\251\377\377\377\244"
-    "\0\0\115\377\377\272\0\0\0\0\0\0\0\0\273\377\377\377\377\377\213\0"
-    "\0\0\0\0\0\0\0\0\0\116\377\377\372\113\372\377\377\115\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\3\307\377\377\322\6\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\32\371\377\345\6\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\233\377\371\101\0"
-    "\0\0\0\0\0\0\0\0\101\371\377\232\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\22\325\377\377\247\0\0\0\351"
-    "\377\377\22\0\0\0\0\0\0\0\0\23\377\377\351\0\0\0\377\377\377\0\0\0"
-    "\1\17\75\244\377\377\367\52\0\0\0\0\0\111\377\377\377\371\251\134"
-    "\34\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0"
-    "\0\0\377\377\377\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\102\377\377"
-    "\334\0\0\0\0\0\335\377\377\101\0\0\0\0\225\377\377\164\0\0\336\377"
-    "\317\377\331\0\0\164\377\377\224\0\0\0\0\0\0\0\0\44\367\377\377\377"
-    "\335\11\0\0\0\0\0\0\0\0\0\0\0\300\377\377\373\377\377\277\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\167\377\377\372\61\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\236\377\377\142\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\377\377\377\0\0\0\0\7\44\153\343\377\377\377\104\0\0\0\365\377"
-    "\377\10\0\0\0\0\0\0\0\0\11\377\377\364\0\0\0\377\377\377\377\377\377"
-    "\377\377\377\377\377\355\111\0\0\0\0\0\0\0\177\377\377\377\377\377"
-    "\377\342\235\113\2\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0"
-    "\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\5\362"
-    "\377\377\46\0\0\0\47\377\377\361\5\0\0\0\0\157\377\377\232\0\23\377"
-    "\377\135\377\376\20\0\232\377\377\156\0\0\0\0\0\0\0\0\0\203\377\377"
-    "\377\110\0\0\0\0\0\0\0\0\0\0\0\0\64\376\377\377\377\376\63\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\52\370\377\377\200\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\51\376\377\326\1\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\377\377\377\377\377\377\377\377\377\377\377\377\377\243\0\0\0"
-    "\0\375\377\377\2\0\0\0\0\0\0\0\0\2\377\377\375\0\0\0\377\377\377\377"
-    "\377\377\377\377\377\356\161\21\0\0\0\0\0\0\0\0\0\110\315\377\377"
-    "\377\377\377\377\377\335\115\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0"
-    "\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0"
-    "\0\0\0\256\377\377\160\0\0\0\161\377\377\255\0\0\0\0\0\110\377\377"
-    "\300\0\110\377\362\5\362\377\104\0\300\377\377\107\0\0\0\0\0\0\0\0"
-    "\0\273\377\377\377\202\0\0\0\0\0\0\0\0\0\0\0\0\0\246\377\377\377\245"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\4\313\377\377\316\5\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\262\377\377\116"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377\377\375\215\5\0"
-    "\0\0\0\365\377\377\10\0\0\0\0\0\0\0\0\11\377\377\366\0\0\0\377\377"
-    "\377\377\377\377\377\377\377\377\333\47\0\0\0\0\0\0\0\0\0\0\0\60\172"
-    "\272\362\377\377\377\377\377\166\0\0\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\377\377\377\0\0"
-    "\0\0\0\0\145\377\377\272\0\0\0\273\377\377\144\0\0\0\0\0\42\377\377"
-    "\347\0\175\377\273\0\274\377\171\0\346\377\377\41\0\0\0\0\0\0\0\0"
-    "\135\377\377\377\377\372\56\0\0\0\0\0\0\0\0\0\0\0\0\40\377\377\377"
-    "\37\0\0\0\0\0\0\0\0\0\0\0\0\0\0\175\377\377\371\56\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\73\377\377"
-    "\304\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\377\377\377\377\377\377\377\370\350\301\205\45\0\0"
-    "\0\0\0\0\351\377\377\22\0\0\0\0\0\0\0\0\23\377\377\354\0\0\0\377\377"
-    "\377\4\15\25\53\164\361\377\377\333\11\0\0\0\0\0\0\0\0\0\0\0\0\0\2"
-    "\57\166\335\377\377\376\73\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0"
-    "\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0"
-    "\33\377\377\370\13\0\13\371\377\377\32\0\0\0\0\0\2\371\377\377\15"
-    "\262\377\201\0\202\377\256\15\377\377\370\2\0\0\0\0\0\0\0\23\353\377"
-    "\377\366\377\377\313\3\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\57\372\377\377\173\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\305\377\377\73"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\324\377\377\55"
-    "\0\0\0\0\0\0\0\0\56\377\377\323\0\0\0\377\377\377\0\0\0\0\0\65\370"
-    "\377\377\177\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\10\265\377\377\253\0"
-    "\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\376\377\377\0\0"
-    "\0\0\0\0\0\0\0\377\377\374\0\0\0\0\0\0\0\321\377\377\116\0\117\377"
-    "\377\320\0\0\0\0\0\0\0\326\377\377\63\347\377\110\0\111\377\344\63"
-    "\377\377\325\0\0\0\0\0\0\0\0\241\377\377\341\65\370\377\377\166\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\5\320"
-    "\377\377\313\4\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\117\377\377\261\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\255\377\377\122\0\0\0\0\0\0\0\0\122\377\377"
-    "\263\0\0\0\377\377\377\0\0\0\0\0\0\173\377\377\361\17\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\51\377\377\346\0\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\365\377\377\1\0\0\0\0\0\0\0\2\377\377\364\0\0"
-    "\0\0\0\0\0\207\377\377\230\0\231\377\377\206\0\0\0\0\0\0\0\257\377"
-    "\377\166\377\376\20\0\21\376\377\162\377\377\256\0\0\0\0\0\0\0\103"
-    "\377\377\377\113\0\172\377\377\367\45\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\0\0\203\377\377\370\52\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\1\327"
-    "\377\376\50\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\200\377"
-    "\377\216\0\0\0\0\0\0\0\0\217\377\377\202\0\0\0\377\377\377\0\0\0\0"
-    "\0\0\10\344\377\377\172\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\6\377\377"
-    "\373\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\344\377\377"
-    "\11\0\0\0\0\0\0\0\13\377\377\344\0\0\0\0\0\0\0\75\377\377\341\0\342"
-    "\377\377\74\0\0\0\0\0\0\0\211\377\377\322\377\325\0\0\0\326\377\316"
-    "\377\377\210\0\0\0\0\0\0\10\333\377\377\251\0\0\4\317\377\377\301"
-    "\1\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\64\373"
-    "\377\377\166\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\143\377\377\235\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\67\377\377\346\6\0\0\0\0\0\0\6\346\377"
-    "\377\100\0\0\0\377\377\377\0\0\0\0\0\0\0\146\377\377\357\22\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\53\377\377\357\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\307\377\377\54\0\0\0\0\0\0\0\56\377\377\307"
-    "\0\0\0\0\0\0\0\3\357\377\377\127\377\377\356\3\0\0\0\0\0\0\0\143\377"
-    "\377\377\377\233\0\0\0\234\377\377\377\377\142\0\0\0\0\0\0\206\377"
-    "\377\357\30\0\0\0\61\373\377\377\152\0\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\7\324\377\377\307\3\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\6\346\377"
-    "\371\31\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\1\337\377\377"
-    "\210\0\0\0\0\0\0\211\377\377\345\3\0\0\0\377\377\377\0\0\0\0\0\0\0"
-    "\4\330\377\377\215\0\0\0\0\0\0\0\0\0\0\0\0\0\0\7\270\377\377\277\0"
-    "\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\223\377\377\255"
-    "\1\0\0\0\0\0\2\256\377\377\223\0\0\0\0\0\0\0\0\251\377\377\341\377"
-    "\377\250\0\0\0\0\0\0\0\0\75\377\377\377\377\142\0\0\0\143\377\377"
-    "\377\377\74\0\0\0\0\0\55\372\377\377\145\0\0\0\0\0\205\377\377\362"
-    "\36\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\211\377\377"
-    "\366\47\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\167\377\377\211\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\137\377\377\377\246\67\13\14\70\247\377"
-    "\377\377\160\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\122\377\377\370\37"
-    "\0\0\0\337\237\153\75\40\13\3\10\44\143\325\377\377\377\140\0\0\0"
-    "\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\63\377\377\377\300"
-    "\114\25\5\25\114\302\377\377\377\64\0\0\0\0\0\0\0\0\137\377\377\377"
-    "\377\377\136\0\0\0\0\0\0\0\0\26\377\377\377\377\50\0\0\0\51\377\377"
-    "\377\377\25\0\0\0\0\2\307\377\377\301\1\0\0\0\0\0\7\326\377\377\267"
-    "\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\70\375\377\377"
-    "\162\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\17\361\377\360\16\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\2\261\377\377\377\377\377\377\377\377\377"
-    "\377\302\3\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\306\377\377\243\0"
-    "\0\0\377\377\377\377\377\377\377\377\377\377\377\377\377\272\2\0\0"
-    "\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\221\377\377\377"
-    "\377\377\377\377\377\377\377\377\221\0\0\0\0\0\0\0\0\0\26\376\377"
-    "\377\377\376\26\0\0\0\0\0\0\0\0\0\357\377\377\355\1\0\0\0\1\356\377"
-    "\377\356\0\0\0\0\0\154\377\377\370\50\0\0\0\0\0\0\0\71\375\377\377"
-    "\136\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\331\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\0\0\0\0\0\0\0\0\377"
-    "\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\212\377\377\166\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\11\246\377\377\377"
-    "\377\377\377\377\377\263\16\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0"
-    "\0\74\377\377\376\60\0\0\377\377\377\377\377\377\377\377\377\377\377"
-    "\376\231\12\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0"
-    "\0\2\175\373\377\377\377\377\377\377\377\374\176\1\0\0\0\0\0\0\0\0"
-    "\0\0\313\377\377\377\312\0\0\0\0\0\0\0\0\0\0\312\377\377\265\0\0\0"
-    "\0\0\266\377\377\311\0\0\0\0\33\362\377\377\177\0\0\0\0\0\0\0\0\0"
-    "\217\377\377\355\27\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\0"
-    "\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\32\371\377\345\6\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\101\237\333\364\377\377\377\374\104\0\0\0\0\0\0\377\377\377\0\0"
-    "\0\0\0\0\0\0\0\0\261\377\377\272\0\0\41\142\226\301\340\364\374\366"
-    "\346\276\203\47\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\41\210\312\356\373\356\313\211\42\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\201\377\377\377\200\0\0\0\0\0\0\0\0\0\0\243\377\377\174\0\0"
-    "\0\0\0\175\377\377\243\0\0\0\0\257\377\377\326\6\0\0\0\0\0\0\0\0\0"
-    "\12\335\377\377\254\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\0"
-    "\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\236\377\377\142\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\15\305\377\377\364\71\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\51\376\377\326\1\0"
-    "\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\14\303\377\377"
-    "\357\60\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\262\377\377\116\0\0\0\0\0\0\0\0\0\0\0"
-    "\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\13\301\377\377\224\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\73\377\377\304\0\0\0\0\0\0\0\377\377\377\377\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\12\267\152\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\377\377\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377"
-    "\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\377\377\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\233\377\375"
-    "\75\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\7\311\377\335\14\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\34\351\377\232\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\7\160\304\356\375\377\377\377\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\377\377\377\377\377\377\377\377\377\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\77\373"
-    "\377\111\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\12\311\377\377\377"
-    "\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\160\377\346\22\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\175\377\377\377\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\377\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\245\377\250\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\320\377\377\226\35\2\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\365\377\377\15\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\72\222\321\364"
-    "\374\356\313\213\52\0\0\0\0\0\0\0\0\377\377\377\0\5\161\317\370\367"
-    "\324\212\31\0\0\0\0\0\0\0\0\0\0\0\36\176\301\351\373\366\315\173\22"
-    "\0\0\0\0\0\0\0\0\26\206\321\366\371\322\164\6\0\377\377\377\0\0\0"
-    "\0\0\0\0\0\103\243\336\371\371\333\230\51\0\0\0\0\0\0\0\0\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\0\0\0\0\0\0\0\21"
-    "\200\320\362\360\313\151\4\0\377\377\377\0\0\0\0\0\377\377\377\0\1"
-    "\144\313\367\361\301\115\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377\0\0\0"
-    "\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\44\343\377\377\364\77\0\0"
-    "\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\377\377\377\2\201\351"
-    "\367\271\42\0\31\254\364\361\262\43\0\0\0\0\377\377\377\0\1\144\313"
-    "\367\361\301\115\0\0\0\0\0\0\0\0\0\0\25\176\311\360\375\360\310\174"
-    "\23\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\107\313"
-    "\377\377\377\377\377\377\377\377\376\221\4\0\0\0\0\0\0\377\377\377"
-    "\13\302\377\377\377\377\377\377\357\110\0\0\0\0\0\0\0\0\4\207\372"
-    "\377\377\377\377\377\377\377\357\135\0\0\0\0\0\0\104\355\377\377\377"
-    "\377\377\377\306\14\377\377\377\0\0\0\0\0\0\17\260\377\377\377\377"
-    "\377\377\377\372\154\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\0\0\0\0\0\0\70\350\377\377\377\377\377\377"
-    "\266\10\377\377\377\0\0\0\0\0\377\377\377\2\250\377\377\377\377\377"
-    "\377\153\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\377\377\377\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\377\0\0\0\0\0\44\343\377\377\365\77\0\0\0\0\0\0\0\0\377\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\377\377\377\211\377\377\377\377\336\21\324"
-    "\377\377\377\377\340\14\0\0\0\377\377\377\2\250\377\377\377\377\377"
-    "\377\153\0\0\0\0\0\0\0\0\112\356\377\377\377\377\377\377\377\355\107"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\244\0\0\0\0\0\0\377\377\377\233\377"
-    "\377\377\377\377\377\377\377\367\60\0\0\0\0\0\0\4\263\377\377\377"
-    "\377\377\377\377\377\377\377\377\0\0\0\0\0\56\366\377\377\377\377"
-    "\377\377\377\377\234\377\377\377\0\0\0\0\0\12\312\377\377\377\377"
-    "\377\377\377\377\377\377\126\0\0\0\0\0\0\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\0\0\0\0\0\46\360\377\377\377\377\377"
-    "\377\377\377\206\377\377\377\0\0\0\0\0\377\377\377\163\377\377\377"
-    "\377\377\377\377\367\33\0\0\0\0\0\0\0\377\377\377\377\377\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377\0\0\0\0\0"
-    "\0\0\0\0\0\0\377\377\377\0\0\0\0\44\343\377\377\365\77\0\0\0\0\0\0"
-    "\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\377\377\377\373\377\377\377"
-    "\377\377\313\377\377\377\377\377\377\145\0\0\0\377\377\377\163\377"
-    "\377\377\377\377\377\377\367\33\0\0\0\0\0\0\73\371\377\377\377\377"
-    "\377\377\377\377\377\370\70\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\377\377\302\150\55\13\3\23\103\253\377\377\377\107\0"
-    "\0\0\0\0\377\377\377\375\362\164\37\6\35\157\361\377\377\313\0\0\0"
-    "\0\0\0\206\377\377\377\320\137\40\7\15\55\164\341\377\0\0\0\0\0\312"
-    "\377\377\360\156\34\6\37\165\363\375\377\377\377\0\0\0\0\0\226\377"
-    "\377\362\171\45\5\17\105\302\377\377\355\15\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\377\0\0\0\0\0\0\0\0\0\0\0\277\377\377\365\172\42\6\32\154\360"
-    "\371\377\377\377\0\0\0\0\0\377\377\377\356\320\102\12\23\161\374\377"
-    "\377\170\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\44"
-    "\343\377\377\365\100\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0"
-    "\0\0\0\0\377\377\377\277\27\25\267\377\377\377\304\34\20\261\377\377"
-    "\245\0\0\0\377\377\377\356\320\102\12\23\161\374\377\377\170\0\0\0"
-    "\0\0\3\330\377\377\361\160\35\6\36\161\361\377\377\325\2\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\270\55\0\0\0\0\0\0\0\0\234"
-    "\377\377\244\0\0\0\0\0\377\377\377\373\72\0\0\0\0\0\67\373\377\377"
-    "\77\0\0\0\0\35\371\377\377\236\4\0\0\0\0\0\0\11\230\0\0\0\0\77\377"
-    "\377\372\64\0\0\0\0\0\75\374\377\377\377\0\0\0\0\43\374\377\357\53"
-    "\0\0\0\0\0\4\302\377\377\152\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0"
-    "\0\0\0\0\0\0\0\66\377\377\375\101\0\0\0\0\0\66\373\377\377\377\0\0"
-    "\0\0\0\377\377\377\344\21\0\0\0\0\214\377\377\272\0\0\0\0\0\0\0\0"
-    "\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0"
-    "\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\44\343\377\377\365\100\0\0\0"
-    "\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\377\377\377\105"
-    "\0\0\77\377\377\377\107\0\0\74\377\377\316\0\0\0\377\377\377\344\21"
-    "\0\0\0\0\214\377\377\272\0\0\0\0\0\115\377\377\373\67\0\0\0\0\0\70"
-    "\373\377\377\112\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\51\377\377\330\0\0\0\0\0\377\377\377\235\0\0\0"
-    "\0\0\0\0\235\377\377\224\0\0\0\0\174\377\377\322\5\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\224\377\377\232\0\0\0\0\0\0\0\240\377\377\377\0\0\0\0\201"
-    "\377\377\160\0\0\0\0\0\0\0\104\377\377\261\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\377\0\0\0\0\0\0\0\0\0\0\216\377\377\241\0\0\0\0\0\0\0\234\377"
-    "\377\377\0\0\0\0\0\377\377\377\163\0\0\0\0\0\64\377\377\341\0\0\0"
-    "\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\377\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\44\343\377\377\365\101"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\34\0\0\32\377\377\377\35\0\0\31\377\377\346\0\0\0\377\377\377"
-    "\163\0\0\0\0\0\64\377\377\341\0\0\0\0\0\233\377\377\234\0\0\0\0\0"
-    "\0\0\235\377\377\231\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\5\377\377\360\0\0\0\0\0\377\377\377\107\0\0"
-    "\0\0\0\0\0\110\377\377\310\0\0\0\0\300\377\377\143\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\311\377\377\106\0\0\0\0\0\0\0\111\377\377\377\0\0\0\0"
-    "\302\377\377\32\0\0\0\0\0\0\0\15\377\377\342\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\377\0\0\0\0\0\0\0\0\0\0\305\377\377\111\0\0\0\0\0\0\0\107\377"
-    "\377\377\0\0\0\0\0\377\377\377\55\0\0\0\0\0\15\377\377\364\0\0\0\0"
-    "\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\377\377\377\44\343\377\377\365\101\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\11\0\0\11\377\377\377\12\0\0\11\377\377\365\0\0\0\377\377\377\55"
-    "\0\0\0\0\0\15\377\377\364\0\0\0\0\0\317\377\377\107\0\0\0\0\0\0\0"
-    "\110\377\377\316\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\1\110\232\313\353\370\377\377\377\377\377\377\373\0\0\0\0\0\377\377"
-    "\377\31\0\0\0\0\0\0\0\32\377\377\351\0\0\0\0\351\377\377\43\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\352\377\377\31\0\0\0\0\0\0\0\32\377\377\377"
-    "\0\0\0\0\351\377\377\374\374\374\375\375\376\376\377\377\377\377\365"
-    "\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\351\377\377\31"
-    "\0\0\0\0\0\0\0\31\377\377\377\0\0\0\0\0\377\377\377\13\0\0\0\0\0\1"
-    "\377\377\376\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\377\377\377\343\377"
-    "\377\377\255\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0"
-    "\0\0\0\0\377\377\377\1\0\0\2\377\377\377\1\0\0\2\377\377\375\0\0\0"
-    "\377\377\377\13\0\0\0\0\0\1\377\377\376\0\0\0\0\0\357\377\377\31\0"
-    "\0\0\0\0\0\0\32\377\377\355\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\51\314\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\0\0\0\0\0\377\377\377\6\0\0\0\0\0\0\0\7\377\377\370\0\0\0\0\374\377"
-    "\377\10\0\0\0\0\0\0\0\0\0\0\0\0\0\0\371\377\377\6\0\0\0\0\0\0\0\7"
-    "\377\377\377\0\0\0\0\374\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\370"
-    "\377\377\5\0\0\0\0\0\0\0\6\377\377\377\0\0\0\0\0\377\377\377\0\0\0"
-    "\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\377\377\377\377\377\121\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0"
-    "\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\377\377\377\0\0\0\0\377\377"
-    "\377\0\0\0\377\377\377\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\375\377"
-    "\377\6\0\0\0\0\0\0\0\7\377\377\374\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\32\352\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\0\0\0\0\0\377\377\377\6\0\0\0\0\0\0\0\7\377\377\367\0\0\0"
-    "\0\374\377\377\10\0\0\0\0\0\0\0\0\0\0\0\0\0\0\370\377\377\6\0\0\0"
-    "\0\0\0\0\7\377\377\377\0\0\0\0\374\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0"
-    "\0\0\0\0\0\370\377\377\6\0\0\0\0\0\0\0\7\377\377\377\0\0\0\0\0\377"
-    "\377\377\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0"
-    "\0\377\377\377\377\364\276\377\377\354\31\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\377\377\377\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\377\377\377"
-    "\0\0\0\0\377\377\377\0\0\0\377\377\377\0\0\0\0\0\0\0\377\377\377\0"
-    "\0\0\0\0\375\377\377\6\0\0\0\0\0\0\0\7\377\377\374\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\227\377\377\373\230\104\32\7\0\0\0"
-    "\3\377\377\377\0\0\0\0\0\377\377\377\31\0\0\0\0\0\0\0\32\377\377\347"
-    "\0\0\0\0\351\377\377\43\0\0\0\0\0\0\0\0\0\0\0\0\0\0\350\377\377\30"
-    "\0\0\0\0\0\0\0\32\377\377\377\0\0\0\0\353\377\354\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\351\377"
-    "\377\33\0\0\0\0\0\0\0\32\377\377\377\0\0\0\0\0\377\377\377\0\0\0\0"
-    "\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\364\77\17\340\377\377\270\1\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0"
-    "\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\377\377\377\0\0\0\0\377\377"
-    "\377\0\0\0\377\377\377\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\357\377"
-    "\377\31\0\0\0\0\0\0\0\32\377\377\355\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\342\377\377\132\0\0\0\0\0\0\0\41\377\377\377\0\0"
-    "\0\0\0\377\377\377\110\0\0\0\0\0\0\0\107\377\377\304\0\0\0\0\301\377"
-    "\377\144\0\0\0\0\0\0\0\0\0\0\0\0\0\0\305\377\377\106\0\0\0\0\0\0\0"
-    "\112\377\377\377\0\0\0\0\306\377\376\22\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\305\377\377\114\0"
-    "\0\0\0\0\0\0\111\377\377\377\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\377"
-    "\377\377\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\377\377\377\77\0\0\76"
-    "\375\377\377\156\0\0\0\0\0\0\0\0\0\0\0\375\377\377\1\0\0\0\0\0\0\0"
-    "\0\0\0\377\377\377\0\0\0\0\377\377\377\0\0\0\0\377\377\377\0\0\0\377"
-    "\377\377\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\320\377\377\107\0\0\0"
-    "\0\0\0\0\110\377\377\316\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\374\377\377\7\0\0\0\0\0\0\0\166\377\377\377\0\0\0\0\0\377\377"
-    "\377\235\0\0\0\0\0\0\0\235\377\377\217\0\0\0\0\174\377\377\324\5\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\220\377\377\231\0\0\0\0\0\0\0\241\377\377"
-    "\377\0\0\0\0\206\377\377\153\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\216\377\377\245\0\0\0\0\0\0\0"
-    "\237\377\377\377\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\377\377\377\0"
-    "\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\377\377\377\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\210\377\377"
-    "\367\52\0\0\0\0\0\0\0\0\0\0\360\377\377\26\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\377\0\0\0\0\377\377\377\0\0\0\0\377\377\377\0\0\0\377\377\377"
-    "\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\234\377\377\234\0\0\0\0\0\0\0"
-    "\235\377\377\233\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\355"
-    "\377\377\75\0\0\0\0\0\0\65\362\377\377\377\0\0\0\0\0\377\377\377\373"
-    "\71\0\0\0\0\0\67\373\377\377\70\0\0\0\0\36\372\377\377\241\5\0\0\0"
-    "\0\0\0\6\222\0\0\0\0\73\377\377\372\64\0\0\0\0\0\75\374\377\377\377"
-    "\0\0\0\0\53\376\377\360\60\0\0\0\0\0\0\0\51\263\0\0\0\0\0\0\0\0\0"
-    "\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\67\377\377\375\104\0\0\0\0\0"
-    "\70\374\377\377\377\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\377\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\6\316\377"
-    "\377\317\6\0\0\0\0\0\0\0\0\0\314\377\377\135\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\377\0\0\0\0\377\377\377\0\0\0\0\377\377\377\0\0\0\377\377\377"
-    "\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\116\377\377\373\67\0\0\0\0\0"
-    "\67\373\377\377\114\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\262\377\377\352\144\33\3\14\65\214\370\356\377\377\377\0\0\0\0\0"
-    "\377\377\377\375\362\163\36\5\33\156\360\377\377\305\0\0\0\0\0\0\207"
-    "\377\377\377\321\140\40\7\14\53\160\333\377\0\0\0\0\0\310\377\377"
-    "\357\156\33\5\36\164\363\375\377\377\377\0\0\0\0\0\244\377\377\366"
-    "\210\64\14\6\40\134\261\375\377\0\0\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\301\377\377\366\174\42\5\30\154\360\360\377"
-    "\377\377\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0"
-    "\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\52\366\377\377\212"
-    "\0\0\0\0\0\0\0\0\0\210\377\377\351\107\6\0\0\0\0\0\0\0\0\377\377\377"
-    "\0\0\0\0\377\377\377\0\0\0\0\377\377\377\0\0\0\377\377\377\0\0\0\0"
-    "\0\0\0\377\377\377\0\0\0\0\0\3\331\377\377\360\157\34\5\35\160\361"
-    "\377\377\330\3\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\73\375"
-    "\377\377\377\377\377\377\377\377\377\136\377\377\377\0\0\0\0\0\377"
-    "\377\377\232\377\377\377\377\377\377\377\377\365\53\0\0\0\0\0\0\4"
-    "\264\377\377\377\377\377\377\377\377\377\377\377\0\0\0\0\0\56\367"
-    "\377\377\377\377\377\377\377\377\231\377\377\377\0\0\0\0\0\20\326"
-    "\377\377\377\377\377\377\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0"
-    "\377\377\377\0\0\0\0\0\0\0\0\0\0\0\50\361\377\377\377\377\377\377"
-    "\377\377\165\377\377\377\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\377\377"
-    "\377\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\377\0\0\0\0\0\0\155\377\377\375\100\0\0\0\0\0\0\0\0\40\366\377"
-    "\377\377\377\377\377\377\0\0\0\0\0\377\377\377\0\0\0\0\377\377\377"
-    "\0\0\0\0\377\377\377\0\0\0\377\377\377\0\0\0\0\0\0\0\377\377\377\0"
-    "\0\0\0\0\0\75\372\377\377\377\377\377\377\377\377\377\372\75\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\144\371\377\377\377\377"
-    "\377\377\375\167\0\377\377\377\0\0\0\0\0\377\377\377\13\302\377\377"
-    "\377\377\377\377\356\104\0\0\0\0\0\0\0\0\5\210\372\377\377\377\377"
-    "\377\377\377\361\140\0\0\0\0\0\0\107\357\377\377\377\377\377\377\302"
-    "\13\377\377\377\0\0\0\0\0\0\26\272\377\377\377\377\377\377\377\377"
-    "\330\115\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\72\351\377\377\377\377\377\377\253\5\377\377\375\0\0\0\0\0\377\377"
-    "\377\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\1\271\377\377\341\20"
-    "\0\0\0\0\0\0\0\0\134\374\377\377\377\377\377\377\0\0\0\0\0\377\377"
-    "\377\0\0\0\0\377\377\377\0\0\0\0\377\377\377\0\0\0\377\377\377\0\0"
-    "\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\115\360\377\377\377\377\377\377"
-    "\377\357\115\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\51\227\330\366\372\337\240\62\0\0\377\377\377\0\0\0\0\0\377\377\377"
-    "\0\5\163\321\371\367\324\207\27\0\0\0\0\0\0\0\0\0\0\0\37\177\302\352"
-    "\374\367\317\200\25\0\0\0\0\0\0\0\0\30\210\324\370\371\321\163\5\0"
-    "\377\377\377\0\0\0\0\0\0\0\0\106\243\334\370\374\341\246\116\2\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\22\201"
-    "\321\363\360\311\144\3\10\377\377\356\0\0\0\0\0\377\377\377\0\0\0"
-    "\0\0\0\0\377\377\377\0\0\0\0\0\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0"
-    "\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\31\354\377\377\246\0\0\0"
-    "\0\0\0\0\0\0\66\255\352\375\377\377\377\0\0\0\0\0\377\377\377\0\0"
-    "\0\0\377\377\377\0\0\0\0\377\377\377\0\0\0\377\377\377\0\0\0\0\0\0"
-    "\0\377\377\377\0\0\0\0\0\0\0\0\26\200\313\362\375\361\312\177\26\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\43\377\377\330\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\11\377\377\372\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\145\377\377\245\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\45\377\377\352\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\17\335\377\377\134\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\171\377\377\301\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\332\221\124\47\13\4\31"
-    "\132\330\377\377\345\7\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\21\136\364\377\377"
-    "\172\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377\375\107"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\357\26\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\377\377\377\377\377\377\377\377\377\361\121\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\377\377\377\377\377\377\371\115\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\50\165"
-    "\262\335\365\373\352\303\173\22\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\375\347\246\55\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\4\140\255\327\360\373\377\0\0\0\0\0\0\0\0\0"
-    "\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\377\372\360\327\254\136\4\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\10\307\377\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\304\7\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\157\377\377"
-    "\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0"
-    "\0\0\0\0\0\377\377\377\377\377\377\377\154\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\275\377\377\313\100"
-    "\22\3\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\3\23\103\320\377\377\273\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\350\377\377\66\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\71\377\377\346"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\370\377\377\10\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\11\377\377\367\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\377\377\377\0\5\151\313\362\360\317\202\23\0\0\0\0\0\0\0\0"
-    "\0\23\202\317\360\362\313\150\4\0\377\377\377\0\0\0\0\0\0\0\0\377"
-    "\377\377\0\0\75\256\352\373\350\255\104\0\0\0\0\0\0\54\220\315\357"
-    "\373\366\340\267\173\53\0\0\0\0\0\0\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\377"
-    "\377\377\0\0\0\0\0\324\377\377\127\0\0\0\0\0\0\0\0\130\377\377\324"
-    "\0\343\377\377\54\0\0\0\0\0\0\0\0\0\0\0\55\377\377\343\0\0\247\377"
-    "\377\352\26\0\0\0\0\0\30\354\377\377\246\0\0\0\0\320\377\377\143\0"
-    "\0\0\0\0\0\0\0\151\377\377\317\0\0\0\0\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\12\270"
-    "\377\377\377\377\377\377\354\100\0\0\0\0\0\0\0\100\353\377\377\377"
-    "\377\377\377\267\12\377\377\377\0\0\0\0\0\0\0\0\377\377\377\0\170"
-    "\377\377\377\377\377\377\377\0\0\0\0\0\200\375\377\377\377\377\377"
-    "\377\377\377\377\0\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\377\377\377"
-    "\0\0\0\0\0\175\377\377\257\0\0\0\0\0\0\0\0\260\377\377\174\0\252\377"
-    "\377\145\0\0\0\0\0\0\0\0\0\0\0\146\377\377\251\0\0\21\344\377\377"
-    "\262\0\0\0\0\0\266\377\377\343\20\0\0\0\0\161\377\377\301\0\0\0\0"
-    "\0\0\0\0\312\377\377\155\0\0\0\0\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\220\377\377\377\377"
-    "\377\377\377\377\364\56\0\0\0\0\0\56\365\377\377\377\377\377\377\377"
-    "\377\217\377\377\377\0\0\0\0\0\0\0\0\377\377\377\116\377\377\377\377"
-    "\377\377\377\377\0\0\0\0\135\377\377\377\377\377\377\377\377\377\377"
-    "\377\0\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0"
-    "\45\377\377\370\16\0\0\0\0\0\0\17\370\377\377\44\0\161\377\377\237"
-    "\0\0\0\0\0\0\0\0\0\0\0\240\377\377\160\0\0\0\104\376\377\377\145\0"
-    "\0\0\151\377\377\376\103\0\0\0\0\0\26\373\377\376\41\0\0\0\0\0\0\53"
-    "\377\377\371\23\0\0\0\0\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\360\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\375\362\164\37\6\34\156"
-    "\357\377\377\307\0\0\0\0\0\310\377\377\360\157\35\6\37\164\363\375"
-    "\377\377\377\0\0\0\0\0\0\0\0\377\377\377\326\377\255\102\20\5\34\131"
-    "\277\0\0\0\0\314\377\377\323\121\30\4\7\33\104\201\323\0\0\0\0\0\0"
-    "\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0"
-    "\0\0\0\377\377\377\0\0\0\0\0\0\315\377\377\136\0\0\0\0\0\0\137\377"
-    "\377\314\0\0\67\377\377\330\0\0\0\0\0\0\0\0\0\0\0\331\377\377\67\0"
-    "\0\0\0\220\377\377\364\43\0\45\365\377\377\217\0\0\0\0\0\0\0\263\377"
-    "\377\177\0\0\0\0\0\0\214\377\377\253\0\0\0\0\0\0\0\0\0\0\0\0\0\223"
-    "\377\377\377\126\0\0\0\0\0\0\0\0\0\0\3\377\377\376\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\2\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\373\72\0\0\0\0\0"
-    "\64\372\377\377\72\0\0\0\74\377\377\372\64\0\0\0\0\0\75\374\377\377"
-    "\377\0\0\0\0\0\0\0\0\377\377\377\377\175\0\0\0\0\0\0\0\0\0\0\0\366"
-    "\377\377\41\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\377\377\377\0\0\0\0"
-    "\0\0\165\377\377\266\0\0\0\0\0\0\267\377\377\164\0\0\6\370\377\376"
-    "\23\0\0\0\0\0\0\0\0\0\23\377\377\367\5\0\0\0\0\10\325\377\377\306"
-    "\7\310\377\377\324\10\0\0\0\0\0\0\0\124\377\377\335\1\0\0\0\0\4\350"
-    "\377\377\112\0\0\0\0\0\0\0\0\0\0\0\0\111\377\377\377\233\0\0\0\0\0"
-    "\0\0\0\0\0\0\31\377\377\364\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\365\377\377\27\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\377\377\377\235\0\0\0\0\0\0\0\232\377\377\220\0\0"
-    "\0\221\377\377\232\0\0\0\0\0\0\0\240\377\377\377\0\0\0\0\0\0\0\0\377"
-    "\377\377\307\1\0\0\0\0\0\0\0\0\0\0\0\361\377\377\123\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\37\376\377\372\23\0\0\0"
-    "\0\23\373\377\376\36\0\0\0\305\377\377\113\0\0\0\331\377\321\0\0\0"
-    "\114\377\377\304\0\0\0\0\0\0\60\372\377\377\320\377\377\371\60\0\0"
-    "\0\0\0\0\0\0\7\356\377\377\75\0\0\0\0\116\377\377\345\3\0\0\0\0\0"
-    "\0\0\0\0\0\0\25\350\377\377\326\12\0\0\0\0\0\0\0\0\0\0\0\144\377\377"
-    "\322\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\323\377\377\143\0\0\0\0\0\0\0\0\0\45\221\326\366\367"
-    "\321\212\53\0\0\0\0\0\0\12\232\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\377\377\377\107\0\0\0\0\0\0\0\107\377\377\304\0\0\0\306"
-    "\377\377\106\0\0\0\0\0\0\0\111\377\377\377\0\0\0\0\0\0\0\0\377\377"
-    "\377\140\0\0\0\0\0\0\0\0\0\0\0\0\260\377\377\377\347\253\167\107\31"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\377\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\306\377\377\145\0"
-    "\0\0\0\146\377\377\305\0\0\0\0\213\377\377\205\0\0\34\377\377\376"
-    "\26\0\0\205\377\377\213\0\0\0\0\0\0\0\171\377\377\377\377\377\170"
-    "\0\0\0\0\0\0\0\0\0\0\226\377\377\234\0\0\0\0\257\377\377\207\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\262\377\377\367\56\0\0\0\0\0\0\0\0\0\5\37\152\361"
-    "\377\377\206\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\207\377\377\361\152\37\5\0\0\0\0\0\200\372"
-    "\377\377\377\377\377\377\377\272\131\32\5\40\154\340\377\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\31\0\0\0\0\0\0\0"
-    "\31\377\377\347\0\0\0\351\377\377\31\0\0\0\0\0\0\0\32\377\377\377"
-    "\0\0\0\0\0\0\0\0\377\377\377\45\0\0\0\0\0\0\0\0\0\0\0\0\46\353\377"
-    "\377\377\377\377\377\377\327\151\1\0\0\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\377\377\377\0\0"
-    "\0\0\0\0\0\156\377\377\275\0\0\0\0\276\377\377\155\0\0\0\0\122\377"
-    "\377\276\0\0\137\377\376\377\131\0\0\277\377\377\121\0\0\0\0\0\0\0"
-    "\2\303\377\377\377\303\2\0\0\0\0\0\0\0\0\0\0\66\377\377\361\11\0\0"
-    "\26\372\377\377\47\0\0\0\0\0\0\0\0\0\0\0\151\377\377\377\152\0\0\0"
-    "\0\0\0\0\0\0\377\377\377\377\377\377\305\15\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\15\302\377"
-    "\377\377\377\377\377\0\0\0\0\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\377\377\377\6\0\0\0\0\0\0\0\6\377\377\367\0\0\0\370\377\377"
-    "\6\0\0\0\0\0\0\0\7\377\377\377\0\0\0\0\0\0\0\0\377\377\377\12\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\34\233\363\377\377\377\377\377\377\377\254"
-    "\2\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\30\375\377\374\27\0\0"
-    "\30\375\377\375\30\0\0\0\0\31\377\377\364\3\0\242\377\250\377\234"
-    "\0\3\364\377\377\30\0\0\0\0\0\0\0\0\57\377\377\377\57\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\327\377\377\132\0\0\162\377\377\305\0\0\0\0\0\0\0\0\0"
-    "\0\0\50\366\377\377\257\0\0\0\0\0\0\0\0\0\0\377\377\377\377\374\207"
-    "\2\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\1\200\372\377\377\377\377\0\0\0\0\377\336\156\44"
-    "\7\17\100\222\356\377\377\377\377\377\377\372\176\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\6\0\0\0\0\0\0\0\6\377\377"
-    "\370\0\0\0\371\377\377\6\0\0\0\0\0\0\0\7\377\377\377\0\0\0\0\0\0\0"
-    "\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\7\72\152\236\340\377"
-    "\377\377\377\144\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\377\377\377\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\276\377"
-    "\377\154\0\0\155\377\377\276\0\0\0\0\0\0\337\377\377\61\0\345\374"
-    "\41\374\337\0\61\377\377\337\0\0\0\0\0\0\0\0\0\252\377\377\377\251"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\170\377\377\271\0\0\323\377\377\144\0\0\0"
-    "\0\0\0\0\0\0\0\5\315\377\377\342\22\0\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\377\377\377\256\5\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\4\251\377\377\377\377\377\377\0\0\0\0"
-    "\230\11\0\0\0\0\0\0\11\142\272\357\370\333\224\46\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\31\0\0\0\0\0\0\0\31\377"
-    "\377\351\0\0\0\352\377\377\30\0\0\0\0\0\0\0\32\377\377\377\0\0\0\0"
-    "\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\110"
-    "\337\377\377\306\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\376\377\377\1\0\0\0\0\0\13\377\377\377\0\0\0\0\0\0\0\0\147"
-    "\377\377\304\0\0\305\377\377\146\0\0\0\0\0\0\246\377\377\152\50\377"
-    "\307\0\310\377\44\153\377\377\245\0\0\0\0\0\0\0\0\151\377\377\377"
-    "\377\377\150\0\0\0\0\0\0\0\0\0\0\0\34\375\377\375\33\64\377\377\365"
-    "\15\0\0\0\0\0\0\0\0\0\0\211\377\377\374\75\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\7\43\170\370\377\377\163\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\160\377\377\367\165\42\6\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\377\377\377\110\0\0\0\0\0\0\0\106\377\377\310"
-    "\0\0\0\311\377\377\106\0\0\0\0\0\0\0\111\377\377\377\0\0\0\0\0\0\0"
-    "\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\60\377"
-    "\377\363\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\365"
-    "\377\377\14\0\0\0\0\0\55\377\377\377\0\0\0\0\0\0\0\0\23\373\377\376"
-    "\35\36\376\377\372\23\0\0\0\0\0\0\155\377\377\244\153\377\200\0\201"
-    "\377\147\244\377\377\154\0\0\0\0\0\0\0\60\370\377\377\345\377\377"
-    "\367\57\0\0\0\0\0\0\0\0\0\0\0\272\377\377\167\225\377\377\241\0\0"
-    "\0\0\0\0\0\0\0\0\100\375\377\377\176\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\167\377\377\306\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\306\377\377\164\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\377\377\377\235\0\0\0\0\0\0\0\232\377\377\223\0\0\0\224\377"
-    "\377\231\0\0\0\0\0\0\0\237\377\377\377\0\0\0\0\0\0\0\0\377\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\12\377\377\373\0\0\0"
-    "\0\0\0\0\0\0\0\372\377\377\14\0\0\0\0\0\0\0\0\0\0\0\343\377\377\63"
-    "\0\0\0\0\0\163\377\377\377\0\0\0\0\0\0\0\0\0\267\377\377\164\165\377"
-    "\377\266\0\0\0\0\0\0\0\63\377\377\335\255\377\72\0\73\377\253\335"
-    "\377\377\63\0\0\0\0\0\0\14\332\377\377\320\20\320\377\377\331\14\0"
-    "\0\0\0\0\0\0\0\0\0\133\377\377\331\356\377\377\102\0\0\0\0\0\0\0\0"
-    "\0\21\342\377\377\300\2\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\42\377\377"
-    "\355\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\356\377\377\41\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\373\71\0\0\0\0\0\64\372\377\377\76\0\0\0\100\377\377\372\64\0"
-    "\0\0\0\0\72\374\377\377\377\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\265\56\0\0\0\0\0\0\0\141\377\377\343\0\0\0\0\0\0"
-    "\0\0\0\0\343\377\377\111\0\0\0\0\0\0\0\0\0\0\0\274\377\377\213\0\0"
-    "\0\0\21\345\377\377\377\0\0\0\0\0\0\0\0\0\137\377\377\313\314\377"
-    "\377\136\0\0\0\0\0\0\0\4\365\377\377\364\360\3\0\4\360\363\377\377"
-    "\365\4\0\0\0\0\0\0\245\377\377\363\46\0\46\363\377\377\244\0\0\0\0"
-    "\0\0\0\0\0\0\11\361\377\377\377\377\343\2\0\0\0\0\0\0\0\0\0\251\377"
-    "\377\354\33\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\6\377\377\374\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\375\377\377\5\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\375\362"
-    "\163\36\5\33\155\357\377\377\313\0\0\0\0\0\314\377\377\357\156\34"
-    "\5\35\162\362\374\377\377\377\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\377\376\273\142\45\5\6\51\201\371\377\377\234\0"
-    "\0\0\0\0\0\0\0\0\0\261\377\377\341\121\22\1\0\0\0\0\0\0\0\0\174\377"
-    "\377\374\160\22\11\101\320\354\377\377\377\0\0\0\0\0\0\0\0\0\17\370"
-    "\377\377\377\377\370\16\0\0\0\0\0\0\0\0\301\377\377\377\255\0\0\0"
-    "\256\377\377\377\300\0\0\0\0\0\0\144\377\377\377\133\0\0\0\132\377"
-    "\377\377\143\0\0\0\0\0\0\0\0\0\0\234\377\377\377\377\212\0\0\0\0\0"
-    "\0\0\0\0\137\377\377\377\116\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\377\377\377\223\377\377\377\377\377\377\377\377\365\60\0\0\0\0\0"
-    "\60\365\377\377\377\377\377\377\377\377\213\377\377\377\0\0\0\0\0"
-    "\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377"
-    "\377\377\377\377\377\361\40\0\0\0\0\0\0\0\0\0\0\126\377\377\377\377"
-    "\377\377\377\377\377\0\0\0\0\0\36\371\377\377\377\377\377\377\377"
-    "\157\377\377\377\0\0\0\0\0\0\0\0\0\0\260\377\377\377\377\257\0\0\0"
-    "\0\0\0\0\0\0\207\377\377\377\147\0\0\0\150\377\377\377\207\0\0\0\0"
-    "\0\54\366\377\377\234\0\0\0\0\0\233\377\377\366\54\0\0\0\0\0\0\0\0"
-    "\0\75\377\377\377\377\57\0\0\0\0\0\0\0\0\0\362\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\14"
-    "\276\377\377\377\377\377\377\355\102\0\0\0\0\0\0\0\101\355\377\377"
-    "\377\377\377\377\266\11\377\377\377\0\0\0\0\0\0\0\0\377\377\377\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\110\316\377\377\377\377\377\377\377\377\340"
-    "\66\0\0\0\0\0\0\0\0\0\0\0\1\247\377\377\377\377\377\377\377\377\0"
-    "\0\0\0\0\0\161\377\377\377\377\377\377\244\1\377\377\377\0\0\0\0\0"
-    "\0\0\0\0\0\130\377\377\377\377\127\0\0\0\0\0\0\0\0\0\116\377\377\377"
-    "\41\0\0\0\42\377\377\377\115\0\0\0\0\13\326\377\377\323\11\0\0\0\0"
-    "\0\11\322\377\377\326\13\0\0\0\0\0\0\0\0\1\335\377\377\326\0\0\0\0"
-    "\0\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377\377\377\377\0"
-    "\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\377\377\377\0\6\155\315\362\362\320\203\24\0\0"
-    "\0\0\0\0\0\0\0\24\203\320\362\362\314\151\4\0\377\377\377\0\0\0\0"
-    "\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\101\234\333\372"
-    "\370\344\265\147\13\0\0\0\0\0\0\0\0\0\0\0\0\0\1\126\261\343\372\377"
-    "\377\377\377\0\0\0\0\0\0\0\121\303\363\370\313\142\1\0\377\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\13\365\377\377\364\12\0\0\0\0\0\0\0\0\0\25\377"
-    "\377\333\0\0\0\0\0\333\377\377\25\0\0\0\0\241\377\377\365\51\0\0\0"
-    "\0\0\0\0\50\364\377\377\240\0\0\0\0\0\0\0\0\0\266\377\377\173\0\0"
-    "\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\377\377\377\1\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\1\377\377\376\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\25\372\377"
-    "\377\41\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\365\377\377\16\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\17\377\377\363\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\172\377\377\303\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\341"
-    "\377\377\100\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\104\377\377\340\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\14\351\377\377\142\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\264\377\377"
-    "\323\105\22\2\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\2\23\110\327\377\377\262\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\2\52\272\377\377\360\13\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\141\377\377"
-    "\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0"
-    "\0\0\0\0\0\377\377\377\377\377\377\377\136\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\174\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\4\272\377\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0"
-    "\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\267\3\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\274\4"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\2\131\251\327\361\373\377\0\0\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\377\373\360\326\251\127\2\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\370\326\167\5\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\1\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\1\311\377\377\277\0\0\0\0\0\0\0\0\0\0\300\377\377\311\1"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0"
-    "\0\0\0\0\377\377\377\377\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0"
-    "\0\243\377\377\314\0\0\24\376\377\377\144\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\2\0\0\0\0\0\0\0\0\0\0\122\303\364\364\301\117\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\112\254\341\367\367\326\226\67\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\141\377\377"
-    "\377\75\0\0\0\0\0\0\0\0\0\0\77\377\377\377\137\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\73\377\377\304\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0"
-    "\0\377\377\377\377\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\341"
-    "\377\377\215\0\0\121\377\377\377\44\0\0\0\0\0\0\0\0\0\0\377\377\3"
-    "\0\0\0\0\0\0\0\0\0\214\377\377\377\377\377\377\204\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\2\241\377\377\377\377\377\377\377\377\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\7\342\377\377"
-    "\306\0\0\0\0\0\0\0\0\0\0\0\0\310\377\377\341\6\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\262\377\377\116\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0"
-    "\377\377\377\377\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\37\377"
-    "\377\377\117\0\0\217\377\377\343\0\0\0\0\0\0\0\10\155\300\355\377"
-    "\377\364\326\252\157\46\0\0\0\0\123\377\377\377\377\377\377\377\377"
-    "\117\0\0\0\0\0\0\0\0\0\0\0\0\155\377\377\377\377\377\377\377\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\152\377\377\377\126\0\0\0\0\0\0\0\0\0\0\0\0\126\377\377\377"
-    "\150\0\0\0\0\0\0\0\0\0\0\44\301\61\0\0\0\377\377\377\0\0\0\61\301"
-    "\44\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\51\376\377\326"
-    "\1\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\377\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\377\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\135\377\377\376\22\0\0\315\377\377\244\0\0"
-    "\0\0\0\0\50\334\377\377\377\377\377\377\377\377\377\377\0\0\0\0\303"
-    "\377\377\256\26\27\262\377\377\301\0\0\0\0\0\0\0\0\0\0\0\0\320\377"
-    "\377\377\377\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\1\333\377\377\353\5\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\6\354\377\377\330\1\0\0\0\0\0\0\0\0\0\240\377\375\226"
-    "\22\0\377\377\377\0\22\227\375\377\240\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\236\377\377\142\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0"
-    "\0\377\377\377\377\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\233\377"
-    "\377\321\0\0\16\374\377\377\144\0\0\0\0\0\17\337\377\377\377\377\377"
-    "\377\377\377\377\377\377\0\0\0\0\365\377\377\26\0\0\27\377\377\364"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\367\377\377\377\174\22\5\37\136\302\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\107"
-    "\377\377\377\221\0\0\0\0\0\0\0\0\0\0\0\0\0\0\223\377\377\377\103\0"
-    "\0\0\0\0\0\0\0\0\204\370\377\377\354\147\377\377\377\150\355\377\377"
-    "\370\204\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\32"
-    "\371\377\345\6\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0"
-    "\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\331\377\377\223\0\0\111\377"
-    "\377\377\44\0\0\0\0\0\174\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\0\0\0\0\365\377\377\25\0\0\26\377\377\364\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\364\377\377\377\13\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\244\377\377\377\77\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\101\377\377\377\237\0\0\0\0\0\0\0\0\0\0\40"
-    "\251\377\377\377\377\377\377\377\377\377\252\40\0\0\0\0\0\0\0\0\0"
-    "\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\212\377\377\166\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\377\377\377\377\0\0"
-    "\0\0\70\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\0\0\0\314\377\377\377\257\41\377\377\12\42\113\204\323\0"
-    "\0\0\0\304\377\377\255\26\26\255\377\377\302\0\0\0\0\0\0\0\1\0\0\0"
-    "\0\306\377\377\377\130\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\5\362\377\377\362\3\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\3\362\377\377\357\3\0\0\0\0\0\0\0\0\0\0\0\71\307"
-    "\377\377\377\377\377\312\73\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\17\361\377\360\16\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0"
-    "\0\0\0\377\377\377\377\0\0\0\0\377\377\377\377\0\0\0\0\70\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\0\0\0"
-    "\362\377\377\377\26\0\377\377\0\0\0\0\0\0\0\0\0\126\377\377\377\377"
-    "\377\377\377\377\121\0\0\0\0\0\55\235\270\0\0\0\0\164\377\377\377"
-    "\337\14\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\75\377\377\377\277\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\300\377\377\377\71\0\0\0\0\0\0\0\0\0\0\0\67\306\377\377\377\377"
-    "\377\311\72\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\167\377\377\211\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\377\0\0\0\0\377\377\377\377\0\0\0\0\70\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\0\0\0\372\377\377\377\31"
-    "\0\377\377\0\0\0\0\0\0\0\0\0\0\220\377\377\377\377\377\377\210\0\0"
-    "\0\1\112\273\377\377\321\14\0\0\0\22\367\377\377\377\234\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\170\377\377\377\211\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\212\377\377\377"
-    "\165\0\0\0\0\0\0\0\0\0\36\245\376\377\377\377\377\377\377\377\377"
-    "\247\36\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\6\346"
-    "\377\371\31\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\1\357\377\377\172\0\0\131\377\377\376\23\0\0"
-    "\0\0\0\0\341\377\377\377\254\15\377\377\0\0\0\0\0\0\0\0\0\0\0\125"
-    "\304\365\364\302\121\0\0\12\150\330\377\375\263\102\0\0\0\0\12\250"
-    "\377\377\377\377\377\113\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\251\377\377\377\125\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\125\377\377\377\247\0\0\0\0\0\0\0\0\200\367\377\377\351"
-    "\141\377\377\377\141\352\377\377\367\200\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\143\377\377\235\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\373\377\377\373\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\54\377\377\377\100"
-    "\0\0\224\377\377\330\0\0\0\0\0\0\0\237\377\377\377\377\364\377\377"
-    "\112\20\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\32\206\355\377\363\224\45\0"
-    "\0\0\0\0\12\305\377\377\377\377\377\377\345\20\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\315\377\377\377\64\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\65\377\377\377\313\0\0\0\0\0\0\0\0"
-    "\241\377\374\224\20\0\377\377\377\0\20\224\374\377\240\0\0\0\0\0\0"
-    "\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\1\327\377\376\50\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\345\377\377"
-    "\345\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\146"
-    "\377\377\373\12\0\0\316\377\377\235\0\0\0\0\0\0\0\55\372\377\377\377"
-    "\377\377\377\377\371\250\43\0\0\0\0\0\0\0\0\0\0\0\63\244\372\377\341"
-    "\165\20\0\0\0\0\0\0\0\237\377\377\377\272\377\377\377\377\240\0\0"
-    "\20\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\351\377\377\377\42\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\43\377\377"
-    "\377\350\0\0\0\0\0\0\0\0\44\301\60\0\0\0\377\377\377\0\0\0\61\301"
-    "\44\0\0\0\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\377\377\377\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\117\377\377\261\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\315\377\377\317"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\241\377"
-    "\377\313\0\0\14\374\377\377\143\0\0\0\0\0\0\0\0\140\374\377\377\377"
-    "\377\377\377\377\377\364\107\0\0\0\0\0\0\0\2\121\302\377\377\307\126"
-    "\3\0\0\0\0\0\0\0\0\66\377\377\377\230\0\247\377\377\377\377\113\0"
-    "\2\377\377\377\370\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\367\377\377\377\21\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\22\377\377\377"
-    "\366\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377"
-    "\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\305\377\377\73\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\265\377\377\270\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\333\377\377\221\0\0\103"
-    "\377\377\377\51\0\0\0\0\0\0\0\0\0\72\310\377\377\377\377\377\377\377"
-    "\377\361\35\0\0\0\0\15\157\335\377\373\250\67\0\0\0\125\303\364\363"
-    "\300\115\0\0\235\377\377\377\42\0\23\350\377\377\377\344\20\20\377"
-    "\377\377\340\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\376"
-    "\377\377\377\4\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\4\377\377\377\375\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377"
-    "\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\73\377\377\304\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\235\377\377\241\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\70\0\0\0\0\0\0\0\0\57\172\377\377"
-    "\377\377\377\377\377\217\0\0\0\6\352\377\356\211\34\0\0\0\0\217\377"
-    "\377\377\377\377\377\204\0\334\377\377\377\4\0\0\120\377\377\377\377"
-    "\237\105\377\377\377\261\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\367\377\377\377\21\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\22\377"
-    "\377\377\365\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377"
-    "\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\262\377\377\116\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\204\377\377\213\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\70\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\65\305\377\377\377\326\0\0\0\0\215\152\13\0\0\0\0\0\125\377\377\377"
-    "\377\377\377\377\377\117\371\377\377\377\24\0\0\0\244\377\377\377"
-    "\377\326\377\377\377\143\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\351\377\377\377\43\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\44\377"
-    "\377\377\347\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\51\376\377"
-    "\326\1\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\70\0\0\0\0\0\0\0\0\0\0\377\377\0\37\377\377\377\365\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\304\377\377\255\25\31\265\377\377\301\371\377\377\377"
-    "\135\0\0\0\22\346\377\377\377\377\377\377\345\12\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\315\377\377\377\65\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\66\377\377\377\313\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\236"
-    "\377\377\142\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\352\377\377\201\0\0\123\377\377\377\31\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\377\377\0\27\377\377\377\365\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\365\377\377\26\0\0\30\377\377\364\332\377\377\377\341\25"
-    "\0\0\0\115\377\377\377\377\377\376\115\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\250\377\377\377\127\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\130\377\377\377\247\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\32\371\377\345\6\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\51\377\377\377\103\0\0\221\377\377\333"
-    "\0\0\0\0\0\0\0\0\0\336\234\145\70\27\6\377\377\42\264\377\377\377"
-    "\321\0\0\0\0\0\0\0\0\0\0\0\0\365\377\377\25\0\0\26\377\377\364\226"
-    "\377\377\377\377\333\120\14\6\106\355\377\377\377\377\257\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\170\377\377\377\214"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\215\377\377\377\166\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\212\377\377\166\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\147\377\377"
-    "\372\12\0\0\317\377\377\235\0\0\0\0\0\0\0\0\0\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\176\0\0\0\0\0\0\0\0\0\0\0\0\304\377"
-    "\377\253\24\27\260\377\377\302\50\373\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\370\40\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\74\377\377\377\300\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\301\377\377\377\72\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\17"
-    "\361\377\360\16\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\245\377\377\307\0\0\17\375\377\377"
-    "\137\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\336\17\0\0\0\0\0\0\0\0\0\0\0\0\127\377\377\377\377\377\377\377"
-    "\377\120\0\164\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\244\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\4\361"
-    "\377\377\363\4\0\0\0\0\0\0\0\0\0\0\0\0\0\0\4\363\377\377\361\4\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\377\377\0\0\0\0\0\0\0\0\0\0\0\167\377\377\211\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\342"
-    "\377\377\211\0\0\113\377\377\377\41\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\377\377\377\377\377\377\377\377\333\46\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\223\377\377\377\377\377\377\207\0\0\0\151\370\377\377\377\377\377"
-    "\377\377\356\262\377\377\377\376\61\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\243\377\377\377\101\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\103\377\377\377\241\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\40\377\377\377\377\277\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0"
-    "\6\346\377\371\31\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\41\377\377\377\113\0\0\211\377\377"
-    "\343\0\0\0\0\0\0\0\0\0\0\41\143\231\305\345\370\377\377\360\304\160"
-    "\11\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\127\304\365\364\302\120\0\0\0"
-    "\0\0\33\206\314\357\372\346\266\150\16\4\320\377\377\377\272\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\106\377\377\377\223"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\225\377\377\377\105\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\167\377\377\377\362\37\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0"
-    "\0\0\0\0\0\0\0\0\143\377\377\235\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\4\377\377\3\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\1\332\377\377\354"
-    "\6\0\0\0\0\0\0\0\0\0\0\0\0\6\355\377\377\331\1\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\316\377\377\377\143\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\1\327\377\376\50\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\3\377\377\2\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\151\377\377\377\127\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\130\377\377\377\150\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\46\377\377\377\264\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\117\377\377"
-    "\261\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\2\377\377\1\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\6\342\377\377\307\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\310\377\377\341\6\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\175\377\377"
-    "\354\30\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\305\377\377\73\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\1\377\377\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\140\377\377\377\76\0\0\0\0\0\0\0\0\0\0\77\377\377\377"
-    "\137\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\324\377\377\127\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\1\311\377"
-    "\377\277\0\0\0\0\0\0\0\0\0\0\300\377\377\311\1\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\5\147\277\356\374\355\277\146\4\0"
-    "\0\0\0\0\0\0\0\30\111\172\253\335\376\377\377\377\377\0\0\0\0\0\0"
-    "\0\0\0\41\143\230\305\345\367\372\353\307\213\53\0\0\0\0\0\0\0\0\44"
-    "\153\243\317\356\373\365\337\261\143\11\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\11\335\377\377\377\377\0\0\0\0\0\0\0\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\0\0\0\0\0\0\0\0\0\5\130\250\332\365\374\354"
-    "\304\205\57\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\0\0\0\0\0\0\0\15\163\302\355\373\355\302\162\15\0"
-    "\0\0\0\0\0\0\0\0\0\51\226\330\367\373\346\267\142\5\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\77\231\324\365\372\352\300\166\22\0\0\0\0\0\0\0\0\33\317\377\377"
-    "\377\377\377\377\377\315\31\0\0\0\0\0\0\0\377\377\377\377\377\377"
-    "\377\377\377\377\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377"
-    "\377\377\376\230\11\0\0\0\0\0\0\377\377\377\377\377\377\377\377\377"
-    "\377\341\71\0\0\0\0\0\0\0\0\0\0\0\0\0\206\377\377\377\377\377\0\0"
-    "\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377\377\377\377\0\0"
-    "\0\0\0\0\0\0\77\335\377\377\377\377\377\377\377\377\377\0\0\0\0\0"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\0\0\0"
-    "\0\0\0\57\340\377\377\377\377\377\377\377\336\55\0\0\0\0\0\0\0\0\162"
-    "\373\377\377\377\377\377\377\377\324\43\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\107\322\377\377\377"
-    "\377\377\377\377\377\353\105\0\0\0\0\0\0\11\322\377\377\377\377\377"
-    "\377\377\377\377\317\7\0\0\0\0\0\0\377\377\377\377\377\377\377\377"
-    "\377\377\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\272\2\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377\377"
-    "\364\45\0\0\0\0\0\0\0\0\0\0\0\51\372\377\377\377\377\377\0\0\0\0\0"
-    "\0\0\377\377\377\377\377\377\377\377\377\377\377\377\377\0\0\0\0\0"
-    "\0\0\121\373\377\377\377\377\377\377\377\377\377\377\0\0\0\0\0\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\0\0\0\0\0"
-    "\24\347\377\377\377\377\377\377\377\377\377\345\22\0\0\0\0\0\0\134"
-    "\377\377\377\377\377\377\377\377\377\377\337\21\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\377\377\377\377\377\377\377\377\367\52\0\0\0\0\0\175\377\377\377"
-    "\377\377\377\377\377\377\377\377\171\0\0\0\0\0\0\377\377\377\377\377"
-    "\377\377\377\377\377\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\145\0\0\0\0\0\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\245\0\0\0\0\0\0\0\0\0\0\0\300\377\377\377\377"
-    "\377\377\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\0\0\0\0\0\0\44\364\377\377\377\377\377\377\377\377\377\377"
-    "\377\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\341\0\0\0\0\0\207\377\377\377\377\377\377\377\377\377\377\377"
-    "\205\0\0\0\0\0\16\357\377\377\377\377\377\377\377\377\377\377\377"
-    "\221\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377\377\377\246\0\0"
-    "\0\0\6\354\377\377\377\377\152\14\154\377\377\377\377\352\5\0\0\0"
-    "\0\0\346\263\200\115\32\377\377\377\377\377\0\0\0\0\0\0\0\0\0\334"
-    "\227\137\62\21\4\27\152\364\377\377\377\377\305\0\0\0\0\0\330\213"
-    "\116\41\10\7\70\306\377\377\377\377\350\0\0\0\0\0\0\0\0\0\0\140\377"
-    "\377\377\377\377\377\377\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\253\377\377\377\377\361\166\44\6\14\62\164\316"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\330\377\377\377\377\201\0\0\0\0\0\325"
-    "\377\377\377\316\57\5\57\316\377\377\377\323\0\0\0\0\0\152\377\377"
-    "\377\377\356\105\7\103\356\377\377\377\365\14\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\367\232\103"
-    "\20\3\46\257\377\377\377\377\347\0\0\0\0\111\377\377\377\377\272\0"
-    "\0\0\276\377\377\377\377\106\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\141\377\377\377\377\363\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\35\377\377\377\377\370\0\0\0\0\0\0\0\0\0\22\353\377"
-    "\377\377\377\377\377\377\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\33\375\377\377\377\366\60\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\74\377\377\377\377\376\40\0\0\0\0\0\366\377\377\377"
-    "\56\0\0\0\56\377\377\377\365\0\0\0\0\0\261\377\377\377\377\155\0\0"
-    "\0\155\377\377\377\377\124\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\11\141\313\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\312\140"
-    "\10\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\252\33\0\0\0\0\0\23\377"
-    "\377\377\377\372\0\0\0\0\210\377\377\377\377\150\0\0\0\153\377\377"
-    "\377\377\207\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\17\377\377\377\377\357\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\26\377\377\377\377\322\0\0\0\0\0\0\0\0\0\234\377\377\345\377\377"
-    "\377\377\377\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\151\377\377\377\377\211\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\237\377\377\377\377\275\0\0\0\0\0\0\370\377\377\377\4\0\0\0\5"
-    "\377\377\377\370\0\0\0\0\0\341\377\377\377\377\42\0\0\0\42\377\377"
-    "\377\377\221\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\44\215\355\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\377\377\355\214\44\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\34\377\377\377\377\331\0\0\0\0\270\377\377\377\377\71\0\0\0\74"
-    "\377\377\377\377\266\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\14\377\377\377\377\270\0\0\0\0\0\0\0"
-    "\0\0\0\6\63\275\377\377\377\377\140\0\0\0\0\0\0\0\0\73\376\377\377"
-    "\131\377\377\377\377\377\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\245\377\377\377\377\67\124\305\365\371\327\205\17"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\15\364\377\377\377\377\133\0\0\0\0\0\0"
-    "\324\377\377\377\57\0\0\0\60\377\377\377\323\0\0\0\0\0\364\377\377"
-    "\377\377\5\0\0\0\6\377\377\377\377\274\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\3\117\271\376\377\377\377\377\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\376\270\116\3\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\1\245\377\377\377\377\164\0\0\0"
-    "\0\331\377\377\377\377\35\0\0\0\36\377\377\377\377\327\0\0\0\0\0\0"
-    "\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\120"
-    "\377\377\377\377\140\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\373"
-    "\167\0\0\0\0\0\0\0\0\5\323\377\377\276\0\377\377\377\377\377\0\0\0"
-    "\0\0\0\0\377\377\377\377\271\356\375\357\305\167\20\0\0\0\0\0\0\0"
-    "\317\377\377\377\377\210\377\377\377\377\377\377\334\34\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\145\377\377\377\377\357\10\0\0\0\0\0\0\177\377\377"
-    "\377\315\56\4\56\316\377\377\377\177\0\0\0\0\0\374\377\377\377\377"
-    "\5\0\0\0\6\377\377\377\377\333\0\0\0\0\0\0\0\0\0\377\377\377\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\27\173\341\377\377\377\377\377\377\377\0\0\0\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\0\0\0\377\377"
-    "\377\377\377\377\377\341\172\26\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\1\226\377\377\377\377\270\3\0\0\0\0\357\377\377\377\377\13\122\351"
-    "\350\136\377\377\377\377\355\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\5\321\377\377\377\334\6\0\0\0\0\0"
-    "\0\0\0\377\377\377\377\377\312\203\41\0\0\0\0\0\0\0\0\0\167\377\377"
-    "\372\52\0\377\377\377\377\377\0\0\0\0\0\0\0\377\377\377\377\377\377"
-    "\377\377\377\377\353\111\0\0\0\0\0\0\352\377\377\377\377\375\377\377"
-    "\377\377\377\377\377\276\0\0\0\0\0\0\0\0\0\0\0\0\310\377\377\377\377"
-    "\226\0\0\0\0\0\0\0\14\324\377\377\377\377\377\377\377\377\377\326"
-    "\14\0\0\0\0\0\360\377\377\377\377\42\0\0\0\42\377\377\377\377\357"
-    "\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\75\247\371\377\377\377"
-    "\377\377\377\351\215\54\0\0\0\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\0\0\0\55\216\351\377\377\377\377\377"
-    "\377\371\246\74\0\0\0\0\0\0\0\0\0\0\0\0\0\0\1\231\377\377\377\377"
-    "\267\11\0\0\0\0\0\373\377\377\377\377\2\351\377\377\355\377\377\377"
-    "\377\372\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\224\377\377\377\374\76\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\377\377\366\275\137\3\0\0\0\0\0\0\0\37\365\377\377\213\0\0\377\377"
-    "\377\377\377\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377"
-    "\377\373\112\0\0\0\0\0\371\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\103\0\0\0\0\0\0\0\0\0\0\53\377\377\377\377\377\64\0\0"
-    "\0\0\0\0\0\0\22\240\377\377\377\377\377\377\377\253\25\0\0\0\0\0\0"
-    "\321\377\377\377\377\154\0\0\0\155\377\377\377\377\372\0\0\0\0\0\0"
-    "\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\377\377\0\0\0\0\0\0\0\0\0\14\151\322\377\377\377\377\377\377\372"
-    "\257\117\4\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\0\0\0\0\0\4\117\260\372\377\377\377\377\377\377\322"
-    "\150\14\0\0\0\0\0\0\0\0\0\0\0\210\377\377\377\377\227\4\0\0\0\0\0"
-    "\0\377\377\377\377\377\0\353\377\377\352\377\377\377\377\376\0\0\0"
-    "\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\170"
-    "\377\377\377\377\163\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377"
-    "\377\320\41\0\0\0\0\0\0\262\377\377\344\14\0\0\377\377\377\377\377"
-    "\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377\377\377\354"
-    "\21\0\0\0\0\376\377\377\377\377\355\103\7\105\360\377\377\377\377"
-    "\233\0\0\0\0\0\0\0\0\0\0\216\377\377\377\377\321\0\0\0\0\0\0\0\0\0"
-    "\145\343\377\377\377\377\377\377\377\350\152\0\0\0\0\0\0\234\377\377"
-    "\377\377\356\104\6\102\355\377\377\377\377\376\0\0\0\0\0\0\0\0\0\377"
-    "\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0"
-    "\0\0\0\0\0\0\0\225\362\377\377\377\377\377\377\321\161\25\0\0\0\0"
-    "\0\0\0\0\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\0\0\0\0\0\0\0\0\25\161\322\377\377\377\377\377\377\361\224\0"
-    "\0\0\0\0\0\0\0\0\75\377\377\377\377\164\0\0\0\0\0\0\0\0\373\377\377"
-    "\377\377\2\124\352\351\126\377\377\377\377\372\0\0\0\0\0\0\0\0\0\0"
-    "\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\157\377\377\377\377"
-    "\214\0\0\0\0\0\0\0\0\0\0\0\0\0\10\65\252\377\377\377\377\334\17\0"
-    "\0\0\0\121\377\377\377\127\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0"
-    "\321\172\73\24\4\21\110\300\377\377\377\377\377\170\0\0\0\0\373\377"
-    "\377\377\377\155\0\0\0\160\377\377\377\377\320\0\0\0\0\0\0\0\0\0\6"
-    "\353\377\377\377\377\157\0\0\0\0\0\0\0\0\221\377\377\377\377\377\377"
-    "\377\377\377\377\377\223\0\0\0\0\0\106\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\370\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\355"
-    "\223\62\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\63\223\355\377\377\377\377\377\0\0\0\0\0\0\0\0"
-    "\0\253\377\377\377\227\0\0\0\0\0\0\0\0\0\357\377\377\377\377\13\0"
-    "\0\0\15\377\377\377\377\355\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\152\377\377\377\377\227\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\246\377\377\377\377\177\0\0\0\0\342\377\377\274"
-    "\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\2\256\377"
-    "\377\377\377\306\0\0\0\0\361\377\377\377\377\42\0\0\0\43\377\377\377"
-    "\377\356\0\0\0\0\0\0\0\0\0\124\377\377\377\377\371\23\0\0\0\0\0\0"
-    "\0\111\377\377\377\372\174\35\5\36\176\372\377\377\377\111\0\0\0\0"
-    "\0\302\377\377\377\377\377\377\377\377\377\377\377\377\350\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\377\377\377\377\231\10\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\11\232\377\377"
-    "\377\377\0\0\0\0\0\0\0\0\0\346\377\377\377\50\0\0\0\0\0\0\0\0\0\331"
-    "\377\377\377\377\35\0\0\0\36\377\377\377\377\330\0\0\0\0\0\0\0\0\0"
-    "\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\150\376\377\377\377"
-    "\234\1\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\56\377\377\377\377\321\0"
-    "\0\0\0\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\0\51\377\377\377\377\360\0\0\0\0\335\377"
-    "\377\377\377\5\0\0\0\6\377\377\377\377\373\0\0\0\0\0\0\0\0\0\267\377"
-    "\377\377\377\253\0\0\0\0\0\0\0\0\267\377\377\377\153\0\0\0\0\0\155"
-    "\377\377\377\266\0\0\0\0\0\36\336\377\377\377\377\377\377\222\377"
-    "\377\377\377\315\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\342\205\46\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\46\205\342\377\377\377\377\377\0\0\0\0\0\0\0\0\0\373\377"
-    "\377\377\10\0\0\0\0\0\0\0\0\0\270\377\377\377\377\71\0\0\0\74\377"
-    "\377\377\377\266\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0"
-    "\0\0\0\0\0\0\146\376\377\377\377\236\1\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\6\377\377\377\377\365\0\0\0\0\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\6\377"
-    "\377\377\377\374\0\0\0\0\277\377\377\377\377\5\0\0\0\6\377\377\377"
-    "\377\363\0\0\0\0\0\0\0\0\35\375\377\377\377\377\110\0\0\0\0\0\0\0"
-    "\0\356\377\377\377\17\0\0\0\0\0\17\377\377\377\355\0\0\0\0\0\0\20"
-    "\207\331\372\366\306\130\65\377\377\377\377\242\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\231"
-    "\364\377\377\377\377\377\377\305\146\17\0\0\0\0\0\0\0\0\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\0\0\0\0\0\0\0"
-    "\0\17\146\306\377\377\377\377\377\377\364\231\0\0\0\0\0\0\0\0\0\377"
-    "\377\377\377\0\0\0\0\0\0\0\0\0\0\211\377\377\377\377\147\0\0\0\153"
-    "\377\377\377\377\207\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0"
-    "\0\0\0\0\0\0\0\145\376\377\377\377\235\2\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\31\377\377\377\377\372\0\0\0\0\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\47"
-    "\377\377\377\377\356\0\0\0\0\223\377\377\377\377\42\0\0\0\43\377\377"
-    "\377\377\337\0\0\0\0\0\0\0\0\175\377\377\377\377\343\2\0\0\0\0\0\0"
-    "\0\0\373\377\377\377\17\0\0\0\0\0\20\377\377\377\372\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\207\377\377\377\377\147\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\16\155\325"
-    "\377\377\377\377\377\377\366\246\106\2\0\0\0\0\0\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\0\0\0\0\0\2\107\246\366"
-    "\377\377\377\377\377\377\325\155\16\0\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\111\377\377\377\377\270\0\0\0\274\377\377"
-    "\377\377\107\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0"
-    "\0\0\144\376\377\377\377\234\1\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\202\377\377\377\377\336\0\0\0\0\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\1\246\377\377"
-    "\377\377\301\0\0\0\0\127\377\377\377\377\154\0\0\0\160\377\377\377"
-    "\377\256\0\0\0\0\0\0\0\1\336\377\377\377\377\204\0\0\0\0\0\0\0\0\0"
-    "\350\377\377\377\154\0\0\0\0\0\161\377\377\377\347\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\55\365\377\377\377\374\31\0\0\0\0\0\0\0\0\0\377\377\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\100\252\372\377\377\377\377\377\377\344\207\47\0\0\0\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\0\0\0"
-    "\47\207\344\377\377\377\377\377\377\372\252\100\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\6\354\377\377\377\377\151\13"
-    "\152\377\377\377\377\353\5\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377"
-    "\0\0\0\0\0\0\0\0\142\376\377\377\377\233\1\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\331\217\127\57\23\6\4\47\217\376\377\377\377\377\242\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\323\202\106\36\10\4\27"
-    "\115\274\377\377\377\377\377\155\0\0\0\0\17\367\377\377\377\355\102"
-    "\6\105\357\377\377\377\377\150\0\0\0\0\0\0\0\103\377\377\377\377\376"
-    "\43\0\0\0\0\0\0\0\0\0\264\377\377\377\372\173\34\4\36\200\373\377"
-    "\377\377\263\0\0\0\0\0\314\160\56\13\5\43\164\360\377\377\377\377"
-    "\250\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\30\176\343"
-    "\377\377\377\377\377\377\377\0\0\0\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\0\0\0\377\377\377\377\377\377\377"
-    "\343\175\30\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\176\377\377\377\377\377\377\377\377\377\377\377\173\0\0\0\0"
-    "\0\0\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\0"
-    "\0\0\376\377\377\377\377\377\377\377\377\377\377\377\377\377\377\10"
-    "\0\0\0\377\377\377\377\377\377\377\377\377\377\377\377\377\377\71"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\337\12\0\0\0\0\0\226\377"
-    "\377\377\377\377\377\377\377\377\377\377\355\15\0\0\0\0\0\0\0\246"
-    "\377\377\377\377\277\0\0\0\0\0\0\0\0\0\0\127\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\126\0\0\0\0\0\377\377\377\377\377\377"
-    "\377\377\377\377\377\363\41\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\3\121\273\376\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\376\273\121\3\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\11\323"
-    "\377\377\377\377\377\377\377\377\377\322\10\0\0\0\0\0\0\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\0\0\0\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\10\0\0\0\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\214\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\356\61\0\0\0\0\0\0\23\342\377\377\377\377\377"
-    "\377\377\377\377\377\130\0\0\0\0\0\0\0\21\367\377\377\377\377\135"
-    "\0\0\0\0\0\0\0\0\0\0\1\270\377\377\377\377\377\377\377\377\377\377"
-    "\377\267\1\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377\372\116"
-    "\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\45"
-    "\216\356\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\356\216\45\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\33\317\377\377\377\377\377\377\377\317\33"
-    "\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\0\0\0\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\10\0\0\0\377\377\377\377\377\377\377\377\377\377\377\366"
-    "\163\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\377"
-    "\377\377\377\377\377\377\377\377\377\377\304\45\0\0\0\0\0\0\0\0\45"
-    "\327\377\377\377\377\377\377\377\373\157\0\0\0\0\0\0\0\0\154\377\377"
-    "\377\377\361\11\0\0\0\0\0\0\0\0\0\0\0\14\252\377\377\377\377\377\377"
-    "\377\377\377\251\14\0\0\0\0\0\0\377\377\377\377\377\377\377\377\377"
-    "\335\76\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\20\377\377\377\377\317\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\11\142\313\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\313\142\11\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\5\147\300\357\375\357\300\147\5"
-    "\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\0\0\0\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\10\0\0\0\43\147\235\307\344\366\375\364\341\264\162\26\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\43\150"
-    "\236\312\351\371\375\360\317\227\101\0\0\0\0\0\0\0\0\0\0\0\6\144\270"
-    "\350\374\370\331\226\51\0\0\0\0\0\0\0\0\0\317\377\377\377\377\231"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\73\232\323\361\374\361\323\232\73\0\0"
-    "\0\0\0\0\0\0\57\204\305\355\375\366\333\251\130\5\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\74\377\377"
-    "\377\377\115\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\147\377\377\377\312\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\223\377\377\377\107"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\277\377\377\304\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\352\377\377\101\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\1\351\377\377\377\377\351\1\0\0\0\0\0\0\0\377\377\377\377\377"
-    "\377\377\375\361\331\252\132\6\0\0\0\0\0\0\0\0\0\0\0\51\204\302\350"
-    "\372\372\351\303\207\61\0\0\0\0\377\377\377\377\377\375\365\340\273"
-    "\204\65\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\0\0\0\0\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\0\0\0\0\0\0\0\0\72\223\315\357\374\361\304\161"
-    "\15\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\377\377\377\377\377\0"
-    "\0\0\0\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377\377\0\0\0\0"
-    "\0\377\377\377\377\377\0\0\0\0\0\0\65\370\377\377\377\351\36\0\0\0"
-    "\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\213"
-    "\0\0\0\0\224\377\377\377\377\377\0\0\0\0\377\377\377\377\377\341\0"
-    "\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\74\242\336\371\371\336\241"
-    "\73\0\0\0\0\0\0\0\0\0\0\0\0\44\173\304\342\371\355\311\176\23\0\0"
-    "\0\0\0\0\0\0\0\0\60\377\377\377\377\377\377\57\0\0\0\0\0\0\0\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\331\56\0\0\0\0\0\0\0\0\22"
-    "\245\376\377\377\377\377\377\377\377\377\377\0\0\0\0\377\377\377\377"
-    "\377\377\377\377\377\377\377\306\61\0\0\0\0\0\0\0\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\0\0\0\0\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\0\0\0\0\0\0\36\272\377"
-    "\377\377\377\377\377\377\377\354\130\0\0\0\0\377\377\377\377\377\0"
-    "\0\0\0\0\377\377\377\377\377\0\0\0\0\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\0\0\0\0\0\0\0\377\377\377\377\377\377"
-    "\377\377\377\377\377\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\26\343"
-    "\377\377\377\372\75\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0"
-    "\0\0\377\377\377\377\377\313\0\0\0\0\323\377\377\377\377\377\0\0\0"
-    "\0\377\377\377\377\377\377\66\0\0\0\0\377\377\377\377\377\0\0\0\0"
-    "\5\235\377\377\377\377\377\377\377\377\233\4\0\0\0\0\0\0\0\0\14\221"
-    "\375\377\377\377\377\377\377\377\360\113\0\0\0\0\0\0\0\0\0\165\377"
-    "\377\377\377\377\377\164\0\0\0\0\0\0\0\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\353\26\0\0\0\0\0\0\36\335\377\377\377\377"
-    "\377\377\377\377\377\377\377\0\0\0\0\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\371\117\0\0\0\0\0\0\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\0\0\0\0\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\0\0\0\0\0\52\351\377\377\377\377\377"
-    "\377\377\377\377\377\377\0\0\0\0\377\377\377\377\377\0\0\0\0\0\377"
-    "\377\377\377\377\0\0\0\0\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377\377"
-    "\377\377\0\0\0\0\0\377\377\377\377\377\0\0\0\0\4\277\377\377\377\377"
-    "\150\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\377\377\374\16\0\0\23\376\377\377\377\377\377\0\0\0\0\377\377\377"
-    "\377\377\377\212\0\0\0\0\377\377\377\377\377\0\0\0\0\245\377\377\377"
-    "\377\377\377\377\377\377\377\241\0\0\0\0\0\0\0\26\325\377\377\377"
-    "\377\377\377\377\377\377\377\374\103\0\0\0\0\0\0\0\0\272\377\377\377"
-    "\377\377\377\271\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\216\0\0\0\0\0\10\322\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\0\0\0\0\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\366\50\0\0\0\0\0\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\0\0\0\0\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\0\0\0\0\15\335\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\0\0\0\0\377\377\377\377\377\0\0\0\0\0\377"
-    "\377\377\377\377\0\0\0\0\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377\377"
-    "\377\377\0\0\0\0\0\377\377\377\377\377\0\0\0\0\217\377\377\377\377"
-    "\230\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\377\377\377\113\0\0\121\377\377\377\377\377\377\0\0\0\0\377\377"
-    "\377\377\377\377\335\0\0\0\0\377\377\377\377\377\0\0\0\125\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\120\0\0\0\0\0\20\323\377"
-    "\377\377\275\124\35\6\33\146\347\377\377\345\10\0\0\0\0\0\0\10\367"
-    "\377\377\364\364\377\377\366\10\0\0\0\0\0\0\377\377\377\377\377\0"
-    "\0\2\46\273\377\377\377\377\330\0\0\0\0\0\175\377\377\377\377\377"
-    "\305\114\23\10\50\165\344\377\0\0\0\0\377\377\377\377\377\0\7\51\203"
-    "\370\377\377\377\377\264\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\211"
-    "\377\377\377\377\377\265\101\17\7\65\233\376\377\0\0\0\0\377\377\377"
-    "\377\377\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0"
-    "\0\0\0\0\377\377\377\377\377\0\0\0\133\377\377\377\377\302\5\0\0\0"
-    "\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377"
-    "\377\213\0\0\220\377\377\377\377\377\377\0\0\0\0\377\377\377\377\377"
-    "\377\377\62\0\0\0\377\377\377\377\377\0\0\0\324\377\377\377\377\240"
-    "\27\27\241\377\377\377\377\321\0\0\0\0\0\235\377\377\375\152\0\0\0"
-    "\0\0\0\37\353\377\377\143\0\0\0\0\0\0\105\377\377\377\276\277\377"
-    "\377\377\104\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\45\377\377\377"
-    "\377\366\0\0\0\0\11\356\377\377\377\377\254\2\0\0\0\0\0\13\234\0\0"
-    "\0\0\377\377\377\377\377\0\0\0\0\116\377\377\377\377\376\41\0\0\0"
-    "\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\0\0\15\363\377\377\377\377\226\0\0\0\0"
-    "\0\0\112\367\0\0\0\0\377\377\377\377\377\0\0\0\0\0\377\377\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\377\377\377\377\377\0\0"
-    "\60\366\377\377\377\342\26\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0"
-    "\0\0\0\0\0\0\0\0\377\377\377\377\350\377\312\0\0\317\377\350\377\377"
-    "\377\377\0\0\0\0\377\377\377\377\377\377\377\206\0\0\0\377\377\377"
-    "\377\377\0\0\64\377\377\377\377\332\4\0\0\4\333\377\377\377\377\61"
-    "\0\0\0\77\377\377\377\154\0\0\0\0\0\0\0\0\160\377\377\256\0\0\0\0"
-    "\0\0\212\377\377\377\204\205\377\377\377\211\0\0\0\0\0\0\377\377\377"
-    "\377\377\0\0\0\0\4\377\377\377\377\364\0\0\0\0\124\377\377\377\377"
-    "\355\20\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\267"
-    "\377\377\377\377\157\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\131\377\377"
-    "\377\377\344\10\0\0\0\0\0\0\0\135\0\0\0\0\377\377\377\377\377\0\0"
-    "\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\377"
-    "\377\377\377\377\0\22\336\377\377\377\366\62\0\0\0\0\0\0\0\0\377\377"
-    "\377\377\377\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\257\377\374\15"
-    "\20\375\377\260\377\377\377\377\0\0\0\0\377\377\377\377\377\377\377"
-    "\331\0\0\0\377\377\377\377\377\0\0\173\377\377\377\377\174\0\0\0\0"
-    "\175\377\377\377\377\171\0\0\0\263\377\377\270\0\0\0\0\0\0\0\0\0\44"
-    "\377\377\340\0\0\0\0\0\0\317\377\377\377\112\113\377\377\377\316\0"
-    "\0\0\0\0\0\377\377\377\377\377\0\0\0\0\41\377\377\377\377\312\0\0"
-    "\0\0\227\377\377\377\377\221\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\377\377\0\0\0\0\0\145\377\377\377\377\250\0\0\0\0\377\377\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\232\377\377\377\377\207\0\0\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\377\377\377\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\377"
-    "\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377"
-    "\377\0\0\0\0\0\377\377\377\377\377\2\271\377\377\377\377\130\0\0\0"
-    "\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\377\166\377\377\112\115\377\377\171\377\377\377\377\0\0\0\0\377\377"
-    "\377\377\377\314\377\377\56\0\0\377\377\377\377\377\0\0\260\377\377"
-    "\377\377\104\0\0\0\0\106\377\377\377\377\255\0\0\33\374\377\377\53"
-    "\0\0\0\32\223\335\370\350\235\37\377\377\365\0\0\0\0\0\25\376\377"
-    "\377\376\21\22\376\377\377\376\25\0\0\0\0\0\377\377\377\377\377\0"
-    "\0\1\42\263\377\377\377\377\147\0\0\0\0\307\377\377\377\377\112\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\63\377\377"
-    "\377\377\320\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\311\377\377\377\377"
-    "\105\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\377\377"
-    "\377\377\377\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\377\377\377\377"
-    "\377\207\377\377\377\377\210\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\76\377\377\212\214\377\377"
-    "\101\377\377\377\377\0\0\0\0\377\377\377\377\377\170\377\377\202\0"
-    "\0\377\377\377\377\377\0\0\324\377\377\377\377\42\0\0\0\0\43\377\377"
-    "\377\377\322\0\0\144\377\377\307\0\0\0\65\355\377\377\377\377\377"
-    "\334\377\377\377\0\0\0\0\0\132\377\377\377\326\0\0\327\377\377\377"
-    "\131\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\243\1\0\0\0\0\347\377\377\377\377\40\0\0\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\377\377\377\0\0\0\0\0\26\377\377\377\377\352\0\0\0\0\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\0\0\0\0\0\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\0\0\0\0\350\377\377"
-    "\377\377\36\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\0\0\0\0\0\0\0\0\0\377\377\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0"
-    "\0\0\377\377\377\377\377\377\377\377\377\377\121\0\0\0\0\0\0\0\0\0"
-    "\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\12\373"
-    "\377\312\313\377\375\14\377\377\377\377\0\0\0\0\377\377\377\377\377"
-    "\44\377\377\326\0\0\377\377\377\377\377\0\0\354\377\377\377\377\15"
-    "\0\0\0\0\17\377\377\377\377\352\0\0\232\377\377\167\0\0\17\344\377"
-    "\377\377\377\377\377\377\377\377\377\0\0\0\0\0\237\377\377\377\234"
-    "\0\0\235\377\377\377\236\0\0\0\0\0\377\377\377\377\377\377\377\377"
-    "\377\377\343\254\116\0\0\0\0\0\0\370\377\377\377\377\14\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\6\377\377\377\377\370"
-    "\0\0\0\0\377\377\377\377\377\377\377\377\377\377\377\377\377\377\0"
-    "\0\0\0\0\377\377\377\377\377\377\377\377\377\377\377\377\377\377\0"
-    "\0\0\0\371\377\377\377\377\12\0\0\0\377\377\377\377\377\377\377\0"
-    "\0\0\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\0"
-    "\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\377\377\377\377\377\0\0\0\0\0\377\377\377\377\377\377\377\377"
-    "\377\377\330\4\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0"
-    "\0\0\0\0\377\377\377\377\0\314\377\374\374\377\322\0\377\377\377\377"
-    "\0\0\0\0\377\377\377\377\377\0\320\377\377\52\0\377\377\377\377\377"
-    "\0\0\372\377\377\377\377\3\0\0\0\0\4\377\377\377\377\370\0\0\314\377"
-    "\377\104\0\0\165\377\377\370\157\27\31\161\371\377\377\377\0\0\0\0"
-    "\0\344\377\377\377\142\0\0\143\377\377\377\343\0\0\0\0\0\377\377\377"
-    "\377\377\377\377\377\377\377\372\323\207\32\0\0\0\0\0\376\377\377"
-    "\377\377\3\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0"
-    "\1\377\377\377\377\376\0\0\0\0\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\0\0\0\0\0\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\0\0\0\0\376\377\377\377\377\2\0\0\0\377\377\377"
-    "\377\377\377\377\0\0\0\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\377\377\377"
-    "\377\377\377\377\377\377\377\377\151\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\377\377\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0\223\377\377\377\377"
-    "\232\0\377\377\377\377\0\0\0\0\377\377\377\377\377\0\174\377\377\176"
-    "\0\377\377\377\377\377\0\0\377\377\377\377\377\0\0\0\0\0\1\377\377"
-    "\377\377\376\0\0\342\377\377\35\0\0\305\377\377\175\0\0\0\0\201\377"
-    "\377\377\0\0\0\0\51\377\377\377\377\50\0\0\51\377\377\377\377\50\0"
-    "\0\0\0\377\377\377\377\377\377\377\377\377\377\377\377\377\363\115"
-    "\0\0\0\0\370\377\377\377\377\14\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\377\377\0\0\0\0\0\6\377\377\377\377\370\0\0\0\0\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\0\0\0\0\0\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\0\0\0\0\371\377\377\377\377"
-    "\13\0\0\0\377\377\377\377\377\377\377\0\0\0\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0"
-    "\0\0\0\0\377\377\377\377\377\377\372\366\377\377\377\350\14\0\0\0"
-    "\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377"
-    "\0\132\377\377\377\377\142\0\377\377\377\377\0\0\0\0\377\377\377\377"
-    "\377\0\47\377\377\322\0\377\377\377\377\377\0\0\372\377\377\377\377"
-    "\3\0\0\0\0\4\377\377\377\377\371\0\0\362\377\377\15\0\0\356\377\377"
-    "\42\0\0\0\0\43\377\377\377\0\0\0\0\157\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\156\0\0\0\0\377\377\377\377\377\0\0\2\25\131"
-    "\350\377\377\377\366\50\0\0\0\347\377\377\377\377\40\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\26\377\377\377\377\352"
-    "\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\350\377\377\377\377\37\0\0\0\377"
-    "\377\377\377\377\377\377\0\0\0\377\377\377\377\377\0\0\0\0\0\377\377"
-    "\377\377\377\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\377\377\377\377"
-    "\377\377\153\207\377\377\377\377\201\0\0\0\0\0\0\0\0\377\377\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0\41\377\377\377\377\53"
-    "\0\377\377\377\377\0\0\0\0\377\377\377\377\377\0\0\323\377\377\45"
-    "\377\377\377\377\377\0\0\355\377\377\377\377\15\0\0\0\0\17\377\377"
-    "\377\377\353\0\0\373\377\377\3\0\0\373\377\377\10\0\0\0\0\11\377\377"
-    "\377\0\0\0\0\264\377\377\377\377\377\377\377\377\377\377\377\377\263"
-    "\0\0\0\0\377\377\377\377\377\0\0\0\0\0\116\377\377\377\377\234\0\0"
-    "\0\307\377\377\377\377\112\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377"
-    "\377\0\0\0\0\0\64\377\377\377\377\320\0\0\0\0\377\377\377\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\310\377\377\377\377\107\0\0\0\0\0\0\377\377\377\377\0\0\0"
-    "\377\377\377\377\377\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0"
-    "\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\377\377\0\0\0\0\0\377\377\377\377\377\240\0\17\355\377\377\377"
-    "\364\30\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\377\377\0\0\350\377\377\361\2\0\377\377\377\377\0\0\0\0\377\377"
-    "\377\377\377\0\0\177\377\377\172\377\377\377\377\377\0\0\325\377\377"
-    "\377\377\42\0\0\0\0\43\377\377\377\377\323\0\0\355\377\377\21\0\0"
-    "\355\377\377\42\0\0\0\0\43\377\377\377\0\0\0\5\363\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\363\5\0\0\0\377\377\377\377\377\0"
-    "\0\0\0\0\15\377\377\377\377\337\0\0\0\227\377\377\377\377\221\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\146\377\377\377"
-    "\377\247\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\230\377\377\377\377\213"
-    "\0\0\0\0\0\0\377\377\377\377\0\0\0\377\377\377\377\377\0\0\0\0\0\377"
-    "\377\377\377\377\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\5\377\377\377\377\374\0\0\0\0\0\377\377\377"
-    "\377\377\10\0\0\164\377\377\377\377\231\0\0\0\0\0\0\0\377\377\377"
-    "\377\377\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\377"
-    "\377\377\377\0\0\0\0\377\377\377\377\377\0\0\53\377\377\316\377\377"
-    "\377\377\377\0\0\260\377\377\377\377\104\0\0\0\0\105\377\377\377\377"
-    "\256\0\0\334\377\377\43\0\0\302\377\377\174\0\0\0\0\177\377\377\377"
-    "\0\0\0\76\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\75\0\0\0\377\377\377\377\377\0\0\0\0\0\10\377\377\377\377\371\0\0"
-    "\0\124\377\377\377\377\355\20\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\377\377\0\0\0\0\0\270\377\377\377\377\155\0\0\0\0\377\377\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\125\377\377\377\377\347\11\0\0\0\0\0\377\377\377\377"
-    "\0\0\0\377\377\377\377\377\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0"
-    "\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\172\0\0\0\0\0\0\0\43"
-    "\377\377\377\377\357\0\0\0\0\0\377\377\377\377\377\0\0\0\10\342\377"
-    "\377\377\374\50\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0"
-    "\0\0\377\377\377\377\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\377\377"
-    "\377\377\377\0\0\0\327\377\377\377\377\377\377\377\0\0\173\377\377"
-    "\377\377\173\0\0\0\0\174\377\377\377\377\172\0\0\302\377\377\121\0"
-    "\0\163\377\377\367\154\26\27\157\370\377\377\377\0\0\0\203\377\377"
-    "\377\357\2\0\0\0\0\4\363\377\377\377\202\0\0\0\377\377\377\377\377"
-    "\0\0\0\0\0\76\377\377\377\377\366\0\0\0\11\356\377\377\377\377\253"
-    "\2\0\0\0\0\0\13\233\0\0\0\0\377\377\377\377\377\0\0\0\0\115\377\377"
-    "\377\377\376\37\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\13\360\377\377"
-    "\377\377\226\0\0\0\0\0\377\377\377\377\0\0\0\377\377\377\377\377\0"
-    "\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\377\377\377\377\377"
-    "\0\0\0\0\0\0\0\0\0\377\224\10\0\0\0\0\0\172\377\377\377\377\320\0"
-    "\0\0\0\0\377\377\377\377\377\0\0\0\0\141\377\377\377\377\261\0\0\0"
-    "\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0"
-    "\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\377\377\377\377\377\0\0\0\203"
-    "\377\377\377\377\377\377\377\0\0\65\377\377\377\377\331\3\0\0\3\331"
-    "\377\377\377\377\62\0\0\212\377\377\212\0\0\16\342\377\377\377\377"
-    "\377\377\377\377\377\377\0\0\0\311\377\377\377\263\0\0\0\0\0\0\271"
-    "\377\377\377\310\0\0\0\377\377\377\377\377\0\0\1\21\113\333\377\377"
-    "\377\377\323\0\0\0\0\175\377\377\377\377\377\305\113\22\7\47\164\343"
-    "\377\0\0\0\0\377\377\377\377\377\0\7\50\202\370\377\377\377\377\261"
-    "\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\204\377\377\377\377\377\257"
-    "\70\12\11\106\377\377\377\377\0\0\0\377\377\377\377\377\0\0\0\0\0"
-    "\377\377\377\377\377\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0"
-    "\0\0\0\0\0\377\377\337\156\41\4\26\155\370\377\377\377\377\232\0\0"
-    "\0\0\0\377\377\377\377\377\0\0\0\0\2\324\377\377\377\377\75\0\0\0"
-    "\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0"
-    "\0\0\0\0\0\0\377\377\377\377\0\0\0\0\377\377\377\377\377\0\0\0\57"
-    "\377\377\377\377\377\377\377\0\0\0\326\377\377\377\377\237\26\26\237"
-    "\377\377\377\377\322\0\0\0\117\377\377\341\2\0\0\63\354\377\377\377"
-    "\377\377\344\377\377\377\0\0\21\375\377\377\377\165\0\0\0\0\0\0\172"
-    "\377\377\377\374\20\0\0\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\210\0\0\0\0\10\322\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\0\0\0\0\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\365\46\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\13\331\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\0\0\0\377\377\377\377\377\0\0\0\0\0\377\377\377\377\377\0\0\0"
-    "\0\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\0\0"
-    "\0\0\377\377\377\377\377\377\377\377\377\377\377\377\377\104\0\0\0"
-    "\0\0\377\377\377\377\377\0\0\0\0\0\116\377\377\377\377\310\0\0\0\0"
-    "\0\377\377\377\377\377\377\377\377\377\377\377\377\377\377\0\0\377"
-    "\377\377\377\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\377\377\377\377"
-    "\377\0\0\0\0\332\377\377\377\377\377\377\0\0\0\127\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\122\0\0\0\13\356\377\377\122\0\0"
-    "\0\32\223\337\371\354\250\37\377\377\377\0\0\123\377\377\377\377\67"
-    "\0\0\0\0\0\0\72\377\377\377\377\122\0\0\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\347\25\0\0\0\0\0\36\335\377\377\377\377"
-    "\377\377\377\377\377\377\377\0\0\0\0\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\370\115\0\0\0\0\0\0\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\0\0\0\0\377\377\377\377\377\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\46\347\377\377\377\377\377\377\377\377\377\377"
-    "\377\366\0\0\0\377\377\377\377\377\0\0\0\0\0\377\377\377\377\377\0"
-    "\0\0\0\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\0\0\0\0\377\377\377\377\377\377\377\377\377\377\377\377\272\0\0\0"
-    "\0\0\0\377\377\377\377\377\0\0\0\0\0\0\304\377\377\377\377\125\0\0"
-    "\0\0\377\377\377\377\377\377\377\377\377\377\377\377\377\377\0\0\377"
-    "\377\377\377\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\377\377\377\377"
-    "\377\0\0\0\0\207\377\377\377\377\377\377\0\0\0\0\250\377\377\377\377"
-    "\377\377\377\377\377\377\244\0\0\0\0\0\212\377\377\343\17\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\230\377\377\377\364\4\0\0\0\0\0\0\5\365\377\377"
-    "\377\227\0\0\377\377\377\377\377\377\377\377\377\377\377\377\377\323"
-    "\52\0\0\0\0\0\0\0\23\246\376\377\377\377\377\377\377\377\377\377\0"
-    "\0\0\0\377\377\377\377\377\377\377\377\377\377\377\305\57\0\0\0\0"
-    "\0\0\0\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\35\272"
-    "\377\377\377\377\377\377\377\377\377\305\54\0\0\0\377\377\377\377"
-    "\377\0\0\0\0\0\377\377\377\377\377\0\0\0\0\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\0\0\0\0\104\311\377\377\377\377"
-    "\377\377\377\377\377\276\22\0\0\0\0\0\0\377\377\377\377\377\0\0\0"
-    "\0\0\0\73\377\377\377\377\333\5\0\0\0\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\0\0\377\377\377\377\0\0\0\0\0\0\0\0\377"
-    "\377\377\377\0\0\0\0\377\377\377\377\377\0\0\0\0\63\377\377\377\377"
-    "\377\377\0\0\0\0\6\241\377\377\377\377\377\377\377\377\236\5\0\0\0"
-    "\0\0\32\357\377\377\267\10\0\0\0\0\0\0\0\0\0\0\0\0\0\335\377\377\377"
-    "\273\0\0\0\0\0\0\0\0\274\377\377\377\335\0\0\377\377\377\377\377\377"
-    "\377\377\371\350\311\227\113\2\0\0\0\0\0\0\0\0\0\0\51\205\304\352"
-    "\373\372\351\303\206\60\0\0\0\0\377\377\377\377\377\376\366\340\274"
-    "\204\65\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\74\226\322\363\375\364\323\230\100\0\0\0\0\0\377"
-    "\377\377\377\377\0\0\0\0\0\377\377\377\377\377\0\0\0\0\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\0\0\0\0\0\0\66\220"
-    "\316\363\376\364\327\242\113\1\0\0\0\0\0\0\0\377\377\377\377\377\0"
-    "\0\0\0\0\0\0\261\377\377\377\377\155\0\0\0\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\0\0\377\377\377\377\0\0\0\0\0\0\0"
-    "\0\377\377\377\377\0\0\0\0\377\377\377\377\377\0\0\0\0\0\336\377\377"
-    "\377\377\377\0\0\0\0\0\0\76\244\337\372\372\337\243\75\0\0\0\0\0\0"
-    "\0\0\127\377\377\377\301\43\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\212\377\377\377\370\233\111\35\6"
-    "\11\45\127\244\264\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\171\376\377\377\377\377\377\377\377\377\377\377\377\145\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\67\305\377\377"
-    "\377\377\377\377\377\377\377\366\166\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\67\204\305\340\365\367\344\266\161\26"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\377\377\377\377\377\310\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\377\377\377\377\377\377\376\366\342\275\201\47\0\0\0"
-    "\0\0\0\0\0\0\70\231\331\363\363\331\231\70\0\0\0\0\0\0\0\0\377\377"
-    "\377\377\377\377\377\372\354\315\233\114\2\0\0\0\0\0\0\0\0\0\63\223"
-    "\315\356\374\366\346\310\235\147\43\0\0\0\0\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\0\0\0\377\377\377\377"
-    "\377\0\0\0\0\0\0\377\377\377\377\377\0\0\342\377\377\377\276\0\0\0"
-    "\0\0\0\0\276\377\377\377\342\0\360\377\377\377\24\0\0\0\0\0\0\0\0"
-    "\0\32\377\377\377\361\265\377\377\377\363\32\0\0\0\0\0\0\30\362\377"
-    "\377\377\265\0\300\377\377\377\377\64\0\0\0\0\0\0\0\65\377\377\377"
-    "\377\277\0\0\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\310\0\0\0\0\0"
-    "\0\303\377\377\304\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\1\270\377\377\377\270"
-    "\1\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\377\377\377\377\377\377\377\377\376\227\6\0\0\0\0\0\4\225\376"
-    "\377\377\377\377\377\377\376\224\3\0\0\0\0\0\0\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\316\37\0\0\0\0\0\0\14\242\377\377\377"
-    "\377\377\377\377\377\377\377\377\0\0\0\0\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\0\0\0\377\377\377\377\377"
-    "\0\0\0\0\0\0\377\377\377\377\377\0\0\246\377\377\377\360\1\0\0\0\0"
-    "\0\1\361\377\377\377\246\0\321\377\377\377\54\0\0\0\0\0\0\0\0\0\55"
-    "\377\377\377\323\45\371\377\377\377\244\0\0\0\0\0\0\242\377\377\377"
-    "\371\45\0\77\377\377\377\377\254\0\0\0\0\0\0\0\257\377\377\377\377"
-    "\76\0\0\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\310\0\0\0\0\0\0\110"
-    "\377\377\377\77\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377"
-    "\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\167\377\377\377\377\377\166"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\246\0\0\0\0\0\233\377\377"
-    "\377\377\377\377\377\377\377\377\232\0\0\0\0\0\0\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\331\11\0\0\0\0\4\301\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\0\0\0\0\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\0\0\0\377\377\377\377"
-    "\377\0\0\0\0\0\0\377\377\377\377\377\0\0\152\377\377\377\377\47\0"
-    "\0\0\0\0\50\377\377\377\377\152\0\262\377\377\377\105\0\0\0\0\0\0"
-    "\0\0\0\100\377\377\377\265\0\211\377\377\377\377\72\0\0\0\0\71\376"
-    "\377\377\377\212\0\0\0\277\377\377\377\375\47\0\0\0\0\0\52\376\377"
-    "\377\377\276\0\0\0\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0"
-    "\0\0\315\377\377\272\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\377\377\0\0\0\0\0\0\0\0\0\0\0\71\373\377\377\377\377\377\373"
-    "\70\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\77\0\0\0\114\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\112\0\0\0\0\0\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\157\0\0\0\0\150\377"
-    "\377\377\377\377\377\376\377\377\377\377\377\377\0\0\0\0\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\0\0\0\377"
-    "\377\377\377\377\0\0\0\0\0\0\377\377\377\377\377\0\0\56\377\377\377"
-    "\377\134\0\0\0\0\0\135\377\377\377\377\56\0\222\377\377\377\136\0"
-    "\0\0\0\0\0\0\0\0\124\377\377\377\230\0\14\346\377\377\377\314\2\0"
-    "\0\2\313\377\377\377\347\15\0\0\0\76\377\377\377\377\236\0\0\0\0\0"
-    "\242\377\377\377\377\75\0\0\0\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\372\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0"
-    "\0\0\0\0\0\0\0\0\122\377\377\377\65\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\20\340\377\377\377"
-    "\377\377\377\377\337\20\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\377\377\377\377\377\0\1\23\126\351\377\377\377\377\236"
-    "\0\0\0\321\377\377\377\377\240\27\27\241\377\377\377\377\317\0\0\0"
-    "\0\0\377\377\377\377\377\0\0\13\102\332\377\377\377\377\275\0\0\0"
-    "\0\307\377\377\377\377\276\50\1\3\33\123\254\374\377\0\0\0\0\0\0\0"
-    "\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0"
-    "\0\0\0\0\0\377\377\377\377\377\0\0\2\357\377\377\377\220\0\0\0\0\0"
-    "\221\377\377\377\357\2\0\163\377\377\377\167\0\0\0\0\0\0\0\0\0\147"
-    "\377\377\377\172\0\0\135\377\377\377\377\144\0\0\144\377\377\377\377"
-    "\137\0\0\0\0\0\276\377\377\377\372\35\0\0\0\40\373\377\377\377\275"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\23\347\377\377\377\377\173\0\0\0\0\0\0"
-    "\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\1\326\377\377\260\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0"
-    "\0\0\255\377\377\377\360\145\360\377\377\377\255\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\130"
-    "\377\377\377\377\327\0\0\54\377\377\377\377\333\4\0\0\4\333\377\377"
-    "\377\377\52\0\0\0\0\377\377\377\377\377\0\0\0\0\100\377\377\377\377"
-    "\351\0\0\0\0\364\377\377\377\377\67\0\0\0\0\0\0\42\262\0\0\0\0\0\0"
-    "\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\377\377\377\377\377"
-    "\0\0\0\0\0\0\377\377\377\377\377\0\0\0\266\377\377\377\305\0\0\0\0"
-    "\0\306\377\377\377\266\0\0\123\377\377\377\217\0\0\0\0\0\0\0\0\0\172"
-    "\377\377\377\135\0\0\1\305\377\377\377\352\17\17\352\377\377\377\310"
-    "\1\0\0\0\0\0\75\377\377\377\377\220\0\0\0\226\377\377\377\377\74\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\251\377\377\377\377\304\3\0\0\0\0\0\0\0\0"
-    "\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\135\377\377\376\53\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0"
-    "\153\377\377\377\360\66\0\66\360\377\377\377\152\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\24\377"
-    "\377\377\377\364\0\0\171\377\377\377\377\177\0\0\0\0\200\377\377\377"
-    "\377\170\0\0\0\0\377\377\377\377\377\0\0\0\0\11\377\377\377\377\372"
-    "\0\0\0\0\372\377\377\377\377\132\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0"
-    "\0\0\0\377\377\377\377\377\0\0\0\172\377\377\377\366\4\0\0\0\4\366"
-    "\377\377\377\172\0\0\64\377\377\377\250\0\0\203\377\377\377\213\0"
-    "\0\216\377\377\377\77\0\0\0\63\375\377\377\377\217\220\377\377\377"
-    "\376\66\0\0\0\0\0\0\0\274\377\377\377\365\24\0\30\367\377\377\377"
-    "\273\0\0\0\0\0\0\0\0\0\0\0\0\0\130\377\377\377\377\362\41\0\0\0\0"
-    "\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\4\336\377\377\245"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0"
-    "\0\0\57\370\377\377\361\67\0\0\0\67\361\377\377\367\57\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\4"
-    "\377\377\377\377\375\0\0\250\377\377\377\377\110\0\0\0\0\111\377\377"
-    "\377\377\247\0\0\0\0\377\377\377\377\377\0\0\0\0\11\377\377\377\377"
-    "\360\0\0\0\0\335\377\377\377\377\361\153\10\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\377\377\377\377\377"
-    "\0\0\0\0\0\0\377\377\377\377\377\0\0\0\76\377\377\377\377\57\0\0\0"
-    "\60\377\377\377\377\76\0\0\24\377\377\377\301\0\0\262\377\377\377"
-    "\301\0\0\241\377\377\377\42\0\0\0\0\233\377\377\377\373\373\377\377"
-    "\377\237\0\0\0\0\0\0\0\0\74\377\377\377\377\202\0\211\377\377\377"
-    "\377\73\0\0\0\0\0\0\0\0\0\0\0\0\30\355\377\377\377\377\140\0\0\0\0"
-    "\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\147\377\377"
-    "\374\43\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0"
-    "\0\0\0\0\14\331\377\377\362\71\0\0\0\0\0\70\361\377\377\330\13\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0"
-    "\0\0\24\377\377\377\377\364\0\0\321\377\377\377\377\44\0\0\0\0\45"
-    "\377\377\377\377\320\0\0\0\0\377\377\377\377\377\0\0\0\0\100\377\377"
-    "\377\377\302\0\0\0\0\220\377\377\377\377\377\377\356\222\56\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\377\377\0\0\0\0\0\0\377\377\377\377\377\0\0\0\10\371\377\377"
-    "\377\143\0\0\0\144\377\377\377\371\10\0\0\0\364\377\377\332\0\0\341"
-    "\377\377\377\364\3\0\264\377\377\376\6\0\0\0\0\25\357\377\377\377"
-    "\377\377\377\362\30\0\0\0\0\0\0\0\0\0\273\377\377\377\356\35\362\377"
-    "\377\377\272\0\0\0\0\0\0\0\0\0\0\0\0\0\263\377\377\377\377\254\0\0"
-    "\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\7\345"
-    "\377\377\233\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0"
-    "\0\0\0\0\0\0\242\377\377\363\73\0\0\0\0\0\0\0\71\362\377\377\241\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0"
-    "\0\0\0\127\377\377\377\377\327\0\0\350\377\377\377\377\17\0\0\0\0"
-    "\20\377\377\377\377\347\0\0\0\0\377\377\377\377\377\0\0\12\102\332"
-    "\377\377\377\377\141\0\0\0\0\26\344\377\377\377\377\377\377\377\377"
-    "\301\75\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0"
-    "\0\0\377\377\377\377\377\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\306"
-    "\377\377\377\230\0\0\0\231\377\377\377\306\0\0\0\0\325\377\377\363"
-    "\0\20\377\377\377\377\377\56\0\310\377\377\346\0\0\0\0\0\0\157\377"
-    "\377\377\377\377\377\164\0\0\0\0\0\0\0\0\0\0\73\377\377\377\377\331"
-    "\377\377\377\377\72\0\0\0\0\0\0\0\0\0\0\0\0\142\377\377\377\377\345"
-    "\22\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\162\377\377\371\33\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\1\22\125"
-    "\351\377\377\377\377\236\0\0\364\377\377\377\377\5\0\0\0\0\7\377\377"
-    "\377\377\363\0\0\0\0\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\257\1\0\0\0\0\0\41\305\377\377\377\377\377\377\377\377\377\220"
-    "\3\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\377\377\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\212\377\377\377"
-    "\315\0\0\0\316\377\377\377\212\0\0\0\0\266\377\377\377\13\76\377\377"
-    "\377\377\377\144\0\333\377\377\311\0\0\0\0\0\0\4\324\377\377\377\377"
-    "\331\5\0\0\0\0\0\0\0\0\0\0\0\272\377\377\377\377\377\377\377\271\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\36\361\377\377\377\376\105\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\13\354\377\377"
-    "\220\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\77\0\0\375\377\377\377\377\1\0\0\0\0\2\377\377\377\377\375\0"
-    "\0\0\0\377\377\377\377\377\377\377\377\377\377\377\333\160\4\0\0\0"
-    "\0\0\0\0\1\121\304\377\377\377\377\377\377\377\377\227\0\0\0\0\0\0"
-    "\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\377\377\377\377\377"
-    "\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\116\377\377\377\372\7\0\10"
-    "\372\377\377\377\116\0\0\0\0\226\377\377\377\44\155\377\377\305\377"
-    "\377\233\0\356\377\377\253\0\0\0\0\0\0\0\205\377\377\377\377\214\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\72\377\377\377\377\377\377\377\71\0\0\0\0\0"
-    "\0\0\0\0\0\0\1\274\377\377\377\377\220\0\0\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\174\377\377\365\25\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\377\377\377\377\377\377\377\377\377\377\377\377\377\246\0\0"
-    "\0\364\377\377\377\377\5\0\0\0\0\7\377\377\377\377\366\0\0\0\0\377"
-    "\377\377\377\377\377\377\377\377\377\327\63\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\47\205\345\377\377\377\377\377\377\77\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\377\377\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\377"
-    "\377\377\377\377\0\0\0\0\23\376\377\377\377\66\0\67\377\377\377\376"
-    "\23\0\0\0\0\167\377\377\377\75\234\377\377\131\377\377\321\3\376\377"
-    "\377\216\0\0\0\0\0\0\25\361\377\377\377\377\363\31\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\271\377\377\377\377\377\270\0\0\0\0\0\0\0\0\0\0\0\0\154\377"
-    "\377\377\377\324\10\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\20\361\377\377\206\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\377\377\377\377\377\377\377\377\376\230\6\0\0\0\350\377\377\377\377"
-    "\17\0\0\0\0\20\377\377\377\377\351\0\0\0\0\377\377\377\377\377\377"
-    "\377\377\377\377\377\354\30\0\0\0\0\0\0\0\0\0\0\0\0\0\3\151\372\377"
-    "\377\377\377\250\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0"
-    "\0\0\0\377\377\377\377\377\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0"
-    "\0\326\377\377\377\153\0\154\377\377\377\326\0\0\0\0\0\127\377\377"
-    "\377\126\312\377\366\6\361\377\374\40\377\377\377\160\0\0\0\0\0\0"
-    "\231\377\377\377\377\377\377\236\0\0\0\0\0\0\0\0\0\0\0\0\70\377\377"
-    "\377\377\377\70\0\0\0\0\0\0\0\0\0\0\0\44\365\377\377\377\371\57\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\207\377\377\361\17\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\367"
-    "\343\276\202\50\0\0\0\0\0\321\377\377\377\377\44\0\0\0\0\45\377\377"
-    "\377\377\316\0\0\0\0\377\377\377\377\377\0\22\245\377\377\377\377"
-    "\234\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\161\377\377\377\377\342\0\0\0\0"
-    "\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\376\377\377\377\377"
-    "\0\0\0\0\0\0\377\377\377\377\375\0\0\0\0\0\232\377\377\377\240\0\241"
-    "\377\377\377\232\0\0\0\0\0\70\377\377\377\161\366\377\307\0\274\377"
-    "\377\147\377\377\377\123\0\0\0\0\0\55\374\377\377\377\377\377\377"
-    "\375\61\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0"
-    "\0\0\0\0\2\305\377\377\377\377\165\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\26\366\377\377\173\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\251\377\377\377"
-    "\377\107\0\0\0\0\111\377\377\377\377\247\0\0\0\0\377\377\377\377\377"
-    "\0\0\4\316\377\377\377\374\45\0\0\0\0\0\0\0\0\0\0\0\0\0\0\22\377\377"
-    "\377\377\372\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0"
-    "\0\365\377\377\377\377\2\0\0\0\0\3\377\377\377\377\363\0\0\0\0\0\136"
-    "\377\377\377\325\0\326\377\377\377\136\0\0\0\0\0\30\377\377\377\257"
-    "\377\377\222\0\204\377\377\260\377\377\377\65\0\0\0\0\0\273\377\377"
-    "\377\351\356\377\377\377\277\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\166\377\377\377\377\277\2\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\221\377\377\353\12\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\172\377\377\377\377\176\0\0\0\0\177\377\377\377\377\160\0\0\0"
-    "\0\377\377\377\377\377\0\0\0\103\377\377\377\377\246\0\0\0\0\0\227"
-    "\6\0\0\0\0\0\0\0\12\377\377\377\377\374\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\377\377\0\0\0\0\0\0\0\0\0\334\377\377\377\377\36\0\0\0\0\36\377"
-    "\377\377\377\333\0\0\0\0\0\42\377\377\377\375\31\375\377\377\377\42"
-    "\0\0\0\0\0\1\367\377\377\361\377\377\136\0\115\377\377\363\377\377"
-    "\377\27\0\0\0\0\116\377\377\377\377\147\157\377\377\377\377\121\0"
-    "\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\53\370"
-    "\377\377\377\357\35\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\34\371\377\377\161\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\56\377\377\377\377\331\3\0\0"
-    "\3\332\377\377\377\377\44\0\0\0\0\377\377\377\377\377\0\0\0\0\310"
-    "\377\377\377\375\54\0\0\0\0\377\317\64\0\0\0\0\0\0\126\377\377\377"
-    "\377\352\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\261"
-    "\377\377\377\377\167\0\0\0\0\170\377\377\377\377\260\0\0\0\0\0\0\345"
-    "\377\377\377\176\377\377\377\345\0\0\0\0\0\0\0\331\377\377\377\377"
-    "\377\52\0\25\377\377\377\377\377\370\1\0\0\0\5\331\377\377\377\325"
-    "\3\5\331\377\377\377\333\6\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377"
-    "\0\0\0\0\0\0\0\0\0\5\315\377\377\377\377\131\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\234"
-    "\377\377\345\6\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\324"
-    "\377\377\377\377\237\26\26\237\377\377\377\377\301\0\0\0\0\0\377\377"
-    "\377\377\377\0\0\0\0\112\377\377\377\377\256\0\0\0\0\377\377\376\261"
-    "\123\31\3\25\144\360\377\377\377\377\266\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\377\377\0\0\0\0\0\0\0\0\0\155\377\377\377\377\370\146\16\16\146"
-    "\370\377\377\377\377\154\0\0\0\0\0\0\252\377\377\377\343\377\377\377"
-    "\252\0\0\0\0\0\0\0\272\377\377\377\377\363\2\0\0\336\377\377\377\377"
-    "\334\0\0\0\0\161\377\377\377\377\111\0\0\116\377\377\377\377\163\0"
-    "\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\201\377\377"
-    "\377\377\245\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\44\374\377\377\146\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\122\377\377\377\377\377\377"
-    "\377\377\377\377\377\376\76\0\0\0\0\0\377\377\377\377\377\0\0\0\0"
-    "\0\313\377\377\377\377\62\0\0\0\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\131\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0"
-    "\0\0\0\0\0\0\0\23\363\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\363\22\0\0\0\0\0\0\156\377\377\377\377\377\377\377\156\0\0\0"
-    "\0\0\0\0\232\377\377\377\377\302\0\0\0\246\377\377\377\377\277\0\0"
-    "\0\23\357\377\377\377\271\0\0\0\0\275\377\377\377\357\24\0\0\0\0\0"
-    "\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\373\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\0\0\0\0\0\0\0\0\377\377"
-    "\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\246\377\377\335\3\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\243\377\377\377\377"
-    "\377\377\377\377\377\377\203\0\0\0\0\0\0\377\377\377\377\377\0\0\0"
-    "\0\0\115\377\377\377\377\266\0\0\0\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\270\1\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0"
-    "\0\0\0\0\0\0\0\0\0\153\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\152\0\0\0\0\0\0\0\62\377\377\377\377\377\377\377\62\0\0\0\0\0"
-    "\0\0\173\377\377\377\377\216\0\0\0\157\377\377\377\377\241\0\0\0\224"
-    "\377\377\377\374\55\0\0\0\0\60\375\377\377\377\225\0\0\0\0\0\0\0\0"
-    "\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\0\0\0\0\0\0\0\0\377\377\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\54\376\377\377\134\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\5\235\377\377\377\377\377"
-    "\377\377\377\165\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\315"
-    "\377\377\377\377\72\0\0\104\312\377\377\377\377\377\377\377\377\377"
-    "\377\241\12\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0"
-    "\0\0\0\0\163\371\377\377\377\377\377\377\377\377\371\163\0\0\0\0\0"
-    "\0\0\0\3\362\377\377\377\377\377\362\3\0\0\0\0\0\0\0\133\377\377\377"
-    "\377\132\0\0\0\67\377\377\377\377\204\0\0\52\373\377\377\377\232\0"
-    "\0\0\0\0\0\235\377\377\377\373\52\0\0\0\0\0\0\0\0\377\377\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\261\377\377\325\1\0\0\0\0\0\0\0\0\0\0\0"
-    "\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\76\240\334\366\377\377\377\377\265"
-    "\11\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\117\377\377\377\377"
-    "\276\0\0\0\0\63\213\307\355\375\373\351\304\211\56\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\37\201\304\353"
-    "\374\374\353\305\202\37\0\0\0\0\0\0\0\0\0\0\272\377\377\377\377\377"
-    "\272\0\0\0\0\0\0\0\0\74\377\377\377\377\46\0\0\0\7\371\377\377\377"
-    "\146\0\0\267\377\377\377\363\30\0\0\0\0\0\0\31\363\377\377\377\267"
-    "\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\0\0\0\0\0\0\0"
-    "\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\66\377"
-    "\377\377\121\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\41"
-    "\355\377\377\377\301\16\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\273\377\377\313\0\0"
-    "\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\105\374\377\377\377"
-    "\265\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\100\377\377\377\107\0\0\0\0\0\0\0\0\0"
-    "\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\166\377\377\267\26\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\310\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\305\377\377\302\0\0\0\0\0\0\377\377\377\377"
-    "\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\243\162\1\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\377\377\377\377\377\377\377\310\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\377\377\377\377\310\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\203\377\377\377\322\11\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\211\377\377\377"
-    "\234\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\217\377\377\377\135\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\15\163\274\344\370\377\377\377\377\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\377\377"
-    "\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377"
-    "\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\224\377\377\364\51\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\22\330\377\377\377\377\377\377\377\377\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\377\377\377\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\1\232\377\377\324\12\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\207\377\377\377\377\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\377\377\377\377\377\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\1\237\377\377\237\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\323\377"
-    "\377\377\377\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377"
-    "\377\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\364\377\377\377\377\104\2\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\47\162\251\322\356\372\374\360\326\246\132\6"
-    "\0\0\0\0\0\377\377\377\377\377\0\12\205\340\373\353\262\106\0\0\0"
-    "\0\0\0\0\0\0\0\0\51\213\312\356\374\366\337\267\174\53\0\0\0\0\0\0"
-    "\0\106\262\353\373\340\204\12\0\377\377\377\377\377\0\0\0\0\0\0\0"
-    "\51\214\314\360\375\364\325\233\100\0\0\0\0\0\0\0\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\0\0\0\0\0\0\0\54\240\343"
-    "\370\336\220\30\0\377\377\377\377\377\0\0\0\0\377\377\377\377\377"
-    "\0\42\250\355\370\323\157\2\0\0\0\0\0\0\0\377\377\377\377\377\377"
-    "\377\377\377\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377\377"
-    "\377\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\57\362\377\377\377"
-    "\363\67\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\0\173\347\366\255\31\0\161\345\367\311\77\0\0\0\0\0\377\377\377"
-    "\377\377\0\44\251\355\370\323\156\2\0\0\0\0\0\0\0\0\0\110\247\340"
-    "\372\372\340\246\110\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377\377\332\52\0\0"
-    "\0\0\377\377\377\377\377\17\315\377\377\377\377\377\377\215\0\0\0"
-    "\0\0\0\0\0\11\227\375\377\377\377\377\377\377\377\377\377\0\0\0\0"
-    "\0\0\215\377\377\377\377\377\377\314\16\377\377\377\377\377\0\0\0"
-    "\0\0\7\222\375\377\377\377\377\377\377\377\377\265\24\0\0\0\0\0\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\0\0\0\0\0\0\132"
-    "\370\377\377\377\377\377\346\53\377\377\377\377\377\0\0\0\0\377\377"
-    "\377\377\377\44\354\377\377\377\377\377\231\0\0\0\0\0\0\0\377\377"
-    "\377\377\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377"
-    "\377\377\377\377\377\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\33"
-    "\344\377\377\377\367\100\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0"
-    "\0\0\0\0\0\0\377\377\377\176\377\377\377\377\324\140\377\377\377\377"
-    "\363\36\0\0\0\0\377\377\377\377\377\50\357\377\377\377\377\377\226"
-    "\0\0\0\0\0\0\0\23\270\377\377\377\377\377\377\377\377\266\22\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\340\12\0\0\0\377\377\377\377\377\247"
-    "\377\377\377\377\377\377\377\377\151\0\0\0\0\0\0\7\300\377\377\377"
-    "\377\377\377\377\377\377\377\377\0\0\0\0\0\152\377\377\377\377\377"
-    "\377\377\377\246\377\377\377\377\377\0\0\0\0\4\267\377\377\377\377"
-    "\377\377\377\377\377\377\377\327\22\0\0\0\0\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\0\0\0\0\0\72\372\377\377\377\377"
-    "\377\377\377\323\377\377\377\377\377\0\0\0\0\377\377\377\377\377\263"
-    "\377\377\377\377\377\377\377\70\0\0\0\0\0\0\377\377\377\377\377\377"
-    "\377\377\377\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377\377"
-    "\377\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\15\320\377\377\377\372"
-    "\112\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\364\377\377\377\377\377\365\377\377\377\377\377\173\0\0\0\0\377"
-    "\377\377\377\377\271\377\377\377\377\377\377\377\66\0\0\0\0\0\15\322"
-    "\377\377\377\377\377\377\377\377\377\377\317\14\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\374\257\136\44\13\10\73\317\377"
-    "\377\377\377\151\0\0\0\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\356\14\0\0\0\0\0\220\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\0\0\0\0\14\356\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\0\0\0\0\206\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\252\0\0\0\0\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\0\0\0\0\1\317\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\0\0\0\0\377\377\377\377\377\375\377\377\377\377"
-    "\377\377\377\227\0\0\0\0\0\0\377\377\377\377\377\377\377\377\377\0"
-    "\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377\0\0\0\0"
-    "\0\0\0\0\377\377\377\377\377\0\3\267\377\377\377\374\124\0\0\0\0\0"
-    "\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\261\0\0\0\0\377\377\377\377"
-    "\377\376\377\377\377\377\377\377\377\226\0\0\0\0\0\237\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\233\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\261\45\0\0\0\0\0\0\53\377\377\377\377\264"
-    "\0\0\0\377\377\377\377\377\377\223\26\24\216\377\377\377\377\377\137"
-    "\0\0\0\0\41\373\377\377\377\377\346\144\31\4\17\64\160\312\0\0\0\0"
-    "\140\377\377\377\377\377\216\24\26\223\377\377\377\377\377\377\0\0"
-    "\0\34\371\377\377\377\375\203\37\4\30\151\363\377\377\377\377\61\0"
-    "\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\77\377\377\377"
-    "\377\377\226\25\27\233\377\377\377\377\377\377\0\0\0\0\377\377\377"
-    "\377\377\345\56\20\262\377\377\377\377\316\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377"
-    "\0\0\0\0\0\0\0\0\377\377\377\377\377\0\230\377\377\377\376\140\0\0"
-    "\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\377\123\134\377\377\377\377\131\126\377\377\377\323\0\0\0\0\377\377"
-    "\377\377\377\345\56\20\262\377\377\377\377\316\0\0\0\0\47\376\377"
-    "\377\377\377\216\24\24\217\377\377\377\377\375\45\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\1\377\377\377\377"
-    "\341\0\0\0\377\377\377\377\377\275\0\0\0\0\272\377\377\377\377\245"
-    "\0\0\0\0\200\377\377\377\377\354\36\0\0\0\0\0\0\0\0\0\0\0\246\377"
-    "\377\377\377\272\0\0\0\0\276\377\377\377\377\377\0\0\0\172\377\377"
-    "\377\377\202\0\0\0\0\0\136\377\377\377\377\216\0\0\0\0\0\0\0\377\377"
-    "\377\377\377\0\0\0\0\0\0\0\0\0\221\377\377\377\377\307\1\0\0\2\314"
-    "\377\377\377\377\377\0\0\0\0\377\377\377\377\377\147\0\0\64\377\377"
-    "\377\377\357\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\377\377\377\377"
-    "\377\166\377\377\377\377\154\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\377\377\377\377\20\24\377\377\377\377\22"
-    "\22\377\377\377\350\0\0\0\0\377\377\377\377\377\147\0\0\64\377\377"
-    "\377\377\356\0\0\0\0\204\377\377\377\377\271\0\0\0\0\272\377\377\377"
-    "\377\202\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\4\125\241"
-    "\322\357\374\377\377\377\377\377\377\377\367\0\0\0\377\377\377\377"
-    "\377\123\0\0\0\0\122\377\377\377\377\324\0\0\0\0\302\377\377\377\377"
-    "\163\0\0\0\0\0\0\0\0\0\0\0\0\324\377\377\377\377\121\0\0\0\0\123\377"
-    "\377\377\377\377\0\0\0\276\377\377\377\377\33\0\0\0\0\0\17\377\377"
-    "\377\377\311\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\304"
-    "\377\377\377\377\140\0\0\0\0\143\377\377\377\377\377\0\0\0\0\377\377"
-    "\377\377\377\42\0\0\13\377\377\377\377\374\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377"
-    "\0\0\0\0\0\0\0\0\377\377\377\377\377\376\377\377\377\210\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\377\2\3\377\377\377\377\2\3\377\377\377\366\0\0\0\0\377\377\377\377"
-    "\377\42\0\0\14\377\377\377\377\373\0\0\0\0\304\377\377\377\377\120"
-    "\0\0\0\0\121\377\377\377\377\302\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\53\331\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\0\0\0\377\377\377\377\377\34\0\0\0\0\34\377\377\377\377\357\0"
-    "\0\0\0\351\377\377\377\377\47\0\0\0\0\0\0\0\0\0\0\0\0\360\377\377"
-    "\377\377\33\0\0\0\0\35\377\377\377\377\377\0\0\0\347\377\377\377\377"
-    "\374\374\375\375\376\376\377\377\377\377\377\355\0\0\0\0\0\0\0\377"
-    "\377\377\377\377\0\0\0\0\0\0\0\0\0\350\377\377\377\377\45\0\0\0\0"
-    "\47\377\377\377\377\377\0\0\0\0\377\377\377\377\377\6\0\0\0\377\377"
-    "\377\377\377\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\377\377\377\377"
-    "\377\377\377\377\377\272\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0\377\377\377\377\0\0\377\377"
-    "\377\374\0\0\0\0\377\377\377\377\377\6\0\0\1\377\377\377\377\377\0"
-    "\0\0\0\352\377\377\377\377\33\0\0\0\0\34\377\377\377\377\351\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\25\352\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\0\0\0\377\377\377\377\377\5\0"
-    "\0\0\0\6\377\377\377\377\374\0\0\0\0\374\377\377\377\377\10\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\375\377\377\377\377\5\0\0\0\0\6\377\377\377\377"
-    "\377\0\0\0\373\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\374\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\367"
-    "\377\377\377\377\14\0\0\0\0\15\377\377\377\377\377\0\0\0\0\377\377"
-    "\377\377\377\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0"
-    "\0\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377\123\0\0\0\0\0"
-    "\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\377\377\377\377"
-    "\0\0\377\377\377\377\0\0\377\377\377\377\0\0\0\0\377\377\377\377\377"
-    "\0\0\0\0\377\377\377\377\377\0\0\0\0\374\377\377\377\377\5\0\0\0\0"
-    "\6\377\377\377\377\373\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\214\377\377\377\377\362\162\47\11\0\2\377\377\377\377\377\0\0\0\377"
-    "\377\377\377\377\5\0\0\0\0\6\377\377\377\377\371\0\0\0\0\374\377\377"
-    "\377\377\7\0\0\0\0\0\0\0\0\0\0\0\0\372\377\377\377\377\5\0\0\0\0\6"
-    "\377\377\377\377\377\0\0\0\374\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\0\0\0\0\0\0\0\377\377\377\377\377\0\0"
-    "\0\0\0\0\0\0\0\373\377\377\377\377\14\0\0\0\0\15\377\377\377\377\377"
-    "\0\0\0\0\377\377\377\377\377\0\0\0\0\377\377\377\377\377\0\0\0\0\0"
-    "\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\377\377\0\0\0\0\0\0\0\0\377\377\377\377\377\377\340\377\377\377"
-    "\341\12\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0"
-    "\0\377\377\377\377\0\0\377\377\377\377\0\0\377\377\377\377\0\0\0\0"
-    "\377\377\377\377\377\0\0\0\0\377\377\377\377\377\0\0\0\0\374\377\377"
-    "\377\377\5\0\0\0\0\6\377\377\377\377\373\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\327\377\377\377\377\134\0\0\0\0\17\377\377\377"
-    "\377\377\0\0\0\377\377\377\377\377\34\0\0\0\0\34\377\377\377\377\353"
-    "\0\0\0\0\352\377\377\377\377\45\0\0\0\0\0\0\0\0\0\0\0\0\355\377\377"
-    "\377\377\33\0\0\0\0\34\377\377\377\377\377\0\0\0\353\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\0\0\0\0\0\0\0\377"
-    "\377\377\377\377\0\0\0\0\0\0\0\0\0\355\377\377\377\377\45\0\0\0\0"
-    "\47\377\377\377\377\377\0\0\0\0\377\377\377\377\377\0\0\0\0\377\377"
-    "\377\377\377\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\377\377\377\377"
-    "\377\232\27\363\377\377\377\205\0\0\0\0\0\0\0\0\0\0\377\377\377\377"
-    "\377\1\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0\377\377\377\377\0\0\377"
-    "\377\377\377\0\0\0\0\377\377\377\377\377\0\0\0\0\377\377\377\377\377"
-    "\0\0\0\0\352\377\377\377\377\32\0\0\0\0\34\377\377\377\377\351\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\365\377\377\377\377\17\0"
-    "\0\0\0\64\377\377\377\377\377\0\0\0\377\377\377\377\377\123\0\0\0"
-    "\0\121\377\377\377\377\317\0\0\0\0\303\377\377\377\377\160\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\321\377\377\377\377\121\0\0\0\0\123\377\377\377\377"
-    "\377\0\0\0\306\377\377\377\377\20\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\320\377\377\377\377\140"
-    "\0\0\0\0\142\377\377\377\377\377\0\0\0\0\377\377\377\377\377\0\0\0"
-    "\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\377"
-    "\377\377\377\377\1\0\202\377\377\377\371\45\0\0\0\0\0\0\0\0\0\371"
-    "\377\377\377\377\17\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0\377\377"
-    "\377\377\0\0\377\377\377\377\0\0\0\0\377\377\377\377\377\0\0\0\0\377"
-    "\377\377\377\377\0\0\0\0\304\377\377\377\377\120\0\0\0\0\120\377\377"
-    "\377\377\302\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\367\377\377"
-    "\377\377\6\0\0\0\0\172\377\377\377\377\377\0\0\0\377\377\377\377\377"
-    "\275\0\0\0\0\272\377\377\377\377\241\0\0\0\0\202\377\377\377\377\351"
-    "\33\0\0\0\0\0\0\0\0\0\0\0\243\377\377\377\377\271\0\0\0\0\275\377"
-    "\377\377\377\377\0\0\0\207\377\377\377\377\165\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\236\377\377"
-    "\377\377\306\1\0\0\1\312\377\377\377\377\377\0\0\0\0\377\377\377\377"
-    "\377\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\377\377\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0"
-    "\0\0\377\377\377\377\377\0\0\16\354\377\377\377\266\0\0\0\0\0\0\0"
-    "\0\0\343\377\377\377\377\105\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0"
-    "\377\377\377\377\0\0\377\377\377\377\0\0\0\0\377\377\377\377\377\0"
-    "\0\0\0\377\377\377\377\377\0\0\0\0\204\377\377\377\377\267\0\0\0\0"
-    "\270\377\377\377\377\202\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\331\377\377\377\377\77\0\0\0\20\346\377\377\377\377\377\0\0\0\377"
-    "\377\377\377\377\377\222\24\23\216\377\377\377\377\377\127\0\0\0\0"
-    "\44\374\377\377\377\377\343\141\30\3\15\60\155\311\0\0\0\0\132\377"
-    "\377\377\377\377\215\23\25\222\377\377\377\377\377\377\0\0\0\51\376"
-    "\377\377\377\376\231\75\22\2\7\25\62\136\226\334\0\0\0\0\0\0\0\0\377"
-    "\377\377\377\377\0\0\0\0\0\0\0\0\0\120\377\377\377\377\377\225\24"
-    "\26\231\377\377\377\377\377\377\0\0\0\0\377\377\377\377\377\0\0\0"
-    "\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\377"
-    "\377\377\377\377\0\0\0\163\377\377\377\377\117\0\0\0\0\0\0\0\0\272"
-    "\377\377\377\377\322\60\3\0\0\0\0\0\0\0\377\377\377\377\0\0\377\377"
-    "\377\377\0\0\377\377\377\377\0\0\0\0\377\377\377\377\377\0\0\0\0\377"
-    "\377\377\377\377\0\0\0\0\50\376\377\377\377\377\214\23\23\214\377"
-    "\377\377\377\375\45\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\223"
-    "\377\377\377\377\330\61\6\64\310\377\377\377\377\377\377\0\0\0\377"
-    "\377\377\377\377\376\377\377\377\377\377\377\377\377\351\12\0\0\0"
-    "\0\0\226\377\377\377\377\377\377\377\377\377\377\377\377\0\0\0\0\14"
-    "\353\377\377\377\377\377\377\377\377\376\377\377\377\377\377\0\0\0"
-    "\0\235\377\377\377\377\377\377\377\377\377\377\377\377\377\377\0\0"
-    "\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\5\337\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\0\0\0\0\377\377\377\377"
-    "\377\0\0\0\0\377\377\377\377\377\0\0\0\0\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\377\377\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\10\342\377"
-    "\377\377\337\11\0\0\0\0\0\0\0\165\377\377\377\377\377\377\377\377"
-    "\377\377\0\0\0\0\377\377\377\377\0\0\377\377\377\377\0\0\377\377\377"
-    "\377\0\0\0\0\377\377\377\377\377\0\0\0\0\377\377\377\377\377\0\0\0"
-    "\0\0\241\377\377\377\377\377\377\377\377\377\377\377\377\235\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\42\364\377\377\377\377\377"
-    "\377\377\377\374\377\377\377\377\377\0\0\0\377\377\377\377\377\246"
-    "\377\377\377\377\377\377\377\377\144\0\0\0\0\0\0\11\305\377\377\377"
-    "\377\377\377\377\377\377\377\377\0\0\0\0\0\150\377\377\377\377\377"
-    "\377\377\377\244\377\377\377\377\377\0\0\0\0\13\310\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\0\0\0\0\0\0\0\0\377\377\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\113\376\377\377\377\377\377\377\377\324\377"
-    "\377\377\377\377\0\0\0\0\377\377\377\377\377\0\0\0\0\377\377\377\377"
-    "\377\0\0\0\0\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0"
-    "\377\377\377\377\377\0\0\0\0\143\377\377\377\377\201\0\0\0\0\0\0\0"
-    "\25\361\377\377\377\377\377\377\377\377\377\0\0\0\0\377\377\377\377"
-    "\0\0\377\377\377\377\0\0\377\377\377\377\0\0\0\0\377\377\377\377\377"
-    "\0\0\0\0\377\377\377\377\377\0\0\0\0\0\17\324\377\377\377\377\377"
-    "\377\377\377\377\377\321\15\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\113\363\377\377\377\377\377\377\367\131\377\377\377\377"
-    "\377\0\0\0\377\377\377\377\377\22\325\377\377\377\377\377\377\221"
-    "\0\0\0\0\0\0\0\0\13\236\376\377\377\377\377\377\377\377\377\377\0"
-    "\0\0\0\0\0\224\377\377\377\377\377\377\323\21\377\377\377\377\377"
-    "\0\0\0\0\0\13\231\375\377\377\377\377\377\377\377\377\377\377\377"
-    "\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\151\373"
-    "\377\377\377\377\377\357\63\377\377\377\377\377\0\0\0\0\377\377\377"
-    "\377\377\0\0\0\0\377\377\377\377\377\0\0\0\0\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\0\0\0\0\0\0\0\0\0\377"
-    "\377\377\377\377\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\3\330"
-    "\377\377\377\367\42\0\0\0\0\0\0\0\107\364\377\377\377\377\377\377"
-    "\377\377\0\0\0\0\377\377\377\377\0\0\377\377\377\377\0\0\377\377\377"
-    "\377\0\0\0\0\377\377\377\377\377\0\0\0\0\377\377\377\377\377\0\0\0"
-    "\0\0\0\25\273\377\377\377\377\377\377\377\377\271\23\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\37\216\325\365\373\335\227"
-    "\41\0\377\377\377\377\377\0\0\0\377\377\377\377\377\0\16\211\336\374"
-    "\360\272\115\0\0\0\0\0\0\0\0\0\0\0\56\216\315\361\375\367\342\275"
-    "\202\57\0\0\0\0\0\0\0\116\273\360\374\336\207\15\0\377\377\377\377"
-    "\377\0\0\0\0\0\0\0\44\200\301\350\372\374\364\342\304\232\145\42\0"
-    "\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\61\244"
-    "\344\371\343\237\45\7\377\377\377\377\364\0\0\0\0\377\377\377\377"
-    "\377\0\0\0\0\377\377\377\377\377\0\0\0\0\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\0\0\0\0\0\0\0\0\3\377\377"
-    "\377\377\374\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\124\377"
-    "\377\377\377\263\0\0\0\0\0\0\0\0\36\214\320\360\376\377\377\377\377"
-    "\0\0\0\0\377\377\377\377\0\0\377\377\377\377\0\0\377\377\377\377\0"
-    "\0\0\0\377\377\377\377\377\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0"
-    "\0\0\113\251\341\372\372\341\251\112\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\50\377\377\377\377\345\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\30\377"
-    "\377\377\377\357\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\210\377\377\377\377\274"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\134\377\377\377\377\330\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\322"
-    "\200\103\34\10\10\50\211\373\377\377\377\377\200\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\24\125\352\377\377\377\377\252\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\374\36\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\377\377\377\377\377\377\377\136\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\200\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377"
-    "\377\377\377\377\377\337\12\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377"
-    "\377\377\377\374\202\2\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377"
-    "\377\377\352\64\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\47\162\255\327\361\374\366\346\275"
-    "\201\37\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\374\355\306\176\23"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\21"
-    "\172\277\344\365\376\377\377\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0"
-    "\0\0\0\0\0\0\0\0\377\377\376\365\344\276\170\20\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\27\342"
-    "\377\377\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0"
-    "\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\340\25\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\210\377"
-    "\377\377\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0"
-    "\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377\206\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\315\377"
-    "\377\377\275\55\6\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0"
-    "\0\0\0\0\0\0\0\6\60\305\377\377\377\313\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\360\377\377\377\63"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\67\377\377\377\357\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\375\377\377\377\12\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\14\377\377"
-    "\377\374\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\14\174"
-    "\326\366\351\263\107\0\0\0\0\0\0\0\0\0\110\263\351\366\326\173\12"
-    "\0\377\377\377\377\377\0\0\0\0\0\0\377\377\377\377\377\0\11\173\326"
-    "\371\356\263\106\0\0\0\0\0\0\21\157\271\344\367\373\356\322\251\161"
-    "\47\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\0\0\0\0\0\377\377\377\377\377\0\0\0\0\377\377\377\377\377"
-    "\0\0\0\330\377\377\377\306\0\0\0\0\0\0\0\307\377\377\377\327\0\352"
-    "\377\377\342\0\0\0\0\0\0\0\0\0\0\0\343\377\377\351\0\0\252\377\377"
-    "\377\377\227\0\0\0\0\230\377\377\377\377\253\0\0\321\377\377\377\361"
-    "\7\0\0\0\0\0\6\361\377\377\377\321\0\0\0\0\377\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\377\377\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\1\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\377\377\20\311\377\377\377\377\377\377\210\0\0\0\0\0\0\0\214\377"
-    "\377\377\377\377\377\307\17\377\377\377\377\377\0\0\0\0\0\0\377\377"
-    "\377\377\377\17\315\377\377\377\377\377\377\0\0\0\0\0\112\353\377"
-    "\377\377\377\377\377\377\377\377\377\0\0\0\0\0\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\0\0\0\0\0\377\377\377\377"
-    "\377\0\0\0\0\377\377\377\377\377\0\0\0\210\377\377\377\373\16\0\0"
-    "\0\0\0\17\374\377\377\377\207\0\276\377\377\376\11\0\0\0\0\0\0\0\0"
-    "\0\12\376\377\377\275\0\0\25\352\377\377\377\371\35\0\0\35\371\377"
-    "\377\377\353\25\0\0\163\377\377\377\377\113\0\0\0\0\0\111\377\377"
-    "\377\377\165\0\0\0\0\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\232\377\377\377"
-    "\377\377\377\377\377\142\0\0\0\0\0\146\377\377\377\377\377\377\377"
-    "\377\230\377\377\377\377\377\0\0\0\0\0\0\377\377\377\377\377\235\377"
-    "\377\377\377\377\377\377\0\0\0\0\62\373\377\377\377\377\377\377\377"
-    "\377\377\377\377\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\0\0\0\0\0\377\377\377\377\377\0\0\0\0\377\377"
-    "\377\377\377\0\0\0\70\377\377\377\377\117\0\0\0\0\0\122\377\377\377"
-    "\377\67\0\221\377\377\377\54\0\0\0\0\0\0\0\0\0\57\377\377\377\220"
-    "\0\0\0\124\377\377\377\377\225\0\0\226\377\377\377\377\127\0\0\0\30"
-    "\374\377\377\377\235\0\0\0\0\0\231\377\377\377\375\33\0\0\0\0\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\377\0\0\0\0\0\0\0"
-    "\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\377\377\377\377\377\376\377\377\377\377\377\377\377\377\351"
-    "\12\0\0\0\14\353\377\377\377\377\377\377\377\377\376\377\377\377\377"
-    "\377\0\0\0\0\0\0\377\377\377\377\377\373\377\377\377\377\377\377\377"
-    "\0\0\0\0\261\377\377\377\377\377\377\377\377\377\377\377\377\0\0\0"
-    "\0\0\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\0"
-    "\0\0\0\0\377\377\377\377\377\0\0\0\0\377\377\377\377\377\0\0\0\1\346"
-    "\377\377\377\224\0\0\0\0\0\227\377\377\377\345\1\0\145\377\377\377"
-    "\121\0\0\0\0\0\0\0\0\0\125\377\377\377\144\0\0\0\0\250\377\377\377"
-    "\370\34\34\371\377\377\377\256\0\0\0\0\0\266\377\377\377\353\3\0\0"
-    "\0\1\347\377\377\377\275\0\0\0\0\0\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\377\354\0\0\0\0\0\0\0\0\0\7\377\377\377\377\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\377\377\377\377\6\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377"
-    "\377\223\26\24\216\377\377\377\377\377\127\0\0\0\132\377\377\377\377"
-    "\377\216\24\26\223\377\377\377\377\377\377\0\0\0\0\0\0\377\377\377"
-    "\377\377\377\335\134\30\4\26\114\265\0\0\0\0\355\377\377\377\377\217"
-    "\41\4\7\33\103\177\322\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0"
-    "\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\377\377\377\377\377\0"
-    "\0\0\0\227\377\377\377\331\0\0\0\0\0\334\377\377\377\226\0\0\70\377"
-    "\377\377\167\0\0\0\0\0\0\0\0\0\173\377\377\377\67\0\0\0\0\24\351\377"
-    "\377\377\224\225\377\377\377\355\27\0\0\0\0\0\127\377\377\377\377"
-    "\101\0\0\0\71\377\377\377\377\141\0\0\0\0\0\0\0\0\0\0\0\0\41\355\377"
-    "\377\377\374\103\0\0\0\0\0\0\0\0\0\44\377\377\377\366\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\367"
-    "\377\377\377\45\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\275"
-    "\0\0\0\0\272\377\377\377\377\241\0\0\0\242\377\377\377\377\272\0\0"
-    "\0\0\276\377\377\377\377\377\0\0\0\0\0\0\377\377\377\377\377\335\21"
-    "\0\0\0\0\0\0\0\0\0\0\371\377\377\377\377\24\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377"
-    "\377\0\0\0\0\377\377\377\377\377\0\0\0\0\107\377\377\377\377\36\0"
-    "\0\0\41\377\377\377\377\106\0\0\15\376\377\377\234\0\0\163\377\377"
-    "\377\166\0\0\240\377\377\376\14\0\0\0\0\0\121\377\377\377\370\370"
-    "\377\377\377\133\0\0\0\0\0\0\10\360\377\377\377\223\0\0\0\211\377"
-    "\377\377\366\16\0\0\0\0\0\0\0\0\0\0\0\12\320\377\377\377\377\161\0"
-    "\0\0\0\0\0\0\0\0\0\170\377\377\377\331\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\332\377\377\377\172"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\123\0\0\0\0\122\377"
-    "\377\377\377\316\0\0\0\320\377\377\377\377\121\0\0\0\0\123\377\377"
-    "\377\377\377\0\0\0\0\0\0\377\377\377\377\377\132\0\0\0\0\0\0\0\0\0"
-    "\0\0\327\377\377\377\377\334\156\44\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0"
-    "\377\377\377\377\377\0\0\0\0\6\361\377\377\377\142\0\0\0\147\377\377"
-    "\377\360\5\0\0\0\337\377\377\301\0\0\251\377\377\377\252\0\0\306\377"
-    "\377\336\0\0\0\0\0\0\0\246\377\377\377\377\377\377\261\0\0\0\0\0\0"
-    "\0\0\232\377\377\377\343\1\0\0\330\377\377\377\251\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\247\377\377\377\377\243\0\0\0\0\0\0\0\0\6\43\167\370\377"
-    "\377\377\224\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\227\377\377\377\371\172\44\6\0\0\0\0\0\0\57\236"
-    "\340\372\355\270\140\10\0\0\0\0\0\6\230\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\34\0\0\0\0\34\377\377\377"
-    "\377\353\0\0\0\355\377\377\377\377\33\0\0\0\0\35\377\377\377\377\377"
-    "\0\0\0\0\0\0\377\377\377\377\377\33\0\0\0\0\0\0\0\0\0\0\0\172\377"
-    "\377\377\377\377\377\377\351\243\110\1\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\377\377\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\377"
-    "\377\377\377\377\0\0\0\0\0\247\377\377\377\247\0\0\0\255\377\377\377"
-    "\246\0\0\0\0\263\377\377\346\0\0\337\377\377\377\337\0\0\354\377\377"
-    "\262\0\0\0\0\0\0\0\22\347\377\377\377\377\356\31\0\0\0\0\0\0\0\0\74"
-    "\377\377\377\377\67\0\51\377\377\377\377\115\0\0\0\0\0\0\0\0\0\0\0"
-    "\164\377\377\377\377\315\11\0\0\0\0\0\0\0\377\377\377\377\377\377"
-    "\377\322\27\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\31\323\377\377\377\377\377\377\377\0\0\0\0\203"
-    "\374\377\377\377\377\377\377\346\175\54\6\27\135\325\377\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\5\0\0\0\0"
-    "\6\377\377\377\377\371\0\0\0\372\377\377\377\377\5\0\0\0\0\6\377\377"
-    "\377\377\377\0\0\0\0\0\0\377\377\377\377\377\6\0\0\0\0\0\0\0\0\0\0"
-    "\0\5\265\377\377\377\377\377\377\377\377\377\307\42\0\0\0\0\0\0\0"
-    "\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377"
-    "\0\0\0\0\377\377\377\377\377\0\0\0\0\0\126\377\377\377\352\1\0\3\357"
-    "\377\377\377\126\0\0\0\0\206\377\377\377\14\25\377\377\376\377\377"
-    "\23\21\377\377\377\206\0\0\0\0\0\0\0\0\152\377\377\377\377\171\0\0"
-    "\0\0\0\0\0\0\0\0\334\377\377\377\212\0\171\377\377\377\353\5\0\0\0"
-    "\0\0\0\0\0\0\0\104\374\377\377\377\352\36\0\0\0\0\0\0\0\0\377\377"
-    "\377\377\377\372\222\6\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\6\220\371\377\377\377\377\377\0"
-    "\0\0\0\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377"
-    "\377\5\0\0\0\0\6\377\377\377\377\371\0\0\0\371\377\377\377\377\5\0"
-    "\0\0\0\6\377\377\377\377\377\0\0\0\0\0\0\377\377\377\377\377\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\2\143\325\377\377\377\377\377\377\377\377\345"
-    "\27\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\377\377\377\0\0\0\0\377\377\377\377\377\0\0\0\0\0\15\370\377"
-    "\377\377\61\0\67\377\377\377\370\15\0\0\0\0\132\377\377\377\61\113"
-    "\377\377\263\377\377\110\70\377\377\377\131\0\0\0\0\0\0\0\12\326\377"
-    "\377\377\377\337\16\0\0\0\0\0\0\0\0\0\177\377\377\377\333\0\311\377"
-    "\377\377\225\0\0\0\0\0\0\0\0\0\0\40\354\377\377\377\373\100\0\0\0"
-    "\0\0\0\0\0\0\377\377\377\377\377\377\377\306\15\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\15\305\377"
-    "\377\377\377\377\377\377\0\0\0\0\377\322\137\32\5\34\136\300\377\377"
-    "\377\377\377\377\375\205\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\377\377\377\377\377\34\0\0\0\0\34\377\377\377\377\353\0\0\0\354"
-    "\377\377\377\377\33\0\0\0\0\34\377\377\377\377\377\0\0\0\0\0\0\377"
-    "\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\47\147\261\364\377"
-    "\377\377\377\377\222\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0"
-    "\0\0\0\0\0\0\377\377\377\377\377\0\0\0\6\377\377\377\377\377\0\0\0"
-    "\0\0\0\266\377\377\377\166\0\175\377\377\377\265\0\0\0\0\0\56\377"
-    "\377\377\126\201\377\377\76\377\377\174\135\377\377\377\55\0\0\0\0"
-    "\0\0\0\231\377\377\377\377\377\377\245\0\0\0\0\0\0\0\0\0\41\376\377"
-    "\377\377\110\376\377\377\377\71\0\0\0\0\0\0\0\0\0\12\320\377\377\377"
-    "\377\156\0\0\0\0\0\0\0\0\0\0\0\7\45\174\372\377\377\377\203\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\204\377\377\377\372\177\46\7\0\0\0\0\0\214\4\0\0\0\0\0\0\62\233"
-    "\342\373\345\244\63\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\377\377\377\377\377\123\0\0\0\0\121\377\377\377\377\320\0\0\0\320"
-    "\377\377\377\377\121\0\0\0\0\123\377\377\377\377\377\0\0\0\0\0\0\377"
-    "\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\12\205\377"
-    "\377\377\377\337\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0"
-    "\0\0\0\0\374\377\377\377\377\12\0\0\41\377\377\377\377\377\0\0\0\0"
-    "\0\0\146\377\377\377\273\0\302\377\377\377\145\0\0\0\0\0\6\373\377"
-    "\377\173\267\377\344\0\344\377\261\203\377\377\372\5\0\0\0\0\0\0\121"
-    "\377\377\377\377\377\377\377\377\133\0\0\0\0\0\0\0\0\0\302\377\377"
-    "\377\336\377\377\377\334\0\0\0\0\0\0\0\0\0\0\246\377\377\377\377\240"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\177\377\377\377\316\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\317\377"
-    "\377\377\200\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\275\0"
-    "\0\0\0\272\377\377\377\377\242\0\0\0\242\377\377\377\377\271\0\0\0"
-    "\0\275\377\377\377\377\377\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\13\377\377\377\377\372\0\0\0\0\0"
-    "\0\0\0\372\377\377\377\377\21\0\0\0\0\0\0\0\0\0\0\360\377\377\377"
-    "\377\61\0\0\145\377\377\377\377\377\0\0\0\0\0\0\30\375\377\377\367"
-    "\25\372\377\377\375\27\0\0\0\0\0\0\325\377\377\241\354\377\251\0\252"
-    "\377\346\251\377\377\324\0\0\0\0\0\0\34\355\377\377\377\246\257\377"
-    "\377\377\361\40\0\0\0\0\0\0\0\0\143\377\377\377\377\377\377\377\201"
-    "\0\0\0\0\0\0\0\0\0\164\377\377\377\377\313\10\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\50\377\377\377\360\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\361\377\377\377\50\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\222\24\23\216\377\377\377"
-    "\377\377\131\0\0\0\132\377\377\377\377\377\215\23\25\222\377\377\377"
-    "\377\377\377\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\332\221\130\56\21\4\6\51\232\377\377\377\377\356\0\0\0\0\0\0\0"
-    "\0\343\377\377\377\377\233\31\1\0\0\0\0\0\0\0\0\320\377\377\377\377"
-    "\254\17\55\344\377\377\377\377\377\0\0\0\0\0\0\0\305\377\377\377\222"
-    "\377\377\377\304\0\0\0\0\0\0\0\250\377\377\346\377\377\157\0\160\377"
-    "\377\346\377\377\247\0\0\0\0\0\2\277\377\377\377\362\31\36\364\377"
-    "\377\377\305\3\0\0\0\0\0\0\0\16\366\377\377\377\377\377\377\45\0\0"
-    "\0\0\0\0\0\0\103\374\377\377\377\351\35\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\10\377\377\377\375\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\375\377\377\377\7\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\353\13\0\0\0\14\353\377\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\377\270\0\0\0\0\0\0\0"
-    "\0\261\377\377\377\377\377\377\377\377\377\377\0\0\0\0\0\227\377\377"
-    "\377\377\377\377\377\377\377\377\377\377\377\0\0\0\0\0\0\0\165\377"
-    "\377\377\371\377\377\377\164\0\0\0\0\0\0\0\174\377\377\377\377\377"
-    "\64\0\65\377\377\377\377\377\173\0\0\0\0\0\173\377\377\377\377\161"
-    "\0\0\167\377\377\377\377\200\0\0\0\0\0\0\0\0\246\377\377\377\377\377"
-    "\311\0\0\0\0\0\0\0\0\0\354\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\237\377\377"
-    "\377\377\377\377\377\377\144\0\0\0\0\0\144\377\377\377\377\377\377"
-    "\377\377\236\377\377\377\377\377\0\0\0\0\0\0\377\377\377\377\377\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\103\0\0\0\0\0\0\0\0\127\377\377\377\377\377\377\377\377\377"
-    "\377\0\0\0\0\0\71\377\377\377\377\377\377\377\275\377\377\377\377"
-    "\377\0\0\0\0\0\0\0\45\377\377\377\377\377\377\377\44\0\0\0\0\0\0\0"
-    "\117\377\377\377\377\365\4\0\4\366\377\377\377\377\116\0\0\0\0\67"
-    "\373\377\377\377\322\4\0\0\5\325\377\377\377\374\72\0\0\0\0\0\0\0"
-    "\110\377\377\377\377\377\155\0\0\0\0\0\0\0\0\0\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\377\377\16\310\377\377\377\377\377\377\207\0\0\0\0\0\0\0\207"
-    "\377\377\377\377\377\377\310\16\377\377\377\377\377\0\0\0\0\0\0\377"
-    "\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377"
-    "\377\377\377\377\366\144\0\0\0\0\0\0\0\0\0\1\247\377\377\377\377\377"
-    "\377\377\377\377\0\0\0\0\0\0\231\377\377\377\377\377\361\54\377\377"
-    "\377\377\377\0\0\0\0\0\0\0\0\325\377\377\377\377\377\324\0\0\0\0\0"
-    "\0\0\0\43\377\377\377\377\277\0\0\0\300\377\377\377\377\42\0\0\0\16"
-    "\335\377\377\377\376\74\0\0\0\0\77\377\377\377\377\336\16\0\0\0\0"
-    "\0\0\3\346\377\377\377\373\25\0\0\0\0\0\0\0\0\0\377\377\377\377\377"
-    "\377\377\377\377\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\377\377\0\12\200\333\370\347\256\101\0\0\0\0\0\0\0\0\0\101\256"
-    "\347\370\333\200\12\0\377\377\377\377\377\0\0\0\0\0\0\377\377\377"
-    "\377\377\0\0\0\0\0\0\0\0\0\0\0\0\41\141\225\300\337\363\375\367\345"
-    "\276\173\33\0\0\0\0\0\0\0\0\0\0\0\0\112\240\323\357\375\377\377\377"
-    "\377\0\0\0\0\0\0\2\156\323\370\357\255\51\0\377\377\377\377\377\0"
-    "\0\0\0\0\0\0\0\204\377\377\377\377\377\204\0\0\0\0\0\0\0\0\1\364\377"
-    "\377\377\205\0\0\0\205\377\377\377\364\1\0\0\0\244\377\377\377\377"
-    "\241\0\0\0\0\0\0\242\377\377\377\377\244\0\0\0\0\0\0\0\266\377\377"
-    "\377\265\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377\377\377"
-    "\377\377\377\377\0\0\0\0\0\0\0\0\0\0\377\377\377\377\2\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\3\377\377"
-    "\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\24\370\377\377\377\131\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\372\377\377\377\20\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\22"
-    "\377\377\377\371\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377"
-    "\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\203\377\377\377\363\12\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\354\377\377\377\75"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\102\377\377\377\353\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\22\141\371\377\377\377\236\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\305\377\377"
-    "\377\306\60\6\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0"
-    "\0\0\0\0\0\6\65\315\377\377\377\303\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377\63"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\175\377\377\377\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\377\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\377\377\173\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\377\377\377\377\253\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\21\334\377\377\377\377\377\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\377\377\377\377\331\17\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377"
-    "\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377"
-    "\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\377\377\377\377\377\377\332\24\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\15\165"
-    "\274\344\366\376\377\377\0\0\0\0\0\0\0\0\0\0\377\377\377\377\0\0\0"
-    "\0\0\0\0\0\0\377\377\376\366\344\274\164\15\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\377\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\376\350\227"
-    "\23\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\377\377\377\377"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\377\377\377\377\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0"
-    "\0\0\0\0\0\0\0\0\0"
+    304, 444, 37770,
+    "\377\0\377\0\377\0\377\0\377\0\377\0\377\0\377\0\377\0\377\0\211\0"
+    "\200\377\377\0\377\0\252\0\200\377\0\1\311\0\2\266\377\275\211\0\2"
+    "\276\377\266\377\0\224\0\201\377\213\0\201\377\201\0\201\377\212\0"
+    "\3\21\375\377m\201\0\2\303\377\265\211\0\200\377\0\2\210\0\5U\304"
+    "\364\363\277M\216\0\7H\255\344\371\364\316\214\62\213\0\201\377"
+    "\220\0\0K\200\377\0\70\211\0\0:\200\377\0J\220\0\200\377\337\0\0;"
+    "\200\377\0\304\233\0\201\377\213\0\201\377\201\0\201\377\212\0\0S"
+    "\200\377\0(\200\0\3\15\373\377o\211\0\200\377\0\3\207\0\0\220\204"
+    "\377\0\207\213\0\1\2\232\206\377\213\0\201\377\217\0\3\1\322\377"
+    "\276\213\0\3\301\377\320\1\217\0\200\377\337\0\0\262\200\377\0N"
+    "\233\0\201\377\213\0\201\377\201\0\201\377\212\0\2\230\377\343\201"
+    "\0\0M\200\377\0*\205\0\3\12l\276\355\200\377\4\363\325\250m&\202\0"
+    "\11V\377\367j\17\20l\370\377L\212\0\0k\207\377\213\0\201\377\217\0"
+    "\0U\200\377\0K\213\0\0N\200\377\0S\211\0\2a\223\12\201\0\200\377"
+    "\201\0\2\12\223`\330\0\4)\376\377\326\1\233\0\201\377\213\0\201"
+    "\377\201\0\201\377\212\0\2\334\377\237\201\0\2\223\377\344\205\0\1"
+    "\61\340\210\377\202\0\2\304\377i\202\0\2l\377\275\212\0\0\321\200"
+    "\377\6\330J\15\5 ]\301\213\0\201\377\217\0\3\311\377\343\2\213\0\3"
+    "\3\346\377\306\211\0\3\314\377\333;\200\0\200\377\200\0\3;\333\377"
+    "\313\330\0\0\236\200\377\0b\234\0\201\377\213\0\201\377\201\0\201"
+    "\377\211\0\0!\200\377\0Z\201\0\2\330\377\237\204\0\1\31\351\201"
+    "\377\0\376\205\377\202\0\2\365\377\16\202\0\2\17\377\363\212\0\0"
+    "\370\200\377\0)\221\0\201\377\216\0\0\65\200\377\0\207\215\0\0\214"
+    "\200\377\0\62\210\0\1\22\231\200\375\1\213\7\200\377\1\10\213\200"
+    "\375\1\230\22\210\0\201\377\312\0\4\32\371\377\345\6\234\0\201\377"
+    "\213\0\201\377\201\0\201\377\211\0\3f\377\376\27\200\0\0\35\200"
+    "\377\0Z\204\0\0\217\200\377\2\362c\17\200\377\4\12$P\214\330\202\0"
+    "\2\365\377\16\202\0\2\17\377\364\212\0\0\355\200\377\0\13\221\0"
+    "\201\377\216\0\0\223\200\377\0\66\215\0\0<\200\377\0\217\212\0\3"
+    "\66\314\377\326\200\377\3\326\377\313\65\212\0\201\377\312\0\0\212"
+    "\200\377\0v\235\0\201\377\213\0\201\377\201\0\201\377\204\0\0\70"
+    "\217\377\201\0\0\332\200\377\0f\200\0\200\377\207\0\2\305\377e\202"
+    "\0\2l\377\303\212\0\0\263\200\377\0L\221\0\201\377\215\0\4\1\350"
+    "\377\355\1\215\0\3\2\356\377\344\213\0\2\2j\357\200\377\2\357j\2"
+    "\213\0\201\377\311\0\4\17\361\377\360\16\235\0\201\377\213\0\201"
+    "\377\201\0\201\377\204\0\0\70\217\377\201\0\0\370\200\377\0\26\200"
+    "\0\200\377\207\0\11X\377\365d\15\20l\370\377U\203\0\2\63\240\31"
+    "\202\0\0F\200\377\1\317\5\220\0\201\377\215\0\0\62\200\377\0\271"
+    "\217\0\0\263\200\377\0-\212\0\2\2i\356\200\377\2\356h\2\213\0\201"
+    "\377\311\0\0w\200\377\0\211\236\0\201\377\213\0\201\377\201\0\201"
+    "\377\204\0\0\70\217\377\201\0\0\363\200\377\0\21\200\0\200\377\210"
+    "\0\0\223\204\377\0\217\201\0\5\4V\304\377\375W\203\0\0\247\200\377"
+    "\0\224\220\0\201\377\215\0\0p\200\377\0\205\217\0\0|\200\377\0m"
+    "\211\0\3\64\312\377\326\200\377\3\326\377\312\63\212\0\201\377\310"
+    "\0\4\6\346\377\371\31\236\0\201\377\236\0\0:\200\377\0>\200\0\3\3"
+    "\361\377\206\205\0\0\306\200\377\0a\200\0\200\377\211\0\1X\305\200"
+    "\365\1\304T\200\0\6\23y\343\377\357\215!\203\0\1<\337\201\377\0b"
+    "\241\0\0\242\200\377\0Q\217\0\0P\200\377\0\240\207\0\1\20\225\200"
+    "\375\1\214\10\200\377\1\10\214\200\375\1\225\20\210\0\201\377\310"
+    "\0\0c\200\377\0\235\237\0\2\364\377\363\236\0\3}\377\365\6\200\0\0"
+    "\67\200\377\0B\205\0\0f\200\377\2\364p\25\200\377\217\0\6.\234\366"
+    "\377\325i\13\204\0\3^\372\377\364\200\377\1\367\61\240\0\0\312\200"
+    "\377\0\63\217\0\0/\200\377\0\310\207\0\3\313\377\333;\200\0\200"
+    "\377\200\0\3<\334\377\312\210\0\201\377\307\0\4\1\327\377\376(\237"
+    "\0\2\345\377\344\236\0\2\300\377\271\201\0\3x\377\367\10\205\0\1\3"
+    "\265\201\377\0\376\200\377\2\207S\20\211\0\6\2P\276\377\375\262D"
+    "\206\0\5P\375\377\250\23\322\200\377\1\336\20\201\0\0\5\200\377\0"
+    "\376\230\0\0\346\200\377\0!\217\0\0\25\200\377\0\345\207\0\2a\224"
+    "\12\201\0\200\377\201\0\2\13\224a\201\0\217\377\300\0\0O\200\377\0"
+    "\261\240\0\2\326\377\325\235\0\3\12\371\377w\201\0\2\272\377\274"
+    "\207\0\2\5\210\367\204\377\2\372\247'\205\0\6\20s\336\377\357\215"
+    "\42\207\0\7\25\357\377\304\4\0%\361\200\377\1\263\1\200\0\0\1\200"
+    "\377\0\364\230\0\0\366\200\377\0\20\217\0\0\11\200\377\0\365\215\0"
+    "\200\377\207\0\217\377\300\0\0\305\200\377\0;\240\0\2\307\377\306"
+    "\235\0\0F\200\377\0\65\200\0\3\6\365\377y\211\0\2\24i\250\204\377"
+    "\1\366W\202\0\6(\225\364\377\325i\13\200\0\5V\305\364\362\274G\201"
+    "\0\0\204\200\377\0C\201\0\0Q\201\377\0|\200\0\0\12\200\377\0\327"
+    "\230\0\0\375\200\377\0\4\217\0\0\2\200\377\0\375\215\0\200\377\207"
+    "\0\217\377\230\0\206\377\235\0\0;\200\377\0\304\241\0\2\270\377"
+    "\267\231\0\217\377\0\70\210\0\200\377\2-e\305\200\377\1\373\64\200"
+    "\0\4\24\374\375\262E\202\0\0\220\204\377\0{\200\0\0\323\200\377\0"
+    "\11\202\0\0\212\200\377\3\375E\0&\200\377\0\241\230\0\0\366\200"
+    "\377\0\21\217\0\0\11\200\377\0\364\237\0\201\377\237\0\206\377\235"
+    "\0\0\262\200\377\0N\277\0\217\377\0\70\210\0\200\377\201\0\0\227"
+    "\200\377\0\257\201\0\1j\42\203\0\13V\377\366g\16\20n\371\377D\0"
+    "\367\200\377\0\12\202\0\1\3\300\200\377\2\353\35[\200\377\0M\230\0"
+    "\0\346\200\377\0\42\217\0\0\26\200\377\0\345\237\0\201\377\237\0"
+    "\206\377\234\0\4)\376\377\326\1\277\0\217\377\0\70\210\0\200\377"
+    "\201\0\0\35\200\377\0\354\210\0\2\304\377g\202\0\4o\377\273\0\371"
+    "\200\377\0:\203\0\1\27\345\200\377\4\310\301\377\322\2\230\0\0\311"
+    "\200\377\0\63\217\0\0\60\200\377\0\310\237\0\201\377\305\0\0\236"
+    "\200\377\0b\303\0\0\42\200\377\0U\201\0\2\333\377\235\215\0\200"
+    "\377\201\0\0\20\200\377\0\367\210\0\2\365\377\16\202\0\4\21\377"
+    "\363\0\325\200\377\0\256\204\0\1<\373\201\377\1\366\61\231\0\0\241"
+    "\200\377\0S\217\0\0R\200\377\0\240\237\0\201\377\304\0\4\32\371"
+    "\377\345\6\303\0\3g\377\375\22\200\0\0 \200\377\0X\215\0\200\377"
+    "\201\0\0v\200\377\0\322\210\0\2\365\377\16\202\0\4\17\377\364\0"
+    "\211\201\377\1\201\1\203\0\0q\201\377\0i\232\0\0o\200\377\0\207"
+    "\217\0\0~\200\377\0m\237\0\201\377\216\0\202\377\240\0\202\377\212"
+    "\0\0\212\200\377\0v\243\0\201\377\234\0\2\254\377\312\201\0\3e\377"
+    "\376\25\207\0\3\326\206F\25\200\0\200\377\3\21\71\237\376\200\377"
+    "\0s\210\0\2\307\377f\202\0\5j\377\303\0\30\360\201\377\6\301R\27\2"
+    "\5:\251\201\377\1\313\2\231\0\0\61\200\377\0\273\217\0\0\266\200"
+    "\377\0-\237\0\201\377\216\0\202\377\240\0\202\377\211\0\4\17\361"
+    "\377\360\16\243\0\201\377\233\0\3\2\355\377\205\201\0\2\253\377"
+    "\317\210\0\202\377\1\363\343\205\377\1\302\5\210\0\11]\377\366f\16"
+    "\17j\367\377R\200\0\1L\372\203\377\200\376\200\377\1\303\367\200"
+    "\377\0o\231\0\4\1\347\377\356\1\215\0\3\3\360\377\345\240\0\201"
+    "\377\216\0\202\377\240\0\202\377\211\0\0w\200\377\0\211\244\0\201"
+    "\377\233\0\0\65\200\377\0\77\200\0\3\2\355\377\212\210\0\212\377\1"
+    "\242\14\212\0\0\233\204\377\0\213\202\0\1A\343\205\377\2\275\15{"
+    "\200\377\1\362\34\231\0\0\222\200\377\0\70\215\0\0\77\200\377\0"
+    "\217\262\0\0\37\201\377\0\301\240\0\202\377\210\0\4\6\346\377\371"
+    "\31\244\0\201\377\233\0\3z\377\364\6\200\0\0\65\200\377\0F\210\0\5"
+    "#f\234\306\345\370\200\377\3\356\316\221\60\215\0\5^\310\366\364"
+    "\303R\204\0\13\12h\271\351\375\363\303a\2\0\6\326\200\377\0\257"
+    "\231\0\0\64\200\377\0\212\215\0\0\220\200\377\0\62\262\0\0v\200"
+    "\377\1\362!\240\0\202\377\210\0\0c\200\377\0\235\336\0\0\4\200\377"
+    "\0\3\307\0\3\307\377\345\3\213\0\3\4\351\377\306\263\0\0\316\200"
+    "\377\0d\256\0\4\1\327\377\376(\336\0\0\3\200\377\0\2\307\0\0R\200"
+    "\377\0N\213\0\0R\200\377\0S\262\0\0%\200\377\0\265\257\0\0O\200"
+    "\377\0\261\337\0\0\2\200\377\0\1\307\0\3\1\321\377\300\213\0\3\304"
+    "\377\321\1\262\0\3}\377\355\31\257\0\0\305\200\377\0;\337\0\0\1"
+    "\200\377\311\0\0J\200\377\0\71\211\0\0;\200\377\0J\263\0\2\324\377"
+    "W\377\0\225\0\200\377\312\0\2\266\377\275\211\0\2\276\377\266\377"
+    "\0\377\0\377\0\377\0\377\0\377\0\377\0\377\0\377\0\377\0\377\0\377"
+    "\0\377\0\377\0\377\0\377\0\377\0\377\0\377\0\377\0\377\0\377\0\231"
+    "\0\10\3`\274\355\374\355\273_\2\207\0\4\31L\177\262\346\201\377"
+    "\207\0\13 _\223\277\336\363\374\364\340\260i\17\206\0\12 `\230\310"
+    "\352\373\363\332\244J\1\215\0\1\16\345\201\377\205\0\212\377\210\0"
+    "\10\27|\305\356\374\360\312\213\63\204\0\215\377\205\0\10\26~\307"
+    "\356\373\356\307}\25\210\0\10<\237\330\362\373\350\267`\4\347\0\10"
+    "\6[\257\344\373\364\324\216\37\207\0\1\24\305\205\377\1\302\22\206"
+    "\0\206\377\207\0\211\377\1\357f\205\0\210\377\1\277\30\214\0\0\225"
+    "\202\377\205\0\212\377\207\0\1_\363\206\377\204\0\214\377\0\350"
+    "\204\0\1F\355\205\377\1\353C\205\0\1\12\245\206\377\1\317\35\345\0"
+    "\1T\342\205\377\1\363P\205\0\1\4\306\207\377\1\302\3\205\0\206\377"
+    "\207\0\213\377\0\214\204\0\211\377\1\325\12\212\0\2\67\375\371\201"
+    "\377\205\0\212\377\206\0\0i\210\377\204\0\214\377\0\206\203\0\1'"
+    "\366\207\377\1\365%\204\0\0\252\210\377\1\331\15\344\0\203\377\200"
+    "\375\201\377\1\370-\204\0\0o\201\377\4\221\42\4#\223\201\377\0k"
+    "\205\0\4\346\263\200M\32\201\377\207\0\5\343\250wK,\22\200\6\2!e"
+    "\337\201\377\0J\203\0\11\334\225[/\21\4\12\63\223\376\200\377\0~"
+    "\211\0\3\4\320\377\210\201\377\205\0\201\377\216\0\1-\372\200\377"
+    "\7\370\204(\5\13,j\307\216\0\4\36\375\377\375!\203\0\0\241\200\377"
+    "\6\363j\31\4\31j\363\200\377\0\237\203\0\0F\201\377\6\276H\22\4\30"
+    "X\325\200\377\0\210\344\0\10\377\372\243J\23\0\3>\325\200\377\0"
+    "\245\203\0\1\3\344\200\377\0\203\203\0\0\207\200\377\1\341\2\211\0"
+    "\201\377\221\0\1\16\316\200\377\0\272\214\0\0v\200\377\0\324\211\0"
+    "\3u\377\345\14\201\377\205\0\201\377\216\0\0\264\200\377\1\366;"
+    "\225\0\0\204\200\377\0\267\204\0\0\345\200\377\0]\203\0\0]\200\377"
+    "\0\344\203\0\0\247\200\377\1\266\2\203\0\4\13\315\377\361\11\343\0"
+    "\1\256 \204\0\0,\200\377\0\346\203\0\0B\200\377\1\347\7\203\0\1\10"
+    "\352\200\377\0>\211\0\201\377\222\0\0@\200\377\0\360\214\0\0\22"
+    "\200\377\0\367\210\0\4\37\365\377[\0\201\377\205\0\201\377\215\0\1"
+    "\37\376\200\377\0p\225\0\1\4\346\200\377\0P\204\0\0\372\200\377\0"
+    "\15\203\0\0\16\200\377\0\372\203\0\0\340\200\377\0\70\205\0\0E\200"
+    "\377\0O\265\0\2\17i\315\223\0\2\315h\16\231\0\0\10\200\377\0\373"
+    "\203\0\0\204\200\377\0\221\205\0\0\224\200\377\0\202\211\0\201\377"
+    "\222\0\0\11\201\377\0\13\213\0\0\20\200\377\0\357\210\0\2\264\377"
+    "\304\200\0\201\377\205\0\201\377\215\0\0l\200\377\1\352\6\225\0\0S"
+    "\200\377\1\345\4\204\0\0\346\200\377\0\13\203\0\0\14\200\377\0\345"
+    "\203\0\0\367\200\377\0\11\205\0\0\13\200\377\0\215\210\0\202\377"
+    "\215\0\202\377\222\0\2;\240\365\200\377\223\0\200\377\2\365\237;"
+    "\227\0\0M\200\377\0\344\203\0\0\265\200\377\0T\205\0\0V\200\377\0"
+    "\263\211\0\201\377\222\0\0\21\201\377\0\35\213\0\0~\200\377\0\261"
+    "\207\0\3U\377\375\61\200\0\201\377\205\0\201\377\215\0\0\246\200"
+    "\377\0\231\226\0\0\272\200\377\0\201\205\0\0\235\200\377\0Y\203\0"
+    "\0[\200\377\0\233\203\0\0\367\200\377\0\11\205\0\0\13\200\377\0"
+    "\272\210\0\202\377\215\0\202\377\217\0\2\24r\326\202\377\0\374\223"
+    "\0\0\375\202\377\2\326r\24\223\0\1\35\342\200\377\0\223\203\0\0"
+    "\327\200\377\0+\205\0\0-\200\377\0\325\211\0\201\377\222\0\0Y\200"
+    "\377\1\371\7\207\0\3\1\21@\244\200\377\1\367\60\206\0\3\16\346\377"
+    "\230\201\0\201\377\205\0\201\377\7\236\335\373\370\340\256^\6\205"
+    "\0\0\317\200\377\0[\225\0\4#\376\377\374\35\205\0\14\35\354\377"
+    "\361h\27\3\30i\363\377\352\33\203\0\0\340\200\377\0\70\205\0\0E"
+    "\200\377\0\332\210\0\202\377\215\0\202\377\214\0\3\1E\251\371\202"
+    "\377\2\327x\32\200\0\217\377\200\0\2\33x\327\202\377\3\371\251E\1"
+    "\217\0\1\34\335\200\377\1\351\26\203\0\0\356\200\377\0\22\205\0\0"
+    "\23\200\377\0\354\211\0\201\377\221\0\1\12\331\200\377\0\260\206\0"
+    "\205\377\1\336=\207\0\3\225\377\356\23\201\0\201\377\205\0\210\377"
+    "\1\336;\204\0\0\353\200\377\10\60\0X\303\365\366\340\251K\215\0\0"
+    "\212\200\377\0\263\207\0\1+\316\205\377\1\316)\204\0\0\250\200\377"
+    "\1\264\1\203\0\1\12\314\200\377\0\356\210\0\202\377\215\0\202\377"
+    "\212\0\2\33|\337\202\377\2\356\227\67\203\0\217\377\203\0\2\67\227"
+    "\356\202\377\2\336|\33\214\0\1\30\333\200\377\1\367<\204\0\0\373"
+    "\200\377\5\4\0l\353\350g\200\0\0\6\200\377\0\371\211\0\201\377\220"
+    "\0\1\1\246\200\377\1\375\63\206\0\204\377\1\245\17\207\0\3\67\375"
+    "\377l\202\0\201\377\205\0\211\377\1\370C\203\0\0\372\200\377\1\26"
+    "\233\205\377\1\263\15\212\0\1\6\352\200\377\0K\210\0\1\35\256\203"
+    "\377\1\256\35\205\0\0J\201\377\7\273F\21\3\27W\325\354\200\377\0"
+    "\372\210\0\202\377\215\0\202\377\207\0\3\4O\263\374\201\377\3\374"
+    "\266V\7\205\0\217\377\205\0\3\7V\266\374\201\377\3\374\263N\3\210"
+    "\0\1\3\306\200\377\1\370J\205\0\201\377\200\0\0\366\200\377\0\364"
+    "\200\0\0\1\200\377\0\376\211\0\201\377\220\0\0\215\201\377\0\206"
+    "\207\0\205\377\1\355l\205\0\4\4\320\377\321\3\202\0\201\377\205\0"
+    "\11\321}A\32\10\6\32M\251\376\200\377\1\352\20\202\0\201\377\0r"
+    "\207\377\0\261\212\0\0Y\200\377\1\341\2\206\0\2\6\217\373\205\377"
+    "\2\373\220\6\204\0\0\264\207\377\0t\200\377\0\376\247\0\1\206\346"
+    "\202\377\2\324u\30\243\0\2\31u\324\202\377\1\346\206\207\0\0e\200"
+    "\377\1\374M\206\0\0\373\200\377\5\4\0u\355\352l\200\0\0\6\200\377"
+    "\0\372\211\0\201\377\216\0\1\1\220\201\377\1\270\3\211\0\4\2\21;"
+    "\215\365\200\377\0\223\204\0\0u\200\377\0\77\203\0\201\377\216\0\1"
+    "I\367\200\377\0w\202\0\0\373\200\377\7\354\325Y\30\4\22H\300\201"
+    "\377\0H\211\0\0\300\200\377\0|\206\0\1\1\257\200\377\6\314P\25\4"
+    "\26S\317\200\377\1\261\1\203\0\1\16\265\205\377\1\235\27\200\377\0"
+    "\370\247\0\201\377\2\355\224\64\251\0\2\65\224\355\201\377\207\0\0"
+    "\300\200\377\0\204\207\0\0\356\200\377\0\21\205\0\0\23\200\377\0"
+    "\354\211\0\201\377\215\0\1\5\243\201\377\1\277\12\216\0\1'\344\200"
+    "\377\0L\202\0\3\37\365\377\251\204\0\201\377\217\0\0{\200\377\0"
+    "\306\202\0\0\360\200\377\1\314\12\203\0\1\2\271\200\377\0\247\210"
+    "\0\0(\200\377\1\373\31\206\0\0Z\200\377\1\303\6\203\0\1\7\306\200"
+    "\377\0[\204\0\11\1M\252\341\367\366\304Y\0\61\200\377\0\351\247\0"
+    "\201\377\2\347\214-\251\0\2-\214\347\201\377\207\0\0\355\200\377\0"
+    "\35\207\0\0\327\200\377\0+\205\0\0-\200\377\0\325\211\0\201\377"
+    "\214\0\1\14\270\201\377\1\261\11\220\0\0S\200\377\0\271\202\0\3"
+    "\264\377\365\35\204\0\201\377\217\0\0 \200\377\0\357\202\0\0\333"
+    "\200\377\0D\205\0\0:\200\377\0\337\210\0\0\220\200\377\0\256\207\0"
+    "\0\273\200\377\0\77\205\0\0A\200\377\0\274\215\0\0\134\200\377\0"
+    "\316\247\0\1\206\346\202\377\2\316o\25\243\0\2\26p\317\202\377\1"
+    "\346\206\207\0\0\376\200\377\0\2\207\0\0\265\200\377\0T\205\0\0U"
+    "\200\377\0\263\211\0\201\377\213\0\1\27\315\201\377\1\222\3\221\0"
+    "\0\15\200\377\0\356\202\0\216\377\214\0\0\6\200\377\0\375\202\0\0"
+    "\274\200\377\0\13\205\0\0\11\200\377\0\366\207\0\1\10\356\200\377"
+    "\0F\207\0\0\356\200\377\0\11\205\0\0\12\200\377\0\355\215\0\0\232"
+    "\200\377\0\245\250\0\3\4P\264\374\201\377\3\373\262S\6\205\0\217"
+    "\377\205\0\3\7S\262\373\201\377\3\374\264O\4\210\0\201\377\210\0\0"
+    "\204\200\377\0\220\205\0\0\223\200\377\0\202\211\0\201\377\212\0\1"
+    "&\336\200\377\1\370c\223\0\0\16\200\377\0\374\202\0\216\377\214\0"
+    "\0\36\200\377\0\357\202\0\0\217\200\377\0\13\205\0\0\11\200\377\0"
+    "\366\207\0\0_\200\377\1\335\1\207\0\0\373\200\377\0\13\205\0\0\13"
+    "\200\377\0\374\214\0\1\7\352\200\377\0l\253\0\2\33}\337\202\377\2"
+    "\355\225\67\203\0\217\377\203\0\2\67\226\356\202\377\2\337}\33\213"
+    "\0\201\377\210\0\0B\200\377\1\346\6\203\0\1\7\351\200\377\0\77\211"
+    "\0\201\377\211\0\1:\354\200\377\1\336\63\224\0\0Q\200\377\0\346"
+    "\202\0\216\377\214\0\0t\200\377\0\304\202\0\0Q\200\377\0D\205\0\0:"
+    "\200\377\0\336\207\0\0\306\200\377\0x\210\0\0\351\200\377\0B\205\0"
+    "\0@\200\377\0\354\214\0\0p\200\377\1\376\37\255\0\3\1F\252\371\202"
+    "\377\2\330y\35\200\0\217\377\200\0\2\35y\330\202\377\3\371\252F\1"
+    "\232\0\1\3\345\200\377\0\201\203\0\0\205\200\377\1\342\2\211\0\201"
+    "\377\210\0\1R\367\200\377\1\255\20\224\0\1\34\335\200\377\0\252"
+    "\214\0\201\377\216\0\1;\362\200\377\0s\202\0\4\12\363\377\314\12"
+    "\203\0\1\2\267\200\377\0\244\206\0\0.\200\377\1\372\26\210\0\0\265"
+    "\200\377\1\307\7\203\0\1\5\302\200\377\0\270\213\0\1:\365\200\377"
+    "\0\264\211\0\202\377\215\0\202\377\217\0\2\24s\327\202\377\0\375"
+    "\223\0\0\375\202\377\2\326s\24\236\0\0q\201\377\4\217!\3\42\221"
+    "\201\377\0m\212\0\201\377\207\0\4p\375\377\367j\214\0\12\335\232e"
+    "\70\32\11\2\16\65\200\356\201\377\0>\214\0\201\377\204\0\12\333"
+    "\224]\62\25\7\4\25D\233\373\200\377\1\345\15\203\0\0\213\200\377\6"
+    "\325X\27\3\21F\275\201\377\0B\206\0\0\226\200\377\0\251\211\0\0U"
+    "\201\377\6\316R\24\3\24O\312\201\377\0W\204\0\7\307g)\11\4'\203"
+    "\367\200\377\1\372.\211\0\202\377\215\0\202\377\222\0\2<\241\365"
+    "\200\377\223\0\200\377\2\365\240<\223\0\201\377\211\0\1\5\311\207"
+    "\377\1\305\4\205\0\213\377\202\0\215\377\0(\201\0\213\377\0\211"
+    "\215\0\201\377\204\0\212\377\1\363\71\204\0\1\16\333\210\377\0\246"
+    "\206\0\1\13\361\200\377\0B\212\0\0\262\211\377\1\263\1\204\0\210"
+    "\377\0l\212\0\202\377\215\0\202\377\224\0\2\17j\316\223\0\2\316i"
+    "\17\225\0\201\377\212\0\1\25\310\205\377\1\305\23\206\0\213\377"
+    "\202\0\215\377\0(\201\0\211\377\1\362k\216\0\201\377\204\0\211\377"
+    "\1\317/\206\0\1 \322\206\377\1\243\11\206\0\0e\200\377\0\331\213\0"
+    "\1\11\241\207\377\1\235\11\205\0\206\377\1\364a\213\0\202\377\214"
+    "\0\0\37\201\377\0\301\306\0\201\377\213\0\10\3b\276\356\375\356"
+    "\275`\3\207\0\213\377\202\0\215\377\0(\201\0\13!b\227\303\341\364"
+    "\375\364\340\262m\22\217\0\201\377\204\0\13*v\255\323\355\371\375"
+    "\363\325\237L\1\210\0\10\5c\271\351\374\364\331\237<\210\0\0\314"
+    "\200\377\0s\215\0\10\65\226\321\360\374\360\321\225\63\207\0\10\64"
+    "\217\316\362\375\357\306~\27\214\0\202\377\214\0\0v\200\377\1\362!"
+    "\306\0\201\377\377\0\335\0\0\316\200\377\0d\377\0\377\0\247\0\0%"
+    "\200\377\0\265\377\0\377\0\250\0\3}\377\355\31\377\0\377\0\250\0\2"
+    "\324\377W\377\0\377\0\377\0\377\0\377\0\377\0\377\0\377\0\377\0"
+    "\377\0\377\0\377\0\377\0\377\0\377\0\377\0\377\0\377\0\377\0\377\0"
+    "\377\0\377\0\377\0\377\0\266\0\1\23\374\200\377\1\374\22\207\0\205"
+    "\377\4\364\337\257_\10\211\0\10+\212\311\355\374\363\310w\21\203\0"
+    "\203\377\4\367\343\276\203/\210\0\214\377\203\0\214\377\207\0\10"
+    "\64\222\317\361\374\357\301p\17\203\0\201\377\207\0\201\377\203\0"
+    "\213\377\207\0\207\377\204\0\201\377\206\0\1\1\235\200\377\1\352)"
+    "\201\0\201\377\214\0\202\377\0\204\205\0\0\205\202\377\201\0\202"
+    "\377\0.\205\0\201\377\206\0\7G\250\340\372\371\337\246E\212\0\10"
+    "\37s\276\336\366\362\325\226,\210\0\0^\202\377\0]\207\0\211\377\1"
+    "\333\61\206\0\2\16\241\376\205\377\1\356^\202\0\210\377\1\267!\206"
+    "\0\214\377\203\0\214\377\205\0\1\24\254\206\377\1\355\134\202\0"
+    "\201\377\207\0\201\377\203\0\213\377\207\0\207\377\204\0\201\377"
+    "\206\0\0\225\200\377\1\355.\202\0\201\377\214\0\202\377\0\334\205"
+    "\0\0\336\202\377\201\0\202\377\0\232\205\0\201\377\204\0\1\14\260"
+    "\206\377\1\256\12\206\0\2\13\214\373\205\377\2\376\210\2\206\0\0"
+    "\255\202\377\0\254\207\0\212\377\1\355\32\204\0\1\24\323\211\377"
+    "\202\0\211\377\1\356\65\205\0\214\377\203\0\214\377\204\0\1\32\333"
+    "\211\377\202\0\201\377\207\0\201\377\203\0\213\377\207\0\207\377"
+    "\204\0\201\377\205\0\0\214\200\377\1\360\64\203\0\201\377\214\0"
+    "\201\377\2\371\377\67\203\0\2:\377\371\201\377\201\0\202\377\1\365"
+    "\21\204\0\201\377\203\0\1\2\273\210\377\1\267\2\204\0\12\26\324"
+    "\377\375\251R\42\10\16>\242\200\377\0\214\205\0\1\10\364\202\377\1"
+    "\363\7\206\0\201\377\202\0\3\11'r\361\200\377\0\225\203\0\1\3\303"
+    "\200\377\11\375\237A\21\3\22C\227\366\377\202\0\201\377\200\0\4\11"
+    "!O\236\371\200\377\1\347\25\204\0\201\377\216\0\201\377\216\0\1\5"
+    "\313\200\377\11\373\227;\16\4\27G\221\362\377\202\0\201\377\207\0"
+    "\201\377\210\0\201\377\222\0\201\377\204\0\201\377\204\0\0\203\200"
+    "\377\1\363:\204\0\201\377\214\0\201\377\2\262\377\220\203\0\2\224"
+    "\377\261\201\377\201\0\203\377\0s\204\0\201\377\203\0\0j\201\377\5"
+    "\250\70\14\16:\251\201\377\0e\203\0\4\21\325\377\330\66\205\0\3Z"
+    "\376\377\63\204\0\0K\200\377\1\330\331\200\377\0J\206\0\201\377"
+    "\205\0\0Q\200\377\0\336\203\0\0m\200\377\1\365C\205\0\1\26\252\202"
+    "\0\201\377\204\0\1)\337\200\377\0\232\204\0\201\377\216\0\201\377"
+    "\216\0\0t\200\377\1\362;\205\0\1\24\244\202\0\201\377\207\0\201"
+    "\377\210\0\201\377\222\0\201\377\204\0\201\377\203\0\0z\200\377\1"
+    "\366\77\205\0\201\377\214\0\201\377\3Y\377\346\2\201\0\3\4\351\377"
+    "X\201\377\201\0\201\377\3\320\377\335\2\203\0\201\377\202\0\1\2"
+    "\342\200\377\0\213\204\0\0\213\200\377\1\337\1\202\0\3\237\377\331"
+    "\27\207\0\2\227\377\236\204\0\0\232\200\377\1\211\212\200\377\0"
+    "\231\206\0\201\377\205\0\0\11\200\377\0\371\202\0\1\5\346\200\377"
+    "\0`\214\0\201\377\205\0\4\62\375\377\371\23\203\0\201\377\216\0"
+    "\201\377\215\0\1\7\351\200\377\0Z\214\0\201\377\207\0\201\377\210"
+    "\0\201\377\222\0\201\377\204\0\201\377\202\0\0p\200\377\1\370F\206"
+    "\0\201\377\214\0\201\377\3\13\364\377C\201\0\3H\377\365\13\201\377"
+    "\201\0\201\377\0d\200\377\0L\203\0\201\377\202\0\0@\200\377\1\343"
+    "\5\204\0\1\6\343\200\377\0=\201\0\3A\377\370'\210\0\2\63\377\334"
+    "\203\0\1\1\347\200\377\1:;\200\377\1\346\1\205\0\201\377\205\0\0"
+    "\22\200\377\0\360\202\0\0J\200\377\1\326\1\214\0\201\377\206\0\0"
+    "\265\200\377\0b\203\0\201\377\216\0\201\377\215\0\0N\200\377\0\323"
+    "\215\0\201\377\207\0\201\377\210\0\201\377\222\0\201\377\204\0\201"
+    "\377\201\0\0h\200\377\1\372L\207\0\201\377\214\0\201\377\3\0\246"
+    "\377\234\201\0\3\242\377\247\0\201\377\201\0\201\377\3\11\356\377"
+    "\271\203\0\201\377\202\0\0\203\200\377\0\213\206\0\0\214\200\377\0"
+    "\201\201\0\2\264\377\202\202\0\11\3k\311\363\362\310h\15\377\365"
+    "\203\0\0\70\200\377\0\351\200\2\0\351\200\377\0\67\205\0\201\377"
+    "\205\0\0i\200\377\0\274\202\0\0\221\200\377\0}\215\0\201\377\206\0"
+    "\0g\200\377\0\237\203\0\201\377\216\0\201\377\215\0\0\223\200\377"
+    "\0{\215\0\201\377\207\0\201\377\210\0\201\377\222\0\201\377\204\0"
+    "\201\377\200\0\4_\376\377\374S\210\0\201\377\214\0\201\377\12\0M"
+    "\377\357\6\0\11\362\377N\0\201\377\201\0\201\377\4\0\213\377\376&"
+    "\202\0\201\377\202\0\0\265\200\377\0P\206\0\0Q\200\377\0\263\200\0"
+    "\3\35\374\371\24\201\0\1\16\301\204\377\0\263\200\377\203\0\0\207"
+    "\200\377\0\235\200\0\0\235\200\377\0\206\205\0\201\377\202\0\3\12,"
+    "\201\371\200\377\0K\202\0\0\303\200\377\0A\215\0\201\377\206\0\0"
+    "\66\200\377\0\313\203\0\201\377\216\0\201\377\215\0\0\305\200\377"
+    "\0@\215\0\201\377\207\0\201\377\210\0\201\377\222\0\201\377\204\0"
+    "\201\377\5\0W\374\377\375Z\211\0\201\377\214\0\201\377\12\0\6\356"
+    "\377O\0V\377\357\6\0\201\377\201\0\201\377\4\0!\375\377\222\202\0"
+    "\201\377\202\0\0\327\200\377\0(\206\0\0*\200\377\0\326\200\0\2e"
+    "\377\256\202\0\7\256\377\336Q\15\14O\335\201\377\203\0\0\326\200"
+    "\377\0N\200\0\0O\200\377\0\325\205\0\211\377\1\364h\203\0\0\345"
+    "\200\377\0\33\215\0\201\377\206\0\0\27\200\377\0\347\203\0\213\377"
+    "\204\0\213\377\203\0\0\346\200\377\0\33\215\0\215\377\210\0\201"
+    "\377\222\0\201\377\204\0\201\377\1P\373\200\377\0\257\212\0\201"
+    "\377\214\0\201\377\200\0\6\233\377\250\0\260\377\234\200\0\201\377"
+    "\201\0\201\377\200\0\3\262\377\361\14\201\0\201\377\202\0\0\356"
+    "\200\377\0\20\206\0\0\22\200\377\0\354\200\0\2\233\377o\201\0\3C"
+    "\377\353\32\202\0\1\32\354\200\377\202\0\0%\200\377\1\365\11\200\0"
+    "\1\12\366\200\377\0$\204\0\210\377\1\317>\204\0\0\370\200\377\0\7"
+    "\215\0\201\377\206\0\0\7\200\377\0\370\203\0\213\377\204\0\213\377"
+    "\203\0\0\370\200\377\0\7\204\0\204\377\201\0\215\377\210\0\201\377"
+    "\222\0\201\377\204\0\201\377\0\371\201\377\1\376@\211\0\201\377"
+    "\214\0\201\377\200\0\6B\377\365\34\371\377C\200\0\201\377\201\0"
+    "\201\377\200\0\0E\200\377\0k\201\0\201\377\202\0\0\373\200\377\0\4"
+    "\206\0\0\5\200\377\0\372\200\0\2\314\377;\201\0\2\244\377t\204\0\0"
+    "t\200\377\202\0\0t\200\377\0\260\202\0\0\261\200\377\0s\204\0\212"
+    "\377\1\250\13\202\0\0\376\200\377\0\1\215\0\201\377\206\0\0\1\200"
+    "\377\0\376\203\0\213\377\204\0\213\377\203\0\0\376\200\377\0\1\204"
+    "\0\204\377\201\0\215\377\210\0\201\377\222\0\201\377\204\0\202\377"
+    "\1\376\331\200\377\1\337\15\210\0\201\377\214\0\201\377\200\0\6\2"
+    "\346\377\275\377\347\3\200\0\201\377\201\0\201\377\200\0\3\1\330"
+    "\377\327\201\0\201\377\202\0\201\377\207\0\0\1\200\377\0\376\200\0"
+    "\2\341\377\34\201\0\2\336\377'\204\0\0(\200\377\202\0\0\303\200"
+    "\377\0a\202\0\0b\200\377\0\302\204\0\201\377\202\0\3\12&d\330\200"
+    "\377\1\267\1\201\0\0\370\200\377\0\7\215\0\201\377\206\0\0\6\200"
+    "\377\0\370\203\0\201\377\216\0\201\377\215\0\0\370\200\377\0\6\204"
+    "\0\204\377\201\0\201\377\207\0\201\377\210\0\201\377\222\0\201\377"
+    "\204\0\202\377\2o\32\355\200\377\0\236\210\0\201\377\214\0\201\377"
+    "\201\0\0\217\201\377\0\221\201\0\201\377\201\0\201\377\201\0\0l"
+    "\200\377\0D\200\0\201\377\202\0\0\373\200\377\0\4\206\0\0\5\200"
+    "\377\0\372\200\0\2\362\377\15\201\0\2\367\377\7\204\0\0\10\200\377"
+    "\201\0\4\25\375\377\375\25\202\0\4\26\375\377\374\24\203\0\201\377"
+    "\205\0\1\12\312\200\377\0X\201\0\0\346\200\377\0\33\215\0\201\377"
+    "\206\0\0\27\200\377\0\350\203\0\201\377\216\0\201\377\215\0\0\346"
+    "\200\377\0\31\207\0\201\377\201\0\201\377\207\0\201\377\210\0\201"
+    "\377\222\0\201\377\204\0\201\377\0|\200\0\0X\201\377\0N\207\0\201"
+    "\377\214\0\201\377\201\0\0\66\201\377\0\70\201\0\201\377\201\0\201"
+    "\377\201\0\3\15\362\377\261\200\0\201\377\202\0\0\357\200\377\0\20"
+    "\206\0\0\22\200\377\0\354\200\0\2\373\377\3\201\0\2\367\377\7\204"
+    "\0\0\11\200\377\201\0\0a\212\377\0`\203\0\201\377\206\0\0F\200\377"
+    "\0\270\201\0\0\306\200\377\0@\215\0\201\377\206\0\0\65\200\377\0"
+    "\314\203\0\201\377\216\0\201\377\215\0\0\306\200\377\0=\207\0\201"
+    "\377\201\0\201\377\207\0\201\377\210\0\201\377\221\0\0\1\200\377\0"
+    "\376\204\0\201\377\202\0\0\250\200\377\1\350\24\206\0\201\377\214"
+    "\0\201\377\202\0\2\334\377\337\202\0\201\377\201\0\201\377\202\0\4"
+    "\223\377\375 \0\201\377\202\0\0\330\200\377\0(\206\0\0*\200\377\0"
+    "\326\200\0\2\355\377\21\201\0\2\336\377(\204\0\0)\200\377\201\0\0"
+    "\260\212\377\0\257\203\0\201\377\206\0\0\16\200\377\0\352\201\0\0"
+    "\224\200\377\0|\215\0\201\377\206\0\0f\200\377\0\241\203\0\201\377"
+    "\216\0\201\377\215\0\0\225\200\377\0w\207\0\201\377\201\0\201\377"
+    "\207\0\201\377\210\0\201\377\221\0\0\10\200\377\0\367\204\0\201"
+    "\377\202\0\1\22\345\200\377\0\254\206\0\201\377\214\0\201\377\211"
+    "\0\201\377\201\0\201\377\202\0\4'\376\377\212\0\201\377\202\0\0"
+    "\266\200\377\0O\206\0\0P\200\377\0\263\200\0\2\333\377#\201\0\2"
+    "\244\377t\204\0\0u\200\377\200\0\1\11\365\212\377\1\365\11\202\0"
+    "\201\377\206\0\0\7\200\377\0\373\201\0\0N\200\377\1\325\1\214\0"
+    "\201\377\206\0\0\264\200\377\0d\203\0\201\377\216\0\201\377\215\0"
+    "\0P\200\377\0\315\207\0\201\377\201\0\201\377\207\0\201\377\210\0"
+    "\201\377\221\0\0 \200\377\0\345\204\0\201\377\203\0\0H\201\377\0]"
+    "\205\0\201\377\214\0\201\377\211\0\201\377\201\0\201\377\203\0\3"
+    "\272\377\355\11\201\377\202\0\0\204\200\377\0\212\206\0\0\213\200"
+    "\377\0\201\200\0\2\300\377K\201\0\3C\377\353\32\202\0\1\32\353\200"
+    "\377\200\0\0N\200\377\0\324\206\0\0\325\200\377\0M\202\0\201\377"
+    "\206\0\0\61\200\377\0\357\201\0\1\7\352\200\377\0^\214\0\201\377"
+    "\205\0\4\60\375\377\372\25\203\0\201\377\216\0\201\377\215\0\1\10"
+    "\354\200\377\0Q\206\0\201\377\201\0\201\377\207\0\201\377\210\0"
+    "\201\377\210\0\0\202\206\0\0Q\200\377\0\304\204\0\201\377\204\0\0"
+    "\230\200\377\1\357\34\204\0\201\377\214\0\201\377\211\0\201\377"
+    "\201\0\201\377\203\0\0M\200\377\0c\201\377\202\0\0B\200\377\1\341"
+    "\5\204\0\1\5\342\200\377\0=\200\0\2\210\377\204\202\0\3\257\377"
+    "\335P\200\14\1N\335\201\377\200\0\0\235\200\377\0\205\206\0\0\206"
+    "\200\377\0\234\202\0\201\377\205\0\1\1\253\200\377\0\300\202\0\0u"
+    "\200\377\1\364@\205\0\1\25\251\202\0\201\377\204\0\1'\335\200\377"
+    "\0\235\204\0\201\377\216\0\201\377\216\0\0y\200\377\1\356\66\205\0"
+    "\201\377\201\0\201\377\207\0\201\377\210\0\201\377\210\0\2\377\245"
+    "\17\204\0\0\264\200\377\0\217\204\0\201\377\204\0\1\13\334\200\377"
+    "\1\273\1\203\0\201\377\214\0\201\377\211\0\201\377\201\0\201\377"
+    "\203\0\3\2\336\377\320\201\377\202\0\1\3\345\200\377\0\210\204\0\0"
+    "\211\200\377\1\340\2\200\0\2K\377\317\202\0\1\16\302\204\377\0\267"
+    "\200\377\2\0\2\351\200\377\0\67\206\0\0\67\200\377\1\351\2\201\0"
+    "\201\377\202\0\3\7\37S\275\201\377\0d\202\0\1\5\313\200\377\11\374"
+    "\235\77\20\2\21A\225\365\377\202\0\201\377\200\0\4\10\37M\235\370"
+    "\200\377\1\351\27\204\0\201\377\216\0\201\377\216\0\1\7\320\200"
+    "\377\7\372\226<\17\2\21C\255\201\377\201\0\201\377\207\0\201\377"
+    "\210\0\201\377\210\0\200\377\2\353\200\60\200\10\1\60\245\201\377"
+    "\0\77\204\0\201\377\205\0\1;\375\200\377\0l\203\0\201\377\214\0"
+    "\201\377\211\0\201\377\201\0\201\377\204\0\0t\203\377\203\0\0o\201"
+    "\377\5\246\67\13\14\70\247\201\377\0g\201\0\3\11\353\377;\202\0\2"
+    "\4k\312\200\364\2\314o\5\200\377\1\0;\200\377\1\346\1\206\0\1\1"
+    "\347\200\377\0:\201\0\213\377\1\301\3\203\0\1\32\332\211\377\202\0"
+    "\211\377\1\357\67\205\0\214\377\203\0\201\377\217\0\1\36\337\211"
+    "\377\0\256\201\0\201\377\207\0\201\377\203\0\213\377\203\0\211\377"
+    "\0\277\205\0\201\377\206\0\0\210\200\377\1\365&\202\0\214\377\201"
+    "\0\201\377\211\0\201\377\201\0\201\377\204\0\1\21\366\202\377\203"
+    "\0\1\3\300\210\377\1\272\2\202\0\3\202\377\276\1\214\0\0\212\200"
+    "\377\0\231\210\0\0\232\200\377\0\211\201\0\212\377\1\247\15\205\0"
+    "\1\22\250\206\377\1\356^\202\0\210\377\1\273#\206\0\214\377\203\0"
+    "\201\377\220\0\1\26\260\206\377\2\371~\2\201\0\201\377\207\0\201"
+    "\377\203\0\213\377\203\0\1M\330\206\377\1\321\31\205\0\201\377\206"
+    "\0\1\6\321\200\377\1\310\3\201\0\214\377\201\0\201\377\211\0\201"
+    "\377\201\0\201\377\205\0\0\233\202\377\204\0\1\16\266\206\377\1"
+    "\261\14\203\0\3\25\352\377q\214\0\0\331\200\377\0K\210\0\0K\200"
+    "\377\0\330\201\0\205\377\4\373\350\305\212\60\211\0\10/\215\313"
+    "\357\375\363\310x\21\203\0\203\377\4\370\345\300\206\61\210\0\214"
+    "\377\203\0\201\377\222\0\10\66\223\317\361\375\362\312\202\34\203"
+    "\0\201\377\207\0\201\377\203\0\213\377\204\0\11\2O\241\334\366\373"
+    "\346\267d\5\206\0\201\377\207\0\1.\371\200\377\0|\201\0\214\377"
+    "\201\0\201\377\211\0\201\377\201\0\201\377\205\0\0.\202\377\206\0"
+    "\2K\253\342\200\372\2\341\250H\206\0\3K\377\374`\377\0\377\0\251\0"
+    "\4z\377\376\216\17\377\0\377\0\250\0\13d\373\377\352\222E\37\10\14"
+    ":\221\204\377\0\377\0\241\0\1*\263\206\377\0\336\377\0\377\0\243\0"
+    "\11)u\273\332\360\374\352\300\200\6\377\0\377\0\377\0\377\0\377\0"
+    "\377\0\377\0\377\0\377\0\377\0\377\0\377\0\377\0\377\0\377\0\377\0"
+    "\377\0\377\0\377\0\377\0\377\0\377\0\336\0\205\377\233\0\205\377"
+    "\256\0\205\377\4\367\347\277\202!\210\0\7C\240\333\364\363\332\237"
+    "C\205\0\204\377\4\374\356\320\232>\211\0\3\24u\272\346\200\370\4"
+    "\350\310\232d!\202\0\217\377\201\0\201\377\207\0\201\377\201\0\0"
+    "\333\200\377\0D\207\0\0E\200\377\2\333\0\355\200\377\0\33\211\0\0"
+    "\33\200\377\0\354\200\0\0\261\200\377\1\322\4\205\0\1\10\331\200"
+    "\377\2\255\0\271\200\377\0\262\207\0\0\263\200\377\0\271\201\0\216"
+    "\377\206\0\205\377\205\0\0\305\200\377\0;\220\0\205\377\214\0\4G"
+    "\375\377\375G\233\0\211\377\2\374\206\3\204\0\1\11\250\206\377\1"
+    "\251\11\203\0\211\377\1\264\22\206\0\1g\364\210\377\202\0\217\377"
+    "\201\0\201\377\207\0\201\377\201\0\0\222\200\377\0\216\207\0\0\217"
+    "\200\377\2\221\0\307\200\377\0A\211\0\0B\200\377\0\306\200\0\1\36"
+    "\364\200\377\0u\205\0\0\207\200\377\4\357\31\0.\375\200\377\0@\205"
+    "\0\0A\200\377\1\375.\201\0\216\377\206\0\205\377\205\0\0O\200\377"
+    "\0\261\220\0\205\377\213\0\1\42\356\201\377\1\355!\232\0\213\377\0"
+    "\235\203\0\1\2\262\210\377\1\263\2\202\0\212\377\1\310\4\204\0\0"
+    "\202\212\377\202\0\217\377\201\0\201\377\207\0\201\377\201\0\0H"
+    "\200\377\0\330\207\0\0\331\200\377\2G\0\241\200\377\0g\211\0\0h"
+    "\200\377\0\240\201\0\0s\200\377\1\364\36\203\0\1/\373\200\377\0e"
+    "\201\0\0\237\200\377\1\314\1\203\0\1\1\315\200\377\0\236\202\0\215"
+    "\377\0\331\206\0\201\377\211\0\4\1\327\377\376(\223\0\201\377\212"
+    "\0\1\12\320\200\377\0\337\200\377\1\320\12\231\0\201\377\202\0\3"
+    "\10%k\343\201\377\0B\202\0\0`\201\377\5\250\70\14\16:\251\201\377"
+    "\0`\202\0\201\377\201\0\3\3\25J\271\201\377\0g\203\0\1:\376\200"
+    "\377\11\323`!\7\5\22\60Z\222\332\211\0\201\377\210\0\201\377\207\0"
+    "\201\377\201\0\1\10\365\200\377\0!\205\0\0#\200\377\3\365\7\0z\200"
+    "\377\0\216\211\0\0\216\200\377\0y\201\0\1\4\321\200\377\0\261\202"
+    "\0\1\3\314\200\377\1\277\1\201\0\1\33\366\200\377\0[\203\0\0\134"
+    "\200\377\1\365\32\215\0\0j\200\377\1\375\71\206\0\201\377\212\0\0c"
+    "\200\377\0\235\223\0\201\377\212\0\0\244\200\377\2\262\7\263\200"
+    "\377\0\244\231\0\201\377\205\0\1\22\325\200\377\0\247\201\0\1\1"
+    "\337\200\377\0\213\204\0\0\213\200\377\1\340\1\201\0\201\377\204\0"
+    "\1\1\244\200\377\0\277\203\0\0\251\200\377\1\266\6\222\0\201\377"
+    "\210\0\201\377\207\0\201\377\202\0\0\264\200\377\0l\205\0\0m\200"
+    "\377\0\263\200\0\0T\200\377\0\264\211\0\0\264\200\377\0S\202\0\1"
+    "\70\376\200\377\0P\201\0\0t\200\377\1\367$\203\0\0\204\200\377\1"
+    "\340\10\201\0\1\10\341\200\377\0\203\215\0\1\42\364\200\377\0\211"
+    "\207\0\201\377\212\0\4\6\346\377\371\31\222\0\201\377\211\0\0p\200"
+    "\377\4\307\12\0\12\307\200\377\0o\230\0\201\377\206\0\0I\200\377\0"
+    "\340\201\0\0\67\200\377\1\347\6\204\0\1\7\350\200\377\0\70\201\0"
+    "\201\377\205\0\0&\200\377\0\354\203\0\0\347\200\377\0)\223\0\201"
+    "\377\210\0\201\377\207\0\201\377\202\0\0j\200\377\0\265\205\0\0"
+    "\266\200\377\0i\200\0\0.\200\377\0\332\211\0\0\333\200\377\0-\203"
+    "\0\0\227\200\377\4\342\13\0\42\365\200\377\0x\204\0\1\15\351\200"
+    "\377\0w\201\0\0x\200\377\1\350\14\214\0\1\2\302\200\377\1\325\7"
+    "\207\0\201\377\213\0\0w\200\377\0\211\222\0\201\377\210\0\4\77\373"
+    "\377\327\23\201\0\4\23\330\377\373>\227\0\201\377\206\0\0\14\200"
+    "\377\0\372\201\0\0\200\200\377\0\217\206\0\0\220\200\377\0\202\201"
+    "\0\201\377\205\0\0\6\200\377\0\372\203\0\0\374\200\377\0\5\223\0"
+    "\201\377\210\0\201\377\207\0\201\377\202\0\0 \200\377\1\366\10\203"
+    "\0\1\11\366\200\377\0\37\200\0\4\11\376\377\373\5\200\0\0\77\201"
+    "\377\0:\200\0\4\5\373\377\376\10\203\0\1\20\350\200\377\2\214\0"
+    "\274\200\377\1\317\4\205\0\0i\200\377\4\360\24\0\24\361\200\377\0h"
+    "\215\0\0q\200\377\1\374\64\210\0\201\377\213\0\4\17\361\377\360\16"
+    "\221\0\201\377\207\0\4\34\351\377\346\37\203\0\4 \346\377\351\33"
+    "\226\0\201\377\206\0\0\14\200\377\0\371\201\0\0\255\200\377\0R\206"
+    "\0\0R\200\377\0\255\201\0\201\377\205\0\0!\200\377\0\344\203\0\0"
+    "\356\200\377\0\63\223\0\201\377\210\0\201\377\207\0\201\377\203\0"
+    "\0\326\200\377\0I\203\0\0J\200\377\0\325\202\0\0\341\200\377\0'"
+    "\200\0\0t\201\377\0o\200\0\0'\200\377\0\340\205\0\0Z\200\377\1\373"
+    "\214\200\377\1\374\63\206\0\1\4\327\200\377\2\222\0\223\200\377\1"
+    "\327\4\214\0\1&\366\200\377\0\205\211\0\201\377\214\0\0\212\200"
+    "\377\0v\221\0\201\377\206\0\4\7\311\377\361/\205\0\4/\361\377\310"
+    "\6\225\0\201\377\206\0\0J\200\377\0\340\201\0\0\325\200\377\0-\206"
+    "\0\0.\200\377\0\325\201\0\201\377\205\0\0\221\200\377\0\242\203\0"
+    "\0\270\200\377\1\315\36\222\0\201\377\210\0\201\377\207\0\201\377"
+    "\203\0\0\214\200\377\0\223\203\0\0\224\200\377\0\213\202\0\0\273"
+    "\200\377\0M\200\0\0\251\201\377\0\244\200\0\0M\200\377\0\272\206\0"
+    "\0\273\203\377\0\213\210\0\0N\200\377\2\372K\372\200\377\0M\214\0"
+    "\1\3\307\200\377\1\322\6\211\0\201\377\214\0\4\32\371\377\345\6"
+    "\220\0\201\377\206\0\3\233\377\371A\207\0\3A\371\377\232\225\0\201"
+    "\377\205\0\1\22\325\200\377\0\247\201\0\0\351\200\377\0\22\206\0\0"
+    "\23\200\377\0\351\201\0\201\377\201\0\3\1\17=\244\200\377\1\367*"
+    "\203\0\0I\201\377\3\371\251\134\34\217\0\201\377\210\0\201\377\207"
+    "\0\201\377\203\0\0B\200\377\0\334\203\0\0\335\200\377\0A\202\0\0"
+    "\225\200\377\0t\200\0\4\336\377\317\377\331\200\0\0t\200\377\0\224"
+    "\206\0\1$\367\201\377\1\335\11\211\0\0\300\200\377\0\373\200\377\0"
+    "\277\215\0\0w\200\377\1\372\61\212\0\201\377\215\0\0\236\200\377\0"
+    "b\220\0\201\377\256\0\201\377\202\0\3\7$k\343\201\377\0D\201\0\0"
+    "\365\200\377\0\10\206\0\0\11\200\377\0\364\201\0\211\377\1\355I"
+    "\205\0\0\177\204\377\3\342\235K\2\213\0\201\377\210\0\201\377\207"
+    "\0\201\377\203\0\1\5\362\200\377\0&\201\0\0'\200\377\1\361\5\202\0"
+    "\0o\200\377\2\232\0\23\200\377\5]\377\376\20\0\232\200\377\0n\207"
+    "\0\0\203\201\377\0H\212\0\1\64\376\201\377\1\376\63\214\0\1*\370"
+    "\200\377\0\200\213\0\201\377\215\0\4)\376\377\326\1\217\0\201\377"
+    "\256\0\213\377\0\243\202\0\0\375\200\377\0\2\206\0\0\2\200\377\0"
+    "\375\201\0\207\377\2\356q\21\207\0\1H\315\205\377\1\335M\212\0\201"
+    "\377\210\0\201\377\207\0\201\377\204\0\0\256\200\377\0p\201\0\0q"
+    "\200\377\0\255\203\0\0H\200\377\12\300\0H\377\362\5\362\377D\0\300"
+    "\200\377\0G\207\0\0\273\201\377\0\202\213\0\0\246\201\377\0\245"
+    "\214\0\1\4\313\200\377\1\316\5\213\0\201\377\216\0\0\262\200\377\0"
+    "N\217\0\201\377\256\0\211\377\2\375\215\5\202\0\0\365\200\377\0\10"
+    "\206\0\0\11\200\377\0\366\201\0\210\377\1\333'\211\0\3\60z\272\362"
+    "\203\377\0v\211\0\201\377\210\0\201\377\207\0\201\377\204\0\0e\200"
+    "\377\0\272\201\0\0\273\200\377\0d\203\0\0\42\200\377\12\347\0}\377"
+    "\273\0\274\377y\0\346\200\377\0!\206\0\0]\202\377\1\372.\212\0\0 "
+    "\201\377\0\37\214\0\0}\200\377\1\371.\214\0\201\377\216\0\0;\200"
+    "\377\0\304\217\0\201\377\256\0\205\377\4\370\350\301\205%\204\0\0"
+    "\351\200\377\0\22\206\0\0\23\200\377\0\354\201\0\201\377\5\4\15\25"
+    "+t\361\200\377\1\333\11\213\0\3\2/v\335\200\377\1\376;\210\0\201"
+    "\377\210\0\201\377\207\0\201\377\204\0\0\33\200\377\4\370\13\0\13"
+    "\371\200\377\0\32\203\0\1\2\371\200\377\10\15\262\377\201\0\202"
+    "\377\256\15\200\377\1\370\2\205\0\1\23\353\200\377\0\366\200\377\1"
+    "\313\3\212\0\201\377\214\0\1/\372\200\377\0{\215\0\201\377\217\0\0"
+    "\305\200\377\0;\216\0\201\377\256\0\201\377\215\0\0\324\200\377\0-"
+    "\206\0\0.\200\377\0\323\201\0\201\377\203\0\1\65\370\200\377\0\177"
+    "\216\0\1\10\265\200\377\0\253\210\0\201\377\210\0\0\376\200\377"
+    "\207\0\200\377\0\374\205\0\0\321\200\377\2N\0O\200\377\0\320\205\0"
+    "\0\326\200\377\10\63\347\377H\0I\377\344\63\200\377\0\325\206\0\0"
+    "\241\200\377\2\341\65\370\200\377\0v\212\0\201\377\213\0\1\5\320"
+    "\200\377\1\313\4\215\0\201\377\217\0\0O\200\377\0\261\216\0\201"
+    "\377\256\0\201\377\215\0\0\255\200\377\0R\206\0\0R\200\377\0\263"
+    "\201\0\201\377\204\0\0{\200\377\1\361\17\216\0\0)\200\377\0\346"
+    "\210\0\201\377\210\0\0\365\200\377\0\1\205\0\0\2\200\377\0\364\205"
+    "\0\0\207\200\377\2\230\0\231\200\377\0\206\205\0\0\257\200\377\10v"
+    "\377\376\20\0\21\376\377r\200\377\0\256\205\0\0C\201\377\2K\0z\200"
+    "\377\1\367%\211\0\201\377\213\0\0\203\200\377\1\370*\216\0\201\377"
+    "\217\0\4\1\327\377\376(\215\0\201\377\256\0\201\377\215\0\0\200"
+    "\200\377\0\216\206\0\0\217\200\377\0\202\201\0\201\377\204\0\1\10"
+    "\344\200\377\0z\216\0\0\6\200\377\0\373\210\0\201\377\210\0\0\344"
+    "\200\377\0\11\205\0\0\13\200\377\0\344\205\0\0=\200\377\2\341\0"
+    "\342\200\377\0<\205\0\0\211\200\377\2\322\377\325\201\0\2\326\377"
+    "\316\200\377\0\210\204\0\1\10\333\200\377\0\251\200\0\1\4\317\200"
+    "\377\1\301\1\210\0\201\377\212\0\1\64\373\200\377\0v\217\0\201\377"
+    "\220\0\0c\200\377\0\235\215\0\201\377\256\0\201\377\215\0\0\67\200"
+    "\377\1\346\6\204\0\1\6\346\200\377\0@\201\0\201\377\205\0\0f\200"
+    "\377\1\357\22\215\0\0+\200\377\0\357\210\0\201\377\210\0\0\307\200"
+    "\377\0,\205\0\0.\200\377\0\307\205\0\1\3\357\200\377\0W\200\377\1"
+    "\356\3\205\0\0c\202\377\0\233\201\0\0\234\202\377\0b\204\0\0\206"
+    "\200\377\1\357\30\201\0\1\61\373\200\377\0j\210\0\201\377\211\0\1"
+    "\7\324\200\377\1\307\3\217\0\201\377\220\0\4\6\346\377\371\31\214"
+    "\0\201\377\256\0\201\377\215\0\1\1\337\200\377\0\210\204\0\0\211"
+    "\200\377\1\345\3\201\0\201\377\205\0\1\4\330\200\377\0\215\214\0\1"
+    "\7\270\200\377\0\277\210\0\201\377\210\0\0\223\200\377\1\255\1\203"
+    "\0\1\2\256\200\377\0\223\206\0\0\251\200\377\0\341\200\377\0\250"
+    "\206\0\0=\202\377\0b\201\0\0c\202\377\0<\203\0\1-\372\200\377\0e"
+    "\203\0\0\205\200\377\1\362\36\207\0\201\377\211\0\0\211\200\377\1"
+    "\366'\220\0\201\377\221\0\0w\200\377\0\211\214\0\201\377\256\0\201"
+    "\377\216\0\0_\201\377\5\246\67\13\14\70\247\201\377\0p\202\0\201"
+    "\377\206\0\0R\200\377\1\370\37\201\0\12\337\237k= \13\3\10$c\325"
+    "\201\377\0`\210\0\201\377\210\0\0\63\201\377\6\300L\25\5\25L\302"
+    "\201\377\0\64\206\0\0_\203\377\0^\206\0\0\26\202\377\0(\201\0\0)"
+    "\202\377\0\25\202\0\1\2\307\200\377\1\301\1\203\0\1\7\326\200\377"
+    "\0\267\207\0\201\377\210\0\1\70\375\200\377\0r\221\0\201\377\221\0"
+    "\4\17\361\377\360\16\213\0\201\377\256\0\201\377\216\0\1\2\261\210"
+    "\377\1\302\3\202\0\201\377\207\0\0\306\200\377\0\243\201\0\213\377"
+    "\1\272\2\210\0\201\377\211\0\0\221\211\377\0\221\207\0\1\26\376"
+    "\201\377\1\376\26\207\0\0\357\200\377\1\355\1\201\0\1\1\356\200"
+    "\377\0\356\203\0\0l\200\377\1\370(\205\0\1\71\375\200\377\0^\206\0"
+    "\201\377\210\0\0\331\215\377\206\0\201\377\222\0\0\212\200\377\0v"
+    "\213\0\201\377\256\0\201\377\217\0\1\11\246\206\377\1\263\16\203\0"
+    "\201\377\207\0\0<\200\377\1\376\60\200\0\211\377\2\376\231\12\211"
+    "\0\201\377\211\0\2\2}\373\205\377\2\374~\1\210\0\0\313\201\377\0"
+    "\312\210\0\0\312\200\377\0\265\203\0\0\266\200\377\0\311\202\0\1"
+    "\33\362\200\377\0\177\207\0\0\217\200\377\1\355\27\205\0\201\377"
+    "\210\0\216\377\206\0\201\377\222\0\4\32\371\377\345\6\212\0\201"
+    "\377\256\0\201\377\221\0\3A\237\333\364\201\377\1\374D\204\0\201"
+    "\377\210\0\0\261\200\377\0\272\200\0\13!b\226\301\340\364\374\366"
+    "\346\276\203'\213\0\201\377\213\0\10!\210\312\356\373\356\313\211"
+    "\42\212\0\0\201\201\377\0\200\210\0\0\243\200\377\0|\203\0\0}\200"
+    "\377\0\243\202\0\0\257\200\377\1\326\6\207\0\1\12\335\200\377\0"
+    "\254\205\0\201\377\210\0\216\377\206\0\201\377\223\0\0\236\200\377"
+    "\0b\212\0\201\377\310\0\1\15\305\200\377\1\364\71\377\0\262\0\201"
+    "\377\223\0\4)\376\377\326\1\211\0\201\377\311\0\1\14\303\200\377\1"
+    "\357\60\377\0\261\0\201\377\224\0\0\262\200\377\0N\211\0\201\377"
+    "\312\0\1\13\301\200\377\0\224\377\0\261\0\205\377\220\0\0;\200\377"
+    "\0\304\205\0\205\377\313\0\2\12\267j\377\0\262\0\205\377\233\0\205"
+    "\377\377\0\377\0\201\0\205\377\233\0\205\377\377\0\377\0\306\0\221"
+    "\377\377\0\377\0\231\0\221\377\377\0\377\0\231\0\221\377\377\0\377"
+    "\0\377\0\377\0\377\0\377\0\377\0\213\0\3\233\377\375=\377\0\377\0"
+    "\250\0\4\7\311\377\335\14\377\0\377\0\250\0\3\34\351\377\232\236\0"
+    "\201\377\254\0\201\377\234\0\4\7p\304\356\375\201\377\226\0\201"
+    "\377\223\0\201\377\217\0\201\377\211\0\201\377\213\0\207\377\306\0"
+    "\3\77\373\377I\235\0\201\377\254\0\201\377\233\0\1\12\311\205\377"
+    "\226\0\201\377\223\0\201\377\217\0\201\377\211\0\201\377\213\0\207"
+    "\377\307\0\3p\377\346\22\234\0\201\377\254\0\201\377\233\0\0}\206"
+    "\377\226\0\201\377\223\0\201\377\217\0\201\377\211\0\201\377\213\0"
+    "\207\377\310\0\2\245\377\250\234\0\201\377\254\0\201\377\233\0\0"
+    "\320\200\377\2\226\35\2\231\0\201\377\223\0\201\377\217\0\201\377"
+    "\211\0\201\377\221\0\201\377\351\0\201\377\254\0\201\377\233\0\0"
+    "\365\200\377\0\15\233\0\201\377\265\0\201\377\221\0\201\377\351\0"
+    "\201\377\254\0\201\377\233\0\201\377\234\0\201\377\265\0\201\377"
+    "\221\0\201\377\330\0\10:\222\321\364\374\356\313\213*\206\0\201"
+    "\377\10\0\5q\317\370\367\324\212\31\211\0\10\36~\301\351\373\366"
+    "\315{\22\206\0\10\26\206\321\366\371\322t\6\0\201\377\206\0\2C\243"
+    "\336\200\371\2\333\230)\206\0\214\377\205\0\10\21\200\320\362\360"
+    "\313i\4\0\201\377\203\0\201\377\7\0\1d\313\367\361\301M\207\0\205"
+    "\377\212\0\206\377\211\0\201\377\204\0\1$\343\200\377\1\364\77\205"
+    "\0\201\377\211\0\201\377\14\2\201\351\367\271\42\0\31\254\364\361"
+    "\262#\202\0\201\377\7\0\1d\313\367\361\301M\210\0\10\25~\311\360"
+    "\375\360\310|\23\231\0\1G\313\206\377\2\376\221\4\204\0\201\377\1"
+    "\13\302\204\377\1\357H\206\0\2\4\207\372\205\377\1\357]\204\0\1D"
+    "\355\204\377\1\306\14\201\377\204\0\1\17\260\205\377\1\372l\205\0"
+    "\214\377\204\0\1\70\350\204\377\1\266\10\201\377\203\0\201\377\1\2"
+    "\250\204\377\0k\206\0\205\377\212\0\206\377\211\0\201\377\203\0\1$"
+    "\343\200\377\1\365\77\206\0\201\377\211\0\201\377\0\211\202\377\2"
+    "\336\21\324\202\377\1\340\14\201\0\201\377\1\2\250\204\377\0k\206"
+    "\0\1J\356\205\377\1\355G\230\0\212\377\0\244\204\0\201\377\0\233"
+    "\206\377\1\367\60\204\0\1\4\263\211\377\203\0\1.\366\206\377\0\234"
+    "\201\377\203\0\1\12\312\210\377\0V\204\0\214\377\203\0\1&\360\206"
+    "\377\0\206\201\377\203\0\201\377\0s\205\377\1\367\33\205\0\205\377"
+    "\212\0\206\377\211\0\201\377\202\0\1$\343\200\377\1\365\77\207\0"
+    "\201\377\211\0\201\377\0\373\203\377\0\313\204\377\0e\201\0\201"
+    "\377\0s\205\377\1\367\33\204\0\1;\371\207\377\1\370\70\227\0\200"
+    "\377\7\302h-\13\3\23C\253\201\377\0G\203\0\201\377\7\375\362t\37\6"
+    "\35o\361\200\377\0\313\204\0\0\206\201\377\10\320_ \7\15-t\341\377"
+    "\203\0\0\312\200\377\7\360n\34\6\37u\363\375\201\377\203\0\0\226"
+    "\200\377\6\362y%\5\17E\302\200\377\1\355\15\210\0\201\377\211\0\0"
+    "\277\200\377\7\365z\42\6\32l\360\371\201\377\203\0\201\377\6\356"
+    "\320B\12\23q\374\200\377\0x\211\0\201\377\217\0\201\377\211\0\201"
+    "\377\201\0\1$\343\200\377\1\365@\210\0\201\377\211\0\201\377\3\277"
+    "\27\25\267\201\377\3\304\34\20\261\200\377\0\245\201\0\201\377\6"
+    "\356\320B\12\23q\374\200\377\0x\203\0\1\3\330\200\377\6\361p\35\6"
+    "\36q\361\200\377\1\325\2\226\0\1\270-\206\0\0\234\200\377\0\244"
+    "\203\0\201\377\1\373:\203\0\1\67\373\200\377\0\77\202\0\1\35\371"
+    "\200\377\1\236\4\204\0\1\11\230\202\0\0\77\200\377\1\372\64\203\0"
+    "\1=\374\201\377\202\0\4#\374\377\357+\203\0\1\4\302\200\377\0j\210"
+    "\0\201\377\210\0\0\66\200\377\1\375A\203\0\1\66\373\201\377\203\0"
+    "\201\377\1\344\21\202\0\0\214\200\377\0\272\211\0\201\377\217\0"
+    "\201\377\211\0\201\377\200\0\1$\343\200\377\1\365@\211\0\201\377"
+    "\211\0\201\377\0E\200\0\0\77\201\377\0G\200\0\0<\200\377\0\316\201"
+    "\0\201\377\1\344\21\202\0\0\214\200\377\0\272\203\0\0M\200\377\1"
+    "\373\67\203\0\1\70\373\200\377\0J\240\0\0)\200\377\0\330\203\0\201"
+    "\377\0\235\205\0\0\235\200\377\0\224\202\0\0|\200\377\1\322\5\213"
+    "\0\0\224\200\377\0\232\205\0\0\240\201\377\202\0\0\201\200\377\0p"
+    "\205\0\0D\200\377\0\261\210\0\201\377\210\0\0\216\200\377\0\241"
+    "\205\0\0\234\201\377\203\0\201\377\0s\203\0\0\64\200\377\0\341\211"
+    "\0\201\377\217\0\201\377\211\0\201\377\2\0$\343\200\377\1\365A\212"
+    "\0\201\377\211\0\201\377\0\34\200\0\0\32\201\377\0\35\200\0\0\31"
+    "\200\377\0\346\201\0\201\377\0s\203\0\0\64\200\377\0\341\203\0\0"
+    "\233\200\377\0\234\205\0\0\235\200\377\0\231\240\0\0\5\200\377\0"
+    "\360\203\0\201\377\0G\205\0\0H\200\377\0\310\202\0\0\300\200\377\0"
+    "c\214\0\0\311\200\377\0F\205\0\0I\201\377\202\0\0\302\200\377\0\32"
+    "\205\0\0\15\200\377\0\342\210\0\201\377\210\0\0\305\200\377\0I\205"
+    "\0\0G\201\377\203\0\201\377\0-\203\0\0\15\200\377\0\364\211\0\201"
+    "\377\217\0\201\377\211\0\201\377\1$\343\200\377\1\365A\213\0\201"
+    "\377\211\0\201\377\0\11\200\0\0\11\201\377\0\12\200\0\0\11\200\377"
+    "\0\365\201\0\201\377\0-\203\0\0\15\200\377\0\364\203\0\0\317\200"
+    "\377\0G\205\0\0H\200\377\0\316\227\0\5\1H\232\313\353\370\204\377"
+    "\0\373\203\0\201\377\0\31\205\0\0\32\200\377\0\351\202\0\0\351\200"
+    "\377\0#\214\0\0\352\200\377\0\31\205\0\0\32\201\377\202\0\0\351"
+    "\200\377\201\374\200\375\200\376\202\377\0\365\210\0\201\377\210\0"
+    "\0\351\200\377\0\31\205\0\0\31\201\377\203\0\201\377\0\13\203\0\0"
+    "\1\200\377\0\376\211\0\201\377\217\0\201\377\211\0\201\377\0\343"
+    "\201\377\0\255\214\0\201\377\211\0\201\377\0\1\200\0\0\2\201\377\0"
+    "\1\200\0\0\2\200\377\0\375\201\0\201\377\0\13\203\0\0\1\200\377\0"
+    "\376\203\0\0\357\200\377\0\31\205\0\0\32\200\377\0\355\226\0\1)"
+    "\314\212\377\203\0\201\377\0\6\205\0\0\7\200\377\0\370\202\0\0\374"
+    "\200\377\0\10\214\0\0\371\200\377\0\6\205\0\0\7\201\377\202\0\0"
+    "\374\214\377\210\0\201\377\210\0\0\370\200\377\0\5\205\0\0\6\201"
+    "\377\203\0\201\377\205\0\201\377\211\0\201\377\217\0\201\377\211\0"
+    "\206\377\0Q\213\0\201\377\211\0\201\377\202\0\201\377\202\0\201"
+    "\377\201\0\201\377\205\0\201\377\203\0\0\375\200\377\0\6\205\0\0\7"
+    "\200\377\0\374\225\0\1\32\352\213\377\203\0\201\377\0\6\205\0\0\7"
+    "\200\377\0\367\202\0\0\374\200\377\0\10\214\0\0\370\200\377\0\6"
+    "\205\0\0\7\201\377\202\0\0\374\214\377\210\0\201\377\210\0\0\370"
+    "\200\377\0\6\205\0\0\7\201\377\203\0\201\377\205\0\201\377\211\0"
+    "\201\377\217\0\201\377\211\0\202\377\1\364\276\200\377\1\354\31"
+    "\212\0\201\377\211\0\201\377\202\0\201\377\202\0\201\377\201\0\201"
+    "\377\205\0\201\377\203\0\0\375\200\377\0\6\205\0\0\7\200\377\0\374"
+    "\225\0\0\227\200\377\4\373\230D\32\7\201\0\0\3\201\377\203\0\201"
+    "\377\0\31\205\0\0\32\200\377\0\347\202\0\0\351\200\377\0#\214\0\0"
+    "\350\200\377\0\30\205\0\0\32\201\377\202\0\2\353\377\354\224\0\201"
+    "\377\210\0\0\351\200\377\0\33\205\0\0\32\201\377\203\0\201\377\205"
+    "\0\201\377\211\0\201\377\217\0\201\377\211\0\201\377\3\364\77\17"
+    "\340\200\377\1\270\1\211\0\201\377\211\0\201\377\202\0\201\377\202"
+    "\0\201\377\201\0\201\377\205\0\201\377\203\0\0\357\200\377\0\31"
+    "\205\0\0\32\200\377\0\355\225\0\0\342\200\377\0Z\205\0\0!\201\377"
+    "\203\0\201\377\0H\205\0\0G\200\377\0\304\202\0\0\301\200\377\0d"
+    "\214\0\0\305\200\377\0F\205\0\0J\201\377\202\0\3\306\377\376\22"
+    "\223\0\201\377\210\0\0\305\200\377\0L\205\0\0I\201\377\203\0\201"
+    "\377\205\0\201\377\211\0\201\377\217\0\201\377\211\0\201\377\0\77"
+    "\200\0\1>\375\200\377\0n\211\0\0\375\200\377\0\1\210\0\201\377\202"
+    "\0\201\377\202\0\201\377\201\0\201\377\205\0\201\377\203\0\0\320"
+    "\200\377\0G\205\0\0H\200\377\0\316\225\0\0\374\200\377\0\7\205\0\0"
+    "v\201\377\203\0\201\377\0\235\205\0\0\235\200\377\0\217\202\0\0|"
+    "\200\377\1\324\5\213\0\0\220\200\377\0\231\205\0\0\241\201\377\202"
+    "\0\0\206\200\377\0k\223\0\201\377\210\0\0\216\200\377\0\245\205\0"
+    "\0\237\201\377\203\0\201\377\205\0\201\377\211\0\201\377\217\0\201"
+    "\377\211\0\201\377\202\0\0\210\200\377\1\367*\210\0\0\360\200\377"
+    "\0\26\210\0\201\377\202\0\201\377\202\0\201\377\201\0\201\377\205"
+    "\0\201\377\203\0\0\234\200\377\0\234\205\0\0\235\200\377\0\233\225"
+    "\0\0\355\200\377\0=\204\0\1\65\362\201\377\203\0\201\377\1\373\71"
+    "\203\0\1\67\373\200\377\0\70\202\0\1\36\372\200\377\1\241\5\204\0"
+    "\1\6\222\202\0\0;\200\377\1\372\64\203\0\1=\374\201\377\202\0\4+"
+    "\376\377\360\60\205\0\1)\263\211\0\201\377\210\0\0\67\200\377\1"
+    "\375D\203\0\1\70\374\201\377\203\0\201\377\205\0\201\377\211\0\201"
+    "\377\217\0\201\377\211\0\201\377\202\0\1\6\316\200\377\1\317\6\207"
+    "\0\0\314\200\377\0]\210\0\201\377\202\0\201\377\202\0\201\377\201"
+    "\0\201\377\205\0\201\377\203\0\0N\200\377\1\373\67\203\0\1\67\373"
+    "\200\377\0L\225\0\0\262\200\377\10\352d\33\3\14\65\214\370\356\201"
+    "\377\203\0\201\377\7\375\362s\36\5\33n\360\200\377\0\305\204\0\0"
+    "\207\201\377\10\321` \7\14+p\333\377\203\0\0\310\200\377\7\357n\33"
+    "\5\36t\363\375\201\377\203\0\0\244\200\377\11\366\210\64\14\6 \134"
+    "\261\375\377\211\0\201\377\211\0\0\301\200\377\5\366|\42\5\30l\200"
+    "\360\201\377\203\0\201\377\205\0\201\377\211\0\201\377\217\0\201"
+    "\377\211\0\201\377\203\0\1*\366\200\377\0\212\207\0\0\210\200\377"
+    "\2\351G\6\206\0\201\377\202\0\201\377\202\0\201\377\201\0\201\377"
+    "\205\0\201\377\203\0\1\3\331\200\377\6\360o\34\5\35p\361\200\377\1"
+    "\330\3\225\0\1;\375\207\377\0^\201\377\203\0\201\377\0\232\206\377"
+    "\1\365+\204\0\1\4\264\211\377\203\0\1.\367\206\377\0\231\201\377"
+    "\203\0\1\20\326\211\377\211\0\201\377\211\0\1(\361\206\377\0u\201"
+    "\377\203\0\201\377\205\0\201\377\203\0\215\377\211\0\201\377\211\0"
+    "\201\377\204\0\0m\200\377\1\375@\206\0\1 \366\205\377\203\0\201"
+    "\377\202\0\201\377\202\0\201\377\201\0\201\377\205\0\201\377\204\0"
+    "\1=\372\207\377\1\372=\227\0\1d\371\204\377\2\375w\0\201\377\203\0"
+    "\201\377\1\13\302\204\377\1\356D\206\0\2\5\210\372\205\377\1\361`"
+    "\204\0\1G\357\204\377\1\302\13\201\377\204\0\1\26\272\206\377\1"
+    "\330M\211\0\201\377\212\0\1:\351\204\377\1\253\5\200\377\0\375\203"
+    "\0\201\377\205\0\201\377\203\0\215\377\211\0\201\377\211\0\201\377"
+    "\204\0\1\1\271\200\377\1\341\20\206\0\1\134\374\204\377\203\0\201"
+    "\377\202\0\201\377\202\0\201\377\201\0\201\377\205\0\201\377\205\0"
+    "\1M\360\205\377\1\357M\231\0\7)\227\330\366\372\337\240\62\200\0"
+    "\201\377\203\0\201\377\10\0\5s\321\371\367\324\207\27\211\0\10\37"
+    "\177\302\352\374\367\317\200\25\206\0\10\30\210\324\370\371\321s\5"
+    "\0\201\377\206\0\10F\243\334\370\374\341\246N\2\212\0\201\377\213"
+    "\0\10\22\201\321\363\360\311d\3\10\200\377\0\356\203\0\201\377\205"
+    "\0\201\377\203\0\215\377\211\0\201\377\211\0\201\377\205\0\1\31"
+    "\354\200\377\0\246\207\0\3\66\255\352\375\201\377\203\0\201\377"
+    "\202\0\201\377\202\0\201\377\201\0\201\377\205\0\201\377\206\0\10"
+    "\26\200\313\362\375\361\312\177\26\377\0\224\0\0#\200\377\0\330"
+    "\256\0\0\11\200\377\0\372\377\0\365\0\0e\200\377\0\245\256\0\0%"
+    "\200\377\0\352\377\0\364\0\1\17\335\200\377\0\134\256\0\0y\200\377"
+    "\0\301\377\0\354\0\10\332\221T'\13\4\31Z\330\200\377\1\345\7\254\0"
+    "\2\21^\364\200\377\0z\377\0\354\0\210\377\1\375G\252\0\205\377\1"
+    "\357\26\377\0\354\0\207\377\1\361Q\253\0\204\377\1\371M\377\0\355"
+    "\0\11(u\262\335\365\373\352\303{\22\254\0\201\377\3\375\347\246-"
+    "\377\0\377\0\377\0\377\0\377\0\377\0\377\0\377\0\377\0\377\0\377\0"
+    "\377\0\377\0\377\0\377\0\377\0\320\0\6\4`\255\327\360\373\377\211"
+    "\0\201\377\211\0\6\377\372\360\327\254^\4\377\0\0\0\201\377\377\0"
+    "\200\0\1\10\307\204\377\211\0\201\377\211\0\204\377\1\304\7\377\0"
+    "\201\377\377\0\200\0\0o\205\377\211\0\201\377\211\0\205\377\0l\377"
+    "\0\201\377\377\0\200\0\0\275\200\377\3\313@\22\3\212\0\201\377\212"
+    "\0\3\3\23C\320\200\377\0\273\377\0\201\377\377\0\200\0\0\350\200"
+    "\377\0\66\215\0\201\377\215\0\0\71\200\377\0\346\377\0\201\377\377"
+    "\0\200\0\0\370\200\377\0\10\215\0\201\377\215\0\0\11\200\377\0\367"
+    "\257\0\201\377\10\0\5i\313\362\360\317\202\23\207\0\10\23\202\317"
+    "\360\362\313h\4\0\201\377\206\0\201\377\200\0\6=\256\352\373\350"
+    "\255D\204\0\11,\220\315\357\373\366\340\267{+\204\0\215\377\203\0"
+    "\201\377\205\0\201\377\203\0\0\324\200\377\0W\206\0\0X\200\377\2"
+    "\324\0\343\200\377\0,\211\0\0-\200\377\0\343\200\0\0\247\200\377\1"
+    "\352\26\203\0\1\30\354\200\377\0\246\202\0\0\320\200\377\0c\206\0"
+    "\0i\200\377\0\317\202\0\213\377\211\0\201\377\216\0\201\377\216\0"
+    "\201\377\257\0\201\377\1\12\270\204\377\1\354@\205\0\1@\353\204"
+    "\377\1\267\12\201\377\206\0\201\377\1\0x\205\377\203\0\1\200\375"
+    "\207\377\204\0\215\377\203\0\201\377\205\0\201\377\203\0\0}\200"
+    "\377\0\257\206\0\0\260\200\377\2|\0\252\200\377\0e\211\0\0f\200"
+    "\377\0\251\200\0\1\21\344\200\377\0\262\203\0\0\266\200\377\1\343"
+    "\20\202\0\0q\200\377\0\301\206\0\0\312\200\377\0m\202\0\213\377"
+    "\211\0\201\377\216\0\201\377\216\0\201\377\257\0\201\377\0\220\206"
+    "\377\1\364.\203\0\1.\365\206\377\0\217\201\377\206\0\201\377\0N"
+    "\206\377\202\0\0]\211\377\204\0\215\377\203\0\201\377\205\0\201"
+    "\377\203\0\0%\200\377\1\370\16\204\0\1\17\370\200\377\2$\0q\200"
+    "\377\0\237\211\0\0\240\200\377\0p\201\0\1D\376\200\377\0e\201\0\0i"
+    "\200\377\1\376C\203\0\4\26\373\377\376!\204\0\0+\200\377\1\371\23"
+    "\202\0\212\377\0\360\211\0\201\377\216\0\201\377\216\0\201\377\257"
+    "\0\201\377\7\375\362t\37\6\34n\357\200\377\0\307\203\0\0\310\200"
+    "\377\7\360o\35\6\37t\363\375\201\377\206\0\201\377\10\326\377\255B"
+    "\20\5\34Y\277\202\0\0\314\200\377\10\323Q\30\4\7\33D\201\323\211\0"
+    "\201\377\212\0\201\377\205\0\201\377\204\0\0\315\200\377\0^\204\0"
+    "\0_\200\377\0\314\200\0\0\67\200\377\0\330\211\0\0\331\200\377\0"
+    "\67\202\0\0\220\200\377\4\364#\0%\365\200\377\0\217\205\0\0\263"
+    "\200\377\0\177\204\0\0\214\200\377\0\253\213\0\0\223\201\377\0V"
+    "\210\0\0\3\200\377\0\376\216\0\201\377\216\0\201\377\0\2\256\0\201"
+    "\377\1\373:\203\0\1\64\372\200\377\0:\201\0\0<\200\377\1\372\64"
+    "\203\0\1=\374\201\377\206\0\202\377\0}\211\0\0\366\200\377\0!\221"
+    "\0\201\377\212\0\201\377\205\0\201\377\204\0\0u\200\377\0\266\204"
+    "\0\0\267\200\377\0t\200\0\4\6\370\377\376\23\207\0\0\23\200\377\1"
+    "\367\5\202\0\1\10\325\200\377\2\306\7\310\200\377\1\324\10\205\0\0"
+    "T\200\377\1\335\1\202\0\1\4\350\200\377\0J\212\0\0I\201\377\0\233"
+    "\211\0\0\31\200\377\0\364\216\0\201\377\216\0\0\365\200\377\0\27"
+    "\256\0\201\377\0\235\205\0\0\232\200\377\0\220\201\0\0\221\200\377"
+    "\0\232\205\0\0\240\201\377\206\0\201\377\1\307\1\211\0\0\361\200"
+    "\377\0S\221\0\201\377\212\0\201\377\205\0\201\377\204\0\4\37\376"
+    "\377\372\23\202\0\4\23\373\377\376\36\201\0\0\305\200\377\0K\201\0"
+    "\2\331\377\321\201\0\0L\200\377\0\304\204\0\1\60\372\200\377\0\320"
+    "\200\377\1\371\60\206\0\1\7\356\200\377\0=\202\0\0N\200\377\1\345"
+    "\3\211\0\1\25\350\200\377\1\326\12\211\0\0d\200\377\0\322\216\0"
+    "\201\377\216\0\0\323\200\377\0c\207\0\7%\221\326\366\367\321\212+"
+    "\204\0\1\12\232\225\0\201\377\0G\205\0\0G\200\377\0\304\201\0\0"
+    "\306\200\377\0F\205\0\0I\201\377\206\0\201\377\0`\212\0\0\260\201"
+    "\377\4\347\253wG\31\214\0\201\377\212\0\201\377\205\0\201\377\205"
+    "\0\0\306\200\377\0e\202\0\0f\200\377\0\305\202\0\0\213\200\377\0"
+    "\205\200\0\0\34\200\377\1\376\26\200\0\0\205\200\377\0\213\205\0\0"
+    "y\203\377\0x\210\0\0\226\200\377\0\234\202\0\0\257\200\377\0\207"
+    "\212\0\0\262\200\377\1\367.\207\0\3\5\37j\361\200\377\0\206\216\0"
+    "\201\377\216\0\0\207\200\377\3\361j\37\5\203\0\1\200\372\205\377\7"
+    "\272Y\32\5 l\340\377\225\0\201\377\0\31\205\0\0\31\200\377\0\347"
+    "\201\0\0\351\200\377\0\31\205\0\0\32\201\377\206\0\201\377\0%\212"
+    "\0\1&\353\205\377\2\327i\1\211\0\201\377\212\0\201\377\205\0\201"
+    "\377\205\0\0n\200\377\0\275\202\0\0\276\200\377\0m\202\0\0R\200"
+    "\377\0\276\200\0\4_\377\376\377Y\200\0\0\277\200\377\0Q\205\0\1\2"
+    "\303\201\377\1\303\2\210\0\0\66\200\377\1\361\11\200\0\1\26\372"
+    "\200\377\0'\211\0\0i\201\377\0j\207\0\204\377\1\305\15\216\0\201"
+    "\377\216\0\1\15\302\204\377\202\0\217\377\225\0\201\377\0\6\205\0"
+    "\0\6\200\377\0\367\201\0\0\370\200\377\0\6\205\0\0\7\201\377\206\0"
+    "\201\377\0\12\213\0\2\34\233\363\205\377\1\254\2\210\0\201\377\212"
+    "\0\201\377\205\0\201\377\205\0\4\30\375\377\374\27\200\0\4\30\375"
+    "\377\375\30\202\0\0\31\200\377\12\364\3\0\242\377\250\377\234\0\3"
+    "\364\200\377\0\30\206\0\0/\201\377\0/\212\0\0\327\200\377\0Z\200\0"
+    "\0r\200\377\0\305\211\0\1(\366\200\377\0\257\210\0\202\377\2\374"
+    "\207\2\217\0\201\377\217\0\2\1\200\372\202\377\202\0\10\377\336n$"
+    "\7\17@\222\356\204\377\1\372~\225\0\201\377\0\6\205\0\0\6\200\377"
+    "\0\370\201\0\0\371\200\377\0\6\205\0\0\7\201\377\206\0\201\377\216"
+    "\0\4\7:j\236\340\202\377\0d\210\0\201\377\212\0\201\377\205\0\201"
+    "\377\206\0\0\276\200\377\0l\200\0\0m\200\377\0\276\204\0\0\337\200"
+    "\377\10\61\0\345\374!\374\337\0\61\200\377\0\337\207\0\0\252\201"
+    "\377\0\251\212\0\0x\200\377\0\271\200\0\0\323\200\377\0d\210\0\1\5"
+    "\315\200\377\1\342\22\210\0\204\377\1\256\5\216\0\201\377\216\0\1"
+    "\4\251\204\377\202\0\1\230\11\204\0\7\11b\272\357\370\333\224&\226"
+    "\0\201\377\0\31\205\0\0\31\200\377\0\351\201\0\0\352\200\377\0\30"
+    "\205\0\0\32\201\377\206\0\201\377\223\0\1H\337\200\377\0\306\210\0"
+    "\201\377\212\0\0\376\200\377\0\1\203\0\0\13\201\377\206\0\0g\200"
+    "\377\0\304\200\0\0\305\200\377\0f\204\0\0\246\200\377\10j(\377\307"
+    "\0\310\377$k\200\377\0\245\206\0\0i\203\377\0h\211\0\5\34\375\377"
+    "\375\33\64\200\377\1\365\15\210\0\0\211\200\377\1\374=\212\0\3\7#x"
+    "\370\200\377\0s\216\0\201\377\216\0\0p\200\377\3\367u\42\6\253\0"
+    "\201\377\0H\205\0\0F\200\377\0\310\201\0\0\311\200\377\0F\205\0\0I"
+    "\201\377\206\0\201\377\224\0\0\60\200\377\0\363\210\0\201\377\212"
+    "\0\0\365\200\377\0\14\203\0\0-\201\377\206\0\11\23\373\377\376\35"
+    "\36\376\377\372\23\204\0\0m\200\377\10\244k\377\200\0\201\377g\244"
+    "\200\377\0l\205\0\1\60\370\200\377\0\345\200\377\1\367/\211\0\0"
+    "\272\200\377\1w\225\200\377\0\241\210\0\1@\375\200\377\0~\216\0\0w"
+    "\200\377\0\306\216\0\201\377\216\0\0\306\200\377\0t\256\0\201\377"
+    "\0\235\205\0\0\232\200\377\0\223\201\0\0\224\200\377\0\231\205\0\0"
+    "\237\201\377\206\0\201\377\224\0\0\12\200\377\0\373\210\0\0\372"
+    "\200\377\0\14\211\0\0\343\200\377\0\63\203\0\0s\201\377\207\0\0"
+    "\267\200\377\1tu\200\377\0\266\205\0\0\63\200\377\10\335\255\377:"
+    "\0;\377\253\335\200\377\0\63\204\0\1\14\332\200\377\2\320\20\320"
+    "\200\377\1\331\14\210\0\0[\200\377\1\331\356\200\377\0B\207\0\1\21"
+    "\342\200\377\1\300\2\216\0\0\42\200\377\0\355\216\0\201\377\216\0"
+    "\0\356\200\377\0!\256\0\201\377\1\373\71\203\0\1\64\372\200\377\0>"
+    "\201\0\0@\200\377\1\372\64\203\0\1:\374\201\377\206\0\201\377\213"
+    "\0\1\265.\205\0\0a\200\377\0\343\210\0\0\343\200\377\0I\211\0\0"
+    "\274\200\377\0\213\202\0\1\21\345\201\377\207\0\0_\200\377\1\313"
+    "\314\200\377\0^\205\0\1\4\365\200\377\6\364\360\3\0\4\360\363\200"
+    "\377\1\365\4\204\0\0\245\200\377\4\363&\0&\363\200\377\0\244\210\0"
+    "\1\11\361\202\377\1\343\2\207\0\0\251\200\377\1\354\33\217\0\0\6"
+    "\200\377\0\374\216\0\201\377\216\0\0\375\200\377\0\5\256\0\201\377"
+    "\7\375\362s\36\5\33m\357\200\377\0\313\203\0\0\314\200\377\7\357n"
+    "\34\5\35r\362\374\201\377\206\0\201\377\213\0\11\377\376\273b%\5\6"
+    ")\201\371\200\377\0\234\210\0\0\261\200\377\3\341Q\22\1\206\0\0|"
+    "\200\377\6\374p\22\11A\320\354\201\377\207\0\1\17\370\202\377\1"
+    "\370\16\206\0\0\301\201\377\0\255\201\0\0\256\201\377\0\300\204\0"
+    "\0d\201\377\0[\201\0\0Z\201\377\0c\210\0\0\234\202\377\0\212\207\0"
+    "\0_\201\377\0N\221\0\201\377\216\0\201\377\216\0\201\377\257\0\201"
+    "\377\0\223\206\377\1\365\60\203\0\1\60\365\206\377\0\213\201\377"
+    "\206\0\201\377\213\0\211\377\1\361 \210\0\0V\207\377\203\0\1\36"
+    "\371\205\377\0o\201\377\210\0\0\260\202\377\0\257\207\0\0\207\201"
+    "\377\0g\201\0\0h\201\377\0\207\203\0\1,\366\200\377\0\234\203\0\0"
+    "\233\200\377\1\366,\207\0\0=\202\377\0/\207\0\0\362\212\377\211\0"
+    "\201\377\216\0\201\377\216\0\201\377\257\0\201\377\1\14\276\204"
+    "\377\1\355B\205\0\1A\355\204\377\1\266\11\201\377\206\0\201\377"
+    "\213\0\1H\316\206\377\1\340\66\211\0\1\1\247\206\377\204\0\0q\204"
+    "\377\1\244\1\201\377\210\0\0X\202\377\0W\207\0\0N\201\377\0!\201\0"
+    "\0\42\201\377\0M\202\0\1\13\326\200\377\1\323\11\203\0\1\11\322"
+    "\200\377\1\326\13\206\0\1\1\335\200\377\0\326\210\0\213\377\211\0"
+    "\201\377\216\0\201\377\216\0\201\377\257\0\201\377\3\0\6m\315\200"
+    "\362\2\320\203\24\207\0\2\24\203\320\200\362\3\314i\4\0\201\377"
+    "\206\0\201\377\215\0\10A\234\333\372\370\344\265g\13\213\0\4\1V"
+    "\261\343\372\202\377\205\0\7Q\303\363\370\313b\1\0\201\377\210\0\1"
+    "\13\365\200\377\1\364\12\207\0\0\25\200\377\0\333\203\0\0\333\200"
+    "\377\0\25\202\0\0\241\200\377\1\365)\205\0\1(\364\200\377\0\240"
+    "\207\0\0\266\200\377\0{\210\0\213\377\211\0\201\377\0\1\215\0\201"
+    "\377\215\0\0\1\200\377\0\376\257\0\201\377\231\0\201\377\377\0\213"
+    "\0\1\25\372\200\377\0!\240\0\0\365\200\377\0\16\215\0\201\377\215"
+    "\0\0\17\200\377\0\363\257\0\201\377\231\0\201\377\377\0\213\0\0z"
+    "\200\377\0\303\241\0\0\341\200\377\0@\215\0\201\377\215\0\0D\200"
+    "\377\0\340\257\0\201\377\231\0\201\377\377\0\212\0\1\14\351\200"
+    "\377\0b\241\0\0\264\200\377\3\323E\22\2\212\0\201\377\212\0\3\2\23"
+    "H\327\200\377\0\262\257\0\201\377\231\0\201\377\377\0\210\0\2\2*"
+    "\272\200\377\1\360\13\241\0\0a\205\377\211\0\201\377\211\0\205\377"
+    "\0^\257\0\201\377\231\0\201\377\377\0\207\0\204\377\0|\242\0\1\4"
+    "\272\204\377\211\0\201\377\211\0\204\377\1\267\3\257\0\201\377\231"
+    "\0\201\377\377\0\207\0\203\377\1\274\4\243\0\6\2Y\251\327\361\373"
+    "\377\211\0\201\377\211\0\6\377\373\360\326\251W\2\260\0\201\377"
+    "\231\0\201\377\377\0\207\0\200\377\3\370\326w\5\266\0\201\377\377"
+    "\0\377\0\251\0\201\377\377\0\377\0\377\0\377\0\377\0\377\0\377\0"
+    "\377\0\377\0\377\0\312\0\200\377\377\0\377\0\252\0\200\377\0\1\307"
+    "\0\1\1\311\200\377\0\277\210\0\0\300\200\377\1\311\1\377\0\223\0"
+    "\202\377\211\0\202\377\202\0\202\377\210\0\0\243\200\377\0\314\200"
+    "\0\1\24\376\200\377\0d\210\0\200\377\0\2\210\0\1R\303\200\364\1"
+    "\301O\216\0\2J\254\341\200\367\2\326\226\67\213\0\202\377\216\0\0a"
+    "\201\377\0=\210\0\0\77\201\377\0_\217\0\201\377\337\0\0;\200\377\0"
+    "\304\233\0\202\377\211\0\202\377\202\0\202\377\210\0\0\341\200\377"
+    "\0\215\200\0\0Q\201\377\0$\210\0\200\377\0\3\207\0\0\214\204\377\0"
+    "\204\213\0\1\2\241\206\377\213\0\202\377\215\0\1\7\342\200\377\0"
+    "\306\212\0\0\310\200\377\1\341\6\216\0\201\377\337\0\0\262\200\377"
+    "\0N\233\0\202\377\211\0\202\377\202\0\202\377\207\0\0\37\201\377\0"
+    "O\200\0\0\217\200\377\0\343\205\0\3\10m\300\355\200\377\4\364\326"
+    "\252o&\202\0\0S\206\377\0O\212\0\0m\207\377\213\0\202\377\215\0\0j"
+    "\201\377\0V\212\0\0V\201\377\0h\210\0\2$\301\61\201\0\201\377\201"
+    "\0\2\61\301$\330\0\4)\376\377\326\1\233\0\202\377\211\0\202\377"
+    "\202\0\202\377\207\0\0]\200\377\1\376\22\200\0\0\315\200\377\0\244"
+    "\204\0\1(\334\210\377\202\0\0\303\200\377\3\256\26\27\262\200\377"
+    "\0\301\212\0\0\320\207\377\213\0\202\377\214\0\1\1\333\200\377\1"
+    "\353\5\212\0\1\6\354\200\377\1\330\1\207\0\5\240\377\375\226\22\0"
+    "\201\377\5\0\22\227\375\377\240\330\0\0\236\200\377\0b\234\0\202"
+    "\377\211\0\202\377\202\0\202\377\207\0\0\233\200\377\0\321\200\0\1"
+    "\16\374\200\377\0d\203\0\1\17\337\211\377\202\0\0\365\200\377\0\26"
+    "\200\0\0\27\200\377\0\364\212\0\0\367\201\377\5|\22\5\37^\302\213"
+    "\0\202\377\214\0\0G\201\377\0\221\214\0\0\223\201\377\0C\207\0\1"
+    "\204\370\200\377\1\354g\201\377\1h\355\200\377\1\370\204\210\0\202"
+    "\377\311\0\4\32\371\377\345\6\234\0\202\377\211\0\202\377\202\0"
+    "\202\377\207\0\0\331\200\377\0\223\200\0\0I\201\377\0$\203\0\0|"
+    "\212\377\202\0\0\365\200\377\0\25\200\0\0\26\200\377\0\364\212\0\0"
+    "\364\201\377\0\13\220\0\202\377\214\0\0\244\201\377\0\77\214\0\0A"
+    "\201\377\0\237\210\0\1 \251\207\377\1\252 \211\0\202\377\311\0\0"
+    "\212\200\377\0v\235\0\202\377\211\0\202\377\202\0\202\377\202\0\0"
+    "\70\217\377\201\0\0\314\201\377\1\257!\200\377\4\12\42K\204\323"
+    "\202\0\0\304\200\377\0\255\200\26\0\255\200\377\0\302\205\0\0\1"
+    "\202\0\0\306\201\377\0X\220\0\202\377\213\0\1\5\362\200\377\1\362"
+    "\3\214\0\1\3\362\200\377\1\357\3\211\0\1\71\307\203\377\1\312;\213"
+    "\0\202\377\310\0\4\17\361\377\360\16\235\0\202\377\211\0\202\377"
+    "\202\0\202\377\202\0\0\70\217\377\201\0\0\362\201\377\1\26\0\200"
+    "\377\207\0\0V\206\377\0Q\203\0\2-\235\270\202\0\0t\201\377\1\337"
+    "\14\217\0\202\377\213\0\0=\201\377\0\277\216\0\0\300\201\377\0\71"
+    "\211\0\1\67\306\203\377\1\311:\213\0\202\377\310\0\0w\200\377\0"
+    "\211\236\0\202\377\211\0\202\377\202\0\202\377\202\0\0\70\217\377"
+    "\201\0\0\372\201\377\1\31\0\200\377\210\0\0\220\204\377\0\210\201"
+    "\0\2\1J\273\200\377\1\321\14\201\0\1\22\367\201\377\0\234\217\0"
+    "\202\377\213\0\0x\201\377\0\211\216\0\0\212\201\377\0u\207\0\2\36"
+    "\245\376\206\377\1\247\36\211\0\202\377\307\0\4\6\346\377\371\31"
+    "\236\0\202\377\234\0\1\1\357\200\377\0z\200\0\0Y\200\377\1\376\23"
+    "\204\0\0\341\201\377\1\254\15\200\377\211\0\5U\304\365\364\302Q"
+    "\200\0\6\12h\330\377\375\263B\202\0\1\12\250\203\377\0K\237\0\0"
+    "\251\201\377\0U\216\0\0U\201\377\0\247\206\0\1\200\367\200\377\1"
+    "\351a\201\377\1a\352\200\377\1\367\200\210\0\202\377\307\0\0c\200"
+    "\377\0\235\237\0\0\373\200\377\0\373\234\0\0,\201\377\0@\200\0\0"
+    "\224\200\377\0\330\205\0\0\237\202\377\0\364\200\377\1J\20\215\0\6"
+    "\32\206\355\377\363\224%\203\0\1\12\305\204\377\1\345\20\236\0\0"
+    "\315\201\377\0\64\216\0\0\65\201\377\0\313\206\0\5\241\377\374\224"
+    "\20\0\201\377\5\0\20\224\374\377\240\210\0\202\377\306\0\4\1\327"
+    "\377\376(\237\0\0\345\200\377\0\345\234\0\0f\200\377\1\373\12\200"
+    "\0\0\316\200\377\0\235\205\0\1-\372\205\377\2\371\250#\211\0\6\63"
+    "\244\372\377\341u\20\205\0\0\237\201\377\0\272\202\377\0\240\200\0"
+    "\0\20\202\377\227\0\0\351\201\377\0\42\216\0\0#\201\377\0\350\206"
+    "\0\2$\301\60\201\0\201\377\201\0\2\61\301$\201\0\220\377\226\0\210"
+    "\377\235\0\0O\200\377\0\261\240\0\0\315\200\377\0\317\234\0\0\241"
+    "\200\377\0\313\200\0\1\14\374\200\377\0c\206\0\1`\374\206\377\1"
+    "\364G\205\0\2\2Q\302\200\377\2\307V\3\206\0\0\66\201\377\2\230\0"
+    "\247\202\377\2K\0\2\201\377\0\370\227\0\0\367\201\377\0\21\216\0\0"
+    "\22\201\377\0\366\214\0\201\377\207\0\220\377\226\0\210\377\235\0"
+    "\0\305\200\377\0;\240\0\0\265\200\377\0\270\234\0\0\333\200\377\0"
+    "\221\200\0\0C\201\377\0)\207\0\1:\310\206\377\1\361\35\202\0\6\15o"
+    "\335\377\373\250\67\201\0\5U\303\364\363\300M\200\0\0\235\201\377"
+    "\3\42\0\23\350\201\377\0\344\200\20\201\377\0\340\227\0\0\376\201"
+    "\377\0\4\216\0\0\4\201\377\0\375\214\0\201\377\207\0\220\377\226\0"
+    "\210\377\234\0\0;\200\377\0\304\241\0\0\235\200\377\0\241\230\0"
+    "\217\377\0\70\206\0\1/z\205\377\0\217\201\0\5\6\352\377\356\211\34"
+    "\202\0\0\217\204\377\2\204\0\334\201\377\0\4\200\0\0P\202\377\1"
+    "\237E\201\377\0\261\227\0\0\367\201\377\0\21\216\0\0\22\201\377\0"
+    "\365\230\0\220\377\226\0\210\377\234\0\0\262\200\377\0N\241\0\0"
+    "\204\200\377\0\213\230\0\217\377\0\70\210\0\200\377\1\65\305\201"
+    "\377\0\326\202\0\2\215j\13\203\0\0U\206\377\1O\371\201\377\0\24"
+    "\201\0\0\244\202\377\0\326\201\377\0c\227\0\0\351\201\377\0#\216\0"
+    "\0$\201\377\0\347\237\0\202\377\235\0\210\377\233\0\4)\376\377\326"
+    "\1\277\0\217\377\0\70\210\0\200\377\1\0\37\201\377\0\365\212\0\0"
+    "\304\200\377\3\255\25\31\265\200\377\1\301\371\201\377\0]\201\0\1"
+    "\22\346\204\377\1\345\12\227\0\0\315\201\377\0\65\216\0\0\66\201"
+    "\377\0\313\237\0\202\377\304\0\0\236\200\377\0b\303\0\0\352\200"
+    "\377\0\201\200\0\0S\201\377\0\31\214\0\200\377\1\0\27\201\377\0"
+    "\365\212\0\0\365\200\377\0\26\200\0\0\30\200\377\1\364\332\201\377"
+    "\1\341\25\201\0\0M\203\377\1\376M\230\0\0\250\201\377\0W\216\0\0X"
+    "\201\377\0\247\237\0\202\377\214\0\203\377\237\0\203\377\212\0\4"
+    "\32\371\377\345\6\302\0\0)\201\377\0C\200\0\0\221\200\377\0\333"
+    "\207\0\5\336\234e\70\27\6\200\377\1\42\264\201\377\0\321\212\0\0"
+    "\365\200\377\0\25\200\0\0\26\200\377\1\364\226\202\377\5\333P\14\6"
+    "F\355\202\377\0\257\231\0\0x\201\377\0\214\216\0\0\215\201\377\0v"
+    "\237\0\202\377\214\0\203\377\237\0\203\377\212\0\0\212\200\377\0v"
+    "\243\0\202\377\232\0\0g\200\377\1\372\12\200\0\0\317\200\377\0\235"
+    "\207\0\213\377\0~\212\0\0\304\200\377\3\253\24\27\260\200\377\2"
+    "\302(\373\213\377\1\370 \230\0\0<\201\377\0\300\216\0\0\301\201"
+    "\377\0:\237\0\202\377\214\0\203\377\237\0\203\377\211\0\4\17\361"
+    "\377\360\16\243\0\202\377\232\0\0\245\200\377\0\307\200\0\1\17\375"
+    "\200\377\0_\207\0\212\377\1\336\17\212\0\0W\206\377\2P\0t\214\377"
+    "\0\244\230\0\1\4\361\200\377\1\363\4\214\0\1\4\363\200\377\1\361\4"
+    "\237\0\202\377\214\0\203\377\237\0\203\377\211\0\0w\200\377\0\211"
+    "\244\0\202\377\232\0\0\342\200\377\0\211\200\0\0K\201\377\0!\207\0"
+    "\211\377\1\333&\214\0\0\223\204\377\0\207\201\0\1i\370\205\377\1"
+    "\356\262\201\377\1\376\61\230\0\0\243\201\377\0A\214\0\0C\201\377"
+    "\0\241\240\0\202\377\213\0\0 \202\377\0\277\237\0\203\377\210\0\4"
+    "\6\346\377\371\31\244\0\202\377\231\0\0!\201\377\0K\200\0\0\211"
+    "\200\377\0\343\210\0\5!c\231\305\345\370\200\377\3\360\304p\11\216"
+    "\0\5W\304\365\364\302P\203\0\12\33\206\314\357\372\346\266h\16\4"
+    "\320\201\377\0\272\230\0\0F\201\377\0\223\214\0\0\225\201\377\0E"
+    "\261\0\0w\201\377\1\362\37\237\0\203\377\210\0\0c\200\377\0\235"
+    "\336\0\0\4\200\377\0\3\305\0\1\1\332\200\377\1\354\6\212\0\1\6\355"
+    "\200\377\1\331\1\261\0\0\316\201\377\0c\256\0\4\1\327\377\376(\336"
+    "\0\0\3\200\377\0\2\306\0\0i\201\377\0W\212\0\0X\201\377\0h\261\0\0"
+    "&\201\377\0\264\257\0\0O\200\377\0\261\337\0\0\2\200\377\0\1\306\0"
+    "\1\6\342\200\377\0\307\212\0\0\310\200\377\1\341\6\261\0\0}\200"
+    "\377\1\354\30\257\0\0\305\200\377\0;\337\0\0\1\200\377\310\0\0`"
+    "\201\377\0>\210\0\0\77\201\377\0_\262\0\0\324\200\377\0W\377\0\225"
+    "\0\200\377\310\0\1\1\311\200\377\0\277\210\0\0\300\200\377\1\311\1"
+    "\377\0\377\0\377\0\377\0\377\0\377\0\377\0\377\0\377\0\377\0\377\0"
+    "\377\0\377\0\377\0\377\0\377\0\377\0\377\0\377\0\377\0\377\0\377\0"
+    "\230\0\10\5g\277\356\374\355\277f\4\206\0\5\30Iz\253\335\376\202"
+    "\377\207\0\12!c\230\305\345\367\372\353\307\213+\206\0\12$k\243"
+    "\317\356\373\365\337\261c\11\214\0\1\11\335\202\377\205\0\213\377"
+    "\207\0\11\5X\250\332\365\374\354\304\205/\203\0\215\377\205\0\10"
+    "\15s\302\355\373\355\302r\15\210\0\10)\226\330\367\373\346\267b\5"
+    "\350\0\10\77\231\324\365\372\352\300v\22\206\0\1\33\317\205\377\1"
+    "\315\31\205\0\210\377\207\0\210\377\2\376\230\11\204\0\210\377\1"
+    "\341\71\213\0\0\206\203\377\205\0\213\377\206\0\1\77\335\207\377"
+    "\203\0\215\377\204\0\1/\340\205\377\1\336-\206\0\1r\373\205\377\1"
+    "\324#\345\0\1G\322\206\377\1\353E\204\0\1\11\322\207\377\1\317\7"
+    "\204\0\210\377\207\0\212\377\1\272\2\203\0\211\377\1\364%\211\0\1)"
+    "\372\203\377\205\0\213\377\205\0\1Q\373\210\377\203\0\215\377\203"
+    "\0\1\24\347\207\377\1\345\22\204\0\0\134\210\377\1\337\21\344\0"
+    "\211\377\1\367*\203\0\0}\211\377\0y\204\0\210\377\207\0\213\377\0e"
+    "\203\0\212\377\0\245\211\0\0\300\204\377\205\0\213\377\204\0\1$"
+    "\364\211\377\203\0\214\377\0\341\203\0\0\207\211\377\0\205\203\0\1"
+    "\16\357\211\377\0\221\344\0\212\377\0\246\202\0\1\6\354\202\377\2j"
+    "\14l\202\377\1\352\5\203\0\4\346\263\200M\32\203\377\207\0\10\334"
+    "\227_\62\21\4\27j\364\202\377\0\305\203\0\7\330\213N!\10\7\70\306"
+    "\202\377\0\350\210\0\0`\205\377\205\0\202\377\215\0\0\253\202\377"
+    "\7\361v$\6\14\62t\316\214\0\0\330\202\377\0\201\203\0\0\325\201"
+    "\377\4\316/\5/\316\201\377\0\323\203\0\0j\202\377\4\356E\7C\356"
+    "\201\377\1\365\14\343\0\7\377\367\232C\20\3&\257\202\377\0\347\202"
+    "\0\0I\202\377\0\272\201\0\0\276\202\377\0F\210\0\203\377\217\0\0a"
+    "\202\377\0\363\212\0\0\35\202\377\0\370\207\0\1\22\353\205\377\205"
+    "\0\202\377\214\0\1\33\375\201\377\1\366\60\222\0\0<\202\377\1\376 "
+    "\203\0\0\366\201\377\0.\201\0\0.\201\377\0\365\203\0\0\261\202\377"
+    "\0m\201\0\0m\202\377\0T\264\0\2\11a\313\224\0\2\312`\10\221\0\1"
+    "\252\33\203\0\0\23\202\377\0\372\202\0\0\210\202\377\0h\201\0\0k"
+    "\202\377\0\207\210\0\203\377\217\0\0\17\202\377\0\357\212\0\0\26"
+    "\202\377\0\322\207\0\0\234\200\377\0\345\203\377\205\0\202\377\214"
+    "\0\0i\202\377\0\211\223\0\0\237\202\377\0\275\204\0\0\370\201\377"
+    "\0\4\201\0\0\5\201\377\0\370\203\0\0\341\202\377\0\42\201\0\0\42"
+    "\202\377\0\221\207\0\203\377\214\0\203\377\221\0\2$\215\355\200"
+    "\377\224\0\200\377\2\355\214$\226\0\0\34\202\377\0\331\202\0\0\270"
+    "\202\377\0\71\201\0\0<\202\377\0\266\210\0\203\377\217\0\0\14\202"
+    "\377\0\270\210\0\2\6\63\275\202\377\0`\206\0\1;\376\200\377\0Y\203"
+    "\377\205\0\202\377\214\0\0\245\202\377\7\67T\305\365\371\327\205"
+    "\17\213\0\1\15\364\202\377\0[\204\0\0\324\201\377\0/\201\0\0\60"
+    "\201\377\0\323\203\0\0\364\202\377\0\5\201\0\0\6\202\377\0\274\207"
+    "\0\203\377\214\0\203\377\216\0\3\3O\271\376\202\377\224\0\202\377"
+    "\3\376\270N\3\222\0\1\1\245\202\377\0t\202\0\0\331\202\377\0\35"
+    "\201\0\0\36\202\377\0\327\210\0\203\377\217\0\0P\202\377\0`\206\0"
+    "\205\377\1\373w\206\0\1\5\323\200\377\1\276\0\203\377\205\0\202"
+    "\377\6\271\356\375\357\305w\20\205\0\0\317\202\377\0\210\204\377\1"
+    "\334\34\212\0\0e\202\377\1\357\10\204\0\0\177\201\377\4\315.\4."
+    "\316\201\377\0\177\203\0\0\374\202\377\0\5\201\0\0\6\202\377\0\333"
+    "\207\0\203\377\214\0\203\377\214\0\2\27{\341\205\377\201\0\216\377"
+    "\201\0\205\377\2\341z\26\217\0\1\1\226\202\377\1\270\3\202\0\0\357"
+    "\202\377\4\13R\351\350^\202\377\0\355\210\0\203\377\216\0\1\5\321"
+    "\201\377\1\334\6\206\0\203\377\2\312\203!\207\0\0w\200\377\2\372*"
+    "\0\203\377\205\0\210\377\1\353I\204\0\0\352\202\377\0\375\205\377"
+    "\0\276\212\0\0\310\202\377\0\226\205\0\1\14\324\207\377\1\326\14"
+    "\203\0\0\360\202\377\0\42\201\0\0\42\202\377\0\357\207\0\203\377"
+    "\214\0\203\377\212\0\2=\247\371\204\377\2\351\215,\201\0\216\377"
+    "\201\0\2-\216\351\204\377\2\371\246<\214\0\1\1\231\202\377\1\267"
+    "\11\203\0\0\373\202\377\1\2\351\200\377\0\355\202\377\0\372\210\0"
+    "\203\377\216\0\0\224\201\377\1\374>\207\0\203\377\3\366\275_\3\205"
+    "\0\1\37\365\200\377\0\213\200\0\203\377\205\0\211\377\1\373J\203\0"
+    "\0\371\213\377\0C\210\0\0+\203\377\0\64\206\0\1\22\240\205\377\1"
+    "\253\25\204\0\0\321\202\377\0l\201\0\0m\202\377\0\372\207\0\203"
+    "\377\214\0\203\377\207\0\2\14i\322\204\377\3\372\257O\4\203\0\216"
+    "\377\203\0\3\4O\260\372\204\377\2\322h\14\211\0\0\210\202\377\1"
+    "\227\4\204\0\203\377\1\0\353\200\377\0\352\202\377\0\376\210\0\203"
+    "\377\215\0\0x\202\377\0s\210\0\206\377\1\320!\204\0\0\262\200\377"
+    "\1\344\14\200\0\203\377\205\0\212\377\1\354\21\202\0\0\376\202\377"
+    "\4\355C\7E\360\202\377\0\233\210\0\0\216\202\377\0\321\207\0\1e"
+    "\343\205\377\1\350j\204\0\0\234\202\377\4\356D\6B\355\202\377\0"
+    "\376\207\0\203\377\214\0\203\377\206\0\1\225\362\204\377\2\321q\25"
+    "\206\0\216\377\206\0\2\25q\322\204\377\1\361\224\207\0\0=\202\377"
+    "\0t\206\0\0\373\202\377\4\2T\352\351V\202\377\0\372\210\0\203\377"
+    "\214\0\0o\202\377\0\214\213\0\2\10\65\252\202\377\1\334\17\202\0\0"
+    "Q\201\377\0W\201\0\203\377\205\0\7\321z;\24\4\21H\300\203\377\0x"
+    "\202\0\0\373\202\377\0m\201\0\0p\202\377\0\320\207\0\1\6\353\202"
+    "\377\0o\206\0\0\221\211\377\0\223\203\0\0F\213\377\0\370\247\0\203"
+    "\377\2\355\223\62\244\0\2\63\223\355\203\377\207\0\0\253\201\377\0"
+    "\227\207\0\0\357\202\377\0\13\201\0\0\15\202\377\0\355\210\0\203"
+    "\377\213\0\0j\202\377\0\227\217\0\0\246\202\377\0\177\202\0\0\342"
+    "\200\377\0\274\202\0\203\377\214\0\1\2\256\202\377\0\306\202\0\0"
+    "\361\202\377\0\42\201\0\0#\202\377\0\356\207\0\0T\202\377\1\371\23"
+    "\205\0\0I\201\377\6\372|\35\5\36~\372\201\377\0I\203\0\0\302\212"
+    "\377\0\350\247\0\202\377\1\231\10\250\0\1\11\232\202\377\207\0\0"
+    "\346\201\377\0(\207\0\0\331\202\377\0\35\201\0\0\36\202\377\0\330"
+    "\210\0\203\377\212\0\1h\376\201\377\1\234\1\217\0\0.\202\377\0\321"
+    "\202\0\216\377\212\0\0)\202\377\0\360\202\0\0\335\202\377\0\5\201"
+    "\0\0\6\202\377\0\373\207\0\0\267\202\377\0\253\206\0\0\267\201\377"
+    "\0k\203\0\0m\201\377\0\266\203\0\1\36\336\204\377\0\222\202\377\0"
+    "\315\247\0\203\377\2\342\205&\244\0\2&\205\342\203\377\207\0\0\373"
+    "\201\377\0\10\207\0\0\270\202\377\0\71\201\0\0<\202\377\0\266\210"
+    "\0\203\377\211\0\1f\376\201\377\1\236\1\220\0\0\6\202\377\0\365"
+    "\202\0\216\377\212\0\0\6\202\377\0\374\202\0\0\277\202\377\0\5\201"
+    "\0\0\6\202\377\0\363\206\0\1\35\375\202\377\0H\206\0\0\356\201\377"
+    "\0\17\203\0\0\17\201\377\0\355\204\0\7\20\207\331\372\366\306X\65"
+    "\202\377\0\242\247\0\1\231\364\204\377\2\305f\17\206\0\216\377\206"
+    "\0\2\17f\306\204\377\1\364\231\207\0\202\377\210\0\0\211\202\377\0"
+    "g\201\0\0k\202\377\0\207\210\0\203\377\210\0\1e\376\201\377\1\235"
+    "\2\221\0\0\31\202\377\0\372\202\0\216\377\212\0\0'\202\377\0\356"
+    "\202\0\0\223\202\377\0\42\201\0\0#\202\377\0\337\206\0\0}\202\377"
+    "\1\343\2\206\0\0\373\201\377\0\17\203\0\0\20\201\377\0\372\213\0\0"
+    "\207\202\377\0g\250\0\2\16m\325\204\377\3\366\246F\2\203\0\216\377"
+    "\203\0\3\2G\246\366\204\377\2\325m\16\210\0\202\377\210\0\0I\202"
+    "\377\0\270\201\0\0\274\202\377\0G\210\0\203\377\207\0\1d\376\201"
+    "\377\1\234\1\222\0\0\202\202\377\0\336\202\0\216\377\211\0\1\1\246"
+    "\202\377\0\301\202\0\0W\202\377\0l\201\0\0p\202\377\0\256\205\0\1"
+    "\1\336\202\377\0\204\207\0\0\350\201\377\0l\203\0\0q\201\377\0\347"
+    "\212\0\1-\365\201\377\1\374\31\207\0\203\377\214\0\203\377\212\0\2"
+    "@\252\372\204\377\2\344\207'\201\0\216\377\201\0\2'\207\344\204"
+    "\377\2\372\252@\231\0\1\6\354\202\377\2i\13j\202\377\1\353\5\210\0"
+    "\203\377\206\0\1b\376\201\377\1\233\1\212\0\11\331\217W/\23\6\4'"
+    "\217\376\202\377\0\242\212\0\203\377\204\0\10\323\202F\36\10\4\27M"
+    "\274\203\377\0m\202\0\1\17\367\201\377\4\355B\6E\357\202\377\0h"
+    "\205\0\0C\202\377\1\376#\207\0\0\264\201\377\6\372{\34\4\36\200"
+    "\373\201\377\0\263\203\0\7\314p.\13\5#t\360\202\377\0\250\210\0"
+    "\203\377\214\0\203\377\214\0\2\30~\343\205\377\201\0\216\377\201\0"
+    "\205\377\2\343}\30\234\0\0~\211\377\0{\204\0\215\377\201\0\0\376"
+    "\214\377\0\10\201\0\214\377\0\71\212\0\203\377\204\0\213\377\1\337"
+    "\12\203\0\0\226\211\377\1\355\15\205\0\0\246\202\377\0\277\210\0\0"
+    "W\213\377\0V\203\0\211\377\1\363!\210\0\203\377\214\0\203\377\216"
+    "\0\3\3Q\273\376\202\377\224\0\202\377\3\376\273Q\3\217\0\202\377"
+    "\211\0\1\11\323\207\377\1\322\10\204\0\215\377\201\0\215\377\0\10"
+    "\201\0\213\377\0\214\213\0\203\377\204\0\212\377\1\356\61\204\0\1"
+    "\23\342\210\377\0X\205\0\1\21\367\202\377\0]\210\0\1\1\270\211\377"
+    "\1\267\1\203\0\210\377\1\372N\211\0\203\377\214\0\203\377\221\0\2%"
+    "\216\356\200\377\224\0\200\377\2\356\216%\222\0\202\377\212\0\1\33"
+    "\317\205\377\1\317\33\205\0\215\377\201\0\215\377\0\10\201\0\211"
+    "\377\1\366s\214\0\203\377\204\0\211\377\1\304%\206\0\1%\327\205"
+    "\377\1\373o\206\0\0l\202\377\1\361\11\211\0\1\14\252\207\377\1\251"
+    "\14\204\0\207\377\1\335>\212\0\203\377\213\0\0\20\202\377\0\317"
+    "\223\0\2\11b\313\224\0\2\313b\11\224\0\202\377\213\0\10\5g\300\357"
+    "\375\357\300g\5\206\0\215\377\201\0\215\377\0\10\201\0\13#g\235"
+    "\307\344\366\375\364\341\264r\26\215\0\203\377\204\0\12#h\236\312"
+    "\351\371\375\360\317\227A\211\0\10\6d\270\350\374\370\331\226)\207"
+    "\0\0\317\202\377\0\231\214\0\10;\232\323\361\374\361\323\232;\206"
+    "\0\11/\204\305\355\375\366\333\251X\5\213\0\203\377\213\0\0<\202"
+    "\377\0M\305\0\202\377\377\0\334\0\0g\201\377\0\312\377\0\377\0\247"
+    "\0\0\223\201\377\0G\377\0\377\0\247\0\0\277\200\377\0\304\377\0"
+    "\377\0\250\0\0\352\200\377\0A\377\0\377\0\377\0\377\0\377\0\377\0"
+    "\377\0\377\0\377\0\377\0\377\0\377\0\377\0\377\0\377\0\377\0\377\0"
+    "\377\0\377\0\377\0\377\0\377\0\377\0\377\0\264\0\1\1\351\202\377\1"
+    "\351\1\205\0\205\377\5\375\361\331\252Z\6\211\0\3)\204\302\350\200"
+    "\372\3\351\303\207\61\202\0\203\377\5\375\365\340\273\204\65\207\0"
+    "\215\377\202\0\215\377\206\0\10:\223\315\357\374\361\304q\15\203\0"
+    "\203\377\203\0\203\377\202\0\215\377\205\0\211\377\203\0\203\377"
+    "\204\0\1\65\370\201\377\1\351\36\201\0\203\377\211\0\203\377\0\213"
+    "\202\0\0\224\203\377\202\0\203\377\0\341\203\0\203\377\204\0\2<"
+    "\242\336\200\371\2\336\241;\212\0\10${\304\342\371\355\311~\23\210"
+    "\0\0\60\204\377\0/\205\0\212\377\1\331.\206\0\2\22\245\376\207\377"
+    "\202\0\211\377\1\306\61\205\0\215\377\202\0\215\377\204\0\1\36\272"
+    "\206\377\1\354X\202\0\203\377\203\0\203\377\202\0\215\377\205\0"
+    "\211\377\203\0\203\377\203\0\1\26\343\201\377\1\372=\202\0\203\377"
+    "\211\0\203\377\0\313\202\0\0\323\203\377\202\0\204\377\0\66\202\0"
+    "\203\377\202\0\1\5\235\206\377\1\233\4\206\0\2\14\221\375\205\377"
+    "\1\360K\207\0\0u\204\377\0t\205\0\213\377\1\353\26\204\0\1\36\335"
+    "\211\377\202\0\212\377\1\371O\204\0\215\377\202\0\215\377\203\0\1*"
+    "\351\211\377\202\0\203\377\203\0\203\377\202\0\215\377\205\0\211"
+    "\377\203\0\203\377\202\0\1\4\277\202\377\0h\203\0\203\377\211\0"
+    "\203\377\1\374\16\200\0\1\23\376\203\377\202\0\204\377\0\212\202\0"
+    "\203\377\202\0\0\245\210\377\0\241\205\0\1\26\325\210\377\1\374C"
+    "\206\0\0\272\204\377\0\271\205\0\214\377\0\216\203\0\1\10\322\212"
+    "\377\202\0\213\377\1\366(\203\0\215\377\202\0\215\377\202\0\1\15"
+    "\335\212\377\202\0\203\377\203\0\203\377\202\0\215\377\205\0\211"
+    "\377\203\0\203\377\202\0\0\217\202\377\0\230\204\0\203\377\211\0"
+    "\204\377\0K\200\0\0Q\204\377\202\0\204\377\0\335\202\0\203\377\201"
+    "\0\0U\212\377\0P\203\0\1\20\323\201\377\6\275T\35\6\33f\347\200"
+    "\377\1\345\10\204\0\1\10\367\200\377\200\364\200\377\1\366\10\204"
+    "\0\203\377\200\0\2\2&\273\202\377\0\330\203\0\0}\203\377\7\305L\23"
+    "\10(u\344\377\202\0\203\377\4\0\7)\203\370\202\377\0\264\203\0\203"
+    "\377\214\0\203\377\214\0\0\211\203\377\7\265A\17\7\65\233\376\377"
+    "\202\0\203\377\203\0\203\377\207\0\203\377\220\0\203\377\203\0\203"
+    "\377\201\0\0[\202\377\1\302\5\204\0\203\377\211\0\204\377\0\213"
+    "\200\0\0\220\204\377\202\0\205\377\0\62\201\0\203\377\201\0\0\324"
+    "\202\377\0\240\200\27\0\241\202\377\0\321\203\0\0\235\200\377\1"
+    "\375j\204\0\1\37\353\200\377\0c\204\0\0E\201\377\1\276\277\201\377"
+    "\0D\204\0\203\377\202\0\0%\202\377\0\366\202\0\1\11\356\202\377\1"
+    "\254\2\203\0\1\13\234\202\0\203\377\202\0\0N\202\377\1\376!\202\0"
+    "\203\377\214\0\203\377\213\0\1\15\363\202\377\0\226\204\0\1J\367"
+    "\202\0\203\377\203\0\203\377\207\0\203\377\220\0\203\377\203\0\203"
+    "\377\200\0\1\60\366\201\377\1\342\26\205\0\203\377\211\0\202\377\2"
+    "\350\377\312\200\0\2\317\377\350\202\377\202\0\205\377\0\206\201\0"
+    "\203\377\200\0\0\64\202\377\1\332\4\200\0\1\4\333\202\377\0\61\201"
+    "\0\0\77\201\377\0l\206\0\0p\200\377\0\256\204\0\0\212\201\377\1"
+    "\204\205\201\377\0\211\204\0\203\377\202\0\0\4\202\377\0\364\202\0"
+    "\0T\202\377\1\355\20\212\0\203\377\203\0\0\267\202\377\0o\202\0"
+    "\203\377\214\0\203\377\213\0\0Y\202\377\1\344\10\205\0\0]\202\0"
+    "\203\377\203\0\203\377\207\0\203\377\220\0\203\377\203\0\203\377\2"
+    "\0\22\336\201\377\1\366\62\206\0\203\377\211\0\202\377\7\257\377"
+    "\374\15\20\375\377\260\202\377\202\0\205\377\0\331\201\0\203\377"
+    "\200\0\0{\202\377\0|\202\0\0}\202\377\0y\201\0\0\263\200\377\0\270"
+    "\207\0\0$\200\377\0\340\204\0\0\317\201\377\1JK\201\377\0\316\204"
+    "\0\203\377\202\0\0!\202\377\0\312\202\0\0\227\202\377\0\221\213\0"
+    "\203\377\203\0\0e\202\377\0\250\202\0\203\377\214\0\203\377\213\0"
+    "\0\232\202\377\0\207\213\0\203\377\203\0\203\377\207\0\203\377\220"
+    "\0\203\377\203\0\203\377\1\2\271\202\377\0X\207\0\203\377\211\0"
+    "\202\377\0v\200\377\1JM\200\377\0y\202\377\202\0\203\377\0\314\200"
+    "\377\0.\200\0\203\377\200\0\0\260\202\377\0D\202\0\0F\202\377\0"
+    "\255\200\0\1\33\374\200\377\0+\201\0\6\32\223\335\370\350\235\37"
+    "\200\377\0\365\203\0\1\25\376\200\377\3\376\21\22\376\200\377\1"
+    "\376\25\203\0\203\377\200\0\2\1\42\263\202\377\0g\202\0\0\307\202"
+    "\377\0J\213\0\203\377\203\0\0\63\202\377\0\320\202\0\203\377\214\0"
+    "\203\377\213\0\0\311\202\377\0E\213\0\203\377\203\0\203\377\207\0"
+    "\203\377\220\0\203\377\203\0\203\377\0\207\202\377\0\210\210\0\203"
+    "\377\211\0\202\377\0>\200\377\1\212\214\200\377\0A\202\377\202\0"
+    "\203\377\0x\200\377\0\202\200\0\203\377\200\0\0\324\202\377\0\42"
+    "\202\0\0#\202\377\0\322\200\0\0d\200\377\0\307\201\0\1\65\355\203"
+    "\377\0\334\201\377\203\0\0Z\201\377\0\326\200\0\0\327\201\377\0Y"
+    "\203\0\213\377\1\243\1\202\0\0\347\202\377\0 \213\0\203\377\203\0"
+    "\0\26\202\377\0\352\202\0\214\377\203\0\214\377\202\0\0\350\202"
+    "\377\0\36\213\0\215\377\207\0\203\377\220\0\203\377\203\0\210\377"
+    "\0Q\210\0\203\377\211\0\202\377\7\12\373\377\312\313\377\375\14"
+    "\202\377\202\0\203\377\0$\200\377\0\326\200\0\203\377\200\0\0\354"
+    "\202\377\0\15\202\0\0\17\202\377\0\352\200\0\0\232\200\377\0w\200"
+    "\0\1\17\344\210\377\203\0\0\237\201\377\0\234\200\0\0\235\201\377"
+    "\0\236\203\0\210\377\2\343\254N\204\0\0\370\202\377\0\14\213\0\203"
+    "\377\203\0\0\6\202\377\0\370\202\0\214\377\203\0\214\377\202\0\0"
+    "\371\202\377\0\12\201\0\205\377\201\0\215\377\207\0\203\377\220\0"
+    "\203\377\203\0\210\377\1\330\4\207\0\203\377\211\0\202\377\2\0\314"
+    "\377\200\374\2\377\322\0\202\377\202\0\203\377\1\0\320\200\377\1*"
+    "\0\203\377\200\0\0\372\202\377\0\3\202\0\0\4\202\377\0\370\200\0\0"
+    "\314\200\377\0D\200\0\0u\200\377\5\370o\27\31q\371\201\377\203\0\0"
+    "\344\201\377\0b\200\0\0c\201\377\0\343\203\0\210\377\3\372\323\207"
+    "\32\203\0\0\376\202\377\0\3\213\0\203\377\203\0\0\1\202\377\0\376"
+    "\202\0\214\377\203\0\214\377\202\0\0\376\202\377\0\2\201\0\205\377"
+    "\201\0\215\377\207\0\203\377\220\0\203\377\203\0\211\377\0i\207\0"
+    "\203\377\211\0\202\377\1\0\223\202\377\1\232\0\202\377\202\0\203"
+    "\377\1\0|\200\377\1~\0\203\377\200\0\203\377\203\0\0\1\202\377\0"
+    "\376\200\0\0\342\200\377\0\35\200\0\0\305\200\377\0}\202\0\0\201"
+    "\201\377\202\0\0)\202\377\0(\200\0\0)\202\377\0(\202\0\213\377\1"
+    "\363M\202\0\0\370\202\377\0\14\213\0\203\377\203\0\0\6\202\377\0"
+    "\370\202\0\214\377\203\0\214\377\202\0\0\371\202\377\0\13\201\0"
+    "\205\377\201\0\215\377\207\0\203\377\220\0\203\377\203\0\204\377\1"
+    "\372\366\201\377\1\350\14\206\0\203\377\211\0\202\377\1\0Z\202\377"
+    "\1b\0\202\377\202\0\203\377\1\0'\200\377\1\322\0\203\377\200\0\0"
+    "\372\202\377\0\3\202\0\0\4\202\377\0\371\200\0\0\362\200\377\0\15"
+    "\200\0\0\356\200\377\0\42\202\0\0#\201\377\202\0\0o\212\377\0n\202"
+    "\0\203\377\200\0\3\2\25Y\350\201\377\1\366(\201\0\0\347\202\377\0 "
+    "\213\0\203\377\203\0\0\26\202\377\0\352\202\0\203\377\214\0\203"
+    "\377\213\0\0\350\202\377\0\37\201\0\205\377\201\0\203\377\203\0"
+    "\203\377\207\0\203\377\220\0\203\377\203\0\204\377\1k\207\202\377"
+    "\0\201\206\0\203\377\211\0\202\377\1\0!\202\377\1+\0\202\377\202\0"
+    "\203\377\200\0\0\323\200\377\0%\203\377\200\0\0\355\202\377\0\15"
+    "\202\0\0\17\202\377\0\353\200\0\0\373\200\377\0\3\200\0\0\373\200"
+    "\377\0\10\202\0\0\11\201\377\202\0\0\264\212\377\0\263\202\0\203"
+    "\377\203\0\0N\202\377\0\234\201\0\0\307\202\377\0J\213\0\203\377"
+    "\203\0\0\64\202\377\0\320\202\0\203\377\214\0\203\377\213\0\0\310"
+    "\202\377\0G\204\0\202\377\201\0\203\377\203\0\203\377\207\0\203"
+    "\377\220\0\203\377\203\0\203\377\3\240\0\17\355\201\377\1\364\30"
+    "\205\0\203\377\211\0\202\377\200\0\0\350\200\377\2\361\2\0\202\377"
+    "\202\0\203\377\200\0\0\177\200\377\0z\203\377\200\0\0\325\202\377"
+    "\0\42\202\0\0#\202\377\0\323\200\0\0\355\200\377\0\21\200\0\0\355"
+    "\200\377\0\42\202\0\0#\201\377\201\0\1\5\363\212\377\1\363\5\201\0"
+    "\203\377\203\0\0\15\202\377\0\337\201\0\0\227\202\377\0\221\213\0"
+    "\203\377\203\0\0f\202\377\0\247\202\0\203\377\214\0\203\377\213\0"
+    "\0\230\202\377\0\213\204\0\202\377\201\0\203\377\203\0\203\377\207"
+    "\0\203\377\217\0\0\5\202\377\0\374\203\0\203\377\0\10\200\0\0t\202"
+    "\377\0\231\205\0\203\377\211\0\202\377\206\0\202\377\202\0\203\377"
+    "\200\0\0+\200\377\0\316\203\377\200\0\0\260\202\377\0D\202\0\0E"
+    "\202\377\0\256\200\0\0\334\200\377\0#\200\0\0\302\200\377\0|\202\0"
+    "\0\177\201\377\201\0\0>\214\377\0=\201\0\203\377\203\0\0\10\202"
+    "\377\0\371\201\0\0T\202\377\1\355\20\212\0\203\377\203\0\0\270\202"
+    "\377\0m\202\0\203\377\214\0\203\377\213\0\0U\202\377\1\347\11\203"
+    "\0\202\377\201\0\203\377\203\0\203\377\207\0\203\377\207\0\0z\205"
+    "\0\0#\202\377\0\357\203\0\203\377\201\0\1\10\342\201\377\1\374("
+    "\204\0\203\377\211\0\202\377\206\0\202\377\202\0\203\377\201\0\0"
+    "\327\205\377\200\0\0{\202\377\0{\202\0\0|\202\377\0z\200\0\0\302"
+    "\200\377\0Q\200\0\0s\200\377\5\367l\26\27o\370\201\377\201\0\0\203"
+    "\201\377\1\357\2\202\0\1\4\363\201\377\0\202\201\0\203\377\203\0\0"
+    ">\202\377\0\366\201\0\1\11\356\202\377\1\253\2\203\0\1\13\233\202"
+    "\0\203\377\202\0\0M\202\377\1\376\37\202\0\203\377\214\0\203\377"
+    "\213\0\1\13\360\202\377\0\226\203\0\202\377\201\0\203\377\203\0"
+    "\203\377\207\0\203\377\207\0\2\377\224\10\203\0\0z\202\377\0\320"
+    "\203\0\203\377\202\0\0a\202\377\0\261\204\0\203\377\211\0\202\377"
+    "\206\0\202\377\202\0\203\377\201\0\0\203\205\377\200\0\0\65\202"
+    "\377\1\331\3\200\0\1\3\331\202\377\0\62\200\0\0\212\200\377\0\212"
+    "\200\0\1\16\342\210\377\201\0\0\311\201\377\0\263\204\0\0\271\201"
+    "\377\0\310\201\0\203\377\200\0\3\1\21K\333\202\377\0\323\202\0\0}"
+    "\203\377\7\305K\22\7't\343\377\202\0\203\377\4\0\7(\202\370\202"
+    "\377\0\261\203\0\203\377\214\0\203\377\214\0\0\204\203\377\4\257"
+    "\70\12\11F\202\377\201\0\203\377\203\0\203\377\207\0\203\377\207\0"
+    "\200\377\6\337n!\4\26m\370\202\377\0\232\203\0\203\377\202\0\1\2"
+    "\324\202\377\0=\203\0\203\377\211\0\202\377\206\0\202\377\202\0"
+    "\203\377\201\0\0/\205\377\201\0\0\326\202\377\0\237\200\26\0\237"
+    "\202\377\0\322\201\0\0O\200\377\1\341\2\200\0\1\63\354\203\377\0"
+    "\344\201\377\200\0\1\21\375\201\377\0u\204\0\0z\201\377\1\374\20"
+    "\200\0\215\377\0\210\202\0\1\10\322\212\377\202\0\213\377\1\365&"
+    "\203\0\215\377\202\0\203\377\214\0\1\13\331\213\377\201\0\203\377"
+    "\203\0\203\377\202\0\215\377\202\0\213\377\0D\203\0\203\377\203\0"
+    "\0N\202\377\0\310\203\0\214\377\200\0\202\377\206\0\202\377\202\0"
+    "\203\377\202\0\0\332\204\377\201\0\0W\212\377\0R\201\0\1\13\356"
+    "\200\377\0R\201\0\6\32\223\337\371\354\250\37\201\377\200\0\0S\202"
+    "\377\0\67\204\0\0:\202\377\0R\200\0\214\377\1\347\25\203\0\1\36"
+    "\335\211\377\202\0\212\377\1\370M\204\0\215\377\202\0\203\377\215"
+    "\0\1&\347\211\377\0\366\201\0\203\377\203\0\203\377\202\0\215\377"
+    "\202\0\212\377\0\272\204\0\203\377\204\0\0\304\202\377\0U\202\0"
+    "\214\377\200\0\202\377\206\0\202\377\202\0\203\377\202\0\0\207\204"
+    "\377\202\0\0\250\210\377\0\244\203\0\0\212\200\377\1\343\17\214\0"
+    "\0\230\201\377\1\364\4\204\0\1\5\365\201\377\0\227\200\0\213\377\1"
+    "\323*\205\0\2\23\246\376\207\377\202\0\211\377\1\305/\205\0\215"
+    "\377\202\0\203\377\216\0\1\35\272\207\377\1\305,\201\0\203\377\203"
+    "\0\203\377\202\0\215\377\202\0\1D\311\207\377\1\276\22\204\0\203"
+    "\377\204\0\0;\202\377\1\333\5\201\0\214\377\200\0\202\377\206\0"
+    "\202\377\202\0\203\377\202\0\0\63\204\377\202\0\1\6\241\206\377\1"
+    "\236\5\203\0\1\32\357\200\377\1\267\10\213\0\0\335\201\377\0\273"
+    "\206\0\0\274\201\377\0\335\200\0\206\377\5\371\350\311\227K\2\210"
+    "\0\11)\205\304\352\373\372\351\303\206\60\202\0\203\377\5\376\366"
+    "\340\274\204\65\207\0\215\377\202\0\203\377\220\0\10<\226\322\363"
+    "\375\364\323\230@\203\0\203\377\203\0\203\377\202\0\215\377\204\0"
+    "\11\66\220\316\363\376\364\327\242K\1\205\0\203\377\205\0\0\261"
+    "\202\377\0m\201\0\214\377\200\0\202\377\206\0\202\377\202\0\203"
+    "\377\203\0\0\336\203\377\204\0\2>\244\337\200\372\2\337\243=\206\0"
+    "\0W\201\377\1\301#\377\0\377\0\247\0\0\212\201\377\11\370\233I\35"
+    "\6\11%W\244\264\377\0\377\0\237\0\1y\376\211\377\0e\377\0\377\0"
+    "\237\0\1\67\305\207\377\1\366v\377\0\377\0\241\0\11\67\204\305\340"
+    "\365\367\344\266q\26\377\0\377\0\377\0\377\0\377\0\377\0\377\0\377"
+    "\0\377\0\377\0\377\0\377\0\377\0\377\0\377\0\377\0\377\0\377\0\377"
+    "\0\377\0\377\0\377\0\337\0\205\377\0\310\232\0\206\377\255\0\204"
+    "\377\5\376\366\342\275\201'\207\0\2\70\231\331\200\363\2\331\231"
+    "\70\206\0\205\377\5\372\354\315\233L\2\207\0\12\63\223\315\356\374"
+    "\366\346\310\235g#\202\0\217\377\201\0\203\377\204\0\203\377\200\0"
+    "\0\342\201\377\0\276\205\0\0\276\201\377\2\342\0\360\201\377\0\24"
+    "\207\0\0\32\201\377\1\361\265\201\377\1\363\32\204\0\1\30\362\201"
+    "\377\2\265\0\300\202\377\0\64\205\0\0\65\202\377\0\277\200\0\216"
+    "\377\206\0\205\377\0\310\204\0\0\303\200\377\0\304\220\0\206\377"
+    "\212\0\1\1\270\201\377\1\270\1\232\0\211\377\2\376\227\6\203\0\2\4"
+    "\225\376\204\377\2\376\224\3\204\0\212\377\1\316\37\204\0\1\14\242"
+    "\211\377\202\0\217\377\201\0\203\377\204\0\203\377\200\0\0\246\201"
+    "\377\1\360\1\203\0\1\1\361\201\377\2\246\0\321\201\377\0,\207\0\0-"
+    "\201\377\2\323%\371\201\377\0\244\204\0\0\242\201\377\3\371%\0\77"
+    "\202\377\0\254\205\0\0\257\202\377\0>\200\0\216\377\206\0\205\377"
+    "\0\310\204\0\0H\201\377\0\77\217\0\206\377\212\0\0w\203\377\0v\232"
+    "\0\213\377\0\246\203\0\0\233\210\377\0\232\204\0\213\377\1\331\11"
+    "\202\0\1\4\301\212\377\202\0\217\377\201\0\203\377\204\0\203\377"
+    "\200\0\0j\202\377\0'\203\0\0(\202\377\2j\0\262\201\377\0E\207\0\0@"
+    "\201\377\2\265\0\211\202\377\0:\202\0\1\71\376\201\377\0\212\201\0"
+    "\0\277\201\377\1\375'\203\0\1*\376\201\377\0\276\201\0\216\377\206"
+    "\0\202\377\211\0\0\315\200\377\0\272\223\0\202\377\211\0\1\71\373"
+    "\203\377\1\373\70\231\0\214\377\0\77\201\0\0L\212\377\0J\203\0\214"
+    "\377\0o\202\0\0h\204\377\0\376\204\377\202\0\217\377\201\0\203\377"
+    "\204\0\203\377\200\0\0.\202\377\0\134\203\0\0]\202\377\2.\0\222"
+    "\201\377\0^\207\0\0T\201\377\3\230\0\14\346\201\377\1\314\2\200\0"
+    "\1\2\313\201\377\1\347\15\201\0\0>\202\377\0\236\203\0\0\242\202"
+    "\377\0=\201\0\215\377\0\372\206\0\202\377\211\0\0R\201\377\0\65"
+    "\222\0\202\377\210\0\1\20\340\205\377\1\337\20\230\0\203\377\4\0\1"
+    "\23V\351\202\377\0\236\201\0\0\321\202\377\0\240\200\27\0\241\202"
+    "\377\0\317\203\0\203\377\200\0\2\13B\332\202\377\0\275\202\0\0\307"
+    "\202\377\10\276(\1\3\33S\254\374\377\210\0\203\377\207\0\203\377"
+    "\204\0\203\377\200\0\1\2\357\201\377\0\220\203\0\0\221\201\377\3"
+    "\357\2\0s\201\377\0w\207\0\0g\201\377\0z\200\0\0]\202\377\0d\200\0"
+    "\0d\202\377\0_\203\0\0\276\201\377\1\372\35\201\0\1 \373\201\377\0"
+    "\275\213\0\1\23\347\202\377\0{\206\0\202\377\211\0\1\1\326\200\377"
+    "\0\260\222\0\202\377\210\0\0\255\201\377\2\360e\360\201\377\0\255"
+    "\230\0\203\377\202\0\0X\202\377\0\327\200\0\0,\202\377\1\333\4\200"
+    "\0\1\4\333\202\377\0*\202\0\203\377\202\0\0@\202\377\0\351\202\0\0"
+    "\364\202\377\0\67\204\0\1\42\262\210\0\203\377\207\0\203\377\204\0"
+    "\203\377\201\0\0\266\201\377\0\305\203\0\0\306\201\377\0\266\200\0"
+    "\0S\201\377\0\217\207\0\0z\201\377\0]\200\0\1\1\305\201\377\0\352"
+    "\200\17\0\352\201\377\1\310\1\203\0\0=\202\377\0\220\201\0\0\226"
+    "\202\377\0<\213\0\0\251\202\377\1\304\3\206\0\202\377\212\0\0]\200"
+    "\377\1\376+\221\0\202\377\207\0\0k\201\377\4\360\66\0\66\360\201"
+    "\377\0j\227\0\203\377\202\0\0\24\202\377\0\364\200\0\0y\202\377\0"
+    "\177\202\0\0\200\202\377\0x\202\0\203\377\202\0\0\11\202\377\0\372"
+    "\202\0\0\372\202\377\0Z\220\0\203\377\207\0\203\377\204\0\203\377"
+    "\201\0\0z\201\377\1\366\4\201\0\1\4\366\201\377\0z\200\0\0\64\201"
+    "\377\0\250\200\0\0\203\201\377\0\213\200\0\0\216\201\377\0\77\201"
+    "\0\1\63\375\201\377\1\217\220\201\377\1\376\66\205\0\0\274\201\377"
+    "\4\365\24\0\30\367\201\377\0\273\213\0\0X\202\377\1\362!\207\0\202"
+    "\377\212\0\1\4\336\200\377\0\245\221\0\202\377\206\0\1/\370\200"
+    "\377\1\361\67\201\0\1\67\361\200\377\1\367/\226\0\203\377\202\0\0"
+    "\4\202\377\0\375\200\0\0\250\202\377\0H\202\0\0I\202\377\0\247\202"
+    "\0\203\377\202\0\0\11\202\377\0\360\202\0\0\335\202\377\2\361k\10"
+    "\216\0\203\377\207\0\203\377\204\0\203\377\201\0\0>\202\377\0/\201"
+    "\0\0\60\202\377\0>\200\0\0\24\201\377\0\301\200\0\0\262\201\377\0"
+    "\301\200\0\0\241\201\377\0\42\202\0\0\233\201\377\200\373\201\377"
+    "\0\237\206\0\0<\202\377\2\202\0\211\202\377\0;\212\0\1\30\355\202"
+    "\377\0`\210\0\202\377\213\0\0g\200\377\1\374#\220\0\202\377\205\0"
+    "\1\14\331\200\377\1\362\71\203\0\1\70\361\200\377\1\330\13\225\0"
+    "\203\377\202\0\0\24\202\377\0\364\200\0\0\321\202\377\0$\202\0\0%"
+    "\202\377\0\320\202\0\203\377\202\0\0@\202\377\0\302\202\0\0\220"
+    "\204\377\2\356\222.\214\0\203\377\207\0\203\377\204\0\203\377\201"
+    "\0\1\10\371\201\377\0c\201\0\0d\201\377\1\371\10\201\0\0\364\200"
+    "\377\0\332\200\0\0\341\201\377\3\364\3\0\264\200\377\1\376\6\202\0"
+    "\1\25\357\204\377\1\362\30\207\0\0\273\201\377\2\356\35\362\201"
+    "\377\0\272\213\0\0\263\202\377\0\254\211\0\202\377\213\0\1\7\345"
+    "\200\377\0\233\220\0\202\377\205\0\0\242\200\377\1\363;\205\0\1\71"
+    "\362\200\377\0\241\225\0\203\377\202\0\0W\202\377\0\327\200\0\0"
+    "\350\202\377\0\17\202\0\0\20\202\377\0\347\202\0\203\377\200\0\2"
+    "\12B\332\202\377\0a\202\0\1\26\344\206\377\1\301=\212\0\203\377"
+    "\207\0\203\377\204\0\203\377\202\0\0\306\201\377\0\230\201\0\0\231"
+    "\201\377\0\306\202\0\0\325\200\377\2\363\0\20\203\377\2.\0\310\200"
+    "\377\0\346\204\0\0o\204\377\0t\210\0\0;\202\377\0\331\202\377\0:"
+    "\212\0\0b\202\377\1\345\22\211\0\202\377\214\0\0r\200\377\1\371\33"
+    "\217\0\202\377\255\0\203\377\4\0\1\22U\351\202\377\0\236\200\0\0"
+    "\364\202\377\0\5\202\0\0\7\202\377\0\363\202\0\213\377\1\257\1\203"
+    "\0\1!\305\207\377\1\220\3\210\0\203\377\207\0\203\377\204\0\203"
+    "\377\202\0\0\212\201\377\0\315\201\0\0\316\201\377\0\212\202\0\0"
+    "\266\201\377\1\13>\203\377\2d\0\333\200\377\0\311\204\0\1\4\324"
+    "\202\377\1\331\5\211\0\0\272\205\377\0\271\212\0\1\36\361\201\377"
+    "\1\376E\212\0\202\377\214\0\1\13\354\200\377\0\220\217\0\202\377"
+    "\255\0\214\377\0\77\200\0\0\375\202\377\0\1\202\0\0\2\202\377\0"
+    "\375\202\0\211\377\2\333p\4\205\0\2\1Q\304\206\377\0\227\210\0\203"
+    "\377\207\0\203\377\204\0\203\377\202\0\0N\201\377\4\372\7\0\10\372"
+    "\201\377\0N\202\0\0\226\201\377\1$m\200\377\0\305\200\377\2\233\0"
+    "\356\200\377\0\253\205\0\0\205\202\377\0\214\212\0\0:\205\377\0\71"
+    "\211\0\1\1\274\202\377\0\220\213\0\202\377\215\0\0|\200\377\1\365"
+    "\25\216\0\202\377\255\0\213\377\0\246\201\0\0\364\202\377\0\5\202"
+    "\0\0\7\202\377\0\366\202\0\210\377\1\327\63\212\0\2'\205\345\204"
+    "\377\0\77\207\0\203\377\207\0\203\377\204\0\203\377\202\0\1\23\376"
+    "\201\377\2\66\0\67\201\377\1\376\23\202\0\0w\201\377\1=\234\200"
+    "\377\0Y\200\377\2\321\3\376\200\377\0\216\204\0\1\25\361\202\377\1"
+    "\363\31\212\0\0\271\203\377\0\270\212\0\0l\202\377\1\324\10\213\0"
+    "\202\377\215\0\1\20\361\200\377\0\206\216\0\202\377\255\0\211\377"
+    "\2\376\230\6\201\0\0\350\202\377\0\17\202\0\0\20\202\377\0\351\202"
+    "\0\211\377\1\354\30\213\0\2\3i\372\202\377\0\250\207\0\203\377\207"
+    "\0\203\377\204\0\203\377\203\0\0\326\201\377\2k\0l\201\377\0\326"
+    "\203\0\0W\201\377\10V\312\377\366\6\361\377\374 \201\377\0p\204\0"
+    "\0\231\204\377\0\236\212\0\0\70\203\377\0\70\211\0\1$\365\201\377"
+    "\1\371/\214\0\202\377\216\0\0\207\200\377\1\361\17\215\0\202\377"
+    "\255\0\205\377\4\367\343\276\202(\203\0\0\321\202\377\0$\202\0\0%"
+    "\202\377\0\316\202\0\203\377\2\0\22\245\202\377\0\234\215\0\0q\202"
+    "\377\0\342\207\0\203\377\207\0\0\376\202\377\204\0\202\377\0\375"
+    "\203\0\0\232\201\377\2\240\0\241\201\377\0\232\203\0\0\70\201\377"
+    "\5q\366\377\307\0\274\200\377\0g\201\377\0S\203\0\1-\374\204\377\1"
+    "\375\61\212\0\203\377\211\0\1\2\305\202\377\0u\215\0\202\377\216\0"
+    "\1\26\366\200\377\0{\215\0\202\377\255\0\203\377\212\0\0\251\202"
+    "\377\0G\202\0\0I\202\377\0\247\202\0\203\377\200\0\1\4\316\201\377"
+    "\1\374%\214\0\0\22\202\377\0\372\207\0\203\377\207\0\0\365\202\377"
+    "\0\2\202\0\0\3\202\377\0\363\203\0\0^\201\377\2\325\0\326\201\377"
+    "\0^\203\0\0\30\201\377\0\257\200\377\2\222\0\204\200\377\0\260\201"
+    "\377\0\65\203\0\0\273\201\377\1\351\356\201\377\0\277\212\0\203"
+    "\377\211\0\0v\202\377\1\277\2\215\0\202\377\217\0\0\221\200\377\1"
+    "\353\12\214\0\202\377\255\0\203\377\212\0\0z\202\377\0~\202\0\0"
+    "\177\202\377\0p\202\0\203\377\201\0\0C\202\377\0\246\203\0\1\227\6"
+    "\205\0\0\12\202\377\0\374\207\0\203\377\207\0\0\334\202\377\0\36"
+    "\202\0\0\36\202\377\0\333\203\0\0\42\201\377\2\375\31\375\201\377"
+    "\0\42\203\0\1\1\367\200\377\0\361\200\377\2^\0M\200\377\0\363\201"
+    "\377\0\27\202\0\0N\202\377\1go\202\377\0Q\211\0\203\377\210\0\1+"
+    "\370\201\377\1\357\35\216\0\202\377\217\0\1\34\371\200\377\0q\214"
+    "\0\202\377\255\0\203\377\212\0\0.\202\377\1\331\3\200\0\1\3\332"
+    "\202\377\0$\202\0\203\377\202\0\0\310\201\377\1\375,\202\0\2\377"
+    "\317\64\204\0\0V\202\377\0\352\207\0\203\377\207\0\0\261\202\377\0"
+    "w\202\0\0x\202\377\0\260\204\0\0\345\201\377\0~\201\377\0\345\205"
+    "\0\0\331\203\377\2*\0\25\203\377\1\370\1\201\0\1\5\331\201\377\3"
+    "\325\3\5\331\201\377\1\333\6\210\0\203\377\207\0\1\5\315\202\377\0"
+    "Y\217\0\202\377\220\0\0\234\200\377\1\345\6\213\0\202\377\255\0"
+    "\203\377\213\0\0\324\202\377\0\237\200\26\0\237\202\377\0\301\203"
+    "\0\203\377\202\0\0J\202\377\0\256\202\0\200\377\7\376\261S\31\3\25"
+    "d\360\202\377\0\266\207\0\203\377\207\0\0m\202\377\1\370f\200\16\1"
+    "f\370\202\377\0l\204\0\0\252\201\377\0\343\201\377\0\252\205\0\0"
+    "\272\202\377\1\363\2\200\0\0\336\202\377\0\334\202\0\0q\202\377\0I"
+    "\200\0\0N\202\377\0s\210\0\203\377\207\0\0\201\202\377\0\245\220\0"
+    "\202\377\220\0\1$\374\200\377\0f\213\0\202\377\255\0\203\377\213\0"
+    "\0R\211\377\1\376>\203\0\203\377\203\0\0\313\202\377\0\62\201\0"
+    "\214\377\0Y\207\0\203\377\207\0\1\23\363\212\377\1\363\22\204\0\0n"
+    "\205\377\0n\205\0\0\232\202\377\0\302\201\0\0\246\202\377\0\277"
+    "\201\0\1\23\357\201\377\0\271\202\0\0\275\201\377\1\357\24\207\0"
+    "\203\377\207\0\0\373\215\377\206\0\202\377\221\0\0\246\200\377\1"
+    "\335\3\212\0\202\377\255\0\203\377\214\0\0\243\210\377\0\203\204\0"
+    "\203\377\203\0\0M\202\377\0\266\201\0\213\377\1\270\1\207\0\203"
+    "\377\210\0\0k\212\377\0j\205\0\0\62\205\377\0\62\205\0\0{\202\377"
+    "\0\216\201\0\0o\202\377\0\241\201\0\0\224\201\377\1\374-\202\0\1"
+    "\60\375\201\377\0\225\207\0\203\377\207\0\216\377\206\0\202\377"
+    "\221\0\1,\376\200\377\0\134\212\0\202\377\255\0\203\377\214\0\1\5"
+    "\235\206\377\0u\205\0\203\377\204\0\0\315\202\377\0:\200\0\1D\312"
+    "\210\377\1\241\12\210\0\203\377\211\0\1s\371\206\377\1\371s\206\0"
+    "\1\3\362\203\377\1\362\3\205\0\0[\202\377\0Z\201\0\0\67\202\377\0"
+    "\204\200\0\1*\373\201\377\0\232\204\0\0\235\201\377\1\373*\206\0"
+    "\203\377\207\0\216\377\206\0\202\377\222\0\0\261\200\377\1\325\1"
+    "\211\0\202\377\255\0\203\377\216\0\3>\240\334\366\202\377\1\265\11"
+    "\204\0\203\377\204\0\0O\202\377\0\276\202\0\11\63\213\307\355\375"
+    "\373\351\304\211.\212\0\203\377\212\0\3\37\201\304\353\200\374\3"
+    "\353\305\202\37\210\0\0\272\203\377\0\272\206\0\0<\202\377\0&\201"
+    "\0\1\7\371\201\377\0f\200\0\0\267\201\377\1\363\30\204\0\1\31\363"
+    "\201\377\0\267\206\0\203\377\207\0\216\377\206\0\202\377\222\0\0"
+    "\66\201\377\0Q\211\0\202\377\306\0\1!\355\201\377\1\301\16\377\0"
+    "\262\0\202\377\223\0\0\273\200\377\0\313\211\0\202\377\307\0\1E"
+    "\374\201\377\0\265\377\0\262\0\202\377\223\0\0@\201\377\0G\210\0"
+    "\202\377\310\0\0v\200\377\1\267\26\377\0\262\0\205\377\0\310\220\0"
+    "\0\305\200\377\0\302\204\0\206\377\311\0\2\243r\1\377\0\263\0\205"
+    "\377\0\310\232\0\206\377\377\0\377\0\200\0\205\377\0\310\232\0\206"
+    "\377\377\0\377\0\305\0\221\377\377\0\377\0\231\0\221\377\377\0\377"
+    "\0\231\0\221\377\377\0\377\0\377\0\377\0\377\0\377\0\377\0\212\0\0"
+    "\203\201\377\1\322\11\377\0\247\0\203\377\215\0\203\377\346\0\0"
+    "\211\201\377\0\234\377\0\247\0\203\377\215\0\203\377\347\0\0\217"
+    "\201\377\0]\234\0\203\377\252\0\203\377\232\0\4\15s\274\344\370"
+    "\202\377\226\0\203\377\221\0\203\377\215\0\203\377\206\0\203\377"
+    "\212\0\210\377\305\0\0\224\200\377\1\364)\233\0\203\377\252\0\203"
+    "\377\231\0\1\22\330\206\377\226\0\203\377\221\0\203\377\215\0\203"
+    "\377\206\0\203\377\212\0\210\377\305\0\1\1\232\200\377\1\324\12"
+    "\232\0\203\377\252\0\203\377\231\0\0\207\207\377\226\0\203\377\221"
+    "\0\203\377\215\0\203\377\206\0\203\377\212\0\210\377\306\0\1\1\237"
+    "\200\377\0\237\232\0\203\377\252\0\203\377\231\0\0\323\207\377\226"
+    "\0\203\377\262\0\203\377\212\0\210\377\347\0\203\377\252\0\203\377"
+    "\231\0\0\364\202\377\1D\2\231\0\203\377\262\0\203\377\217\0\203"
+    "\377\347\0\203\377\252\0\203\377\231\0\203\377\233\0\203\377\262\0"
+    "\203\377\217\0\203\377\326\0\13'r\251\322\356\372\374\360\326\246Z"
+    "\6\203\0\203\377\7\0\12\205\340\373\353\262F\211\0\11)\213\312\356"
+    "\374\366\337\267|+\205\0\7F\262\353\373\340\204\12\0\203\377\205\0"
+    "\10)\214\314\360\375\364\325\233@\205\0\214\377\205\0\7,\240\343"
+    "\370\336\220\30\0\203\377\202\0\203\377\7\0\42\250\355\370\323o\2"
+    "\205\0\207\377\210\0\210\377\206\0\203\377\202\0\1/\362\201\377\1"
+    "\363\67\204\0\203\377\210\0\201\377\13\0{\347\366\255\31\0q\345"
+    "\367\311\77\203\0\203\377\7\0$\251\355\370\323n\2\207\0\2H\247\340"
+    "\200\372\2\340\246H\232\0\211\377\1\332*\202\0\203\377\1\17\315"
+    "\204\377\0\215\206\0\2\11\227\375\207\377\204\0\0\215\204\377\1"
+    "\314\16\203\377\203\0\2\7\222\375\206\377\1\265\24\203\0\214\377"
+    "\204\0\1Z\370\203\377\1\346+\203\377\202\0\203\377\1$\354\203\377"
+    "\0\231\205\0\207\377\210\0\210\377\206\0\203\377\201\0\1\33\344"
+    "\201\377\1\367@\205\0\203\377\210\0\201\377\0~\202\377\1\324`\202"
+    "\377\1\363\36\202\0\203\377\1(\357\203\377\0\226\205\0\1\23\270"
+    "\206\377\1\266\22\230\0\212\377\1\340\12\201\0\203\377\0\247\206"
+    "\377\0i\204\0\1\7\300\211\377\203\0\0j\206\377\0\246\203\377\202\0"
+    "\1\4\267\211\377\1\327\22\202\0\214\377\203\0\1:\372\205\377\0\323"
+    "\203\377\202\0\203\377\0\263\205\377\0\70\204\0\207\377\210\0\210"
+    "\377\206\0\203\377\200\0\1\15\320\201\377\1\372J\206\0\203\377\210"
+    "\0\201\377\0\364\203\377\0\365\203\377\0{\202\0\203\377\0\271\205"
+    "\377\0\66\203\0\1\15\322\210\377\1\317\14\227\0\10\377\374\257^$"
+    "\13\10;\317\202\377\0i\201\0\214\377\1\356\14\203\0\0\220\212\377"
+    "\202\0\1\14\356\214\377\202\0\0\206\213\377\0\252\202\0\214\377"
+    "\202\0\1\1\317\214\377\202\0\203\377\0\375\205\377\0\227\204\0\207"
+    "\377\210\0\210\377\206\0\203\377\2\0\3\267\201\377\1\374T\207\0"
+    "\203\377\210\0\215\377\0\261\202\0\203\377\0\376\205\377\0\226\203"
+    "\0\0\237\212\377\0\233\227\0\1\261%\204\0\0+\202\377\0\264\201\0"
+    "\204\377\3\223\26\24\216\203\377\0_\202\0\1!\373\202\377\7\346d\31"
+    "\4\17\64p\312\202\0\0`\203\377\3\216\24\26\223\204\377\201\0\1\34"
+    "\371\201\377\6\375\203\37\4\30i\363\202\377\0\61\205\0\203\377\207"
+    "\0\0\77\203\377\3\226\25\27\233\204\377\202\0\203\377\3\345.\20"
+    "\262\202\377\0\316\210\0\203\377\215\0\203\377\206\0\203\377\1\0"
+    "\230\201\377\1\376`\210\0\203\377\210\0\202\377\1S\134\202\377\1YV"
+    "\201\377\0\323\202\0\203\377\3\345.\20\262\202\377\0\316\202\0\1'"
+    "\376\202\377\0\216\200\24\0\217\202\377\1\375%\236\0\0\1\202\377\0"
+    "\341\201\0\203\377\0\275\202\0\0\272\202\377\0\245\202\0\0\200\202"
+    "\377\1\354\36\211\0\0\246\202\377\0\272\202\0\0\276\203\377\201\0"
+    "\0z\202\377\0\202\203\0\0^\202\377\0\216\205\0\203\377\207\0\0\221"
+    "\202\377\1\307\1\200\0\1\2\314\203\377\202\0\203\377\0g\200\0\0\64"
+    "\202\377\0\357\210\0\203\377\215\0\203\377\206\0\203\377\0v\202"
+    "\377\0l\211\0\203\377\210\0\202\377\1\20\24\202\377\200\22\201\377"
+    "\0\350\202\0\203\377\0g\200\0\0\64\202\377\0\356\202\0\0\204\202"
+    "\377\0\271\202\0\0\272\202\377\0\202\226\0\5\4U\241\322\357\374"
+    "\205\377\0\367\201\0\203\377\0S\202\0\0R\202\377\0\324\202\0\0\302"
+    "\202\377\0s\212\0\0\324\202\377\0Q\202\0\0S\203\377\201\0\0\276"
+    "\202\377\0\33\203\0\0\17\202\377\0\311\205\0\203\377\207\0\0\304"
+    "\202\377\0`\202\0\0c\203\377\202\0\203\377\0\42\200\0\0\13\202\377"
+    "\0\374\210\0\203\377\215\0\203\377\206\0\203\377\0\376\201\377\0"
+    "\210\212\0\203\377\210\0\202\377\1\2\3\202\377\1\2\3\201\377\0\366"
+    "\202\0\203\377\0\42\200\0\0\14\202\377\0\373\202\0\0\304\202\377\0"
+    "P\202\0\0Q\202\377\0\302\225\0\1+\331\213\377\201\0\203\377\0\34"
+    "\202\0\0\34\202\377\0\357\202\0\0\351\202\377\0'\212\0\0\360\202"
+    "\377\0\33\202\0\0\35\203\377\201\0\0\347\202\377\200\374\200\375"
+    "\200\376\203\377\0\355\205\0\203\377\207\0\0\350\202\377\0%\202\0"
+    "\0'\203\377\202\0\203\377\0\6\201\0\203\377\210\0\203\377\215\0"
+    "\203\377\206\0\207\377\0\272\212\0\203\377\210\0\202\377\200\0\202"
+    "\377\200\0\201\377\0\374\202\0\203\377\0\6\200\0\0\1\203\377\202\0"
+    "\0\352\202\377\0\33\202\0\0\34\202\377\0\351\224\0\1\25\352\214"
+    "\377\201\0\203\377\0\5\202\0\0\6\202\377\0\374\202\0\0\374\202\377"
+    "\0\10\212\0\0\375\202\377\0\5\202\0\0\6\203\377\201\0\0\373\215"
+    "\377\0\374\205\0\203\377\207\0\0\367\202\377\0\14\202\0\0\15\203"
+    "\377\202\0\203\377\202\0\203\377\210\0\203\377\215\0\203\377\206\0"
+    "\210\377\0S\211\0\203\377\210\0\202\377\200\0\202\377\200\0\202"
+    "\377\202\0\203\377\202\0\203\377\202\0\0\374\202\377\0\5\202\0\0\6"
+    "\202\377\0\373\224\0\0\214\202\377\5\362r'\11\0\2\203\377\201\0"
+    "\203\377\0\5\202\0\0\6\202\377\0\371\202\0\0\374\202\377\0\7\212\0"
+    "\0\372\202\377\0\5\202\0\0\6\203\377\201\0\0\374\216\377\205\0\203"
+    "\377\207\0\0\373\202\377\0\14\202\0\0\15\203\377\202\0\203\377\202"
+    "\0\203\377\210\0\203\377\215\0\203\377\206\0\204\377\0\340\201\377"
+    "\1\341\12\210\0\203\377\210\0\202\377\200\0\202\377\200\0\202\377"
+    "\202\0\203\377\202\0\203\377\202\0\0\374\202\377\0\5\202\0\0\6\202"
+    "\377\0\373\224\0\0\327\202\377\0\134\202\0\0\17\203\377\201\0\203"
+    "\377\0\34\202\0\0\34\202\377\0\353\202\0\0\352\202\377\0%\212\0\0"
+    "\355\202\377\0\33\202\0\0\34\203\377\201\0\0\353\216\377\205\0\203"
+    "\377\207\0\0\355\202\377\0%\202\0\0'\203\377\202\0\203\377\202\0"
+    "\203\377\210\0\203\377\215\0\203\377\206\0\203\377\2\232\27\363"
+    "\201\377\0\205\210\0\203\377\0\1\207\0\202\377\200\0\202\377\200\0"
+    "\202\377\202\0\203\377\202\0\203\377\202\0\0\352\202\377\0\32\202"
+    "\0\0\34\202\377\0\351\224\0\0\365\202\377\0\17\202\0\0\64\203\377"
+    "\201\0\203\377\0S\202\0\0Q\202\377\0\317\202\0\0\303\202\377\0p"
+    "\212\0\0\321\202\377\0Q\202\0\0S\203\377\201\0\0\306\202\377\0\20"
+    "\220\0\203\377\207\0\0\320\202\377\0`\202\0\0b\203\377\202\0\203"
+    "\377\202\0\203\377\210\0\203\377\215\0\203\377\206\0\203\377\2\1\0"
+    "\202\201\377\1\371%\207\0\0\371\202\377\0\17\207\0\202\377\200\0"
+    "\202\377\200\0\202\377\202\0\203\377\202\0\203\377\202\0\0\304\202"
+    "\377\0P\202\0\0P\202\377\0\302\224\0\0\367\202\377\0\6\202\0\0z"
+    "\203\377\201\0\203\377\0\275\202\0\0\272\202\377\0\241\202\0\0\202"
+    "\202\377\1\351\33\211\0\0\243\202\377\0\271\202\0\0\275\203\377"
+    "\201\0\0\207\202\377\0u\220\0\203\377\207\0\0\236\202\377\1\306\1"
+    "\200\0\1\1\312\203\377\202\0\203\377\202\0\203\377\210\0\203\377"
+    "\215\0\203\377\206\0\203\377\200\0\1\16\354\201\377\0\266\207\0\0"
+    "\343\202\377\0E\207\0\202\377\200\0\202\377\200\0\202\377\202\0"
+    "\203\377\202\0\203\377\202\0\0\204\202\377\0\267\202\0\0\270\202"
+    "\377\0\202\224\0\0\331\202\377\0\77\201\0\1\20\346\203\377\201\0"
+    "\204\377\3\222\24\23\216\203\377\0W\202\0\1$\374\202\377\7\343a\30"
+    "\3\15\60m\311\202\0\0Z\203\377\3\215\23\25\222\204\377\201\0\1)"
+    "\376\201\377\12\376\231=\22\2\7\25\62^\226\334\206\0\203\377\207\0"
+    "\0P\203\377\3\225\24\26\231\204\377\202\0\203\377\202\0\203\377"
+    "\210\0\203\377\215\0\203\377\206\0\203\377\201\0\0s\202\377\0O\206"
+    "\0\0\272\202\377\2\322\60\3\205\0\202\377\200\0\202\377\200\0\202"
+    "\377\202\0\203\377\202\0\203\377\202\0\1(\376\202\377\0\214\200\23"
+    "\0\214\202\377\1\375%\224\0\0\223\202\377\4\330\61\6\64\310\204"
+    "\377\201\0\203\377\0\376\206\377\1\351\12\203\0\0\226\212\377\202"
+    "\0\1\14\353\206\377\0\376\203\377\202\0\0\235\214\377\206\0\203"
+    "\377\207\0\1\5\337\214\377\202\0\203\377\202\0\203\377\202\0\217"
+    "\377\207\0\203\377\206\0\203\377\201\0\1\10\342\201\377\1\337\11"
+    "\205\0\0u\210\377\202\0\202\377\200\0\202\377\200\0\202\377\202\0"
+    "\203\377\202\0\203\377\203\0\0\241\212\377\0\235\225\0\1\42\364"
+    "\206\377\0\374\203\377\201\0\203\377\0\246\206\377\0d\204\0\1\11"
+    "\305\211\377\203\0\0h\206\377\0\244\203\377\202\0\1\13\310\213\377"
+    "\206\0\203\377\210\0\1K\376\205\377\0\324\203\377\202\0\203\377"
+    "\202\0\203\377\202\0\217\377\207\0\203\377\206\0\203\377\202\0\0c"
+    "\202\377\0\201\205\0\1\25\361\207\377\202\0\202\377\200\0\202\377"
+    "\200\0\202\377\202\0\203\377\202\0\203\377\203\0\1\17\324\210\377"
+    "\1\321\15\226\0\1K\363\204\377\1\367Y\203\377\201\0\203\377\1\22"
+    "\325\204\377\0\221\206\0\2\13\236\376\207\377\204\0\0\224\204\377"
+    "\1\323\21\203\377\203\0\2\13\231\375\211\377\206\0\203\377\211\0\1"
+    "i\373\203\377\1\357\63\203\377\202\0\203\377\202\0\203\377\202\0"
+    "\217\377\207\0\203\377\206\0\203\377\202\0\1\3\330\201\377\1\367"
+    "\42\205\0\1G\364\206\377\202\0\202\377\200\0\202\377\200\0\202\377"
+    "\202\0\203\377\202\0\203\377\204\0\1\25\273\206\377\1\271\23\230\0"
+    "\10\37\216\325\365\373\335\227!\0\203\377\201\0\203\377\7\0\16\211"
+    "\336\374\360\272M\211\0\11.\216\315\361\375\367\342\275\202/\205\0"
+    "\7N\273\360\374\336\207\15\0\203\377\205\0\13$\200\301\350\372\374"
+    "\364\342\304\232e\42\206\0\203\377\212\0\7\61\244\344\371\343\237%"
+    "\7\202\377\0\364\202\0\203\377\202\0\203\377\202\0\217\377\206\0\0"
+    "\3\202\377\0\374\206\0\203\377\203\0\0T\202\377\0\263\206\0\4\36"
+    "\214\320\360\376\202\377\202\0\202\377\200\0\202\377\200\0\202\377"
+    "\202\0\203\377\202\0\203\377\206\0\2K\251\341\200\372\2\341\251J"
+    "\377\0\223\0\0(\202\377\0\345\255\0\0\30\202\377\0\357\377\0\362\0"
+    "\0\210\202\377\0\274\255\0\0\134\202\377\0\330\377\0\352\0\3\322"
+    "\200C\34\200\10\2(\211\373\202\377\0\200\253\0\2\24U\352\202\377\0"
+    "\252\377\0\352\0\212\377\1\374\36\250\0\210\377\0^\377\0\352\0\212"
+    "\377\0\200\251\0\207\377\1\337\12\377\0\352\0\210\377\2\374\202\2"
+    "\251\0\206\377\1\352\64\377\0\353\0\12'r\255\327\361\374\366\346"
+    "\275\201\37\253\0\202\377\4\374\355\306~\23\377\0\377\0\377\0\377"
+    "\0\377\0\377\0\377\0\377\0\377\0\377\0\377\0\377\0\377\0\377\0\377"
+    "\0\377\0\316\0\5\21z\277\344\365\376\200\377\210\0\202\377\207\0"
+    "\200\377\5\376\365\344\276x\20\377\0\203\377\377\0\2\0\27\342\205"
+    "\377\210\0\202\377\207\0\205\377\1\340\25\376\0\203\377\377\0\1\0"
+    "\210\206\377\210\0\202\377\207\0\206\377\0\206\376\0\203\377\377\0"
+    "\1\0\315\201\377\2\275-\6\212\0\202\377\211\0\2\6\60\305\201\377\0"
+    "\313\376\0\203\377\377\0\1\0\360\201\377\0\63\214\0\202\377\213\0"
+    "\0\67\201\377\0\357\376\0\203\377\377\0\1\0\375\201\377\0\12\214\0"
+    "\202\377\213\0\0\14\201\377\0\374\256\0\203\377\7\0\14|\326\366"
+    "\351\263G\207\0\7H\263\351\366\326{\12\0\203\377\204\0\203\377\7\0"
+    "\11{\326\371\356\263F\204\0\12\21o\271\344\367\373\356\322\251q'"
+    "\203\0\215\377\203\0\203\377\202\0\203\377\201\0\0\330\201\377\0"
+    "\306\205\0\0\307\201\377\2\327\0\352\200\377\0\342\211\0\0\343\200"
+    "\377\0\351\200\0\0\252\202\377\0\227\202\0\0\230\202\377\0\253\200"
+    "\0\0\321\201\377\1\361\7\203\0\1\6\361\201\377\0\321\202\0\214\377"
+    "\210\0\202\377\215\0\202\377\213\0\0\1\202\377\256\0\203\377\1\20"
+    "\311\204\377\0\210\205\0\0\214\204\377\1\307\17\203\377\204\0\203"
+    "\377\1\17\315\204\377\203\0\1J\353\210\377\203\0\215\377\203\0\203"
+    "\377\202\0\203\377\201\0\0\210\201\377\1\373\16\203\0\1\17\374\201"
+    "\377\2\207\0\276\200\377\1\376\11\207\0\1\12\376\200\377\0\275\200"
+    "\0\1\25\352\201\377\1\371\35\200\0\1\35\371\201\377\1\353\25\200\0"
+    "\0s\202\377\0K\203\0\0I\202\377\0u\202\0\214\377\210\0\202\377\215"
+    "\0\202\377\214\0\202\377\256\0\203\377\0\232\206\377\0b\203\0\0f"
+    "\206\377\0\230\203\377\204\0\203\377\0\235\205\377\202\0\1\62\373"
+    "\211\377\203\0\215\377\203\0\203\377\202\0\203\377\201\0\0\70\202"
+    "\377\0O\203\0\0R\202\377\2\67\0\221\201\377\0,\207\0\0/\201\377\0"
+    "\220\201\0\0T\202\377\0\225\200\0\0\226\202\377\0W\201\0\1\30\374"
+    "\201\377\0\235\203\0\0\231\201\377\1\375\33\202\0\214\377\210\0"
+    "\202\377\215\0\202\377\214\0\202\377\256\0\203\377\0\376\206\377\1"
+    "\351\12\201\0\1\14\353\206\377\0\376\203\377\204\0\203\377\0\373"
+    "\205\377\202\0\0\261\212\377\203\0\215\377\203\0\203\377\202\0\203"
+    "\377\201\0\1\1\346\201\377\0\224\203\0\0\227\201\377\3\345\1\0e"
+    "\201\377\0Q\207\0\0U\201\377\0d\202\0\0\250\201\377\0\370\200\34\0"
+    "\371\201\377\0\256\203\0\0\266\201\377\1\353\3\201\0\1\1\347\201"
+    "\377\0\275\203\0\213\377\0\354\207\0\0\7\202\377\215\0\202\377\214"
+    "\0\202\377\0\6\255\0\204\377\3\223\26\24\216\203\377\0W\201\0\0Z"
+    "\203\377\3\216\24\26\223\204\377\204\0\204\377\6\335\134\30\4\26L"
+    "\265\202\0\0\355\202\377\7\217!\4\7\33C\177\322\207\0\203\377\211"
+    "\0\203\377\202\0\203\377\202\0\0\227\201\377\0\331\203\0\0\334\201"
+    "\377\0\226\200\0\0\70\201\377\0w\207\0\0{\201\377\0\67\202\0\1\24"
+    "\351\201\377\1\224\225\201\377\1\355\27\203\0\0W\202\377\0A\201\0"
+    "\0\71\202\377\0a\212\0\1!\355\201\377\1\374C\207\0\0$\201\377\0"
+    "\366\215\0\202\377\214\0\0\367\201\377\0%\255\0\203\377\0\275\202"
+    "\0\0\272\202\377\0\241\201\0\0\242\202\377\0\272\202\0\0\276\203"
+    "\377\204\0\203\377\1\335\21\210\0\0\371\202\377\0\24\216\0\203\377"
+    "\211\0\203\377\202\0\203\377\202\0\0G\202\377\0\36\201\0\0!\202"
+    "\377\0F\200\0\1\15\376\200\377\0\234\200\0\0s\201\377\0v\200\0\0"
+    "\240\200\377\1\376\14\203\0\0Q\201\377\200\370\201\377\0[\204\0\1"
+    "\10\360\201\377\0\223\201\0\0\211\201\377\1\366\16\211\0\1\12\320"
+    "\202\377\0q\210\0\0x\201\377\0\331\215\0\202\377\214\0\0\332\201"
+    "\377\0z\255\0\203\377\0S\202\0\0R\202\377\0\316\201\0\0\320\202"
+    "\377\0Q\202\0\0S\203\377\204\0\203\377\0Z\211\0\0\327\202\377\2"
+    "\334n$\214\0\203\377\211\0\203\377\202\0\203\377\202\0\1\6\361\201"
+    "\377\0b\201\0\0g\201\377\1\360\5\201\0\0\337\200\377\0\301\200\0\0"
+    "\251\201\377\0\252\200\0\0\306\200\377\0\336\205\0\0\246\204\377\0"
+    "\261\206\0\0\232\201\377\1\343\1\200\0\0\330\201\377\0\251\212\0\0"
+    "\247\202\377\0\243\206\0\3\6#w\370\201\377\0\224\215\0\202\377\214"
+    "\0\0\227\201\377\3\371z$\6\204\0\7/\236\340\372\355\270`\10\203\0"
+    "\1\6\230\225\0\203\377\0\34\202\0\0\34\202\377\0\353\201\0\0\355"
+    "\202\377\0\33\202\0\0\35\203\377\204\0\203\377\0\33\211\0\0z\205"
+    "\377\3\351\243H\1\210\0\203\377\211\0\203\377\202\0\203\377\203\0"
+    "\0\247\201\377\0\247\201\0\0\255\201\377\0\246\202\0\0\263\200\377"
+    "\0\346\200\0\0\337\201\377\0\337\200\0\0\354\200\377\0\262\205\0\1"
+    "\22\347\202\377\1\356\31\206\0\0<\202\377\2\67\0)\202\377\0M\211\0"
+    "\0t\202\377\1\315\11\205\0\205\377\1\322\27\215\0\202\377\214\0\1"
+    "\31\323\205\377\202\0\1\203\374\204\377\7\346},\6\27]\325\377\225"
+    "\0\203\377\0\5\202\0\0\6\202\377\0\371\201\0\0\372\202\377\0\5\202"
+    "\0\0\6\203\377\204\0\203\377\0\6\211\0\1\5\265\207\377\1\307\42"
+    "\207\0\203\377\211\0\203\377\202\0\203\377\203\0\0V\201\377\4\352"
+    "\1\0\3\357\201\377\0V\202\0\0\206\201\377\1\14\25\200\377\0\376"
+    "\200\377\1\23\21\201\377\0\206\206\0\0j\202\377\0y\210\0\0\334\201"
+    "\377\2\212\0y\201\377\1\353\5\210\0\1D\374\201\377\1\352\36\206\0"
+    "\203\377\2\372\222\6\216\0\202\377\215\0\2\6\220\371\203\377\202\0"
+    "\216\377\225\0\203\377\0\5\202\0\0\6\202\377\0\371\201\0\0\371\202"
+    "\377\0\5\202\0\0\6\203\377\204\0\203\377\213\0\2\2c\325\206\377\1"
+    "\345\27\206\0\203\377\211\0\203\377\202\0\203\377\203\0\1\15\370"
+    "\201\377\2\61\0\67\201\377\1\370\15\202\0\0Z\201\377\1\61K\200\377"
+    "\0\263\200\377\1H\70\201\377\0Y\205\0\1\12\326\202\377\1\337\16"
+    "\207\0\0\177\201\377\2\333\0\311\201\377\0\225\210\0\1 \354\201"
+    "\377\1\373@\207\0\205\377\1\306\15\215\0\202\377\214\0\1\15\305"
+    "\205\377\202\0\7\377\322_\32\5\34^\300\204\377\1\375\205\225\0\203"
+    "\377\0\34\202\0\0\34\202\377\0\353\201\0\0\354\202\377\0\33\202\0"
+    "\0\34\203\377\204\0\203\377\216\0\3'g\261\364\203\377\0\222\206\0"
+    "\203\377\211\0\203\377\201\0\0\6\203\377\204\0\0\266\201\377\2v\0}"
+    "\201\377\0\265\203\0\0.\201\377\1V\201\200\377\0>\200\377\1|]\201"
+    "\377\0-\205\0\0\231\204\377\0\245\207\0\1!\376\201\377\1H\376\201"
+    "\377\0\71\207\0\1\12\320\202\377\0n\211\0\3\7%|\372\201\377\0\203"
+    "\215\0\202\377\214\0\0\204\201\377\3\372\177&\7\203\0\1\214\4\204"
+    "\0\6\62\233\342\373\345\244\63\226\0\203\377\0S\202\0\0Q\202\377\0"
+    "\320\201\0\0\320\202\377\0Q\202\0\0S\203\377\204\0\203\377\221\0\1"
+    "\12\205\202\377\0\337\206\0\203\377\211\0\0\374\202\377\0\12\200\0"
+    "\0!\203\377\204\0\0f\201\377\2\273\0\302\201\377\0e\203\0\1\6\373"
+    "\200\377\10{\267\377\344\0\344\377\261\203\200\377\1\372\5\204\0\0"
+    "Q\206\377\0[\207\0\0\302\201\377\0\336\201\377\0\334\210\0\0\246"
+    "\202\377\0\240\215\0\0\177\201\377\0\316\215\0\202\377\214\0\0\317"
+    "\201\377\0\200\255\0\203\377\0\275\202\0\0\272\202\377\0\242\201\0"
+    "\0\242\202\377\0\271\202\0\0\275\203\377\204\0\203\377\222\0\0\13"
+    "\202\377\0\372\206\0\0\372\202\377\0\21\210\0\0\360\202\377\0\61"
+    "\200\0\0e\203\377\204\0\1\30\375\200\377\2\367\25\372\200\377\1"
+    "\375\27\204\0\0\325\200\377\10\241\354\377\251\0\252\377\346\251"
+    "\200\377\0\324\204\0\1\34\355\201\377\1\246\257\201\377\1\361 \206"
+    "\0\0c\205\377\0\201\207\0\0t\202\377\1\313\10\215\0\0(\201\377\0"
+    "\360\215\0\202\377\214\0\0\361\201\377\0(\255\0\204\377\3\222\24"
+    "\23\216\203\377\0Y\201\0\0Z\203\377\3\215\23\25\222\204\377\204\0"
+    "\203\377\212\0\10\332\221X.\21\4\6)\232\202\377\0\356\206\0\0\343"
+    "\202\377\2\233\31\1\206\0\0\320\202\377\3\254\17-\344\203\377\205"
+    "\0\0\305\201\377\0\222\201\377\0\304\205\0\0\250\200\377\0\346\200"
+    "\377\2o\0p\200\377\0\346\200\377\0\247\203\0\1\2\277\201\377\3\362"
+    "\31\36\364\201\377\1\305\3\205\0\1\16\366\204\377\0%\206\0\1C\374"
+    "\201\377\1\351\35\216\0\0\10\201\377\0\375\215\0\202\377\214\0\0"
+    "\375\201\377\0\7\255\0\214\377\1\353\13\201\0\1\14\353\214\377\204"
+    "\0\203\377\212\0\213\377\0\270\206\0\0\261\210\377\203\0\0\227\213"
+    "\377\205\0\0u\201\377\0\371\201\377\0t\205\0\0|\203\377\2\64\0\65"
+    "\203\377\0{\203\0\0{\202\377\0q\200\0\0w\202\377\0\200\206\0\0\246"
+    "\203\377\0\311\207\0\0\354\213\377\210\0\202\377\215\0\202\377\214"
+    "\0\202\377\256\0\203\377\0\237\206\377\0d\203\0\0d\206\377\0\236"
+    "\203\377\204\0\203\377\212\0\213\377\0C\206\0\0W\210\377\203\0\0"
+    "\71\205\377\0\275\203\377\205\0\0%\205\377\0$\205\0\0O\202\377\4"
+    "\365\4\0\4\366\202\377\0N\202\0\1\67\373\201\377\1\322\4\200\0\1\5"
+    "\325\201\377\1\374:\205\0\0H\203\377\0m\207\0\214\377\210\0\202"
+    "\377\215\0\202\377\214\0\202\377\256\0\203\377\1\16\310\204\377\0"
+    "\207\205\0\0\207\204\377\1\310\16\203\377\204\0\203\377\212\0\211"
+    "\377\1\366d\207\0\1\1\247\207\377\204\0\0\231\203\377\1\361,\203"
+    "\377\206\0\0\325\203\377\0\324\206\0\0#\202\377\0\277\201\0\0\300"
+    "\202\377\0\42\201\0\1\16\335\201\377\1\376<\202\0\0\77\202\377\1"
+    "\336\16\204\0\1\3\346\201\377\1\373\25\207\0\214\377\210\0\202\377"
+    "\215\0\202\377\214\0\202\377\256\0\203\377\7\0\12\200\333\370\347"
+    "\256A\207\0\7A\256\347\370\333\200\12\0\203\377\204\0\203\377\212"
+    "\0\13!a\225\300\337\363\375\367\345\276{\33\212\0\4J\240\323\357"
+    "\375\202\377\204\0\7\2n\323\370\357\255)\0\203\377\206\0\0\204\203"
+    "\377\0\204\206\0\1\1\364\201\377\0\205\201\0\0\205\201\377\1\364\1"
+    "\201\0\0\244\202\377\0\241\204\0\0\242\202\377\0\244\205\0\0\266"
+    "\201\377\0\265\210\0\214\377\210\0\202\377\0\2\214\0\202\377\213\0"
+    "\0\3\202\377\256\0\203\377\227\0\203\377\377\0\211\0\1\24\370\201"
+    "\377\0Y\240\0\0\372\201\377\0\20\214\0\202\377\213\0\0\22\201\377"
+    "\0\371\256\0\203\377\227\0\203\377\377\0\211\0\0\203\201\377\1\363"
+    "\12\240\0\0\354\201\377\0=\214\0\202\377\213\0\0B\201\377\0\353"
+    "\256\0\203\377\227\0\203\377\377\0\207\0\2\22a\371\201\377\0\236"
+    "\241\0\0\305\201\377\2\306\60\6\212\0\202\377\211\0\2\6\65\315\201"
+    "\377\0\303\256\0\203\377\227\0\203\377\377\0\205\0\206\377\0\63"
+    "\241\0\0}\206\377\210\0\202\377\207\0\206\377\0{\256\0\203\377\227"
+    "\0\203\377\377\0\205\0\205\377\0\253\242\0\1\21\334\205\377\210\0"
+    "\202\377\207\0\205\377\1\331\17\256\0\203\377\227\0\203\377\377\0"
+    "\205\0\204\377\1\332\24\243\0\5\15u\274\344\366\376\200\377\210\0"
+    "\202\377\207\0\200\377\5\376\366\344\274t\15\257\0\203\377\227\0"
+    "\203\377\377\0\205\0\201\377\3\376\350\227\23\266\0\202\377\377\0"
+    "\377\0\250\0\202\377\276\0"
 };
 #endif
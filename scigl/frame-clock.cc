@@ -0,0 +1,138 @@
+/*
+ * Copyright (C) 2008 Nicolas P. Rougier
+ *
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <ctime>
+#include <sys/time.h>
+#include "frame-clock.h"
+
+
+// __________________________________________________________________ FrameClock
+FrameClock::FrameClock (void)
+{
+    step_ = 0;
+    paused_ = false;
+    reset ();
+}
+
+// _________________________________________________________________ ~FrameClock
+FrameClock::~FrameClock (void)
+{}
+
+// _____________________________________________________________________ Default
+FrameClockPtr
+FrameClock::Default (void)
+{
+    static FrameClockPtr clock;
+    if (not clock) {
+        clock = FrameClockPtr (new FrameClock());
+    }
+    return clock;
+}
+
+// ________________________________________________________________________ tick
+double
+FrameClock::tick (const void *owner)
+{
+    if (owner) {
+        bool seen = owners_.empty();
+        for (unsigned int i=0; (not seen) and (i<owners_.size()); i++)
+            seen = (owners_[i] == owner);
+        if (not seen) {
+            owners_.push_back (owner);
+            return time_;
+        }
+        owners_.clear();
+        owners_.push_back (owner);
+    }
+    if (paused_) {
+        return time_;
+    }
+    if (step_ > 0) {
+        time_ += step_;
+        origin_ = now() - time_;
+    } else {
+        time_ = now() - origin_;
+    }
+    return time_;
+}
+
+// ____________________________________________________________________ get_time
+double
+FrameClock::get_time (void) const
+{
+    return time_;
+}
+
+// _______________________________________________________________________ reset
+void
+FrameClock::reset (double time)
+{
+    time_ = time;
+    origin_ = now() - time_;
+}
+
+// _______________________________________________________________________ pause
+void
+FrameClock::pause (void)
+{
+    paused_ = true;
+}
+
+// ______________________________________________________________________ resume
+void
+FrameClock::resume (void)
+{
+    if (paused_) {
+        paused_ = false;
+        origin_ = now() - time_;
+    }
+}
+
+// __________________________________________________________________ get_paused
+bool
+FrameClock::get_paused (void) const
+{
+    return paused_;
+}
+
+// ____________________________________________________________________ set_step
+void
+FrameClock::set_step (double step)
+{
+    step_ = (step > 0) ? step : 0;
+    origin_ = now() - time_;
+}
+
+// ____________________________________________________________________ get_step
+double
+FrameClock::get_step (void) const
+{
+    return step_;
+}
+
+// _________________________________________________________________________ now
+double
+FrameClock::now (void)
+{
+#if defined(CLOCK_MONOTONIC)
+    struct timespec ts;
+    if (clock_gettime (CLOCK_MONOTONIC, &ts) == 0) {
+        return ts.tv_sec*1000.0 + ts.tv_nsec/1000000.0;
+    }
+#endif
+    struct timeval tv;
+    gettimeofday (&tv, NULL);
+    return tv.tv_sec*1000.0 + tv.tv_usec/1000.0;
+}
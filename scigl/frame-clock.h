@@ -0,0 +1,182 @@
+/*
+ * Copyright (C) 2008 Nicolas P. Rougier
+ *
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef __FRAME_CLOCK_H__
+#define __FRAME_CLOCK_H__
+#include <vector>
+
+#if defined(HAVE_BOOST)
+#   include <boost/shared_ptr.hpp>
+    typedef boost::shared_ptr<class FrameClock> FrameClockPtr;
+#else
+    typedef class FrameClock *                  FrameClockPtr;
+#endif
+
+
+/**
+ * Time source for animations.
+ *
+ * A frame clock is sampled once per frame by the scene being rendered (see
+ * Scene::render) and all objects rendered within that frame then see the very
+ * same time (see Object::get_time). Time is expressed in milliseconds and is
+ * read from a monotonic system clock such that it is not affected by system
+ * time changes.
+ *
+ * The clock can be paused, in which case time stands still until the clock is
+ * resumed, and it can be given a fixed step, in which case time advances by
+ * exactly this step at each frame whatever the real elapsed time. The latter
+ * allows to replay animations deterministically, for example when recording a
+ * movie frame by frame.
+ */
+class FrameClock {
+public:
+
+    // _________________________________________________________________________
+
+    /**
+     * @name Creation/Destruction
+     */
+    /**
+     * Default constructor
+     */
+    FrameClock (void);
+
+    /**
+     * Destructor
+     */
+    virtual ~FrameClock (void);
+
+    /**
+     * Default clock shared by all scenes
+     */
+    static FrameClockPtr Default (void);
+    //@}
+
+
+    // _________________________________________________________________________
+
+    /**
+     * @name Time
+     */
+    /**
+     * Sample clock for a new frame.
+     *
+     * When several owners (e.g. scenes) share the clock, each of them ticks
+     * it once per displayed frame: time only advances when an owner ticks
+     * the clock for the second time since it last advanced, so that a fixed
+     * step is applied once per frame and not once per owner.
+     *
+     * @param owner whoever samples the clock (0 always advances it)
+     * @return new frame time (ms)
+     */
+    virtual double tick (const void *owner = 0);
+
+    /**
+     * Get time of last frame.
+     *
+     * @return frame time (ms)
+     */
+    virtual double get_time (void) const;
+
+    /**
+     * Restart clock from given time.
+     *
+     * @param time new frame time (ms)
+     */
+    virtual void reset (double time = 0);
+    //@}
+
+
+    // _________________________________________________________________________
+
+    /**
+     * @name Pause/Replay
+     */
+    /**
+     * Pause clock.
+     */
+    virtual void pause (void);
+
+    /**
+     * Resume clock.
+     *
+     * Time resumes from where it was paused.
+     */
+    virtual void resume (void);
+
+    /**
+     * Whether clock is paused.
+     */
+    virtual bool get_paused (void) const;
+
+    /**
+     * Set fixed time step.
+     *
+     * @param step time added at each frame (ms), 0 to follow real time
+     */
+    virtual void set_step (double step);
+
+    /**
+     * Get fixed time step.
+     *
+     * @return time added at each frame (ms), 0 if following real time
+     */
+    virtual double get_step (void) const;
+    //@}
+
+
+protected:
+
+    // _________________________________________________________________________
+
+    /**
+     * Read monotonic system clock.
+     *
+     * @return system time (ms)
+     */
+    static double now (void);
+
+
+protected:
+
+    // _________________________________________________________________________
+
+    /**
+     * Time of last frame (ms)
+     */
+    double time_;
+
+    /**
+     * System time corresponding to a frame time of 0 (ms)
+     */
+    double origin_;
+
+    /**
+     * Fixed time step (ms)
+     */
+    double step_;
+
+    /**
+     * Whether clock is paused
+     */
+    bool paused_;
+
+    /**
+     * Owners that ticked the clock since it last advanced
+     */
+    std::vector<const void *> owners_;
+};
+
+#endif
@@ -65,7 +65,6 @@ Frame::render (void)
     glDisable (GL_LIGHTING);
     glEnable (GL_BLEND);
     glDisable (GL_TEXTURE_2D);
-	float m[16];
 
     struct face {
         int index;
@@ -84,7 +83,7 @@ Frame::render (void)
         {2, {-.5,-.5,-.5,  -.5,-.5, .5,  -.5, .5, .5,   -.5, .5,-.5}, {-1,0,0}, 0},
         {3, { .5,-.5,-.5,   .5,-1.0,-.5,   .5,-1.0, .5,  .5,-.5, .5}, { 1,0,0}, 0},
     };
-	glGetFloatv (GL_MODELVIEW_MATRIX, m);
+    const float *m = RenderState::get_modelview ();
     for (int i=0; i<4; i++)
         faces[i].z = faces[i].normal[0]*m[2] + faces[i].normal[1]*m[6]
                    + faces[i].normal[2]*m[10] + m[14]; 
@@ -99,29 +98,29 @@ Frame::render (void)
         if (faces[i].index == 0) {
             if ((faces[3].index != 3) and (faces[3].index != 0))
                 z_axis_->render();
-            glPushMatrix();
-            glRotatef (90, 1, 0, 0);
-            glTranslatef (0, 0, .5);
+            RenderState::push_matrix();
+            RenderState::rotate (90, 1, 0, 0);
+            RenderState::translate (0, 0, .5);
             plane(fg,bg,9,9);
-            glPopMatrix();
+            RenderState::pop_matrix();
             if ((faces[3].index == 3) or (faces[3].index == 0))
                 z_axis_->render();
         // XY plane
         } else if (faces[i].index == 1) {
-            glPushMatrix();
-            glTranslatef (0.0f, 0.0f, -0.5f);
+            RenderState::push_matrix();
+            RenderState::translate (0.0f, 0.0f, -0.5f);
             plane(fg,bg,9,9);
-            glTranslatef (0.0f, 0.5f, 0.0f);
-            glPopMatrix ();
+            RenderState::translate (0.0f, 0.5f, 0.0f);
+            RenderState::pop_matrix ();
             x_axis_->render();
             y_axis_->render();
         // XZ plane
         } else if (faces[i].index == 2) {
-            glPushMatrix();
-            glRotatef (90, 0, 1, 0);
-            glTranslatef (0.0f, 0.0f, -0.5f);
+            RenderState::push_matrix();
+            RenderState::rotate (90, 0, 1, 0);
+            RenderState::translate (0.0f, 0.0f, -0.5f);
             plane(fg,bg,9,9);
-            glPopMatrix();
+            RenderState::pop_matrix();
         } else if (faces[i].index == 3) {
             //z_axis_->render();
         }
@@ -149,6 +148,36 @@ Frame::show (float timeout)
     z_axis_->show (timeout);
 }
 
+// ________________________________________________________________ needs_redraw
+bool
+Frame::needs_redraw (void) const
+{
+    return Object::needs_redraw() or x_axis_->needs_redraw() or
+           y_axis_->needs_redraw() or z_axis_->needs_redraw();
+}
+
+// ___________________________________________________________________ set_dirty
+void
+Frame::set_dirty (bool dirty)
+{
+    Object::set_dirty (dirty);
+    if (dirty)
+        return;
+    x_axis_->set_dirty (false);
+    y_axis_->set_dirty (false);
+    z_axis_->set_dirty (false);
+}
+
+// ____________________________________________________________________ set_time
+void
+Frame::set_time (double time)
+{
+    Object::set_time (time);
+    x_axis_->set_time (time);
+    y_axis_->set_time (time);
+    z_axis_->set_time (time);
+}
+
 // __________________________________________________________________ get_x_axis
 AxisPtr
 Frame::get_x_axis(void)
@@ -160,6 +189,7 @@ Frame::get_x_axis(void)
 void
 Frame::set_x_axis(AxisPtr axis)
 {
+    set_dirty ();
     x_axis_ = axis;
 }
 
@@ -174,6 +204,7 @@ Frame::get_y_axis(void)
 void
 Frame::set_y_axis(AxisPtr axis)
 {
+    set_dirty ();
     y_axis_ = axis;
 }
 
@@ -188,5 +219,6 @@ Frame::get_z_axis(void)
 void
 Frame::set_z_axis(AxisPtr axis)
 {
+    set_dirty ();
     z_axis_ = axis;
 }
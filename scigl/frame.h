@@ -88,6 +88,32 @@ public:
     //@}
 
 
+    // _________________________________________________________________________
+
+    /**
+     * @name Redraw
+     */
+    /**
+     * Whether frame or any of its axis needs to be redrawn
+     */
+    virtual bool needs_redraw (void) const;
+
+    /**
+     * Set whether frame needs to be redrawn, clearing also clears axis
+     *
+     * @param dirty whether frame needs to be redrawn
+     */
+    virtual void set_dirty (bool dirty = true);
+
+    /**
+     * Set time of the frame being rendered, passed down to axis
+     *
+     * @param time frame time (ms)
+     */
+    virtual void set_time (double time);
+    //@}
+
+
     // _________________________________________________________________________
 
     /**
@@ -0,0 +1,261 @@
+/*
+ * Copyright (C) 2008 Nicolas P. Rougier
+ *
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "layer-cache.h"
+#include "render-state.h"
+
+// Color is premultiplied, depth is written as is such that objects rendered
+// afterwards are depth tested against cached ones.
+static const char *layer_vertex_source =
+    "void main() {\n"
+    "    gl_TexCoord[0] = gl_MultiTexCoord0;\n"
+    "    gl_Position = gl_Vertex;\n"
+    "}\n";
+static const char *layer_fragment_source =
+    "uniform sampler2D color;\n"
+    "uniform sampler2D depth;\n"
+    "void main() {\n"
+    "    gl_FragColor = texture2D (color, gl_TexCoord[0].st);\n"
+    "    gl_FragDepth = texture2D (depth, gl_TexCoord[0].st).r;\n"
+    "}\n";
+
+// ______________________________________________________________ compile_shader
+static GLuint
+compile_shader (GLenum type, const char *source)
+{
+    GLuint shader = glCreateShader (type);
+    glShaderSource (shader, 1, &source, 0);
+    glCompileShader (shader);
+    GLint status;
+    glGetShaderiv (shader, GL_COMPILE_STATUS, &status);
+    if (not status) {
+        glDeleteShader (shader);
+        return 0;
+    }
+    return shader;
+}
+
+
+// __________________________________________________________________ LayerCache
+LayerCache::LayerCache (void)
+{
+    framebuffer_ = 0;
+    textures_[0] = textures_[1] = 0;
+    program_ = 0;
+    previous_ = 0;
+    width_ = height_ = 0;
+    valid_ = false;
+    broken_ = false;
+}
+
+
+// _________________________________________________________________ ~LayerCache
+LayerCache::~LayerCache (void)
+{
+    if (framebuffer_)
+        glDeleteFramebuffersEXT (1, &framebuffer_);
+    if (textures_[0])
+        glDeleteTextures (2, textures_);
+    if (program_)
+        glDeleteProgram (program_);
+}
+
+
+// ___________________________________________________________________ get_valid
+bool
+LayerCache::get_valid (void) const
+{
+    return valid_;
+}
+
+
+// __________________________________________________________________ invalidate
+void
+LayerCache::invalidate (void)
+{
+    valid_ = false;
+}
+
+
+// _____________________________________________________________________ set_key
+void
+LayerCache::set_key (const std::vector<float> &key)
+{
+    if (key != key_) {
+        key_ = key;
+        valid_ = false;
+    }
+}
+
+
+// _______________________________________________________________________ setup
+bool
+LayerCache::setup (void)
+{
+    if (not glewIsSupported ("GL_VERSION_2_0 GL_EXT_framebuffer_object"))
+        return false;
+    GLuint vertex = compile_shader (GL_VERTEX_SHADER, layer_vertex_source);
+    GLuint fragment = compile_shader (GL_FRAGMENT_SHADER, layer_fragment_source);
+    if ((not vertex) or (not fragment)) {
+        if (vertex)
+            glDeleteShader (vertex);
+        if (fragment)
+            glDeleteShader (fragment);
+        return false;
+    }
+    program_ = glCreateProgram ();
+    glAttachShader (program_, vertex);
+    glAttachShader (program_, fragment);
+    glLinkProgram (program_);
+    glDeleteShader (vertex);
+    glDeleteShader (fragment);
+    GLint status;
+    glGetProgramiv (program_, GL_LINK_STATUS, &status);
+    if (not status)
+        return false;
+    GLuint program = RenderState::get_program();
+    RenderState::use_program (program_);
+    glUniform1i (glGetUniformLocation (program_, "color"), 0);
+    glUniform1i (glGetUniformLocation (program_, "depth"), 1);
+    RenderState::use_program (program);
+
+    glGenFramebuffersEXT (1, &framebuffer_);
+    glGenTextures (2, textures_);
+    for (unsigned int i=0; i<2; i++) {
+        glBindTexture (GL_TEXTURE_2D, textures_[i]);
+        glTexParameteri (GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri (GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTexParameteri (GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+        glTexParameteri (GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    }
+    glBindTexture (GL_TEXTURE_2D, 0);
+    return true;
+}
+
+
+// ______________________________________________________________________ resize
+bool
+LayerCache::resize (int width, int height)
+{
+    glBindFramebufferEXT (GL_FRAMEBUFFER_EXT, framebuffer_);
+    if ((width != width_) or (height != height_)) {
+        glBindTexture (GL_TEXTURE_2D, textures_[0]);
+        glTexImage2D (GL_TEXTURE_2D, 0, GL_RGBA8, width, height, 0,
+                      GL_RGBA, GL_UNSIGNED_BYTE, 0);
+        glBindTexture (GL_TEXTURE_2D, textures_[1]);
+        glTexImage2D (GL_TEXTURE_2D, 0, GL_DEPTH_COMPONENT24, width, height, 0,
+                      GL_DEPTH_COMPONENT, GL_UNSIGNED_INT, 0);
+        glBindTexture (GL_TEXTURE_2D, 0);
+        glFramebufferTexture2DEXT (GL_FRAMEBUFFER_EXT, GL_COLOR_ATTACHMENT0_EXT,
+                                   GL_TEXTURE_2D, textures_[0], 0);
+        glFramebufferTexture2DEXT (GL_FRAMEBUFFER_EXT, GL_DEPTH_ATTACHMENT_EXT,
+                                   GL_TEXTURE_2D, textures_[1], 0);
+        width_ = width;
+        height_ = height;
+    }
+    if (glCheckFramebufferStatusEXT (GL_FRAMEBUFFER_EXT)
+        != GL_FRAMEBUFFER_COMPLETE_EXT) {
+        glBindFramebufferEXT (GL_FRAMEBUFFER_EXT, previous_);
+        return false;
+    }
+    return true;
+}
+
+
+// _______________________________________________________________________ begin
+bool
+LayerCache::begin (int width, int height)
+{
+    if (broken_ or (width <= 0) or (height <= 0))
+        return false;
+    if ((not program_) and (not setup())) {
+        broken_ = true;
+        return false;
+    }
+    // Only queried when cache is rendered again, not every frame
+    glGetIntegerv (GL_FRAMEBUFFER_BINDING_EXT, &previous_);
+    if (not resize (width, height))
+        return false;
+
+    RenderState::push_attrib (GL_VIEWPORT_BIT | GL_SCISSOR_BIT |
+                              GL_COLOR_BUFFER_BIT);
+    RenderState::viewport (0, 0, width, height);
+    RenderState::scissor (0, 0, width, height);
+    glClearColor (0, 0, 0, 0);
+    glClear (GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+    // Accumulate premultiplied colors and coverage
+    glBlendFuncSeparate (GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA,
+                         GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+    return true;
+}
+
+
+// _________________________________________________________________________ end
+void
+LayerCache::end (void)
+{
+    glBindFramebufferEXT (GL_FRAMEBUFFER_EXT, previous_);
+    RenderState::pop_attrib ();
+    valid_ = true;
+}
+
+
+// ________________________________________________________________________ draw
+void
+LayerCache::draw (bool depth)
+{
+    if (not valid_)
+        return;
+    // Vertex program ignores matrices, quad covers the viewport
+    glPushAttrib (GL_ENABLE_BIT | GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT |
+                  GL_TEXTURE_BIT | GL_POLYGON_BIT);
+    glDisable (GL_LIGHTING);
+    glDisable (GL_CULL_FACE);
+    glPolygonMode (GL_FRONT_AND_BACK, GL_FILL);
+    if (depth) {
+        glEnable (GL_DEPTH_TEST);
+        glDepthFunc (GL_ALWAYS);
+        glDepthMask (GL_TRUE);
+    } else {
+        glDisable (GL_DEPTH_TEST);
+    }
+    glEnable (GL_BLEND);
+    glBlendFunc (GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+    glActiveTexture (GL_TEXTURE1);
+    glBindTexture (GL_TEXTURE_2D, textures_[1]);
+    glActiveTexture (GL_TEXTURE0);
+    glBindTexture (GL_TEXTURE_2D, textures_[0]);
+
+    GLuint program = RenderState::get_program();
+    RenderState::use_program (program_);
+    glBegin (GL_QUADS);
+    glTexCoord2f (0, 0); glVertex2f (-1, -1);
+    glTexCoord2f (1, 0); glVertex2f ( 1, -1);
+    glTexCoord2f (1, 1); glVertex2f ( 1,  1);
+    glTexCoord2f (0, 1); glVertex2f (-1,  1);
+    glEnd ();
+    RenderState::use_program (program);
+
+    glPopAttrib ();
+}
+
+
+// _________________________________________________________________ get_texture
+GLuint
+LayerCache::get_texture (void) const
+{
+    return textures_[0];
+}
@@ -0,0 +1,194 @@
+/*
+ * Copyright (C) 2008 Nicolas P. Rougier
+ *
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef __LAYER_CACHE_H__
+#define __LAYER_CACHE_H__
+#include <vector>
+#include "object.h"
+
+#if defined(HAVE_BOOST)
+#   include <boost/shared_ptr.hpp>
+    typedef boost::shared_ptr<class LayerCache> LayerCachePtr;
+#else
+    typedef class LayerCache *                  LayerCachePtr;
+#endif
+
+
+/**
+ * Offscreen color and depth copy of a set of objects.
+ *
+ * Objects that do not change from one frame to the next can be rendered once
+ * into an offscreen framebuffer (between begin and end) and the result drawn
+ * (draw) on subsequent frames instead of rendering them again. Both color and
+ * depth are restored such that objects rendered afterwards are correctly
+ * hidden by cached ones.
+ *
+ * Colors are stored with premultiplied alpha over a transparent background
+ * and composited over what is already in the framebuffer.
+ *
+ * The cache is tagged with a key describing the view it was rendered with
+ * (see set_key): any change of key invalidates it. It has to be invalidated
+ * by hand when cached objects change.
+ *
+ * Caching needs framebuffer objects and shaders (GL 2.0), begin fails if they
+ * are not available and objects must then be rendered directly.
+ */
+class LayerCache {
+public:
+
+    // _________________________________________________________________________
+
+    /**
+     * @name Creation/Destruction
+     */
+    /**
+     * Default constructor
+     */
+    LayerCache (void);
+
+    /**
+     * Destructor
+     */
+    virtual ~LayerCache (void);
+    //@}
+
+
+    // _________________________________________________________________________
+
+    /**
+     * @name Validity
+     */
+    /**
+     * Whether cache holds an up to date rendering
+     */
+    virtual bool get_valid (void) const;
+
+    /**
+     * Mark cache as out of date
+     */
+    virtual void invalidate (void);
+
+    /**
+     * Set view key, invalidating cache if it differs from the current one.
+     *
+     * @param key values cache content depends on (view orientation, zoom,
+     *            size...)
+     */
+    virtual void set_key (const std::vector<float> &key);
+    //@}
+
+
+    // _________________________________________________________________________
+
+    /**
+     * @name Rendering
+     */
+    /**
+     * Start rendering into the cache.
+     *
+     * The offscreen buffers (resized if needed) are bound and cleared,
+     * viewport and scissor cover them entirely. Matrices are left unchanged.
+     *
+     * @param width  cache width (pixels)
+     * @param height cache height (pixels)
+     * @return false if caching is not available, nothing is bound then
+     */
+    virtual bool begin (int width, int height);
+
+    /**
+     * Finish rendering into the cache and restore previous framebuffer,
+     * viewport and scissor. Cache is then valid.
+     */
+    virtual void end (void);
+
+    /**
+     * Draw cache content (color and depth) over the current viewport.
+     *
+     * @param depth whether to restore depth, only color is drawn otherwise
+     */
+    virtual void draw (bool depth = true);
+
+    /**
+     * Get color texture (premultiplied alpha)
+     */
+    virtual GLuint get_texture (void) const;
+    //@}
+
+
+protected:
+
+    // _________________________________________________________________________
+
+    /**
+     * Create framebuffer, textures and compositing program
+     *
+     * @return false if caching is not available
+     */
+    virtual bool setup (void);
+
+    /**
+     * Bind framebuffer and resize textures if needed
+     *
+     * @return false if framebuffer is not complete
+     */
+    virtual bool resize (int width, int height);
+
+
+protected:
+
+    // _________________________________________________________________________
+
+    /**
+     * Offscreen framebuffer
+     */
+    GLuint framebuffer_;
+
+    /**
+     * Color and depth textures
+     */
+    GLuint textures_[2];
+
+    /**
+     * Compositing program
+     */
+    GLuint program_;
+
+    /**
+     * Framebuffer bound before begin
+     */
+    GLint previous_;
+
+    /**
+     * Size of textures
+     */
+    int width_, height_;
+
+    /**
+     * Whether cache content is up to date
+     */
+    bool valid_;
+
+    /**
+     * Whether caching is not available
+     */
+    bool broken_;
+
+    /**
+     * View key of cache content
+     */
+    std::vector<float> key_;
+};
+
+#endif
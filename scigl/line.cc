@@ -14,7 +14,9 @@
  * this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 #include "line.h"
+#include "render-queue.h"
 #include "shapes.h"
+#include "picker.h"
 
 
 // ________________________________________________________________________ Line
@@ -39,6 +41,43 @@ Line::~Line (void)
 {}
 
 
+// _____________________________________________________________________ prepare
+void
+Line::prepare (WorkerPool &pool)
+{
+    if ((not xdata_) or (not ydata_) or (not zdata_)) {
+        return;
+    }
+    compute_visibility();
+    if (!get_visible()) {
+        return;
+    }
+    kernel_.prepare (kernel_source(), pool);
+}
+
+
+// ______________________________________________________________________ submit
+bool
+Line::submit (RenderQueue &queue)
+{
+    // Thick lines are drawn by render
+    if ((thickness_ > 0) and (thickness_ <= 1.0))
+        return false;
+    if ((not xdata_) or (not ydata_) or (not zdata_))
+        return true;
+    compute_visibility();
+    if (not get_visible())
+        return true;
+    if (not kernel_.consume())
+        kernel_.prepare (kernel_source());
+    if (thickness_ == 0)
+        queue.submit (kernel_, RenderKernel::LINE_STRIP, 1.0);
+    else
+        queue.submit (kernel_, RenderKernel::LINE_STRIP, thickness_);
+    return true;
+}
+
+
 // ______________________________________________________________________ render
 void
 Line::render (void)
@@ -50,314 +89,80 @@ Line::render (void)
     if (!get_visible()) {
         return;
     }
-    unsigned int width        = xdata_->get_width();
-    unsigned int xdata_stride = xdata_->get_stride();
-    unsigned int ydata_stride = ydata_->get_stride();
-    unsigned int zdata_stride = zdata_->get_stride();
-    Color c;
-    double x, y, z, v, r, g, b, a;
-    double x1, y1, z1, s1;
-    double x2, y2, z2, s2;
-    r = fg_color_.r;
-    g = fg_color_.g;
-    b = fg_color_.b;
-    a = fg_color_.a;
+    if (not kernel_.consume())
+        kernel_.prepare (kernel_source());
 
     // -------------------------------------------------------------------------
     //  Rendering using GL_LINE_STRIP
     // -------------------------------------------------------------------------
     if ((thickness_ == 0) or (thickness_ > 1.0)) {
-        glEnable (GL_BLEND);
-        glEnable (GL_LINE_SMOOTH);
+        if (not Picker::get_active()) {
+            glEnable (GL_BLEND);
+            glEnable (GL_LINE_SMOOTH);
+        }
         if (thickness_ == 0)
             glLineWidth (1.0);
         else
             glLineWidth (thickness_);
-
-        // XYZ
-        // ---------------------------------------------------------------------
-        if (not cdata_) {
-            GLbyte *xdata = (GLbyte *) xdata_->get_data();
-            GLbyte *ydata = (GLbyte *) ydata_->get_data();
-            GLbyte *zdata = (GLbyte *) zdata_->get_data();
-            glBegin(GL_LINE_STRIP);
-            for (unsigned int i=0; i<width; i++) {
-                x = * (GLdouble *)(xdata+i*xdata_stride);
-                y = * (GLdouble *)(ydata+i*ydata_stride);
-                z = * (GLdouble *)(zdata+i*zdata_stride);
-                glVertex3f (x,y,z);
-            }
-            glEnd();
-        }
-        else {
-            GLbyte *xdata = (GLbyte *) xdata_->get_data();
-            GLbyte *ydata = (GLbyte *) ydata_->get_data();
-            GLbyte *zdata = (GLbyte *) zdata_->get_data();
-            GLbyte *cdata = (GLbyte *) cdata_->get_data();
-            unsigned int cdata_stride = cdata_->get_stride();
-            
-            // XYZ + C
-            // -----------------------------------------------------------------
-            if (cdata_->get_depth() == 1) {
-                glBegin(GL_LINE_STRIP);
-                for (unsigned int i=0; i<width; i++) {
-                    x = * (GLdouble *)(xdata+i*xdata_stride);
-                    y = * (GLdouble *)(ydata+i*ydata_stride);
-                    z = * (GLdouble *)(zdata+i*zdata_stride);
-                    v = * (GLdouble *)(cdata+i*cdata_stride + 0*sizeof(GLdouble));
-                    Color c = (*cmap_)(v);
-                    r = c.r;
-                    g = c.g;
-                    b = c.b;
-                    a = c.a;
-                    glColor4f(r,g,b,a*alpha_);
-                glVertex3f (x,y,z);
-                }
-                glEnd();
-            }
-            // XYZ + RGB
-            // -----------------------------------------------------------------
-            else if (cdata_->get_depth() == 3) {
-                glBegin(GL_LINE_STRIP);
-                for (unsigned int i=0; i<width; i++) {
-                    x = * (GLdouble *)(xdata+i*xdata_stride);
-                    y = * (GLdouble *)(ydata+i*ydata_stride);
-                    z = * (GLdouble *)(zdata+i*zdata_stride);
-                    r = * (GLdouble *)(cdata+i*cdata_stride + 0*sizeof(GLdouble));
-                    g = * (GLdouble *)(cdata+i*cdata_stride + 1*sizeof(GLdouble));
-                    b = * (GLdouble *)(cdata+i*cdata_stride + 2*sizeof(GLdouble));
-                    glColor4f(r,g,b,alpha_);
-                    glVertex3f (x,y,z);
-                }
-                glEnd();
-            }
-            // XYZ + RGBA
-            // -----------------------------------------------------------------
-            else if (cdata_->get_depth() == 4) {
-                glBegin(GL_LINE_STRIP);
-                for (unsigned int i=0; i<width; i++) {
-                    x = * (GLdouble *)(xdata+i*xdata_stride);
-                    y = * (GLdouble *)(ydata+i*ydata_stride);
-                    z = * (GLdouble *)(zdata+i*zdata_stride);
-                    r = * (GLdouble *)(cdata+i*cdata_stride + 0*sizeof(GLdouble));
-                    g = * (GLdouble *)(cdata+i*cdata_stride + 1*sizeof(GLdouble));
-                    b = * (GLdouble *)(cdata+i*cdata_stride + 2*sizeof(GLdouble));
-                    a = * (GLdouble *)(cdata+i*cdata_stride + 3*sizeof(GLdouble));
-                    glColor4f(r,g,b,a*alpha_);
-                    glVertex3f (x,y,z);
-                }
-            }
-        }
+        kernel_.draw (RenderKernel::LINE_STRIP, false);
     }
 
-
     // -------------------------------------------------------------------------
     //  Rendering using cylinder
     // -------------------------------------------------------------------------
     else {
+        kernel_.draw (RenderKernel::LINE_STRIP, true);
+    }
+}
 
-        // XYZ
-        // ---------------------------------------------------------------------
-        if ((not cdata_) and (not sdata_)) {
-            GLbyte *xdata = (GLbyte *) xdata_->get_data();
-            GLbyte *ydata = (GLbyte *) ydata_->get_data();
-            GLbyte *zdata = (GLbyte *) zdata_->get_data();
-            for (unsigned int i=0; i<(width-1); i++) {
-                x1 = * (GLdouble *)(xdata+i*xdata_stride);
-                y1 = * (GLdouble *)(ydata+i*ydata_stride);
-                z1 = * (GLdouble *)(zdata+i*zdata_stride);
-                x2 = * (GLdouble *)(xdata+(i+1)*xdata_stride);
-                y2 = * (GLdouble *)(ydata+(i+1)*ydata_stride);
-                z2 = * (GLdouble *)(zdata+(i+1)*zdata_stride);
-                cylinder (x1,y1,z1, thickness_, x2,y2,z2, thickness_);
-                sphere (x2,y2,z2, thickness_);
-            }
-        }
-        // XYZ + S
-        // ---------------------------------------------------------------------
-        else if ((not cdata_) and (sdata_)) {
-            GLbyte *xdata = (GLbyte *) xdata_->get_data();
-            GLbyte *ydata = (GLbyte *) ydata_->get_data();
-            GLbyte *zdata = (GLbyte *) zdata_->get_data();
-            GLbyte *sdata = (GLbyte *) sdata_->get_data();
-            unsigned int sdata_stride = sdata_->get_stride();
-            for (unsigned int i=0; i<(width-1); i++) {
-                x1 = * (GLdouble *)(xdata+i*xdata_stride);
-                y1 = * (GLdouble *)(ydata+i*ydata_stride);
-                z1 = * (GLdouble *)(zdata+i*zdata_stride);
-                s1 = * (GLdouble *)(sdata+i*sdata_stride);
-                x2 = * (GLdouble *)(xdata+(i+1)*xdata_stride);
-                y2 = * (GLdouble *)(ydata+(i+1)*ydata_stride);
-                z2 = * (GLdouble *)(zdata+(i+1)*zdata_stride);
-                s2 = * (GLdouble *)(sdata+(i+1)*sdata_stride);
-                cylinder (x1,y1,z1, thickness_ * s1, x2,y2,z2, thickness_ * s2);
-                sphere (x2,y2,z2, thickness_*s2);
-            }
-        }
-        else if ((cdata_) and (not sdata_)) {
-            GLbyte *xdata = (GLbyte *) xdata_->get_data();
-            GLbyte *ydata = (GLbyte *) ydata_->get_data();
-            GLbyte *zdata = (GLbyte *) zdata_->get_data();
-            GLbyte *cdata = (GLbyte *) cdata_->get_data();
-            unsigned int cdata_stride = cdata_->get_stride();
-            
-            // XYZ + C
-            // -----------------------------------------------------------------
-            if (cdata_->get_depth() == 1) {
-                for (unsigned int i=0; i<(width-1); i++) {
-                    x1 = * (GLdouble *)(xdata+i*xdata_stride);
-                    y1 = * (GLdouble *)(ydata+i*ydata_stride);
-                    z1 = * (GLdouble *)(zdata+i*zdata_stride);
-                    x2 = * (GLdouble *)(xdata+(i+1)*xdata_stride);
-                    y2 = * (GLdouble *)(ydata+(i+1)*ydata_stride);
-                    z2 = * (GLdouble *)(zdata+(i+1)*zdata_stride);
-                    v = * (GLdouble *)(cdata+i*cdata_stride + 0*sizeof(GLdouble));
-                    Color c = (*cmap_)(v);
-                    r = c.r;
-                    g = c.g;
-                    b = c.b;
-                    a = c.a;
-                    glColor4f(r,g,b,a*alpha_);
-                    cylinder (x1,y1,z1, thickness_, x2,y2,z2, thickness_);
-                    sphere (x2,y2,z2, thickness_);
-                }
-            }
-            // XYZ + RGB
-            // -----------------------------------------------------------------
-            else if (cdata_->get_depth() == 3) {
-                for (unsigned int i=0; i<(width-1); i++) {
-                    x1 = * (GLdouble *)(xdata+i*xdata_stride);
-                    y1 = * (GLdouble *)(ydata+i*ydata_stride);
-                    z1 = * (GLdouble *)(zdata+i*zdata_stride);
-                    x2 = * (GLdouble *)(xdata+(i+1)*xdata_stride);
-                    y2 = * (GLdouble *)(ydata+(i+1)*ydata_stride);
-                    z2 = * (GLdouble *)(zdata+(i+1)*zdata_stride);
-                    r = * (GLdouble *)(cdata+i*cdata_stride + 0*sizeof(GLdouble));
-                    g = * (GLdouble *)(cdata+i*cdata_stride + 1*sizeof(GLdouble));
-                    b = * (GLdouble *)(cdata+i*cdata_stride + 2*sizeof(GLdouble));
-                    glColor4f(r,g,b,a*alpha_);
-                    cylinder (x1,y1,z1, thickness_, x2,y2,z2, thickness_);
-                    sphere (x2,y2,z2, thickness_);
-                }
-            }
-            // XYZ + RGBA
-            // -----------------------------------------------------------------
-            else if (cdata_->get_depth() == 4) {
-                for (unsigned int i=0; i<(width-1); i++) {
-                    x1 = * (GLdouble *)(xdata+i*xdata_stride);
-                    y1 = * (GLdouble *)(ydata+i*ydata_stride);
-                    z1 = * (GLdouble *)(zdata+i*zdata_stride);
-                    x2 = * (GLdouble *)(xdata+(i+1)*xdata_stride);
-                    y2 = * (GLdouble *)(ydata+(i+1)*ydata_stride);
-                    z2 = * (GLdouble *)(zdata+(i+1)*zdata_stride);
-                    r = * (GLdouble *)(cdata+i*cdata_stride + 0*sizeof(GLdouble));
-                    g = * (GLdouble *)(cdata+i*cdata_stride + 1*sizeof(GLdouble));
-                    b = * (GLdouble *)(cdata+i*cdata_stride + 2*sizeof(GLdouble));
-                    a = * (GLdouble *)(cdata+i*cdata_stride + 3*sizeof(GLdouble));
-                    glColor4f(r,g,b,a*alpha_);
-                    cylinder (x1,y1,z1, thickness_, x2,y2,z2, thickness_);
-                    sphere (x2,y2,z2, thickness_);
-                }
-            }
-        }
 
-        else if ((cdata_) and (sdata_)) {
-            GLbyte *xdata = (GLbyte *) xdata_->get_data();
-            GLbyte *ydata = (GLbyte *) ydata_->get_data();
-            GLbyte *zdata = (GLbyte *) zdata_->get_data();
-            GLbyte *cdata = (GLbyte *) cdata_->get_data();
-            GLbyte *sdata = (GLbyte *) sdata_->get_data();
-            unsigned int cdata_stride = cdata_->get_stride();
-            unsigned int sdata_stride = sdata_->get_stride();
-            
-            // XYZ + S + C
-            // -----------------------------------------------------------------
-            if (cdata_->get_depth() == 1) {
-                for (unsigned int i=0; i<(width-1); i++) {
-                    x1 = * (GLdouble *)(xdata+i*xdata_stride);
-                    y1 = * (GLdouble *)(ydata+i*ydata_stride);
-                    z1 = * (GLdouble *)(zdata+i*zdata_stride);
-                    s1 = * (GLdouble *)(sdata+i*sdata_stride);
-                    x2 = * (GLdouble *)(xdata+(i+1)*xdata_stride);
-                    y2 = * (GLdouble *)(ydata+(i+1)*ydata_stride);
-                    z2 = * (GLdouble *)(zdata+(i+1)*zdata_stride);
-                    s2 = * (GLdouble *)(sdata+(i+1)*sdata_stride);            
-                    v = * (GLdouble *)(cdata+i*cdata_stride + 0*sizeof(GLdouble));
-                    Color c = (*cmap_)(v);
-                    r = c.r;
-                    g = c.g;
-                    b = c.b;
-                    a = c.a;
-                    glColor4f(r,g,b,a*alpha_);
-                    cylinder (x1,y1,z1, thickness_*s1, x2,y2,z2, thickness_*s2);
-                    sphere (x2,y2,z2, thickness_*s2);
-                }
-            }
-            // XYZ + S + RGB
-            // -----------------------------------------------------------------
-            else if (cdata_->get_depth() == 3) {
-                for (unsigned int i=0; i<(width-1); i++) {
-                    x1 = * (GLdouble *)(xdata+i*xdata_stride);
-                    y1 = * (GLdouble *)(ydata+i*ydata_stride);
-                    z1 = * (GLdouble *)(zdata+i*zdata_stride);
-                    s1 = * (GLdouble *)(sdata+i*sdata_stride);
-                    x2 = * (GLdouble *)(xdata+(i+1)*xdata_stride);
-                    y2 = * (GLdouble *)(ydata+(i+1)*ydata_stride);
-                    z2 = * (GLdouble *)(zdata+(i+1)*zdata_stride);
-                    s2 = * (GLdouble *)(sdata+(i+1)*sdata_stride);
-                    r = * (GLdouble *)(cdata+i*cdata_stride + 0*sizeof(GLdouble));
-                    g = * (GLdouble *)(cdata+i*cdata_stride + 1*sizeof(GLdouble));
-                    b = * (GLdouble *)(cdata+i*cdata_stride + 2*sizeof(GLdouble));
-                    glColor4f(r,g,b,a*alpha_);
-                    cylinder (x1,y1,z1, thickness_*s1, x2,y2,z2, thickness_*s2);
-                    sphere (x2,y2,z2, thickness_*s2);
-                }
-            }
-            // XYZ + S + RGBA
-            // -----------------------------------------------------------------
-            else if (cdata_->get_depth() == 4) {
-                for (unsigned int i=0; i<(width-1); i++) {
-                    x1 = * (GLdouble *)(xdata+i*xdata_stride);
-                    y1 = * (GLdouble *)(ydata+i*ydata_stride);
-                    z1 = * (GLdouble *)(zdata+i*zdata_stride);
-                    s1 = * (GLdouble *)(sdata+i*sdata_stride);
-                    x2 = * (GLdouble *)(xdata+(i+1)*xdata_stride);
-                    y2 = * (GLdouble *)(ydata+(i+1)*ydata_stride);
-                    z2 = * (GLdouble *)(zdata+(i+1)*zdata_stride);
-                    s2 = * (GLdouble *)(sdata+(i+1)*sdata_stride);
-                    r = * (GLdouble *)(cdata+i*cdata_stride + 0*sizeof(GLdouble));
-                    g = * (GLdouble *)(cdata+i*cdata_stride + 1*sizeof(GLdouble));
-                    b = * (GLdouble *)(cdata+i*cdata_stride + 2*sizeof(GLdouble));
-                    a = * (GLdouble *)(cdata+i*cdata_stride + 3*sizeof(GLdouble));
-                    glColor4f(r,g,b,a*alpha_);
-                    cylinder (x1,y1,z1, thickness_*s1, x2,y2,z2, thickness_*s2);
-                    sphere (x2,y2,z2, thickness_*s2);
-                }
-            }
-        }
-    }
+
+// ________________________________________________________________ needs_redraw
+bool
+Line::needs_redraw (void) const
+{
+    return Object::needs_redraw() or
+           (get_visible() and kernel_.get_outdated (kernel_source()));
 }
 
 
+// _______________________________________________________________ kernel_source
+RenderKernel::Source
+Line::kernel_source (void) const
+{
+    RenderKernel::Source source;
+    source.xdata = xdata_;
+    source.ydata = ydata_;
+    source.zdata = zdata_;
+    source.sdata = sdata_;
+    source.cdata = cdata_;
+    source.cmap = cmap_;
+    source.color = fg_color_;
+    source.alpha = alpha_;
+    source.thickness = thickness_;
+    return source;
+}
+
 
 // ________________________________________________________________ set_xyz_data
 void
 Line::set_xyz_data (DataPtr xdata, DataPtr ydata, DataPtr zdata)
 {
+    set_dirty ();
     if ((not xdata) or (not ydata) or (not zdata)) {
         throw std::invalid_argument
             ("line: X,Y,Z data must be valid data");
     }
-    if ((not (xdata->get_type() == xdata->get_type())) or
+    if ((not (xdata->get_type() == ydata->get_type())) or
         (not (xdata->get_type() == zdata->get_type()))) {
         throw std::invalid_argument
             ("line: X,Y,Z data must be of same type");
     }
-    if ((not (xdata->get_type() == GL_DOUBLE))) {
+    if (not RenderKernel::supports (xdata->get_type())) {
         throw std::invalid_argument
-            ("line: X,Y,Z data must be of type GL_DOUBLE");
+            ("line: X,Y,Z data must be of type GL_FLOAT or GL_DOUBLE");
     }
-    if ((not (xdata->get_width() == xdata->get_width())) or
+    if ((not (xdata->get_width() == ydata->get_width())) or
         (not (xdata->get_width() == zdata->get_width()))) {
         throw std::invalid_argument
             ("line: X,Y,Z data must be of same size");
@@ -376,8 +181,7 @@ Line::set_xyz_data (DataPtr xdata, DataPtr ydata, DataPtr zdata)
     xdata_ = xdata;
     ydata_ = ydata;
     zdata_ = zdata;
-    id_ = id_counter_;
-    id_ += xdata->get_width();
+    set_id (id_counter_ + xdata->get_width());
 }
 
 
@@ -386,21 +190,22 @@ void
 Line::set_xyz_s_data (DataPtr xdata, DataPtr ydata, DataPtr zdata,
                        DataPtr sdata)
 {
+    set_dirty ();
     if ((not xdata) or (not ydata) or (not zdata) or
         (not sdata) ) {
         throw std::invalid_argument
             ("line: X,Y,Z,S data must be valid data");
     }
-    if ((not (xdata->get_type() == xdata->get_type())) or
+    if ((not (xdata->get_type() == ydata->get_type())) or
         (not (xdata->get_type() == zdata->get_type()))) {
         throw std::invalid_argument
             ("line: X,Y,Z data must be of same type");
     }
-    if ((not (xdata->get_type() == GL_DOUBLE))) {
+    if (not RenderKernel::supports (xdata->get_type())) {
         throw std::invalid_argument
-            ("line: X,Y,Z data must be of type GL_DOUBLE");
+            ("line: X,Y,Z data must be of type GL_FLOAT or GL_DOUBLE");
     }
-    if ((not (xdata->get_width() == xdata->get_width())) or
+    if ((not (xdata->get_width() == ydata->get_width())) or
         (not (xdata->get_width() == zdata->get_width())) or
         (not (xdata->get_width() == sdata->get_width()))) {
         throw std::invalid_argument
@@ -417,17 +222,16 @@ Line::set_xyz_s_data (DataPtr xdata, DataPtr ydata, DataPtr zdata,
         throw std::invalid_argument
             ("line: X,Y,Z,S data must be linear (height=1)");
     }
-    if ((not (sdata->get_type() == GL_DOUBLE))) {
+    if ((not (sdata->get_type() == xdata->get_type()))) {
         throw std::invalid_argument
-            ("line: S data must be of type GL_DOUBLE");
+            ("line: S data must be of same type as X,Y,Z data");
     }
     reset_data();
     xdata_ = xdata;
     ydata_ = ydata;
     zdata_ = zdata;
     sdata_ = sdata;
-    id_ = id_counter_;
-    id_ += xdata->get_width();
+    set_id (id_counter_ + xdata->get_width());
 }
 
 
@@ -436,20 +240,21 @@ void
 Line::set_xyz_c_data (DataPtr xdata, DataPtr ydata, DataPtr zdata,
                        DataPtr cdata)
 {
+    set_dirty ();
     if ((not xdata) or (not ydata) or (not zdata) or (not cdata)) {
         throw std::invalid_argument
             ("line: X,Y,Z,C data must be valid data");
     }
-    if ((not (xdata->get_type() == xdata->get_type())) or
+    if ((not (xdata->get_type() == ydata->get_type())) or
         (not (xdata->get_type() == zdata->get_type()))) {
         throw std::invalid_argument
             ("line: X,Y,Z data must be of same type");
     }
-    if ((not (xdata->get_type() == GL_DOUBLE))) {
+    if (not RenderKernel::supports (xdata->get_type())) {
         throw std::invalid_argument
-            ("line: X,Y,Z data must be of type GL_DOUBLE");
+            ("line: X,Y,Z data must be of type GL_FLOAT or GL_DOUBLE");
     }
-    if ((not (xdata->get_width() == xdata->get_width())) or
+    if ((not (xdata->get_width() == ydata->get_width())) or
         (not (xdata->get_width() == zdata->get_width())) or
         (not (xdata->get_width() == cdata->get_width()))) {
         throw std::invalid_argument
@@ -466,9 +271,9 @@ Line::set_xyz_c_data (DataPtr xdata, DataPtr ydata, DataPtr zdata,
         throw std::invalid_argument
             ("line: X,Y,Z,C data must be linear (height=1)");
     }
-    if ((not (cdata->get_type() == GL_DOUBLE))) {
+    if ((not (cdata->get_type() == xdata->get_type()))) {
         throw std::invalid_argument
-            ("line: C data must be of type GL_DOUBLE");
+            ("line: C data must be of same type as X,Y,Z data");
     }
     if ((not (cdata->get_depth() == 1)) and
         (not (cdata->get_depth() == 3)) and
@@ -481,8 +286,7 @@ Line::set_xyz_c_data (DataPtr xdata, DataPtr ydata, DataPtr zdata,
     ydata_ = ydata;
     zdata_ = zdata;
     cdata_ = cdata;
-    id_ = id_counter_;
-    id_ += xdata->get_width();
+    set_id (id_counter_ + xdata->get_width());
 }
 
 // ____________________________________________________________ set_xyz_s_c_data
@@ -490,21 +294,22 @@ void
 Line::set_xyz_s_c_data (DataPtr xdata, DataPtr ydata, DataPtr zdata,
                         DataPtr sdata, DataPtr cdata)
 {
+    set_dirty ();
     if ((not xdata) or (not ydata) or (not zdata) or
         (not cdata) or (not sdata)) {
         throw std::invalid_argument
             ("line: X,Y,Z,S,C data must be valid data");
     }
-    if ((not (xdata->get_type() == xdata->get_type())) or
+    if ((not (xdata->get_type() == ydata->get_type())) or
         (not (xdata->get_type() == zdata->get_type()))) {
         throw std::invalid_argument
             ("line: X,Y,Z data must be of same type");
     }
-    if ((not (xdata->get_type() == GL_DOUBLE))) {
+    if (not RenderKernel::supports (xdata->get_type())) {
         throw std::invalid_argument
-            ("line: X,Y,Z data must be of type GL_DOUBLE");
+            ("line: X,Y,Z data must be of type GL_FLOAT or GL_DOUBLE");
     }
-    if ((not (xdata->get_width() == xdata->get_width())) or
+    if ((not (xdata->get_width() == ydata->get_width())) or
         (not (xdata->get_width() == zdata->get_width())) or
         (not (xdata->get_width() == sdata->get_width())) or
         (not (xdata->get_width() == cdata->get_width()))) {
@@ -523,10 +328,10 @@ Line::set_xyz_s_c_data (DataPtr xdata, DataPtr ydata, DataPtr zdata,
         throw std::invalid_argument
             ("line: X,Y,Z,C data must be linear (height=1)");
     }
-    if ((not (sdata->get_type() == GL_DOUBLE)) or
-        (not (cdata->get_type() == GL_DOUBLE))) {
+    if ((not (sdata->get_type() == xdata->get_type())) or
+        (not (cdata->get_type() == xdata->get_type()))) {
         throw std::invalid_argument
-            ("line: S,C data must be of type GL_DOUBLE");
+            ("line: S,C data must be of same type as X,Y,Z data");
     }
     if ((not (cdata->get_depth() == 1)) and
         (not (cdata->get_depth() == 3)) and
@@ -540,8 +345,7 @@ Line::set_xyz_s_c_data (DataPtr xdata, DataPtr ydata, DataPtr zdata,
     zdata_ = zdata;
     cdata_ = cdata;
     sdata_ = sdata;
-    id_ = id_counter_;
-    id_ += xdata->get_width();
+    set_id (id_counter_ + xdata->get_width());
 }
 
 // __________________________________________________________________ reset_data
@@ -576,6 +380,7 @@ Line::get_thickness (void) const
 void
 Line::set_thickness (float thickness)
 {
+    set_dirty ();
     thickness_ = thickness;
 }
 
@@ -592,5 +397,6 @@ Line::get_colormap (void)
 void
 Line::set_colormap (ColormapPtr colormap)
 {
+    set_dirty ();
     cmap_ = colormap;
 }
@@ -18,6 +18,7 @@
 #include "object.h"
 #include "colormap.h"
 #include "data.h"
+#include "render-kernel.h"
 
 #if defined(HAVE_BOOST)
 #   include <boost/shared_ptr.hpp>
@@ -52,10 +53,25 @@ public:
     /**
      *  @name Rendering
      */
+    /**
+     * Convert data into vertices using a worker pool
+     */
+    virtual void prepare (WorkerPool &pool);
+
+    /**
+     * Submit thin lines to render queue
+     */
+    virtual bool submit (RenderQueue &queue);
+
     /**
      * 
      */
     void render	(void);
+
+    /**
+     * Whether object needs to be redrawn, including when data changed
+     */
+    virtual bool needs_redraw (void) const;
     //@}
 
 
@@ -156,6 +172,11 @@ protected:
      */
     void reset_data (void);    
 
+    /**
+     * Get kernel input from current data and parameters
+     */
+    RenderKernel::Source kernel_source (void) const;
+
 
 protected:
 
@@ -196,6 +217,11 @@ protected:
      * Data colors
      */
     DataPtr cdata_;
+
+    /**
+     * Vertices prepared for rendering
+     */
+    RenderKernel kernel_;
 };
 
 #endif
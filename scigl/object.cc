@@ -14,7 +14,6 @@
  * You should have received a copy  of the GNU General Public License along with
  * this program. If not, see <http://www.gnu.org/licenses/>.
  */
-#include <sys/time.h>
 #include "object.h"
 
 // _________________________________________________________________ id_counter_
@@ -24,6 +23,8 @@ Object::id_counter_ = 1;
 // ______________________________________________________________________ Object
 Object::Object (void)
 {
+    dirty_ = true;
+    static_ = false;
     set_size (1,1,1);
     set_position (0,0,0);
     set_fg_color (0,0,0,1);
@@ -33,6 +34,9 @@ Object::Object (void)
     set_alpha (1.0f);
     fade_in_delay_ = 0;
     fade_out_delay_ = 0;
+    fade_time_ = 0;
+    fade_pending_ = false;
+    time_ = 0;
     id_ = id_counter_++;
     action_ = "";
 
@@ -56,14 +60,15 @@ Object::get_repr( void )
 void
 Object::compute_visibility (void)
 {
-    // Update visibility and transparency according to current time
-    struct timeval now;
+    // Update visibility and transparency according to current frame time
+    if (fade_pending_) {
+        fade_time_ = time_;
+        fade_pending_ = false;
+    }
 
     // Fade out
     if (fade_out_delay_) {
-        gettimeofday (&now, NULL);
-        float delay = ((now.tv_sec - fade_time_.tv_sec)*1000.0 +
-                       (now.tv_usec - fade_time_.tv_usec)/1000.0);
+        float delay = time_ - fade_time_;
         alpha_ = 1.0f - delay/fade_out_delay_;
         if (alpha_ < 0.0f) {
             fade_out_delay_ = 0;
@@ -73,9 +78,7 @@ Object::compute_visibility (void)
 
     // Fade in
     } else if (fade_in_delay_) {
-        gettimeofday (&now, NULL);
-        float delay = ((now.tv_sec - fade_time_.tv_sec)*1000.0 +
-                       (now.tv_usec - fade_time_.tv_usec)/1000.0);
+        float delay = time_ - fade_time_;
         alpha_ = delay/fade_in_delay_;
         if (alpha_ > 1.0f) {
             fade_in_delay_ = 0;
@@ -97,6 +100,20 @@ Object::update (void)
 {}
 
 
+// _____________________________________________________________________ prepare
+void
+Object::prepare (WorkerPool &pool)
+{}
+
+
+// ______________________________________________________________________ submit
+bool
+Object::submit (RenderQueue &queue)
+{
+    return false;
+}
+
+
 // ______________________________________________________________________ render
 void
 Object::render (void)
@@ -115,6 +132,14 @@ Object::select (int x, int y)
 }
 
 
+// ______________________________________________________________________ select
+bool
+Object::select (Position origin, Direction direction)
+{
+    return false;
+}
+
+
 // _____________________________________________________________ keyboard_action
 bool
 Object::keyboard_action (std::string action, std::string key)
@@ -151,7 +176,12 @@ Object::mouse_action (int x, int y)
 void
 Object::set_name (std::string name)
 {
+    if (name == name_)
+        return;
+    std::string previous = name_;
     name_ = name;
+    for (unsigned int i=0; i<registries_.size(); i++)
+        registries_[i]->renamed (this, previous);
 }
 
 
@@ -179,10 +209,45 @@ Object::check_id (unsigned int id)
 }
 
 
+// ______________________________________________________________________ set_id
+void
+Object::set_id (unsigned long id)
+{
+    if (id == id_)
+        return;
+    unsigned int previous = id_;
+    id_ = id;
+    for (unsigned int i=0; i<registries_.size(); i++)
+        registries_[i]->reidentified (this, previous);
+}
+
+
+// ______________________________________________________________________ attach
+void
+Object::attach (Registry *registry)
+{
+    registries_.push_back (registry);
+}
+
+
+// ______________________________________________________________________ detach
+void
+Object::detach (Registry *registry)
+{
+    for (unsigned int i=0; i<registries_.size(); i++) {
+        if (registries_[i] == registry) {
+            registries_.erase (registries_.begin()+i);
+            return;
+        }
+    }
+}
+
+
 // _________________________________________________________________ set_visible
 void
 Object::set_visible (bool visible)
 {
+    set_dirty ();
     visible_ = visible;
 }
 
@@ -199,8 +264,9 @@ Object::get_visible (void) const
 void
 Object::hide (float timeout)
 {
+    set_dirty ();
     if (timeout) {
-        gettimeofday (&fade_time_, NULL);
+        fade_pending_ = true;
         fade_out_delay_ = timeout;
         fade_in_delay_ = 0;
         alpha_ = 1.0f;
@@ -214,10 +280,11 @@ Object::hide (float timeout)
 void
 Object::show (float timeout)
 {
+    set_dirty ();
     set_visible (true);
     alpha_ = 1.0f;
     if (timeout) {
-        gettimeofday (&fade_time_, NULL);
+        fade_pending_ = true;
         fade_out_delay_ = 0;
         fade_in_delay_ = timeout;
         alpha_ = 0.0f;
@@ -225,10 +292,27 @@ Object::show (float timeout)
 }
 
 
+// ____________________________________________________________________ set_time
+void
+Object::set_time (double time)
+{
+    time_ = time;
+}
+
+
+// ____________________________________________________________________ get_time
+double
+Object::get_time (void) const
+{
+    return time_;
+}
+
+
 // ___________________________________________________________________ set_alpha
 void
 Object::set_alpha (float alpha)
 {
+    set_dirty ();
     alpha_ = alpha;
 }
 
@@ -241,10 +325,44 @@ Object::get_alpha (void) const
 }
 
 
+// ___________________________________________________________________ set_dirty
+void
+Object::set_dirty (bool dirty)
+{
+    dirty_ = dirty;
+}
+
+
+// ________________________________________________________________ needs_redraw
+bool
+Object::needs_redraw (void) const
+{
+    return dirty_ or fade_in_delay_ or fade_out_delay_;
+}
+
+
+// __________________________________________________________________ set_static
+void
+Object::set_static (bool is_static)
+{
+    set_dirty ();
+    static_ = is_static;
+}
+
+
+// __________________________________________________________________ get_static
+bool
+Object::get_static (void) const
+{
+    return static_;
+}
+
+
 // ________________________________________________________________ set_position
 void
 Object::set_position (Position position)
 {
+    set_dirty ();
     position_ = Position (position);
 }
 
@@ -269,6 +387,7 @@ Object::get_position (void) const
 void
 Object::set_size (Size size)
 {
+    set_dirty ();
     size_ = Size (size);
 }
 
@@ -293,6 +412,7 @@ Object::get_size (void) const
 void
 Object::set_fg_color (Color color)
 {
+    set_dirty ();
     fg_color_ = color;
 }
 
@@ -317,6 +437,7 @@ Object::get_fg_color (void) const
 void
 Object::set_bg_color (Color color)
 {
+    set_dirty ();
     bg_color_ = color;
 }
 
@@ -341,6 +462,7 @@ Object::get_bg_color (void) const
 void
 Object::set_br_color (Color color)
 {
+    set_dirty ();
     br_color_ = color;
 }
 
@@ -34,8 +34,13 @@
 #include <stdexcept>
 #include <sstream>
 #include <string>
+#include <vector>
 #include <cstdlib>
 #include "vec4f.h"
+#include "render-state.h"
+
+class WorkerPool;
+class RenderQueue;
 
 
 /**
@@ -56,6 +61,39 @@
  */
 class Object {
 
+public:
+
+    /**
+     * Observer of object name and id.
+     *
+     * Scenes register as such to the objects they contain, such that their
+     * name and id indices follow renames and id changes.
+     */
+    class Registry {
+    public:
+        /**
+         * Destructor
+         */
+        virtual ~Registry (void) {};
+
+        /**
+         * Object has been renamed
+         *
+         * @param object   renamed object
+         * @param previous previous name of object
+         */
+        virtual void renamed (Object *object, const std::string &previous) = 0;
+
+        /**
+         * Object id has changed
+         *
+         * @param object   object
+         * @param previous previous id of object
+         */
+        virtual void reidentified (Object *object, unsigned int previous) = 0;
+    };
+
+
 public:
 
     // _________________________________________________________________________
@@ -89,6 +127,28 @@ public:
      */
     virtual void setup (void);
 
+    /**
+     * Prepare rendering data ahead of rendering
+     *
+     * Scenes call this on all their objects at the start of a frame, before
+     * any of them is rendered. CPU only work (no GL call) may be submitted
+     * to the pool which is waited for before rendering starts.
+     *
+     * @param pool worker pool
+     */
+    virtual void prepare (WorkerPool &pool);
+
+    /**
+     * Submit draw items to a scene render queue instead of rendering
+     *
+     * Objects whose drawing can be merged with other objects (see
+     * RenderQueue) submit it here. Default does nothing.
+     *
+     * @param queue render queue
+     * @return whether object has been handled, render is not called if so
+     */
+    virtual bool submit (RenderQueue &queue);
+
     /**
      * Render the object
      */
@@ -121,6 +181,14 @@ public:
      */
     virtual bool select (int x, int y);
 
+    /**
+     * Select callback
+     *
+     * @param origin    ray origin (object space)
+     * @param direction ray direction (object space)
+     */
+    virtual bool select (Position origin, Direction direction);
+
     /**
      * Keyboard action
      *
@@ -203,6 +271,21 @@ public:
      */
     virtual bool check_id (unsigned int id);
 
+    /**
+     * Attach a registry notified of renames and id changes
+     *
+     * A registry attached n times has to be detached n times.
+     *
+     * @param registry registry to be notified
+     */
+    virtual void attach (Registry *registry);
+
+    /**
+     * Detach a registry
+     *
+     * @param registry registry to be detached
+     */
+    virtual void detach (Registry *registry);
     //@}
 
 
@@ -261,6 +344,73 @@ public:
     //@}
 
 
+    // _________________________________________________________________________
+
+    /**
+     * @name Frame time
+     */
+    /**
+     * Set time of the frame being rendered.
+     *
+     * This is set by the scene rendering the object from its frame clock
+     * such that all objects animate from the very same time within a frame.
+     * Objects made of other objects pass it down to them.
+     *
+     * @param time frame time (ms)
+     */
+    virtual void set_time (double time);
+
+    /**
+     * Get time of the frame being rendered.
+     *
+     * @return frame time (ms)
+     */
+    virtual double get_time (void) const;
+    //@}
+
+
+    // _________________________________________________________________________
+
+    /**
+     * @name Redraw
+     */
+    /**
+     * Set whether object needs to be redrawn
+     *
+     * Setters flag the object dirty on their own. It has to be done by hand
+     * when something the object does not own changes (data modified in
+     * place for example). The flag is cleared once the scene has been
+     * rendered.
+     *
+     * @param dirty whether object needs to be redrawn
+     */
+    virtual void set_dirty (bool dirty = true);
+
+    /**
+     * Whether object needs to be redrawn
+     *
+     * @return true if object is dirty or fading in or out
+     */
+    virtual bool needs_redraw (void) const;
+
+    /**
+     * Set whether object belongs to the static layer of scenes
+     *
+     * When the layer cache of a scene is enabled (see Scene::set_layer_cache),
+     * static objects are only rendered again when one of them needs to be
+     * redrawn or when the view changes.
+     *
+     * @param is_static whether object seldom changes
+     */
+    virtual void set_static (bool is_static = true);
+
+    /**
+     * Whether object belongs to the static layer of scenes
+     */
+    virtual bool get_static (void) const;
+    //@}
+
+
     // _________________________________________________________________________
 
     /**
@@ -458,6 +608,28 @@ protected:
      */
     unsigned long id_;
 
+    /**
+     * Registries notified of renames and id changes
+     */
+    std::vector<Registry *> registries_;
+
+    /**
+     * Change id, notifying registries
+     *
+     * @param id new id
+     */
+    virtual void set_id (unsigned long id);
+
+    /**
+     * Whether object needs to be redrawn
+     */
+    bool dirty_;
+
+    /**
+     * Whether object belongs to the static layer of scenes
+     */
+    bool static_;
+
     /**
      * Unique identifier counter
      */
@@ -499,9 +671,19 @@ protected:
     float alpha_;
 
     /**
-     * Last fade in/out start time
+     * Time of the frame being rendered (ms)
+     */
+    double time_;
+
+    /**
+     * Last fade in/out start time (frame time, ms)
+     */
+    double fade_time_;
+
+    /**
+     * Whether fade in/out start time is to be taken from next frame
      */
-    struct timeval fade_time_;
+    bool fade_pending_;
 
     /**
      * Fade in time delay
@@ -0,0 +1,171 @@
+/*
+ * Copyright (C) 2008 Nicolas P. Rougier
+ *
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "overlay.h"
+
+
+// _____________________________________________________________________ Overlay
+Overlay::Overlay (void)
+{
+    height_ = 0;
+    cleared_ = false;
+}
+
+
+// ____________________________________________________________________ ~Overlay
+Overlay::~Overlay (void)
+{}
+
+
+// ______________________________________________________________________ render
+void
+Overlay::render (const std::vector<WidgetPtr> &widgets)
+{
+    int viewport[4];
+    RenderState::get_viewport (viewport);
+    height_ = viewport[3];
+    cleared_ = false;
+
+    RenderState::push_attrib (GL_ENABLE_BIT | GL_VIEWPORT_BIT | GL_SCISSOR_BIT);
+    RenderState::matrix_mode (GL_PROJECTION);
+    RenderState::push_matrix ();
+    RenderState::load_identity ();
+    RenderState::ortho (0, viewport[2], 0, viewport[3], -1000, 1000);
+    RenderState::matrix_mode (GL_MODELVIEW);
+    RenderState::push_matrix ();
+    RenderState::load_identity ();
+
+    for (unsigned int i=0; i<widgets.size(); i++)
+        if (widgets[i]->get_position().z >= 0)
+            append (widgets[i]);
+    flush ();
+
+    RenderState::matrix_mode (GL_PROJECTION);
+    RenderState::pop_matrix ();
+    RenderState::matrix_mode (GL_MODELVIEW);
+    RenderState::pop_matrix ();
+    RenderState::pop_attrib ();
+}
+
+
+// ______________________________________________________________________ append
+void
+Overlay::append (WidgetPtr widget)
+{
+    widget->compute_visibility ();
+    if (not widget->get_visible())
+        return;
+    widget->compute_size ();
+    widget->compute_position ();
+    widget->compute_decoration (height_);
+
+    // Start a new batch if widget overlaps any widget of current batch
+    float x1 = widget->get_position().x - 1;
+    float y1 = widget->get_position().y - 1;
+    float x2 = widget->get_position().x + widget->get_size().x + 1;
+    float y2 = widget->get_position().y + widget->get_size().y + 1;
+    for (unsigned int i=0; i<areas_.size(); i+=4) {
+        if ((x1 < areas_[i+2]) and (areas_[i] < x2) and
+            (y1 < areas_[i+3]) and (areas_[i+1] < y2)) {
+            flush ();
+            break;
+        }
+    }
+    float area[4] = {x1, y1, x2, y2};
+    areas_.insert (areas_.end(), area, area+4);
+
+    // Background as a triangle fan
+    float alpha = widget->get_alpha();
+    Color bg = widget->get_bg_color();
+    bg.a *= alpha;
+    const std::vector<float> &fill = widget->fill_;
+    for (unsigned int i=2; (i+3)<fill.size(); i+=2) {
+        unsigned int triangle[3] = {0, i, i+2};
+        for (unsigned int j=0; j<3; j++) {
+            float vertex[3] = {fill[triangle[j]], fill[triangle[j]+1], 0};
+            fills_.insert (fills_.end(), vertex, vertex+3);
+            fill_colors_.insert (fill_colors_.end(), bg.data, bg.data+4);
+        }
+    }
+
+    // Border as lines, half a pixel translation for nice antialiasing
+    Color br = widget->get_br_color();
+    br.a *= alpha;
+    const std::vector<float> &border = widget->border_;
+    unsigned int n = border.size()/2;
+    for (unsigned int i=0; br.a and (i<n); i++) {
+        unsigned int segment[2] = {2*i, 2*((i+1)%n)};
+        for (unsigned int j=0; j<2; j++) {
+            float vertex[3] = {border[segment[j]] + 0.315f,
+                               border[segment[j]+1] + 0.315f, 1};
+            borders_.insert (borders_.end(), vertex, vertex+3);
+            border_colors_.insert (border_colors_.end(), br.data, br.data+4);
+        }
+    }
+
+    batch_.push_back (widget);
+}
+
+
+// _______________________________________________________________________ flush
+void
+Overlay::flush (void)
+{
+    if (batch_.empty())
+        return;
+    if (not cleared_) {
+        glClear (GL_DEPTH_BUFFER_BIT);
+        cleared_ = true;
+    }
+
+    glDisable (GL_TEXTURE_2D);
+    glDisable (GL_LIGHTING);
+    glEnable (GL_BLEND);
+    glLineWidth (1.0f);
+    glPolygonMode (GL_FRONT_AND_BACK, GL_FILL);
+    glPolygonOffset (1, 1);
+    glEnable (GL_POLYGON_OFFSET_FILL);
+    glEnable (GL_LINE_SMOOTH);
+    glEnableClientState (GL_VERTEX_ARRAY);
+    glEnableClientState (GL_COLOR_ARRAY);
+    if (fills_.size()) {
+        glVertexPointer (3, GL_FLOAT, 0, &fills_[0]);
+        glColorPointer (4, GL_FLOAT, 0, &fill_colors_[0]);
+        glDrawArrays (GL_TRIANGLES, 0, fills_.size()/3);
+    }
+    glDisable (GL_POLYGON_OFFSET_FILL);
+    if (borders_.size()) {
+        glDepthMask (GL_FALSE);
+        glVertexPointer (3, GL_FLOAT, 0, &borders_[0]);
+        glColorPointer (4, GL_FLOAT, 0, &border_colors_[0]);
+        glDrawArrays (GL_LINES, 0, borders_.size()/3);
+        glDepthMask (GL_TRUE);
+    }
+    glDisableClientState (GL_COLOR_ARRAY);
+    glDisableClientState (GL_VERTEX_ARRAY);
+
+    for (unsigned int i=0; i<batch_.size(); i++) {
+        batch_[i]->overlaid_ = true;
+        batch_[i]->render ();
+        batch_[i]->overlaid_ = false;
+    }
+
+    batch_.clear();
+    areas_.clear();
+    fills_.clear();
+    fill_colors_.clear();
+    borders_.clear();
+    border_colors_.clear();
+}
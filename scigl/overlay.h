@@ -0,0 +1,137 @@
+/*
+ * Copyright (C) 2008 Nicolas P. Rougier
+ *
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef __OVERLAY_H__
+#define __OVERLAY_H__
+#include <vector>
+#include "widget.h"
+
+#if defined(HAVE_BOOST)
+#   include <boost/shared_ptr.hpp>
+    typedef boost::shared_ptr<class Overlay> OverlayPtr;
+#else
+    typedef class Overlay *                  OverlayPtr;
+#endif
+
+
+/**
+ * Compositor for the front widgets of a scene.
+ *
+ * Instead of letting each widget set up its own orthographic projection,
+ * clear the depth buffer and draw its own background and border, the overlay
+ * does it once for a whole set of widgets: projection is set once, depth
+ * buffer is cleared at most once and backgrounds and borders of widgets are
+ * drawn in two batched draw calls from their cached outlines. Each widget
+ * then only renders its content.
+ *
+ * Since backgrounds of a batch are drawn before any content, a widget that
+ * overlaps a previous widget of the batch starts a new batch such that the
+ * final picture is the same as when widgets are rendered one by one.
+ */
+class Overlay {
+public:
+
+    // _________________________________________________________________________
+
+    /**
+     * @name Creation/Destruction
+     */
+    /**
+     * Default constructor
+     */
+    Overlay (void);
+
+    /**
+     * Destructor
+     */
+    virtual ~Overlay (void);
+    //@}
+
+
+    // _________________________________________________________________________
+
+    /**
+     * @name Rendering
+     */
+    /**
+     * Render widgets with a positive z, in order.
+     *
+     * @param widgets widgets to render
+     */
+    virtual void render (const std::vector<WidgetPtr> &widgets);
+    //@}
+
+
+protected:
+
+    // _________________________________________________________________________
+
+    /**
+     * Append widget decoration to current batch.
+     */
+    virtual void append (WidgetPtr widget);
+
+    /**
+     * Draw decorations of current batch, then contents of its widgets.
+     */
+    virtual void flush (void);
+
+
+protected:
+
+    // _________________________________________________________________________
+
+    /**
+     * Widgets of current batch
+     */
+    std::vector<WidgetPtr> batch_;
+
+    /**
+     * Area (x1,y1,x2,y2) covered by widgets of current batch
+     */
+    std::vector<float> areas_;
+
+    /**
+     * Background triangles (x,y,z vertices)
+     */
+    std::vector<float> fills_;
+
+    /**
+     * Background colors (r,g,b,a per vertex)
+     */
+    std::vector<float> fill_colors_;
+
+    /**
+     * Border lines (x,y,z vertices)
+     */
+    std::vector<float> borders_;
+
+    /**
+     * Border colors (r,g,b,a per vertex)
+     */
+    std::vector<float> border_colors_;
+
+    /**
+     * Viewport height
+     */
+    float height_;
+
+    /**
+     * Whether depth buffer has been cleared during current pass
+     */
+    bool cleared_;
+};
+
+#endif
@@ -0,0 +1,253 @@
+/*
+ * Copyright (C) 2008 Nicolas P. Rougier
+ *
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "picker.h"
+
+// Identifier program, the primitive index needs GL_EXT_gpu_shader4
+static const char *picker_vertex_source =
+    "attribute float size;\n"
+    "void main() {\n"
+    "    gl_Position = ftransform();\n"
+    "    gl_PointSize = size;\n"
+    "}\n";
+static const char *picker_fragment_source =
+    "#version 120\n"
+    "#extension GL_EXT_gpu_shader4 : require\n"
+    "uniform vec3 key;\n"
+    "void main() {\n"
+    "    int i = gl_PrimitiveID;\n"
+    "    gl_FragData[0] = vec4 (key, 1.0);\n"
+    "    gl_FragData[1] = vec4 (float(i & 255)/255.0,\n"
+    "                           float((i >> 8) & 255)/255.0,\n"
+    "                           float((i >> 16) & 255)/255.0, 1.0);\n"
+    "}\n";
+static const char *picker_fragment_source_fallback =
+    "uniform vec3 key;\n"
+    "void main() {\n"
+    "    gl_FragData[0] = vec4 (key, 1.0);\n"
+    "    gl_FragData[1] = vec4 (0.0, 0.0, 0.0, 1.0);\n"
+    "}\n";
+
+// ______________________________________________________________ compile_shader
+static GLuint
+compile_shader (GLenum type, const char *source)
+{
+    GLuint shader = glCreateShader (type);
+    glShaderSource (shader, 1, &source, 0);
+    glCompileShader (shader);
+    GLint status;
+    glGetShaderiv (shader, GL_COMPILE_STATUS, &status);
+    if (not status) {
+        glDeleteShader (shader);
+        return 0;
+    }
+    return shader;
+}
+
+
+bool Picker::active_ = false;
+
+
+// ______________________________________________________________________ Picker
+Picker::Picker (void)
+{
+    framebuffer_ = 0;
+    renderbuffers_[0] = renderbuffers_[1] = renderbuffers_[2] = 0;
+    pixelbuffer_ = 0;
+    program_ = 0;
+    key_location_ = -1;
+    width_ = height_ = 0;
+    x_ = y_ = 0;
+    pending_ = false;
+    broken_ = false;
+}
+
+
+// _____________________________________________________________________ ~Picker
+Picker::~Picker (void)
+{
+    if (framebuffer_)
+        glDeleteFramebuffersEXT (1, &framebuffer_);
+    if (renderbuffers_[0])
+        glDeleteRenderbuffersEXT (3, renderbuffers_);
+    if (pixelbuffer_)
+        glDeleteBuffers (1, &pixelbuffer_);
+    if (program_)
+        glDeleteProgram (program_);
+}
+
+
+// _______________________________________________________________________ setup
+bool
+Picker::setup (void)
+{
+    GLuint vertex = compile_shader (GL_VERTEX_SHADER, picker_vertex_source);
+    GLuint fragment = compile_shader (GL_FRAGMENT_SHADER,
+                                      picker_fragment_source);
+    if (not fragment)
+        fragment = compile_shader (GL_FRAGMENT_SHADER,
+                                   picker_fragment_source_fallback);
+    if ((not vertex) or (not fragment))
+        return false;
+
+    program_ = glCreateProgram ();
+    glAttachShader (program_, vertex);
+    glAttachShader (program_, fragment);
+    glBindAttribLocation (program_, POINT_SIZE_ATTRIBUTE, "size");
+    glLinkProgram (program_);
+    glDeleteShader (vertex);
+    glDeleteShader (fragment);
+    GLint status;
+    glGetProgramiv (program_, GL_LINK_STATUS, &status);
+    if (not status)
+        return false;
+    key_location_ = glGetUniformLocation (program_, "key");
+
+    glGenFramebuffersEXT (1, &framebuffer_);
+    glGenRenderbuffersEXT (3, renderbuffers_);
+    glGenBuffers (1, &pixelbuffer_);
+    glBindBuffer (GL_PIXEL_PACK_BUFFER, pixelbuffer_);
+    glBufferData (GL_PIXEL_PACK_BUFFER, 8, 0, GL_STREAM_READ);
+    glBindBuffer (GL_PIXEL_PACK_BUFFER, 0);
+    return true;
+}
+
+
+// ______________________________________________________________________ resize
+bool
+Picker::resize (int width, int height)
+{
+    glBindFramebufferEXT (GL_FRAMEBUFFER_EXT, framebuffer_);
+    if ((width != width_) or (height != height_)) {
+        GLenum formats[3] = {GL_RGBA8, GL_RGBA8, GL_DEPTH_COMPONENT24};
+        GLenum attachments[3] = {GL_COLOR_ATTACHMENT0_EXT,
+                                 GL_COLOR_ATTACHMENT1_EXT,
+                                 GL_DEPTH_ATTACHMENT_EXT};
+        for (unsigned int i=0; i<3; i++) {
+            glBindRenderbufferEXT (GL_RENDERBUFFER_EXT, renderbuffers_[i]);
+            glRenderbufferStorageEXT (GL_RENDERBUFFER_EXT, formats[i],
+                                      width, height);
+            glFramebufferRenderbufferEXT (GL_FRAMEBUFFER_EXT, attachments[i],
+                                          GL_RENDERBUFFER_EXT,
+                                          renderbuffers_[i]);
+        }
+        glBindRenderbufferEXT (GL_RENDERBUFFER_EXT, 0);
+        width_ = width;
+        height_ = height;
+    }
+    if (glCheckFramebufferStatusEXT (GL_FRAMEBUFFER_EXT)
+        != GL_FRAMEBUFFER_COMPLETE_EXT) {
+        glBindFramebufferEXT (GL_FRAMEBUFFER_EXT, 0);
+        return false;
+    }
+    return true;
+}
+
+
+// _______________________________________________________________________ begin
+bool
+Picker::begin (int width, int height, int x, int y)
+{
+    if (broken_)
+        return false;
+    if ((not program_) and (not setup())) {
+        broken_ = true;
+        return false;
+    }
+    if (not resize (width, height))
+        return false;
+    x_ = x;
+    y_ = y;
+
+    glPushAttrib (GL_COLOR_BUFFER_BIT | GL_SCISSOR_BIT | GL_ENABLE_BIT);
+    GLenum buffers[2] = {GL_COLOR_ATTACHMENT0_EXT, GL_COLOR_ATTACHMENT1_EXT};
+    glDrawBuffers (2, buffers);
+    glEnable (GL_SCISSOR_TEST);
+    glScissor (x_, y_, 1, 1);
+    glDisable (GL_BLEND);
+    glDisable (GL_DITHER);
+    glDisable (GL_POINT_SMOOTH);
+    glDisable (GL_LINE_SMOOTH);
+    glDisable (GL_POLYGON_SMOOTH);
+    glClearColor (0, 0, 0, 0);
+    glClear (GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+    RenderState::use_program (program_);
+    set_key (0);
+    active_ = true;
+    return true;
+}
+
+
+// _____________________________________________________________________ set_key
+void
+Picker::set_key (unsigned int key)
+{
+    glUniform3f (key_location_,
+                 ((key      ) & 255)/255.0f,
+                 ((key >>  8) & 255)/255.0f,
+                 ((key >> 16) & 255)/255.0f);
+}
+
+
+// _________________________________________________________________________ end
+void
+Picker::end (void)
+{
+    active_ = false;
+    RenderState::use_program (0);
+    glPixelStorei (GL_PACK_ALIGNMENT, 1);
+    glBindBuffer (GL_PIXEL_PACK_BUFFER, pixelbuffer_);
+    glReadBuffer (GL_COLOR_ATTACHMENT0_EXT);
+    glReadPixels (x_, y_, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, (GLvoid *) 0);
+    glReadBuffer (GL_COLOR_ATTACHMENT1_EXT);
+    glReadPixels (x_, y_, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, (GLvoid *) 4);
+    glBindBuffer (GL_PIXEL_PACK_BUFFER, 0);
+    glBindFramebufferEXT (GL_FRAMEBUFFER_EXT, 0);
+    glPopAttrib ();
+    pending_ = true;
+}
+
+
+// ______________________________________________________________________ result
+bool
+Picker::result (unsigned int &key, unsigned int &index)
+{
+    if (not pending_)
+        return false;
+    pending_ = false;
+    glBindBuffer (GL_PIXEL_PACK_BUFFER, pixelbuffer_);
+    GLubyte *pixels = (GLubyte *) glMapBuffer (GL_PIXEL_PACK_BUFFER,
+                                               GL_READ_ONLY);
+    if (not pixels) {
+        glBindBuffer (GL_PIXEL_PACK_BUFFER, 0);
+        return false;
+    }
+    // Keys are written opaque: anything else is a blend of several keys.
+    key = 0;
+    if (pixels[3] == 255)
+        key = pixels[0] | (pixels[1] << 8) | (pixels[2] << 16);
+    index = pixels[4] | (pixels[5] << 8) | (pixels[6] << 16);
+    glUnmapBuffer (GL_PIXEL_PACK_BUFFER);
+    glBindBuffer (GL_PIXEL_PACK_BUFFER, 0);
+    return true;
+}
+
+
+// __________________________________________________________________ get_active
+bool
+Picker::get_active (void)
+{
+    return active_;
+}
@@ -0,0 +1,194 @@
+/*
+ * Copyright (C) 2008 Nicolas P. Rougier
+ *
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef __PICKER_H__
+#define __PICKER_H__
+#include "object.h"
+
+#if defined(HAVE_BOOST)
+#   include <boost/shared_ptr.hpp>
+    typedef boost::shared_ptr<class Picker> PickerPtr;
+#else
+    typedef class Picker *                  PickerPtr;
+#endif
+
+/**
+ * Generic vertex attribute holding the size of points.
+ *
+ * Programs honouring per-vertex point sizes (see Cloud::render) bind their
+ * size attribute to this location.
+ */
+#define POINT_SIZE_ATTRIBUTE 1
+
+
+/**
+ * Offscreen identifier buffer used for picking.
+ *
+ * Objects are rendered into an offscreen framebuffer with a program that
+ * ignores their colors and writes instead a key identifying the object being
+ * rendered (first color attachment) and the index of the primitive being
+ * rasterized within the current draw call (second color attachment). For a
+ * cloud rendered as points, this index is the point index. Only the picked
+ * pixel is rasterized (scissor) and it is read back asynchronously through a
+ * pixel buffer object, so that the result can be fetched one frame later
+ * without stalling the pipeline.
+ *
+ * Keys and indices are encoded on 24 bits, 0 being reserved for background.
+ */
+class Picker {
+public:
+
+    // _________________________________________________________________________
+
+    /**
+     * @name Creation/Destruction
+     */
+    /**
+     * Default constructor
+     */
+    Picker (void);
+
+    /**
+     * Destructor
+     */
+    virtual ~Picker (void);
+    //@}
+
+
+    // _________________________________________________________________________
+
+    /**
+     * @name Picking
+     */
+    /**
+     * Start an identifier pass.
+     *
+     * Binds the offscreen buffers (resized if needed), restricts rendering to
+     * the picked pixel and installs the identifier program.
+     *
+     * @param width  width of the buffer (window space)
+     * @param height height of the buffer (window space)
+     * @param x      x coordinate of the picked pixel (GL window space)
+     * @param y      y coordinate of the picked pixel (GL window space)
+     * @return false if picking is not supported by the GL implementation
+     */
+    virtual bool begin (int width, int height, int x, int y);
+
+    /**
+     * Set key of the objects rendered from now on.
+     *
+     * @param key object key (1 to 2^24-1)
+     */
+    virtual void set_key (unsigned int key);
+
+    /**
+     * End an identifier pass.
+     *
+     * Issues an asynchronous read of the picked pixel and restores the
+     * previous GL state.
+     */
+    virtual void end (void);
+
+    /**
+     * Get result of the last identifier pass.
+     *
+     * Waits for the read issued by the last pass if it is not available yet.
+     *
+     * @param key   key of the object at picked pixel (0 if none)
+     * @param index index of the primitive at picked pixel
+     * @return false if no pass is pending
+     */
+    virtual bool result (unsigned int &key, unsigned int &index);
+
+    /**
+     * Whether an identifier pass is in progress.
+     *
+     * Objects must not enable blending nor smoothing while it is the case,
+     * since partially covered pixels would blend keys together.
+     */
+    static bool get_active (void);
+    //@}
+
+protected:
+
+    // _________________________________________________________________________
+
+    /**
+     * Build identifier program
+     */
+    virtual bool setup (void);
+
+    /**
+     * (Re)allocate offscreen buffers
+     */
+    virtual bool resize (int width, int height);
+
+
+protected:
+
+    // _________________________________________________________________________
+
+    /**
+     * Offscreen framebuffer
+     */
+    GLuint framebuffer_;
+
+    /**
+     * Key, index and depth renderbuffers
+     */
+    GLuint renderbuffers_[3];
+
+    /**
+     * Pixel buffer receiving key and index of picked pixel
+     */
+    GLuint pixelbuffer_;
+
+    /**
+     * Identifier program
+     */
+    GLuint program_;
+
+    /**
+     * Location of the key uniform
+     */
+    GLint key_location_;
+
+    /**
+     * Buffers size
+     */
+    int width_, height_;
+
+    /**
+     * Picked pixel
+     */
+    int x_, y_;
+
+    /**
+     * Whether a read is pending
+     */
+    bool pending_;
+
+    /**
+     * Whether setup failed
+     */
+    bool broken_;
+
+    /**
+     * Whether an identifier pass is in progress
+     */
+    static bool active_;
+};
+
+#endif
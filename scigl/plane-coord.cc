@@ -68,15 +68,15 @@ PlaneCoord::render (void)
   compute_visibility();
   if (not get_visible()) return;
 
-  glPushMatrix();
+  RenderState::push_matrix();
 
   // set global position and size
-  glScalef (get_size().x, get_size().y, get_size().z);
-  glTranslatef (get_position().x, get_position().y, get_position().z);
+  RenderState::scale (get_size().x, get_size().y, get_size().z);
+  RenderState::translate (get_position().x, get_position().y, get_position().z);
 
   if (get_flipped()) {
-    glTranslatef ( 1, 0, 0);
-    glRotatef (180, 0, 1, 0);
+    RenderState::translate ( 1, 0, 0);
+    RenderState::rotate (180, 0, 1, 0);
   }
 
   glEnable (GL_BLEND);
@@ -101,7 +101,7 @@ PlaneCoord::render (void)
   glDisable (GL_POLYGON_OFFSET_FILL);
   glEnable (GL_LINE_SMOOTH);
 
-  glPushMatrix();
+  RenderState::push_matrix();
   // draw sides (AXIS, LINE or NONE)
   for (int i=0; i<4; i++ )
     {
@@ -120,10 +120,10 @@ PlaneCoord::render (void)
 	default:
 	  {}
 	}
-      glTranslatef( 1, 0, 0);
-      glRotatef( 90, 0, 0, 1);
+      RenderState::translate( 1, 0, 0);
+      RenderState::rotate( 90, 0, 0, 1);
     }
-  glPopMatrix();
+  RenderState::pop_matrix();
 
   // Grid lines
   glEnable (GL_LINE_STIPPLE);
@@ -165,7 +165,7 @@ PlaneCoord::render (void)
 //     }
   glDisable (GL_LINE_STIPPLE);
 
-  glPopMatrix();
+  RenderState::pop_matrix();
   
 }
 // ============================================================================
@@ -185,6 +185,36 @@ PlaneCoord::show (float timeout)
     axis_[i].show (timeout);
   }
 }
+// ============================================================================
+bool
+PlaneCoord::needs_redraw (void) const
+{
+  if (Object::needs_redraw())
+    return true;
+  for (int i=0; i<4; i++)
+    if (axis_[i].needs_redraw())
+      return true;
+  return false;
+}
+void
+PlaneCoord::set_dirty (bool dirty)
+{
+  Object::set_dirty (dirty);
+  if (dirty)
+    return;
+  for (int i=0; i<4; i++)
+    axis_[i].set_dirty (false);
+}
+
+
+// ============================================================================
+void
+PlaneCoord::set_time (double time)
+{
+  Object::set_time (time);
+  for (int i=0; i<4; i++)
+    axis_[i].set_time (time);
+}
 
 
 // ============================================================================
@@ -192,6 +222,7 @@ void
 PlaneCoord::set_sides_type (SideType side1, SideType side2,
 			    SideType side3, SideType side4)
 {
+  set_dirty();
   side_type_[0] = side1;
   side_type_[1] = side2;
   side_type_[2] = side3;
@@ -201,6 +232,7 @@ PlaneCoord::set_sides_type (SideType side1, SideType side2,
 void
 PlaneCoord::set_range_coord1 (Range range)
 {
+  set_dirty();
   axis_[0].set_range (range);
   axis_[2].set_range ( Range( range.max, range.min, range.major, range.minor));
   max_slide1_ = range.max;
@@ -208,6 +240,7 @@ PlaneCoord::set_range_coord1 (Range range)
 void
 PlaneCoord::set_range_coord2 (Range range)
 {
+  set_dirty();
   axis_[1].set_range (range);
   axis_[3].set_range ( Range( range.max, range.min, range.major, range.minor));
   max_slide2_ = range.max;
@@ -227,6 +260,7 @@ PlaneCoord::get_range_coord2 (void)
 void
 PlaneCoord::set_slide_max1 (float max_slide )
 {
+  set_dirty();
   max_slide1_ = max_slide;
   axis_[0].set_slide_max( max_slide1_ );
   axis_[2].set_slide_max( max_slide1_ );
@@ -239,6 +273,7 @@ PlaneCoord::get_slide_max1()
 void
 PlaneCoord::set_slide_max2 (float max_slide )
 {
+  set_dirty();
   max_slide2_ = max_slide;
   axis_[1].set_slide_max( max_slide2_ );
   axis_[3].set_slide_max( max_slide2_ );
@@ -252,6 +287,7 @@ PlaneCoord::get_slide_max2()
 void
 PlaneCoord::set_sliding_coord1( bool flag )
 {
+  set_dirty();
   axis_[0].set_sliding( flag );
   axis_[2].set_sliding( flag );
 }
@@ -263,6 +299,7 @@ PlaneCoord::get_sliding_coord1()
 void
 PlaneCoord::set_sliding_coord2( bool flag )
 {
+  set_dirty();
   axis_[1].set_sliding( flag );
   axis_[3].set_sliding( flag );
 }
@@ -311,12 +348,14 @@ PlaneCoord::get_projection_coord3( float value )
 void
 PlaneCoord::set_title_coord1 (std::string label)
 {
+  set_dirty();
   axis_[0].set_title (label);
   axis_[2].set_title (label);
 }
 void
 PlaneCoord::set_title_coord2 (std::string label)
 {
+  set_dirty();
   axis_[1].set_title (label);
   axis_[3].set_title (label);
 }
@@ -324,6 +363,7 @@ PlaneCoord::set_title_coord2 (std::string label)
 void
 PlaneCoord::set_flipped (bool flip)
 {
+  set_dirty();
   flipped_ = flip;
 }
 bool
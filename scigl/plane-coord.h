@@ -93,6 +93,23 @@ class PlaneCoord : public Object {
   virtual void show (float timeout=0);
   //@}
 
+  /**
+   * @name Redraw
+   */
+  /**
+   * Whether object or any of its axes needs to be redrawn
+   */
+  virtual bool needs_redraw (void) const;
+  /**
+   * Set whether object needs to be redrawn, clearing also clears axes
+   */
+  virtual void set_dirty (bool dirty = true);
+  /**
+   * Set time of the frame being rendered, passed down to axes
+   */
+  virtual void set_time (double time);
+  //@}
+
   // Setter/Getters
   /**
    * @name SidesType
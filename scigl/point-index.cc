@@ -0,0 +1,437 @@
+/*
+ * Copyright (C) 2008 Nicolas P. Rougier
+ *
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <algorithm>
+#include <cmath>
+#include "point-index.h"
+#include "worker-pool.h"
+
+// Maximum number of points in a leaf
+static const unsigned int leaf_size = 16;
+
+// Minimum number of points for a subtree to be built in its own task
+static const unsigned int parallel_size = 65536;
+
+// Compare point indices along one axis
+struct axis_less {
+    const GLbyte *coords;
+    unsigned int stride;
+    bool single;
+    bool operator() (unsigned int i, unsigned int j) const {
+        if (single)
+            return (* (const GLfloat *)(coords+size_t(i)*stride)) <
+                   (* (const GLfloat *)(coords+size_t(j)*stride));
+        return (* (const GLdouble *)(coords+size_t(i)*stride)) <
+               (* (const GLdouble *)(coords+size_t(j)*stride));
+    }
+};
+
+// ________________________________________________________ ray_distance_squared
+static double
+ray_distance_squared (const double p[3],
+                      const double origin[3],
+                      const double direction[3],
+                      double &t)
+{
+    double v[3] = {p[0]-origin[0], p[1]-origin[1], p[2]-origin[2]};
+    t = v[0]*direction[0] + v[1]*direction[1] + v[2]*direction[2];
+    double d = v[0]*v[0] + v[1]*v[1] + v[2]*v[2];
+    if (t > 0)
+        d -= t*t;
+    return d > 0 ? d : 0;
+}
+
+
+// _____________________________________________________________________ Subtree
+class PointIndex::Subtree : public WorkerPool::Task {
+public:
+    Subtree (PointIndex *index, unsigned int n,
+             unsigned int begin, unsigned int end)
+        : index_(index), n_(n), begin_(begin), end_(end)
+    {}
+
+    void run (void)
+    {
+        index_->build_node (n_, begin_, end_, 1, 0);
+    }
+
+protected:
+    PointIndex   *index_;
+    unsigned int  n_, begin_, end_;
+};
+
+
+// __________________________________________________________________ PointIndex
+PointIndex::PointIndex (void)
+{
+    for (unsigned int i=0; i<3; i++) {
+        data_[i] = DataPtr();
+        coords_[i] = 0;
+        strides_[i] = 0;
+    }
+    single_ = false;
+    tree_size_ = size_ = 0;
+}
+
+
+// __________________________________________________________________ PointIndex
+PointIndex::PointIndex (DataPtr xdata, DataPtr ydata, DataPtr zdata)
+{
+    for (unsigned int i=0; i<3; i++) {
+        coords_[i] = 0;
+        strides_[i] = 0;
+    }
+    single_ = false;
+    tree_size_ = size_ = 0;
+    set_data (xdata, ydata, zdata);
+}
+
+
+// _________________________________________________________________ ~PointIndex
+PointIndex::~PointIndex (void)
+{}
+
+
+// ____________________________________________________________________ set_data
+void
+PointIndex::set_data (DataPtr xdata, DataPtr ydata, DataPtr zdata)
+{
+    if ((not xdata) or (not ydata) or (not zdata)) {
+        throw std::invalid_argument
+            ("point index: X,Y,Z data must be valid data");
+    }
+    if (((xdata->get_type() != GL_DOUBLE) and
+         (xdata->get_type() != GL_FLOAT)) or
+        (ydata->get_type() != xdata->get_type()) or
+        (zdata->get_type() != xdata->get_type())) {
+        throw std::invalid_argument
+            ("point index: X,Y,Z data must all be of type GL_FLOAT or GL_DOUBLE");
+    }
+    data_[0] = xdata;
+    data_[1] = ydata;
+    data_[2] = zdata;
+    build ();
+}
+
+
+// _______________________________________________________________________ build
+void
+PointIndex::build (unsigned int threads)
+{
+    tree_size_ = size_ = 0;
+    indices_.clear();
+    nodes_.clear();
+    if (not data_[0])
+        return;
+
+    unsigned int n = data_[0]->get_width();
+    single_ = (data_[0]->get_type() == GL_FLOAT);
+    for (unsigned int i=0; i<3; i++) {
+        coords_[i] = (const GLbyte *) data_[i]->get_data();
+        strides_[i] = data_[i]->get_stride();
+        if (data_[i]->get_width() < n)
+            n = data_[i]->get_width();
+    }
+    if (n == 0)
+        return;
+
+    indices_.resize (n);
+    for (unsigned int i=0; i<n; i++)
+        indices_[i] = i;
+    unsigned int depth = 0;
+    for (unsigned int count=n; count > leaf_size; count = (count+1)/2)
+        depth++;
+    nodes_.resize ((2u << depth) - 1);
+
+    WorkerPoolPtr pool = WorkerPool::Default();
+    if (threads == 0)
+        threads = pool->get_size() + 1;
+    if ((threads > 1) and (n >= parallel_size)) {
+        build_node (0, 0, n, threads, &*pool);
+        pool->wait ();
+    } else {
+        build_node (0, 0, n, 1, 0);
+    }
+    tree_size_ = size_ = n;
+}
+
+
+// __________________________________________________________________ build_node
+void
+PointIndex::build_node (unsigned int n,
+                        unsigned int begin,
+                        unsigned int end,
+                        unsigned int threads,
+                        WorkerPool *pool)
+{
+    // Subtrees below the split levels are built by pool workers
+    if (pool and ((threads <= 1) or ((end-begin) < parallel_size))) {
+        pool->submit (new Subtree (this, n, begin, end));
+        return;
+    }
+
+    Node &node = nodes_[n];
+    node.begin = begin;
+    node.end = end;
+    for (unsigned int axis=0; axis<3; axis++) {
+        node.min[axis] = node.max[axis] = coordinate (indices_[begin], axis);
+        for (unsigned int i=begin+1; i<end; i++) {
+            double c = coordinate (indices_[i], axis);
+            if (c < node.min[axis])
+                node.min[axis] = c;
+            else if (c > node.max[axis])
+                node.max[axis] = c;
+        }
+    }
+    node.leaf = (end-begin) <= leaf_size;
+    if (node.leaf)
+        return;
+
+    // Split at median along largest extent
+    unsigned int axis = 0;
+    for (unsigned int i=1; i<3; i++)
+        if ((node.max[i]-node.min[i]) > (node.max[axis]-node.min[axis]))
+            axis = i;
+    unsigned int mid = (begin+end)/2;
+    axis_less less;
+    less.coords = coords_[axis];
+    less.stride = strides_[axis];
+    less.single = single_;
+    std::nth_element (indices_.begin()+begin,
+                      indices_.begin()+mid,
+                      indices_.begin()+end, less);
+
+    build_node (2*n+1, begin, mid, threads/2, pool);
+    build_node (2*n+2, mid, end, threads - threads/2, pool);
+}
+
+
+// ______________________________________________________________________ update
+void
+PointIndex::update (void)
+{
+    if (not data_[0])
+        return;
+    unsigned int n = data_[0]->get_width();
+    for (unsigned int i=0; i<3; i++) {
+        if (data_[i]->get_width() < n)
+            n = data_[i]->get_width();
+        // Data may have been reallocated when growing
+        coords_[i] = (const GLbyte *) data_[i]->get_data();
+        strides_[i] = data_[i]->get_stride();
+    }
+
+    // Rebuild once pending points represent a quarter of the tree, which
+    // keeps the amortized cost of an append logarithmic.
+    if ((n < tree_size_) or ((n - tree_size_) > std::max (leaf_size,
+                                                          tree_size_/4)))
+        build ();
+    else
+        size_ = n;
+}
+
+
+// ____________________________________________________________________ get_size
+unsigned int
+PointIndex::get_size (void) const
+{
+    return size_;
+}
+
+
+// ______________________________________________________________ nearest_to_ray
+int
+PointIndex::nearest_to_ray (Position origin,
+                            Direction direction,
+                            float radius) const
+{
+    double bound = -1;
+    if (radius >= 0)
+        bound = double(radius)*double(radius);
+    return nearest_to_ray (origin, direction, bound, 0, 0);
+}
+
+
+// ______________________________________________________________ nearest_to_ray
+int
+PointIndex::nearest_to_ray (Position origin,
+                            Direction direction,
+                            const std::vector<GLfloat> &radii) const
+{
+    if (radii.empty())
+        return -1;
+    double bound = 0;
+    for (unsigned int i=0; i<radii.size(); i++)
+        if (double(radii[i])*double(radii[i]) > bound)
+            bound = double(radii[i])*double(radii[i]);
+    return nearest_to_ray (origin, direction, bound, &radii[0], radii.size());
+}
+
+
+// ______________________________________________________________ nearest_to_ray
+int
+PointIndex::nearest_to_ray (Position origin,
+                            Direction direction,
+                            double bound,
+                            const GLfloat *radii,
+                            unsigned int count) const
+{
+    double o[3] = {origin.x, origin.y, origin.z};
+    double d[3] = {direction.x, direction.y, direction.z};
+    double norm = sqrt (d[0]*d[0] + d[1]*d[1] + d[2]*d[2]);
+    if (norm == 0)
+        return -1;
+    for (unsigned int i=0; i<3; i++)
+        d[i] /= norm;
+
+    int best = -1;
+    double best_distance = HUGE_VAL;
+    if (bound >= 0)
+        best_distance = bound;
+    if (tree_size_)
+        nearest_to_ray (0, o, d, radii, count, best, best_distance);
+
+    // Points appended since last build
+    for (unsigned int i=tree_size_; i<size_; i++) {
+        if (radii and (i >= count))
+            break;
+        double p[3] = {coordinate (i,0), coordinate (i,1), coordinate (i,2)};
+        double t;
+        double distance = ray_distance_squared (p, o, d, t);
+        if ((t >= 0) and (distance <= best_distance) and
+            ((not radii) or (distance <= double(radii[i])*double(radii[i])))) {
+            best = i;
+            best_distance = distance;
+        }
+    }
+    return best;
+}
+
+
+// ______________________________________________________________ nearest_to_ray
+void
+PointIndex::nearest_to_ray (unsigned int n,
+                            const double origin[3],
+                            const double direction[3],
+                            const GLfloat *radii,
+                            unsigned int count,
+                            int &best,
+                            double &best_distance) const
+{
+    const Node &node = nodes_[n];
+    if (node.leaf) {
+        for (unsigned int i=node.begin; i<node.end; i++) {
+            unsigned int j = indices_[i];
+            if (radii and (j >= count))
+                continue;
+            double p[3] = {coordinate (j,0), coordinate (j,1), coordinate (j,2)};
+            double t;
+            double distance = ray_distance_squared (p, origin, direction, t);
+            if ((t >= 0) and (distance <= best_distance) and
+                ((not radii) or
+                 (distance <= double(radii[j])*double(radii[j])))) {
+                best = j;
+                best_distance = distance;
+            }
+        }
+        return;
+    }
+
+    // Lower bound of distance between ray and a child using its bounding
+    // sphere, closest child is searched first.
+    double bound[2];
+    for (unsigned int c=0; c<2; c++) {
+        const Node &child = nodes_[2*n+1+c];
+        double center[3], r = 0, t;
+        for (unsigned int i=0; i<3; i++) {
+            center[i] = (child.min[i]+child.max[i])/2;
+            r += (child.max[i]-child.min[i])*(child.max[i]-child.min[i])/4;
+        }
+        double d = sqrt (ray_distance_squared (center, origin, direction, t))
+                 - sqrt (r);
+        bound[c] = d > 0 ? d*d : 0;
+    }
+    unsigned int first = bound[1] < bound[0] ? 1 : 0;
+    if (bound[first] <= best_distance)
+        nearest_to_ray (2*n+1+first, origin, direction, radii, count,
+                        best, best_distance);
+    if (bound[1-first] <= best_distance)
+        nearest_to_ray (2*n+2-first, origin, direction, radii, count,
+                        best, best_distance);
+}
+
+
+// ___________________________________________________________________ box_query
+void
+PointIndex::box_query (Position min,
+                       Position max,
+                       std::vector<unsigned int> &result) const
+{
+    double lo[3] = {min.x, min.y, min.z};
+    double hi[3] = {max.x, max.y, max.z};
+    result.clear();
+    if (tree_size_)
+        box_query (0, lo, hi, result);
+
+    // Points appended since last build
+    for (unsigned int i=tree_size_; i<size_; i++) {
+        bool inside = true;
+        for (unsigned int axis=0; inside and (axis<3); axis++) {
+            double c = coordinate (i, axis);
+            inside = (c >= lo[axis]) and (c <= hi[axis]);
+        }
+        if (inside)
+            result.push_back (i);
+    }
+}
+
+
+// ___________________________________________________________________ box_query
+void
+PointIndex::box_query (unsigned int n,
+                       const double min[3],
+                       const double max[3],
+                       std::vector<unsigned int> &result) const
+{
+    const Node &node = nodes_[n];
+    bool contained = true;
+    for (unsigned int axis=0; axis<3; axis++) {
+        if ((node.max[axis] < min[axis]) or (node.min[axis] > max[axis]))
+            return;
+        if ((node.min[axis] < min[axis]) or (node.max[axis] > max[axis]))
+            contained = false;
+    }
+    if (contained) {
+        result.insert (result.end(),
+                       indices_.begin()+node.begin,
+                       indices_.begin()+node.end);
+        return;
+    }
+    if (not node.leaf) {
+        box_query (2*n+1, min, max, result);
+        box_query (2*n+2, min, max, result);
+        return;
+    }
+    for (unsigned int i=node.begin; i<node.end; i++) {
+        unsigned int j = indices_[i];
+        bool inside = true;
+        for (unsigned int axis=0; inside and (axis<3); axis++) {
+            double c = coordinate (j, axis);
+            inside = (c >= min[axis]) and (c <= max[axis]);
+        }
+        if (inside)
+            result.push_back (j);
+    }
+}
@@ -0,0 +1,271 @@
+/*
+ * Copyright (C) 2008 Nicolas P. Rougier
+ *
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef __POINT_INDEX_H__
+#define __POINT_INDEX_H__
+#include <vector>
+#include "data.h"
+
+class WorkerPool;
+
+#if defined(HAVE_BOOST)
+#   include <boost/shared_ptr.hpp>
+    typedef boost::shared_ptr<class PointIndex> PointIndexPtr;
+#else
+    typedef class PointIndex *                  PointIndexPtr;
+#endif
+
+
+/**
+ * Spatial index (k-d tree) over a set of points.
+ *
+ * Points are given as three linear (height=1) GL_FLOAT or GL_DOUBLE data
+ * holding x, y and z coordinates, as for a Cloud. The index only stores point
+ * indices and reads coordinates from data, hence it does not need any GL
+ * context.
+ *
+ * The tree is balanced and stored implicitly (children of node n are nodes
+ * 2n+1 and 2n+2), which allows its upper levels to be built in parallel.
+ * Points appended to data afterwards (data width increased) are picked up by
+ * update: they are first kept aside and scanned linearly, until they
+ * represent a significant part of the points and the tree is rebuilt.
+ *
+ * If existing points are modified, the index must be rebuilt using build.
+ */
+class PointIndex {
+public:
+
+    // _________________________________________________________________________
+
+    /**
+     * @name Creation/Destruction
+     */
+    /**
+     * Default constructor
+     */
+    PointIndex (void);
+
+    /**
+     * Constructor
+     *
+     * @param xdata data x coordinates
+     * @param ydata data y coordinates
+     * @param zdata data z coordinates
+     */
+    PointIndex (DataPtr xdata, DataPtr ydata, DataPtr zdata);
+
+    /**
+     * Destructor
+     */
+    virtual ~PointIndex (void);
+    //@}
+
+
+    // _________________________________________________________________________
+
+    /**
+     * @name Building
+     */
+    /**
+     * Set x,y,z data and build index
+     *
+     * @param xdata data x coordinates
+     * @param ydata data y coordinates
+     * @param zdata data z coordinates
+     */
+    virtual void set_data (DataPtr xdata, DataPtr ydata, DataPtr zdata);
+
+    /**
+     * Build index over all points
+     *
+     * Large trees are built in parallel on the shared worker pool, the top
+     * levels being split by the calling thread. It must hence not be called
+     * from a task of that pool.
+     *
+     * @param threads maximum number of concurrent subtrees (0 means one per
+     *                worker plus the calling thread)
+     */
+    virtual void build (unsigned int threads = 0);
+
+    /**
+     * Take into account points appended since last build or update
+     */
+    virtual void update (void);
+
+    /**
+     * Get number of indexed points
+     */
+    virtual unsigned int get_size (void) const;
+    //@}
+
+
+    // _________________________________________________________________________
+
+    /**
+     * @name Queries
+     */
+    /**
+     * Find point nearest to a ray
+     *
+     * Only points in front of origin are considered.
+     *
+     * @param origin    ray origin
+     * @param direction ray direction
+     * @param radius    maximum distance to the ray (negative means none)
+     * @return index of nearest point or -1 if there is none
+     */
+    virtual int nearest_to_ray (Position origin,
+                                Direction direction,
+                                float radius = -1) const;
+
+    /**
+     * Find point nearest to a ray among points having their own radius
+     *
+     * Only points in front of origin whose distance to the ray is at most
+     * their radius are considered.
+     *
+     * @param origin    ray origin
+     * @param direction ray direction
+     * @param radii     radius of each point (points beyond its size are
+     *                  ignored)
+     * @return index of nearest point or -1 if there is none
+     */
+    virtual int nearest_to_ray (Position origin,
+                                Direction direction,
+                                const std::vector<GLfloat> &radii) const;
+
+    /**
+     * Find points inside an axis aligned box
+     *
+     * @param min    box minimum corner
+     * @param max    box maximum corner
+     * @param result receives indices of points inside box
+     */
+    virtual void box_query (Position min,
+                            Position max,
+                            std::vector<unsigned int> &result) const;
+    //@}
+
+protected:
+
+    // _________________________________________________________________________
+
+    /**
+     * Tree node
+     */
+    struct Node {
+        double       min[3], max[3];
+        unsigned int begin, end;
+        bool         leaf;
+    };
+
+    /**
+     * Get coordinate of a point along an axis
+     */
+    double coordinate (unsigned int i, unsigned int axis) const
+    {
+        const GLbyte *coord = coords_[axis] + size_t(i)*strides_[axis];
+        if (single_)
+            return * (const GLfloat *) coord;
+        return * (const GLdouble *) coord;
+    }
+
+    /**
+     * Build node n over indices_[begin,end)
+     */
+    virtual void build_node (unsigned int n,
+                             unsigned int begin,
+                             unsigned int end,
+                             unsigned int threads,
+                             WorkerPool *pool);
+
+    /**
+     * Task building a subtree
+     */
+    class Subtree;
+    friend class Subtree;
+
+    /**
+     * Find point nearest to a ray within bound (squared distance, infinite
+     * if negative) and within its own radius if radii is given
+     */
+    virtual int nearest_to_ray (Position origin,
+                                Direction direction,
+                                double bound,
+                                const GLfloat *radii,
+                                unsigned int count) const;
+
+    /**
+     * Search node n for point nearest to a ray
+     */
+    virtual void nearest_to_ray (unsigned int n,
+                                 const double origin[3],
+                                 const double direction[3],
+                                 const GLfloat *radii,
+                                 unsigned int count,
+                                 int &best,
+                                 double &best_distance) const;
+
+    /**
+     * Search node n for points inside a box
+     */
+    virtual void box_query (unsigned int n,
+                            const double min[3],
+                            const double max[3],
+                            std::vector<unsigned int> &result) const;
+
+
+protected:
+
+    // _________________________________________________________________________
+
+    /**
+     * Data x, y and z coordinates
+     */
+    DataPtr data_[3];
+
+    /**
+     * Raw coordinates and strides
+     */
+    const GLbyte *coords_[3];
+    unsigned int strides_[3];
+
+    /**
+     * Whether coordinates are GL_FLOAT (GL_DOUBLE otherwise)
+     */
+    bool single_;
+
+    /**
+     * Point indices, ordered such that each node covers a contiguous range
+     */
+    std::vector<unsigned int> indices_;
+
+    /**
+     * Tree nodes
+     */
+    std::vector<Node> nodes_;
+
+    /**
+     * Number of points in tree
+     */
+    unsigned int tree_size_;
+
+    /**
+     * Number of points indexed (tree + pending ones)
+     */
+    unsigned int size_;
+};
+
+#endif
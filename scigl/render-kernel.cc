@@ -0,0 +1,388 @@
+/*
+ * Copyright (C) 2008 Nicolas P. Rougier
+ *
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "render-kernel.h"
+#include "shapes.h"
+
+// Number of vertices converted by a single task
+static const unsigned int chunk_size = 65536;
+
+// Last version given to prepared vertices of any kernel
+static unsigned long kernel_version = 0;
+
+
+// _______________________________________________________________________ Chunk
+class RenderKernel::Chunk : public WorkerPool::Task {
+public:
+    Chunk (RenderKernel *kernel, const Source &source,
+           unsigned int first, unsigned int last)
+        : kernel_(kernel), source_(source), first_(first), last_(last)
+    {}
+
+    void run (void)
+    {
+        kernel_->prepare_range (source_, first_, last_);
+    }
+
+protected:
+    RenderKernel *kernel_;
+    Source        source_;
+    unsigned int  first_, last_;
+};
+
+
+// ________________________________________________________________ RenderKernel
+RenderKernel::RenderKernel (void)
+{
+    count_ = 0;
+    prepared_ = false;
+    thickness_ = 1;
+    cmap_min_ = cmap_max_ = 0;
+    version_ = ++kernel_version;
+    translucent_ = false;
+    translucent_version_ = 0;
+    for (unsigned int i=0; i<5; i++) {
+        data_[i] = 0;
+        versions_[i] = 0;
+    }
+}
+
+
+// _______________________________________________________________ ~RenderKernel
+RenderKernel::~RenderKernel (void)
+{}
+
+
+// _____________________________________________________________________ prepare
+void
+RenderKernel::prepare (const Source &source)
+{
+    unsigned int first, last;
+    setup (source, first, last);
+    prepare_range (source, first, last);
+}
+
+
+// _____________________________________________________________________ prepare
+void
+RenderKernel::prepare (const Source &source, WorkerPool &pool)
+{
+    unsigned int first, last;
+    setup (source, first, last);
+    for (; first<last; first+=chunk_size) {
+        unsigned int end = first+chunk_size;
+        if (end > last)
+            end = last;
+        pool.submit (new Chunk (this, source, first, end));
+    }
+    prepared_ = true;
+}
+
+
+// _____________________________________________________________________ consume
+bool
+RenderKernel::consume (void)
+{
+    bool prepared = prepared_;
+    prepared_ = false;
+    return prepared;
+}
+
+
+// _______________________________________________________________________ setup
+void
+RenderKernel::setup (const Source &source,
+                     unsigned int &first, unsigned int &last)
+{
+    const Data *data[5] = {0, 0, 0, 0, 0};
+    if (source.xdata) data[0] = &*source.xdata;
+    if (source.ydata) data[1] = &*source.ydata;
+    if (source.zdata) data[2] = &*source.zdata;
+    if (source.sdata) data[3] = &*source.sdata;
+    if (source.cdata) data[4] = &*source.cdata;
+    Color color = source.color;
+    color.a *= source.alpha;
+    float cmap_min = 0, cmap_max = 0;
+    if (source.cmap) {
+        cmap_min = source.cmap->get_min();
+        cmap_max = source.cmap->get_max();
+    }
+    unsigned int count = 0;
+    if (data[0] and data[1] and data[2])
+        count = data[0]->get_width();
+
+    // Everything is converted again when anything but data values changed
+    bool whole = (count != count_) or
+                 (source.thickness != thickness_) or
+                 (color.r != color_.r) or (color.g != color_.g) or
+                 (color.b != color_.b) or (color.a != color_.a) or
+                 (source.cmap != cmap_) or
+                 (cmap_min != cmap_min_) or (cmap_max != cmap_max_);
+    for (unsigned int i=0; i<5; i++)
+        whole = whole or (data[i] != data_[i]);
+
+    color_ = color;
+    thickness_ = source.thickness;
+    cmap_ = source.cmap;
+    cmap_min_ = cmap_min;
+    cmap_max_ = cmap_max;
+    count_ = count;
+    positions_.resize (3*count_);
+    if (source.sdata)
+        sizes_.resize (count_);
+    else
+        sizes_.clear ();
+    if (source.cdata)
+        colors_.resize (4*count_);
+    else
+        colors_.clear ();
+
+    // Otherwise only elements changed since last conversion
+    first = count_;
+    last = 0;
+    for (unsigned int i=0; i<5; i++) {
+        data_[i] = data[i];
+        if (not data[i])
+            continue;
+        unsigned int offset, n;
+        if (data[i]->get_dirty (versions_[i], offset, n) and n) {
+            if (offset < first)
+                first = offset;
+            if (offset+n > last)
+                last = offset+n;
+        }
+        versions_[i] = data[i]->get_version();
+    }
+    if (whole) {
+        first = 0;
+        last = count_;
+    }
+    if (last > count_)
+        last = count_;
+    if (first < last)
+        version_ = ++kernel_version;
+}
+
+
+// _______________________________________________________________ prepare_range
+void
+RenderKernel::prepare_range (const Source &source,
+                             unsigned int first, unsigned int last)
+{
+    if (first >= last)
+        return;
+    if (source.xdata->get_type() == GL_FLOAT)
+        prepare_type<GLfloat> (source, first, last);
+    else
+        prepare_type<GLdouble> (source, first, last);
+}
+
+
+// ________________________________________________________________ get_outdated
+bool
+RenderKernel::get_outdated (const Source &source) const
+{
+    DataPtr data[5] = {source.xdata, source.ydata, source.zdata,
+                       source.sdata, source.cdata};
+    for (unsigned int i=0; i<5; i++) {
+        const Data *d = data[i] ? &*data[i] : 0;
+        if (d != data_[i])
+            return true;
+        if (d and ((d->get_version() != versions_[i]) or d->get_pending()))
+            return true;
+    }
+    return false;
+}
+
+
+// ____________________________________________________________________ supports
+bool
+RenderKernel::supports (GLenum type)
+{
+    return (type == GL_FLOAT) or (type == GL_DOUBLE);
+}
+
+
+// ___________________________________________________________________ get_count
+unsigned int
+RenderKernel::get_count (void) const
+{
+    return count_;
+}
+
+
+// _______________________________________________________________ get_positions
+const std::vector<GLfloat> &
+RenderKernel::get_positions (void) const
+{
+    return positions_;
+}
+
+
+// __________________________________________________________________ get_colors
+const std::vector<GLfloat> &
+RenderKernel::get_colors (void) const
+{
+    return colors_;
+}
+
+
+// ___________________________________________________________________ get_sizes
+const std::vector<GLfloat> &
+RenderKernel::get_sizes (void) const
+{
+    return sizes_;
+}
+
+
+// ___________________________________________________________________ get_color
+const Color &
+RenderKernel::get_color (void) const
+{
+    return color_;
+}
+
+
+// _________________________________________________________________ get_version
+unsigned long
+RenderKernel::get_version (void) const
+{
+    return version_;
+}
+
+
+// _____________________________________________________________ get_translucent
+bool
+RenderKernel::get_translucent (void) const
+{
+    if (translucent_version_ == version_)
+        return translucent_;
+    translucent_version_ = version_;
+    translucent_ = false;
+    if (colors_.empty()) {
+        translucent_ = color_.a < 1;
+    } else {
+        for (unsigned int i=3; (i<colors_.size()) and (not translucent_); i+=4)
+            translucent_ = colors_[i] < 1;
+    }
+    return translucent_;
+}
+
+
+// ________________________________________________________________________ bind
+void
+RenderKernel::bind (void)
+{
+    glEnableClientState (GL_VERTEX_ARRAY);
+    glVertexPointer (3, GL_FLOAT, 0, &positions_[0]);
+    if (colors_.size()) {
+        glEnableClientState (GL_COLOR_ARRAY);
+        glColorPointer (4, GL_FLOAT, 0, &colors_[0]);
+    } else {
+        glColor4f (color_.r, color_.g, color_.b, color_.a);
+    }
+}
+
+
+// ______________________________________________________________________ unbind
+void
+RenderKernel::unbind (void)
+{
+    if (colors_.size())
+        glDisableClientState (GL_COLOR_ARRAY);
+    glDisableClientState (GL_VERTEX_ARRAY);
+}
+
+
+// ________________________________________________________________________ draw
+void
+RenderKernel::draw (Primitive primitive, bool thick)
+{
+    if (not count_)
+        return;
+
+    if (not thick) {
+        GLenum mode = GL_POINTS;
+        if (primitive == LINE_STRIP)
+            mode = GL_LINE_STRIP;
+        else if (primitive == LINES)
+            mode = GL_LINES;
+        bind ();
+        glDrawArrays (mode, 0, count_);
+        unbind ();
+        return;
+    }
+
+    if (colors_.empty())
+        glColor4f (color_.r, color_.g, color_.b, color_.a);
+    bool colored = not colors_.empty();
+    bool sized = not sizes_.empty();
+    if (primitive == POINTS) {
+        if      (colored and sized) draw_kernel<POINTS, true,  true>  ();
+        else if (colored)           draw_kernel<POINTS, true,  false> ();
+        else if (sized)             draw_kernel<POINTS, false, true>  ();
+        else                        draw_kernel<POINTS, false, false> ();
+    } else if (primitive == LINE_STRIP) {
+        if      (colored and sized) draw_kernel<LINE_STRIP, true,  true>  ();
+        else if (colored)           draw_kernel<LINE_STRIP, true,  false> ();
+        else if (sized)             draw_kernel<LINE_STRIP, false, true>  ();
+        else                        draw_kernel<LINE_STRIP, false, false> ();
+    } else {
+        if      (colored and sized) draw_kernel<LINES, true,  true>  ();
+        else if (colored)           draw_kernel<LINES, true,  false> ();
+        else if (sized)             draw_kernel<LINES, false, true>  ();
+        else                        draw_kernel<LINES, false, false> ();
+    }
+}
+
+
+// _________________________________________________________________ draw_kernel
+template <int PRIMITIVE, bool COLORED, bool SIZED>
+void
+RenderKernel::draw_kernel (void)
+{
+    const GLfloat *p = &positions_[0];
+    const GLfloat *c = COLORED ? &colors_[0] : 0;
+    const GLfloat *s = SIZED ? &sizes_[0] : 0;
+    GLfloat r1 = thickness_, r2 = thickness_;
+
+    // Spheres
+    if (PRIMITIVE == POINTS) {
+        for (unsigned int i=0; i<count_; i++) {
+            if (COLORED)
+                glColor4fv (c+4*i);
+            if (SIZED)
+                r1 = s[i];
+            sphere (p[3*i+0], p[3*i+1], p[3*i+2], r1);
+        }
+        return;
+    }
+
+    // Cylinders joining consecutive vertices (strip) or vertex pairs (lines)
+    unsigned int step = (PRIMITIVE == LINE_STRIP) ? 1 : 2;
+    for (unsigned int i=0; i+1<count_; i+=step) {
+        const GLfloat *p1 = p+3*i;
+        const GLfloat *p2 = p+3*(i+1);
+        if (COLORED)
+            glColor4fv (c+4*i);
+        if (SIZED) {
+            r1 = s[i];
+            r2 = s[i+1];
+        }
+        cylinder (p1[0], p1[1], p1[2], r1, p2[0], p2[1], p2[2], r2);
+        if (PRIMITIVE == LINE_STRIP)
+            sphere (p2[0], p2[1], p2[2], r2);
+    }
+}
@@ -0,0 +1,452 @@
+/*
+ * Copyright (C) 2008 Nicolas P. Rougier
+ *
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef __RENDER_KERNEL_H__
+#define __RENDER_KERNEL_H__
+#include <vector>
+#include "data.h"
+#include "colormap.h"
+#include "worker-pool.h"
+
+
+/**
+ * Vertex preparation and drawing shared by Cloud, Line and Segment.
+ *
+ * Those objects draw x,y,z data with optional scale (s) and color (c) data as
+ * points, line strips or line pairs, either thin (GL primitives) or thick
+ * (spheres and cylinders). Instead of one hand written loop per combination,
+ * data is first converted by a kernel specialized at compile time on element
+ * type, color mode and size presence into tightly packed float arrays
+ * (positions, colors and sizes). Those arrays are then drawn according to the
+ * primitive kind, using vertex arrays for thin primitives.
+ *
+ * Supporting a new element type or attribute only means adding a case to the
+ * dispatch in prepare.
+ *
+ * Preparation does not involve GL and can be done ahead of rendering by a
+ * worker pool, large data being split into chunks converted in parallel.
+ * Prepared vertices are kept from one preparation to the next such that only
+ * elements marked as dirty in data (see Data::mark_dirty) are converted
+ * again.
+ */
+class RenderKernel {
+public:
+
+    /**
+     * Color mode
+     */
+    enum ColorMode {
+        COLOR_NONE = 0,   /*!< Foreground color                  */
+        COLOR_CMAP = 1,   /*!< One value mapped through colormap */
+        COLOR_RGB  = 3,   /*!< Red, green and blue values        */
+        COLOR_RGBA = 4    /*!< Red, green, blue and alpha values */
+    };
+
+    /**
+     * Primitive kind
+     */
+    enum Primitive {
+        POINTS,       /*!< One point (or sphere) per vertex              */
+        LINE_STRIP,   /*!< Consecutive vertices joined (capped by spheres) */
+        LINES         /*!< Vertices joined by pairs                      */
+    };
+
+    /**
+     * Kernel input
+     */
+    struct Source {
+        DataPtr     xdata;      /*!< x coordinates (mandatory)        */
+        DataPtr     ydata;      /*!< y coordinates (mandatory)        */
+        DataPtr     zdata;      /*!< z coordinates (mandatory)        */
+        DataPtr     sdata;      /*!< scales (optional)                */
+        DataPtr     cdata;      /*!< colors (optional)                */
+        ColormapPtr cmap;       /*!< colormap used for 1 value colors */
+        Color       color;      /*!< color used when there is no color data */
+        float       alpha;      /*!< global alpha                     */
+        float       thickness;  /*!< sizes are thickness * scale      */
+    };
+
+
+public:
+
+    /**
+     * @name Creation/Destruction
+     */
+    /**
+     * Default constructor
+     */
+    RenderKernel (void);
+
+    /**
+     * Destructor.
+     */
+    virtual ~RenderKernel (void);
+    //@}
+
+
+    // _________________________________________________________________________
+
+    /**
+     * @name Preparation
+     */
+    /**
+     * Convert source data into vertex arrays.
+     *
+     * x,y,z,s and c data must all be of the same type, either GL_FLOAT or
+     * GL_DOUBLE.
+     *
+     * @param source data to be converted
+     */
+    void prepare (const Source &source);
+
+    /**
+     * Convert source data into vertex arrays using a worker pool.
+     *
+     * Vertex arrays are allocated right away while conversion is split into
+     * chunks submitted to the pool. Prepared vertices must not be used
+     * before the pool has been waited for.
+     *
+     * @param source data to be converted
+     * @param pool   pool running conversion
+     */
+    void prepare (const Source &source, WorkerPool &pool);
+
+    /**
+     * Whether vertices have been prepared ahead of rendering.
+     *
+     * This resets the state such that next call returns false until
+     * vertices are prepared with a pool again.
+     */
+    bool consume (void);
+
+    /**
+     * Whether data changed since vertices were last prepared
+     *
+     * Only changes signalled through data versions or pending in data (see
+     * Data::get_pending) are considered, data which is not tracked (see
+     * Data::get_tracked) is not reported.
+     *
+     * @param source data to be checked
+     */
+    bool get_outdated (const Source &source) const;
+
+    /**
+     * Whether a data type is supported by kernels
+     *
+     * @param type data type
+     */
+    static bool supports (GLenum type);
+
+    /**
+     * Get number of prepared vertices
+     */
+    unsigned int get_count (void) const;
+
+    /**
+     * Get prepared positions (x,y,z per vertex)
+     */
+    const std::vector<GLfloat> & get_positions (void) const;
+
+    /**
+     * Get prepared colors (r,g,b,a per vertex, empty if uniform)
+     */
+    const std::vector<GLfloat> & get_colors (void) const;
+
+    /**
+     * Get prepared sizes (one per vertex, empty if uniform)
+     */
+    const std::vector<GLfloat> & get_sizes (void) const;
+
+    /**
+     * Get uniform color (including alpha) used when there are no colors
+     */
+    const Color & get_color (void) const;
+
+    /**
+     * Get version of prepared vertices
+     *
+     * Versions are unique among all kernels and change whenever vertices
+     * are converted again, such that copies of prepared vertices can be
+     * kept as long as version does not change.
+     */
+    unsigned long get_version (void) const;
+
+    /**
+     * Whether some prepared vertex is translucent (computed once per version)
+     */
+    bool get_translucent (void) const;
+    //@}
+
+
+    // _________________________________________________________________________
+
+    /**
+     * @name Drawing
+     */
+    /**
+     * Draw prepared vertices.
+     *
+     * Thin primitives are drawn with a single glDrawArrays call, line width or
+     * point size must be set by caller. Thick primitives are drawn as
+     * spheres and cylinders whose radius is given by prepared sizes or
+     * thickness if there are none. When there are no prepared colors, the
+     * source color is used.
+     *
+     * @param primitive primitive kind
+     * @param thick     whether to draw spheres and cylinders
+     */
+    void draw (Primitive primitive, bool thick);
+
+    /**
+     * Enable vertex and color arrays pointing to prepared vertices
+     */
+    void bind (void);
+
+    /**
+     * Disable vertex and color arrays
+     */
+    void unbind (void);
+    //@}
+
+
+protected:
+
+    // _________________________________________________________________________
+
+    /**
+     * Conversion of a chunk of vertices by a worker pool
+     */
+    class Chunk;
+    friend class Chunk;
+
+    /**
+     * Set uniform parameters and allocate vertex arrays
+     *
+     * Only vertices whose data changed since last preparation need to be
+     * converted again, unless parameters or data objects changed.
+     *
+     * @param source data to be converted
+     * @param first  first vertex to be converted
+     * @param last   last vertex to be converted (excluded)
+     */
+    void setup (const Source &source, unsigned int &first, unsigned int &last);
+
+    /**
+     * Convert vertices in [first,last[, setup must have been called
+     */
+    void prepare_range (const Source &source,
+                        unsigned int first, unsigned int last);
+
+    /**
+     * Dispatch preparation on color mode and size presence.
+     */
+    template <typename T>
+    void prepare_type (const Source &source,
+                       unsigned int first, unsigned int last);
+
+    /**
+     * Preparation kernel.
+     *
+     * Every column is converted in its own loop such that, when data is
+     * tightly packed, loops only involve contiguous reads and can be
+     * vectorized by the compiler.
+     */
+    template <typename T, int COLOR, bool SIZE>
+    void prepare_kernel (const Source &source,
+                         unsigned int first, unsigned int last);
+
+    /**
+     * Convert one component of data into floats.
+     *
+     * out[(i-first)*step] = scale * data[i][component] for i in [first,last[
+     */
+    template <typename T>
+    static void gather (const Data &data, unsigned int component,
+                        unsigned int first, unsigned int last,
+                        GLfloat *out, unsigned int step, GLfloat scale);
+
+    /**
+     * Draw prepared vertices as spheres and cylinders.
+     */
+    template <int PRIMITIVE, bool COLORED, bool SIZED>
+    void draw_kernel (void);
+
+
+protected:
+
+    // _________________________________________________________________________
+
+    /**
+     * Number of prepared vertices
+     */
+    unsigned int count_;
+
+    /**
+     * Whether vertices have been prepared ahead of rendering
+     */
+    bool prepared_;
+
+    /**
+     * Uniform color (including alpha)
+     */
+    Color color_;
+
+    /**
+     * Uniform size
+     */
+    GLfloat thickness_;
+
+    /**
+     * Colormap (and its range) used for last preparation
+     */
+    ColormapPtr cmap_;
+    float cmap_min_, cmap_max_;
+
+    /**
+     * Data (x,y,z,s,c) used for last preparation
+     */
+    const Data *data_[5];
+
+    /**
+     * Data versions at last preparation
+     */
+    unsigned long versions_[5];
+
+    /**
+     * Version of prepared vertices
+     */
+    unsigned long version_;
+
+    /**
+     * Translucency of prepared vertices and version it was computed for
+     */
+    mutable bool translucent_;
+    mutable unsigned long translucent_version_;
+
+    /**
+     * Prepared positions
+     */
+    std::vector<GLfloat> positions_;
+
+    /**
+     * Prepared colors
+     */
+    std::vector<GLfloat> colors_;
+
+    /**
+     * Prepared sizes
+     */
+    std::vector<GLfloat> sizes_;
+};
+
+
+// ______________________________________________________________________ gather
+template <typename T>
+void
+RenderKernel::gather (const Data &data, unsigned int component,
+                      unsigned int first, unsigned int last,
+                      GLfloat *out, unsigned int step, GLfloat scale)
+{
+    unsigned int stride = data.get_stride();
+    const GLbyte *bytes = (const GLbyte *) data.get_data()
+                          + size_t(first)*stride + component*sizeof(T);
+    unsigned int count = last-first;
+    if (stride == sizeof(T)) {
+        const T *values = (const T *) bytes;
+        for (unsigned int i=0; i<count; i++)
+            out[i*step] = scale * values[i];
+    } else {
+        for (unsigned int i=0; i<count; i++)
+            out[i*step] = scale * (* (const T *)(bytes + size_t(i)*stride));
+    }
+}
+
+
+// ______________________________________________________________ prepare_kernel
+template <typename T, int COLOR, bool SIZE>
+void
+RenderKernel::prepare_kernel (const Source &source,
+                              unsigned int first, unsigned int last)
+{
+    unsigned int n = last-first;
+    GLfloat *positions = &positions_[3*first];
+    gather<T> (*source.xdata, 0, first, last, positions+0, 3, 1);
+    gather<T> (*source.ydata, 0, first, last, positions+1, 3, 1);
+    gather<T> (*source.zdata, 0, first, last, positions+2, 3, 1);
+
+    if (SIZE)
+        gather<T> (*source.sdata, 0, first, last, &sizes_[first], 1,
+                   source.thickness);
+
+    if (COLOR == COLOR_NONE)
+        return;
+    GLfloat *colors = &colors_[4*first];
+    if (COLOR == COLOR_CMAP) {
+        unsigned int cdata_stride = source.cdata->get_stride();
+        const GLbyte *cdata = (const GLbyte *) source.cdata->get_data()
+                              + size_t(first)*cdata_stride;
+        Colormap &cmap = *source.cmap;
+        for (unsigned int i=0; i<n; i++) {
+            Color c = cmap (* (const T *)(cdata + size_t(i)*cdata_stride));
+            colors[4*i+0] = c.r;
+            colors[4*i+1] = c.g;
+            colors[4*i+2] = c.b;
+            colors[4*i+3] = c.a * source.alpha;
+        }
+        return;
+    }
+    gather<T> (*source.cdata, 0, first, last, colors+0, 4, 1);
+    gather<T> (*source.cdata, 1, first, last, colors+1, 4, 1);
+    gather<T> (*source.cdata, 2, first, last, colors+2, 4, 1);
+    if (COLOR == COLOR_RGBA) {
+        gather<T> (*source.cdata, 3, first, last, colors+3, 4, source.alpha);
+    } else {
+        GLfloat alpha = source.color.a * source.alpha;
+        for (unsigned int i=0; i<n; i++)
+            colors[4*i+3] = alpha;
+    }
+}
+
+
+// ________________________________________________________________ prepare_type
+template <typename T>
+void
+RenderKernel::prepare_type (const Source &source,
+                            unsigned int first, unsigned int last)
+{
+    int color = COLOR_NONE;
+    if (source.cdata)
+        color = source.cdata->get_depth();
+
+#define KERNEL(COLOR,SIZE) prepare_kernel<T, COLOR, SIZE> (source, first, last)
+    if (source.sdata) {
+        switch (color) {
+        case COLOR_CMAP: KERNEL (COLOR_CMAP, true); break;
+        case COLOR_RGB:  KERNEL (COLOR_RGB,  true); break;
+        case COLOR_RGBA: KERNEL (COLOR_RGBA, true); break;
+        default:         KERNEL (COLOR_NONE, true); break;
+        }
+    } else {
+        switch (color) {
+        case COLOR_CMAP: KERNEL (COLOR_CMAP, false); break;
+        case COLOR_RGB:  KERNEL (COLOR_RGB,  false); break;
+        case COLOR_RGBA: KERNEL (COLOR_RGBA, false); break;
+        default:         KERNEL (COLOR_NONE, false); break;
+        }
+    }
+#undef KERNEL
+}
+
+#endif
@@ -0,0 +1,263 @@
+/*
+ * Copyright (C) 2008 Nicolas P. Rougier
+ *
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <algorithm>
+#include "render-queue.h"
+
+
+// Items are sorted by key then by submission order
+static bool
+before (const RenderQueue::Item &a, const RenderQueue::Item &b)
+{
+    if (a.key != b.key)
+        return a.key < b.key;
+    return a.order < b.order;
+}
+
+
+// _________________________________________________________________ RenderQueue
+RenderQueue::RenderQueue (void)
+{
+    drawn_items_ = 0;
+    draws_ = 0;
+    lighting_ = false;
+    batch_ = 0;
+}
+
+
+// ________________________________________________________________ ~RenderQueue
+RenderQueue::~RenderQueue (void)
+{}
+
+
+// ______________________________________________________________________ submit
+void
+RenderQueue::submit (RenderKernel &kernel, RenderKernel::Primitive primitive,
+                     float size, bool smooth)
+{
+    if (not kernel.get_count())
+        return;
+    Item item;
+    item.kernel = &kernel;
+    item.primitive = primitive;
+    item.size = size;
+    item.smooth = smooth;
+    item.order = items_.size();
+    item.key = key (item);
+    items_.push_back (item);
+}
+
+
+// _______________________________________________________________________ flush
+void
+RenderQueue::flush (void)
+{
+    drawn_items_ = items_.size();
+    draws_ = 0;
+    batch_ = 0;
+    if (items_.empty()) {
+        batches_.clear();
+        return;
+    }
+
+    std::sort (items_.begin(), items_.end(), before);
+    lighting_ = glIsEnabled (GL_LIGHTING);
+    unsigned int first = 0;
+    for (unsigned int i=1; i<=items_.size(); i++) {
+        if ((i == items_.size()) or (not compatible (items_[first], items_[i]))) {
+            draw (first, i);
+            first = i;
+        }
+    }
+
+    glDisable (GL_BLEND);
+    glDisable (GL_POINT_SMOOTH);
+    glDisable (GL_LINE_SMOOTH);
+    if (lighting_)
+        glEnable (GL_LIGHTING);
+    items_.clear();
+    batches_.resize (batch_);
+}
+
+
+// ___________________________________________________________________ get_items
+unsigned int
+RenderQueue::get_items (void) const
+{
+    return drawn_items_;
+}
+
+
+// ___________________________________________________________________ get_draws
+unsigned int
+RenderQueue::get_draws (void) const
+{
+    return draws_;
+}
+
+
+// _________________________________________________________________________ key
+unsigned int
+RenderQueue::key (const Item &item)
+{
+    // Translucent items are drawn after opaque ones
+    unsigned int pass = item.kernel->get_translucent() ? 1 : 0;
+
+    // State: primitive, smoothing and size in 1/16 pixels
+    unsigned int size = (unsigned int) (item.size*16);
+    if (size > 0x0fffffff)
+        size = 0x0fffffff;
+    return (pass << 31) | ((item.primitive & 3) << 29) |
+           ((item.smooth ? 1 : 0) << 28) | size;
+}
+
+
+// __________________________________________________________________ compatible
+bool
+RenderQueue::compatible (const Item &a, const Item &b)
+{
+    return (a.key == b.key) and (a.size == b.size);
+}
+
+
+// _______________________________________________________________________ setup
+void
+RenderQueue::setup (const Item &item, bool lighting)
+{
+    glEnable (GL_BLEND);
+    GLenum smooth = GL_LINE_SMOOTH;
+    if (item.primitive == RenderKernel::POINTS) {
+        smooth = GL_POINT_SMOOTH;
+        glPointSize (item.size);
+        glDisable (GL_LIGHTING);
+    } else {
+        glLineWidth (item.size);
+        if (lighting)
+            glEnable (GL_LIGHTING);
+    }
+    if (item.smooth)
+        glEnable (smooth);
+    else
+        glDisable (smooth);
+}
+
+
+// _____________________________________________________________________ current
+bool
+RenderQueue::current (const Batch &batch,
+                      unsigned int first, unsigned int last) const
+{
+    if ((batch.primitive != items_[first].primitive) or
+        (batch.kernels.size() != last-first))
+        return false;
+    for (unsigned int i=first; i<last; i++) {
+        if ((batch.kernels[i-first] != items_[i].kernel) or
+            (batch.versions[i-first] != items_[i].kernel->get_version()))
+            return false;
+    }
+    return true;
+}
+
+
+// _______________________________________________________________________ merge
+void
+RenderQueue::merge (Batch &batch, unsigned int first, unsigned int last)
+{
+    RenderKernel::Primitive primitive = items_[first].primitive;
+    batch.primitive = primitive;
+    batch.kernels.clear();
+    batch.versions.clear();
+    unsigned int count = 0;
+    for (unsigned int i=first; i<last; i++) {
+        batch.kernels.push_back (items_[i].kernel);
+        batch.versions.push_back (items_[i].kernel->get_version());
+        count += items_[i].kernel->get_count();
+    }
+    batch.positions.resize (3*count);
+    batch.colors.resize (4*count);
+    batch.indices.clear();
+
+    unsigned int base = 0;
+    for (unsigned int i=first; i<last; i++) {
+        const RenderKernel &kernel = *items_[i].kernel;
+        unsigned int n = kernel.get_count();
+        std::copy (kernel.get_positions().begin(),
+                   kernel.get_positions().begin() + 3*n,
+                   batch.positions.begin() + 3*base);
+        if (kernel.get_colors().size()) {
+            std::copy (kernel.get_colors().begin(),
+                       kernel.get_colors().begin() + 4*n,
+                       batch.colors.begin() + 4*base);
+        } else {
+            Color c = kernel.get_color();
+            for (unsigned int j=0; j<n; j++) {
+                batch.colors[4*(base+j)+0] = c.r;
+                batch.colors[4*(base+j)+1] = c.g;
+                batch.colors[4*(base+j)+2] = c.b;
+                batch.colors[4*(base+j)+3] = c.a;
+            }
+        }
+        if (primitive == RenderKernel::LINE_STRIP) {
+            for (unsigned int j=0; j+1<n; j++) {
+                batch.indices.push_back (base+j);
+                batch.indices.push_back (base+j+1);
+            }
+        } else {
+            unsigned int m = n;
+            if (primitive == RenderKernel::LINES)
+                m -= m%2;
+            for (unsigned int j=0; j<m; j++)
+                batch.indices.push_back (base+j);
+        }
+        base += n;
+    }
+}
+
+
+// ________________________________________________________________________ draw
+void
+RenderQueue::draw (unsigned int first, unsigned int last)
+{
+    const Item &head = items_[first];
+    setup (head, lighting_);
+    draws_++;
+
+    // A single item is drawn from its own vertices
+    if (last-first == 1) {
+        head.kernel->draw (head.primitive, false);
+        return;
+    }
+
+    // Groups are matched with batches of last flush in drawing order
+    if (batch_ == batches_.size())
+        batches_.push_back (Batch());
+    Batch &batch = batches_[batch_++];
+    if (not current (batch, first, last))
+        merge (batch, first, last);
+    if (batch.indices.empty())
+        return;
+
+    GLenum mode = GL_LINES;
+    if (head.primitive == RenderKernel::POINTS)
+        mode = GL_POINTS;
+    glEnableClientState (GL_VERTEX_ARRAY);
+    glEnableClientState (GL_COLOR_ARRAY);
+    glVertexPointer (3, GL_FLOAT, 0, &batch.positions[0]);
+    glColorPointer (4, GL_FLOAT, 0, &batch.colors[0]);
+    glDrawElements (mode, batch.indices.size(), GL_UNSIGNED_INT,
+                    &batch.indices[0]);
+    glDisableClientState (GL_COLOR_ARRAY);
+    glDisableClientState (GL_VERTEX_ARRAY);
+}
@@ -0,0 +1,192 @@
+/*
+ * Copyright (C) 2008 Nicolas P. Rougier
+ *
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef __RENDER_QUEUE_H__
+#define __RENDER_QUEUE_H__
+#include <vector>
+#include "render-kernel.h"
+
+#if defined(HAVE_BOOST)
+#   include <boost/shared_ptr.hpp>
+    typedef boost::shared_ptr<class RenderQueue> RenderQueuePtr;
+#else
+    typedef class RenderQueue *                  RenderQueuePtr;
+#endif
+
+
+/**
+ * Queue of draw items collected over a whole scene.
+ *
+ * Instead of drawing themselves, objects drawing thin primitives from
+ * prepared vertices (see Object::submit) submit a draw item made of their
+ * vertices and the state they need (primitive, point size or line width,
+ * smoothing). Each item gets a sort key made of its pass (opaque items
+ * first, then translucent ones) and a hash of its state. When flushed, items
+ * are sorted by key, preserving submission order for equal keys, and
+ * consecutive items sharing the same state are merged into shared vertex,
+ * color and index arrays drawn with a single call. Many small objects with
+ * the same settings hence cost one draw and no redundant state change.
+ *
+ * Line strips are merged as indexed line pairs. Merged arrays are kept from
+ * one flush to the next and only rebuilt when the items of a group or their
+ * vertices (see RenderKernel::get_version) changed. Items are only
+ * referenced until flush, vertices must stay valid until then.
+ */
+class RenderQueue {
+public:
+
+    /**
+     * Draw item
+     */
+    struct Item {
+        RenderKernel *          kernel;    /*!< prepared vertices            */
+        RenderKernel::Primitive primitive; /*!< primitive kind               */
+        float                   size;      /*!< point size or line width     */
+        bool                    smooth;    /*!< whether to smooth primitives */
+        unsigned int            key;       /*!< sort key                     */
+        unsigned int            order;     /*!< submission order             */
+    };
+
+
+public:
+
+    // _________________________________________________________________________
+
+    /**
+     * @name Creation/Destruction
+     */
+    /**
+     * Default constructor
+     */
+    RenderQueue (void);
+
+    /**
+     * Destructor
+     */
+    virtual ~RenderQueue (void);
+    //@}
+
+
+    // _________________________________________________________________________
+
+    /**
+     * @name Queue
+     */
+    /**
+     * Submit a draw item
+     *
+     * @param kernel    prepared vertices
+     * @param primitive primitive kind
+     * @param size      point size or line width
+     * @param smooth    whether to smooth primitives
+     */
+    virtual void submit (RenderKernel &kernel,
+                         RenderKernel::Primitive primitive,
+                         float size, bool smooth = true);
+
+    /**
+     * Draw all submitted items and empty the queue
+     */
+    virtual void flush (void);
+
+    /**
+     * Get number of items drawn by last flush
+     */
+    virtual unsigned int get_items (void) const;
+
+    /**
+     * Get number of draw calls issued by last flush
+     */
+    virtual unsigned int get_draws (void) const;
+    //@}
+
+
+protected:
+
+    // _________________________________________________________________________
+
+    /**
+     * Compute sort key of an item
+     */
+    static unsigned int key (const Item &item);
+
+    /**
+     * Whether two items can be merged
+     */
+    static bool compatible (const Item &a, const Item &b);
+
+    /**
+     * Set state needed by an item
+     *
+     * Points have no normal, they are drawn unlit; lighting is left as found
+     * (lighting) for other primitives.
+     */
+    static void setup (const Item &item, bool lighting);
+
+    /**
+     * Merged vertices of a group of items
+     */
+    struct Batch {
+        RenderKernel::Primitive             primitive; /*!< primitive kind  */
+        std::vector<const RenderKernel *>   kernels;   /*!< merged kernels  */
+        std::vector<unsigned long>          versions;  /*!< kernel versions */
+        std::vector<GLfloat>                positions; /*!< merged positions */
+        std::vector<GLfloat>                colors;    /*!< merged colors   */
+        std::vector<GLuint>                 indices;   /*!< merged indices  */
+    };
+
+    /**
+     * Whether a batch holds current vertices of items [first,last[
+     */
+    bool current (const Batch &batch,
+                  unsigned int first, unsigned int last) const;
+
+    /**
+     * Merge vertices of items [first,last[ into a batch
+     */
+    void merge (Batch &batch, unsigned int first, unsigned int last);
+
+    /**
+     * Draw items [first,last[ of sorted items in one call
+     */
+    void draw (unsigned int first, unsigned int last);
+
+    /**
+     * Submitted items
+     */
+    std::vector<Item> items_;
+
+    /**
+     * Batches of merged groups, in drawing order of last flush
+     */
+    std::vector<Batch> batches_;
+
+    /**
+     * Number of batches used by current flush
+     */
+    unsigned int batch_;
+
+    /**
+     * Whether lighting was enabled when flush started
+     */
+    bool lighting_;
+
+    /**
+     * Statistics of last flush
+     */
+    unsigned int drawn_items_, draws_;
+};
+
+#endif
@@ -0,0 +1,325 @@
+/*
+ * Copyright (C) 2008 Nicolas P. Rougier
+ *
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <cmath>
+#include "render-state.h"
+
+// ________________________________________________________________ static state
+std::vector<RenderState::Matrix> RenderState::modelview_ (1);
+std::vector<RenderState::Matrix> RenderState::projection_ (1);
+GLenum RenderState::mode_ = GL_MODELVIEW;
+RenderState::Attrib RenderState::attrib_ = {0, {0,0,0,0}, {0,0,0,0}, false};
+std::vector<RenderState::Attrib> RenderState::attribs_;
+bool RenderState::declared_ = false;
+unsigned long RenderState::frame_ = 0;
+GLuint RenderState::program_ = 0;
+
+static const float identity[16] = {1,0,0,0, 0,1,0,0, 0,0,1,0, 0,0,0,1};
+
+
+// _________________________________________________________________ begin_frame
+void
+RenderState::begin_frame (void)
+{
+    frame_++;
+    modelview_.resize (1);
+    projection_.resize (1);
+    for (unsigned int i=0; i<16; i++)
+        modelview_[0].data[i] = projection_[0].data[i] = identity[i];
+    mode_ = GL_MODELVIEW;
+    attribs_.clear();
+    if (not declared_) {
+        GLint viewport[4], scissor[4];
+        glGetIntegerv (GL_VIEWPORT, viewport);
+        glGetIntegerv (GL_SCISSOR_BOX, scissor);
+        for (unsigned int i=0; i<4; i++) {
+            attrib_.viewport[i] = viewport[i];
+            attrib_.scissor[i] = scissor[i];
+        }
+        attrib_.scissor_test = glIsEnabled (GL_SCISSOR_TEST);
+    }
+}
+
+
+// ___________________________________________________________________ get_frame
+unsigned long
+RenderState::get_frame (void)
+{
+    return frame_;
+}
+
+
+// ________________________________________________________________ get_declared
+bool
+RenderState::get_declared (void)
+{
+    return declared_;
+}
+
+
+// ____________________________________________________________________ viewport
+void
+RenderState::viewport (int x, int y, int width, int height)
+{
+    glViewport (x, y, width, height);
+    attrib_.viewport[0] = x;
+    attrib_.viewport[1] = y;
+    attrib_.viewport[2] = width;
+    attrib_.viewport[3] = height;
+    if (attribs_.empty())
+        declared_ = true;
+}
+
+
+// ________________________________________________________________ get_viewport
+void
+RenderState::get_viewport (int viewport[4])
+{
+    for (unsigned int i=0; i<4; i++)
+        viewport[i] = attrib_.viewport[i];
+}
+
+
+// _____________________________________________________________________ scissor
+void
+RenderState::scissor (int x, int y, int width, int height)
+{
+    glEnable (GL_SCISSOR_TEST);
+    glScissor (x, y, width, height);
+    attrib_.scissor[0] = x;
+    attrib_.scissor[1] = y;
+    attrib_.scissor[2] = width;
+    attrib_.scissor[3] = height;
+    attrib_.scissor_test = true;
+}
+
+
+// _________________________________________________________________ get_scissor
+bool
+RenderState::get_scissor (int scissor[4])
+{
+    for (unsigned int i=0; i<4; i++)
+        scissor[i] = attrib_.scissor[i];
+    return attrib_.scissor_test;
+}
+
+
+// _________________________________________________________________ push_attrib
+void
+RenderState::push_attrib (GLbitfield mask)
+{
+    glPushAttrib (mask);
+    attrib_.mask = mask;
+    attribs_.push_back (attrib_);
+}
+
+
+// __________________________________________________________________ pop_attrib
+void
+RenderState::pop_attrib (void)
+{
+    glPopAttrib ();
+    if (attribs_.empty())
+        return;
+    Attrib attrib = attribs_.back();
+    attribs_.pop_back();
+    if (attrib.mask & GL_VIEWPORT_BIT)
+        for (unsigned int i=0; i<4; i++)
+            attrib_.viewport[i] = attrib.viewport[i];
+    if (attrib.mask & GL_SCISSOR_BIT)
+        for (unsigned int i=0; i<4; i++)
+            attrib_.scissor[i] = attrib.scissor[i];
+    if (attrib.mask & (GL_SCISSOR_BIT | GL_ENABLE_BIT))
+        attrib_.scissor_test = attrib.scissor_test;
+}
+
+
+// _________________________________________________________________ matrix_mode
+void
+RenderState::matrix_mode (GLenum mode)
+{
+    glMatrixMode (mode);
+    mode_ = mode;
+}
+
+
+// _________________________________________________________________ push_matrix
+void
+RenderState::push_matrix (void)
+{
+    glPushMatrix ();
+    std::vector<Matrix> &matrices = stack();
+    matrices.push_back (matrices.back());
+}
+
+
+// __________________________________________________________________ pop_matrix
+void
+RenderState::pop_matrix (void)
+{
+    glPopMatrix ();
+    std::vector<Matrix> &matrices = stack();
+    if (matrices.size() > 1)
+        matrices.pop_back();
+}
+
+
+// _______________________________________________________________ load_identity
+void
+RenderState::load_identity (void)
+{
+    glLoadIdentity ();
+    Matrix &matrix = stack().back();
+    for (unsigned int i=0; i<16; i++)
+        matrix.data[i] = identity[i];
+}
+
+
+// _________________________________________________________________ mult_matrix
+void
+RenderState::mult_matrix (const float *m)
+{
+    glMultMatrixf (m);
+    mult (m);
+}
+
+
+// ___________________________________________________________________ translate
+void
+RenderState::translate (float x, float y, float z)
+{
+    glTranslatef (x, y, z);
+    float m[16] = {1,0,0,0, 0,1,0,0, 0,0,1,0, x,y,z,1};
+    mult (m);
+}
+
+
+// _______________________________________________________________________ scale
+void
+RenderState::scale (float x, float y, float z)
+{
+    glScalef (x, y, z);
+    float m[16] = {x,0,0,0, 0,y,0,0, 0,0,z,0, 0,0,0,1};
+    mult (m);
+}
+
+
+// ______________________________________________________________________ rotate
+void
+RenderState::rotate (float angle, float x, float y, float z)
+{
+    glRotatef (angle, x, y, z);
+    float norm = sqrt (x*x + y*y + z*z);
+    if (norm == 0)
+        return;
+    x /= norm; y /= norm; z /= norm;
+    float c = cos (angle*M_PI/180.0);
+    float s = sin (angle*M_PI/180.0);
+    float m[16] = {x*x*(1-c)+c,   y*x*(1-c)+z*s, x*z*(1-c)-y*s, 0,
+                   x*y*(1-c)-z*s, y*y*(1-c)+c,   y*z*(1-c)+x*s, 0,
+                   x*z*(1-c)+y*s, y*z*(1-c)-x*s, z*z*(1-c)+c,   0,
+                   0,             0,             0,             1};
+    mult (m);
+}
+
+
+// _______________________________________________________________________ ortho
+void
+RenderState::ortho (double left, double right, double bottom, double top,
+                    double near, double far)
+{
+    glOrtho (left, right, bottom, top, near, far);
+    float m[16] = {float(2/(right-left)), 0, 0, 0,
+                   0, float(2/(top-bottom)), 0, 0,
+                   0, 0, float(-2/(far-near)), 0,
+                   float(-(right+left)/(right-left)),
+                   float(-(top+bottom)/(top-bottom)),
+                   float(-(far+near)/(far-near)), 1};
+    mult (m);
+}
+
+
+// _____________________________________________________________________ frustum
+void
+RenderState::frustum (double left, double right, double bottom, double top,
+                      double near, double far)
+{
+    glFrustum (left, right, bottom, top, near, far);
+    float m[16] = {float(2*near/(right-left)), 0, 0, 0,
+                   0, float(2*near/(top-bottom)), 0, 0,
+                   float((right+left)/(right-left)),
+                   float((top+bottom)/(top-bottom)),
+                   float(-(far+near)/(far-near)), -1,
+                   0, 0, float(-2*far*near/(far-near)), 0};
+    mult (m);
+}
+
+
+// _______________________________________________________________ get_modelview
+const float *
+RenderState::get_modelview (void)
+{
+    return modelview_.back().data;
+}
+
+
+// ______________________________________________________________ get_projection
+const float *
+RenderState::get_projection (void)
+{
+    return projection_.back().data;
+}
+
+
+// _________________________________________________________________ use_program
+void
+RenderState::use_program (GLuint program)
+{
+    glUseProgram (program);
+    program_ = program;
+}
+
+
+// _________________________________________________________________ get_program
+GLuint
+RenderState::get_program (void)
+{
+    return program_;
+}
+
+
+// _______________________________________________________________________ stack
+std::vector<RenderState::Matrix> &
+RenderState::stack (void)
+{
+    if (mode_ == GL_PROJECTION)
+        return projection_;
+    return modelview_;
+}
+
+
+// ________________________________________________________________________ mult
+void
+RenderState::mult (const float *m)
+{
+    Matrix &matrix = stack().back();
+    float r[16];
+    for (unsigned int c=0; c<4; c++)
+        for (unsigned int l=0; l<4; l++)
+            r[c*4+l] = matrix.data[0*4+l]*m[c*4+0] + matrix.data[1*4+l]*m[c*4+1]
+                     + matrix.data[2*4+l]*m[c*4+2] + matrix.data[3*4+l]*m[c*4+3];
+    for (unsigned int i=0; i<16; i++)
+        matrix.data[i] = r[i];
+}
@@ -0,0 +1,283 @@
+/*
+ * Copyright (C) 2008 Nicolas P. Rougier
+ *
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef __RENDER_STATE_H__
+#define __RENDER_STATE_H__
+
+#if defined(__APPLE__)
+#   include <GL/glew.h>
+#   include <OpenGL/gl.h>
+#else
+#   include <GL/glew.h>
+#   include <GL/gl.h>
+#endif
+#include <vector>
+
+
+/**
+ * CPU side mirror of the GL transform and viewport state.
+ *
+ * Querying GL state (glGet*) forces the CPU to wait for the GPU. To avoid
+ * such stalls during rendering, the transform, viewport and scissor calls
+ * made by scenes and widgets go through this class which forwards them to GL
+ * and keeps track of the resulting state. Objects can then read the current
+ * viewport or modelview matrix from here instead of asking GL.
+ *
+ * Only transforms issued through this class are tracked: an object that needs
+ * the modelview matrix (for z sorting for example) must be enclosed by
+ * RenderState transforms only. All scigl objects and widgets issue their
+ * transforms through this class, the only exception being the glyph display
+ * lists of Font, which move the text cursor while text is rendered, always
+ * between a push_matrix/pop_matrix pair.
+ *
+ * The viewport of the window should be declared with RenderState::viewport.
+ * If it is not, it is read from GL once at the start of each frame.
+ */
+class RenderState {
+public:
+
+    // _________________________________________________________________________
+
+    /**
+     * @name Frame
+     */
+    /**
+     * Start a new frame.
+     *
+     * Matrices are reset to identity and, if window viewport has not been
+     * declared, viewport and scissor are read from GL.
+     */
+    static void begin_frame (void);
+
+    /**
+     * Get number of frames started so far.
+     */
+    static unsigned long get_frame (void);
+
+    /**
+     * Whether window viewport has been declared.
+     */
+    static bool get_declared (void);
+    //@}
+
+
+    // _________________________________________________________________________
+
+    /**
+     * @name Viewport/Scissor
+     */
+    /**
+     * Set viewport (glViewport)
+     *
+     * When no attributes are pushed, this declares the window viewport.
+     */
+    static void viewport (int x, int y, int width, int height);
+
+    /**
+     * Get current viewport
+     *
+     * @param viewport x, y, width and height of viewport
+     */
+    static void get_viewport (int viewport[4]);
+
+    /**
+     * Set scissor box and enable scissor test (glScissor)
+     */
+    static void scissor (int x, int y, int width, int height);
+
+    /**
+     * Get current scissor box
+     *
+     * @param scissor x, y, width and height of scissor box
+     * @return whether scissor test is enabled
+     */
+    static bool get_scissor (int scissor[4]);
+
+    /**
+     * Push viewport, scissor and given attributes (glPushAttrib)
+     */
+    static void push_attrib (GLbitfield mask);
+
+    /**
+     * Pop attributes (glPopAttrib)
+     */
+    static void pop_attrib (void);
+    //@}
+
+
+    // _________________________________________________________________________
+
+    /**
+     * @name Matrices
+     */
+    /**
+     * Set current matrix stack (glMatrixMode)
+     */
+    static void matrix_mode (GLenum mode);
+
+    /**
+     * Push current matrix (glPushMatrix)
+     */
+    static void push_matrix (void);
+
+    /**
+     * Pop current matrix (glPopMatrix)
+     */
+    static void pop_matrix (void);
+
+    /**
+     * Replace current matrix with identity (glLoadIdentity)
+     */
+    static void load_identity (void);
+
+    /**
+     * Multiply current matrix by a column major matrix (glMultMatrixf)
+     */
+    static void mult_matrix (const float *m);
+
+    /**
+     * Multiply current matrix by a translation (glTranslatef)
+     */
+    static void translate (float x, float y, float z);
+
+    /**
+     * Multiply current matrix by a scaling (glScalef)
+     */
+    static void scale (float x, float y, float z);
+
+    /**
+     * Multiply current matrix by a rotation (glRotatef)
+     */
+    static void rotate (float angle, float x, float y, float z);
+
+    /**
+     * Multiply current matrix by an orthographic projection (glOrtho)
+     */
+    static void ortho (double left, double right, double bottom, double top,
+                       double near, double far);
+
+    /**
+     * Multiply current matrix by a perspective projection (glFrustum)
+     */
+    static void frustum (double left, double right, double bottom, double top,
+                         double near, double far);
+
+    /**
+     * Get current modelview matrix (column major)
+     */
+    static const float *get_modelview (void);
+
+    /**
+     * Get current projection matrix (column major)
+     */
+    static const float *get_projection (void);
+    //@}
+
+
+    // _________________________________________________________________________
+
+    /**
+     * @name Program
+     */
+    /**
+     * Install program (glUseProgram)
+     */
+    static void use_program (GLuint program);
+
+    /**
+     * Get installed program
+     */
+    static GLuint get_program (void);
+    //@}
+
+
+protected:
+
+    // _________________________________________________________________________
+
+    /**
+     * Column major 4x4 matrix
+     */
+    struct Matrix {
+        float data[16];
+    };
+
+    /**
+     * Viewport and scissor state
+     */
+    struct Attrib {
+        GLbitfield mask;
+        int viewport[4];
+        int scissor[4];
+        bool scissor_test;
+    };
+
+    /**
+     * Current matrix stack
+     */
+    static std::vector<Matrix> &stack (void);
+
+    /**
+     * Multiply current matrix by m
+     */
+    static void mult (const float *m);
+
+
+protected:
+
+    // _________________________________________________________________________
+
+    /**
+     * Modelview matrix stack
+     */
+    static std::vector<Matrix> modelview_;
+
+    /**
+     * Projection matrix stack
+     */
+    static std::vector<Matrix> projection_;
+
+    /**
+     * Current matrix mode
+     */
+    static GLenum mode_;
+
+    /**
+     * Current viewport and scissor
+     */
+    static Attrib attrib_;
+
+    /**
+     * Attribute stack
+     */
+    static std::vector<Attrib> attribs_;
+
+    /**
+     * Whether window viewport has been declared
+     */
+    static bool declared_;
+
+    /**
+     * Number of frames started so far
+     */
+    static unsigned long frame_;
+
+    /**
+     * Installed program
+     */
+    static GLuint program_;
+};
+
+#endif
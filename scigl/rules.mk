@@ -24,21 +24,22 @@ d		:= $(dir)
 #EIGEN_FLAGS	:= -I$(EIGEN_ROOT)
 
 # Local rules and target
-CORE_HDR_$(d)	:= $(d)/axis-ranged.h $(d)/axis.h $(d)/basis-cube.h $(d)/cloud.h \
+CORE_HDR_$(d)	:= $(d)/axis-ranged.h $(d)/axis.h $(d)/basis-cube.h $(d)/buffer.h $(d)/cloud.h \
                    $(d)/colormap.h $(d)/convert.h $(d)/cube.h $(d)/curve.h \
-                   $(d)/data.h $(d)/font.h $(d)/font_12.h $(d)/font_16.h \
-                   $(d)/font_24.h $(d)/font_32.h $(d)/frame.h $(d)/line.h \
-                   $(d)/object.h $(d)/plane-coord.h $(d)/scene.h $(d)/scene-graph.h $(d)/segment.h \
-                   $(d)/shapes.h $(d)/terminal.h $(d)/textbox.h $(d)/trackball.h \
-                   $(d)/vec4f.h $(d)/widget.h
-
-CORE_SRC_$(d)	:= $(d)/axis-ranged.cc $(d)/axis.cc $(d)/basis-cube.cc \
+                   $(d)/data.h $(d)/data-view.h $(d)/font.h $(d)/font-registry.h $(d)/font_12.h $(d)/font_16.h \
+                   $(d)/font_24.h $(d)/font_32.h $(d)/frame.h $(d)/frame-clock.h $(d)/layer-cache.h $(d)/line.h \
+                   $(d)/object.h $(d)/overlay.h $(d)/picker.h $(d)/plane-coord.h $(d)/point-index.h $(d)/render-kernel.h $(d)/render-queue.h $(d)/render-state.h $(d)/scene.h $(d)/scene-graph.h $(d)/segment.h \
+                   $(d)/shared-data.h $(d)/shared-ring.h \
+                   $(d)/shapes.h $(d)/table-reader.h $(d)/terminal.h $(d)/textbox.h $(d)/trackball.h $(d)/triple-data.h \
+                   $(d)/vec4f.h $(d)/widget.h $(d)/worker-pool.h
+
+CORE_SRC_$(d)	:= $(d)/axis-ranged.cc $(d)/axis.cc $(d)/basis-cube.cc $(d)/buffer.cc \
                    $(d)/cloud.cc $(d)/colormap.cc $(d)/cube.cc $(d)/curve.cc \
-                   $(d)/data.cc $(d)/font.cc \
-                   $(d)/frame.cc $(d)/line.cc \
-                   $(d)/object.cc $(d)/plane-coord.cc $(d)/scene.cc $(d)/scene-graph.cc \
-                   $(d)/segment.cc $(d)/shapes.cc $(d)/terminal.cc $(d)/textbox.cc \
-                   $(d)/trackball.cc $(d)/widget.cc
+                   $(d)/data.cc $(d)/data-view.cc $(d)/font.cc $(d)/font-registry.cc \
+                   $(d)/frame.cc $(d)/frame-clock.cc $(d)/layer-cache.cc $(d)/line.cc \
+                   $(d)/object.cc $(d)/overlay.cc $(d)/picker.cc $(d)/plane-coord.cc $(d)/point-index.cc $(d)/render-kernel.cc $(d)/render-queue.cc $(d)/render-state.cc $(d)/scene.cc $(d)/scene-graph.cc \
+                   $(d)/segment.cc $(d)/shapes.cc $(d)/shared-data.cc $(d)/shared-ring.cc $(d)/table-reader.cc $(d)/terminal.cc $(d)/textbox.cc \
+                   $(d)/trackball.cc $(d)/triple-data.cc $(d)/widget.cc $(d)/worker-pool.cc
 
 CORE_OBJS_$(d)	:= $(CORE_SRC_$(d):%.cc=%.o)
 
@@ -53,44 +53,51 @@ SceneGraph::get_basis_cube (void)
 }
 // ===========================================================================
 bool
-SceneGraph::remove (ObjectPtr object)
+SceneGraph::needs_redraw (void) const
 {
-  std::vector<ObjectPtr>::iterator it;
-  
-  bool found = false;
-  // look for the object
-  //std::cout << "remove : search object " << object->get_id() << "\n";
-  it = objects_.begin();
-  while( found == false ) {
-    //std::cout << "remove : look at object " << (*it)->get_id() << "\n";
-    if( *it == object ) {
-      //std::cout << "remove : found\n";
-      objects_.erase(it);
-      found = true;
-    }
-    it++;
-  }
-      
-  return found;
+  return Scene::needs_redraw() or axis_cube_->needs_redraw();
+}
+void
+SceneGraph::set_dirty (bool dirty)
+{
+  Scene::set_dirty (dirty);
+  if (not dirty)
+    axis_cube_->set_dirty (false);
+}
+void
+SceneGraph::set_time (double time)
+{
+  Scene::set_time (time);
+  axis_cube_->set_time (time);
 }
 // ===========================================================================
-ObjectPtr
-SceneGraph::get_object( unsigned int id)
+bool
+SceneGraph::render_cube_layer (void)
 {
-  unsigned int i;
+  if (not get_layer_cache())
+    return false;
+  if (not cube_layer_)
+    cube_layer_ = LayerCachePtr (new LayerCache());
+
+  // Scene area, as set by view_start
+  int viewport[4];
+  RenderState::get_viewport (viewport);
+  cube_layer_->set_key (get_layer_key());
+  if (Widget::needs_redraw() or axis_cube_->needs_redraw())
+    cube_layer_->invalidate();
 
-  for (i=0; i<objects_.size(); i++) {
-    if ( objects_[i]->check_id( id ) == true ) {
-      return objects_[i];
-    }
+  if (not cube_layer_->get_valid()) {
+    if (not cube_layer_->begin (viewport[2], viewport[3]))
+      return false;
+    glDisable (GL_DEPTH_TEST);
+    axis_cube_->render();
+    cube_layer_->end ();
   }
-#ifdef HAVE_BOOST
-  return ObjectPtr();
-#else
-  return NULL;
-#endif
+  // BasisCube does not write depth
+  cube_layer_->draw (false);
+  return true;
 }
- // ===========================================================================
+// ===========================================================================
 std::string
 SceneGraph::dump_objects (void)
 {
@@ -119,126 +126,61 @@ SceneGraph::render ()
 //   build_rotmatrix (m, view_.data);
 //   glMultMatrixf (&m[0][0]);
   
-  GLint viewport[4]; 
-  glGetIntegerv (GL_VIEWPORT, viewport);
-  GLint scissor[4]; 
-  glGetIntegerv (GL_SCISSOR_BOX, scissor);
-  GLint scissor_active;
-  GLint mode;
-  glGetIntegerv (GL_RENDER_MODE, &mode);
-  glGetIntegerv (GL_SCISSOR_TEST, &scissor_active);
-  float height = viewport[3];
-  
+  if (render_panel())
+    return;
+  frame_start ();
   render_start ();
   if (not get_visible()) {
     render_finish ();
+    frame_finish ();
     return;
   }    
-  if (mode == GL_RENDER) {
+  if (not picking_) {
     Widget::render();
   }
   render_finish ();
   
-  glPushAttrib (GL_VIEWPORT_BIT | GL_SCISSOR_BIT);
-  
-  int border = 2;
-  if ((get_br_color().alpha * alpha_) == 0) {
-    border = 0;
-  }
-  
-  // Set scissor test
-  int x = viewport[0] + int(get_position().x + border/2);
-  int y = viewport[1] + int(height-get_position().y-get_size().y + border/2);
-  int w = int(get_size().x) - border;
-  int h = int(get_size().y) - border;
-  if (scissor_active) {
-    if (x < scissor[0])
-      x = scissor[0];
-    if (y < scissor[1])
-      y = scissor[1];
-    if ((x+w) > (viewport[0]+scissor[2]))
-      w += (viewport[0]+scissor[2]) - (x+w);
-    if ((y+h) > (viewport[1]+scissor[3]))
-      h += (viewport[1]+scissor[3]) - (y+h);
-  }
-  glEnable (GL_SCISSOR_TEST);
-  glScissor (x,y,w,h);
-  // Set viewport
-  glViewport (viewport[0]+int(get_position().x) + border/2,
-	      viewport[1]+int(height-get_position().y-get_size().y+border/2),
-	      int(get_size().x)-border,
-	      int(get_size().y)-border);
-  
-  
-  // Set modelview 
-  glClear(GL_DEPTH_BUFFER_BIT);
-  glMatrixMode (GL_PROJECTION);
-  glPushMatrix();
-  glLoadIdentity ();
-  
-  if (mode == GL_SELECT) {
-    GLint v[4];
-    glGetIntegerv (GL_VIEWPORT, v);
-    gluPickMatrix (pointer_.x, pointer_.y, 5, 5, v);
-  }
-  
-  float aspect = 1.0f;
-  aspect = get_size().x / get_size().y;
-  float aperture = 25.0f;
-  float near = 1.0f;
-  float far = 100.0f;
-  float top = tan(aperture*3.14159/360.0) * near;
-  float bottom = -top;
-  float left = aspect * bottom;
-  float right = aspect * top;
-  if (get_ortho_mode())
-    glOrtho (left, right, bottom, top, near, far);
-  else
-    glFrustum (left, right, bottom, top, near, far);
-  
-  glMatrixMode (GL_MODELVIEW);
-  glPushMatrix();
-  glLoadIdentity ();
-  glTranslatef (0.0, 0, -8.0f);
-  glScalef (zoom_, zoom_, zoom_);
-  float m[4][4];
-  build_rotmatrix (m, view_.data);
-  glMultMatrixf (&m[0][0]);
+  view_start ();
   
   // 
   setup();
   
   // Back widgets
   glDisable (GL_DEPTH_TEST);
-  for (unsigned int i=0; i<widgets_.size(); i++)
+  for (unsigned int i=0; (not picking_) and (i<widgets_.size()); i++)
     if (widgets_.at(i)->get_position().z < 0)
       widgets_.at(i)->render();
   
   // Objects
   glEnable (GL_DEPTH_TEST);
   glEnable (GL_LIGHTING);
-  for (unsigned int i=0; i<objects_.size(); i++)
+  bool cached = (not picking_) and render_static_layer (false);
+  for (unsigned int i=0; i<objects_.size(); i++) {
+    if (picking_)
+      picker_->set_key (pick_key (objects_.at(i)));
+    else if (cached and objects_.at(i)->get_static())
+      continue;
+    else if (objects_.at(i)->submit (*queue_))
+      continue;
     objects_.at(i)->render();
+  }
+  queue_->flush ();
 
   // BasisCube, rendered "after" to allow for transparency.
+  // It is not pickable since it would hide objects behind it.
   glDisable (GL_DEPTH_TEST);
-  axis_cube_->render();
+  if ((not picking_) and (not render_cube_layer()))
+    axis_cube_->render();
   glDisable (GL_LIGHTING);
 
   
   // Front widgets
   glDisable (GL_DEPTH_TEST);
-  for (unsigned int i=0; i<widgets_.size(); i++)
-    if (widgets_.at(i)->get_position().z >= 0)
-      widgets_.at(i)->render();
+  if (not picking_)
+    overlay_->render (widgets_);
 
-  glMatrixMode (GL_MODELVIEW);
-  glPopMatrix();
-  glMatrixMode (GL_PROJECTION);
-  glPopMatrix();
-  
-  //glDisable (GL_SCISSOR_TEST);
-  glPopAttrib ();
+  view_finish ();
+  frame_finish ();
 }
 // ============================================================================
 void
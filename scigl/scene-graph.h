@@ -73,9 +73,27 @@ class SceneGraph : public Scene {
    * -# graphical objects
    * -# BasisCube, so as to allow for transparency
    * -# Widgets with a positive z
+   *
+   * With layer cache (see Scene::set_layer_cache), the BasisCube belongs to
+   * the static layer and is drawn under graphical objects instead.
    */
   virtual void render (void);
 
+  /**
+   * Whether scene, including BasisCube, needs to be redrawn
+   */
+  virtual bool needs_redraw (void) const;
+
+  /**
+   * Set whether scene needs to be redrawn (see Scene::set_dirty)
+   */
+  virtual void set_dirty (bool dirty = true);
+
+  /**
+   * Set time of the frame being rendered (see Scene::set_time)
+   */
+  virtual void set_time (double time);
+
   /**
    * @name SetAxisSize
    *
@@ -101,28 +119,30 @@ class SceneGraph : public Scene {
   
 
   /**
-   * Remove a graphical object
-   *
-   * @return true if object removed
+   * Get BasisCube.
    */
-  virtual bool remove (ObjectPtr object);
+  BasisCubePtr get_basis_cube (void);
+
+ protected:
   /**
-   * Get a graphical object by its id.
+   * Draw BasisCube through its own layer cache, rendering it again first if
+   * needed. The cube is drawn over all objects, like when it is rendered
+   * directly, hence it is not part of the static layer.
    *
-   * @return ObjectPtr of empty sharedPtr/NULL
+   * @return false if layer cache is disabled or not available, BasisCube
+   *         must then be rendered directly
    */
-  virtual ObjectPtr get_object( unsigned int id);
+  virtual bool render_cube_layer (void);
 
   /**
-   * Get BasisCube.
+   * A BasisCube to display coordinates.
    */
-  BasisCubePtr get_basis_cube (void);
+  BasisCubePtr axis_cube_;
 
- protected:
   /**
-   * A BasisCube to display coordinates.
+   * Layer cache of BasisCube
    */
-  BasisCubePtr axis_cube_;
+  LayerCachePtr cube_layer_;
 
  public:
   /**
@@ -17,6 +17,58 @@
 #include <iostream>
 #include "trackball.h" 
 #include "scene.h"
+#include "cloud.h"
+#include "worker-pool.h"
+
+// _______________________________________________________________ invert_matrix
+// Invert a column-major 4x4 matrix, returning false if it is singular.
+static bool
+invert_matrix (const float *m, float *inverse)
+{
+    float r[16];
+    r[0]  =  m[5]*m[10]*m[15] - m[5]*m[11]*m[14] - m[9]*m[6]*m[15]
+           + m[9]*m[7]*m[14] + m[13]*m[6]*m[11] - m[13]*m[7]*m[10];
+    r[4]  = -m[4]*m[10]*m[15] + m[4]*m[11]*m[14] + m[8]*m[6]*m[15]
+           - m[8]*m[7]*m[14] - m[12]*m[6]*m[11] + m[12]*m[7]*m[10];
+    r[8]  =  m[4]*m[9]*m[15] - m[4]*m[11]*m[13] - m[8]*m[5]*m[15]
+           + m[8]*m[7]*m[13] + m[12]*m[5]*m[11] - m[12]*m[7]*m[9];
+    r[12] = -m[4]*m[9]*m[14] + m[4]*m[10]*m[13] + m[8]*m[5]*m[14]
+           - m[8]*m[6]*m[13] - m[12]*m[5]*m[10] + m[12]*m[6]*m[9];
+    r[1]  = -m[1]*m[10]*m[15] + m[1]*m[11]*m[14] + m[9]*m[2]*m[15]
+           - m[9]*m[3]*m[14] - m[13]*m[2]*m[11] + m[13]*m[3]*m[10];
+    r[5]  =  m[0]*m[10]*m[15] - m[0]*m[11]*m[14] - m[8]*m[2]*m[15]
+           + m[8]*m[3]*m[14] + m[12]*m[2]*m[11] - m[12]*m[3]*m[10];
+    r[9]  = -m[0]*m[9]*m[15] + m[0]*m[11]*m[13] + m[8]*m[1]*m[15]
+           - m[8]*m[3]*m[13] - m[12]*m[1]*m[11] + m[12]*m[3]*m[9];
+    r[13] =  m[0]*m[9]*m[14] - m[0]*m[10]*m[13] - m[8]*m[1]*m[14]
+           + m[8]*m[2]*m[13] + m[12]*m[1]*m[10] - m[12]*m[2]*m[9];
+    r[2]  =  m[1]*m[6]*m[15] - m[1]*m[7]*m[14] - m[5]*m[2]*m[15]
+           + m[5]*m[3]*m[14] + m[13]*m[2]*m[7] - m[13]*m[3]*m[6];
+    r[6]  = -m[0]*m[6]*m[15] + m[0]*m[7]*m[14] + m[4]*m[2]*m[15]
+           - m[4]*m[3]*m[14] - m[12]*m[2]*m[7] + m[12]*m[3]*m[6];
+    r[10] =  m[0]*m[5]*m[15] - m[0]*m[7]*m[13] - m[4]*m[1]*m[15]
+           + m[4]*m[3]*m[13] + m[12]*m[1]*m[7] - m[12]*m[3]*m[5];
+    r[14] = -m[0]*m[5]*m[14] + m[0]*m[6]*m[13] + m[4]*m[1]*m[14]
+           - m[4]*m[2]*m[13] - m[12]*m[1]*m[6] + m[12]*m[2]*m[5];
+    r[3]  = -m[1]*m[6]*m[11] + m[1]*m[7]*m[10] + m[5]*m[2]*m[11]
+           - m[5]*m[3]*m[10] - m[9]*m[2]*m[7] + m[9]*m[3]*m[6];
+    r[7]  =  m[0]*m[6]*m[11] - m[0]*m[7]*m[10] - m[4]*m[2]*m[11]
+           + m[4]*m[3]*m[10] + m[8]*m[2]*m[7] - m[8]*m[3]*m[6];
+    r[11] = -m[0]*m[5]*m[11] + m[0]*m[7]*m[9] + m[4]*m[1]*m[11]
+           - m[4]*m[3]*m[9] - m[8]*m[1]*m[7] + m[8]*m[3]*m[5];
+    r[15] =  m[0]*m[5]*m[10] - m[0]*m[6]*m[9] - m[4]*m[1]*m[10]
+           + m[4]*m[2]*m[9] + m[8]*m[1]*m[6] - m[8]*m[2]*m[5];
+    float det = m[0]*r[0] + m[1]*r[4] + m[2]*r[8] + m[3]*r[12];
+    if (det == 0)
+        return false;
+    for (unsigned int i=0; i<16; i++)
+        inverse[i] = r[i]/det;
+    return true;
+}
+
+// ________________________________________________________________ frame_depth_
+unsigned int
+Scene::frame_depth_ = 0;
 
 // _______________________________________________________________________ Scene
 Scene::Scene (void) : Widget()
@@ -30,6 +82,18 @@ Scene::Scene (void) : Widget()
     pointer_ = Position (-1,-1);
     focus_ = 0;
     ortho_mode_ = false;
+    picker_ = PickerPtr();
+    overlay_ = OverlayPtr (new Overlay());
+    queue_ = RenderQueuePtr (new RenderQueue());
+    picking_ = false;
+    layer_cache_ = false;
+    layer_ = LayerCachePtr();
+    panel_cache_ = false;
+    panel_rendering_ = false;
+    panel_ = LayerCachePtr();
+    clock_ = FrameClock::Default();
+    selection_ = ObjectPtr();
+    selection_index_ = 0;
 
     std::ostringstream oss;
     oss << "Scene_" << id_;
@@ -39,7 +103,10 @@ Scene::Scene (void) : Widget()
 
 // ______________________________________________________________________ ~Scene
 Scene::~Scene (void)
-{}
+{
+    for (unsigned int i=0; i<objects_.size(); i++)
+        objects_[i]->detach (this);
+}
 
 
 // _______________________________________________________________________ setup
@@ -54,7 +121,11 @@ Scene::setup (void)
     glEnable (GL_NORMALIZE);
     glEnable (GL_COLOR_MATERIAL);
     glColorMaterial(GL_FRONT_AND_BACK, GL_AMBIENT_AND_DIFFUSE);
-    glBlendFunc (GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    // Alpha accumulates coverage such that rendering into a layer cache
+    // (see LayerCache::begin) gives premultiplied colors, colors are blended
+    // as usual.
+    glBlendFuncSeparate (GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA,
+                         GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
     glHint (GL_LINE_SMOOTH_HINT, GL_NICEST);
     GLfloat ambient[] = {0.1f, 0.1f, 0.1f, 1.0f};
     GLfloat diffuse[] = {1.0f, 1.0f, 1.0f, 1.0f};
@@ -77,101 +148,99 @@ Scene::update (void)
 }
 
 
+// _____________________________________________________________________ prepare
+void
+Scene::prepare (WorkerPool &pool)
+{
+    for (unsigned int i=0; i<widgets_.size(); i++)
+        widgets_.at(i)->prepare (pool);
+    for (unsigned int i=0; i<objects_.size(); i++)
+        objects_.at(i)->prepare (pool);
+}
+
+
 // ______________________________________________________________________ render
 void
 Scene::render (void)
 {
-    GLint viewport[4]; 
-    glGetIntegerv (GL_VIEWPORT, viewport);
-    GLint scissor[4]; 
-    glGetIntegerv (GL_SCISSOR_BOX, scissor);
-    GLint scissor_active;
-    GLint mode;
-    glGetIntegerv (GL_RENDER_MODE, &mode);
-    glGetIntegerv (GL_SCISSOR_TEST, &scissor_active);
-    float height = viewport[3];
-
+    if (render_panel())
+        return;
+    frame_start ();
     render_start ();
     if (not get_visible()) {
         render_finish ();
+        frame_finish ();
         return;
     }    
-    if (mode == GL_RENDER) {
+    if (not picking_) {
         Widget::render();
     }
     render_finish ();
 
-    glPushAttrib (GL_VIEWPORT_BIT | GL_SCISSOR_BIT);
+    view_start ();
 
-    int border = 2;
-    if ((get_br_color().alpha * alpha_) == 0) {
-        border = 0;
-    }
+    // 
+    setup();
 
-    // Set scissor test
-    int x = viewport[0] + int(get_position().x + border/2);
-    int y = viewport[1] + int(height-get_position().y-get_size().y + border/2);
-    int w = int(get_size().x) - border;
-    int h = int(get_size().y) - border;
-    if (scissor_active) {
-        if (x < scissor[0])
-            x = scissor[0];
-        if (y < scissor[1])
-            y = scissor[1];
-        if ((x+w) > (viewport[0]+scissor[2]))
-            w += (viewport[0]+scissor[2]) - (x+w);
-        if ((y+h) > (viewport[1]+scissor[3]))
-            h += (viewport[1]+scissor[3]) - (y+h);
-    }
-    glEnable (GL_SCISSOR_TEST);
-    glScissor (x,y,w,h);
-    // Set viewport
-    glViewport (viewport[0]+int(get_position().x) + border/2,
-                viewport[1]+int(height-get_position().y-get_size().y+border/2),
-                int(get_size().x)-border,
-                int(get_size().y)-border);
+    // Back widgets
+    glDisable (GL_DEPTH_TEST);
+    for (unsigned int i=0; (not picking_) and (i<widgets_.size()); i++)
+        if (widgets_.at(i)->get_position().z < 0)
+            widgets_.at(i)->render();
 
+    // Objects
+    glEnable (GL_DEPTH_TEST);
+    //glColor4f(1,1,1,1);
+    //glEnable (GL_LIGHT0);
+    glEnable (GL_LIGHTING);
+    bool cached = (not picking_) and render_static_layer (false);
+    for (unsigned int i=0; i<objects_.size(); i++) {
+        if (picking_)
+            picker_->set_key (pick_key (objects_.at(i)));
+        else if (cached and objects_.at(i)->get_static())
+            continue;
+        else if (objects_.at(i)->submit (*queue_))
+            continue;
+        objects_.at(i)->render();
+    }
+    queue_->flush ();
+    //glDisable (GL_LIGHT0);
+    glDisable (GL_LIGHTING);
 
-    // Set modelview 
-    glClear(GL_DEPTH_BUFFER_BIT);
-    glMatrixMode (GL_PROJECTION);
-    glPushMatrix();
-    glLoadIdentity ();
+    // Front widgets
+    glDisable (GL_DEPTH_TEST);
+    if (not picking_)
+        overlay_->render (widgets_);
 
-    if (mode == GL_SELECT) {
-        GLint v[4];
-        glGetIntegerv (GL_VIEWPORT, v);
-        gluPickMatrix (pointer_.x, pointer_.y, 5, 5, v);
+    view_finish ();
+    frame_finish ();
+}
+// ________________________________________________ render_with_view_orientation
+void
+Scene::render_with_view_orientation (void)
+{
+    if (render_panel (true))
+        return;
+    frame_start ();
+    render_start ();
+    if (not get_visible()) {
+        render_finish ();
+        frame_finish ();
+        return;
+    }    
+    if (not picking_) {
+        Widget::render();
     }
+    render_finish ();
 
-    float aspect = 1.0f;
-    aspect = get_size().x / get_size().y;
-    float aperture = 25.0f;
-    float near = 1.0f;
-    float far = 100.0f;
-    float top = tan(aperture*3.14159/360.0) * near;
-    float bottom = -top;
-    float left = aspect * bottom;
-    float right = aspect * top;
-    if (get_ortho_mode())
-        glOrtho (left, right, bottom, top, near, far);
-    else
-        glFrustum (left, right, bottom, top, near, far);
-
-    glMatrixMode (GL_MODELVIEW);
-    glPushMatrix();
-    glLoadIdentity ();
-    glTranslatef (0.0, 0, -8.0f);
-    glScalef (zoom_, zoom_, zoom_);
-    build_rotmatrix (view_rotation_, view_.data);
-    glMultMatrixf (&view_rotation_[0][0]);
+    view_start ();
 
     // 
     setup();
 
     // Back widgets
     glDisable (GL_DEPTH_TEST);
-    for (unsigned int i=0; i<widgets_.size(); i++)
+    for (unsigned int i=0; (not picking_) and (i<widgets_.size()); i++)
         if (widgets_.at(i)->get_position().z < 0)
             widgets_.at(i)->render();
 
@@ -180,50 +249,279 @@ Scene::render (void)
     //glColor4f(1,1,1,1);
     //glEnable (GL_LIGHT0);
     glEnable (GL_LIGHTING);
-    for (unsigned int i=0; i<objects_.size(); i++)
-        objects_.at(i)->render();
+    bool cached = (not picking_) and render_static_layer (true);
+    for (unsigned int i=0; i<objects_.size(); i++) {
+        if (picking_)
+            picker_->set_key (pick_key (objects_.at(i)));
+        else if (cached and objects_.at(i)->get_static())
+            continue;
+        else if (objects_.at(i)->submit (*queue_))
+            continue;
+        objects_.at(i)->render( view_rotation_ );
+    }
+    queue_->flush ();
     //glDisable (GL_LIGHT0);
     glDisable (GL_LIGHTING);
 
     // Front widgets
     glDisable (GL_DEPTH_TEST);
+    if (not picking_)
+        overlay_->render (widgets_);
+
+    view_finish ();
+    frame_finish ();
+}
+
+
+// ________________________________________________________________ needs_redraw
+bool
+Scene::needs_redraw (void) const
+{
+    if (Widget::needs_redraw())
+        return true;
     for (unsigned int i=0; i<widgets_.size(); i++)
-        if (widgets_.at(i)->get_position().z >= 0)
-            widgets_.at(i)->render();
+        if (widgets_[i]->needs_redraw())
+            return true;
+    for (unsigned int i=0; i<objects_.size(); i++)
+        if (objects_[i]->needs_redraw())
+            return true;
+    return false;
+}
 
-    glMatrixMode (GL_MODELVIEW);
-    glPopMatrix();
-    glMatrixMode (GL_PROJECTION);
-    glPopMatrix();
 
-    //glDisable (GL_SCISSOR_TEST);
-    glPopAttrib ();
+// ___________________________________________________________________ set_dirty
+void
+Scene::set_dirty (bool dirty)
+{
+    Widget::set_dirty (dirty);
+    if (dirty)
+        return;
+    for (unsigned int i=0; i<widgets_.size(); i++)
+        widgets_[i]->set_dirty (false);
+    for (unsigned int i=0; i<objects_.size(); i++)
+        objects_[i]->set_dirty (false);
 }
-// ________________________________________________ render_with_view_orientation
+
+
+// ____________________________________________________________________ set_time
 void
-Scene::render_with_view_orientation (void)
+Scene::set_time (double time)
 {
-    GLint viewport[4]; 
-    glGetIntegerv (GL_VIEWPORT, viewport);
-    GLint scissor[4]; 
-    glGetIntegerv (GL_SCISSOR_BOX, scissor);
-    GLint scissor_active;
-    GLint mode;
-    glGetIntegerv (GL_RENDER_MODE, &mode);
-    glGetIntegerv (GL_SCISSOR_TEST, &scissor_active);
-    float height = viewport[3];
+    Widget::set_time (time);
+    for (unsigned int i=0; i<widgets_.size(); i++)
+        widgets_[i]->set_time (time);
+    for (unsigned int i=0; i<objects_.size(); i++)
+        objects_[i]->set_time (time);
+}
 
-    render_start ();
-    if (not get_visible()) {
-        render_finish ();
+
+// _____________________________________________________________ set_layer_cache
+void
+Scene::set_layer_cache (bool cache)
+{
+    set_dirty ();
+    layer_cache_ = cache;
+    if (not cache)
+        layer_ = LayerCachePtr();
+}
+
+
+// _____________________________________________________________ get_layer_cache
+bool
+Scene::get_layer_cache (void) const
+{
+    return layer_cache_;
+}
+
+
+// _____________________________________________________________ set_panel_cache
+void
+Scene::set_panel_cache (bool cache)
+{
+    set_dirty ();
+    panel_cache_ = cache;
+    if (not cache)
+        panel_ = LayerCachePtr();
+}
+
+
+// _____________________________________________________________ get_panel_cache
+bool
+Scene::get_panel_cache (void) const
+{
+    return panel_cache_;
+}
+
+
+// ________________________________________________________________ render_panel
+bool
+Scene::render_panel (bool oriented)
+{
+    // Outermost scene starts the frame (clock, preparation), it is never
+    // cached.
+    if ((not panel_cache_) or panel_rendering_ or picking_
+        or (frame_depth_ == 0) or (not get_visible()))
+        return false;
+    if (not panel_)
+        panel_ = LayerCachePtr (new LayerCache());
+
+    // Scene area within parent viewport
+    compute_size ();
+    compute_position ();
+    int viewport[4];
+    RenderState::get_viewport (viewport);
+    int x = viewport[0] + int(get_position().x);
+    int y = viewport[1] + int(viewport[3]-get_position().y-get_size().y);
+    int w = int(get_size().x);
+    int h = int(get_size().y);
+
+    std::vector<float> key (8);
+    for (unsigned int i=0; i<4; i++)
+        key[i] = view_.data[i];
+    key[4] = zoom_;
+    key[5] = ortho_mode_;
+    key[6] = w;
+    key[7] = h;
+    panel_->set_key (key);
+    if (needs_redraw())
+        panel_->invalidate();
+
+    if (not panel_->get_valid()) {
+        if (not panel_->begin (w, h))
+            return false;
+        // Parent viewport shifted such that scene area is the cache
+        RenderState::viewport (viewport[0]-x, viewport[1]-y,
+                               viewport[2], viewport[3]);
+        panel_rendering_ = true;
+        if (oriented)
+            render_with_view_orientation ();
+        else
+            render ();
+        panel_rendering_ = false;
+        panel_->end ();
+    }
+
+    RenderState::push_attrib (GL_VIEWPORT_BIT);
+    RenderState::viewport (x, y, w, h);
+    panel_->draw (false);
+    RenderState::pop_attrib ();
+    return true;
+}
+
+
+// _________________________________________________________ render_static_layer
+bool
+Scene::render_static_layer (bool oriented)
+{
+    if (not layer_cache_)
+        return false;
+    if (not layer_)
+        layer_ = LayerCachePtr (new LayerCache());
+
+    // Scene area, as set by view_start
+    int viewport[4];
+    RenderState::get_viewport (viewport);
+    layer_->set_key (get_layer_key());
+    if (get_static_changed())
+        layer_->invalidate();
+
+    if (not layer_->get_valid()) {
+        if (not layer_->begin (viewport[2], viewport[3]))
+            return false;
+        render_static_objects (oriented);
+        layer_->end ();
+    }
+    layer_->draw ();
+    return true;
+}
+
+
+// _______________________________________________________________ get_layer_key
+std::vector<float>
+Scene::get_layer_key (void) const
+{
+    int viewport[4];
+    RenderState::get_viewport (viewport);
+    std::vector<float> key (8);
+    for (unsigned int i=0; i<4; i++)
+        key[i] = view_.data[i];
+    key[4] = zoom_;
+    key[5] = ortho_mode_;
+    key[6] = viewport[2];
+    key[7] = viewport[3];
+    return key;
+}
+
+
+// __________________________________________________________ get_static_changed
+bool
+Scene::get_static_changed (void) const
+{
+    if (Widget::needs_redraw())
+        return true;
+    for (unsigned int i=0; i<objects_.size(); i++)
+        if (objects_[i]->get_static() and objects_[i]->needs_redraw())
+            return true;
+    return false;
+}
+
+
+// _______________________________________________________ render_static_objects
+void
+Scene::render_static_objects (bool oriented)
+{
+    for (unsigned int i=0; i<objects_.size(); i++) {
+        if (not objects_.at(i)->get_static())
+            continue;
+        if (objects_.at(i)->submit (*queue_))
+            continue;
+        if (oriented)
+            objects_.at(i)->render (view_rotation_);
+        else
+            objects_.at(i)->render ();
+    }
+    queue_->flush ();
+}
+
+
+// _________________________________________________________________ frame_start
+void
+Scene::frame_start (void)
+{
+    if (picking_)
         return;
-    }    
-    if (mode == GL_RENDER) {
-        Widget::render();
+    if (frame_depth_++ == 0) {
+        set_time (clock_->tick (this));
+        RenderState::begin_frame ();
+        WorkerPoolPtr pool = WorkerPool::Default();
+        prepare (*pool);
+        pool->wait ();
     }
-    render_finish ();
+}
+
+
+// ________________________________________________________________ frame_finish
+void
+Scene::frame_finish (void)
+{
+    if (picking_)
+        return;
+    frame_depth_--;
+    set_dirty (false);
+}
 
-    glPushAttrib (GL_VIEWPORT_BIT | GL_SCISSOR_BIT);
+
+// __________________________________________________________________ view_start
+void
+Scene::view_start (void)
+{
+    int viewport[4];
+    RenderState::get_viewport (viewport);
+    int scissor[4];
+    bool scissor_active = RenderState::get_scissor (scissor);
+    float height = viewport[3];
+
+    RenderState::push_attrib (GL_VIEWPORT_BIT | GL_SCISSOR_BIT);
 
     int border = 2;
     if ((get_br_color().alpha * alpha_) == 0) {
@@ -245,26 +543,33 @@ Scene::render_with_view_orientation (void)
         if ((y+h) > (viewport[1]+scissor[3]))
             h += (viewport[1]+scissor[3]) - (y+h);
     }
-    glEnable (GL_SCISSOR_TEST);
-    glScissor (x,y,w,h);
+    if (picking_)
+        RenderState::scissor (int(pointer_.x), int(pointer_.y), 1, 1);
+    else
+        RenderState::scissor (x,y,w,h);
     // Set viewport
-    glViewport (viewport[0]+int(get_position().x) + border/2,
-                viewport[1]+int(height-get_position().y-get_size().y+border/2),
-                int(get_size().x)-border,
-                int(get_size().y)-border);
+    RenderState::viewport (viewport[0]+int(get_position().x) + border/2,
+                           viewport[1]+int(height-get_position().y-get_size().y+border/2),
+                           int(get_size().x)-border,
+                           int(get_size().y)-border);
 
 
     // Set modelview 
     glClear(GL_DEPTH_BUFFER_BIT);
-    glMatrixMode (GL_PROJECTION);
-    glPushMatrix();
-    glLoadIdentity ();
+    RenderState::matrix_mode (GL_PROJECTION);
+    RenderState::push_matrix ();
+    view_projection ();
+    RenderState::matrix_mode (GL_MODELVIEW);
+    RenderState::push_matrix ();
+    view_modelview ();
+}
 
-    if (mode == GL_SELECT) {
-        GLint v[4];
-        glGetIntegerv (GL_VIEWPORT, v);
-        gluPickMatrix (pointer_.x, pointer_.y, 5, 5, v);
-    }
+
+// _____________________________________________________________ view_projection
+void
+Scene::view_projection (void)
+{
+    RenderState::load_identity ();
 
     float aspect = 1.0f;
     aspect = get_size().x / get_size().y;
@@ -276,50 +581,35 @@ Scene::render_with_view_orientation (void)
     float left = aspect * bottom;
     float right = aspect * top;
     if (get_ortho_mode())
-        glOrtho (left, right, bottom, top, near, far);
+        RenderState::ortho (left, right, bottom, top, near, far);
     else
-        glFrustum (left, right, bottom, top, near, far);
-
-    glMatrixMode (GL_MODELVIEW);
-    glPushMatrix();
-    glLoadIdentity ();
-    glTranslatef (0.0, 0, -8.0f);
-    glScalef (zoom_, zoom_, zoom_);
-    build_rotmatrix (view_rotation_, view_.data);
-    glMultMatrixf (&view_rotation_[0][0]);
-
-    // 
-    setup();
+        RenderState::frustum (left, right, bottom, top, near, far);
+}
 
-    // Back widgets
-    glDisable (GL_DEPTH_TEST);
-    for (unsigned int i=0; i<widgets_.size(); i++)
-        if (widgets_.at(i)->get_position().z < 0)
-            widgets_.at(i)->render();
 
-    // Objects
-    glEnable (GL_DEPTH_TEST);
-    //glColor4f(1,1,1,1);
-    //glEnable (GL_LIGHT0);
-    glEnable (GL_LIGHTING);
-    for (unsigned int i=0; i<objects_.size(); i++)
-        objects_.at(i)->render( view_rotation_ );
-    //glDisable (GL_LIGHT0);
-    glDisable (GL_LIGHTING);
+// ______________________________________________________________ view_modelview
+void
+Scene::view_modelview (void)
+{
+    RenderState::load_identity ();
+    RenderState::translate (0.0, 0, -8.0f);
+    RenderState::scale (zoom_, zoom_, zoom_);
+    build_rotmatrix (view_rotation_, view_.data);
+    RenderState::mult_matrix (&view_rotation_[0][0]);
+}
 
-    // Front widgets
-    glDisable (GL_DEPTH_TEST);
-    for (unsigned int i=0; i<widgets_.size(); i++)
-        if (widgets_.at(i)->get_position().z >= 0)
-            widgets_.at(i)->render();
 
-    glMatrixMode (GL_MODELVIEW);
-    glPopMatrix();
-    glMatrixMode (GL_PROJECTION);
-    glPopMatrix();
+// _________________________________________________________________ view_finish
+void
+Scene::view_finish (void)
+{
+    RenderState::matrix_mode (GL_MODELVIEW);
+    RenderState::pop_matrix ();
+    RenderState::matrix_mode (GL_PROJECTION);
+    RenderState::pop_matrix ();
+    RenderState::matrix_mode (GL_MODELVIEW);
 
-    //glDisable (GL_SCISSOR_TEST);
-    glPopAttrib ();
+    RenderState::pop_attrib ();
 }
 
 
@@ -371,7 +661,10 @@ Scene::save (std::string filename) {
 void
 Scene::add (ObjectPtr object)
 {
+    set_dirty ();
     objects_.push_back (object);
+    object->attach (this);
+    index_object (objects_.size()-1);
 }
 
 
@@ -379,6 +672,7 @@ Scene::add (ObjectPtr object)
 void
 Scene::add (WidgetPtr widget)
 {
+    set_dirty ();
     unsigned int i;
     for (i=0; i<widgets_.size(); i++) {
         if (widget->get_position().z < widgets_[i]->get_position().z) {
@@ -391,34 +685,207 @@ Scene::add (WidgetPtr widget)
 
 // __________________________________________________________________ get_object
 ObjectPtr
-Scene::get_object( const std::string name ) const
+Scene::get_object (const std::string name) const
 {
-    return ObjectPtr();
+    int i = find_object (name);
+    if (i < 0)
+        return ObjectPtr();
+    return objects_[i];
 }
 
+
 // __________________________________________________________________ operator[]
 ObjectPtr
-Scene::operator[]( const std::string name ) const 
+Scene::operator[] (const std::string name) const
+{
+    return get_object (name);
+}
+
+
+// __________________________________________________________________ get_object
+ObjectPtr
+Scene::get_object (unsigned int id)
 {
-    return ObjectPtr();
+    ObjectIdIndex::const_iterator it = ids_.find (id);
+    if (it == ids_.end())
+        return ObjectPtr();
+    return objects_[it->second];
 }
 
+
 // __________________________________________________________________ set_object
 void
-Scene::set_object( const std::string name, const ObjectPtr object )
-{}
+Scene::set_object (const std::string name, const ObjectPtr object)
+{
+    set_dirty ();
+    int i = find_object (name);
+    int j = find_slot (object);
+
+    // Object already in scene: it is renamed in place, the object previously
+    // known under name (if any) being removed.
+    if (j >= 0) {
+        if ((i >= 0) and (i != j)) {
+            unsigned int last = objects_.size()-1;
+            remove_object (i);
+            if (j == int(last))
+                j = i;
+        }
+        object->set_name (name);
+        return;
+    }
+
+    object->set_name (name);
+    if (i < 0) {
+        add (object);
+        return;
+    }
+    unindex_object (i);
+    objects_[i]->detach (this);
+    objects_[i] = object;
+    object->attach (this);
+    index_object (i);
+}
+
 
 // __________________________________________________________________ has_object
 bool
-Scene::has_object( const std::string name )
+Scene::has_object (const std::string name) const
 {
-    return false;
+    return find_object (name) >= 0;
 }
 
+
 // __________________________________________________________________ del_object
 void
-Scene::del_object( const std::string name )
-{}
+Scene::del_object (const std::string name)
+{
+    int i = find_object (name);
+    if (i >= 0)
+        remove_object (i);
+}
+
+
+// ______________________________________________________________________ remove
+bool
+Scene::remove (ObjectPtr object)
+{
+    int i = find_slot (object);
+    if (i < 0)
+        return false;
+    remove_object (i);
+    return true;
+}
+
+
+// _____________________________________________________________________ renamed
+void
+Scene::renamed (Object *object, const std::string &previous)
+{
+    std::pair<ObjectNameIndex::iterator,ObjectNameIndex::iterator> range =
+        names_.equal_range (previous);
+    std::vector<unsigned int> slots;
+    for (ObjectNameIndex::iterator it = range.first; it != range.second; ) {
+        if (&*objects_[it->second] == object) {
+            slots.push_back (it->second);
+            names_.erase (it++);
+        } else
+            ++it;
+    }
+    for (unsigned int k=0; k<slots.size(); k++)
+        names_.insert (std::make_pair (object->get_name(), slots[k]));
+}
+
+
+// ________________________________________________________________ reidentified
+void
+Scene::reidentified (Object *object, unsigned int previous)
+{
+    std::pair<ObjectIdIndex::iterator,ObjectIdIndex::iterator> range =
+        ids_.equal_range (previous);
+    std::vector<unsigned int> slots;
+    for (ObjectIdIndex::iterator it = range.first; it != range.second; ) {
+        if (&*objects_[it->second] == object) {
+            slots.push_back (it->second);
+            ids_.erase (it++);
+        } else
+            ++it;
+    }
+    for (unsigned int k=0; k<slots.size(); k++)
+        ids_.insert (std::make_pair ((unsigned int) object->get_id(), slots[k]));
+}
+
+
+// _________________________________________________________________ find_object
+int
+Scene::find_object (const std::string &name) const
+{
+    ObjectNameIndex::const_iterator it = names_.find (name);
+    if (it == names_.end())
+        return -1;
+    return it->second;
+}
+
+
+// ___________________________________________________________________ find_slot
+int
+Scene::find_slot (const ObjectPtr object) const
+{
+    std::pair<ObjectIdIndex::const_iterator,ObjectIdIndex::const_iterator>
+        range = ids_.equal_range (object->get_id());
+    for (ObjectIdIndex::const_iterator it = range.first; it != range.second; ++it)
+        if (objects_[it->second] == object)
+            return it->second;
+    return -1;
+}
+
+
+// ________________________________________________________________ index_object
+void
+Scene::index_object (unsigned int i)
+{
+    names_.insert (std::make_pair (objects_[i]->get_name(), i));
+    ids_.insert (std::make_pair ((unsigned int) objects_[i]->get_id(), i));
+}
+
+
+// ______________________________________________________________ unindex_object
+void
+Scene::unindex_object (unsigned int i)
+{
+    std::pair<ObjectNameIndex::iterator,ObjectNameIndex::iterator> names =
+        names_.equal_range (objects_[i]->get_name());
+    for (ObjectNameIndex::iterator it = names.first; it != names.second; ++it) {
+        if (it->second == i) {
+            names_.erase (it);
+            break;
+        }
+    }
+    std::pair<ObjectIdIndex::iterator,ObjectIdIndex::iterator> ids =
+        ids_.equal_range (objects_[i]->get_id());
+    for (ObjectIdIndex::iterator it = ids.first; it != ids.second; ++it) {
+        if (it->second == i) {
+            ids_.erase (it);
+            break;
+        }
+    }
+}
+
+
+// _______________________________________________________________ remove_object
+void
+Scene::remove_object (unsigned int i)
+{
+    set_dirty ();
+    unsigned int last = objects_.size()-1;
+    unindex_object (i);
+    objects_[i]->detach (this);
+    if (i != last) {
+        unindex_object (last);
+        objects_[i] = objects_[last];
+        index_object (i);
+    }
+    objects_.pop_back();
+}
 
 
 
@@ -426,7 +893,145 @@ Scene::del_object( const std::string name )
 bool
 Scene::select (int x, int y)
 {
-    return false;
+    pick (x,y);
+    selection_ = get_pick (&selection_index_);
+    if (not selection_) {
+        selection_index_ = 0;
+        return false;
+    }
+    Position origin;
+    Direction direction;
+    get_ray (x, y, origin, direction);
+    if (selection_->select (origin, direction)) {
+        Cloud *cloud = dynamic_cast<Cloud *>(&*selection_);
+        if (cloud and (cloud->get_selection() >= 0))
+            selection_index_ = cloud->get_selection();
+    }
+    return true;
+}
+
+
+// _______________________________________________________________ get_selection
+ObjectPtr
+Scene::get_selection (unsigned int *index)
+{
+    if (index)
+        *index = selection_index_;
+    return selection_;
+}
+
+
+// _____________________________________________________________________ get_ray
+void
+Scene::get_ray (int x, int y, Position &origin, Direction &direction)
+{
+    int border = 2;
+    if ((get_br_color().alpha * alpha_) == 0) {
+        border = 0;
+    }
+    float w = get_size().x - border;
+    float h = get_size().y - border;
+    float px = 2*(x - get_position().x - border/2)/w - 1;
+    float py = 1 - 2*(y - get_position().y - border/2)/h;
+
+    // Matrices set by view_start
+    float projection[16], modelview[16];
+    RenderState::matrix_mode (GL_PROJECTION);
+    RenderState::push_matrix ();
+    view_projection ();
+    for (unsigned int i=0; i<16; i++)
+        projection[i] = RenderState::get_projection()[i];
+    RenderState::pop_matrix ();
+    RenderState::matrix_mode (GL_MODELVIEW);
+    RenderState::push_matrix ();
+    view_modelview ();
+    for (unsigned int i=0; i<16; i++)
+        modelview[i] = RenderState::get_modelview()[i];
+    RenderState::pop_matrix ();
+
+    // Unproject pointer on near and far planes
+    float m[16], inverse[16];
+    for (unsigned int c=0; c<4; c++)
+        for (unsigned int l=0; l<4; l++)
+            m[c*4+l] = projection[0*4+l]*modelview[c*4+0]
+                     + projection[1*4+l]*modelview[c*4+1]
+                     + projection[2*4+l]*modelview[c*4+2]
+                     + projection[3*4+l]*modelview[c*4+3];
+    if (not invert_matrix (m, inverse)) {
+        origin = Position (0,0,0);
+        direction = Direction (0,0,-1);
+        return;
+    }
+    float p[2][4];
+    for (unsigned int k=0; k<2; k++) {
+        float ndc[4] = {px, py, k ? 1.0f : -1.0f, 1.0f};
+        for (unsigned int l=0; l<4; l++)
+            p[k][l] = inverse[0*4+l]*ndc[0] + inverse[1*4+l]*ndc[1]
+                    + inverse[2*4+l]*ndc[2] + inverse[3*4+l]*ndc[3];
+        for (unsigned int l=0; l<3; l++)
+            p[k][l] /= p[k][3];
+    }
+    for (unsigned int i=0; i<3; i++) {
+        origin.data[i]    = p[0][i];
+        direction.data[i] = p[1][i] - p[0][i];
+    }
+    origin.data[3] = direction.data[3] = 0;
+}
+
+
+// ________________________________________________________________________ pick
+void
+Scene::pick (int x, int y)
+{
+    RenderState::begin_frame ();
+    int viewport[4];
+    RenderState::get_viewport (viewport);
+    pointer_.x = viewport[0] + x;
+    pointer_.y = viewport[1] + viewport[3] - y - 1;
+
+    if (not picker_)
+        picker_ = PickerPtr (new Picker());
+    if (not picker_->begin (viewport[0]+viewport[2], viewport[1]+viewport[3],
+                            int(pointer_.x), int(pointer_.y)))
+        return;
+    picking_ = true;
+    render();
+    picking_ = false;
+    picker_->end();
+}
+
+
+// ____________________________________________________________________ get_pick
+ObjectPtr
+Scene::get_pick (unsigned int *index)
+{
+    unsigned int key, primitive;
+    if ((not picker_) or (not picker_->result (key, primitive)))
+        return ObjectPtr();
+    if (key == 0)
+        return ObjectPtr();
+
+    // Ids fitting on 24 bits are resolved through the id index, others
+    // through a scan for the folded key.
+    ObjectPtr object = get_object (key);
+    if (not object or (pick_key (object) != key)) {
+        object = ObjectPtr();
+        for (unsigned int i=0; (not object) and (i<objects_.size()); i++)
+            if (pick_key (objects_[i]) == key)
+                object = objects_[i];
+    }
+    if (object and index)
+        *index = primitive;
+    return object;
+}
+
+
+// ____________________________________________________________________ pick_key
+unsigned int
+Scene::pick_key (const ObjectPtr object) const
+{
+    unsigned int key = object->get_id() % 0xffffff;
+    return key ? key : 0xffffff;
 }
 
 
@@ -449,53 +1054,11 @@ Scene::keyboard_action (std::string action, std::string keyname)
 bool
 Scene::mouse_action_start (std::string action, int x, int y)
 {
-    // Selection
-    /*
-    if (button == 2) {
-        GLint viewport[4]; 
-        glGetIntegerv (GL_VIEWPORT, viewport);
-        pointer_.x = x;
-        pointer_.y = viewport[3]-y;
-        GLuint buffer[512];
-        GLint hits;
-        glSelectBuffer (512, buffer);
-        glRenderMode (GL_SELECT);
-        glInitNames ();
-        glPushName (0);
-        glPushMatrix();
-        glLoadIdentity();
-        render();
-        hits = glRenderMode (GL_RENDER);
-        GLuint choose = 0, depth = 0;
-        //printf("Hits: %d\n", int(hits));
-        if (hits > 0) {
-            choose = buffer[3];
-            depth  = buffer[1];
-            for (int loop=1; loop<hits; loop++) {
-                if (buffer[loop*4+1] < GLuint(depth)) { 
-                    choose = buffer[loop*4+3];
-                    depth = buffer[loop*4+1];
-                } 
-            }
-        }
-        glPopMatrix();
-        glPopName();
-        if (choose) {
-            for (unsigned int i=0; i<objects_.size(); i++) {
-                if (objects_[i]->check_id(choose)) {
-                    // WidgetPtr widget = WidgetPtr (widgets_.at(i));
-                    // selection_ = WidgetPtr (widget);
-                }
-            }
-            return true;
-        }
-        return true;
-    }
-    */
-
     focus_ = 0;
     if (not has_focus(x,y))
         return false;
+    if (action == "select")
+        return select (x,y);
     x -= get_position().x;
     y -= get_position().y;
     if (action == "move-resize") {
@@ -598,6 +1161,7 @@ Scene::mouse_action (int x, int y)
         add_quats (d_quat, view_.data, view_.data);
         start_.x = x;
         start_.y = y;
+        set_dirty ();
         return true;
     } else if (action_ == "zoom") {
         zoom_ = zoom_ * (1.0 - (y - start_.y) / h);
@@ -608,6 +1172,7 @@ Scene::mouse_action (int x, int y)
         }
         start_.x = x;
         start_.y = y;
+        set_dirty ();
     }
     return false;
 }
@@ -617,6 +1182,7 @@ Scene::mouse_action (int x, int y)
 void
 Scene::set_ortho_mode (bool mode)
 {
+    set_dirty ();
     ortho_mode_ = mode;
 }
 
@@ -633,6 +1199,7 @@ Scene::get_ortho_mode (void)
 void
 Scene::set_zoom (float zoom)
 {
+    set_dirty ();
     zoom_ = zoom;
     if (zoom_ > zoom_max_)
         zoom_ = zoom_max_;
@@ -652,6 +1219,7 @@ Scene::get_zoom (void)
 void
 Scene::set_orientation (Orientation orientation)
 {
+    set_dirty ();
     orientation_ = Orientation (orientation);
     view_ = Vec4f (0,0,0,1);
 
@@ -720,3 +1288,22 @@ Scene::has_focus (int x, int y)
     focus |= Widget::has_focus(x,y);
     return focus;
 }
+
+
+// ___________________________________________________________________ set_clock
+void
+Scene::set_clock (FrameClockPtr clock)
+{
+    if (not clock)
+        clock = FrameClock::Default();
+    clock_ = clock;
+    set_dirty ();
+}
+
+
+// ___________________________________________________________________ get_clock
+FrameClockPtr
+Scene::get_clock (void) const
+{
+    return clock_;
+}
@@ -20,11 +20,23 @@
 #include <cstdio>
 #include "object.h"
 #include "widget.h"
+#include "picker.h"
+#include "frame-clock.h"
+#include "render-state.h"
+#include "overlay.h"
+#include "render-queue.h"
+#include "layer-cache.h"
 
 #ifdef HAVE_BOOST
+#   include <boost/unordered_map.hpp>
     typedef boost::shared_ptr<class Scene> ScenePtr;
+    typedef boost::unordered_multimap<std::string,unsigned int>  ObjectNameIndex;
+    typedef boost::unordered_multimap<unsigned int,unsigned int>  ObjectIdIndex;
 #else
+#   include <map>
     typedef class Scene * ScenePtr;
+    typedef std::multimap<std::string,unsigned int>  ObjectNameIndex;
+    typedef std::multimap<unsigned int,unsigned int>  ObjectIdIndex;
 #endif
 
 
@@ -41,7 +53,7 @@
  * \image html scene.png
  * \image latex scene.png
  */
-class Scene : public Widget {
+class Scene : public Widget, public Object::Registry {
 public:
 
     //__________________________________________________________________________
@@ -78,6 +90,15 @@ public:
      */
     virtual void update (void);
 
+    /**
+     * Prepare rendering data.
+     *
+     * This method recursively call objects and widgets prepare method.
+     *
+     * @param pool worker pool
+     */
+    virtual void prepare (WorkerPool &pool);
+
     /**
      * Render the scene.
      *
@@ -97,6 +118,30 @@ public:
      */
     virtual void render_with_view_orientation (void);
 
+    /**
+     * Whether scene or any of its objects and widgets needs to be redrawn
+     */
+    virtual bool needs_redraw (void) const;
+
+    /**
+     * Set whether scene needs to be redrawn
+     *
+     * Clearing the flag also clears it for all objects and widgets.
+     *
+     * @param dirty whether scene needs to be redrawn
+     */
+    virtual void set_dirty (bool dirty = true);
+
+    /**
+     * Set time of the frame being rendered (see Object::set_time)
+     *
+     * The time is passed down to all objects and widgets, nested scenes
+     * thus animating from the time of their parent.
+     *
+     * @param time frame time (ms)
+     */
+    virtual void set_time (double time);
+
     /**
      * Save the scene as a ppm image into a file
      *
@@ -113,6 +158,11 @@ public:
     /**
      * Add a new object to the scene.
      *
+     * The object is registered under its name and id, and the scene is
+     * attached to it such that later renames and id changes are reflected
+     * in the indices. If several objects share a name, which one is found
+     * by name is unspecified: use set_object to keep names unique.
+     *
      * @param object object to be added.
      */
     virtual void add (ObjectPtr object);
@@ -125,29 +175,82 @@ public:
     virtual void add (WidgetPtr widget);
 
     /**
+     * Get an object by its name.
+     *
+     * @param name name the object was registered with
+     * @return object or an empty ObjectPtr if there is no such object
+     */
+    virtual ObjectPtr get_object (const std::string name) const;
+
+    /**
+     * Get an object by its name.
+     *
+     * @param name name the object was registered with
+     * @return object or an empty ObjectPtr if there is no such object
+     */
+    virtual ObjectPtr operator[] (const std::string name) const;
+
+    /**
+     * Get an object by its id.
      *
+     * @param id any id the object answers to (see Object::check_id)
+     * @return object or an empty ObjectPtr if there is no such object
      */
-    virtual ObjectPtr get_object( const std::string name ) const;
+    virtual ObjectPtr get_object (unsigned int id);
 
     /**
+     * Set the object known under a given name.
      *
+     * If an object is already registered under this name, it is replaced and
+     * the new object takes its place in the rendering order. Otherwise the
+     * object is added. In both cases, the object is renamed to name. An
+     * object already in the scene is renamed in place, never added twice.
+     *
+     * @param name   name to register the object with
+     * @param object object to be set
      */
-    virtual ObjectPtr operator[]( const std::string name ) const ;
+    virtual void      set_object (const std::string name, const ObjectPtr object);
 
     /**
+     * Whether an object is registered under a given name.
      *
+     * @param name name to look for
      */
-    virtual void      set_object( const std::string name, const ObjectPtr object );
+    virtual bool      has_object (const std::string name) const;
 
     /**
+     * Remove the object registered under a given name.
+     *
+     * Removal does not shift the object list: the last object is moved into
+     * the freed slot, hence it is rendered earlier from now on.
      *
+     * @param name name of the object to be removed
      */
-    virtual bool      has_object( const std::string name );
+    virtual void      del_object (const std::string name);
 
     /**
+     * Remove an object.
      *
+     * @param object object to be removed
+     * @return true if object removed
      */
-    virtual void      del_object( const std::string name );
+    virtual bool      remove (ObjectPtr object);
+
+    /**
+     * Update name index when a scene object has been renamed
+     *
+     * @param object   renamed object
+     * @param previous previous name of object
+     */
+    virtual void      renamed (Object *object, const std::string &previous);
+
+    /**
+     * Update id index when a scene object id has changed
+     *
+     * @param object   object
+     * @param previous previous id of object
+     */
+    virtual void      reidentified (Object *object, unsigned int previous);
 
     //    virtual Object *get (std::string name);
     //    virtual Object *operator() (std::string name);
@@ -161,11 +264,65 @@ public:
     /**
      * Select callback.
      *
+     * Pick the object under pointer and make it the current selection. The
+     * selected object is then given the pointer ray (see Object::select) so
+     * that it can refine the selection on its own (see Cloud::select), the
+     * refined point index replacing the picked one when available.
+     *
      * @param x x pointer coordinates (window space)
      * @param y y pointer coordinates (window space)
+     * @return whether an object has been selected
      */
     virtual bool select (int x, int y);
 
+    /**
+     * Get current selection.
+     *
+     * @param index if not null, receives the index of the selected primitive
+     *              within the object (point index for a cloud of points)
+     * @return selected object or an empty ObjectPtr
+     */
+    virtual ObjectPtr get_selection (unsigned int *index = 0);
+
+    /**
+     * Get ray going through a pointer position.
+     *
+     * The ray is unprojected through the projection and modelview matrices
+     * set by view_start, objects being rendered without any additional
+     * transformation.
+     *
+     * @param x         x pointer coordinates (window space)
+     * @param y         y pointer coordinates (window space)
+     * @param origin    receives ray origin (object space)
+     * @param direction receives ray direction (object space)
+     */
+    virtual void get_ray (int x, int y, Position &origin, Direction &direction);
+
+    /**
+     * Start picking the object under pointer.
+     *
+     * Objects are rendered into an offscreen identifier buffer restricted to
+     * the pointer pixel and the result is read back asynchronously. It can be
+     * fetched with get_pick, ideally one frame later to avoid any stall.
+     *
+     * @param x x pointer coordinates (window space)
+     * @param y y pointer coordinates (window space)
+     */
+    virtual void pick (int x, int y);
+
+    /**
+     * Get result of last pick.
+     *
+     * @param index if not null, receives the index of the picked primitive
+     *              within the object (point index for a cloud of points)
+     * The picked object is resolved from its id, so that an object removed
+     * from the scene or given new data (hence a new id) since the pick is
+     * not returned.
+     *
+     * @return picked object or an empty ObjectPtr
+     */
+    virtual ObjectPtr get_pick (unsigned int *index = 0);
+
     /**
      * Keyboard action
      *
@@ -294,6 +451,80 @@ public:
     //@}
 
 
+    //__________________________________________________________________________
+    /**
+     * @name Frame clock
+     */
+    /**
+     * Set clock animations are driven from.
+     *
+     * The clock is sampled once at the start of each frame by the outermost
+     * scene being rendered, nested scenes use the time of their parent.
+     * Scenes sharing a clock (the default one unless told otherwise) all see
+     * it advance once per displayed frame (see FrameClock::tick).
+     *
+     * @param clock frame clock
+     */
+    virtual void set_clock (FrameClockPtr clock);
+
+    /**
+     * Get clock animations are driven from.
+     *
+     * @return frame clock
+     */
+    virtual FrameClockPtr get_clock (void) const;
+    //@}
+
+
+    //__________________________________________________________________________
+    /**
+     * @name Layer cache
+     */
+    /**
+     * Set whether static objects are cached.
+     *
+     * When enabled, objects flagged as static (see Object::set_static) are
+     * rendered into an offscreen layer (see LayerCache) which is drawn under
+     * the other objects each frame. The layer is only rendered again when the
+     * view (orientation, zoom, projection or size) changes, when the scene is
+     * dirty or when a static object needs to be redrawn. Only the other
+     * objects are then rendered every frame.
+     *
+     * If offscreen rendering is not available, objects are rendered directly.
+     *
+     * @param cache whether to cache static objects
+     */
+    virtual void set_layer_cache (bool cache);
+
+    /**
+     * Get whether static objects are cached.
+     */
+    virtual bool get_layer_cache (void) const;
+
+    /**
+     * Set whether scene is cached as a panel.
+     *
+     * This only applies to a scene rendered within another scene (as a
+     * widget). The whole scene is then rendered into an offscreen texture
+     * (see LayerCache) which is drawn in its area by the parent. It is only
+     * rendered again when the scene needs to be redrawn (see needs_redraw) or
+     * when its view (orientation, zoom, projection or size) changes, such
+     * that unchanged panels of a dashboard cost a single textured quad.
+     *
+     * If offscreen rendering is not available, the scene is rendered
+     * directly.
+     *
+     * @param cache whether to cache scene as a panel
+     */
+    virtual void set_panel_cache (bool cache);
+
+    /**
+     * Get whether scene is cached as a panel.
+     */
+    virtual bool get_panel_cache (void) const;
+    //@}
+
+
     //__________________________________________________________________________
 
 protected:
@@ -308,6 +539,128 @@ protected:
      */
     std::vector<ObjectPtr> objects_;
 
+    /**
+     * Start a frame.
+     *
+     * If this is the outermost scene being rendered, sample the frame clock,
+     * pass its time down to all objects (see set_time) then prepare rendering
+     * data of all objects in parallel.
+     */
+    virtual void frame_start (void);
+
+    /**
+     * Finish a frame.
+     *
+     * Clear dirty flags once scene has been rendered.
+     */
+    virtual void frame_finish (void);
+
+    /**
+     * Set viewport, scissor and matrices of the scene area.
+     */
+    virtual void view_start (void);
+
+    /**
+     * Load projection matrix of the scene into current matrix.
+     */
+    virtual void view_projection (void);
+
+    /**
+     * Load modelview matrix of the scene into current matrix.
+     */
+    virtual void view_modelview (void);
+
+    /**
+     * Restore viewport, scissor and matrices set by view_start.
+     */
+    virtual void view_finish (void);
+
+    /**
+     * Draw the panel cache, rendering the scene into it first if needed.
+     *
+     * @param oriented whether scene is rendered with view orientation (see
+     *                 render_with_view_orientation)
+     * @return false if scene is not cached as a panel (not nested, picking,
+     *         disabled or not available), it must then be rendered directly
+     */
+    virtual bool render_panel (bool oriented = false);
+
+    /**
+     * Draw the static layer, rendering it again first if needed.
+     *
+     * @param oriented whether to pass view orientation to objects
+     * @return false if layer cache is disabled or not available, static
+     *         objects must then be rendered with the others
+     */
+    virtual bool render_static_layer (bool oriented);
+
+    /**
+     * Get key of cached layers: view orientation, zoom, projection and size
+     * of the scene area as set by view_start (see LayerCache::set_key)
+     */
+    virtual std::vector<float> get_layer_key (void) const;
+
+    /**
+     * Whether static layer content changed since it was cached
+     */
+    virtual bool get_static_changed (void) const;
+
+    /**
+     * Render static objects (into the layer cache)
+     *
+     * @param oriented whether to pass view orientation to objects
+     */
+    virtual void render_static_objects (bool oriented);
+
+    /**
+     * Get slot of the object currently named name.
+     *
+     * @return slot or -1 if there is no such object
+     */
+    virtual int find_object (const std::string &name) const;
+
+    /**
+     * Get slot of object.
+     *
+     * @return slot or -1 if object is not in the scene
+     */
+    virtual int find_slot (const ObjectPtr object) const;
+
+    /**
+     * Get picking key of object, i.e. its id folded on the 24 bits the
+     * picker can encode (0 being reserved for background).
+     */
+    virtual unsigned int pick_key (const ObjectPtr object) const;
+
+    /**
+     * Register object at slot i into the name and id indices.
+     */
+    virtual void index_object (unsigned int i);
+
+    /**
+     * Remove object at slot i from the name and id indices.
+     */
+    virtual void unindex_object (unsigned int i);
+
+    /**
+     * Remove object at slot i by moving the last object into it.
+     */
+    virtual void remove_object (unsigned int i);
+
+    /**
+     * Slot in objects_ of every object, indexed by name.
+     *
+     * Invariant: there is exactly one entry (name, i) per slot i, name being
+     * the current name of objects_[i]. Renames are reported by objects.
+     */
+    ObjectNameIndex names_;
+
+    /**
+     * Slot in objects_ of every object, indexed by id (same invariant as
+     * names_, id changes being reported by objects).
+     */
+    ObjectIdIndex ids_;
+
     /**
      * List of lights to use
      */
@@ -352,6 +705,71 @@ protected:
      */
     Orientation orientation_;
 
+    /**
+     * Identifier buffer used for picking
+     */
+    PickerPtr picker_;
+
+    /**
+     * Compositor for front widgets
+     */
+    OverlayPtr overlay_;
+
+    /**
+     * Queue merging draws of objects
+     */
+    RenderQueuePtr queue_;
+
+    /**
+     * Whether current rendering is an identifier pass
+     */
+    bool picking_;
+
+    /**
+     * Whether static objects are cached
+     */
+    bool layer_cache_;
+
+    /**
+     * Static objects cache (created on first use)
+     */
+    LayerCachePtr layer_;
+
+    /**
+     * Whether scene is cached as a panel
+     */
+    bool panel_cache_;
+
+    /**
+     * Whether scene is being rendered into its panel cache
+     */
+    bool panel_rendering_;
+
+    /**
+     * Panel cache (created on first use)
+     */
+    LayerCachePtr panel_;
+
+    /**
+     * Clock animations are driven from
+     */
+    FrameClockPtr clock_;
+
+    /**
+     * Number of scenes currently being rendered
+     */
+    static unsigned int frame_depth_;
+
+    /**
+     * Selected object
+     */
+    ObjectPtr selection_;
+
+    /**
+     * Index of selected primitive within selected object
+     */
+    unsigned int selection_index_;
+
     /**
      * Pointer position at event start.
      */
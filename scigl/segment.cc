@@ -14,7 +14,9 @@
  * this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 #include "segment.h"
+#include "render-queue.h"
 #include "shapes.h"
+#include "picker.h"
 #include <iostream>
 
 
@@ -40,6 +42,43 @@ Segment::~Segment (void)
 {}
 
 
+// _____________________________________________________________________ prepare
+void
+Segment::prepare (WorkerPool &pool)
+{
+    if ((not xdata_) or (not ydata_) or (not zdata_)) {
+        return;
+    }
+    compute_visibility();
+    if (!get_visible()) {
+        return;
+    }
+    kernel_.prepare (kernel_source(), pool);
+}
+
+
+// ______________________________________________________________________ submit
+bool
+Segment::submit (RenderQueue &queue)
+{
+    // Thick segments are drawn by render
+    if ((thickness_ > 0) and (thickness_ <= 1.0))
+        return false;
+    if ((not xdata_) or (not ydata_) or (not zdata_))
+        return true;
+    compute_visibility();
+    if (not get_visible())
+        return true;
+    if (not kernel_.consume())
+        kernel_.prepare (kernel_source());
+    if (thickness_ == 0)
+        queue.submit (kernel_, RenderKernel::LINES, 1.0);
+    else
+        queue.submit (kernel_, RenderKernel::LINES, thickness_);
+    return true;
+}
+
+
 // ______________________________________________________________________ render
 void
 Segment::render (void)
@@ -51,307 +90,80 @@ Segment::render (void)
     if (!get_visible()) {
         return;
     }
-    unsigned int width        = xdata_->get_width();
-    unsigned int xdata_stride = xdata_->get_stride();
-    unsigned int ydata_stride = ydata_->get_stride();
-    unsigned int zdata_stride = zdata_->get_stride();
-    Color c;
-    double x, y, z, v, r, g, b, a;
-    double x1, y1, z1, s1;
-    double x2, y2, z2, s2;
-    r = fg_color_.r;
-    g = fg_color_.g;
-    b = fg_color_.b;
-    a = fg_color_.a;
+    if (not kernel_.consume())
+        kernel_.prepare (kernel_source());
 
     // -------------------------------------------------------------------------
     //  Rendering using GL_LINES
     // -------------------------------------------------------------------------
     if ((thickness_ == 0) or (thickness_ > 1.0)) {
-        glEnable (GL_BLEND);
-        glEnable (GL_LINE_SMOOTH);
+        if (not Picker::get_active()) {
+            glEnable (GL_BLEND);
+            glEnable (GL_LINE_SMOOTH);
+        }
         if (thickness_ == 0)
             glLineWidth (1.0);
         else
             glLineWidth (thickness_);
-
-        // XYZ
-        // ---------------------------------------------------------------------
-        if (not cdata_) {
-            GLbyte *xdata = (GLbyte *) xdata_->get_data();
-            GLbyte *ydata = (GLbyte *) ydata_->get_data();
-            GLbyte *zdata = (GLbyte *) zdata_->get_data();
-            glBegin(GL_LINES);
-            for (unsigned int i=0; i<width; i++) {
-                x = * (GLdouble *)(xdata+i*xdata_stride);
-                y = * (GLdouble *)(ydata+i*ydata_stride);
-                z = * (GLdouble *)(zdata+i*zdata_stride);
-                glVertex3f (x,y,z);
-            }
-            glEnd();
-        }
-        else {
-            GLbyte *xdata = (GLbyte *) xdata_->get_data();
-            GLbyte *ydata = (GLbyte *) ydata_->get_data();
-            GLbyte *zdata = (GLbyte *) zdata_->get_data();
-            GLbyte *cdata = (GLbyte *) cdata_->get_data();
-            unsigned int cdata_stride = cdata_->get_stride();
-            
-            // XYZ + C
-            // -----------------------------------------------------------------
-            if (cdata_->get_depth() == 1) {
-                glBegin(GL_LINES);
-                for (unsigned int i=0; i<width; i++) {
-                    x = * (GLdouble *)(xdata+i*xdata_stride);
-                    y = * (GLdouble *)(ydata+i*ydata_stride);
-                    z = * (GLdouble *)(zdata+i*zdata_stride);
-                    v = * (GLdouble *)(cdata+i*cdata_stride + 0*sizeof(GLdouble));
-                    Color c = (*cmap_)(v);
-                    r = c.r;
-                    g = c.g;
-                    b = c.b;
-                    a = c.a;
-                    glColor4f(r,g,b,a*alpha_);
-		    glVertex3f (x,y,z);
-                }
-                glEnd();
-            }
-            // XYZ + RGB
-            // -----------------------------------------------------------------
-            else if (cdata_->get_depth() == 3) {
-                glBegin(GL_LINES);
-                for (unsigned int i=0; i<width; i++) {
-                    x = * (GLdouble *)(xdata+i*xdata_stride);
-                    y = * (GLdouble *)(ydata+i*ydata_stride);
-                    z = * (GLdouble *)(zdata+i*zdata_stride);
-                    r = * (GLdouble *)(cdata+i*cdata_stride + 0*sizeof(GLdouble));
-                    g = * (GLdouble *)(cdata+i*cdata_stride + 1*sizeof(GLdouble));
-                    b = * (GLdouble *)(cdata+i*cdata_stride + 2*sizeof(GLdouble));
-                    glColor4f(r,g,b,alpha_);
-                    glVertex3f (x,y,z);
-                }
-                glEnd();
-            }
-            // XYZ + RGBA
-            // -----------------------------------------------------------------
-            else if (cdata_->get_depth() == 4) {
-                glBegin(GL_LINES);
-                for (unsigned int i=0; i<width; i++) {
-                    x = * (GLdouble *)(xdata+i*xdata_stride);
-                    y = * (GLdouble *)(ydata+i*ydata_stride);
-                    z = * (GLdouble *)(zdata+i*zdata_stride);
-                    r = * (GLdouble *)(cdata+i*cdata_stride + 0*sizeof(GLdouble));
-                    g = * (GLdouble *)(cdata+i*cdata_stride + 1*sizeof(GLdouble));
-                    b = * (GLdouble *)(cdata+i*cdata_stride + 2*sizeof(GLdouble));
-                    a = * (GLdouble *)(cdata+i*cdata_stride + 3*sizeof(GLdouble));
-                    glColor4f(r,g,b,a*alpha_);
-                    glVertex3f (x,y,z);
-                }
-		glEnd();
-            }
-        }
+        kernel_.draw (RenderKernel::LINES, false);
     }
 
-
     // -------------------------------------------------------------------------
     //  Rendering using cylinder
     // -------------------------------------------------------------------------
     else {
+        kernel_.draw (RenderKernel::LINES, true);
+    }
+}
 
-        // XYZ
-        // ---------------------------------------------------------------------
-        if ((not cdata_) and (not sdata_)) {
-            GLbyte *xdata = (GLbyte *) xdata_->get_data();
-            GLbyte *ydata = (GLbyte *) ydata_->get_data();
-            GLbyte *zdata = (GLbyte *) zdata_->get_data();
-            for (unsigned int i=0; i<(width-1); i +=2 ) {
-	      x1 = * (GLdouble *)(xdata+(2*i)*xdata_stride);
-                y1 = * (GLdouble *)(ydata+(2*i)*ydata_stride);
-                z1 = * (GLdouble *)(zdata+(2*i)*zdata_stride);
-                x2 = * (GLdouble *)(xdata+(2*i+1)*xdata_stride);
-                y2 = * (GLdouble *)(ydata+(2*i+1)*ydata_stride);
-                z2 = * (GLdouble *)(zdata+(2*i+1)*zdata_stride);
-                cylinder (x1,y1,z1, thickness_, x2,y2,z2, thickness_);
-            }
-        }
-        // XYZ + S
-        // ---------------------------------------------------------------------
-        else if ((not cdata_) and (sdata_)) {
-            GLbyte *xdata = (GLbyte *) xdata_->get_data();
-            GLbyte *ydata = (GLbyte *) ydata_->get_data();
-            GLbyte *zdata = (GLbyte *) zdata_->get_data();
-            GLbyte *sdata = (GLbyte *) sdata_->get_data();
-            unsigned int sdata_stride = sdata_->get_stride();
-            for (unsigned int i=0; i<(width-1); i += 2) {
-                x1 = * (GLdouble *)(xdata+(2*i)*xdata_stride);
-                y1 = * (GLdouble *)(ydata+(2*i)*ydata_stride);
-                z1 = * (GLdouble *)(zdata+(2*i)*zdata_stride);
-                s1 = * (GLdouble *)(sdata+(2*i)*sdata_stride);
-                x2 = * (GLdouble *)(xdata+(2*i+1)*xdata_stride);
-                y2 = * (GLdouble *)(ydata+(2*i+1)*ydata_stride);
-                z2 = * (GLdouble *)(zdata+(2*i+1)*zdata_stride);
-                s2 = * (GLdouble *)(sdata+(2*i+1)*sdata_stride);
-                cylinder (x1,y1,z1, thickness_ * s1, x2,y2,z2, thickness_ * s2);
-            }
-        }
-        else if ((cdata_) and (not sdata_)) {
-            GLbyte *xdata = (GLbyte *) xdata_->get_data();
-            GLbyte *ydata = (GLbyte *) ydata_->get_data();
-            GLbyte *zdata = (GLbyte *) zdata_->get_data();
-            GLbyte *cdata = (GLbyte *) cdata_->get_data();
-            unsigned int cdata_stride = cdata_->get_stride();
-            
-            // XYZ + C
-            // -----------------------------------------------------------------
-            if (cdata_->get_depth() == 1) {
-                for (unsigned int i=0; i<(width-1); i += 2) {
-                    x1 = * (GLdouble *)(xdata+(2*i)*xdata_stride);
-                    y1 = * (GLdouble *)(ydata+(2*i)*ydata_stride);
-                    z1 = * (GLdouble *)(zdata+(2*i)*zdata_stride);
-                    x2 = * (GLdouble *)(xdata+(2*i+1)*xdata_stride);
-                    y2 = * (GLdouble *)(ydata+(2*i+1)*ydata_stride);
-                    z2 = * (GLdouble *)(zdata+(2*i+1)*zdata_stride);
-                    v = * (GLdouble *)(cdata+(2*i)*cdata_stride + 0*sizeof(GLdouble));
-                    Color c = (*cmap_)(v);
-                    r = c.r;
-                    g = c.g;
-                    b = c.b;
-                    a = c.a;
-                    glColor4f(r,g,b,a*alpha_);
-                    cylinder (x1,y1,z1, thickness_, x2,y2,z2, thickness_);
-                }
-            }
-            // XYZ + RGB
-            // -----------------------------------------------------------------
-            else if (cdata_->get_depth() == 3) {
-                for (unsigned int i=0; i<(width-1); i += 2) {
-                    x1 = * (GLdouble *)(xdata+(2*i)*xdata_stride);
-                    y1 = * (GLdouble *)(ydata+(2*i)*ydata_stride);
-                    z1 = * (GLdouble *)(zdata+(2*i)*zdata_stride);
-                    x2 = * (GLdouble *)(xdata+(2*i+1)*xdata_stride);
-                    y2 = * (GLdouble *)(ydata+(2*i+1)*ydata_stride);
-                    z2 = * (GLdouble *)(zdata+(2*i+1)*zdata_stride);
-                    r = * (GLdouble *)(cdata+(2*i)*cdata_stride + 0*sizeof(GLdouble));
-                    g = * (GLdouble *)(cdata+(2*i)*cdata_stride + 1*sizeof(GLdouble));
-                    b = * (GLdouble *)(cdata+(2*i)*cdata_stride + 2*sizeof(GLdouble));
-                    glColor4f(r,g,b,a*alpha_);
-                    cylinder (x1,y1,z1, thickness_, x2,y2,z2, thickness_);
-                }
-            }
-            // XYZ + RGBA
-            // -----------------------------------------------------------------
-            else if (cdata_->get_depth() == 4) {
-                for (unsigned int i=0; i<(width-1); i += 2) {
-                    x1 = * (GLdouble *)(xdata+i*xdata_stride);
-                    y1 = * (GLdouble *)(ydata+i*ydata_stride);
-                    z1 = * (GLdouble *)(zdata+i*zdata_stride);
-                    x2 = * (GLdouble *)(xdata+(i+1)*xdata_stride);
-                    y2 = * (GLdouble *)(ydata+(i+1)*ydata_stride);
-                    z2 = * (GLdouble *)(zdata+(i+1)*zdata_stride);
-                    r = * (GLdouble *)(cdata+i*cdata_stride + 0*sizeof(GLdouble));
-                    g = * (GLdouble *)(cdata+i*cdata_stride + 1*sizeof(GLdouble));
-                    b = * (GLdouble *)(cdata+i*cdata_stride + 2*sizeof(GLdouble));
-                    a = * (GLdouble *)(cdata+i*cdata_stride + 3*sizeof(GLdouble));
-                    glColor4f(r,g,b,a*alpha_);
-                    cylinder (x1,y1,z1, thickness_, x2,y2,z2, thickness_);
-                }
-            }
-        }
 
-        else if ((cdata_) and (sdata_)) {
-            GLbyte *xdata = (GLbyte *) xdata_->get_data();
-            GLbyte *ydata = (GLbyte *) ydata_->get_data();
-            GLbyte *zdata = (GLbyte *) zdata_->get_data();
-            GLbyte *cdata = (GLbyte *) cdata_->get_data();
-            GLbyte *sdata = (GLbyte *) sdata_->get_data();
-            unsigned int cdata_stride = cdata_->get_stride();
-            unsigned int sdata_stride = sdata_->get_stride();
-            
-            // XYZ + S + C
-            // -----------------------------------------------------------------
-            if (cdata_->get_depth() == 1) {
-                for (unsigned int i=0; i<(width-1); i += 2) {
-                    x1 = * (GLdouble *)(xdata+(2*i)*xdata_stride);
-                    y1 = * (GLdouble *)(ydata+(2*i)*ydata_stride);
-                    z1 = * (GLdouble *)(zdata+(2*i)*zdata_stride);
-                    s1 = * (GLdouble *)(sdata+(2*i)*sdata_stride);
-                    x2 = * (GLdouble *)(xdata+(2*i+1)*xdata_stride);
-                    y2 = * (GLdouble *)(ydata+(2*i+1)*ydata_stride);
-                    z2 = * (GLdouble *)(zdata+(2*i+1)*zdata_stride);
-                    s2 = * (GLdouble *)(sdata+(2*i+1)*sdata_stride);            
-                    v = * (GLdouble *)(cdata+(2*i)*cdata_stride + 0*sizeof(GLdouble));
-                    Color c = (*cmap_)(v);
-                    r = c.r;
-                    g = c.g;
-                    b = c.b;
-                    a = c.a;
-                    glColor4f(r,g,b,a*alpha_);
-                    cylinder (x1,y1,z1, thickness_*s1, x2,y2,z2, thickness_*s2);
-                }
-            }
-            // XYZ + S + RGB
-            // -----------------------------------------------------------------
-            else if (cdata_->get_depth() == 3) {
-                for (unsigned int i=0; i<(width-1); i += 2) {
-                    x1 = * (GLdouble *)(xdata+(2*i)*xdata_stride);
-                    y1 = * (GLdouble *)(ydata+(2*i)*ydata_stride);
-                    z1 = * (GLdouble *)(zdata+(2*i)*zdata_stride);
-                    s1 = * (GLdouble *)(sdata+(2*i)*sdata_stride);
-                    x2 = * (GLdouble *)(xdata+(2*i+1)*xdata_stride);
-                    y2 = * (GLdouble *)(ydata+(2*i+1)*ydata_stride);
-                    z2 = * (GLdouble *)(zdata+(2*i+1)*zdata_stride);
-                    s2 = * (GLdouble *)(sdata+(2*i+1)*sdata_stride);
-                    r = * (GLdouble *)(cdata+(2*i)*cdata_stride + 0*sizeof(GLdouble));
-                    g = * (GLdouble *)(cdata+(2*i)*cdata_stride + 1*sizeof(GLdouble));
-                    b = * (GLdouble *)(cdata+(2*i)*cdata_stride + 2*sizeof(GLdouble));
-                    glColor4f(r,g,b,a*alpha_);
-                    cylinder (x1,y1,z1, thickness_*s1, x2,y2,z2, thickness_*s2);
-                }
-            }
-            // XYZ + S + RGBA
-            // -----------------------------------------------------------------
-            else if (cdata_->get_depth() == 4) {
-                for (unsigned int i=0; i<(width-1); i += 2) {
-                    x1 = * (GLdouble *)(xdata+(2*i)*xdata_stride);
-                    y1 = * (GLdouble *)(ydata+(2*i)*ydata_stride);
-                    z1 = * (GLdouble *)(zdata+(2*i)*zdata_stride);
-                    s1 = * (GLdouble *)(sdata+(2*i)*sdata_stride);
-                    x2 = * (GLdouble *)(xdata+(2*i+1)*xdata_stride);
-                    y2 = * (GLdouble *)(ydata+(2*i+1)*ydata_stride);
-                    z2 = * (GLdouble *)(zdata+(2*i+1)*zdata_stride);
-                    s2 = * (GLdouble *)(sdata+(2*i+1)*sdata_stride);
-                    r = * (GLdouble *)(cdata+(2*i)*cdata_stride + 0*sizeof(GLdouble));
-                    g = * (GLdouble *)(cdata+(2*i)*cdata_stride + 1*sizeof(GLdouble));
-                    b = * (GLdouble *)(cdata+(2*i)*cdata_stride + 2*sizeof(GLdouble));
-                    a = * (GLdouble *)(cdata+(2*i)*cdata_stride + 3*sizeof(GLdouble));
-                    glColor4f(r,g,b,a*alpha_);
-                    cylinder (x1,y1,z1, thickness_*s1, x2,y2,z2, thickness_*s2);
-                }
-            }
-        }
-    }
+
+// ________________________________________________________________ needs_redraw
+bool
+Segment::needs_redraw (void) const
+{
+    return Object::needs_redraw() or
+           (get_visible() and kernel_.get_outdated (kernel_source()));
 }
 
 
+// _______________________________________________________________ kernel_source
+RenderKernel::Source
+Segment::kernel_source (void) const
+{
+    RenderKernel::Source source;
+    source.xdata = xdata_;
+    source.ydata = ydata_;
+    source.zdata = zdata_;
+    source.sdata = sdata_;
+    source.cdata = cdata_;
+    source.cmap = cmap_;
+    source.color = fg_color_;
+    source.alpha = alpha_;
+    source.thickness = thickness_;
+    return source;
+}
+
 
 // ________________________________________________________________ set_xyz_data
 void
 Segment::set_xyz_data (DataPtr xdata, DataPtr ydata, DataPtr zdata)
 {
+    set_dirty ();
     if ((not xdata) or (not ydata) or (not zdata)) {
         throw std::invalid_argument
             ("segment: X,Y,Z data must be valid data");
     }
-    if ((not (xdata->get_type() == xdata->get_type())) or
+    if ((not (xdata->get_type() == ydata->get_type())) or
         (not (xdata->get_type() == zdata->get_type()))) {
         throw std::invalid_argument
             ("segment: X,Y,Z data must be of same type");
     }
-    if ((not (xdata->get_type() == GL_DOUBLE))) {
+    if (not RenderKernel::supports (xdata->get_type())) {
         throw std::invalid_argument
-            ("segment: X,Y,Z data must be of type GL_DOUBLE");
+            ("segment: X,Y,Z data must be of type GL_FLOAT or GL_DOUBLE");
     }
-    if ((not (xdata->get_width() == xdata->get_width())) or
+    if ((not (xdata->get_width() == ydata->get_width())) or
         (not (xdata->get_width() == zdata->get_width()))) {
         throw std::invalid_argument
             ("segment: X,Y,Z data must be of same size");
@@ -374,8 +186,7 @@ Segment::set_xyz_data (DataPtr xdata, DataPtr ydata, DataPtr zdata)
     xdata_ = xdata;
     ydata_ = ydata;
     zdata_ = zdata;
-    id_ = id_counter_;
-    id_ += xdata->get_width();
+    set_id (id_counter_ + xdata->get_width());
 }
 
 
@@ -384,21 +195,22 @@ void
 Segment::set_xyz_s_data (DataPtr xdata, DataPtr ydata, DataPtr zdata,
                        DataPtr sdata)
 {
+    set_dirty ();
     if ((not xdata) or (not ydata) or (not zdata) or
         (not sdata) ) {
         throw std::invalid_argument
             ("segment: X,Y,Z,S data must be valid data");
     }
-    if ((not (xdata->get_type() == xdata->get_type())) or
+    if ((not (xdata->get_type() == ydata->get_type())) or
         (not (xdata->get_type() == zdata->get_type()))) {
         throw std::invalid_argument
             ("segment: X,Y,Z data must be of same type");
     }
-    if ((not (xdata->get_type() == GL_DOUBLE))) {
+    if (not RenderKernel::supports (xdata->get_type())) {
         throw std::invalid_argument
-            ("segment: X,Y,Z data must be of type GL_DOUBLE");
+            ("segment: X,Y,Z data must be of type GL_FLOAT or GL_DOUBLE");
     }
-    if ((not (xdata->get_width() == xdata->get_width())) or
+    if ((not (xdata->get_width() == ydata->get_width())) or
         (not (xdata->get_width() == zdata->get_width())) or
         (not (xdata->get_width() == sdata->get_width()))) {
         throw std::invalid_argument
@@ -419,17 +231,16 @@ Segment::set_xyz_s_data (DataPtr xdata, DataPtr ydata, DataPtr zdata,
         throw std::invalid_argument
             ("segment: X,Y,Z,S data must be linear (height=1)");
     }
-    if ((not (sdata->get_type() == GL_DOUBLE))) {
+    if ((not (sdata->get_type() == xdata->get_type()))) {
         throw std::invalid_argument
-            ("segment: S data must be of type GL_DOUBLE");
+            ("segment: S data must be of same type as X,Y,Z data");
     }
     reset_data();
     xdata_ = xdata;
     ydata_ = ydata;
     zdata_ = zdata;
     sdata_ = sdata;
-    id_ = id_counter_;
-    id_ += xdata->get_width();
+    set_id (id_counter_ + xdata->get_width());
 }
 
 
@@ -438,20 +249,21 @@ void
 Segment::set_xyz_c_data (DataPtr xdata, DataPtr ydata, DataPtr zdata,
                        DataPtr cdata)
 {
+    set_dirty ();
     if ((not xdata) or (not ydata) or (not zdata) or (not cdata)) {
         throw std::invalid_argument
             ("segment: X,Y,Z,C data must be valid data");
     }
-    if ((not (xdata->get_type() == xdata->get_type())) or
+    if ((not (xdata->get_type() == ydata->get_type())) or
         (not (xdata->get_type() == zdata->get_type()))) {
         throw std::invalid_argument
             ("segment: X,Y,Z data must be of same type");
     }
-    if ((not (xdata->get_type() == GL_DOUBLE))) {
+    if (not RenderKernel::supports (xdata->get_type())) {
         throw std::invalid_argument
-            ("segment: X,Y,Z data must be of type GL_DOUBLE");
+            ("segment: X,Y,Z data must be of type GL_FLOAT or GL_DOUBLE");
     }
-    if ((not (xdata->get_width() == xdata->get_width())) or
+    if ((not (xdata->get_width() == ydata->get_width())) or
         (not (xdata->get_width() == zdata->get_width())) or
         (not (xdata->get_width() == cdata->get_width()))) {
         throw std::invalid_argument
@@ -472,9 +284,9 @@ Segment::set_xyz_c_data (DataPtr xdata, DataPtr ydata, DataPtr zdata,
         throw std::invalid_argument
             ("segment: X,Y,Z,C data must be linear (height=1)");
     }
-    if ((not (cdata->get_type() == GL_DOUBLE))) {
+    if ((not (cdata->get_type() == xdata->get_type()))) {
         throw std::invalid_argument
-            ("segment: C data must be of type GL_DOUBLE");
+            ("segment: C data must be of same type as X,Y,Z data");
     }
     if ((not (cdata->get_depth() == 1)) and
         (not (cdata->get_depth() == 3)) and
@@ -487,8 +299,7 @@ Segment::set_xyz_c_data (DataPtr xdata, DataPtr ydata, DataPtr zdata,
     ydata_ = ydata;
     zdata_ = zdata;
     cdata_ = cdata;
-    id_ = id_counter_;
-    id_ += xdata->get_width();
+    set_id (id_counter_ + xdata->get_width());
 }
 
 // ____________________________________________________________ set_xyz_s_c_data
@@ -496,21 +307,22 @@ void
 Segment::set_xyz_s_c_data (DataPtr xdata, DataPtr ydata, DataPtr zdata,
                         DataPtr sdata, DataPtr cdata)
 {
+    set_dirty ();
     if ((not xdata) or (not ydata) or (not zdata) or
         (not cdata) or (not sdata)) {
         throw std::invalid_argument
             ("segment: X,Y,Z,S,C data must be valid data");
     }
-    if ((not (xdata->get_type() == xdata->get_type())) or
+    if ((not (xdata->get_type() == ydata->get_type())) or
         (not (xdata->get_type() == zdata->get_type()))) {
         throw std::invalid_argument
             ("segment: X,Y,Z data must be of same type");
     }
-    if ((not (xdata->get_type() == GL_DOUBLE))) {
+    if (not RenderKernel::supports (xdata->get_type())) {
         throw std::invalid_argument
-            ("segment: X,Y,Z data must be of type GL_DOUBLE");
+            ("segment: X,Y,Z data must be of type GL_FLOAT or GL_DOUBLE");
     }
-    if ((not (xdata->get_width() == xdata->get_width())) or
+    if ((not (xdata->get_width() == ydata->get_width())) or
         (not (xdata->get_width() == zdata->get_width())) or
         (not (xdata->get_width() == sdata->get_width())) or
         (not (xdata->get_width() == cdata->get_width()))) {
@@ -533,10 +345,10 @@ Segment::set_xyz_s_c_data (DataPtr xdata, DataPtr ydata, DataPtr zdata,
         throw std::invalid_argument
             ("segment: X,Y,Z,C data must be linear (height=1)");
     }
-    if ((not (sdata->get_type() == GL_DOUBLE)) or
-        (not (cdata->get_type() == GL_DOUBLE))) {
+    if ((not (sdata->get_type() == xdata->get_type())) or
+        (not (cdata->get_type() == xdata->get_type()))) {
         throw std::invalid_argument
-            ("segment: S,C data must be of type GL_DOUBLE");
+            ("segment: S,C data must be of same type as X,Y,Z data");
     }
     if ((not (cdata->get_depth() == 1)) and
         (not (cdata->get_depth() == 3)) and
@@ -550,8 +362,7 @@ Segment::set_xyz_s_c_data (DataPtr xdata, DataPtr ydata, DataPtr zdata,
     zdata_ = zdata;
     cdata_ = cdata;
     sdata_ = sdata;
-    id_ = id_counter_;
-    id_ += xdata->get_width();
+    set_id (id_counter_ + xdata->get_width());
 }
 
 // __________________________________________________________________ reset_data
@@ -586,6 +397,7 @@ Segment::get_thickness (void) const
 void
 Segment::set_thickness (float thickness)
 {
+    set_dirty ();
     thickness_ = thickness;
 }
 
@@ -602,5 +414,6 @@ Segment::get_colormap (void)
 void
 Segment::set_colormap (ColormapPtr colormap)
 {
+    set_dirty ();
     cmap_ = colormap;
 }
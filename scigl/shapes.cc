@@ -28,11 +28,11 @@ void sphere (GLfloat x, GLfloat y, GLfloat z, GLfloat r)
         glEndList();
     }
 
-    glPushMatrix();
-    glScalef (r,r,r);
-    glTranslatef(x/r,y/r,z/r);
+    RenderState::push_matrix();
+    RenderState::scale (r,r,r);
+    RenderState::translate(x/r,y/r,z/r);
     glCallList (list);
-    glPopMatrix();    
+    RenderState::pop_matrix();    
 }
 
 void cylinder(GLfloat x1, GLfloat y1, GLfloat z1, GLfloat r1,
@@ -55,11 +55,11 @@ void cylinder(GLfloat x1, GLfloat y1, GLfloat z1, GLfloat r1,
         ax = -ax;
     float rx = -vy*vz;
     float ry = vx*vz;
-    glPushMatrix();
-    glTranslatef(x1,y1,z1);
-    glRotatef (ax, rx, ry, 0);
+    RenderState::push_matrix();
+    RenderState::translate(x1,y1,z1);
+    RenderState::rotate (ax, rx, ry, 0);
     gluCylinder (quadric, r1, r2, v, 6, 1);
-    glPopMatrix ();    
+    RenderState::pop_matrix ();    
 }
 
 
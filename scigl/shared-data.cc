@@ -0,0 +1,206 @@
+/*
+ * Copyright (C) 2008 Nicolas P. Rougier
+ *
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <climits>
+#include <cstring>
+#include <stdexcept>
+#include "shared-data.h"
+#include "render-state.h"
+
+// Number of attempts to copy a record before giving up latching
+static const unsigned int latch_attempts = 4;
+
+
+// __________________________________________________________________ SharedData
+SharedData::SharedData (SharedRingPtr ring) : Data ()
+{
+    if (not ring) {
+        throw std::invalid_argument ("Shared data ring must be valid");
+    }
+    ring_ = ring;
+    record_.sequence = 0;
+    record_.time = 0;
+    record_.data = 0;
+    copy_ = 0;
+    width_ = height_ = 0;
+    tracked_ = true;
+    latch ();
+    frame_ = RenderState::get_frame();
+}
+
+
+// _________________________________________________________________ ~SharedData
+SharedData::~SharedData (void)
+{}
+
+
+// ____________________________________________________________________ get_ring
+SharedRingPtr
+SharedData::get_ring (void) const
+{
+    return ring_;
+}
+
+
+// _______________________________________________________________________ latch
+bool
+SharedData::latch (void)
+{
+    // Copy into the buffer not holding the current record, then make sure
+    // the producer did not overwrite the record while it was being copied.
+    unsigned int copy = 1 - copy_;
+    SharedRing::Record last;
+    bool copied = false;
+    for (unsigned int i=0; (not copied) and (i<latch_attempts); i++) {
+        unsigned long head = ring_->get_head();
+        if (head == record_.sequence)
+            return false;
+        if (not ring_->get (head, last))
+            continue;
+        size_t size = size_t (last.width)*last.height*last.depth*
+                      type_size (last.type);
+        if ((not copies_[copy]) or (copies_[copy]->get_size() < size))
+            copies_[copy] = BufferPtr (new Buffer (size));
+        memcpy (copies_[copy]->get_data(), last.data, size);
+        copied = ring_->validate (last);
+    }
+    if (not copied)
+        return false;
+    copy_ = copy;
+    record_ = last;
+    record_.data = copies_[copy_]->get_data();
+    buffer_ = copies_[copy_];
+    data_ = record_.data;
+    width_ = record_.width;
+    height_ = record_.height;
+    depth_ = record_.depth;
+    type_ = record_.type;
+    stride_ = 0;
+    record (0, UINT_MAX);
+    return true;
+}
+
+
+// _________________________________________________________________ latch_frame
+void
+SharedData::latch_frame (void)
+{
+    unsigned long frame = RenderState::get_frame();
+    if (frame == frame_)
+        return;
+    frame_ = frame;
+    latch ();
+}
+
+
+// ___________________________________________________________________ get_valid
+bool
+SharedData::get_valid (void) const
+{
+    if (record_.sequence == 0)
+        return true;
+    return ring_->validate (record_);
+}
+
+
+// ____________________________________________________________________ get_time
+double
+SharedData::get_time (void) const
+{
+    return record_.time;
+}
+
+
+// ________________________________________________________________ get_sequence
+unsigned long
+SharedData::get_sequence (void) const
+{
+    return record_.sequence;
+}
+
+
+// ____________________________________________________________________ set_data
+void
+SharedData::set_data (const void *data)
+{
+    throw std::invalid_argument ("Shared data storage cannot be changed");
+}
+
+
+// ___________________________________________________________________ set_width
+void
+SharedData::set_width (const unsigned int width)
+{
+    throw std::invalid_argument ("Shared data width cannot be changed");
+}
+
+
+// __________________________________________________________________ set_height
+void
+SharedData::set_height (const unsigned int height)
+{
+    throw std::invalid_argument ("Shared data height cannot be changed");
+}
+
+
+// ___________________________________________________________________ set_depth
+void
+SharedData::set_depth (const unsigned int depth)
+{
+    throw std::invalid_argument ("Shared data depth cannot be changed");
+}
+
+
+// ____________________________________________________________________ set_type
+void
+SharedData::set_type (const unsigned int type)
+{
+    throw std::invalid_argument ("Shared data type cannot be changed");
+}
+
+
+// __________________________________________________________________ set_stride
+void
+SharedData::set_stride (const unsigned int stride)
+{
+    throw std::invalid_argument ("Shared data stride cannot be changed");
+}
+
+
+// _________________________________________________________________ get_version
+unsigned long
+SharedData::get_version (void) const
+{
+    const_cast<SharedData *>(this)->latch_frame ();
+    return version_;
+}
+
+
+// _________________________________________________________________ get_pending
+bool
+SharedData::get_pending (void) const
+{
+    return ring_->get_head() != record_.sequence;
+}
+
+
+// ___________________________________________________________________ get_dirty
+bool
+SharedData::get_dirty (unsigned long version,
+                       unsigned int &offset, unsigned int &count) const
+{
+    const_cast<SharedData *>(this)->latch_frame ();
+    return Data::get_dirty (version, offset, count);
+}
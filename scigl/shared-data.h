@@ -0,0 +1,162 @@
+/*
+ * Copyright (C) 2008 Nicolas P. Rougier
+ *
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef __SHARED_DATA_H__
+#define __SHARED_DATA_H__
+#include "data.h"
+#include "shared-ring.h"
+
+#if defined(HAVE_BOOST)
+#   include <boost/shared_ptr.hpp>
+    typedef boost::shared_ptr<class SharedData> SharedDataPtr;
+#else
+    typedef class SharedData *                  SharedDataPtr;
+#endif
+
+
+/**
+ * Data following the last record of a shared ring.
+ *
+ * Like TripleData, the last published record is latched the first time data
+ * version is read within a rendering frame (see get_version and
+ * RenderState::begin_frame), which is what objects do before converting
+ * data, or explicitly with latch. A new record is signalled as a change of
+ * all elements, and its shape and type become those of data. Records
+ * published in between are reported by get_pending.
+ *
+ * Since the producer may overwrite a record once it wrapped around the ring,
+ * latching copies the record out of the shared segment and checks it has not
+ * been overwritten meanwhile, retrying with the newest record otherwise.
+ * Latched data is hence always consistent whatever the producer does.
+ */
+class SharedData : public Data {
+public:
+
+    // _________________________________________________________________________
+
+    /**
+     * @name Creation/Destruction
+     */
+    /**
+     * Default constructor
+     *
+     * @param ring ring to be followed
+     */
+    SharedData (SharedRingPtr ring);
+
+    /**
+     * Destructor
+     */
+    virtual ~SharedData (void);
+    //@}
+
+
+    // _________________________________________________________________________
+
+    /**
+     * @name Ring
+     */
+    /**
+     * Get followed ring
+     */
+    virtual SharedRingPtr get_ring (void) const;
+
+    /**
+     * Make last published record the current one
+     *
+     * @return whether a new record has been published since last latch
+     */
+    virtual bool latch (void);
+
+    /**
+     * Latch unless data has already been latched in current rendering frame
+     */
+    virtual void latch_frame (void);
+
+    /**
+     * Whether current record is still intact in the ring (the latched copy
+     * always is)
+     */
+    virtual bool get_valid (void) const;
+
+    /**
+     * Get time stamp of current record
+     */
+    virtual double get_time (void) const;
+
+    /**
+     * Get sequence number of current record, 0 if none
+     */
+    virtual unsigned long get_sequence (void) const;
+    //@}
+
+
+    // _________________________________________________________________________
+
+    /**
+     * @name Data
+     */
+    virtual void set_data (const void *data);
+    virtual void set_width (const unsigned int width);
+    virtual void set_height (const unsigned int height);
+    virtual void set_depth (const unsigned int depth);
+    virtual void set_type (const unsigned int type = GL_FLOAT);
+    virtual void set_stride (const unsigned int stride = 0);
+    //@}
+
+
+    // _________________________________________________________________________
+
+    /**
+     * @name Versioning
+     */
+    virtual unsigned long get_version (void) const;
+    virtual bool get_pending (void) const;
+    virtual bool get_dirty (unsigned long version,
+                            unsigned int &offset, unsigned int &count) const;
+    //@}
+
+
+protected:
+
+    // _________________________________________________________________________
+
+    /**
+     * Followed ring
+     */
+    SharedRingPtr ring_;
+
+    /**
+     * Current record
+     */
+    SharedRing::Record record_;
+
+    /**
+     * Copies of records, alternately filled when latching
+     */
+    BufferPtr copies_[2];
+
+    /**
+     * Index of copy holding current record
+     */
+    unsigned int copy_;
+
+    /**
+     * Rendering frame of last automatic latch (see latch_frame)
+     */
+    unsigned long frame_;
+};
+
+#endif
@@ -0,0 +1,297 @@
+/*
+ * Copyright (C) 2008 Nicolas P. Rougier
+ *
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "shared-ring.h"
+
+
+// Segment identification
+static const unsigned int magic = 0x52474353; // "SCGR"
+
+// Slot headers and data are aligned on cache lines
+static const size_t alignment = 64;
+
+static size_t
+align (size_t size)
+{
+    return ((size + alignment - 1)/alignment)*alignment;
+}
+
+// ______________________________________________________________________ Header
+struct SharedRing::Header {
+    unsigned int           magic;
+    unsigned int           slots;
+    size_t                 size;
+    size_t                 stride;
+    volatile unsigned long head;
+};
+
+
+// ________________________________________________________________________ Slot
+struct SharedRing::Slot {
+    volatile unsigned long lock;
+    double                 time;
+    unsigned int           width;
+    unsigned int           height;
+    unsigned int           depth;
+    unsigned int           type;
+};
+
+
+// __________________________________________________________________ SharedRing
+SharedRing::SharedRing (const std::string &name, unsigned int slots,
+                        size_t size)
+{
+    if ((slots == 0) or (size == 0)) {
+        throw std::invalid_argument ("Shared ring must not be empty");
+    }
+    name_ = name;
+    mapping_ = 0;
+    length_ = 0;
+    header_ = 0;
+    writable_ = true;
+
+    int fd = shm_open (name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+    if ((fd < 0) and (errno == EEXIST)) {
+        throw std::runtime_error ("Shared ring: " + name + " already exists");
+    }
+    if (fd < 0) {
+        throw std::runtime_error ("Shared ring: cannot create " + name);
+    }
+    size_t stride = align (sizeof (Slot)) + align (size);
+    size_t length = align (sizeof (Header)) + slots*stride;
+    if (ftruncate (fd, length) != 0) {
+        close (fd);
+        shm_unlink (name.c_str());
+        throw std::runtime_error ("Shared ring: cannot size " + name);
+    }
+    attach (fd, length, true);
+
+    // Segment is zero filled: no record yet and all slots unlocked
+    header_->slots = slots;
+    header_->size = size;
+    header_->stride = stride;
+    header_->head = 0;
+    __sync_synchronize ();
+    header_->magic = magic;
+}
+
+
+// __________________________________________________________________ SharedRing
+SharedRing::SharedRing (const std::string &name)
+{
+    name_ = name;
+    mapping_ = 0;
+    length_ = 0;
+    header_ = 0;
+    writable_ = false;
+
+    int fd = shm_open (name.c_str(), O_RDONLY, 0);
+    if (fd < 0) {
+        throw std::runtime_error ("Shared ring: cannot open " + name);
+    }
+    struct stat status;
+    if ((fstat (fd, &status) != 0) or
+        (size_t (status.st_size) < align (sizeof (Header)))) {
+        close (fd);
+        throw std::runtime_error ("Shared ring: " + name + " is not a ring");
+    }
+    attach (fd, status.st_size, false);
+    if ((header_->magic != magic) or
+        (length_ < align (sizeof (Header)) +
+                   header_->slots*header_->stride)) {
+        munmap (mapping_, length_);
+        throw std::runtime_error ("Shared ring: " + name + " is not a ring");
+    }
+}
+
+
+// _________________________________________________________________ ~SharedRing
+SharedRing::~SharedRing (void)
+{
+    munmap (mapping_, length_);
+}
+
+
+// ______________________________________________________________________ remove
+void
+SharedRing::remove (const std::string &name)
+{
+    shm_unlink (name.c_str());
+}
+
+
+// _____________________________________________________________________ publish
+void
+SharedRing::publish (const Data &data, double time)
+{
+    write (time, data.get_width(), data.get_height(), data.get_depth(),
+           data.get_type(), &data, 0);
+}
+
+
+// _____________________________________________________________________ publish
+void
+SharedRing::publish (double time, const float *values, unsigned int count)
+{
+    write (time, count, 1, 1, GL_FLOAT, 0, values);
+}
+
+
+// ____________________________________________________________________ get_head
+unsigned long
+SharedRing::get_head (void) const
+{
+    unsigned long head = header_->head;
+    __sync_synchronize ();
+    return head;
+}
+
+
+// _________________________________________________________________________ get
+bool
+SharedRing::get (unsigned long sequence, Record &record) const
+{
+    if ((sequence == 0) or (sequence > get_head()))
+        return false;
+    const Slot *slot = this->slot (sequence);
+    if (slot->lock != 2*sequence)
+        return false;
+    __sync_synchronize ();
+    record.sequence = sequence;
+    record.time = slot->time;
+    record.width = slot->width;
+    record.height = slot->height;
+    record.depth = slot->depth;
+    record.type = slot->type;
+    record.data = (const char *) slot + align (sizeof (Slot));
+    return validate (record);
+}
+
+
+// ____________________________________________________________________ validate
+bool
+SharedRing::validate (const Record &record) const
+{
+    __sync_synchronize ();
+    return slot (record.sequence)->lock == 2*record.sequence;
+}
+
+
+// ____________________________________________________________________ get_name
+std::string
+SharedRing::get_name (void) const
+{
+    return name_;
+}
+
+
+// ___________________________________________________________________ get_slots
+unsigned int
+SharedRing::get_slots (void) const
+{
+    return header_->slots;
+}
+
+
+// ____________________________________________________________________ get_size
+size_t
+SharedRing::get_size (void) const
+{
+    return header_->size;
+}
+
+
+// ______________________________________________________________________ attach
+void
+SharedRing::attach (int fd, size_t length, bool writable)
+{
+    int protection = PROT_READ;
+    if (writable)
+        protection |= PROT_WRITE;
+    mapping_ = mmap (0, length, protection, MAP_SHARED, fd, 0);
+    close (fd);
+    if (mapping_ == MAP_FAILED) {
+        mapping_ = 0;
+        throw std::runtime_error ("Shared ring: cannot map " + name_);
+    }
+    length_ = length;
+    header_ = (Header *) mapping_;
+}
+
+
+// ________________________________________________________________________ slot
+SharedRing::Slot *
+SharedRing::slot (unsigned long sequence) const
+{
+    size_t index = (sequence-1) % header_->slots;
+    return (Slot *) ((char *) mapping_ + align (sizeof (Header)) +
+                     index*header_->stride);
+}
+
+
+// _______________________________________________________________________ write
+void
+SharedRing::write (double time, unsigned int width, unsigned int height,
+                   unsigned int depth, unsigned int type,
+                   const Data *data, const void *values)
+{
+    if (not writable_) {
+        throw std::logic_error ("Shared ring is opened for reading only");
+    }
+    size_t element = depth*Data::type_size (type);
+    size_t count = size_t (width)*height;
+    if (element*count > header_->size) {
+        throw std::invalid_argument ("Shared ring record does not fit in slot");
+    }
+    if ((count > 0) and (not values) and (not data->get_data())) {
+        throw std::invalid_argument ("Shared ring data must be valid");
+    }
+
+    unsigned long sequence = header_->head + 1;
+    Slot *slot = this->slot (sequence);
+    slot->lock = 2*sequence - 1;
+    __sync_synchronize ();
+
+    slot->time = time;
+    slot->width = width;
+    slot->height = height;
+    slot->depth = depth;
+    slot->type = type;
+    char *out = (char *) slot + align (sizeof (Slot));
+    if (values) {
+        memcpy (out, values, element*count);
+    } else if (count > 0) {
+        const char *in = (const char *) data->get_data();
+        size_t stride = data->get_stride();
+        if (stride == element) {
+            memcpy (out, in, element*count);
+        } else {
+            for (size_t i=0; i<count; i++)
+                memcpy (out + i*element, in + i*stride, element);
+        }
+    }
+
+    __sync_synchronize ();
+    slot->lock = 2*sequence;
+    __sync_synchronize ();
+    header_->head = sequence;
+}
@@ -0,0 +1,240 @@
+/*
+ * Copyright (C) 2008 Nicolas P. Rougier
+ *
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef __SHARED_RING_H__
+#define __SHARED_RING_H__
+#include <string>
+#include "data.h"
+
+#if defined(HAVE_BOOST)
+#   include <boost/shared_ptr.hpp>
+    typedef boost::shared_ptr<class SharedRing> SharedRingPtr;
+#else
+    typedef class SharedRing *                  SharedRingPtr;
+#endif
+
+
+/**
+ * Ring of records shared between processes.
+ *
+ * A ring lives in a named POSIX shared memory segment such that a producer
+ * process (typically a long running simulation) can publish data arrays to
+ * viewer processes without any serialization, a viewer crash never affecting
+ * the producer. The segment holds a fixed number of slots of fixed size, each
+ * record (a data array and its time stamp) being written in the slot
+ * following the one of last record.
+ *
+ * There is a single writer and any number of readers which never write to
+ * the segment. Each slot is protected by a sequence lock: its lock word is odd
+ * while the slot is being written and equals twice the record sequence
+ * number once written. Readers check the lock word before and after reading
+ * a record (see get and validate) and simply drop records that have been
+ * overwritten in between. Records being read in place, the ring must hold
+ * enough slots for the producer not to wrap around while a viewer renders a
+ * frame.
+ */
+class SharedRing {
+public:
+
+    /**
+     * Record read from a ring, pointing directly into shared memory
+     */
+    struct Record {
+        unsigned long sequence;  /*!< record sequence number (from 1) */
+        double        time;      /*!< record time stamp               */
+        unsigned int  width;     /*!< data width                      */
+        unsigned int  height;    /*!< data height                     */
+        unsigned int  depth;     /*!< data depth                      */
+        unsigned int  type;      /*!< data type                       */
+        const void *  data;      /*!< tightly packed data             */
+    };
+
+
+public:
+
+    // _________________________________________________________________________
+
+    /**
+     * @name Creation/Destruction
+     */
+    /**
+     * Create a ring (producer side)
+     *
+     * Creation fails if a segment with the same name exists, a stale one
+     * (left by a crashed producer) has to be removed first (see remove).
+     *
+     * @param name  segment name (starting with '/')
+     * @param slots number of slots
+     * @param size  maximum size in bytes of a record data
+     */
+    SharedRing (const std::string &name, unsigned int slots, size_t size);
+
+    /**
+     * Open an existing ring (viewer side)
+     *
+     * @param name  segment name (starting with '/')
+     */
+    SharedRing (const std::string &name);
+
+    /**
+     * Destructor
+     *
+     * The segment is unmapped but not removed (see remove).
+     */
+    virtual ~SharedRing (void);
+
+    /**
+     * Remove a segment name, mappings staying valid until released
+     *
+     * @param name  segment name
+     */
+    static void remove (const std::string &name);
+    //@}
+
+
+    // _________________________________________________________________________
+
+    /**
+     * @name Producer
+     */
+    /**
+     * Publish data as a new record
+     *
+     * Data elements are packed when copied into the ring.
+     *
+     * @param data data to be published
+     * @param time record time stamp
+     */
+    virtual void publish (const Data &data, double time = 0);
+
+    /**
+     * Publish a sample (a vector of floats) as a new record
+     *
+     * @param time   sample time
+     * @param values sample values
+     * @param count  number of values
+     */
+    virtual void publish (double time, const float *values, unsigned int count);
+    //@}
+
+
+    // _________________________________________________________________________
+
+    /**
+     * @name Viewer
+     */
+    /**
+     * Get sequence number of last published record, 0 if none
+     */
+    virtual unsigned long get_head (void) const;
+
+    /**
+     * Start reading a record
+     *
+     * @param sequence record sequence number
+     * @param record   record pointing into ring
+     * @return whether record is still in the ring and completely written
+     */
+    virtual bool get (unsigned long sequence, Record &record) const;
+
+    /**
+     * Check a record has not been overwritten since it was got
+     *
+     * @param record record obtained by get
+     */
+    virtual bool validate (const Record &record) const;
+    //@}
+
+
+    // _________________________________________________________________________
+
+    /**
+     * @name Layout
+     */
+    /**
+     * Get segment name
+     */
+    virtual std::string get_name (void) const;
+
+    /**
+     * Get number of slots
+     */
+    virtual unsigned int get_slots (void) const;
+
+    /**
+     * Get maximum size in bytes of a record data
+     */
+    virtual size_t get_size (void) const;
+    //@}
+
+
+protected:
+
+    // _________________________________________________________________________
+
+    /**
+     * Segment header
+     */
+    struct Header;
+
+    /**
+     * Slot header, followed by record data
+     */
+    struct Slot;
+
+    /**
+     * Map segment from an open descriptor
+     */
+    void attach (int fd, size_t length, bool writable);
+
+    /**
+     * Get slot holding a sequence number
+     */
+    Slot *slot (unsigned long sequence) const;
+
+    /**
+     * Write a record
+     */
+    void write (double time, unsigned int width, unsigned int height,
+                unsigned int depth, unsigned int type,
+                const Data *data, const void *values);
+
+    /**
+     * Segment name
+     */
+    std::string name_;
+
+    /**
+     * Segment mapping
+     */
+    void *mapping_;
+
+    /**
+     * Segment size
+     */
+    size_t length_;
+
+    /**
+     * Segment header (start of mapping)
+     */
+    Header *header_;
+
+    /**
+     * Whether this is the producer side
+     */
+    bool writable_;
+};
+
+#endif
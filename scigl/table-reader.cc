@@ -0,0 +1,370 @@
+/*
+ * Copyright (C) 2008 Nicolas P. Rougier
+ *
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <sys/stat.h>
+#include "convert.h"
+#include "buffer.h"
+#include "table-reader.h"
+
+
+// Size of chunks parsed in parallel
+static const size_t chunk_size = 1 << 20;
+
+// Skip value separators
+static inline const char *
+skip_separators (const char *p, const char *end)
+{
+    while ((p < end) and ((*p == ' ') or (*p == '\t') or (*p == ',') or
+                          (*p == ';') or (*p == '\r')))
+        p++;
+    return p;
+}
+
+// Whether a line holds no value (blank or comment)
+static inline bool
+skipped (const char *p, const char *end)
+{
+    while ((p < end) and ((*p == ' ') or (*p == '\t') or (*p == '\r')))
+        p++;
+    return (p == end) or (*p == '#');
+}
+
+// End of line starting at p
+static inline const char *
+end_of_line (const char *p, const char *end)
+{
+    const char *eol = (const char *) memchr (p, '\n', end-p);
+    return eol ? eol : end;
+}
+
+// Number of values of a line, 0 if it is not made of numbers
+static unsigned int
+count_values (const char *p, const char *end)
+{
+    unsigned int count = 0;
+    double value;
+    p = skip_separators (p, end);
+    while (p < end) {
+        if (not parse_number (p, end, value))
+            return 0;
+        count++;
+        p = skip_separators (p, end);
+    }
+    return count;
+}
+
+
+// ________________________________________________________________________ Part
+struct TableReader::Part {
+    Part (const char *begin, const char *end)
+        : begin(begin), end(end), lines(0), rows(0), first_row(0),
+          first_line(0), error_count(0)
+    {}
+
+    void error (unsigned long line, unsigned int column, const char *message)
+    {
+        error_count++;
+        if (errors.size() < TableReader::max_errors) {
+            Error e;
+            e.line = line;
+            e.column = column;
+            e.message = message;
+            errors.push_back (e);
+        }
+    }
+
+    const char *       begin, *end;
+    unsigned long      lines;
+    unsigned int       rows;
+    unsigned int       first_row;
+    unsigned long      first_line;
+    std::vector<Error> errors;
+    unsigned long      error_count;
+};
+
+
+// _______________________________________________________________________ Chunk
+class TableReader::Chunk : public WorkerPool::Task {
+public:
+    Chunk (TableReader *reader, Part *part, bool counting)
+        : reader_(reader), part_(part), counting_(counting)
+    {}
+
+    void run (void)
+    {
+        if (counting_)
+            reader_->count (*part_);
+        else if (reader_->type_ == GL_DOUBLE)
+            reader_->parse<GLdouble> (*part_);
+        else if (reader_->type_ == GL_INT)
+            reader_->parse<GLint> (*part_);
+        else
+            reader_->parse<GLfloat> (*part_);
+    }
+
+protected:
+    TableReader *reader_;
+    Part *       part_;
+    bool         counting_;
+};
+
+
+// _________________________________________________________________ TableReader
+TableReader::TableReader (void)
+{
+    type_ = GL_FLOAT;
+    rows_ = 0;
+    missing_ = std::numeric_limits<double>::quiet_NaN();
+    error_count_ = 0;
+}
+
+
+// ________________________________________________________________ ~TableReader
+TableReader::~TableReader (void)
+{}
+
+
+// ________________________________________________________________________ read
+bool
+TableReader::read (const std::string &filename, unsigned int type,
+                   WorkerPoolPtr pool)
+{
+    if ((type != GL_FLOAT) and (type != GL_DOUBLE) and (type != GL_INT)) {
+        throw std::invalid_argument
+            ("Table reader type must be GL_[FLOAT,DOUBLE,INT]");
+    }
+    type_ = type;
+    rows_ = 0;
+    columns_.clear();
+    outputs_.clear();
+    errors_.clear();
+    error_count_ = 0;
+    if (not pool) {
+        if (not pool_)
+            pool_ = WorkerPoolPtr (new WorkerPool());
+        pool = pool_;
+    }
+
+    struct stat status;
+    if (stat (filename.c_str(), &status) != 0) {
+        throw std::runtime_error ("Table reader: cannot open " + filename);
+    }
+    if (status.st_size == 0)
+        return true;
+    BufferPtr file = BufferPtr (new Buffer (filename, 0, 0,
+                                            Buffer::ACCESS_SEQUENTIAL));
+    const char *text = (const char *) ((const Buffer &) *file).get_data();
+    const char *end = text + file->get_size();
+
+    // First row gives number of columns, a first line of words is a header
+    const char *start = text;
+    unsigned long line = 1;
+    unsigned int columns = 0;
+    bool first = true;
+    while ((start < end) and (columns == 0)) {
+        const char *eol = end_of_line (start, end);
+        if (not skipped (start, eol)) {
+            columns = count_values (start, eol);
+            if ((columns == 0) and (not first)) {
+                Error e;
+                e.line = line;
+                e.column = 1;
+                e.message = "bad value";
+                errors_.push_back (e);
+                error_count_++;
+            }
+            first = false;
+        }
+        if (columns == 0) {
+            start = eol+1;
+            line++;
+        }
+    }
+    if (columns == 0)
+        return errors_.empty();
+
+    // Parts end on line boundaries
+    std::vector<Part> parts;
+    while (start < end) {
+        const char *stop = end;
+        if (size_t (end-start) > chunk_size)
+            stop = std::min (end, end_of_line (start + chunk_size, end) + 1);
+        parts.push_back (Part (start, stop));
+        start = stop;
+    }
+
+    // Rows are counted first such that each part knows where to write
+    for (unsigned int i=0; i<parts.size(); i++)
+        pool->submit (new Chunk (this, &parts[i], true));
+    pool->wait ();
+    for (unsigned int i=0; i<parts.size(); i++) {
+        parts[i].first_row = rows_;
+        parts[i].first_line = line;
+        rows_ += parts[i].rows;
+        line += parts[i].lines;
+    }
+
+    unsigned int size = 0;
+    if (type_ == GL_DOUBLE)
+        size = sizeof (GLdouble);
+    else if (type_ == GL_INT)
+        size = sizeof (GLint);
+    else
+        size = sizeof (GLfloat);
+    std::vector<BufferPtr> buffers;
+    for (unsigned int i=0; i<columns; i++) {
+        buffers.push_back (BufferPtr (new Buffer (size_t (rows_)*size)));
+        outputs_.push_back (buffers[i]->get_data());
+    }
+
+    for (unsigned int i=0; i<parts.size(); i++)
+        pool->submit (new Chunk (this, &parts[i], false));
+    pool->wait ();
+
+    for (unsigned int i=0; i<parts.size(); i++) {
+        error_count_ += parts[i].error_count;
+        for (unsigned int j=0; j<parts[i].errors.size(); j++)
+            if (errors_.size() < max_errors)
+                errors_.push_back (parts[i].errors[j]);
+    }
+    for (unsigned int i=0; i<columns; i++) {
+        DataPtr column = DataPtr (new Data ());
+        column->set (buffers[i], rows_, 1, 1, type_);
+        columns_.push_back (column);
+    }
+    outputs_.clear();
+    return error_count_ == 0;
+}
+
+
+// _________________________________________________________________ set_missing
+void
+TableReader::set_missing (double value)
+{
+    missing_ = value;
+}
+
+
+// _________________________________________________________________ get_missing
+double
+TableReader::get_missing (void) const
+{
+    return missing_;
+}
+
+
+// _________________________________________________________________ get_columns
+unsigned int
+TableReader::get_columns (void) const
+{
+    return columns_.size();
+}
+
+
+// ____________________________________________________________________ get_rows
+unsigned int
+TableReader::get_rows (void) const
+{
+    return rows_;
+}
+
+
+// __________________________________________________________________ get_column
+DataPtr
+TableReader::get_column (unsigned int index) const
+{
+    if (index >= columns_.size()) {
+        throw std::invalid_argument ("Table reader column index out of range");
+    }
+    return columns_[index];
+}
+
+
+// __________________________________________________________________ get_errors
+const std::vector<TableReader::Error> &
+TableReader::get_errors (void) const
+{
+    return errors_;
+}
+
+
+// _____________________________________________________________ get_error_count
+unsigned long
+TableReader::get_error_count (void) const
+{
+    return error_count_;
+}
+
+
+// _______________________________________________________________________ count
+void
+TableReader::count (Part &part)
+{
+    const char *p = part.begin;
+    while (p < part.end) {
+        const char *eol = end_of_line (p, part.end);
+        if (not skipped (p, eol))
+            part.rows++;
+        part.lines++;
+        p = eol+1;
+    }
+}
+
+
+// _______________________________________________________________________ parse
+template <typename T>
+void
+TableReader::parse (Part &part)
+{
+    unsigned int columns = outputs_.size();
+    unsigned int row = part.first_row;
+    unsigned long line = part.first_line;
+    T missing = T (0);
+    if (missing_ == missing_)
+        missing = T (missing_);
+    else if (std::numeric_limits<T>::has_quiet_NaN)
+        missing = std::numeric_limits<T>::quiet_NaN();
+    const char *p = part.begin;
+    while (p < part.end) {
+        const char *eol = end_of_line (p, part.end);
+        if (skipped (p, eol)) {
+            p = eol+1;
+            line++;
+            continue;
+        }
+        for (unsigned int c=0; c<columns; c++) {
+            T value = missing;
+            p = skip_separators (p, eol);
+            if (p == eol) {
+                part.error (line, c+1, "missing value");
+            } else if (not parse_number (p, eol, value)) {
+                part.error (line, c+1, "bad value");
+                value = missing;
+                while ((p < eol) and (skip_separators (p, eol) == p))
+                    p++;
+            }
+            ((T *) outputs_[c])[row] = value;
+        }
+        if (skip_separators (p, eol) != eol)
+            part.error (line, columns+1, "extra values");
+        p = eol+1;
+        row++;
+        line++;
+    }
+}
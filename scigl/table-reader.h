@@ -0,0 +1,216 @@
+/*
+ * Copyright (C) 2008 Nicolas P. Rougier
+ *
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef __TABLE_READER_H__
+#define __TABLE_READER_H__
+#include <string>
+#include <vector>
+#include "data.h"
+#include "worker-pool.h"
+
+#if defined(HAVE_BOOST)
+#   include <boost/shared_ptr.hpp>
+    typedef boost::shared_ptr<class TableReader> TableReaderPtr;
+#else
+    typedef class TableReader *                  TableReaderPtr;
+#endif
+
+
+/**
+ * Bulk reader of numeric text tables (CSV or whitespace separated).
+ *
+ * The file is memory mapped (see Buffer) and split into chunks ending on line
+ * boundaries. Chunks are parsed in parallel by a worker pool, numbers being
+ * converted without locale nor allocation (see parse_number in convert.h),
+ * and written straight into one buffer per column. Each column is then
+ * available as a Data over its buffer.
+ *
+ * Values are separated by spaces, tabs, commas or semicolons. Blank lines
+ * and lines starting with '#' are skipped, and so is a first line that is not
+ * made of numbers (a header). The number of columns is given by the first row.
+ *
+ * Malformed rows do not stop reading: they are kept (unparsed values being
+ * replaced by the missing value, see set_missing) and reported with their
+ * line number (see get_errors).
+ */
+class TableReader {
+public:
+
+    /**
+     * Parse error
+     */
+    struct Error {
+        unsigned long line;     /*!< line number (from 1)        */
+        unsigned int  column;   /*!< column number (from 1)      */
+        std::string   message;  /*!< what went wrong             */
+    };
+
+
+public:
+
+    // _________________________________________________________________________
+
+    /**
+     * @name Creation/Destruction
+     */
+    /**
+     * Default constructor
+     */
+    TableReader (void);
+
+    /**
+     * Destructor
+     */
+    virtual ~TableReader (void);
+    //@}
+
+
+    // _________________________________________________________________________
+
+    /**
+     * @name Reading
+     */
+    /**
+     * Read a table
+     *
+     * @param filename file to be read
+     * @param type     column type (GL_FLOAT, GL_DOUBLE or GL_INT)
+     * @param pool     pool parsing chunks (a pool owned by the reader if
+     *                 none, such that reading does not wait for nor delay
+     *                 rendering tasks of the default pool)
+     * @return whether table was read without error
+     */
+    virtual bool read (const std::string &filename,
+                       unsigned int type = GL_FLOAT,
+                       WorkerPoolPtr pool = WorkerPoolPtr());
+
+    /**
+     * Set value stored in place of missing or malformed values
+     *
+     * Default is NaN, which integer columns cannot hold: they get 0 unless
+     * another value is set (truncated to an integer).
+     *
+     * @param value missing value
+     */
+    virtual void set_missing (double value);
+
+    /**
+     * Get value stored in place of missing or malformed values
+     */
+    virtual double get_missing (void) const;
+
+    /**
+     * Get number of columns
+     */
+    virtual unsigned int get_columns (void) const;
+
+    /**
+     * Get number of rows
+     */
+    virtual unsigned int get_rows (void) const;
+
+    /**
+     * Get a column
+     *
+     * @param index column index
+     * @return data over column buffer
+     */
+    virtual DataPtr get_column (unsigned int index) const;
+
+    /**
+     * Get errors of last read (at most max_errors)
+     */
+    virtual const std::vector<Error> & get_errors (void) const;
+
+    /**
+     * Get number of errors of last read, including those not kept
+     */
+    virtual unsigned long get_error_count (void) const;
+
+    /**
+     * Maximum number of errors kept
+     */
+    static const unsigned int max_errors = 100;
+    //@}
+
+
+protected:
+
+    // _________________________________________________________________________
+
+    /**
+     * Lines parsed by a task
+     */
+    struct Part;
+
+    /**
+     * Counting or parsing of a part by a worker pool
+     */
+    class Chunk;
+    friend class Chunk;
+
+    /**
+     * Count lines and rows of a part
+     */
+    void count (Part &part);
+
+    /**
+     * Parse rows of a part into columns
+     */
+    template <typename T>
+    void parse (Part &part);
+
+    /**
+     * Type of columns
+     */
+    unsigned int type_;
+
+    /**
+     * Number of rows
+     */
+    unsigned int rows_;
+
+    /**
+     * Columns
+     */
+    std::vector<DataPtr> columns_;
+
+    /**
+     * Column storage
+     */
+    std::vector<void *> outputs_;
+
+    /**
+     * Missing value
+     */
+    double missing_;
+
+    /**
+     * Errors
+     */
+    std::vector<Error> errors_;
+
+    /**
+     * Number of errors
+     */
+    unsigned long error_count_;
+
+    /**
+     * Pool parsing chunks when none is given to read
+     */
+    WorkerPoolPtr pool_;
+};
+
+#endif
@@ -90,6 +90,7 @@ split (const std::string &text)
 void
 Terminal::print (const std::string &text)
 {
+    set_dirty ();
     if (not text.size())
         return;
 
@@ -129,20 +130,19 @@ Terminal::render (void)
     }
 
     
-    GLint viewport[4]; 
-    glGetIntegerv (GL_VIEWPORT, viewport);
+    int viewport[4];
+    RenderState::get_viewport (viewport);
     float height = viewport[3];
 
-    glPushMatrix();
+    RenderState::push_matrix();
 
     Widget::render();
 
-    glEnable (GL_SCISSOR_TEST);
-    glScissor (int(get_position().x + get_margin().left),
-               int(height-1-get_position().y - get_size().y + get_margin().down),
-               int(get_size().x - get_margin().right - get_margin().left),
-               int(get_size().y - get_margin().up    - get_margin().down));
-    glTranslatef (get_position().x + get_margin().left,
+    RenderState::scissor (int(get_position().x + get_margin().left),
+                          int(height-1-get_position().y - get_size().y + get_margin().down),
+                          int(get_size().x - get_margin().right - get_margin().left),
+                          int(get_size().y - get_margin().up    - get_margin().down));
+    RenderState::translate (get_position().x + get_margin().left,
                   height-1-get_position().y - get_margin().up,
                   1);
     glTexEnvf (GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
@@ -168,22 +168,22 @@ Terminal::render (void)
     // dy to be aligned on terminal bottom line
     if (h > (get_size().y - get_margin().up - get_margin().down))
         dy = h - (get_size().y - get_margin().up - get_margin().down);
-    glTranslatef (0, dy, 0);
+    RenderState::translate (0, dy, 0);
 
     // buffer
-    glPushMatrix();
+    RenderState::push_matrix();
     glColor4f (fg_color_.r,fg_color_.g, fg_color_.b, fg_color_.a*alpha_);
     glListBase (font_->get_base());
     for (int i=int(buffer_.size()-l); i<int(buffer_.size()); i++) {
         //glPushMatrix();
-        font_->render_ansi_string (buffer_[i], alpha_);
+        font_->render_ansi_string (buffer_[i], fg_color_, alpha_);
         //glPopMatrix();
     }
 
     // prompt & cursor
     //glColor4f (fg_color_.r,fg_color_.g, fg_color_.b, fg_color_.a*alpha_);
     //glPushMatrix();
-    font_->render_ansi_string (prompt_, alpha_);
+    font_->render_ansi_string (prompt_, fg_color_, alpha_);
     //glTranslatef (s.x*size.x,0,0);
     glDisable (GL_TEXTURE_2D);
     glBegin (GL_LINES);
@@ -191,13 +191,13 @@ Terminal::render (void)
     glVertex3f (cursor_*size.x +0.375, -size.y, 0);
     glEnd();
     glEnable (GL_TEXTURE_2D);
-    font_->render_ansi_string (input_, alpha_);
+    font_->render_ansi_string (input_, fg_color_, alpha_);
     //glPopMatrix();
 
-    glPopMatrix();
+    RenderState::pop_matrix();
 
 
-    glPopMatrix();
+    RenderState::pop_matrix();
 
     render_finish();
 }
@@ -206,6 +206,7 @@ Terminal::render (void)
 bool
 Terminal::keyboard_action (std::string action, std::string keyname)
 {
+    set_dirty ();
     if (not get_visible())
         return false;
     if ((action == "type")  and
@@ -288,6 +289,7 @@ Terminal::get_prompt (void)
 void
 Terminal::set_prompt (std::string prompt)
 {
+    set_dirty ();
     prompt_ = prompt;
 }
 
@@ -302,6 +304,7 @@ Terminal::get_input (void)
 void
 Terminal::set_input (std::string input)
 {
+    set_dirty ();
     input_ = input;
     cursor_ = input_.size();
 }
@@ -310,6 +313,7 @@ Terminal::set_input (std::string input)
 void
 Terminal::set_fontsize (int size)
 {
+    set_dirty ();
     fontsize_ = size;
     switch (fontsize_) {
     case 1:
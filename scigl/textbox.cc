@@ -50,15 +50,13 @@ TextBox::render (void)
         return;
     }
 
-    GLint viewport[4]; 
-    glGetIntegerv (GL_VIEWPORT, viewport);
-    GLint scissor[4]; 
-    glGetIntegerv (GL_SCISSOR_BOX, scissor);
-    GLint scissor_active;
-    glGetIntegerv (GL_SCISSOR_TEST, &scissor_active);
+    int viewport[4];
+    RenderState::get_viewport (viewport);
+    int scissor[4];
+    bool scissor_active = RenderState::get_scissor (scissor);
     float height = viewport[3];
 
-    glPushMatrix();
+    RenderState::push_matrix();
     Widget::render();
 
     int border = 2;
@@ -81,10 +79,9 @@ TextBox::render (void)
         if ((y+h) > (viewport[1]+scissor[3]))
             h += (viewport[1]+scissor[3]) - (y+h);
     }
-    glEnable (GL_SCISSOR_TEST);
-    glScissor (x,y,w,h);
+    RenderState::scissor (x,y,w,h);
 
-    glTranslatef (get_position().x          + get_margin().left+1,
+    RenderState::translate (get_position().x          + get_margin().left+1,
                   height-1-get_position().y - get_margin().up+1,
                   1);
     glTexEnvf (GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
@@ -96,16 +93,17 @@ TextBox::render (void)
     glEnable (GL_BLEND);
     glListBase (font_->get_base());
 
-    glPushMatrix();
+    RenderState::push_matrix();
     if (justification_ == -1) {
         //glTranslatef (int(get_size().x/2), 0, 0);
     } else if (justification_ == 0) {
-        glTranslatef (int((get_size().x-get_margin().right-get_margin().left)/2), 0, 0);
+        RenderState::translate (int((get_size().x-get_margin().right-get_margin().left)/2), 0, 0);
     } else if (justification_ == +1) {
-        glTranslatef (int(get_size().x -get_margin().right-get_margin().left-1),0,0);
+        RenderState::translate (int(get_size().x -get_margin().right-get_margin().left-1),0,0);
     }
-    Size s = font_->render_ansi_string (buffer_, alpha_, justification_);
-    glPopMatrix();
+    Size s = font_->render_ansi_string (buffer_, fg_color_,
+                                        alpha_, justification_);
+    RenderState::pop_matrix();
 
     // FIX ME:
     //  Autosize is computed once the test has been rendered at least once,
@@ -117,7 +115,7 @@ TextBox::render (void)
             + get_margin().up + get_margin().down;
     }
 
-    glPopMatrix();
+    RenderState::pop_matrix();
     render_finish();
 }
 
@@ -134,6 +132,7 @@ TextBox::get_buffer (void)
 void
 TextBox::set_buffer (std::string buffer)
 {
+    set_dirty ();
     buffer_ = buffer;
 }
 
@@ -142,6 +141,7 @@ TextBox::set_buffer (std::string buffer)
 void
 TextBox::set_fontsize (int size)
 {
+    set_dirty ();
     fontsize_ = size;
     switch (fontsize_) {
     case 1:
@@ -172,6 +172,7 @@ TextBox::get_fontsize()
 void
 TextBox::set_justification (int justification)
 {
+    set_dirty ();
     switch (justification) {
     case 0:
         justification_ = 0;
@@ -198,6 +199,7 @@ TextBox::get_justification (void)
 void
 TextBox::set_autosize (bool autosize)
 {
+    set_dirty ();
     autosize_ = autosize;
 }
 
@@ -214,6 +216,7 @@ TextBox::get_autosize (void)
 void
 TextBox::set_size (Size size)
 {
+    set_dirty ();
     if (autosize_)
         size_.z = size.z;
     else
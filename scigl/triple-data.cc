@@ -0,0 +1,189 @@
+/*
+ * Copyright (C) 2008 Nicolas P. Rougier
+ *
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <climits>
+#include <cstring>
+#include <stdexcept>
+#include "triple-data.h"
+#include "render-state.h"
+#if defined(HAVE_BOOST)
+
+
+// __________________________________________________________________ TripleData
+TripleData::TripleData (unsigned int width, unsigned int height,
+                        unsigned int depth, unsigned int type) : Data ()
+{
+    unsigned int size = type_size (type);
+    if (size == 0) {
+        throw std::invalid_argument
+            ("Data type must be GL_[BYTE,SHORT,INT,FLOAT,DOUBLE]");
+    }
+    if ((width*height == 0) or (depth == 0)) {
+        throw std::invalid_argument ("Data must not be empty");
+    }
+    size_t length = size_t (width)*height*depth*size;
+    for (unsigned int i=0; i<3; i++) {
+        buffers_[i] = BufferPtr (new Buffer (length));
+        memset (buffers_[i]->get_data(), 0, length);
+    }
+    back_ = 0;
+    middle_ = 1;
+    front_ = 2;
+    frame_ = RenderState::get_frame() - 1;
+    width_ = width;
+    height_ = height;
+    depth_ = depth;
+    type_ = type;
+    stride_ = 0;
+    buffer_ = buffers_[front_];
+    data_ = buffer_->get_data();
+    tracked_ = true;
+}
+
+
+// _________________________________________________________________ ~TripleData
+TripleData::~TripleData (void)
+{}
+
+
+// ____________________________________________________________________ get_back
+void *
+TripleData::get_back (void)
+{
+    return buffers_[back_]->get_data();
+}
+
+
+// _____________________________________________________________________ publish
+void
+TripleData::publish (bool carry)
+{
+    unsigned int published = back_;
+    back_ = exchange (published | fresh) & ~fresh;
+    if (carry)
+        memcpy (buffers_[back_]->get_data(), buffers_[published]->get_data(),
+                buffers_[back_]->get_size());
+}
+
+
+// _______________________________________________________________________ latch
+bool
+TripleData::latch (void)
+{
+    if (not (middle_ & fresh))
+        return false;
+    front_ = exchange (front_) & ~fresh;
+    buffer_ = buffers_[front_];
+    data_ = buffer_->get_data();
+    record (0, UINT_MAX);
+    return true;
+}
+
+
+// _________________________________________________________________ latch_frame
+void
+TripleData::latch_frame (void)
+{
+    unsigned long frame = RenderState::get_frame();
+    if (frame == frame_)
+        return;
+    frame_ = frame;
+    latch ();
+}
+
+
+// ____________________________________________________________________ set_data
+void
+TripleData::set_data (const void *data)
+{
+    throw std::invalid_argument ("Triple data storage cannot be changed");
+}
+
+
+// ___________________________________________________________________ set_width
+void
+TripleData::set_width (const unsigned int width)
+{
+    throw std::invalid_argument ("Triple data width cannot be changed");
+}
+
+
+// __________________________________________________________________ set_height
+void
+TripleData::set_height (const unsigned int height)
+{
+    throw std::invalid_argument ("Triple data height cannot be changed");
+}
+
+
+// ___________________________________________________________________ set_depth
+void
+TripleData::set_depth (const unsigned int depth)
+{
+    throw std::invalid_argument ("Triple data depth cannot be changed");
+}
+
+
+// ____________________________________________________________________ set_type
+void
+TripleData::set_type (const unsigned int type)
+{
+    throw std::invalid_argument ("Triple data type cannot be changed");
+}
+
+
+// __________________________________________________________________ set_stride
+void
+TripleData::set_stride (const unsigned int stride)
+{
+    throw std::invalid_argument ("Triple data stride cannot be changed");
+}
+
+
+// _________________________________________________________________ get_version
+unsigned long
+TripleData::get_version (void) const
+{
+    const_cast<TripleData *>(this)->latch_frame ();
+    return version_;
+}
+
+
+// _________________________________________________________________ get_pending
+bool
+TripleData::get_pending (void) const
+{
+    return middle_ & fresh;
+}
+
+
+// ___________________________________________________________________ get_dirty
+bool
+TripleData::get_dirty (unsigned long version,
+                       unsigned int &offset, unsigned int &count) const
+{
+    const_cast<TripleData *>(this)->latch_frame ();
+    return Data::get_dirty (version, offset, count);
+}
+
+
+// ____________________________________________________________________ exchange
+unsigned int
+TripleData::exchange (unsigned int state)
+{
+    return middle_.exchange (state, boost::memory_order_acq_rel);
+}
+
+#endif
@@ -0,0 +1,197 @@
+/*
+ * Copyright (C) 2008 Nicolas P. Rougier
+ *
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef __TRIPLE_DATA_H__
+#define __TRIPLE_DATA_H__
+#include "data.h"
+
+#if defined(HAVE_BOOST)
+#   include <boost/shared_ptr.hpp>
+#   include <boost/atomic.hpp>
+    typedef boost::shared_ptr<class TripleData> TripleDataPtr;
+
+
+/**
+ * Data shared between a producer thread and a rendering thread.
+ *
+ * Storage is made of three buffers of identical layout: the back buffer is
+ * written by the producer, the front buffer is read by the renderer and the
+ * middle one holds the last published frame. Publishing swaps back and middle
+ * buffers while latching swaps middle and front buffers, both swaps being a
+ * single atomic exchange. Hence neither side ever waits for the other and the
+ * renderer always reads a complete frame, frames published faster than they
+ * are rendered being simply skipped.
+ *
+ * The renderer latches the last published frame the first time it reads data
+ * version within a rendering frame (see get_version and
+ * RenderState::begin_frame), which is what objects do before converting data,
+ * or explicitly with latch. All objects rendering the data within a frame
+ * thus read the same front buffer, even while it is being converted by a
+ * worker pool. A new frame is signalled as a change of all elements. Frames
+ * published in between are reported by get_pending, such that objects know
+ * they have to be rendered again.
+ *
+ * Distinct triple data are published and latched independently, so several
+ * columns that must stay consistent (x, y and z coordinates of a cloud for
+ * instance) have to be stored in a single triple data whose depth is the
+ * number of columns, objects being given its columns as views (see
+ * Data::component). This is the only supported pattern for multi-column
+ * data, one triple data per column possibly mixing columns of different
+ * frames.
+ *
+ * Only get_back and publish may be called by the producer.
+ *
+ * Buffers are exchanged through atomic operations provided by boost, triple
+ * data is not available without boost.
+ */
+class TripleData : public Data {
+public:
+
+    // _________________________________________________________________________
+
+    /**
+     * @name Creation/Destruction
+     */
+    /**
+     * Default constructor
+     *
+     * All three buffers are tightly packed and initialized to zero.
+     *
+     * @param width  data width
+     * @param height data height
+     * @param depth  number of components per data
+     * @param type   data type (GL_[BYTE,SHORT,INT,FLOAT,DOUBLE])
+     */
+    TripleData (unsigned int width,
+                unsigned int height = 1,
+                unsigned int depth = 1,
+                unsigned int type = GL_FLOAT);
+
+    /**
+     * Destructor
+     */
+    virtual ~TripleData (void);
+    //@}
+
+
+    // _________________________________________________________________________
+
+    /**
+     * @name Producer
+     */
+    /**
+     * Get back buffer storage, to be filled with next frame
+     */
+    virtual void *get_back (void);
+
+    /**
+     * Publish back buffer as last frame
+     *
+     * @param carry whether the new back buffer starts as a copy of the
+     *              published frame, such that producer can update it
+     *              incrementally instead of writing a whole frame
+     */
+    virtual void publish (bool carry = true);
+    //@}
+
+
+    // _________________________________________________________________________
+
+    /**
+     * @name Renderer
+     */
+    /**
+     * Make last published frame the front buffer
+     *
+     * @return whether a new frame has been published since last latch
+     */
+    virtual bool latch (void);
+
+    /**
+     * Latch unless data has already been latched in current rendering frame
+     */
+    virtual void latch_frame (void);
+    //@}
+
+
+    // _________________________________________________________________________
+
+    /**
+     * @name Data
+     */
+    virtual void set_data (const void *data);
+    virtual void set_width (const unsigned int width);
+    virtual void set_height (const unsigned int height);
+    virtual void set_depth (const unsigned int depth);
+    virtual void set_type (const unsigned int type = GL_FLOAT);
+    virtual void set_stride (const unsigned int stride = 0);
+    //@}
+
+
+    // _________________________________________________________________________
+
+    /**
+     * @name Versioning
+     */
+    virtual unsigned long get_version (void) const;
+    virtual bool get_pending (void) const;
+    virtual bool get_dirty (unsigned long version,
+                            unsigned int &offset, unsigned int &count) const;
+    //@}
+
+
+protected:
+
+    // _________________________________________________________________________
+
+    /**
+     * Flag set in shared state when middle buffer holds an unread frame
+     */
+    static const unsigned int fresh = 4;
+
+    /**
+     * Exchange shared state (middle buffer index and fresh flag)
+     */
+    unsigned int exchange (unsigned int state);
+
+    /**
+     * Buffers
+     */
+    BufferPtr buffers_[3];
+
+    /**
+     * Index of back buffer (owned by producer)
+     */
+    unsigned int back_;
+
+    /**
+     * Index of front buffer (owned by renderer)
+     */
+    unsigned int front_;
+
+    /**
+     * Rendering frame of last automatic latch (see latch_frame)
+     */
+    unsigned long frame_;
+
+    /**
+     * Index of middle buffer and fresh flag
+     */
+    boost::atomic<unsigned int> middle_;
+};
+
+#endif
+
+#endif
@@ -37,6 +37,9 @@ Widget::Widget (void) : Object()
     fade_in_delay_ = 0;
     fade_out_delay_ = 0;
     action_ = "";
+    for (unsigned int i=0; i<6; i++)
+        decoration_[i] = -1;
+    overlaid_ = false;
 
     std::ostringstream oss;
     oss << "Widget_" << id_;
@@ -53,8 +56,8 @@ Widget::~Widget (void)
 void
 Widget::compute_size (void)
 {
-    GLint viewport[4]; 
-    glGetIntegerv (GL_VIEWPORT, viewport);
+    int viewport[4];
+    RenderState::get_viewport (viewport);
     float width  = viewport[2];
     float height = viewport[3];
 
@@ -101,8 +104,8 @@ Widget::compute_size (void)
 void
 Widget::compute_position (void)
 {
-    GLint viewport[4]; 
-    glGetIntegerv (GL_VIEWPORT, viewport);
+    int viewport[4];
+    RenderState::get_viewport (viewport);
     float width  = viewport[2];
     float height = viewport[3];
 
@@ -163,18 +166,21 @@ Widget::compute_position (void)
 
 // __________________________________________________________________ arc_circle
 void
-Widget::arc_circle (float x, float y, float radius, float theta1, float theta2)
+Widget::arc_circle (float x, float y, float radius, float theta1, float theta2,
+                    std::vector<float> &vertices)
 {
     const GLfloat delta_theta = 25.0f ;
     if(theta2 > theta1) {
         for(GLfloat theta = theta1; theta <= theta2; theta += delta_theta) {
             GLfloat theta_rad = theta * 3.14159f / 180.0f ;
-            glVertex2f(x+radius*cos(theta_rad), y-radius*sin(theta_rad)) ;
+            vertices.push_back (x+radius*cos(theta_rad));
+            vertices.push_back (y-radius*sin(theta_rad));
         }
     } else {
         for(GLfloat theta = theta1; theta >= theta2; theta -= delta_theta) {
             GLfloat theta_rad = theta * 3.14159f / 180.0f ;
-            glVertex2f(x+radius*cos(theta_rad), y-radius*sin(theta_rad)) ;
+            vertices.push_back (x+radius*cos(theta_rad));
+            vertices.push_back (y-radius*sin(theta_rad));
         }
     }
 }
@@ -182,30 +188,62 @@ Widget::arc_circle (float x, float y, float radius, float theta1, float theta2)
 
 // _____________________________________________________________ round_rectangle
 void
-Widget::round_rectangle (float x, float y, float w, float h, float radius)
+Widget::round_rectangle (float x, float y, float w, float h, float radius,
+                         std::vector<float> &vertices)
 {
     if (radius) {
-        glVertex2f  (x,            y-1-radius);
-        glVertex2f  (x,            y-h+radius);
-        arc_circle  (x+radius,     y-h+radius, radius, -180.0f, -270.0f);
-        glVertex2f  (x+radius,     y-h);
-        glVertex2f  (x+w-1-radius, y-h);
-        arc_circle  (x+w-1-radius, y-h+radius, radius, 90.0f, 0.0f);
-        glVertex2f  (x+w-1,        y-h+radius);
-        glVertex2f  (x+w-1,        y-1-radius);
-        arc_circle  (x+w-1-radius, y-1-radius, radius, 0.0f, -90.0f);
-        glVertex2f  (x+w-1-radius, y-1);
-        glVertex2f  (x+radius,     y-1);
-        arc_circle  (x+radius,     y-1-radius, radius, -90.0f, -180.0f);
+        float points[8][2] = {{x,            y-1-radius},
+                              {x,            y-h+radius},
+                              {x+radius,     y-h},
+                              {x+w-1-radius, y-h},
+                              {x+w-1,        y-h+radius},
+                              {x+w-1,        y-1-radius},
+                              {x+w-1-radius, y-1},
+                              {x+radius,     y-1}};
+        float arcs[4][4] = {{x+radius,     y-h+radius, -180.0f, -270.0f},
+                            {x+w-1-radius, y-h+radius,   90.0f,    0.0f},
+                            {x+w-1-radius, y-1-radius,    0.0f,  -90.0f},
+                            {x+radius,     y-1-radius,  -90.0f, -180.0f}};
+        for (unsigned int i=0; i<4; i++) {
+            vertices.insert (vertices.end(), points[2*i], points[2*i]+2);
+            vertices.insert (vertices.end(), points[2*i+1], points[2*i+1]+2);
+            arc_circle (arcs[i][0], arcs[i][1], radius, arcs[i][2], arcs[i][3],
+                        vertices);
+        }
     } else {
-        glVertex2f (x,     y-1);
-        glVertex2f (x+w-1, y-1);
-        glVertex2f (x+w-1, y-h);
-        glVertex2f (x,     y-h);
+        float points[8] = {x,     y-1,
+                           x+w-1, y-1,
+                           x+w-1, y-h,
+                           x,     y-h};
+        vertices.insert (vertices.end(), points, points+8);
     }
 }
 
 
+// __________________________________________________________ compute_decoration
+void
+Widget::compute_decoration (float height)
+{
+    float key[6] = {get_position().x, get_position().y,
+                    get_size().x, get_size().y, float(radius_), height};
+    bool changed = false;
+    for (unsigned int i=0; i<6; i++) {
+        if (key[i] != decoration_[i]) {
+            changed = true;
+            decoration_[i] = key[i];
+        }
+    }
+    if (not changed)
+        return;
+    fill_.clear();
+    border_.clear();
+    round_rectangle (get_position().x, height-get_position().y+1,
+                     get_size().x+1, get_size().y+1, radius_, fill_);
+    round_rectangle (get_position().x, height-get_position().y,
+                     get_size().x, get_size().y, radius_, border_);
+}
+
+
 // ________________________________________________________________ render_start
 void
 Widget::render_start (void)
@@ -214,22 +252,26 @@ Widget::render_start (void)
     compute_size ();
     compute_position ();
 
-    GLint viewport[4]; 
-    glGetIntegerv (GL_VIEWPORT, viewport);
-    glPushAttrib (GL_ENABLE_BIT | GL_VIEWPORT_BIT | GL_SCISSOR_BIT);
-
-    glMatrixMode (GL_PROJECTION);
-    glPushMatrix ();
-    glLoadIdentity ();
-    glOrtho (0, viewport[2], 0, viewport[3], -1000, 1000);
-    glMatrixMode (GL_MODELVIEW);
-    glPushMatrix ();
-    glLoadIdentity();
+    int viewport[4];
+    RenderState::get_viewport (viewport);
+    RenderState::push_attrib (GL_ENABLE_BIT | GL_VIEWPORT_BIT | GL_SCISSOR_BIT);
+
+    // Projection and depth buffer are set once for all by overlay
+    if (not overlaid_) {
+        RenderState::matrix_mode (GL_PROJECTION);
+        RenderState::push_matrix ();
+        RenderState::load_identity ();
+        RenderState::ortho (0, viewport[2], 0, viewport[3], -1000, 1000);
+    }
+    RenderState::matrix_mode (GL_MODELVIEW);
+    RenderState::push_matrix ();
+    RenderState::load_identity ();
     glDisable (GL_TEXTURE_2D);
     glDisable (GL_LIGHTING);
     glEnable (GL_BLEND);
     glLineWidth (1.0f);
-    glClear (GL_DEPTH_BUFFER_BIT);
+    if (not overlaid_)
+        glClear (GL_DEPTH_BUFFER_BIT);
 }
 
 
@@ -237,11 +279,13 @@ Widget::render_start (void)
 void
 Widget::render_finish (void)
 {
-    glMatrixMode (GL_PROJECTION);
-    glPopMatrix();
-    glMatrixMode (GL_MODELVIEW);
-    glPopMatrix ();
-    glPopAttrib ();
+    if (not overlaid_) {
+        RenderState::matrix_mode (GL_PROJECTION);
+        RenderState::pop_matrix ();
+    }
+    RenderState::matrix_mode (GL_MODELVIEW);
+    RenderState::pop_matrix ();
+    RenderState::pop_attrib ();
 }
 
 
@@ -249,39 +293,43 @@ Widget::render_finish (void)
 void
 Widget::render (void)
 {
-    GLint viewport[4]; 
-    glGetIntegerv (GL_VIEWPORT, viewport);
+    // Background and border already drawn by overlay
+    if (overlaid_)
+        return;
+
+    int viewport[4];
+    RenderState::get_viewport (viewport);
     float height = viewport[3];
+    compute_decoration (height);
+
     glPolygonMode (GL_FRONT_AND_BACK, GL_FILL);
     glPolygonOffset (1, 1);
     glEnable (GL_POLYGON_OFFSET_FILL);
     glEnable (GL_LINE_SMOOTH);
     glLineWidth (1.0f);
+    glEnableClientState (GL_VERTEX_ARRAY);
     glColor4f (get_bg_color().r,
                get_bg_color().g,
                get_bg_color().b,
                get_bg_color().a*alpha_);
-    glBegin (GL_POLYGON);
-    round_rectangle (get_position().x, height-get_position().y+1,
-                     get_size().x+1, get_size().y+1, radius_);
-    glEnd();
+    glVertexPointer (2, GL_FLOAT, 0, &fill_[0]);
+    glDrawArrays (GL_POLYGON, 0, fill_.size()/2);
 
     if (get_br_color().a*alpha_) {
         // This translation (half a pixel) is necessary to get nice antialiasing
-        glTranslatef (0.315f, 0.315f, 0.0f);
-        glTranslatef (0,0,1);
+        RenderState::translate (0.315f, 0.315f, 0.0f);
+        RenderState::translate (0,0,1);
         glColor4f (get_br_color().r,
                    get_br_color().g,
                    get_br_color().b,
                    get_br_color().a*alpha_);
         glDepthMask (GL_FALSE);
-        glBegin (GL_LINE_LOOP);
-        round_rectangle (get_position().x, height-get_position().y,
-                         get_size().x, get_size().y, radius_);
-        glEnd ();
-        glTranslatef (-0.315f, -0.315f, 1.0f);
+        glVertexPointer (2, GL_FLOAT, 0, &border_[0]);
+        glDrawArrays (GL_LINE_LOOP, 0, border_.size()/2);
+        RenderState::translate (-0.315f, -0.315f, 1.0f);
         glDepthMask (GL_TRUE);
     }
+    glDisableClientState (GL_VERTEX_ARRAY);
     glDisable (GL_POLYGON_OFFSET_FILL);
 }
 
@@ -422,6 +470,7 @@ Widget::mouse_action (int x, int y)
     } else {
         return false;
     };
+    set_dirty ();
     return true;
 }
 
@@ -430,6 +479,7 @@ Widget::mouse_action (int x, int y)
 void
 Widget::set_position (Position position)
 {
+    set_dirty ();
     position_request_ = Position (position);
 }
 
@@ -446,6 +496,7 @@ Widget::set_position (float x, float y, float z)
 void
 Widget::set_size (Size size)
 {
+    set_dirty ();
     size_request_ = Size (size);
 }
 
@@ -462,6 +513,7 @@ Widget::set_size (float x, float y, float z)
 void
 Widget::set_gravity (Gravity gravity)
 {
+    set_dirty ();
     if (gravity.x == 0)       gravity_.x = 0;
     else if (gravity.x == -1) gravity_.x = -1;
     else                      gravity_.x = 1;
@@ -490,6 +542,7 @@ Widget::get_gravity (void)
 void
 Widget::set_radius (int radius)
 {
+    set_dirty ();
     radius_ = radius;
 }
 
@@ -506,6 +559,7 @@ Widget::get_radius (void)
 void
 Widget::set_margin (Margin margin)
 {
+    set_dirty ();
     margin_ = Margin (margin);
 }
 
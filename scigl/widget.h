@@ -16,6 +16,7 @@
  */
 #ifndef __WIDGET_H__
 #define __WIDGET_H__
+#include <vector>
 #include "object.h"
 
 #ifdef HAVE_BOOST
@@ -38,6 +39,8 @@
  *
  */
 class Widget : public Object {
+    friend class Overlay;
+
 public:
 
 
@@ -351,28 +354,38 @@ protected:
     virtual void compute_position (void);
 
     /**
-     * Render an arc circle in the (x,y) plane between theta1 and theta2.
+     * Build an arc circle in the (x,y) plane between theta1 and theta2.
      *
      * @param x x center coordinate
      * @param y y center coordinate
      * @param radius arc circle radius
      * @param theta1 start angle (degrees)
      * @param theta2 end angle (degrees)
+     * @param vertices (x,y) vertices are appended to this vector
      */
     virtual void arc_circle (float x, float y, float radius,
-                             float theta1, float theta2);
+                             float theta1, float theta2,
+                             std::vector<float> &vertices);
 
     /**
-     * Render a rounded rectangle in the (x,y) plane.
+     * Build a rounded rectangle outline in the (x,y) plane.
      *
      * @param x x position
      * @param y y position
      * @param w width
      * @param h height
      * @param radius corner radius
+     * @param vertices (x,y) vertices are appended to this vector
      */
     virtual void round_rectangle (float x, float y, float w, float h,
-                                  float radius);
+                                  float radius, std::vector<float> &vertices);
+
+    /**
+     * Update background and border outlines if widget geometry changed.
+     *
+     * @param height viewport height
+     */
+    virtual void compute_decoration (float height);
 
 
 protected:
@@ -448,6 +461,29 @@ protected:
      * Maximum widget size
      */
     static Size max_size_;
+
+    /**
+     * Background outline (x,y vertices, window coordinates)
+     */
+    std::vector<float> fill_;
+
+    /**
+     * Border outline (x,y vertices, window coordinates)
+     */
+    std::vector<float> border_;
+
+    /**
+     * Geometry outlines have been computed for (x, y, w, h, radius, height)
+     */
+    float decoration_[6];
+
+    /**
+     * Whether widget is being rendered by an overlay pass
+     *
+     * The overlay has then already drawn background and border and set up the
+     * orthographic projection and depth buffer.
+     */
+    bool overlaid_;
 };
 
 #endif
@@ -0,0 +1,203 @@
+/*
+ * Copyright (C) 2008 Nicolas P. Rougier
+ *
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "worker-pool.h"
+
+
+// __________________________________________________________________ WorkerPool
+WorkerPool::WorkerPool (unsigned int threads)
+{
+#if defined(HAVE_BOOST)
+    if (threads == 0) {
+        threads = boost::thread::hardware_concurrency();
+        if (threads > 0)
+            threads--;
+    }
+    queued_ = pending_ = next_ = 0;
+    stop_ = false;
+    for (unsigned int i=0; i<threads; i++)
+        queues_.push_back (new Queue());
+    for (unsigned int i=0; i<threads; i++)
+        threads_.add_thread (new boost::thread (&WorkerPool::work, this, i));
+#endif
+}
+
+
+// _________________________________________________________________ ~WorkerPool
+WorkerPool::~WorkerPool (void)
+{
+#if defined(HAVE_BOOST)
+    wait ();
+    {
+        boost::mutex::scoped_lock lock (mutex_);
+        stop_ = true;
+    }
+    wake_.notify_all ();
+    threads_.join_all ();
+    for (unsigned int i=0; i<queues_.size(); i++)
+        delete queues_[i];
+#endif
+}
+
+
+// _____________________________________________________________________ Default
+static WorkerPoolPtr default_pool;
+
+static void
+create_default (void)
+{
+    default_pool = WorkerPoolPtr (new WorkerPool());
+}
+
+WorkerPoolPtr
+WorkerPool::Default (void)
+{
+#if defined(HAVE_BOOST)
+    static boost::once_flag once = BOOST_ONCE_INIT;
+    boost::call_once (create_default, once);
+#else
+    if (not default_pool)
+        create_default ();
+#endif
+    return default_pool;
+}
+
+
+// ____________________________________________________________________ get_size
+unsigned int
+WorkerPool::get_size (void) const
+{
+#if defined(HAVE_BOOST)
+    return queues_.size();
+#else
+    return 0;
+#endif
+}
+
+
+// ______________________________________________________________________ submit
+void
+WorkerPool::submit (Task *task)
+{
+#if defined(HAVE_BOOST)
+    if (queues_.empty()) {
+        task->run ();
+        delete task;
+        return;
+    }
+    unsigned int index;
+    {
+        boost::mutex::scoped_lock lock (mutex_);
+        index = next_;
+        next_ = (next_+1) % queues_.size();
+    }
+    {
+        boost::mutex::scoped_lock lock (queues_[index]->mutex);
+        queues_[index]->tasks.push_back (task);
+    }
+    {
+        boost::mutex::scoped_lock lock (mutex_);
+        queued_++;
+        pending_++;
+    }
+    wake_.notify_one ();
+#else
+    task->run ();
+    delete task;
+#endif
+}
+
+
+// ________________________________________________________________________ wait
+void
+WorkerPool::wait (void)
+{
+#if defined(HAVE_BOOST)
+    boost::mutex::scoped_lock lock (mutex_);
+    while (queued_ > 0) {
+        queued_--;
+        lock.unlock ();
+        run (take (queues_.size()));
+        lock.lock ();
+    }
+    while (pending_ > 0)
+        done_.wait (lock);
+#endif
+}
+
+
+#if defined(HAVE_BOOST)
+// ________________________________________________________________________ take
+WorkerPool::Task *
+WorkerPool::take (unsigned int index)
+{
+    // A task has been reserved by decrementing queued_, hence one is
+    // guaranteed to be found in some queue
+    unsigned int n = queues_.size();
+    while (true) {
+        if (index < n) {
+            Queue &queue = *queues_[index];
+            boost::mutex::scoped_lock lock (queue.mutex);
+            if (not queue.tasks.empty()) {
+                Task *task = queue.tasks.back();
+                queue.tasks.pop_back();
+                return task;
+            }
+        }
+        for (unsigned int i=0; i<n; i++) {
+            if (i == index)
+                continue;
+            Queue &queue = *queues_[i];
+            boost::mutex::scoped_lock lock (queue.mutex);
+            if (not queue.tasks.empty()) {
+                Task *task = queue.tasks.front();
+                queue.tasks.pop_front();
+                return task;
+            }
+        }
+        boost::this_thread::yield ();
+    }
+}
+
+
+// _________________________________________________________________________ run
+void
+WorkerPool::run (Task *task)
+{
+    task->run ();
+    delete task;
+    boost::mutex::scoped_lock lock (mutex_);
+    if (--pending_ == 0)
+        done_.notify_all ();
+}
+
+
+// ________________________________________________________________________ work
+void
+WorkerPool::work (unsigned int index)
+{
+    boost::mutex::scoped_lock lock (mutex_);
+    while (true) {
+        while ((not stop_) and (queued_ == 0))
+            wake_.wait (lock);
+        if (stop_)
+            return;
+        queued_--;
+        lock.unlock ();
+        run (take (index));
+        lock.lock ();
+    }
+}
+#endif
@@ -0,0 +1,201 @@
+/*
+ * Copyright (C) 2008 Nicolas P. Rougier
+ *
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef __WORKER_POOL_H__
+#define __WORKER_POOL_H__
+#include <vector>
+#include <deque>
+
+#if defined(HAVE_BOOST)
+#   include <boost/shared_ptr.hpp>
+#   include <boost/thread.hpp>
+    typedef boost::shared_ptr<class WorkerPool> WorkerPoolPtr;
+#else
+    typedef class WorkerPool *                  WorkerPoolPtr;
+#endif
+
+
+/**
+ * Pool of worker threads running CPU only tasks.
+ *
+ * The pool is used to prepare rendering data (see Object::prepare) in
+ * parallel before any GL call is issued for a frame. Tasks are spread over one
+ * queue per worker; a worker takes its own most recent task first and, when
+ * its queue is empty, steals the oldest task of another worker. The thread
+ * calling wait takes part in the work until all submitted tasks are done.
+ *
+ * Tasks must not issue any GL call. Without boost, tasks are run as soon as
+ * they are submitted.
+ */
+class WorkerPool {
+public:
+
+    /**
+     * Unit of work
+     */
+    class Task {
+    public:
+        /**
+         * Destructor
+         */
+        virtual ~Task (void) {};
+
+        /**
+         * Do the work
+         */
+        virtual void run (void) = 0;
+    };
+
+
+public:
+
+    // _________________________________________________________________________
+
+    /**
+     * @name Creation/Destruction
+     */
+    /**
+     * Default constructor
+     *
+     * @param threads number of worker threads (0 means one per core besides
+     *                the calling thread)
+     */
+    WorkerPool (unsigned int threads = 0);
+
+    /**
+     * Destructor
+     *
+     * Pending tasks are completed before workers are stopped.
+     */
+    virtual ~WorkerPool (void);
+
+    /**
+     * Pool shared by all scenes
+     *
+     * The pool is created on first call, which may come from any thread.
+     */
+    static WorkerPoolPtr Default (void);
+    //@}
+
+
+    // _________________________________________________________________________
+
+    /**
+     * @name Tasks
+     */
+    /**
+     * Get number of worker threads
+     */
+    virtual unsigned int get_size (void) const;
+
+    /**
+     * Submit a task
+     *
+     * @param task task to be run, the pool takes ownership of it
+     */
+    virtual void submit (Task *task);
+
+    /**
+     * Wait until all submitted tasks are done, running tasks meanwhile.
+     */
+    virtual void wait (void);
+    //@}
+
+
+protected:
+
+    // _________________________________________________________________________
+
+#if defined(HAVE_BOOST)
+    /**
+     * Take a task, from own queue first then from other queues
+     *
+     * @param index queue of calling worker (get_size() for none)
+     */
+    Task *take (unsigned int index);
+
+    /**
+     * Run a task then account for it
+     */
+    void run (Task *task);
+
+    /**
+     * Worker thread loop
+     *
+     * @param index queue of the worker
+     */
+    void work (unsigned int index);
+
+    /**
+     * Queue of a worker
+     */
+    struct Queue {
+        boost::mutex      mutex;
+        std::deque<Task*> tasks;
+    };
+
+
+protected:
+
+    // _________________________________________________________________________
+
+    /**
+     * Worker queues
+     */
+    std::vector<Queue *> queues_;
+
+    /**
+     * Worker threads
+     */
+    boost::thread_group threads_;
+
+    /**
+     * Protects counters below
+     */
+    boost::mutex mutex_;
+
+    /**
+     * Signaled when tasks are queued or workers must stop
+     */
+    boost::condition_variable wake_;
+
+    /**
+     * Signaled when all tasks are done
+     */
+    boost::condition_variable done_;
+
+    /**
+     * Number of queued tasks not yet taken
+     */
+    unsigned int queued_;
+
+    /**
+     * Number of submitted tasks not yet done
+     */
+    unsigned int pending_;
+
+    /**
+     * Queue receiving next submitted task
+     */
+    unsigned int next_;
+
+    /**
+     * Whether workers must stop
+     */
+    bool stop_;
+#endif
+};
+
+#endif
@@ -89,6 +89,15 @@ void on_key_pressed( int key, int action)
   }
 }
 
+/**
+ * Called when the window needs to be redrawn (exposed...).
+ * see glfwSetWindowRefreshCallback().
+ */
+void on_refresh( void )
+{
+  scene->set_dirty();
+}
+
 void display (void) {
     glClearColor (1,1,1,1);
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
@@ -141,6 +150,7 @@ void set_data( std::vector<Vec4f> &v_vec, const Color &col,
 int main (int argc, char **argv)
 {
   int width, height;
+  int drawn_width = 0, drawn_height = 0;
   data = NULL;
   
   // Initialise GLFW
@@ -164,6 +174,7 @@ int main (int argc, char **argv)
   //glutDisplayFunc (display);
   glfwSetMouseButtonCallback( on_mouse_button );
   glfwSetMousePosCallback( on_mouse_move );
+  glfwSetWindowRefreshCallback( on_refresh );
   glfwSetKeyCallback( on_key_pressed );
   //glutReshapeWindow (400,400);
   
@@ -223,10 +234,19 @@ int main (int argc, char **argv)
     // Special case: avoid division by zero below
     height = height > 0 ? height : 1;
     
-    glViewport( 0, 0, width, height );
+    RenderState::viewport( 0, 0, width, height );
     
-    // display
-    display();
+    // display only when something changed, poll events otherwise
+    if( (width != drawn_width) || (height != drawn_height) ||
+        scene->needs_redraw() ) {
+      display();
+      drawn_width = width;
+      drawn_height = height;
+    }
+    else {
+      glfwPollEvents();
+      glfwSleep( 0.01 );
+    }
     
   } // Check if the ESC key was pressed or the window was closed
   while( glfwGetKey( GLFW_KEY_ESC ) != GLFW_PRESS &&
@@ -72,6 +72,15 @@ void on_mouse_move (int x, int y) {
 //     glutPostRedisplay();
 }
 
+/**
+ * Called when the window needs to be redrawn (exposed...).
+ * see glfwSetWindowRefreshCallback().
+ */
+void on_refresh( void )
+{
+  scene->set_dirty();
+}
+
 void display (void) {
     glClearColor (1,1,1,1);
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
@@ -88,6 +97,7 @@ void display (void) {
 int main (int argc, char **argv)
 {
     int width, height;
+    int drawn_width = 0, drawn_height = 0;
 
   //glutInit (&argc, argv);
   // Initialise GLFW
@@ -114,6 +124,7 @@ int main (int argc, char **argv)
   glfwSetMouseButtonCallback( glfw_on_mouse_button );
   //glutMotionFunc (on_mouse_move);
   glfwSetMousePosCallback( on_mouse_move );
+  glfwSetWindowRefreshCallback( on_refresh );
   //glutReshapeWindow (400,400);
     
   scene->set_bg_color (1,1,1,1);
@@ -205,7 +216,7 @@ int main (int argc, char **argv)
     // Special case: avoid division by zero below
     height = height > 0 ? height : 1;
     
-    glViewport( 0, 0, width, height );
+    RenderState::viewport( 0, 0, width, height );
     
 //         // Clear color buffer to black
 //         glClearColor( 0.0f, 0.0f, 0.0f, 0.0f );
@@ -234,7 +245,17 @@ int main (int argc, char **argv)
 //           glColor3f( 0.0f, 0.0f, 1.0f );
 //           glVertex3f( 0.0f, 0.0f, 6.0f );
 //         glEnd();
-    display();
+    // display only when something changed, poll events otherwise
+    if( (width != drawn_width) || (height != drawn_height) ||
+        scene->needs_redraw() ) {
+      display();
+      drawn_width = width;
+      drawn_height = height;
+    }
+    else {
+      glfwPollEvents();
+      glfwSleep( 0.01 );
+    }
     
   } // Check if the ESC key was pressed or the window was closed
   while( glfwGetKey( GLFW_KEY_ESC ) != GLFW_PRESS &&
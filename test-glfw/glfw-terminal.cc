@@ -130,11 +130,22 @@ void terminal_history_next (Terminal *terminal, std::string input)
     terminal->print (terminal->get_prompt() + input + "\n");
     terminal->print (std::string("History next callback: \"") + input + "\"\n");
 }
+/**
+ * Called when the window needs to be redrawn (exposed...).
+ * see glfwSetWindowRefreshCallback().
+ */
+void on_refresh( void )
+{
+  terminal->set_dirty();
+}
+
 void display (void) {
     glClearColor (1,1,1,1);
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
     glBlendFunc (GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
     terminal->render ();
+    // Terminal is not hosted in a scene, nobody else clears it
+    terminal->set_dirty (false);
     // Swap buffers
     glfwSwapBuffers();
 }
@@ -147,6 +158,7 @@ void display (void) {
 int main (int argc, char **argv)
 {
   int width, height;
+  int drawn_width = 0, drawn_height = 0;
   
   // Initialise GLFW
   if( !glfwInit() ) {
@@ -169,6 +181,7 @@ int main (int argc, char **argv)
   //glutDisplayFunc (display);
   //glfwSetMouseButtonCallback( on_mouse_button );
   //glfwSetMousePosCallback( on_mouse_move );
+glfwSetWindowRefreshCallback( on_refresh );
   glfwSetKeyCallback( on_key_pressed );
   glfwSetCharCallback( on_char_key_pressed );
   //glutReshapeWindow (400,400);
@@ -219,10 +232,19 @@ int main (int argc, char **argv)
     // Special case: avoid division by zero below
     height = height > 0 ? height : 1;
     
-    glViewport( 0, 0, width, height );
+    RenderState::viewport( 0, 0, width, height );
     
-    // display
-    display();
+    // display only when something changed, poll events otherwise
+    if( (width != drawn_width) || (height != drawn_height) ||
+        terminal->needs_redraw() ) {
+      display();
+      drawn_width = width;
+      drawn_height = height;
+    }
+    else {
+      glfwPollEvents();
+      glfwSleep( 0.01 );
+    }
     
   } // Check if the ESC key was pressed or the window was closed
   while( glfwGetKey( GLFW_KEY_ESC ) != GLFW_PRESS &&
@@ -86,7 +86,8 @@ $(TGTS_$(d)):	LF_TGT := -framework OpenGL -framework GLUT -framework Cocoa \
 # 	                  -lgthread-2.0 -lboost_thread
 
 $(TGTS_$(d)):	LL_TGT := $(S_LL_INET) scigl/libscigl.a \
-                          $(GLFW_HOME)/lib/cocoa/libglfw.a
+                          $(GLFW_HOME)/lib/cocoa/libglfw.a \
+                          -lboost_thread-mt
 else
 $(TGTS_$(d)):	CF_TGT := -Iscigl \
 
@@ -95,7 +96,7 @@ $(TGTS_$(d)):	LF_TGT :=
 
 $(TGTS_$(d)):	LL_TGT := -lGL -lGLU -lGLEW \
                           $(S_LL_INET) scigl/libscigl.a \
-                          -lglfw 
+                          -lglfw -lboost_thread -lboost_system
 endif
 
 #$(CORE_OBJS_$(d)):	CF_TGT := -I. -I$(d) $(shell pkg-config --cflags gtkmm-2.4)
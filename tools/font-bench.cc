@@ -0,0 +1,108 @@
+/*
+ * Copyright (C) 2008 Nicolas P. Rougier
+ *
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <iostream>
+#include <iomanip>
+#include <ctime>
+#include <sys/resource.h>
+#include <sys/stat.h>
+
+#include "font-registry.h"
+
+/**
+ * Footprint and cold start cost of the built-in fonts.
+ *
+ *   font-bench
+ *
+ * Reports the size of this binary, the size of each encoded glyph bitmap
+ * against its decoded size and the time (and page faults) spent decoding each
+ * size the first time it is requested, then when it is requested again.
+ *
+ * No GL context is needed: only glyph bitmaps are decoded, nothing is
+ * uploaded.
+ */
+
+/** Font sizes */
+const unsigned int sizes[] = {12, 16, 24, 32};
+
+/**
+ * Current time in seconds.
+ */
+double now()
+{
+  timespec ts;
+  clock_gettime( CLOCK_MONOTONIC, &ts );
+  return ts.tv_sec + ts.tv_nsec*1e-9;
+}
+
+/**
+ * Number of minor page faults so far.
+ */
+long faults()
+{
+  rusage usage;
+  getrusage( RUSAGE_SELF, &usage );
+  return usage.ru_minflt;
+}
+
+/****************************************************************************/
+int main( int argc, char *argv[] )
+{
+  struct stat st;
+  if( stat( "/proc/self/exe", &st ) == 0 ) {
+    std::cout << "binary size      " << st.st_size << " bytes" << std::endl;
+  }
+
+  std::cout << std::endl
+            << " size    packed       raw   ratio   cold (us)  faults   warm (us)"
+            << std::endl;
+  unsigned int total_packed = 0, total_raw = 0;
+  double total_cold = 0;
+  for( unsigned int i = 0; i < 4; i++ ) {
+    FontRegistry::Region region = FontRegistry::get_region( sizes[i] );
+    unsigned int raw = region.width * region.height;
+    unsigned int packed = FontRegistry::get_packed_size( sizes[i] );
+
+    long f = faults();
+    double t = now();
+    FontRegistry::get_bitmap( sizes[i] );
+    double cold = now() - t;
+    f = faults() - f;
+
+    t = now();
+    FontRegistry::get_bitmap( sizes[i] );
+    double warm = now() - t;
+
+    std::cout << std::setw(5) << sizes[i]
+              << std::setw(10) << packed
+              << std::setw(10) << raw
+              << std::setw(8) << std::fixed << std::setprecision(2)
+              << float(raw)/packed
+              << std::setw(12) << std::setprecision(1) << cold*1e6
+              << std::setw(8) << f
+              << std::setw(12) << std::setprecision(3) << warm*1e6
+              << std::endl;
+    total_packed += packed;
+    total_raw += raw;
+    total_cold += cold;
+  }
+  std::cout << "total" << std::setw(10) << total_packed
+            << std::setw(10) << total_raw
+            << std::setw(8) << std::setprecision(2)
+            << float(total_raw)/total_packed
+            << std::setw(12) << std::setprecision(1) << total_cold*1e6
+            << std::endl;
+  return 0;
+}
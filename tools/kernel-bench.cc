@@ -0,0 +1,132 @@
+/*
+ * Copyright (C) 2008 Nicolas P. Rougier
+ *
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <cstdlib>
+#include <ctime>
+
+#include "render-kernel.h"
+
+/**
+ * Cost of each vertex preparation kernel.
+ *
+ *   kernel-bench [vertices]
+ *
+ * Times RenderKernel::prepare over packed data for every element type, color
+ * mode and size presence, i.e. once for each prepare_kernel<T,COLOR,SIZE>
+ * instance. Data is not tracked, so that everything is converted at each
+ * preparation.
+ *
+ * No GL context is needed: vertices are prepared, not drawn.
+ */
+
+/** Number of preparations timed per kernel */
+const unsigned int repeats = 20;
+
+/** Color modes and their names */
+const int colors[] = { RenderKernel::COLOR_NONE, RenderKernel::COLOR_CMAP,
+                       RenderKernel::COLOR_RGB, RenderKernel::COLOR_RGBA };
+const char *color_names[] = { "none", "cmap", "rgb", "rgba" };
+
+/**
+ * Current time in seconds.
+ */
+double now()
+{
+  timespec ts;
+  clock_gettime( CLOCK_MONOTONIC, &ts );
+  return ts.tv_sec + ts.tv_nsec*1e-9;
+}
+
+/**
+ * Time one kernel instance, returns seconds per preparation.
+ */
+template <typename T>
+double time_kernel( unsigned int n, unsigned int type, int color, bool size )
+{
+  std::vector<T> values( 8*n );
+  for( unsigned int i = 0; i < values.size(); i++ ) {
+    values[i] = T( (i % 1021) / 1021.0 );
+  }
+  DataPtr xdata( new Data() ), ydata( new Data() ), zdata( new Data() );
+  DataPtr sdata( new Data() ), cdata( new Data() );
+  xdata->set( &values[0*n], n, 1, 1, type );
+  ydata->set( &values[1*n], n, 1, 1, type );
+  zdata->set( &values[2*n], n, 1, 1, type );
+  sdata->set( &values[3*n], n, 1, 1, type );
+  cdata->set( &values[4*n], n, 1, color ? color : 1, type );
+
+  RenderKernel::Source source;
+  source.xdata = xdata;
+  source.ydata = ydata;
+  source.zdata = zdata;
+  if( size ) {
+    source.sdata = sdata;
+  }
+  if( color != RenderKernel::COLOR_NONE ) {
+    source.cdata = cdata;
+  }
+  source.cmap = Colormap::IceAndFire();
+  source.cmap->scale( 0, 1 );
+  source.color = Color( 0, 0, 0, 1 );
+  source.alpha = 1;
+  source.thickness = 1;
+
+  // First preparation allocates vertex arrays
+  RenderKernel kernel;
+  kernel.prepare( source );
+  double t = now();
+  for( unsigned int i = 0; i < repeats; i++ ) {
+    kernel.prepare( source );
+  }
+  return (now() - t) / repeats;
+}
+
+/****************************************************************************/
+int main( int argc, char *argv[] )
+{
+  unsigned int n = 1000000;
+  if( argc > 1 ) {
+    n = atoi( argv[1] );
+  }
+  if( n == 0 ) {
+    std::cerr << "usage: " << argv[0] << " [vertices]" << std::endl;
+    return 1;
+  }
+
+  std::cout << n << " vertices, " << repeats << " preparations per kernel"
+            << std::endl << std::endl
+            << " type    color  size   time (ms)   Mvertices/s" << std::endl;
+  for( unsigned int k = 0; k < 16; k++ ) {
+    bool dbl = k / 8;
+    int color = colors[(k / 2) % 4];
+    bool size = k % 2;
+    double t;
+    if( dbl ) {
+      t = time_kernel<GLdouble>( n, GL_DOUBLE, color, size );
+    } else {
+      t = time_kernel<GLfloat>( n, GL_FLOAT, color, size );
+    }
+    std::cout << std::setw(7) << (dbl ? "double" : "float")
+              << std::setw(7) << color_names[(k / 2) % 4]
+              << std::setw(6) << (size ? "yes" : "no")
+              << std::setw(12) << std::fixed << std::setprecision(3) << t*1e3
+              << std::setw(14) << std::setprecision(1) << n/t*1e-6
+              << std::endl;
+  }
+  return 0;
+}
@@ -0,0 +1,131 @@
+#!/usr/bin/env python
+#
+# Copyright (C) 2008 Nicolas P. Rougier
+#
+# This program is free software: you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation, either version 3 of the License, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program.  If not, see <http://www.gnu.org/licenses/>.
+#
+"""
+Compress a glyph bitmap header (as generated by makefont.py) with run length
+encoding, see FontRegistry::decode in scigl/font-registry.cc.
+
+Encoding is made of packets starting with a control byte c:
+  c < 128  : the c+1 next bytes are copied as is
+  c >= 128 : next byte is repeated c-126 times (2 to 129)
+
+usage: rle-font.py font_12.h [...]   (files are rewritten in place)
+"""
+import re, sys
+
+
+def parse (text):
+    """ Return (name, width, height, raw bytes) of a raw bitmap header """
+    name = re.search (r'}\s*(\w+)\s*=', text).group(1)
+    body = text[text.index('=')+1:]
+    width, height = [int(v) for v in re.search (r'(\d+)\s*,\s*(\d+)\s*,', body).groups()]
+    data = bytearray()
+    for literal in re.findall (r'"((?:[^"\\]|\\.)*)"', body):
+        i = 0
+        while i < len(literal):
+            if literal[i] == '\\':
+                m = re.match (r'[0-7]{1,3}', literal[i+1:])
+                if m:
+                    data.append (int(m.group(0), 8))
+                    i += 1 + len(m.group(0))
+                else:
+                    data.append (ord(literal[i+1]))
+                    i += 2
+            else:
+                data.append (ord(literal[i]))
+                i += 1
+    if len(data) != width*height:
+        raise ValueError ('%s: %d bytes instead of %d' % (name, len(data), width*height))
+    return name, width, height, data
+
+
+def encode (data):
+    out = bytearray()
+    literal = bytearray()
+    i = 0
+    while i < len(data):
+        n = 1
+        while i+n < len(data) and data[i+n] == data[i] and n < 129:
+            n += 1
+        if n >= 2:
+            while literal:
+                out.append (min(len(literal),128)-1)
+                out += literal[:128]
+                literal = literal[128:]
+            out.append (n+126)
+            out.append (data[i])
+            i += n
+        else:
+            literal.append (data[i])
+            i += 1
+    while literal:
+        out.append (min(len(literal),128)-1)
+        out += literal[:128]
+        literal = literal[128:]
+    return out
+
+
+def decode (data, size):
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        c = data[i]
+        if c < 128:
+            out += data[i+1:i+2+c]
+            i += 2+c
+        else:
+            out += bytearray([data[i+1]]) * (c-126)
+            i += 2
+    assert len(out) == size
+    return out
+
+
+def literal (data):
+    """ C string literal lines, octal escapes never followed by a digit """
+    lines, line = [], ''
+    for b in data:
+        c = chr(b)
+        if 32 <= b < 127 and c not in '"\\?0123456789':
+            s = c
+        else:
+            s = '\\%o' % b
+        if len(line) + len(s) > 66:
+            lines.append ('    "%s"' % line)
+            line = ''
+        line += s
+    lines.append ('    "%s"' % line)
+    return '\n'.join (lines)
+
+
+for filename in sys.argv[1:]:
+    name, width, height, raw = parse (open(filename).read())
+    packed = encode (raw)
+    assert decode (packed, len(raw)) == raw
+    guard = '__%s__' % name.upper()
+    out = open (filename, 'w')
+    out.write ('/* This file has been generated by makefont.py and rle-font.py */\n\n')
+    out.write ('#ifndef %s\n#define %s\n\n' % (guard, guard))
+    out.write ('static const struct {\n')
+    out.write ('    unsigned int width;\n')
+    out.write ('    unsigned int height;\n')
+    out.write ('    unsigned int length;\n')
+    out.write ('    unsigned char data[%d+1];\n' % len(packed))
+    out.write ('} %s = {\n' % name)
+    out.write ('    %d, %d, %d,\n' % (width, height, len(packed)))
+    out.write (literal (packed) + '\n')
+    out.write ('};\n#endif\n')
+    out.close ()
+    sys.stderr.write ('%s: %d -> %d bytes\n' % (filename, len(raw), len(packed)))
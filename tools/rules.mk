@@ -0,0 +1,62 @@
+# Standard things
+sp 		:= $(sp).x
+dirstack_$(sp)	:= $(d)
+d		:= $(dir)
+
+# Local rules and target
+CORE_HDR_$(d)	:= 
+CORE_SRC_$(d)	:= $(d)/scigl-plot.cc $(d)/font-bench.cc \
+		   $(d)/kernel-bench.cc
+
+TGTS_$(d)	:= $(CORE_SRC_$(d):%.cc=%)
+DEPS_$(d)	:= $(TGTS_$(d):%=%.d)
+
+TGT_BIN		:= $(TGT_BIN) verbose_$(d) $(TGTS_$(d))
+TAR_SRC		:= $(TAR_SRC) $(CORE_SRC_$(d)) $(d)/rle-font.py $(d)/rules.mk
+CLEAN		:= $(CLEAN) $(TGTS_$(d)) $(DEPS_$(d))
+VERYCLEAN	:= $(VERYCLEAN) $(d)/*~
+
+ifeq ($(PLATFORM), Darwin)
+$(TGTS_$(d)):	CF_TGT := -Iscigl -I/opt/local/include \
+                          -I$(GLFW_HOME)/include
+$(TGTS_$(d)):	LF_TGT := -framework OpenGL -framework GLUT -framework Cocoa \
+                          -L/opt/local/lib \
+                          -lGLEW
+$(TGTS_$(d)):	LL_TGT := $(S_LL_INET) scigl/libscigl.a \
+                          $(GLFW_HOME)/lib/cocoa/libglfw.a \
+                          -lboost_thread-mt
+else
+$(TGTS_$(d)):	CF_TGT := -Iscigl
+$(TGTS_$(d)):	LF_TGT := 
+$(TGTS_$(d)):	LL_TGT := -lGL -lGLU -lGLEW \
+                          $(S_LL_INET) scigl/libscigl.a \
+                          -lglfw -lboost_thread -lboost_system
+endif
+
+$(d)/scigl-plot: $(d)/scigl-plot.cc scigl/libscigl.a
+	@echo "===== Compiling and Linking $@"
+	$(COMPLINK)	
+
+$(d)/font-bench: $(d)/font-bench.cc scigl/libscigl.a
+	@echo "===== Compiling and Linking $@"
+	$(COMPLINK)	
+
+$(d)/kernel-bench: $(d)/kernel-bench.cc scigl/libscigl.a
+	@echo "===== Compiling and Linking $@"
+	$(COMPLINK)	
+
+# Font resources footprint and cold start, vertex preparation kernels
+.PHONY : bench
+bench: $(d)/font-bench $(d)/kernel-bench
+	./$(word 1,$^)
+	./$(word 2,$^)
+
+.PHONY : verbose_$(d)
+verbose_$(d): $(TGTS_$(d))
+	@echo "**** Generating $^"
+
+# Standard things
+-include	$(CORE_DEPS_$(d))
+
+d		:= $(dirstack_$(sp))
+sp		:= $(basename $(sp))
@@ -0,0 +1,373 @@
+/*
+ * Copyright (C) 2008 Nicolas P. Rougier
+ *
+ * This program is free software: you can redistribute it and/or modify it under
+ * the terms of the GNU General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later
+ * version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ * FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "object.h"
+#include <GL/glfw.h>
+
+#include <iostream>
+#include <vector>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <unistd.h>
+#include <boost/thread.hpp>
+
+#include "scene.h"
+#include "basis-cube.h"
+#include "curve.h"
+#include "convert.h"
+
+/**
+ * Live plot of columns read from stdin.
+ *
+ *   producer | scigl-plot [-b columns] [-n samples] [-o image.ppm]
+ *
+ * Each column is drawn as a curve of its last samples. Input is either text
+ * (one row per line, values separated by spaces, tabs, commas or semicolons,
+ * lines that are not numbers being skipped) or, with -b, binary records of
+ * native floats.
+ *
+ * Input is read by blocks in its own thread and only the last samples of
+ * each column are kept, such that memory is bounded whatever the input rate
+ * and a fast producer is never slowed down by rendering.
+ *
+ * With -o, all input is read first, then a single frame is rendered and
+ * written as a PPM image before exiting (a window is still needed for the GL
+ * context).
+ */
+
+ScenePtr scene = ScenePtr (new Scene);
+
+/** Number of samples kept per column */
+unsigned int nb_samples = 1000;
+/** Number of floats per binary record, 0 for text input */
+unsigned int nb_binary = 0;
+/** Image dumped when input ends, if any */
+const char *image_name = NULL;
+
+/** Rows read but not yet plotted, at most nb_samples */
+std::vector<float> pending;
+/** Number of columns, known after first row */
+unsigned int nb_columns = 0;
+/** Index of first pending row (pending is a ring) */
+unsigned int pending_first = 0;
+/** Number of pending rows */
+unsigned int pending_count = 0;
+/** Protect pending rows */
+boost::mutex pending_mutex;
+
+/** Size of input blocks */
+const size_t block_size = 1 << 16;
+
+/**
+ * Queue a row, dropping the oldest pending one when full.
+ */
+void push_row( const float *row )
+{
+  boost::mutex::scoped_lock lock( pending_mutex );
+  unsigned int slot = (pending_first + pending_count) % nb_samples;
+  if( pending_count == nb_samples ) {
+    pending_first = (pending_first + 1) % nb_samples;
+  }
+  else {
+    pending_count++;
+  }
+  memcpy( &pending[slot*nb_columns], row, nb_columns*sizeof(float) );
+}
+
+/**
+ * Parse complete lines of a text block, return number of bytes consumed.
+ */
+size_t parse_text( const char *begin, const char *end, std::vector<float> &row )
+{
+  const char *line = begin;
+  while( true ) {
+    const char *eol = (const char *) memchr( line, '\n', end-line );
+    if( eol == NULL ) break;
+
+    const char *p = line;
+    row.clear();
+    bool valid = true;
+    while( p < eol ) {
+      while( (p < eol) && ((*p == ' ') || (*p == '\t') || (*p == ',') ||
+                           (*p == ';') || (*p == '\r')) ) p++;
+      if( p == eol ) break;
+      float value;
+      if( not parse_number( p, eol, value )) {
+        valid = false;
+        break;
+      }
+      row.push_back( value );
+    }
+    if( valid && (row.size() > 0) ) {
+      if( nb_columns == 0 ) {
+        boost::mutex::scoped_lock lock( pending_mutex );
+        nb_columns = row.size();
+        pending.resize( nb_samples*nb_columns );
+      }
+      // Rows with another number of columns are skipped
+      if( row.size() == nb_columns ) push_row( &row[0] );
+    }
+    line = eol+1;
+  }
+  return line - begin;
+}
+
+/**
+ * Read stdin by blocks until end of input.
+ */
+void read_input()
+{
+  std::vector<char> block( block_size );
+  std::vector<float> row;
+  size_t used = 0;
+  size_t record = nb_binary*sizeof(float);
+  if( nb_binary > 0 ) {
+    boost::mutex::scoped_lock lock( pending_mutex );
+    nb_columns = nb_binary;
+    pending.resize( nb_samples*nb_columns );
+    row.resize( nb_binary );
+    if( block.size() < record ) block.resize( record );
+  }
+
+  while( true ) {
+    ssize_t n = read( 0, &block[used], block.size() - used );
+    if( n <= 0 ) break;
+    used += n;
+
+    size_t consumed = 0;
+    if( nb_binary > 0 ) {
+      // Only the last nb_samples records of a block can be plotted
+      size_t nb = used / record;
+      size_t first = nb > nb_samples ? nb - nb_samples : 0;
+      for( size_t i=first; i<nb; i++) {
+        memcpy( &row[0], &block[i*record], record );
+        push_row( &row[0] );
+      }
+      consumed = nb*record;
+    }
+    else {
+      consumed = parse_text( &block[0], &block[0] + used, row );
+      // A line longer than a block: grow block
+      if( (consumed == 0) && (used == block.size()) ) {
+        block.resize( 2*block.size() );
+      }
+    }
+    memmove( &block[0], &block[consumed], used - consumed );
+    used -= consumed;
+  }
+  // Last line may not end with a newline
+  if( (nb_binary == 0) && (used > 0) ) {
+    block.resize( used+1 );
+    block[used] = '\n';
+    parse_text( &block[0], &block[0] + used + 1, row );
+  }
+}
+
+/** Curves, one per column */
+std::vector<CurvePtr> curves;
+/** Coordinate system */
+BasisCubePtr coord;
+/** Current y range */
+Range rg_y( 0, 0, 4, 4*5 );
+/** Whether y range has been set */
+bool rg_y_set = false;
+
+/**
+ * Move pending rows into curves, growing y range if needed.
+ * Return whether there were pending rows.
+ */
+bool plot_pending()
+{
+  std::vector<float> rows;
+  unsigned int first, count;
+  {
+    boost::mutex::scoped_lock lock( pending_mutex );
+    if( pending_count == 0 ) return false;
+    rows = pending;
+    first = pending_first;
+    count = pending_count;
+    pending_first = 0;
+    pending_count = 0;
+  }
+
+  Color colors[] = { Color(0,0,0,1), Color(1,0,0,1), Color(0,0,1,1),
+                     Color(0,0.6,0,1), Color(1,0.5,0,1), Color(0.6,0,0.6,1) };
+  Position pos_rep( -0.5, -0.5, -0.5, 0);
+  Range rg_x( 0, nb_samples, 4, 4*5 );
+  Range rg_z( -1, 1, 4, 4*5 );
+  while( curves.size() < nb_columns ) {
+    CurvePtr curve = CurvePtr (new Curve());
+    curve->set_range_coordX( rg_x );
+    curve->set_range_coordZ( rg_z );
+    curve->set_fg_color( colors[curves.size() % 6] );
+    curve->set_thickness( 1.5 );
+    curve->set_position( pos_rep );
+    scene->add( curve );
+    curves.push_back( curve );
+  }
+
+  float ymin = rg_y.min, ymax = rg_y.max;
+  for( unsigned int i=0; i<count; i++) {
+    const float *row = &rows[((first+i) % nb_samples)*nb_columns];
+    for( unsigned int c=0; c<nb_columns; c++) {
+      if( not rg_y_set ) {
+        ymin = ymax = row[c];
+        rg_y_set = true;
+      }
+      if( row[c] < ymin ) ymin = row[c];
+      if( row[c] > ymax ) ymax = row[c];
+      curves[c]->add_yz( row[c], 0.0 );
+    }
+  }
+
+  // Range only grows, with some margin, to avoid rescaling every frame
+  if( (ymin < rg_y.min) || (ymax > rg_y.max) || (rg_y.min == rg_y.max) ) {
+    float margin = 0.1 * (ymax - ymin);
+    if( margin == 0 ) margin = 1;
+    rg_y.min = ymin - margin;
+    rg_y.max = ymax + margin;
+    coord->set_range_coord_y( rg_y );
+    for( unsigned int c=0; c<curves.size(); c++) {
+      curves[c]->set_range_coordY( rg_y );
+    }
+  }
+  return true;
+}
+
+void display (void) {
+    glClearColor (1,1,1,1);
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+    scene->render ();
+}
+
+/**
+ * Write back buffer as a binary PPM image.
+ */
+bool dump_image( const char *filename, int width, int height )
+{
+  std::vector<unsigned char> pixels( width*height*3 );
+  glPixelStorei( GL_PACK_ALIGNMENT, 1 );
+  glReadBuffer( GL_BACK );
+  glReadPixels( 0, 0, width, height, GL_RGB, GL_UNSIGNED_BYTE, &pixels[0] );
+
+  FILE *file = fopen( filename, "wb" );
+  if( file == NULL ) return false;
+  fprintf( file, "P6\n%d %d\n255\n", width, height );
+  // GL rows go bottom up
+  for( int y=height-1; y>=0; y-- ) {
+    fwrite( &pixels[y*width*3], 1, width*3, file );
+  }
+  fclose( file );
+  return true;
+}
+
+void usage( const char *name )
+{
+  fprintf( stderr, "Usage: %s [-b columns] [-n samples] [-o image.ppm]\n", name );
+  fprintf( stderr, "  -b columns  binary input, records of columns native floats\n" );
+  fprintf( stderr, "  -n samples  number of samples kept per column (1000)\n" );
+  fprintf( stderr, "  -o image    read whole input, write last frame as PPM and exit\n" );
+}
+
+int main (int argc, char **argv)
+{
+  int opt;
+  while( (opt = getopt( argc, argv, "b:n:o:h" )) != -1 ) {
+    if( opt == 'b' ) nb_binary = atoi( optarg );
+    else if( opt == 'n' ) nb_samples = atoi( optarg );
+    else if( opt == 'o' ) image_name = optarg;
+    else {
+      usage( argv[0] );
+      exit( opt == 'h' ? EXIT_SUCCESS : EXIT_FAILURE );
+    }
+  }
+  if( nb_samples < 2 ) {
+    usage( argv[0] );
+    exit( EXIT_FAILURE );
+  }
+
+  int width, height;
+  int drawn_width = 0, drawn_height = 0;
+
+  // Initialise GLFW
+  if( !glfwInit() ) {
+    fprintf( stderr, "Failed to initialize GLFW\n" );
+    exit( EXIT_FAILURE );
+  }
+  // Open a window and create its OpenGL context
+  if( !glfwOpenWindow( 640, 480, 0,0,0,0, 0,0, GLFW_WINDOW ) ) {
+    fprintf( stderr, "Failed to open GLFW window\n" );
+    glfwTerminate();
+    exit( EXIT_FAILURE );
+  }
+  glfwSetWindowTitle( "scigl-plot" );
+  glewInit();
+
+  scene->set_bg_color (1,1,1,1);
+  coord = BasisCubePtr (new BasisCube());
+  coord->set_range_coord_x( Range( 0, nb_samples, 4, 4*5 ) );
+  coord->set_range_coord_y( Range( -1, 1, 4, 4*5 ) );
+  coord->set_range_coord_z( Range( -1, 1, 4, 4*5 ) );
+  coord->set_position( Position( -0.5, -0.5, -0.5, 0) );
+  scene->add( coord );
+  scene->set_zoom( 1.8 );
+  scene->set_orientation( 0, 0 );
+
+  boost::thread reader( read_input );
+
+  // Headless dump: whole input, one frame
+  if( image_name != NULL ) {
+    reader.join();
+    plot_pending();
+    glfwGetWindowSize( &width, &height );
+    height = height > 0 ? height : 1;
+    RenderState::viewport( 0, 0, width, height );
+    display();
+    bool done = dump_image( image_name, width, height );
+    glfwTerminate();
+    if( not done ) {
+      fprintf( stderr, "Cannot write %s\n", image_name );
+      exit( EXIT_FAILURE );
+    }
+    return 0;
+  }
+
+  // Main loop of GLFW
+  do {
+    glfwGetWindowSize( &width, &height );
+    height = height > 0 ? height : 1;
+    RenderState::viewport( 0, 0, width, height );
+
+    plot_pending();
+    if( (width != drawn_width) || (height != drawn_height) ||
+        scene->needs_redraw() ) {
+      display();
+      glfwSwapBuffers();
+      drawn_width = width;
+      drawn_height = height;
+    }
+    else {
+      glfwPollEvents();
+      glfwSleep( 0.01 );
+    }
+  } // Check if the ESC key was pressed or the window was closed
+  while( glfwGetKey( GLFW_KEY_ESC ) != GLFW_PRESS &&
+         glfwGetWindowParam( GLFW_OPENED ) );
+
+  // Reader may still be blocked on input
+  glfwTerminate();
+  exit( EXIT_SUCCESS );
+}